@@ -0,0 +1,55 @@
+/**
+ * EPS Predictive FDIR - Feature Spec
+ * Generated by eps_forest_export.py from deploy/models/feature_spec.json; do not edit
+ *
+ * A model predicting sample t reads, for feature i of signal s at age a
+ * (a = lag + EPS_SPEC_TARGET_SHIFT):
+ *   LAG   s[t - a]
+ *   DIFF  s[t - a] - s[t - a - 1]
+ *   STAT  rolling statistic j (EPS_SPEC_STATS) over the window ending at s[t - a]
+ * EPS_SPEC_<MODEL>_FEATURES(F) expands F(index, kind, signal or j, age) once
+ * per feature in model input order; each feature engine turns it into
+ * straight-line ring loads. Rolling statistics (eps_rolling.h) are updated
+ * once per sample per EPS_SPEC_ROLLING window and stored in a ring per
+ * EPS_SPEC_STATS series, like the first differences.
+ */
+
+#ifndef EPS_FEATURE_SPEC_H
+#define EPS_FEATURE_SPEC_H
+
+#define EPS_SPEC_TARGET_SHIFT  1
+#define EPS_SPEC_MAX_AGE       14   // Oldest ring slot read, counted back from the predicted sample
+#define EPS_SPEC_RING          16   // Power of two > EPS_SPEC_MAX_AGE
+#define EPS_SPEC_HISTORY       14   // Samples before the predicted one a full row needs
+
+#define EPS_SPEC_POWER_DIFF     1   // 1: a diff feature reads this signal
+#define EPS_SPEC_VOLTAGE_DIFF   0   // 1: a diff feature reads this signal
+
+#define EPS_SPEC_N_ROLLING      0
+#define EPS_SPEC_MAX_WINDOW     0
+#define EPS_SPEC_ROLLING(R)
+#define EPS_SPEC_N_STATS        0
+#define EPS_SPEC_STATS(S)
+
+#define EPS_SPEC_POWER_N_FEATURES  10
+#define EPS_SPEC_POWER_FEATURES(F) \
+    F(0, LAG, power, 2)         /* Power_lag1 */ \
+    F(1, LAG, power, 3)         /* Power_lag2 */ \
+    F(2, LAG, power, 4)         /* Power_lag3 */ \
+    F(3, LAG, power, 7)         /* Power_lag6 */ \
+    F(4, LAG, power, 13)        /* Power_lag12 */ \
+    F(5, DIFF, power, 2)        /* Power_diff_lag1 */ \
+    F(6, DIFF, power, 3)        /* Power_diff_lag2 */ \
+    F(7, DIFF, power, 4)        /* Power_diff_lag3 */ \
+    F(8, DIFF, power, 7)        /* Power_diff_lag6 */ \
+    F(9, DIFF, power, 13)       /* Power_diff_lag12 */
+
+#define EPS_SPEC_VOLTAGE_N_FEATURES  5
+#define EPS_SPEC_VOLTAGE_FEATURES(F) \
+    F(0, LAG, voltage, 2)       /* Volt_lag1 */ \
+    F(1, LAG, voltage, 3)       /* Volt_lag2 */ \
+    F(2, LAG, voltage, 4)       /* Volt_lag3 */ \
+    F(3, LAG, voltage, 7)       /* Volt_lag6 */ \
+    F(4, LAG, voltage, 13)      /* Volt_lag12 */
+
+#endif // EPS_FEATURE_SPEC_H
@@ -0,0 +1,3859 @@
+/**
+ * EPS Predictive FDIR - Panel model (multi-target RandomForest)
+ * Generated by eps_forest_export.py from a synthetic random-split fit on NEPALISAT.csv, RAAVANA.csv, UGUISU.csv (seed 2026) -- do not edit
+ *
+ * Trees: 50, internal nodes: 2674, leaves: 2724 (2702 distinct), features: 15, outputs: power, voltage, current
+ */
+
+#include "eps_forest_multi.h"
+
+static const int16_t panel_roots[50] = {
+    0, 57, 108, 166, 215, 266, 325, 381, 436, 489, 544, 593, 646, 696, 744, 796,
+    847, 903, 952, 1003, 1058, 1112, 1164, 1209, 1251, 1300, 1349, 1406, 1458, 1514, 1572, 1624,
+    1683, 1732, 1785, 1840, 1897, 1958, 2010, 2063, 2112, 2168, 2224, 2281, 2333, 2386, 2440, 2501,
+    2563, 2615,
+};
+
+static const uint8_t panel_feature[2674] = {
+    0, 14, 14, 13, 5, 0, 4, 0, 6, 7, 0, 0, 11, 7, 13, 10, 11, 14, 1, 14, 10, 5, 13, 11,
+    4, 9, 3, 13, 0, 14, 11, 10, 7, 10, 6, 14, 11, 0, 12, 6, 0, 7, 0, 0, 11, 7, 5, 7,
+    6, 4, 1, 5, 5, 6, 0, 0, 13, 0, 14, 10, 12, 0, 10, 4, 0, 11, 14, 12, 0, 12, 12, 8,
+    2, 5, 10, 2, 11, 11, 11, 7, 0, 10, 13, 1, 0, 6, 5, 5, 0, 0, 8, 5, 5, 11, 5, 5,
+    7, 9, 1, 7, 14, 10, 0, 0, 12, 14, 2, 0, 14, 1, 11, 4, 11, 4, 6, 13, 10, 1, 11, 10,
+    6, 10, 1, 10, 7, 0, 13, 0, 13, 1, 10, 6, 1, 5, 1, 1, 0, 12, 2, 0, 12, 10, 11, 10,
+    3, 13, 8, 0, 10, 10, 0, 10, 12, 0, 6, 6, 13, 0, 6, 0, 3, 5, 2, 3, 6, 2, 12, 12,
+    11, 10, 11, 6, 3, 4, 14, 11, 11, 0, 14, 4, 10, 10, 0, 11, 1, 1, 4, 11, 0, 0, 5, 2,
+    14, 5, 6, 2, 0, 7, 0, 0, 3, 10, 2, 2, 5, 5, 2, 0, 5, 5, 0, 13, 0, 6, 8, 3,
+    11, 1, 10, 1, 9, 10, 2, 0, 11, 0, 14, 6, 0, 0, 10, 12, 5, 12, 12, 8, 1, 0, 10, 0,
+    10, 10, 14, 13, 13, 0, 10, 11, 10, 14, 12, 2, 10, 0, 0, 6, 5, 0, 6, 5, 1, 1, 0, 3,
+    14, 14, 14, 1, 11, 0, 12, 0, 10, 5, 13, 7, 6, 0, 10, 3, 0, 13, 7, 14, 6, 10, 10, 1,
+    0, 10, 11, 7, 2, 10, 1, 11, 10, 7, 1, 0, 0, 8, 5, 10, 4, 0, 0, 0, 10, 6, 0, 3,
+    5, 1, 6, 0, 10, 13, 1, 5, 14, 5, 0, 5, 6, 3, 12, 13, 0, 5, 8, 5, 5, 10, 0, 11,
+    12, 10, 0, 5, 0, 10, 0, 0, 10, 3, 8, 1, 8, 5, 5, 14, 11, 0, 10, 10, 10, 6, 10, 6,
+    5, 10, 4, 1, 2, 3, 11, 1, 2, 7, 12, 1, 2, 5, 2, 0, 13, 6, 1, 5, 5, 2, 12, 12,
+    3, 9, 8, 1, 7, 5, 2, 0, 2, 0, 10, 3, 0, 3, 10, 0, 14, 10, 0, 6, 12, 2, 1, 10,
+    2, 11, 12, 10, 12, 14, 0, 5, 2, 10, 11, 2, 12, 5, 1, 11, 4, 7, 10, 3, 0, 0, 5, 10,
+    5, 1, 0, 14, 12, 10, 10, 10, 0, 5, 9, 12, 9, 2, 13, 10, 11, 0, 14, 14, 0, 5, 10, 3,
+    12, 6, 11, 6, 1, 11, 11, 10, 7, 0, 1, 0, 5, 5, 14, 1, 10, 0, 0, 0, 10, 3, 5, 0,
+    6, 1, 5, 12, 13, 6, 1, 5, 11, 13, 11, 13, 2, 14, 5, 1, 13, 8, 6, 10, 6, 11, 10, 1,
+    10, 13, 12, 5, 0, 11, 6, 14, 10, 9, 1, 5, 0, 10, 0, 9, 10, 5, 11, 4, 10, 0, 1, 1,
+    4, 5, 0, 7, 1, 5, 4, 7, 5, 0, 13, 2, 13, 0, 12, 13, 2, 12, 13, 0, 4, 7, 1, 12,
+    10, 8, 2, 13, 14, 10, 4, 0, 9, 12, 10, 7, 12, 10, 1, 0, 10, 14, 2, 11, 13, 10, 10, 6,
+    0, 5, 10, 3, 1, 0, 13, 1, 5, 6, 14, 0, 12, 4, 14, 11, 9, 0, 11, 10, 10, 12, 12, 3,
+    6, 13, 12, 11, 7, 1, 0, 14, 1, 10, 10, 12, 10, 6, 13, 12, 13, 8, 11, 5, 10, 5, 10, 11,
+    10, 2, 1, 14, 5, 5, 5, 2, 0, 10, 11, 11, 5, 11, 12, 1, 6, 13, 0, 0, 10, 1, 1, 11,
+    0, 12, 3, 4, 5, 3, 0, 13, 5, 4, 1, 2, 4, 10, 10, 12, 1, 10, 4, 10, 13, 11, 7, 3,
+    7, 12, 5, 2, 1, 12, 8, 1, 7, 11, 1, 0, 2, 10, 1, 8, 0, 13, 2, 6, 5, 1, 14, 0,
+    10, 13, 7, 1, 3, 9, 4, 10, 10, 2, 11, 13, 2, 12, 5, 11, 11, 6, 10, 0, 11, 13, 6, 11,
+    3, 10, 5, 12, 0, 7, 14, 8, 2, 2, 3, 0, 0, 11, 5, 0, 5, 12, 0, 6, 11, 0, 10, 5,
+    0, 11, 14, 4, 14, 7, 12, 1, 1, 7, 2, 14, 0, 6, 14, 10, 12, 11, 1, 0, 10, 6, 0, 2,
+    13, 6, 10, 4, 13, 10, 3, 9, 7, 14, 2, 0, 12, 0, 11, 0, 11, 5, 1, 10, 7, 3, 10, 13,
+    5, 5, 11, 13, 4, 10, 13, 0, 11, 0, 13, 10, 12, 5, 1, 12, 3, 10, 0, 0, 14, 5, 2, 0,
+    2, 0, 1, 5, 1, 10, 1, 1, 14, 12, 4, 7, 0, 1, 10, 5, 1, 2, 1, 0, 13, 7, 0, 0,
+    0, 0, 6, 0, 7, 12, 1, 10, 2, 11, 3, 0, 5, 0, 4, 11, 5, 14, 1, 11, 7, 9, 10, 11,
+    12, 12, 11, 5, 0, 8, 7, 5, 6, 14, 8, 2, 3, 1, 5, 5, 5, 5, 5, 5, 5, 0, 5, 10,
+    5, 0, 1, 6, 2, 10, 10, 6, 0, 10, 5, 5, 1, 11, 7, 2, 12, 2, 0, 1, 9, 6, 11, 10,
+    2, 6, 4, 5, 3, 12, 11, 5, 12, 10, 1, 11, 1, 0, 12, 0, 12, 2, 9, 10, 6, 13, 14, 0,
+    0, 13, 1, 2, 7, 0, 13, 6, 14, 0, 6, 0, 1, 12, 0, 0, 1, 10, 12, 13, 3, 1, 2, 3,
+    14, 10, 3, 14, 14, 12, 11, 10, 5, 2, 11, 11, 11, 13, 7, 0, 6, 10, 10, 11, 1, 1, 10, 3,
+    0, 4, 12, 11, 5, 6, 6, 0, 0, 5, 11, 13, 9, 0, 0, 8, 14, 1, 2, 1, 10, 14, 14, 3,
+    4, 4, 4, 3, 5, 12, 1, 3, 4, 2, 1, 11, 1, 11, 10, 2, 14, 5, 11, 10, 0, 2, 12, 7,
+    11, 0, 7, 11, 0, 0, 10, 8, 2, 10, 6, 7, 8, 5, 10, 12, 7, 13, 11, 0, 5, 4, 12, 0,
+    6, 10, 0, 13, 13, 14, 1, 7, 4, 9, 0, 13, 12, 0, 11, 10, 14, 11, 9, 1, 2, 14, 11, 5,
+    13, 11, 5, 13, 0, 3, 0, 5, 1, 1, 8, 2, 10, 14, 10, 13, 10, 10, 11, 11, 6, 5, 5, 0,
+    0, 8, 1, 0, 2, 10, 0, 13, 0, 12, 12, 14, 10, 3, 1, 10, 3, 1, 11, 6, 3, 7, 11, 4,
+    0, 10, 3, 11, 3, 4, 14, 3, 0, 13, 11, 7, 8, 4, 11, 11, 10, 5, 5, 1, 0, 7, 4, 1,
+    5, 5, 7, 1, 6, 1, 3, 4, 5, 1, 13, 5, 12, 10, 11, 0, 1, 6, 3, 5, 13, 14, 10, 5,
+    11, 11, 11, 11, 3, 12, 5, 4, 4, 5, 10, 0, 12, 8, 0, 0, 0, 2, 1, 5, 1, 6, 11, 6,
+    0, 5, 5, 6, 3, 9, 14, 7, 12, 13, 11, 1, 5, 9, 6, 5, 7, 12, 4, 9, 7, 3, 4, 14,
+    6, 11, 5, 0, 0, 11, 0, 2, 11, 10, 10, 10, 5, 7, 10, 11, 8, 1, 5, 11, 0, 0, 7, 2,
+    6, 5, 5, 1, 10, 10, 6, 1, 6, 1, 10, 2, 12, 11, 12, 2, 9, 2, 11, 12, 0, 10, 14, 13,
+    12, 5, 2, 12, 3, 10, 8, 9, 11, 1, 5, 6, 9, 12, 1, 1, 5, 10, 4, 6, 5, 0, 10, 8,
+    0, 0, 12, 9, 1, 10, 11, 3, 3, 2, 0, 11, 0, 2, 0, 13, 12, 10, 11, 9, 11, 11, 8, 14,
+    10, 10, 11, 3, 4, 10, 12, 5, 11, 11, 0, 4, 14, 9, 0, 10, 0, 6, 11, 0, 0, 1, 1, 6,
+    11, 5, 11, 0, 5, 14, 10, 14, 3, 4, 6, 2, 2, 8, 4, 4, 8, 14, 4, 9, 3, 5, 0, 4,
+    13, 2, 13, 14, 1, 11, 10, 4, 6, 5, 10, 12, 10, 13, 14, 0, 11, 12, 10, 10, 5, 14, 0, 1,
+    0, 0, 0, 10, 6, 6, 5, 10, 12, 1, 1, 0, 0, 1, 13, 1, 14, 11, 2, 4, 6, 2, 10, 10,
+    0, 1, 11, 6, 12, 10, 10, 11, 7, 13, 5, 5, 1, 5, 0, 2, 2, 12, 5, 11, 5, 5, 10, 10,
+    0, 5, 10, 0, 1, 12, 10, 5, 0, 6, 5, 12, 9, 1, 0, 1, 6, 0, 13, 3, 9, 11, 11, 9,
+    10, 7, 13, 12, 11, 10, 11, 12, 2, 13, 11, 2, 8, 2, 7, 11, 6, 10, 10, 11, 0, 7, 5, 3,
+    3, 2, 11, 5, 6, 6, 7, 13, 0, 12, 10, 10, 0, 0, 12, 2, 10, 10, 9, 0, 1, 7, 1, 7,
+    7, 6, 14, 11, 11, 0, 10, 7, 11, 1, 0, 4, 3, 5, 4, 3, 3, 7, 0, 13, 10, 0, 5, 13,
+    3, 11, 6, 6, 10, 0, 10, 4, 12, 0, 6, 4, 12, 6, 11, 0, 7, 0, 10, 6, 1, 2, 1, 13,
+    7, 5, 0, 6, 0, 5, 1, 10, 3, 1, 0, 1, 12, 13, 1, 2, 1, 6, 3, 5, 7, 9, 14, 3,
+    10, 11, 3, 14, 6, 5, 14, 1, 6, 13, 5, 7, 0, 0, 1, 13, 9, 5, 3, 5, 1, 10, 11, 5,
+    0, 3, 2, 3, 6, 5, 1, 14, 4, 1, 1, 5, 10, 0, 6, 11, 0, 13, 12, 14, 0, 11, 2, 6,
+    5, 3, 1, 11, 0, 12, 12, 1, 0, 10, 10, 7, 13, 4, 6, 7, 9, 11, 11, 10, 3, 0, 0, 10,
+    3, 2, 14, 6, 3, 0, 13, 5, 6, 12, 10, 14, 0, 2, 4, 2, 14, 7, 10, 12, 0, 6, 0, 10,
+    10, 0, 0, 11, 12, 14, 4, 12, 7, 10, 11, 5, 6, 11, 11, 11, 10, 12, 1, 10, 3, 2, 0, 7,
+    0, 0, 13, 12, 12, 5, 11, 10, 2, 2, 10, 14, 0, 11, 6, 1, 4, 1, 7, 6, 2, 1, 1, 0,
+    4, 0, 9, 13, 11, 0, 12, 13, 9, 5, 13, 9, 0, 12, 0, 10, 1, 12, 11, 1, 14, 10, 4, 6,
+    4, 6, 4, 5, 7, 0, 4, 1, 10, 10, 14, 0, 5, 3, 4, 11, 10, 11, 0, 12, 5, 0, 6, 0,
+    14, 6, 1, 7, 3, 0, 1, 0, 0, 12, 0, 10, 0, 0, 1, 14, 14, 4, 6, 1, 0, 6, 1, 12,
+    5, 14, 10, 3, 10, 0, 10, 10, 8, 11, 5, 1, 3, 2, 6, 10, 0, 10, 5, 1, 11, 0, 2, 7,
+    5, 13, 2, 2, 7, 3, 1, 0, 12, 5, 1, 6, 0, 4, 0, 2, 11, 14, 2, 13, 8, 3, 13, 12,
+    12, 4, 2, 6, 1, 11, 10, 5, 14, 10, 3, 10, 2, 12, 5, 10, 5, 10, 12, 1, 2, 0, 12, 1,
+    7, 0, 0, 10, 12, 5, 2, 10, 3, 5, 0, 10, 1, 5, 11, 12, 1, 0, 2, 11, 10, 13, 0, 7,
+    2, 12, 13, 13, 13, 12, 2, 0, 3, 2, 0, 5, 11, 10, 12, 14, 3, 11, 10, 1, 13, 6, 6, 8,
+    4, 10, 10, 5, 14, 6, 0, 1, 5, 0, 6, 9, 9, 10, 1, 7, 5, 3, 7, 9, 6, 9, 12, 1,
+    0, 4, 6, 7, 5, 5, 13, 0, 6, 0, 5, 13, 5, 3, 13, 11, 11, 11, 9, 6, 9, 8, 4, 6,
+    2, 1, 3, 1, 11, 14, 0, 2, 3, 4, 0, 11, 10, 5, 2, 6, 12, 12, 11, 11, 12, 10, 0, 0,
+    0, 10, 5, 6, 0, 0, 5, 5, 9, 0, 8, 0, 5, 0, 10, 3, 14, 0, 10, 14, 4, 1, 3, 1,
+    8, 3, 4, 14, 12, 11, 2, 7, 0, 10, 2, 0, 1, 4, 2, 0, 1, 11, 11, 7, 1, 7, 7, 6,
+    6, 4, 12, 12, 4, 11, 0, 1, 2, 12, 3, 2, 5, 5, 10, 12, 0, 5, 10, 0, 1, 6, 0, 11,
+    14, 1, 9, 10, 3, 5, 3, 10, 1, 14, 1, 0, 0, 3, 10, 6, 11, 12, 10, 0, 11, 11, 6, 0,
+    3, 6, 10, 0, 11, 5, 0, 10, 1, 5, 0, 0, 6, 11, 11, 5, 11, 6, 0, 0, 1, 7, 0, 0,
+    12, 14, 11, 5, 2, 3, 0, 8, 0, 0, 14, 12, 1, 7, 2, 10, 14, 3, 13, 4, 3, 5, 6, 2,
+    6, 8, 11, 2, 10, 0, 10, 10, 2, 11, 4, 12, 6, 12, 5, 5, 11, 0, 0, 6, 10, 10, 1, 0,
+    0, 4, 6, 1, 11, 12, 11, 8, 0, 4, 14, 2, 5, 1, 6, 10, 14, 12, 13, 1, 12, 0, 10, 3,
+    10, 5, 3, 10, 10, 2, 6, 12, 10, 10, 1, 13, 4, 10, 10, 5, 11, 5, 4, 11, 7, 3, 0, 1,
+    0, 2, 1, 7, 0, 5, 10, 0, 0, 2, 2, 5, 5, 7, 0, 8, 1, 12, 14, 10, 2, 5, 5, 5,
+    10, 6, 11, 0, 10, 10, 0, 9, 0, 10, 2, 10, 0, 10, 4, 0, 6, 3, 3, 10, 0, 10, 9, 6,
+    1, 3, 1, 6, 5, 11, 2, 3, 6, 2, 0, 7, 0, 5, 7, 7, 7, 0, 5, 0, 11, 2, 10, 14,
+    0, 2, 10, 4, 14, 1, 2, 6, 10, 0, 11, 0, 12, 1, 0, 7, 0, 13, 4, 1, 11, 5, 10, 1,
+    3, 11, 14, 11, 0, 11, 10, 2, 2, 0, 5, 11, 0, 13, 11, 9, 1, 10, 5, 5, 12, 2, 14, 1,
+    6, 8, 5, 1, 11, 14, 12, 14, 14, 1, 0, 1, 11, 10, 2, 7, 2, 6, 1, 3, 13, 11, 1, 6,
+    0, 13, 5, 11, 5, 11, 10, 0, 10, 2, 3, 1, 0, 1, 10, 14, 4, 13, 5, 2, 6, 11, 9, 6,
+    2, 0, 1, 0, 5, 12, 0, 13, 12, 13, 11, 1, 10, 1, 2, 0, 5, 12, 1, 5, 0, 13, 3, 10,
+    5, 12, 1, 10, 5, 14, 0, 3, 7, 8, 11, 0, 5, 1, 1, 1, 10, 5, 6, 0, 5, 0, 5, 5,
+    12, 0, 4, 12, 7, 0, 7, 9, 5, 0, 11, 3, 11, 12, 2, 1, 3, 0, 11, 3, 13, 6, 14, 2,
+    11, 7, 12, 10, 1, 12, 12, 10, 11, 10, 10, 7, 1, 5, 12, 8, 1, 6, 1, 5, 1, 12, 12, 11,
+    11, 11, 0, 2, 10, 13, 14, 0, 12, 0, 6, 7, 1, 1, 2, 6, 8, 11, 0, 5, 12, 0, 0, 10,
+    5, 0, 13, 1, 6, 0, 13, 4, 14, 7, 6, 7, 14, 5, 13, 10, 2, 11, 1, 6, 13, 7, 4, 6,
+    10, 4, 10, 11, 11, 10, 12, 10, 2, 5, 11, 10, 10, 0, 6, 5, 12, 0, 0, 1, 0, 4, 0, 12,
+    11, 5, 5, 5, 7, 5, 12, 0, 6, 0, 0, 11, 9, 8, 14, 0, 0, 0, 2, 3, 10, 12, 12, 5,
+    14, 4, 4, 1, 0, 2, 3, 2, 12, 10, 4, 10, 14, 14, 13, 12, 10, 11, 6, 7, 1, 1, 10, 1,
+    6, 12, 4, 10, 3, 13, 10, 5, 1, 10, 1, 2, 5, 0, 10, 7, 6, 1, 0, 0, 0, 5, 1, 14,
+    1, 12, 12, 12, 2, 13, 11, 12, 6, 10, 1, 4, 2, 10, 5, 1, 1, 11, 11, 9, 11, 0, 4, 14,
+    0, 0, 5, 2, 13, 6, 0, 12, 5, 10, 11, 4, 5, 13, 8, 10, 10, 9, 2, 0, 2, 3, 1, 0,
+    6, 10, 0, 5, 9, 4, 10, 4, 9, 1,
+};
+
+static const double panel_threshold[2674] = {
+    6159.2618, 1300.37, 1245.42, 1.53,
+    0.0, 28.5192, 28.5192, 5796.527400000001,
+    0.0, 0.0, 5832.1298, 0.0,
+    1280.53, 7.083200000000943, 1257.63, 4479.55,
+    1343.1, 1341.58, 0.0, 1343.1,
+    1375.15, -6280.188800000001, 1553.72, 4916.06,
+    540959.1459, -46429.35079999999, 24089.4506, 1399.57,
+    17837.781000000003, 1326.31, 1323.26, 1350.73,
+    0.0, 1277.47, 12539.0814, 4606.23,
+    2805.25, 6856.3046, 3331.81, 49572.9868,
+    130927.8497, 124397.0783, 746314.6590000001, 171140.21759999997,
+    4960.32, -24772.23380000001, -142.22320000000764, -909.8760000000475,
+    533.7073999999557, 97780.4072, 1213676.2641999999, -320.91749999974854,
+    -51559.395099999965, 138870.7339000001, 1344010.8812000002, 1212254.5982000001,
+    4728.33, 218680.137, 4679.49, 2759.46,
+    1257.63, 5803.657200000001, 1.53, 0.0,
+    6586.0246, 1346.15, 1323.26, 4580.28,
+    21244.5206, 2933.46, 4424.6, -14.166400000001886,
+    49857.43320000001, 23876.102200000023, 1355.31, 6273.059,
+    5016.79, 4691.7, 2780.83, 7.083200000004581,
+    48491.866799999996, 5152.63, 5125.15, 1117416.9211,
+    686811.4852, 512.3645999999717, -196176.92240000004, -441783.71420000005,
+    474833.9232, 443445.89900000003, 426.76280000000224, 153026.46970000002,
+    121344.85200000007, 5077.84, 43442.10439999995, -625.5245000000577,
+    150905.06259999995, -73321.08829999994, 762806.057, -67052.5344,
+    4706.96, 4694.75, 1369052.1260000002, 1102211.08,
+    5082.42, 4700.85, 1811534.2498, 1957484.9039000003,
+    4945.05, 12304.3572, 1321.73, 35.6643,
+    1.53, 28.5192, 0.0, 1283.58,
+    1268.32, 6137.9656, 2495.42, 1923.08,
+    0.0, 2177.96, 0.0, 4311.66,
+    -14.212999999999738, 641093.8881, 2863.25, 18143.5702,
+    1340.05, 19238.856600000003, 4600.12, -28.472600000000966,
+    170520.7907, -86684.11640000017, 1505506.4362, 1224108.6805999998,
+    1225958.6937, 4896.21, 1461452.6331999998, 323202.2075,
+    4964.9, 4819.9, 1440.78, 4629.12,
+    23157.7302, 4865.69, 42.638999999995576, 239452.3496,
+    5082.42, 4797.01, 24210.3776, 5158.73,
+    5100.73, 757955.5277, 0.0, -140555.37050000008,
+    5250.31, 523185.74040000007, 41471.3735000001, 472786.67059999995,
+    337754.43520000007, 0.0, 1292176.2559999998, 1114057.76,
+    205704.1083999998, 969476.8135999999, 4627.59, 2794.57,
+    1306.47, 1259.16, 1.53, 0.0,
+    0.0, 11806.4828, 1289.68, 1280.53,
+    1376.68, 0.0, 1341.58, 12389.7284,
+    2831.2, 2440.48, 23548.9372, 3084.55,
+    12980.0106, 13556.126400000001, 282605.0898, 4362.03,
+    21052.482, 119894.2857, 533.3370000000068, 84096.22400000002,
+    4178.88, 322316.44719999994, 65017.78210000004, 1485385.0,
+    72076.4064, -291373.9226, 23883.199, 22780.7828,
+    23278.6572, 5189.26, 173359.71839999998, 23328.4726,
+    24217.322599999985, 53435.52240000013, 296381.4595, 855047.144,
+    26497.987400000216, -88762.74159999983, 1311074.7478, 4720.7,
+    1646140.4352, 16670.954400000395, 175878.73120000027, 12290.097600000001,
+    2513.74, 35.6643, 1.53, 28.5192,
+    0.0, 1303.42, 0.0, 0.0,
+    1347.68, 11820.7424, 1268.32, 14.166400000000067,
+    6763.850200000001, 6287.3186000000005, 2452.69, 3782.05,
+    0.0, 2541.21, 2548.84, 35.60239999999976,
+    120819.22649999999, 24238.8502, 4545.18, 21415.2164,
+    2950.24, 2625.15, 1320.21, 1285.1,
+    1329.37, 12652.832, 2857.14, 5036.63,
+    4252.14, 5059.52, 4572.65, 607731.5608999999,
+    5239.62, 214487.83299999998, 143265.13700000002, 119296.3692,
+    48523.24319999998, 272469.8007, 170.78820000000997, 49985.74079999991,
+    2152878.6774000004, 1267940.5577999998, 2207478.3156, 839353.6685999999,
+    4662.7, 4705.43, 4523.81, 11948.706,
+    1343.1, 5889.0284, 1.53, 28.5192,
+    1304.95, 7.129799999999705, 1268.32, 7.0832000000000335,
+    -4573.230799999999, 7432.3738, 1399.57, 8947.2932,
+    17965.698, 1332.42, 0.0, 1309.52,
+    -14.166400000000067, 2748.78, 1335.47, 13307.1892,
+    993242.2843999999, 4554.33, 3756.11, 2041.2664000000004,
+    1171103.0015999998, 4737.48, 389790.2764, 4554.33,
+    1361.42, -21.342800000000352, 6337.0874, 6073.9372,
+    17958.6614, -22866.154, -35.55580000000191, 4888.58,
+    24146.3492, 21379.6606, 133190.343, 146210.65769999998,
+    5058.0, 427.21119999996154, 862305.7420000001, 669083.0068,
+    74573.82479999994, 590084.0451, 97221.95719999995, 734106.3016,
+    4615.38, 5221.31, 1218289.3575, -37977.74079999991,
+    5158.73, 75879.17859999998, 1373497.2225000001, -11346.493600000162,
+    -80218.82159999991, 49004.000799999994, 2551.89, 1.53,
+    28.5192, 0.0, 0.0, 0.0,
+    0.0, 1350.73, 11806.4828, 2451.16,
+    1349.21, 1320.21, 6770.9334, 23513.288199999988,
+    19324.2278, 2951.77, 11216.154, 0.0,
+    4575.7, 20824.8876, 22709.6712, 438071.5426,
+    234.6776000000027, 244432.30100000004, 222798.55069999993, 2298.53,
+    5267.09, 218073.29950000002, 4607.75, 4058.3,
+    1456.04, -5206.152000000002, 4566.54, -981.4891999999963,
+    -192.08519999999407, 4647.44, 347744.16599999997, 86429.02,
+    70220.0022, 325162.2608, 4975.58, 71649.597,
+    1283081.25, 25043.44709999999, 5274.73, 477055.21440000006,
+    519576.404, 42900.46120000002, 766971.7703999999, 793835.4863999999,
+    5282.36, -91000.10019999999, 1754037.8289, 48306.44160000002,
+    -51692.533000000054, 13655.664, 1297.31, 1.53,
+    28.5192, 0.0, 0.0, 28.5192,
+    0.0, 7.0832000000000335, 5981.4828, 6009.9088,
+    5803.657200000001, 5910.3712, 1317.16, 6137.9656,
+    6059.7242, 0.0, 1308.0, 12105.1888,
+    1317.16, 1430.1, 12403.894800000002, 0.0,
+    1341.58, 8869.0984, 22638.559600000004, 2854.09,
+    49587.1532, 4299.45, 1306.47, 1286.63,
+    1285.1, 2881.56, 19096.6334, 35.55579999999463,
+    22439.3912, 4465.81, 5048.84, 35220.28,
+    4929.79, 272811.28469999996, 215122.8618, 4607.75,
+    116585.66429999999, 512.087400000004, 4885.53, 858405.1516000001,
+    93000.9248, 766971.7703999999, 118556.80949999992, 4871.79,
+    152713.33619999993, 1616581.2666, 971467.9928, 4664.22,
+    2776.25, 1356.84, 1246.95, 1.53,
+    28.5192, -28.5192, 0.0, 1245.42,
+    0.0, 6088.1502, 1289.68, 1282.05,
+    1311.05, 11948.706, 1269.84, 1575.09,
+    11984.2618, 277.40980000000036, 2916.67, 8100.944,
+    1894.08, 995.7487999999994, 2689.26, 64.02839999999742,
+    263549.3334, 4619.96, 4455.13, 4079.67,
+    -2147.933799999999, 20405.301199999998, 62922.861600000004, 42545.98640000001,
+    0.0, 362.64120000001276, 4899.27, 216728.802,
+    5061.05, 373221.1924, 64800.5154, 1164064.9526999998,
+    5047.31, 301839.99120000005, 110323.56160000002, 605025.3203,
+    -24872.359600000083, 459970.42039999994, 148135.6487999999, 4697.8,
+    4667.28, 31630.963299999945, 1870896.3418, 41527.78860000009,
+    4723.75, 4166.67, 1352.26, 1.53,
+    28.5192, 0.0, 7.145099999999996, 28.5192,
+    1269.84, 0.0, 7.129799999999705, 1266.79,
+    7.129799999999705, 1344.63, 1344.63, 18897.465,
+    1984.13, 1335.47, 1494.2, -14.213000000001557,
+    12631.4892, 3382.17, 20419.6074, 3318.07,
+    4554.33, 0.0, 328391.58300000004, 22986.33030000003,
+    20270.1612, 4133.09, 17937.318600000002, 39970.51259999978,
+    4751.22, -256.0203999999976, 5053.42, 1123426.9242,
+    5273.2, 1351055.6539999999, 1136844.702, 238100.65959999998,
+    1311074.7478, -99895.48609999986, 1252572.2712, 24146.319499999983,
+    282552.2077, 24196.21120000002, 949129.7318000001, 28122.72860000003,
+    24914.797699999996, 323561.09280000004, 4703.91, 1085978.0289999999,
+    4673.38, 1552130.6112000002, 5355.62, 4716.12,
+    12389.7284, 1256.11, 1.53, 28.5192,
+    28.5192, 0.0, 28.5192, 1250.0,
+    1245.42, 0.0, 0.0, 1254.58,
+    2336.69, 1317.16, 11948.706, 5903.2414,
+    0.0, 1356.84, 1320.21, 0.0,
+    4618.44, 1349.21, 6130.835800000001, 0.0,
+    5071.73, 4913.0, 1401907.0976, 4642.86,
+    4474.97, 4571.12, 2596.15, 44110.7212,
+    42901.5444, -433.846000000005, 4609.28, 327936.6864,
+    317036.9956, 70049.3064, 4787.85, 536645.1408,
+    -21834.176199999987, 97554.41959999967, 4746.64, 1375027.8709999998,
+    4734.43, 932709.0222, 4565.02, 5167.89,
+    0.0, 6059.7242, 1379.73, 1266.79,
+    1257.63, 1245.42, 1.53, 0.0,
+    0.0, 1263.74, 1263.74, 1343.1,
+    0.0, 0.0, 5988.566, 1343.1,
+    0.0, 4545.18, 4464.29, 4227.72,
+    1794.87, -23164.86, 4902.32, 4513.13,
+    1898.66, 0.0, 1321.73, 0.0,
+    1388.89, 0.0, 1318.68, 1366.0,
+    3047.92, 11934.493, 7105.241800000001, 4629.12,
+    -85.32459999999992, -718.3390000000036, 44452.0196, 108438.3531,
+    42304.132399999995, 5131.26, 4412.39, 5155.68,
+    72524.4188, 4777.17, 4789.38, 407335.33900000004,
+    -107154.65459999989, 5041.21, 281865.2859, 922364.7984,
+    5071.73, 1719631.5645, 19558.9054, 1256.11,
+    28.5192, 1.53, 28.5192, 0.0,
+    7.129799999999705, 35.6643, 5810.787, 1323.26,
+    0.0, 6081.067, 5860.555800000001, 6073.9372,
+    12275.9312, 1318.68, 1320.21, 1585.78,
+    6913.2032, 1422.47, 12361.2092, 2704.52,
+    2806.78, 2960.93, 72013.36079999991, 206036.58599999998,
+    10007.1636, 4937.42, 21799.293599999975, 48875.944,
+    244360.8487, 4673.38, 170.74240000000282, 968168.363,
+    -175842.7093, 4885.53, 542435.5746, 1256717.785,
+    1496225.865, 4731.38, 525201.6825, 341.3915999999881,
+    350930.9694, 5013.74, 1385175.7155999998, 99146.39229999983,
+    -13331.279900000198, 687807.2764999999, 4638.28, 2076807.276,
+    4539.07, 1.53, 0.0, 28.5192,
+    28.5192, 7.145099999999996, 28.5192, 1343.1,
+    1306.47, 6052.5944, 1245.42, 1297.31,
+    6308.6614, 1332.42, 0.0, 3759.16,
+    2788.46, 71.11159999999927, 2820.51, 20369.698800000002,
+    4126.98, 4619.96, 20440.506800000003, 5178.57,
+    547667.2755999999, 5085.47, 30099.406000000006, 5091.58,
+    1570436.844, -172718.7638999999, 4691.7, 222006.0628,
+    1057518.7875, 467805.8016, 1778904.8520000002, 1177383.5996,
+    231556.1495, 5006.11, 14000.780200000008, 72119.0454,
+    1338.5176999997348, 5039.68, 801120.4608, 43616.110500000184,
+    5001.53, 1320663.2674000002, 5198.41, 26224.281000000425,
+    11479.3042, 1308.0, 1257.63, 35.6643,
+    1.53, 0.0, 1256.11, 5796.527400000001,
+    5803.657200000001, 7.0832000000000335, 0.0, 1274.42,
+    6052.5944, 0.0, 1266.79, 2448.11,
+    1437.73, 1401.1, 6173.5214, 8762.384399999999,
+    1448.41, -128.01020000000062, 0.0, 0.0,
+    4954.21, -241.8074000000015, 1318.68, 12418.154400000001,
+    1291.21, 1272.89, 11820.7424, -14.25959999999941,
+    -14.25959999999941, 1317.16, 17901.809400000002, 17837.781000000003,
+    1277.47, 972467.0572000002, 4392.55, 12887.5562,
+    1329.37, 3314.3318, 24423.759, 4963.37,
+    23421.177800000063, 1733999.8428, 5091.58, 4714.59,
+    -26884.35360000003, -86684.11640000017, 4717.64, 4714.59,
+    19822.0556, 4713.06, 2177.96, 5889.0284,
+    1245.42, 35.6643, 1343.1, 1739.93,
+    1318.68, 2496.408599999999, 13321.4022, 2574.79,
+    12133.6614, 2858.67, 43072.2868, 13669.9236,
+    2165.75, 43696.226900000125, 1214110.7056, 118720.16100000001,
+    107264.46149999999, 837389.3023999999, 590937.6132, 198344.01839999994,
+    905089.3156000001, 4650.49, 19509.1366, 6308.6614,
+    5242.67, 1423.99, 1168086.6432, -355.60459999999875,
+    324308.5376, 64715.0976, 4606.23, 170.78819999998086,
+    540498.7684, 219866.2425, 49032.4268, 67574.2872,
+    5013.74, 0.0, 143222.3429, 131055.9523,
+    354935.59520000004, 1895289.8869999999, -49858.26560000004, 1034127.6172,
+    144877.4846999998, 4697.8, 2058088.1635000003, 4563.49,
+    12290.097600000001, 1.53, 28.5192, 28.5192,
+    0.0, 28.5192, 28.5192, 1628.51,
+    21.342800000000352, 1298.84, 0.0, 2564.1,
+    135.13999999999942, -832.1828000000023, 4268.93, 2799.15,
+    1289.68, 1280.53, 1332.42, 78.24139999999898,
+    13420.9864, -21.342799999998533, -1913.2095999999983, -21137.8532,
+    -355.6046000000024, 4558.91, 291.622800000001, 346931.8528,
+    21393.873600000003, 21457.902, 21365.49420000001, 0.0,
+    49501.875199999995, 419.632999999998, -14.25959999999759, 173309.37500000012,
+    21855.89810000002, 23840.56, -42.63900000000285, 4900.79,
+    176596.5084, 387871.3780000001, 453613.17600000004, -111109.92920000001,
+    1680911.3088, 5155.68, 4677.96, -296162.93019999994,
+    867891.2507999999, 5126.68, -92090.5072, -98915.37459999998,
+    1872104.7213, 5038.16, 117339.93800000031, 11052.5414,
+    1.53, 28.5192, 28.5192, 0.0,
+    -7.145099999999996, -7.145099999999996, 1343.1, 1298.84,
+    0.0, 0.0, 5810.787, 0.0,
+    0.0, 1301.89, 2203.91, 0.0,
+    1372.1, 1546.09, 0.0, 4829.06,
+    24245.933399999998, 865123.104, 1330.89, 17837.781000000003,
+    1286.63, 11977.132, 0.0, 1277.47,
+    0.0, 1286.63, 2847.99, 86514.3912,
+    12588.850199999999, 4123.93, 59743.53, 21472.115,
+    46485.89920000003, 1904435.4655999998, 4729.85, 125175.12520000013,
+    1382.78, 1346575.5067999999, -1620.6479999999283, 1723518.1278,
+    1045893.8475, 4752.75, 2120564.8047, 2261049.994,
+    21379.6606, 4568.07, 1250.0, 1.53,
+    28.5192, 28.5192, 28.5192, 5796.527400000001,
+    1246.95, 1320.21, 0.0, 1289.68,
+    4655.07, 4473.44, 2670.94, 4481.07,
+    775.2375999999967, 0.0, 4891.64, 4650.49,
+    5047.31, 1967.34, 0.0, 796794.8208,
+    57.03839999999036, 5056.47, 4710.01, 4621.49,
+    416170.848, 23933.0144, 5076.31, 411559.0892,
+    188669.5008, 21102.297400000003, 4481.07, 5018.32,
+    294449.06139999995, 47055.12280000001, 108701.6745, 1316263.7056,
+    1035305.0249999999, -50378.94120000012, 4711.54, 4586.39,
+    0.0, 1186662.303, 1146006.4413, -19819.688300000038,
+    4732.91, 1693160.996, 1447838.3107999999, 20668.4514,
+    1294.26, 1256.11, 1.53, 28.5192,
+    28.5192, 28.5192, 5796.527400000001, 0.0,
+    -7.129799999999705, 1275.95, 5917.4544, 0.0,
+    11806.4828, 11920.28, 0.0, 1279.0,
+    20376.8286, 1355.31, 1317.16, 6059.7242,
+    1350.73, 149.35300000000097, 3837.0, 4136.14,
+    548813.3505, 48193.1608, 4662.7, 142.22319999999308,
+    4549.76, 21962.859600000003, 78.24139999999898, 5061.05,
+    46087.866, 152641.8348, 4659.65, -568.8927999999869,
+    296210.3137, 5022.89, 16236.137799999968, -145006.32480000003,
+    -4611.1440000000875, -25014.13029999996, 4969.47, 4726.8,
+    -72083.29859999986, 4726.8, 5219.78, 1889843.4015000002,
+    142189.02879999997, 459830.9736, 5053.42, 2042245.0238,
+    59067.42240000004, 4705.43, 11820.7424, 1295.79,
+    1265.26, 1.53, 28.5192, 0.0,
+    28.5192, 0.0, 0.0, 1245.42,
+    1292.74, 5924.584199999999, 1272.89, 1272.89,
+    1343.1, 1323.26, -7.129799999999705, 6088.1502,
+    0.0, 1327.84, 1327.84, 0.0,
+    4687.12, 4165.14, 120.92699999999786, 4594.02,
+    0.0, 447799.47000000003, 264018.4539, 28.426000000003114,
+    22759.440000000002, 12389.7284, -28.472600000000966, 19886.084,
+    4671.86, 5257.94, 5120.57, 4482.6,
+    4635.23, 2941.09, 4635.23, 5045.79,
+    21536.407799999957, 45625.538699999976, -121792.31650000019, 1325726.553,
+    367174.388, -76959.90469999996, 1235730.732, 529602.6936,
+    95447.4248, 5286.94, 1350663.4232, 4708.49,
+    17880.420000000002, 2960.93, 1350.73, 1246.95,
+    1.53, 28.5192, 5803.657200000001, 1283.58,
+    5903.2414, 6059.7242, 1419.41, 0.0,
+    0.0, 71.11160000000018, 2318.38, 6401.1158000000005,
+    0.0, 4906.9, 233050.0, 4308.61,
+    0.0, 23954.357200000002, 4708.49, 20120.808200000003,
+    282040.4482, 4130.04, 3866.0, 0.0,
+    583.2456000000002, 6884.730600000001, 5000.0, 4644.38,
+    4638.28, -19358.74410000001, -25341.583599999998, 96414.8408,
+    145100.8081, -43005.92669999995, 939936.8735999999, 880734.5136,
+    47012.30559999996, -331809.72940000007, -86074.18899999978, 907139.449,
+    -118200.05340000021, 573180.4881000001, 144929.91139999998, 23812.087400000004,
+    3927.7556999999797, 981996.2596, 4594.02, -173004.29350000003,
+    4563.49, 2866.3, 1.53, 28.5192,
+    28.5192, 0.0, 28.5192, 0.0,
+    2164.22, 1274.42, 1268.32, 0.0,
+    2489.32, 1486.57, 2579.37, 4123.93,
+    7610.1993999999995, 1939.87, 71.15819999999985, 13733.905400000001,
+    21386.790399999998, 28.519200000002456, 4537.55, 20263.0314,
+    4548.23, -277.40979999999763, 63264.25320000001, 2022366.5784,
+    939597.9392, 540468.1241, 64949.8218, 48705.248199999995,
+    419628.367, -5760.995999999926, 5268.62, 75377.14559999981,
+    1410701.7049999998, -129264.37709999993, -279416.90249999997, 9064.799099999946,
+    1013468.2821000001, -156.48279999999795, 4714.59, 90998.3385000003,
+    4739.01, 1321.73, 1245.42, 28.5192,
+    0.0, 0.0, 0.0, 7.145099999999996,
+    0.0, 1.53, 5796.527400000001, -47117.78140000001,
+    14.166400000000067, 6109.493, 0.0, 1320.21,
+    21.342799999999443, 1294.26, 42.63900000000103, 21991.3322,
+    15547.5774, 1364.47, 6251.7627999999995, 6251.7627999999995,
+    1344.63, 2727.41, 1750.61, 3028.08,
+    2446.639799999997, -462.2719999999972, 4146.83, 4305.56,
+    219263.5505, 217399.2942, 23498.983599999978, 4600.12,
+    368263.14559999993, 564332.1421, -144296.98089999997, 1032336.9222,
+    86917.8254999998, -67809.70400000038, -166132.16399999987, 6059.7242,
+    1343.1, 1.53, 0.0, 28.5192,
+    -7.145099999999996, 28.5192, 1271.37, 0.0,
+    1256.11, 1245.42, 1303.42, 0.0,
+    -6251.7627999999995, 0.0, 1553.72, 1370.57,
+    0.0, 3571.43, 5175.52, 1361.42,
+    1387.36, 0.0, 17859.030600000002, 1282.05,
+    11948.706, 1317.16, -21.389399999996385, 0.0,
+    1304.95, 6081.067, 255.97379999999976, 85.32459999999901,
+    14.213000000001557, 4531.44, 19018.392, 12162.0874,
+    -56.89860000000044, 2797.62, 20960.027599999998, 689.866399999999,
+    -597.4120000000003, 667089.3195, 4635.23, -1557.6049999999996,
+    182124.36, 2036402.3440000003, 4942.0, 21166.2792,
+    6586.0246, 1341.58, 1289.68, 35.6643,
+    0.0, 0.0, 28.5192, 1245.42,
+    5810.787, 6145.0488000000005, 6052.5944, 1306.47,
+    1308.0, 1320.21, 1318.68, -2588.909600000001,
+    4903.85, 1353.79, 0.0, 1352.26,
+    1344.63, 1477.41, 1410.26, 0.0,
+    0.0, 1344.63, 1340.05, 0.0,
+    1282.05, 1271.37, 12332.7832, 11948.706,
+    1268.32, 0.0, 946799.0731, 4648.96,
+    12574.637200000001, 0.0, 4470.39, 449592.41300000006,
+    243578.7329, 857780.3315999999, 1216650.4519, 53641.892799999914,
+    5265.57, 196838.04209999996, 5001.53, 1523668.3176,
+    -50679.865600000136, 1341.58, 1266.79, 1248.47,
+    85.3712, 28.5192, 0.0, 28.5192,
+    5803.657200000001, 0.0, 5810.787, 0.0,
+    0.0, 1257.63, 5874.768800000001, 0.0,
+    5903.2414, 14.25959999999941, 6145.0488000000005, 5903.2414,
+    1309.52, 5981.4828, 1318.68, 1280.53,
+    12375.468799999999, 4639.8, 1308.0, 6059.7242,
+    291.6228000000001, 223054.5549999997, 4691.7, 4633.7,
+    2687.73, 1588.83, 1344.63, 11237.4968,
+    4273.5, 2858.67, 4615.38, 4558.91,
+    -384.0771999999997, 4687.12, 1175136.96, 305183.82180000003,
+    917499.312, 290576.4848, 97325.21840000001, 5085.47,
+    -426.82219999999506, 47922.695999999996, -97832.37939999998, 5079.37,
+    4735.96, 1991325.1600000001, 1674421.6320000002, 1536250.6107,
+    1218656.7563999998, 1705782.4264, 4574.18, 19117.9296,
+    1280.53, 1.53, 28.5192, 28.5192,
+    0.0, 5903.2414, 1277.47, 2558.0,
+    6379.773, 0.0, 1318.68, -7.129800000000614,
+    2635.84, 3893.47, 4597.07, 4406.29,
+    -49.81539999999586, 4566.54, -35.55580000000191, 289703.51780000003,
+    396241.86419999995, 192.03859999999986, 1279494.8893999998, 47695.286400000005,
+    22652.7726, 3994.2, 0.0, 4557.39,
+    23812.087400000004, 860.5622000000003, 5093.1, 4943.53,
+    23890.328800000003, 47873.158599999995, 5096.15, 964097.3265000001,
+    214553.7537, 4671.86, 4601.65, 49.92389999999432,
+    435936.80460000003, -73629.87859999994, 83886.33019999991, 4935.9,
+    134358.85129999975, 1677666.4704, 1570436.844, 1159626.1494999998,
+    1307.9010000000708, 1347925.4984, 4662.7, 6756.7204,
+    -42.638999999999214, 4681.01, 1301.89, -5917.4544,
+    1947.5, 270.27999999999884, 1318.68, 1259.16,
+    1.53, 1317.16, 4421.55, 1346.15,
+    12389.6818, 1318.68, 1289.68, 11820.7424,
+    0.0, 11664.213000000002, 7.129800000000614, 1324.79,
+    21913.090799999998, 3321.12, 2829.67, 4525.34,
+    1218253.4256, 87130.05080000001, 109114.34309999994, 1013886.3275000001,
+    146210.65769999998, 236109.0143, 4774.11, 35.55579999999463,
+    0.0, 25043.44709999999, 52483.43599999999, 4914.53,
+    354081.87200000003, 4742.06, 4661.17, 5109.89,
+    1045893.8475, 630366.1493, 4731.38, 792811.3529999999,
+    4685.59, 1527.78, 77505.80299999999, 984426.7210000001,
+    900130.0111000001, -253778.9796000002, 1046554.6709, 25407.00459999987,
+    -59147.63919999963, -47801.16800000006, 1341.58, 1280.53,
+    1268.32, 28.5192, 1.53, 7.145099999999996,
+    1257.63, 5803.657200000001, 35.6643, 5867.685600000001,
+    5974.353, 0.0, 5924.584199999999, 11820.7424,
+    11906.020400000001, 14.166400000000067, 11962.9656, 1297.31,
+    1289.68, 0.0, 14.166400000000067, 1324.79,
+    11977.132, 4658.12, 120.92700000000059, -7.129799999999705,
+    4430.71, 21201.8816, 2344.32, 10270.220599999999,
+    1343.1, 0.0, 7.0832000000000335, 415187.4888,
+    1370.57, -28.472599999999147, 3058.61, 13100.937600000001,
+    21.342799999998533, 13556.126400000001, 4534.49, 0.0,
+    0.0, 527421.1833, 304785.7358, 4439.87,
+    241.8074000000015, 263.1502000000037, 548857.4653, 49852.23899999994,
+    628194.4647999998, -44679.350800000015, 1960460.3325, 4706.96,
+    2046329.036, 1349881.5252, 1208180.8161, 1535287.7004,
+    2742.67, 1.53, 28.5192, 28.5192,
+    0.0, 0.0, 28.5192, -7.145099999999996,
+    0.0, -28.472600000000057, 1356.84, 6258.846,
+    1335.47, 1300.37, 5910.3712, 1341.58,
+    0.0, 0.0, 1304.95, 6180.6046,
+    192.03859999999986, 1375.15, 903.2944000000007, 40843.62609999998,
+    23214.628800000002, 20917.388600000002, 0.0, 4919.11,
+    42.685600000000704, -142.22320000000036, 23655.604600000002, 106.71400000000358,
+    257797.0304, 4732.91, 4638.28, 23883.199,
+    311459.2234, 1108614.7475, 740339.7231000001, 618342.8894,
+    217396.43669999973, 65780.67429999998, 981996.2596, 1558.3,
+    146466.86289999998, 1049565.7251, 1474245.122, -24317.044999999925,
+    5025.95, 1177723.6692, -3411.943500000052, 5155.68,
+    85660.8656, 4575.7, 1437.73, 1269.84,
+    28.5192, 1.53, 5803.657200000001, 0.0,
+    7.129800000000614, 6173.5214, 13591.682200000001, 2875.46,
+    12930.2418, 3884.31, 4406.29, 19018.392,
+    21657.0704, 4334.55, 3837.0, -323880.30819999997,
+    5007.63, 383258.41620000004, -56.89860000000044, -1699.874800000005,
+    71.11160000000018, 4812.27, 5099.21, 4836.69,
+    24167.692, 776989.356, 324311.61040000006, 4893.16,
+    368005.3146, 64010.925, 5199.94, -70789.4205,
+    676139.5101, 228568.44850000003, 5050.37, 66806.4558,
+    -179123.03999999992, 4507.02, 5027.47, 5230.46,
+    552921.3150000001, 945799.5222, 47553.063200000004, 479834.9046,
+    4580.28, 50909.84590000007, 4732.91, 4687.12,
+    1297684.656, -27497.762599999784, 949228.4628000001, 5282.36,
+    5204.52, 1852477.2114, 1449291.25, 3476.8,
+    2199.33, 1248.47, 5803.657200000001, 1.53,
+    0.0, 1245.42, 1246.95, 0.0,
+    0.0, 1347.68, 1298.84, 1423.99,
+    1350.73, 1318.68, 7382.6050000000005, 2353.48,
+    12638.619, 15405.307600000002, 13677.006800000001, 177.77900000000045,
+    12482.1362, 143777.5474, 4954.21, 4682.54,
+    4542.12, -440.97580000000016, 4635.23, 4987.79,
+    46756.4828, 23641.391600000003, 5094.63, 5163.31,
+    22097.999600000003, 4896.21, 56.89860000000044, 48719.4612,
+    68811.7968, 1918048.772, 197327.47499999986, 24914.797699999996,
+    385307.12879999995, 389920.216, 1401907.0976, 889152.1535999998,
+    1717333.7044000002, 2015818.4970000002, 78833.08020000001, 4725.27,
+    1327.84, 5903.2414, 1256.11, 1.53,
+    -28.5192, 0.0, 1245.42, 0.0,
+    0.0, 1268.32, 0.0, 1262.21,
+    5874.768800000001, 1289.68, 1291.21, 5945.927000000001,
+    1275.95, 1272.89, 5917.4544, -7.0832000000000335,
+    11934.5396, 0.0, 6827.832, 0.0,
+    0.0, 12375.468799999999, 17859.030600000002, 374152.1982,
+    1691.09, 1352.26, 4349.82, 0.0,
+    14.25959999999941, 0.0, 6308.6614, 2809.83,
+    4229.24, 2307.69, 23428.0102, 4557.39,
+    48102.72329999998, 473783.1924, -420008.4186, 389632.76879999996,
+    5184.68, 24601.782199999958, 753570.4377, -2177.2050000000745,
+    847790.3448, 634405.6342000001, 1733807.2727, 878953.1800000002,
+    1960482.9100000001, 4711.54, 12290.097600000001, 1.53,
+    28.5192, 0.0, 0.0, 1350.73,
+    1271.37, 0.0, 0.0, 6749.5906,
+    0.0, -35.55580000000009, 20867.573200000003, 1335.47,
+    0.0, 1283.58, 1320.21, 6251.7627999999995,
+    2701.47, 106695.23129999998, 4658.12, 4549.76,
+    21.342799999998533, 4674.91, 1706.9836000000068, 416578.2696,
+    382575.26339999994, 72844.4676, 192.0851999999868, 4687.12,
+    23598.706000000002, 5267.09, -71.11159999999654, 264488.0871,
+    4902.32, 136989.7878, 96727.8064, 49153.55550000002,
+    52384.48450000002, 4754.27, 633325.6091, 464831.9568,
+    -122467.45129999996, 514049.12039999996, 272704.6173, 488153.05539999995,
+    5126.68, -30944.778399999952, 836939.8224000001, -76807.05869999994,
+    635544.598, 1496225.865, 1161297.984, 1764854.8099,
+    2197.8, 1265.26, 28.5192, 1.53,
+    -28.5192, 28.5192, 1256.11, 1256.11,
+    1259.16, 35.6643, 35.6643, -7.145099999999996,
+    28.5192, 1257.63, 1248.47, 0.0,
+    4488.71, 1304.95, 0.0, 1282.05,
+    6081.067, 1343.1, 0.0, 1346.15,
+    184.90880000000107, 1393.47, 1294.26, 0.0,
+    492563.2936, 21180.538800000002, 3759.16, 12318.5702,
+    -28.472599999999147, 13733.905400000001, 0.0, 4354.4,
+    4354.4, 23193.457999999926, 23129.3042, 4587.91,
+    170819.35520000002, 220173.98750000005, 146466.86289999998, 4755.8,
+    966631.7392000001, -135794.6050000002, 5151.1, 5007.63,
+    836366.5752, 750808.7927999999, 822634.8143999999, 4731.38,
+    4726.8, 4671.86, 999010.3251, -24040.817400000058,
+    1417336.4382, 4656.59, 2582.42, 1265.26,
+    1245.42, 1.53, 28.5192, 5796.527400000001,
+    5846.342799999999, 0.0, 5889.0284, 0.0,
+    2496.95, 1318.68, 2452.69, 1477.41,
+    7290.150600000001, 4456.65, 2918.19, 12226.115800000001,
+    2756.41, -405.4200000000001, -71.11160000000018, -227.59440000000177,
+    0.0, 4645.91, 4571.12, -184.9088000000047,
+    4619.96, 1401.1222000000016, 435083.8416, 238100.65959999998,
+    92.45439999999871, 22666.9856, -384.0771999999997, 0.0,
+    -1138.0908000000345, 5140.42, 143436.0337, 42.685599999997066,
+    22965.7382, 73676.697, -199.1218000000008, -49.76880000000165,
+    46274.135399999985, 0.0, 5120.57, 1120808.9781,
+    655826.4711000001, 444086.05600000004, 725.0460000000312, -29054.64659999998,
+    0.0, -71391.9584, 4856.53, 1393206.1423,
+    -24314.155899999896, 1121477.3808000002, -26359.842999999877, 5233.52,
+    -24939.095999999903, 1646140.4352, 3113.55, 1317.16,
+    1259.16, 1.53, 0.0, 0.0,
+    7.145099999999996, 7.129799999999705, 0.0, 14.212999999999738,
+    5903.2414, 0.0, 11920.28, 6109.493,
+    1349.21, 1350.73, 6251.7627999999995, 0.0,
+    0.0, 12759.546, 600840.3456, 1434.68,
+    1388.89, 11372.590199999999, 439348.223, 448.0260000000126,
+    4534.49, 4420.02, 3510.38, 4507.02,
+    4829.06, 4607.75, 48819.092000000004, 616087.1181999999,
+    85205.6768, 4800.06, 145063.4007999999, -46315.31600000011,
+    976719.7525000001, 619109.9064, -220543.55429999996, -66989.2526,
+    20811.441399999894, 1174149.8979, 21506.13509999984, 1168086.6432,
+    50703.57079999964, 666924.7782000001, 5079.37, 1494289.3005,
+    4784.8, 1670598.4779000003, 1317.16, 1.53,
+    28.5192, 28.5192, 28.5192, 0.0,
+    -7.145099999999996, 6137.9656, 0.0, 1257.63,
+    1256.11, 1292.74, 5817.8702, 0.0,
+    5974.353, 1286.63, 11806.4828, 5938.797200000001,
+    11962.9656, 12304.3572, 12034.077200000002, 12019.8176,
+    22169.1578, 2460.32, 1347.68, 0.0,
+    12247.412, 21.34280000000126, 0.0, 0.0,
+    177.77900000000045, 20746.6928, 3081.5, 2437.42,
+    0.0, 4656.59, 20711.090399999997, 21898.877800000002,
+    142069.9789, 4845.85, 11991.3916, 21194.7518,
+    199.0752000000066, -56.8519999999844, 5025.95, 5144.99,
+    409549.2624, 1138.0908000000054, 4632.17, 236678.1224,
+    981427.6176, 230366.7470000002, 1374530.5392000002, 1366.0,
+    1.53, 28.5192, 0.0, 0.0,
+    28.5192, -7.145099999999996, 28.5192, 1282.05,
+    5910.3712, 1245.42, 5896.1116, 11863.3348,
+    5967.2698, 11948.706, 1350.73, 0.0,
+    1286.63, 1288.16, 1358.36, 0.0,
+    4659.65, 2692.31, -49.76880000000165, 8328.5384,
+    18477.832, -142.22320000000036, 2571.73, 6415.3288,
+    2561.05, 20789.285199999995, 19679.832400000003, 4551.28,
+    63947.036400000005, 22531.799, 172392.41580000002, 23513.381400000002,
+    -22467.863800000003, 4967.95, 4913.0, 0.0,
+    4957.26, 33879.42240000004, 1323988.6309999998, 234828.6376,
+    1590925.2240000002, 88582.71509999991, 439636.70639999997, 922905.0144,
+    1344.63, 1279.0, 1.53, 0.0,
+    28.5192, 28.5192, 28.5192, 0.0,
+    5803.657200000001, 0.0, 1265.26, 1271.37,
+    5931.6674, 0.0, 0.0, 1314.1,
+    1291.21, 0.0, 1297.31, 0.0,
+    0.0, 42.685600000000704, 0.0, 12290.097600000001,
+    7.083200000000943, 0.0, 1327.84, 122313.39749999999,
+    2698.41, 0.0, 1352.26, 1529.3,
+    6778.0632000000005, 1369.05, 21649.9406, 4481.07,
+    56.89860000000044, 3031.14, 92.45439999999871, 43125.568799999994,
+    4627.59, 303789.8682, 1096130.4275, -256.1594000000041,
+    4945.05, 4656.59, 687607.5961999999, 897571.5192000001,
+    668625.948, 260016.3328, -70068.65289999987, 1659584.8284000002,
+    5082.42, 5238.1, 4743.59, 180877.78130000003,
+    12567.5074, 6173.5214, 1248.47, 35.6643,
+    0.0, 28.5192, -28.5192, 1246.95,
+    1245.42, 1585.78, 1472.83, 6137.9656,
+    1358.36, 11906.020400000001, 1268.32, 11806.4828,
+    1271.37, 0.0, 12076.7628, 1289.68,
+    1454.52, 6422.4586, -99.58420000000024, 4383.39,
+    2365.69, 3948.41, 194511.6625, 4635.23,
+    18755.2884, 2992.98, 2695.36, 625.8846000000012,
+    4638.28, 14.259600000001228, 275979.3141, 5004.58,
+    -170.89669999998296, 449558.01360000006, 23150.647, 95276.86880000001,
+    94451.8624, 72823.21800000001, 440372.642, -398.08600000006845,
+    217826.2418, -65397.880799999984, 4851.95, 479331.64679999993,
+    333969.35520000005, 267852.9372, 1196505.8027, 21152.472899999935,
+    -40622.03449999995, 147022.39529999986, 761924.6680000001, -30785.30480000004,
+    510762.31, 4661.17, 1317.16, 1.53,
+    28.5192, 0.0, -7.145099999999996, 0.0,
+    1317.16, 0.0, 2039.07, 6052.5944,
+    1341.58, 1326.31, 18257.3674, -163.5659999999989,
+    245504.735, 4940.48, 22553.1884, 4792.43,
+    21692.6262, 4890.11, 21621.468, 44224.5184,
+    23143.64319999999, 176490.2139, 119182.63139999998, 5187.73,
+    371903.7808, 5201.47, -21.342799999999443, -15045.727599999867,
+    834487.5335999998, 1008053.6503, 756499.2468, -75510.91859999998,
+    -100064.33279999997, 5170.94, 1139486.0329, 1158542.9322,
+    -42265.72029999993, 1457861.6463000001, 991300.8740000001, -37810.47529999958,
+    934529.4, 22497.498200000147, 19756.63710000005, -74945.56199999992,
+    122889.82270000008, 612313.7669999999, 101242.95419999992, 1393206.1423,
+    4957.26, 891379.0842000002, 5201.47, 5239.62,
+    2162706.0050000004, 23684.0772, 1317.16, 35.6643,
+    1.53, 28.5192, 28.5192, 0.0,
+    1268.32, 0.0, 1298.84, 11820.7424,
+    1268.32, 5768.1014, 6081.067, 0.0,
+    12048.336800000001, 1289.68, 12403.894800000002, 14395.345800000001,
+    1343.1, 7.129799999999705, 5036.63, 42176.1688,
+    21201.8816, 1468.25, 4700.85, 4410.87,
+    20028.3072, 2338.22, 4702.38, 1483646.1195,
+    774484.9596000001, 638689.4785, 23761.638800000015, 4659.65,
+    454143.624, 5164.84, 4832.11, 23463.566000000003,
+    1345577.2408, 5196.89, 18990.53769999987, -27981.792799999937,
+    4735.96, 1331821.6230999997, 5267.09, 2013334.8224000002,
+    -80218.82159999991, -42080.933600000106, -40793.939999999944, 1643322.5444,
+    4705.43, 4676.43, 1341.58, 1265.26,
+    1.53, 28.5192, 28.5192, 0.0,
+    1256.11, 1246.95, 11948.706, 0.0,
+    0.0, 21.34280000000126, 12290.097600000001, 12019.8176,
+    1329.37, 2568.68, 8861.9686, 0.0,
+    0.0, 1394.99, -35.55580000000009, 2274.11,
+    1578.9011999999984, 4676.43, 4487.18, 14288.678399999999,
+    4594.02, 169225.706, 22083.786600000003, 502506.13519999996,
+    949129.7318000001, 12418.154400000001, 1353.79, 5065.63,
+    830722.9104, 2898.35, 0.0, 70433.4768,
+    24402.322999999997, 4885.53, -49.8153999999995, 97746.37790000002,
+    193807.32200000001, 819434.2746, 1760466.988, 1407878.172,
+    -57561.706899999874, 5279.3, 1383470.3568, 4728.33,
+    5276.25, 5190.78, 3421.86, 6273.059,
+    1.53, 28.5192, 28.5192, 28.5192,
+    -7.145099999999996, 1304.95, 5803.657200000001, 0.0,
+    5917.4544, 3713.37, 6372.6432, 2129.12,
+    0.0, 1323.26, 12275.9312, 1347.68,
+    14.259600000001228, 1320.21, 17880.420000000002, 12944.454800000001,
+    99.58420000000297, -135.13999999999942, 2731.99, 13591.682200000001,
+    -120.92699999999786, 1127448.1364, 563777.0919, 86798.8376,
+    4574.18, -739.6818000000003, -24537.602799999993, 344228.8798,
+    0.0, 705126.3342, 15151.978799999924, -119465.1178,
+    5111.42, 762586.4322, 63669.5334, 5152.63,
+    175295.06939999995, 1754037.8289, -13048.792799999937, 156334.77469999995,
+    -133035.31089999992, 1132365.4268, 4731.38, 1239189.9696000002,
+    5235.04, 4742.06, 1921935.3062, 2259764.4263999998,
+    12290.097600000001, 11806.4828, 1259.16, 35.6643,
+    1.53, -7.145099999999996, 1256.11, 5796.527400000001,
+    1243.89, 7.0832000000000335, 1312.58, 1298.84,
+    0.0, 1306.47, 2525.95, 1552.2,
+    3971.31, 4429.18, 1318.68, 0.0,
+    11962.9656, 14.166400000000067, 2637.36, 28.472600000000966,
+    12873.343200000001, 23904.5418, 23278.6572, 21223.1778,
+    452794.037, 4600.12, 4601.65, 2756.41,
+    1367.52, 1323.26, 12347.0428, 10896.1052,
+    2619.05, 4966.42, 2811.36, 43527.4756,
+    4536.02, 13285.8464, -21351.234600000003, -199.0752000000066,
+    129177.76679999998, 240308.6424, 264369.924, 135.13999999999942,
+    -223502.36340000003, 4832.11, 64629.81960000001, 21500.494399999996,
+    4992.37, 278028.02999999997, 827791.5592, 4777.17,
+    -135081.26189999998, 701018.6539999999, 4749.69, 1550146.1257999998,
+    -174984.08479999984, 22716.801000000003, 1291.21, 5803.657200000001,
+    1.53, 0.0, 0.0, 7.145099999999996,
+    1245.42, 0.0, 1268.32, 1275.95,
+    5832.1298, 1250.0, 5917.4544, 0.0,
+    1282.05, 21.342800000000352, 12588.850199999999, 28.425999999995838,
+    1323.26, 6102.3632, 1466.73, 1343.1,
+    1312.58, 2402.32, 2661.78, 1373.63,
+    6009.9088, -35.55579999999827, 4473.44, 4369.66,
+    4578.75, 684022.4864999999, 128.05679999999847, 56.85199999999895,
+    4652.01, 42631.3576, 173458.79590000003, 23036.8498,
+    41792.0916, 196368.36950000003, 332475.55380000005, 5172.47,
+    4577.23, 24750.891, 152342.64990000002, 25355.182000000088,
+    23812.087400000004, 4021.910299999872, 4729.85, 1034496.7354,
+    17921.461799999932, 1620365.1760000002, 1328345.8022999999, 5137.36,
+    -625.8379999999961, 195770.11050000004, 5000.0, 870736.3252,
+    918628.8852, 1706307.503, 1739811.5174999998, 17901.809400000002,
+    1289.68, 1243.89, 1.53, 0.0,
+    1.53, 11806.4828, 0.0, 0.0,
+    5889.0284, 11820.7424, 5903.2414, 12005.6512,
+    1405.68, 1346.15, 6045.4646, 1327.84,
+    1317.16, 1349.21, 1288.16, 1356.84,
+    4461.23, 2574.79, 35.55580000000009, 199.12179999999898,
+    539813.071, 23484.9088, 4484.13, 17944.4484,
+    -128.0568000000003, 1591.88, 11977.132, 1491.15,
+    19132.1892, 1303.42, 1546.09, -618.7548000000024,
+    338252.369, 4645.91, 151197.631, 64074.9534,
+    20838.995399999985, 98406.152, 4990.84, 23876.44370000006,
+    -23107.366599999834, 1030243.5404000002, 823360.6527999999, 1697543.165,
+    738844.9404000001, 64764.1062000001, 1185918.8991, 4635.23,
+    12318.5236, 1343.1, 1263.74, 1.53,
+    28.5192, 1256.11, 1320.21, 1274.42,
+    -7.129799999999705, 2504.58, 6308.6614, 6265.975800000001,
+    7460.8464, 2608.36, -7.129799999998795, 6941.629199999999,
+    346833.5442, 3063.19, 1283.58, 0.0,
+    1332.42, 24388.203200000004, 21216.094600000004, 4542.12,
+    714635.6797999999, 550983.2427000001, 44423.02930000005, 1091810.9712999999,
+    4920.63, 2788.6418999999296, 497401.4116, 4732.91,
+    106.71399999999994, 4633.7, 4478.02, 806898.1885999999,
+    21678.413199999995, 4455.13, -469.6162999999942, 5094.63,
+    4648.96, 47168.86720000004, 47951.3068, 222427.29,
+    49572.9868, 378022.1544, 1639237.3632000003, 1113736.8425,
+    -206.81010000011884, 5235.04, 836439.372, 129893.31940000004,
+    -30484.716999999888, 225865.06850000002, 4684.07, 1499610.891,
+    21913.090799999998, 2037418.1604000002,
+};
+
+static const int16_t panel_children[5348] = {
+    1, 26, 2, 15, 3, 9, 4, 7, 5, 6, -1, -2, -3, -4, -5, 8,
+    -6, -7, 10, 13, 11, 12, -8, -9, -10, -11, -12, 14, -13, -14, 16, 23,
+    17, 20, 18, 19, -15, -16, -17, -18, 21, 22, -19, -20, -21, -22, 24, 25,
+    -23, -24, -25, -26, 27, 42, 28, 35, 29, 32, 30, 31, -27, -28, -29, -30,
+    33, 34, -31, -32, -33, -34, 36, 39, 37, 38, -35, -36, -37, -38, 40, 41,
+    -39, -40, -41, -42, 43, 50, 44, 47, 45, 46, -43, -44, -45, -46, 48, 49,
+    -47, -48, -49, -50, 51, 54, 52, 53, -51, -52, -53, -54, 55, 56, -55, -56,
+    -57, -58, 58, 83, 59, 74, 60, 67, 61, 64, 62, 63, -59, -60, -61, -62,
+    65, 66, -63, -64, -65, -66, 68, 71, 69, 70, -67, -68, -69, -70, 72, 73,
+    -71, -72, -73, -74, 75, 76, -75, -76, 77, 80, 78, 79, -77, -78, -79, -80,
+    81, 82, -81, -82, -83, -84, 84, 99, 85, 92, 86, 89, 87, 88, -85, -86,
+    -87, -88, 90, 91, -89, -90, -91, -92, 93, 96, 94, 95, -93, -94, -95, -96,
+    97, 98, -97, -98, -99, -100, 100, 102, 101, -103, -101, -102, 103, 105, -104, 104,
+    -105, -106, 106, 107, -107, -108, -109, -110, 109, 139, 110, 125, 111, 118, 112, 115,
+    113, 114, -111, -112, -113, -114, 116, 117, -115, -116, -117, -118, 119, 122, 120, 121,
+    -119, -120, -121, -122, 123, 124, -123, -124, -125, -126, 126, 133, 127, 130, 128, 129,
+    -127, -128, -129, -130, 131, 132, -131, -132, -133, -134, 134, 136, 135, -137, -135, -136,
+    137, 138, -138, -139, -140, -141, 140, 153, 141, 147, 142, 144, -142, 143, -143, -144,
+    145, 146, -145, -146, -147, -148, 148, 151, 149, 150, -149, -150, -151, -152, 152, -155,
+    -153, -154, 154, 161, 155, 158, 156, 157, -156, -157, -158, -159, 159, 160, -160, -161,
+    -162, -163, 162, 164, 163, -166, -164, -165, 165, -169, -167, -168, 167, 195, 168, 182,
+    169, 176, 170, 173, 171, 172, -170, -171, -172, -173, 174, 175, -174, -175, -176, -177,
+    177, 180, 178, 179, -178, -179, -180, -181, 181, -184, -182, -183, 183, 189, 184, 186,
+    -185, 185, -186, -187, 187, 188, -188, -189, -190, -191, 190, 193, 191, 192, -192, -193,
+    -194, -195, 194, -198, -196, -197, 196, 208, 197, 202, 198, 199, -199, -200, 200, 201,
+    -201, -202, -203, -204, 203, 205, -205, 204, -206, -207, 206, 207, -208, -209, -210, -211,
+    209, 214, 210, 212, -212, 211, -213, -214, -215, 213, -216, -217, -218, -219, 216, 239,
+    217, 231, 218, 224, 219, 221, 220, -222, -220, -221, 222, 223, -223, -224, -225, -226,
+    225, 228, 226, 227, -227, -228, -229, -230, 229, 230, -231, -232, -233, -234, 232, 236,
+    233, 234, -235, -236, -237, 235, -238, -239, 237, -243, 238, -242, -240, -241, 240, 251,
+    241, 247, 242, 245, 243, 244, -244, -245, -246, -247, -248, 246, -249, -250, 248, -255,
+    249, 250, -251, -252, -253, -254, 252, 259, 253, 256, 254, 255, -256, -257, -258, -259,
+    257, 258, -260, -261, -262, -263, 260, 263, 261, 262, -264, -265, -266, -267, 264, 265,
+    -268, -269, -270, -271, 267, 294, 268, 280, 269, 276, 270, 273, 271, 272, -272, -273,
+    -274, -275, 274, 275, -276, -277, -278, -279, -280, 277, 278, 279, -281, -282, -283, -284,
+    281, 288, 282, 285, 283, 284, -285, -286, -287, -288, 286, 287, -289, -290, -291, -292,
+    289, 292, 290, 291, -293, -294, -295, -296, 293, -299, -297, -298, 295, 310, 296, 303,
+    297, 300, 298, 299, -300, -301, -302, -303, 301, 302, -304, -305, -306, -307, 304, 307,
+    305, 306, -308, -309, -310, -311, 308, 309, -312, -313, -314, -315, 311, 318, 312, 315,
+    313, 314, -316, -317, -318, -319, 316, 317, -320, -321, -322, -323, 319, 322, 320, 321,
+    -324, -325, -326, -327, 323, 324, -328, -329, -330, -331, 326, 353, 327, 339, 328, 332,
+    329, 331, 330, -334, -332, -333, -335, -336, 333, 336, 334, 335, -337, -338, -339, -340,
+    337, 338, -341, -342, -343, -344, 340, 347, 341, 344, 342, 343, -345, -346, -347, -348,
+    345, 346, -349, -350, -351, -352, 348, 351, 349, 350, -353, -354, -355, -356, -357, 352,
+    -358, -359, 354, 368, 355, 361, 356, 358, -360, 357, -361, -362, 359, 360, -363, -364,
+    -365, -366, 362, 365, 363, 364, -367, -368, -369, -370, 366, 367, -371, -372, -373, -374,
+    369, 376, 370, 373, 371, 372, -375, -376, -377, -378, 374, 375, -379, -380, -381, -382,
+    377, 380, 378, 379, -383, -384, -385, -386, -387, -388, 382, 408, 383, 394, 384, 388,
+    385, 387, 386, -391, -389, -390, -392, -393, 389, 392, 390, 391, -394, -395, -396, -397,
+    -398, 393, -399, -400, 395, 401, 396, 399, 397, 398, -401, -402, -403, -404, -405, 400,
+    -406, -407, 402, 405, 403, 404, -408, -409, -410, -411, 406, 407, -412, -413, -414, -415,
+    409, 422, 410, 415, 411, 413, 412, -418, -416, -417, -419, 414, -420, -421, 416, 419,
+    417, 418, -422, -423, -424, -425, 420, 421, -426, -427, -428, -429, 423, 429, 424, 426,
+    425, -432, -430, -431, 427, 428, -433, -434, -435, -436, 430, 433, 431, 432, -437, -438,
+    -439, -440, 434, 435, -441, -442, -443, -444, 437, 460, 438, 452, 439, 445, 440, 443,
+    441, 442, -445, -446, -447, -448, 444, -451, -449, -450, 446, 449, 447, 448, -452, -453,
+    -454, -455, 450, 451, -456, -457, -458, -459, 453, 456, 454, -463, 455, -462, -460, -461,
+    457, 458, -464, -465, -466, 459, -467, -468, 461, 475, 462, 469, 463, 466, 464, 465,
+    -469, -470, -471, -472, 467, 468, -473, -474, -475, -476, 470, 473, 471, 472, -477, -478,
+    -479, -480, 474, -483, -481, -482, 476, 483, 477, 480, 478, 479, -484, -485, -486, -487,
+    481, 482, -488, -489, -490, -491, 484, 486, -492, 485, -493, -494, 487, 488, -495, -496,
+    -497, -498, 490, 515, 491, 503, 492, 496, 493, 495, -499, 494, -500, -390, -501, -502,
+    497, 500, 498, 499, -503, -504, -505, -506, 501, 502, -507, -508, -509, -510, 504, 510,
+    505, 507, -511, 506, -512, -513, 508, 509, -514, -515, -516, -517, 511, 513, 512, -520,
+    -518, -519, 514, -523, -521, -522, 516, 530, 517, 523, 518, 520, 519, -526, -524, -525,
+    521, 522, -527, -528, -529, -530, 524, 527, 525, 526, -531, -532, -533, -534, 528, 529,
+    -535, -536, -537, -538, 531, 538, 532, 535, 533, 534, -539, -540, -541, -542, 536, 537,
+    -543, -544, -545, -546, 539, 541, -547, 540, -548, -549, 542, 543, -550, -551, -552, -553,
+    545, 570, 546, 556, 547, 551, 548, 550, 549, -556, -554, -555, -557, -558, 552, 554,
+    553, -561, -559, -560, -562, 555, -563, -564, 557, 564, 558, 561, 559, 560, -565, -566,
+    -567, -568, 562, 563, -569, -570, -571, -572, 565, 568, 566, 567, -573, -574, -575, -576,
+    569, -579, -577, -578, 571, 586, 572, 579, 573, 576, 574, 575, -580, -581, -582, -583,
+    577, 578, -584, -585, -586, -587, 580, 583, 581, 582, -588, -589, -590, -591, 584, 585,
+    -592, -593, -594, -595, 587, 591, -596, 588, 589, 590, -597, -598, -599, -600, -601, 592,
+    -602, -603, 594, 615, 595, 609, 596, 603, 597, 600, 598, 599, -604, -605, -606, -607,
+    601, 602, -608, -609, -610, -611, 604, 607, 605, 606, -612, -613, -614, -615, -616, 608,
+    -617, -618, 610, 613, 611, -622, 612, -621, -619, -620, -623, 614, -624, -625, 616, 631,
+    617, 624, 618, 621, 619, 620, -626, -627, -628, -629, 622, 623, -630, -631, -632, -633,
+    625, 628, 626, 627, -634, -635, -636, -637, 629, 630, -638, -639, -640, -641, 632, 639,
+    633, 636, 634, 635, -642, -643, -644, -645, 637, 638, -646, -647, -648, -649, 640, 643,
+    641, 642, -650, -651, -652, -653, 644, 645, -654, -655, -656, -657, 647, 670, 648, 655,
+    649, 652, 650, 651, -658, -659, -660, -661, 653, -665, -662, 654, -663, -664, 656, 663,
+    657, 660, 658, 659, -666, -667, -668, -669, 661, 662, -670, -671, -672, -673, 664, 667,
+    665, 666, -674, -675, -676, -677, 668, 669, -678, -679, -680, -681, 671, 686, 672, 679,
+    673, 676, 674, 675, -682, -683, -684, -685, 677, 678, -686, -687, -688, -689, 680, 683,
+    681, 682, -690, -691, -692, -693, 684, 685, -694, -695, -696, -697, 687, 690, 688, 689,
+    -698, -699, -700, -701, 691, 694, 692, 693, -702, -703, -704, -705, 695, -708, -706, -707,
+    697, 718, 698, 703, 699, -712, 700, 702, 701, -333, -709, -710, -711, -711, 704, 711,
+    705, 708, 706, 707, -713, -714, -715, -716, 709, 710, -717, -718, -719, -720, 712, 715,
+    713, 714, -721, -722, -723, -724, 716, 717, -725, -726, -727, -728, 719, 731, 720, 727,
+    721, 724, 722, 723, -729, -730, -731, -732, 725, 726, -733, -734, -735, -736, 728, -741,
+    729, 730, -737, -738, -739, -740, 732, 739, 733, 736, 734, 735, -742, -743, -744, -745,
+    737, 738, -746, -747, -748, -749, 740, 741, -750, -751, 742, 743, -752, -753, -754, -755,
+    745, 770, 746, 759, 747, 753, 748, 751, 749, 750, -756, -757, -758, -759, -760, 752,
+    -761, -762, 754, 757, 755, 756, -763, -764, -765, -766, 758, -769, -767, -768, 760, 766,
+    761, 763, 762, -772, -770, -771, 764, 765, -773, -774, -775, -776, 767, -781, 768, 769,
+    -777, -778, -779, -780, 771, 781, 772, 778, 773, 776, 774, 775, -782, -783, -784, -785,
+    -786, 777, -787, -788, 779, -792, -789, 780, -790, -791, 782, 789, 783, 786, 784, 785,
+    -793, -794, -795, -796, 787, 788, -797, -798, -799, -800, 790, 793, 791, 792, -801, -802,
+    -803, -804, 794, 795, -805, -806, -807, -808, 797, 821, 798, 813, 799, 806, 800, 803,
+    801, 802, -809, -810, -811, -812, 804, 805, -813, -814, -815, -816, 807, 810, 808, 809,
+    -817, -818, -819, -820, 811, 812, -821, -822, -823, -824, 814, 817, 815, -828, 816, -827,
+    -825, -826, 818, 820, 819, -831, -829, -830, -832, -833, 822, 833, 823, 828, 824, 826,
+    825, -836, -834, -835, 827, -839, -837, -838, 829, 832, 830, 831, -840, -841, -842, -843,
+    -844, -845, 834, 841, 835, 838, 836, 837, -846, -847, -848, -849, 839, 840, -850, -851,
+    -852, -853, 842, 845, 843, 844, -854, -855, -856, -857, -858, 846, -859, -860, 848, 875,
+    849, 862, 850, 855, 851, 853, -861, 852, -862, -863, 854, -866, -864, -865, 856, 859,
+    857, 858, -867, -868, -869, -870, 860, 861, -871, -872, -873, -874, 863, 869, 864, 867,
+    865, 866, -875, -876, -877, -878, 868, -881, -879, -880, 870, 873, 871, 872, -882, -883,
+    -884, -885, 874, -888, -886, -887, 876, 891, 877, 884, 878, 881, 879, 880, -889, -890,
+    -891, -892, 882, 883, -893, -894, -895, -896, 885, 888, 886, 887, -897, -898, -899, -900,
+    889, 890, -901, -902, -903, -904, 892, 896, 893, -909, 894, 895, -905, -906, -907, -908,
+    897, 900, 898, 899, -910, -911, -912, -913, 901, 902, -914, -915, -916, -917, 904, 925,
+    905, 910, 906, 908, 907, -920, -918, -919, -921, 909, -922, -923, 911, 918, 912, 915,
+    913, 914, -924, -925, -926, -927, 916, 917, -928, -929, -930, -931, 919, 922, 920, 921,
+    -932, -933, -934, -935, 923, 924, -936, -937, -938, -939, 926, 941, 927, 934, 928, 931,
+    929, 930, -940, -941, -942, -943, 932, 933, -944, -945, -946, -947, 935, 938, 936, 937,
+    -948, -949, -950, -951, 939, 940, -952, -953, -954, -955, 942, 949, 943, 946, 944, 945,
+    -956, -957, -958, -959, 947, 948, -960, -961, -962, -963, 950, -967, -964, 951, -965, -966,
+    953, 975, 954, 968, 955, 961, 956, 959, 957, 958, -968, -969, -970, -971, -972, 960,
+    -973, -974, 962, 965, 963, 964, -975, -976, -977, -978, 966, 967, -979, -980, -981, -982,
+    969, 973, 970, -987, 971, 972, -983, -984, -985, -986, -988, 974, -989, -990, 976, 991,
+    977, 984, 978, 981, 979, 980, -991, -992, -993, -994, 982, 983, -995, -996, -997, -998,
+    985, 988, 986, 987, -999, -1000, -1001, -1002, 989, 990, -1003, -1004, -1005, -1006, 992, 999,
+    993, 996, 994, 995, -1007, -1008, -1009, -1010, 997, 998, -1011, -1012, -1013, -1014, -1015, 1000,
+    1001, 1002, -1016, -1017, -1018, -1019, 1004, 1028, 1005, 1020, 1006, 1013, 1007, 1010, 1008, 1009,
+    -1020, -1021, -1022, -1023, 1011, 1012, -1024, -1025, -1026, -1027, 1014, 1017, 1015, 1016, -1028, -1029,
+    -1030, -1031, 1018, 1019, -1032, -1033, -1034, -1035, 1021, -1044, 1022, 1025, 1023, 1024, -1036, -1037,
+    -1038, -1039, 1026, 1027, -1040, -1041, -1042, -1043, 1029, 1044, 1030, 1037, 1031, 1034, 1032, 1033,
+    -1045, -1046, -1047, -1048, 1035, 1036, -1049, -1050, -1051, -1052, 1038, 1041, 1039, 1040, -1053, -1054,
+    -1055, -1056, 1042, 1043, -1057, -1058, -1059, -1060, 1045, 1051, 1046, 1049, 1047, 1048, -1061, -1062,
+    -1063, -1064, -1065, 1050, -1066, -1067, 1052, 1055, 1053, 1054, -1068, -1069, -1070, -1071, 1056, 1057,
+    -1072, -1073, -1074, -1075, 1059, 1086, 1060, 1072, 1061, 1068, 1062, 1065, 1063, 1064, -1076, -1077,
+    -1078, -1079, 1066, 1067, -1080, -1081, -1082, -1083, 1069, -1088, 1070, 1071, -1084, -1085, -1086, -1087,
+    1073, 1080, 1074, 1077, 1075, 1076, -1089, -1090, -1091, -1092, 1078, 1079, -1093, -1094, -1095, -1096,
+    1081, 1084, 1082, 1083, -1097, -1098, -1099, -1100, 1085, -1103, -1101, -1102, 1087, 1102, 1088, 1095,
+    1089, 1092, 1090, 1091, -1104, -1105, -1106, -1107, 1093, 1094, -1108, -1109, -1110, -1111, 1096, 1099,
+    1097, 1098, -1112, -1113, -1114, -1115, 1100, 1101, -1116, -1117, -1118, -1119, 1103, 1106, 1104, -1123,
+    -1120, 1105, -1121, -1122, 1107, 1110, 1108, 1109, -1124, -1125, -1126, -1127, -1128, 1111, -1129, -1130,
+    1113, 1136, 1114, 1128, 1115, 1122, 1116, 1119, 1117, 1118, -1131, -1132, -1133, -1134, 1120, 1121,
+    -1135, -1136, -1137, -1138, 1123, 1125, 1124, -1141, -1139, -1140, 1126, 1127, -1142, -1143, -1144, -1145,
+    1129, 1134, 1130, 1132, 1131, -1148, -1146, -1147, 1133, -1151, -1149, -1150, 1135, -1154, -1152, -1153,
+    1137, 1149, 1138, 1142, 1139, 1140, -1155, -1156, -1157, 1141, -1158, -1159, 1143, 1146, 1144, 1145,
+    -1160, -1161, -1162, -1163, 1147, 1148, -1164, -1165, -1166, -1167, 1150, 1157, 1151, 1154, 1152, 1153,
+    -1168, -1169, -1170, -1171, 1155, 1156, -1172, -1173, -1174, -1175, 1158, 1161, 1159, 1160, -1176, -1177,
+    -1178, -1179, 1162, 1163, -1180, -1181, -1182, -1183, 1165, 1191, 1166, 1179, 1167, 1172, 1168, 1170,
+    1169, -1186, -1184, -1185, 1171, -1189, -1187, -1188, 1173, 1176, 1174, 1175, -1190, -1191, -1192, -1193,
+    1177, 1178, -1194, -1195, -1196, -1197, 1180, 1185, 1181, 1182, -1198, -1199, 1183, 1184, -1200, -1201,
+    -1202, -1203, 1186, 1189, 1187, 1188, -1204, -1205, -1206, -1207, -1208, 1190, -1209, -1210, 1192, 1207,
+    1193, 1200, 1194, 1197, 1195, 1196, -1211, -1212, -1213, -1214, 1198, 1199, -1215, -1216, -1217, -1218,
+    1201, 1204, 1202, 1203, -1219, -1220, -1221, -1222, 1205, 1206, -1223, -1224, -1225, -1226, 1208, -1229,
+    -1227, -1228, 1210, 1227, 1211, 1219, 1212, 1216, 1213, 1215, 1214, -1232, -1230, -1231, -1233, -1234,
+    1217, -1238, -1235, 1218, -1236, -1237, -1239, 1220, 1221, 1224, 1222, 1223, -1240, -1241, -1242, -1243,
+    1225, 1226, -1244, -1245, -1246, -1247, 1228, 1240, 1229, 1236, 1230, 1233, 1231, 1232, -1248, -1249,
+    -1250, -1251, 1234, 1235, -1252, -1253, -1254, -1255, 1237, -1260, 1238, 1239, -1256, -1257, -1258, -1259,
+    1241, 1248, 1242, 1245, 1243, 1244, -1261, -1262, -1263, -1264, 1246, 1247, -1265, -1266, -1267, -1268,
+    1249, -1272, 1250, -1271, -1269, -1270, 1252, 1272, 1253, 1265, 1254, 1258, 1255, 1257, 1256, -448,
+    -1273, -1274, -1275, -659, 1259, 1262, 1260, 1261, -1276, -1277, -1278, -1279, 1263, 1264, -1280, -1281,
+    -1282, -1283, 1266, 1271, 1267, 1269, 1268, -1286, -1284, -1285, -1287, 1270, -1288, -1289, -1290, -1291,
+    1273, 1285, 1274, 1279, 1275, 1278, 1276, 1277, -1292, -1293, -1294, -1295, -1296, -1297, 1280, 1283,
+    1281, 1282, -1298, -1299, -1300, -1301, 1284, -1304, -1302, -1303, 1286, 1293, 1287, 1290, 1288, 1289,
+    -1305, -1306, -1307, -1308, 1291, 1292, -1309, -1310, -1311, -1312, 1294, 1297, 1295, 1296, -1313, -1314,
+    -1315, -1316, 1298, 1299, -1317, -1318, -1319, -1320, 1301, 1325, 1302, 1316, 1303, 1309, 1304, 1307,
+    1305, 1306, -1321, -1322, -1323, -1324, -1325, 1308, -1326, -1327, 1310, 1313, 1311, 1312, -1328, -1329,
+    -1330, -1331, 1314, 1315, -1332, -1333, -1334, -1335, 1317, 1324, 1318, 1321, 1319, 1320, -1336, -1337,
+    -1338, -1339, 1322, 1323, -1340, -1341, -1342, -1343, -1344, -1345, 1326, 1334, 1327, -1354, 1328, 1331,
+    1329, 1330, -1346, -1347, -1348, -1349, 1332, 1333, -1350, -1351, -1352, -1353, 1335, 1342, 1336, 1339,
+    1337, 1338, -1355, -1356, -1357, -1358, 1340, 1341, -1359, -1360, -1361, -1362, 1343, 1346, 1344, 1345,
+    -1363, -1364, -1365, -1366, 1347, 1348, -1367, -1368, -1369, -1370, 1350, 1378, 1351, 1365, 1352, 1359,
+    1353, 1356, 1354, 1355, -1371, -1234, -1372, -1373, 1357, 1358, -1374, -560, -1375, -1376, 1360, 1362,
+    1361, -1379, -1377, -1378, 1363, 1364, -1380, -1381, -1382, -1383, 1366, 1373, 1367, 1370, 1368, 1369,
+    -1384, -1385, -1386, -1387, 1371, 1372, -1388, -1389, -1390, -1391, 1374, 1377, 1375, 1376, -1392, -1393,
+    -1394, -1395, -1396, -1397, 1379, 1392, 1380, 1387, 1381, 1384, 1382, 1383, -1398, -1399, -1400, -1401,
+    1385, 1386, -1402, -1403, -1404, -1405, 1388, 1390, 1389, -1408, -1406, -1407, 1391, -1411, -1409, -1410,
+    1393, 1400, 1394, 1397, 1395, 1396, -1412, -1413, -1414, -1415, 1398, 1399, -1416, -1417, -1418, -1419,
+    1401, 1403, 1402, -1422, -1420, -1421, 1404, 1405, -1423, -1424, -1425, -1426, 1407, 1431, 1408, 1422,
+    1409, 1415, 1410, 1412, -1427, 1411, -3, -1428, 1413, 1414, -1429, -1430, -1431, -1432, 1416, 1419,
+    1417, 1418, -1433, -1434, -1435, -1436, 1420, 1421, -1437, -1438, -1439, -1440, 1423, 1427, 1424, 1425,
+    -1441, -1442, 1426, -1445, -1443, -1444, 1428, 1430, 1429, -1448, -1446, -1447, -1449, -1450, 1432, 1443,
+    1433, 1437, -1451, 1434, 1435, 1436, -1452, -1453, -1454, -1455, 1438, 1441, 1439, 1440, -1456, -1457,
+    -1458, -1459, 1442, -1462, -1460, -1461, 1444, 1451, 1445, 1448, 1446, 1447, -1463, -1464, -1465, -1466,
+    1449, 1450, -1467, -1468, -1469, -1470, 1452, 1455, 1453, 1454, -1471, -1472, -1473, -1474, 1456, 1457,
+    -1475, -1476, -1477, -1478, 1459, 1487, 1460, 1472, 1461, 1466, 1462, 1465, 1463, 1464, -1479, -1480,
+    -1481, -1482, -1483, -1484, 1467, 1470, 1468, 1469, -1485, -1486, -1487, -1488, 1471, -1491, -1489, -1490,
+    1473, 1480, 1474, 1477, 1475, 1476, -1492, -1493, -1494, -1495, 1478, 1479, -1496, -1497, -1498, -1499,
+    1481, 1484, 1482, 1483, -1500, -1501, -1502, -1503, 1485, 1486, -1504, -1505, -1506, -1507, 1488, 1503,
+    1489, 1496, 1490, 1493, 1491, 1492, -1508, -1509, -1510, -1511, 1494, 1495, -1512, -1513, -1514, -1515,
+    1497, 1500, 1498, 1499, -1516, -1517, -1518, -1519, 1501, 1502, -1520, -1521, -1522, -1523, 1504, 1507,
+    1505, 1506, -1524, -1525, -1526, -1527, 1508, 1511, 1509, 1510, -1528, -1529, -1530, -1531, 1512, 1513,
+    -1532, -1533, -1534, -1535, 1515, 1541, 1516, 1529, 1517, 1524, 1518, 1521, 1519, 1520, -1536, -1537,
+    -1538, -1539, 1522, 1523, -1540, -1541, -1542, -1543, 1525, 1527, 1526, -1546, -1544, -1545, -1547, 1528,
+    -1548, -1549, 1530, 1537, 1531, 1534, 1532, 1533, -1550, -1551, -1552, -1553, 1535, 1536, -1554, -1555,
+    -1556, -1557, 1538, -1562, 1539, 1540, -1558, -1559, -1560, -1561, 1542, 1557, 1543, 1550, 1544, 1547,
+    1545, 1546, -1563, -1564, -1565, -1566, 1548, 1549, -1567, -1568, -1569, -1570, 1551, 1554, 1552, 1553,
+    -1571, -1572, -1573, -1574, 1555, 1556, -1575, -1576, -1577, -1578, 1558, 1565, 1559, 1562, 1560, 1561,
+    -1579, -1580, -1581, -1582, 1563, 1564, -1583, -1584, -1585, -1586, 1566, 1569, 1567, 1568, -1587, -1588,
+    -1589, -1590, 1570, 1571, -1591, -1592, -1593, -1594, 1573, 1595, 1574, 1580, 1575, 1578, 1576, -1598,
+    -1595, 1577, -1596, -1597, -1599, 1579, -1600, -1601, 1581, 1588, 1582, 1585, 1583, 1584, -1602, -1603,
+    -1604, -1605, 1586, 1587, -1606, -1607, -1608, -1609, 1589, 1592, 1590, 1591, -1610, -1611, -1612, -1613,
+    1593, 1594, -1614, -1615, -1616, -1617, 1596, 1611, 1597, 1604, 1598, 1601, 1599, 1600, -1618, -1619,
+    -1620, -1621, 1602, 1603, -1622, -1623, -1624, -1625, 1605, 1608, 1606, 1607, -1626, -1627, -1628, -1629,
+    1609, 1610, -1630, -1631, -1632, -1633, 1612, 1618, 1613, 1616, 1614, 1615, -1634, -1635, -1636, -1637,
+    1617, -1640, -1638, -1639, 1619, 1622, 1620, 1621, -1641, -1642, -1643, -1644, -1645, 1623, -1646, -1647,
+    1625, 1653, 1626, 1641, 1627, 1634, 1628, 1631, 1629, 1630, -1648, -1649, -1650, -1651, 1632, 1633,
+    -1652, -1653, -1654, -1655, 1635, 1638, 1636, 1637, -1656, -1657, -1658, -1659, 1639, 1640, -1660, -1661,
+    -1662, -1663, 1642, 1646, 1643, 1645, -1664, 1644, -1665, -1666, -1667, -1668, 1647, 1650, 1648, 1649,
+    -1669, -1670, -1671, -1672, 1651, 1652, -1673, -1674, -1675, -1676, 1654, 1669, 1655, 1662, 1656, 1659,
+    1657, 1658, -1677, -1678, -1679, -1680, 1660, 1661, -1681, -1682, -1683, -1684, 1663, 1666, 1664, 1665,
+    -1685, -1686, -1687, -1688, 1667, 1668, -1689, -1690, -1691, -1692, 1670, 1676, 1671, 1673, -1693, 1672,
+    -1694, -1695, 1674, 1675, -1696, -1697, -1698, -1699, 1677, 1680, 1678, 1679, -1700, -1701, -1702, -1703,
+    1681, 1682, -1704, -1705, -1706, -1707, 1684, 1705, 1685, 1699, 1686, 1692, 1687, 1690, 1688, 1689,
+    -1708, -1709, -1710, -1711, 1691, -1714, -1712, -1713, 1693, 1696, 1694, 1695, -1715, -1716, -1717, -1718,
+    1697, 1698, -1719, -1720, -1721, -1722, 1700, 1702, -1723, 1701, -1724, -1725, 1703, -1729, 1704, -1728,
+    -1726, -1727, 1706, 1721, 1707, 1714, 1708, 1711, 1709, 1710, -1730, -1731, -1732, -1733, 1712, 1713,
+    -1734, -1735, -1736, -1737, 1715, 1718, 1716, 1717, -1738, -1739, -1740, -1741, 1719, 1720, -1742, -1743,
+    -1744, -1745, 1722, 1728, 1723, 1726, 1724, 1725, -1746, -1747, -1748, -1749, 1727, -1752, -1750, -1751,
+    1729, -1757, 1730, 1731, -1753, -1754, -1755, -1756, 1733, 1759, 1734, 1747, 1735, 1741, 1736, 1738,
+    -334, 1737, -1758, -1759, 1739, 1740, -559, -1760, -1761, -1762, 1742, 1745, 1743, 1744, -1763, -1764,
+    -1765, -1766, -1767, 1746, -1768, -1769, 1748, 1752, 1749, 1751, 1750, -1772, -1770, -1771, -1773, -1774,
+    1753, 1756, 1754, 1755, -1775, -1776, -1777, -1778, 1757, 1758, -1779, -1780, -1781, -1782, 1760, 1773,
+    1761, 1767, 1762, 1764, 1763, -1785, -1783, -1784, 1765, 1766, -1786, -1787, -1788, -1789, 1768, 1770,
+    1769, -1792, -1790, -1791, 1771, 1772, -1793, -1794, -1795, -1796, 1774, 1778, -1797, 1775, 1776, 1777,
+    -1798, -1799, -1800, -1801, 1779, 1782, 1780, 1781, -1802, -1803, -1804, -1805, 1783, 1784, -1806, -1807,
+    -1808, -1809, 1786, 1812, 1787, 1798, 1788, 1791, 1789, -1812, -1810, 1790, -390, -1811, 1792, 1795,
+    1793, 1794, -1813, -1814, -1815, -1816, 1796, 1797, -1817, -1818, -1819, -1820, 1799, 1805, 1800, 1803,
+    1801, 1802, -1821, -1822, -1823, -1824, -1825, 1804, -1826, -1827, 1806, 1809, 1807, 1808, -1828, -1829,
+    -1830, -1831, 1810, 1811, -1832, -1833, -1834, -1835, 1813, 1826, 1814, 1819, 1815, 1817, -1836, 1816,
+    -1837, -1838, 1818, -1841, -1839, -1840, 1820, 1823, 1821, 1822, -1842, -1843, -1844, -1845, 1824, 1825,
+    -1846, -1847, -1848, -1849, 1827, 1833, 1828, 1831, 1829, 1830, -1850, -1851, -1852, -1853, 1832, -1856,
+    -1854, -1855, 1834, 1837, 1835, 1836, -1857, -1858, -1859, -1860, 1838, 1839, -1861, -1862, -1863, -1864,
+    1841, 1868, 1842, 1856, 1843, 1849, 1844, 1846, -1865, 1845, -1866, -1867, 1847, 1848, -1868, -1869,
+    -1870, -1871, 1850, 1853, 1851, 1852, -1872, -1873, -1874, -1875, 1854, 1855, -1876, -1877, -1878, -1879,
+    1857, 1864, 1858, 1861, 1859, 1860, -1880, -1881, -1882, -1883, 1862, 1863, -1884, -1885, -1886, -1887,
+    1865, -1892, 1866, 1867, -1888, -1889, -1890, -1891, 1869, 1884, 1870, 1877, 1871, 1874, 1872, 1873,
+    -1893, -1894, -1895, -1896, 1875, 1876, -1897, -1898, -1899, -1900, 1878, 1881, 1879, 1880, -1901, -1902,
+    -1903, -1904, 1882, 1883, -1905, -1906, -1907, -1908, 1885, 1891, 1886, 1888, 1887, -1911, -1909, -1910,
+    1889, 1890, -1912, -1913, -1914, -1915, 1892, 1894, 1893, -1918, -1916, -1917, 1895, 1896, -1919, -1920,
+    -1921, -1922, 1898, 1927, 1899, 1913, 1900, 1907, 1901, 1904, 1902, 1903, -1923, -1924, -1925, -1926,
+    1905, 1906, -1927, -1928, -1929, -1930, 1908, 1910, 1909, -1933, -1931, -1932, 1911, 1912, -1934, -1935,
+    -1936, -1937, 1914, 1921, 1915, 1918, 1916, 1917, -1938, -1939, -1940, -1941, 1919, 1920, -1942, -1943,
+    -1944, -1945, 1922, 1925, 1923, 1924, -1946, -1947, -1948, -1949, -1950, 1926, -1951, -1952, 1928, 1943,
+    1929, 1936, 1930, 1933, 1931, 1932, -1953, -1954, -1955, -1956, 1934, 1935, -1957, -1958, -1959, -1960,
+    1937, 1940, 1938, 1939, -1961, -1962, -1963, -1964, 1941, 1942, -1965, -1966, -1967, -1968, 1944, 1951,
+    1945, 1948, 1946, 1947, -1969, -1970, -1971, -1972, 1949, 1950, -1973, -1974, -1975, -1976, 1952, 1955,
+    1953, 1954, -1977, -1978, -1979, -1980, 1956, 1957, -1981, -1982, -1983, -1984, 1959, 1982, 1960, 1972,
+    1961, 1967, 1962, 1965, 1963, 1964, -1985, -1986, -555, -1185, 1966, -1989, -1987, -1988, 1968, 1971,
+    1969, 1970, -1990, -1991, -1992, -1993, -1994, -1995, 1973, 1978, 1974, 1977, 1975, 1976, -1996, -1997,
+    -1998, -1999, -2000, -2001, 1979, -2006, 1980, 1981, -2002, -2003, -2004, -2005, 1983, 1995, 1984, 1991,
+    1985, 1988, 1986, 1987, -2007, -2008, -2009, -2010, 1989, 1990, -2011, -2012, -2013, -2014, 1992, -2019,
+    1993, 1994, -2015, -2016, -2017, -2018, 1996, 2003, 1997, 2000, 1998, 1999, -2020, -2021, -2022, -2023,
+    2001, 2002, -2024, -2025, -2026, -2027, 2004, 2007, 2005, 2006, -2028, -2029, -2030, -2031, 2008, 2009,
+    -2032, -2033, -2034, -2035, 2011, 2032, 2012, 2017, 2013, 2016, 2014, -2037, 2015, -333, -1597, -2036,
+    -2038, -2039, 2018, 2025, 2019, 2022, 2020, 2021, -2040, -2041, -2042, -2043, 2023, 2024, -2044, -2045,
+    -2046, -2047, 2026, 2029, 2027, 2028, -2048, -2049, -2050, -2051, 2030, 2031, -2052, -2053, -2054, -2055,
+    2033, 2048, 2034, 2041, 2035, 2038, 2036, 2037, -2056, -2057, -2058, -2059, 2039, 2040, -2060, -2061,
+    -2062, -2063, 2042, 2045, 2043, 2044, -2064, -2065, -2066, -2067, 2046, 2047, -2068, -2069, -2070, -2071,
+    2049, 2056, 2050, 2053, 2051, 2052, -2072, -2073, -2074, -2075, 2054, 2055, -2076, -2077, -2078, -2079,
+    2057, 2060, 2058, 2059, -2080, -2081, -2082, -2083, 2061, 2062, -2084, -2085, -2086, -2087, 2064, 2084,
+    2065, 2071, 2066, 2069, 2067, -2091, -2088, 2068, -2089, -2090, 2070, -2094, -2092, -2093, 2072, 2078,
+    2073, 2075, -2095, 2074, -2096, -2097, 2076, 2077, -2098, -2099, -2100, -2101, 2079, 2082, 2080, 2081,
+    -2102, -2103, -2104, -2105, -2106, 2083, -2107, -2108, 2085, 2099, 2086, 2093, 2087, 2090, 2088, 2089,
+    -2109, -2110, -2111, -2112, 2091, 2092, -2113, -2114, -2115, -2116, 2094, 2097, 2095, 2096, -2117, -2118,
+    -2119, -2120, -2121, 2098, -2122, -2123, 2100, 2105, 2101, 2102, -2124, -2125, 2103, 2104, -2126, -2127,
+    -2128, -2129, 2106, 2109, 2107, 2108, -2130, -2131, -2132, -2133, 2110, 2111, -2134, -2135, -2136, -2137,
+    2113, 2139, 2114, 2126, 2115, 2119, 2116, 2118, 2117, -2140, -2138, -2139, -2141, -556, 2120, 2123,
+    2121, 2122, -2142, -2143, -2144, -2145, 2124, 2125, -2146, -2147, -2148, -2149, 2127, 2133, 2128, 2131,
+    2129, 2130, -2150, -2151, -2152, -2153, 2132, -2156, -2154, -2155, 2134, 2137, 2135, 2136, -2157, -2158,
+    -2159, -2160, 2138, -2163, -2161, -2162, 2140, 2154, 2141, 2147, 2142, 2144, -2164, 2143, -2165, -2166,
+    2145, 2146, -2167, -2168, -2169, -2170, 2148, 2151, 2149, 2150, -2171, -2172, -2173, -2174, 2152, 2153,
+    -2175, -2176, -2177, -2178, 2155, 2162, 2156, 2159, 2157, 2158, -2179, -2180, -2181, -2182, 2160, 2161,
+    -2183, -2184, -2185, -2186, 2163, 2165, 2164, -2189, -2187, -2188, 2166, 2167, -2190, -2191, -2192, -2193,
+    2169, 2194, 2170, 2180, 2171, 2177, 2172, 2175, 2173, 2174, -2194, -2195, -1865, -555, 2176, -2198,
+    -2196, -2197, 2178, -2202, 2179, -2201, -2199, -2200, 2181, 2188, 2182, 2185, 2183, 2184, -2203, -2204,
+    -2205, -2206, 2186, 2187, -2207, -2208, -2209, -2210, 2189, 2191, -2211, 2190, -2212, -2213, 2192, 2193,
+    -2214, -2215, -2216, -2217, 2195, 2210, 2196, 2203, 2197, 2200, 2198, 2199, -2218, -2219, -2220, -2221,
+    2201, 2202, -2222, -2223, -2224, -2225, 2204, 2207, 2205, 2206, -2226, -2227, -2228, -2229, 2208, 2209,
+    -2230, -2231, -2232, -2233, 2211, 2218, 2212, 2215, 2213, 2214, -2234, -2235, -2236, -2237, 2216, 2217,
+    -2238, -2239, -2240, -2241, 2219, 2222, 2220, 2221, -2242, -2243, -2244, -2245, -2246, 2223, -2247, -2248,
+    2225, 2255, 2226, 2241, 2227, 2234, 2228, 2231, 2229, 2230, -2249, -2250, -2251, -2252, 2232, 2233,
+    -2253, -2254, -2255, -2256, 2235, 2238, 2236, 2237, -2257, -2258, -2259, -2260, 2239, 2240, -2261, -2262,
+    -2263, -2264, 2242, 2248, 2243, 2246, 2244, 2245, -2265, -2266, -2267, -2268, -2269, 2247, -2270, -2271,
+    2249, 2252, 2250, 2251, -2272, -2273, -2274, -2275, 2253, 2254, -2276, -2277, -2278, -2279, 2256, 2268,
+    2257, 2262, 2258, 2260, 2259, -2282, -2280, -2281, 2261, -2285, -2283, -2284, 2263, 2265, 2264, -2288,
+    -2286, -2287, 2266, 2267, -2289, -2290, -2291, -2292, 2269, 2275, 2270, 2272, 2271, -2295, -2293, -2294,
+    2273, 2274, -2296, -2297, -2298, -2299, 2276, 2279, 2277, 2278, -2300, -2301, -2302, -2303, 2280, -2306,
+    -2304, -2305, 2282, 2311, 2283, 2298, 2284, 2291, 2285, 2288, 2286, 2287, -2307, -2308, -2309, -2310,
+    2289, 2290, -2311, -2312, -2313, -2314, 2292, 2295, 2293, 2294, -2315, -2316, -2317, -2318, 2296, 2297,
+    -2319, -2320, -2321, -2322, 2299, 2304, 2300, 2303, 2301, 2302, -2323, -2324, -2325, -2326, -2327, -2328,
+    2305, 2308, 2306, 2307, -2329, -2330, -2331, -2332, 2309, 2310, -2333, -2334, -2335, -2336, 2312, 2327,
+    2313, 2320, 2314, 2317, 2315, 2316, -2337, -2338, -2339, -2340, 2318, 2319, -2341, -2342, -2343, -2344,
+    2321, 2324, 2322, 2323, -2345, -2346, -2347, -2348, 2325, 2326, -2349, -2350, -2351, -2352, 2328, 2332,
+    2329, 2330, -2353, -2354, -2355, 2331, -2356, -2357, -2358, -2359, 2334, 2364, 2335, 2349, 2336, 2342,
+    2337, 2339, 2338, -2361, -2360, -659, 2340, 2341, -2362, -2363, -2364, -2365, 2343, 2346, 2344, 2345,
+    -2366, -2367, -2368, -2369, 2347, 2348, -2370, -2371, -2372, -2373, 2350, 2357, 2351, 2354, 2352, 2353,
+    -2374, -2375, -2376, -2377, 2355, 2356, -2378, -2379, -2380, -2381, 2358, 2361, 2359, 2360, -2382, -2383,
+    -2384, -2385, 2362, 2363, -2386, -2387, -2388, -2389, 2365, 2378, 2366, 2371, 2367, 2369, 2368, -2392,
+    -2390, -2391, -2393, 2370, -2394, -2395, 2372, 2375, 2373, 2374, -2396, -2397, -2398, -2399, 2376, 2377,
+    -2400, -2401, -2402, -2403, 2379, 2385, 2380, 2383, 2381, 2382, -2404, -2405, -2406, -2407, -2408, 2384,
+    -2409, -2410, -2411, -2412, 2387, 2413, 2388, 2399, 2389, 2393, 2390, 2392, 2391, -665, -2413, -2414,
+    -2415, -862, 2394, 2397, 2395, 2396, -2416, -2417, -2418, -2419, 2398, -2422, -2420, -2421, 2400, 2407,
+    2401, 2404, 2402, 2403, -2423, -2424, -2425, -2426, 2405, 2406, -2427, -2428, -2429, -2430, 2408, 2411,
+    2409, 2410, -2431, -2432, -2433, -2434, 2412, -2437, -2435, -2436, 2414, 2429, 2415, 2422, 2416, 2419,
+    2417, 2418, -2438, -2439, -2440, -2441, 2420, 2421, -2442, -2443, -2444, -2445, 2423, 2426, 2424, 2425,
+    -2446, -2447, -2448, -2449, 2427, 2428, -2450, -2451, -2452, -2453, 2430, 2437, 2431, 2434, 2432, 2433,
+    -2454, -2455, -2456, -2457, 2435, 2436, -2458, -2459, -2460, -2461, 2438, -2465, -2462, 2439, -2463, -2464,
+    2441, 2470, 2442, 2457, 2443, 2450, 2444, 2447, 2445, 2446, -2466, -2467, -2468, -2469, 2448, 2449,
+    -2470, -2471, -2472, -2473, 2451, 2454, 2452, 2453, -2474, -2475, -2476, -2477, 2455, 2456, -2478, -2479,
+    -2480, -2481, 2458, 2465, 2459, 2462, 2460, 2461, -2482, -2483, -2484, -2485, 2463, 2464, -2486, -2487,
+    -2488, -2489, 2466, 2468, 2467, -2492, -2490, -2491, 2469, -2495, -2493, -2494, 2471, 2486, 2472, 2479,
+    2473, 2476, 2474, 2475, -2496, -2497, -2498, -2499, 2477, 2478, -2500, -2501, -2502, -2503, 2480, 2483,
+    2481, 2482, -2504, -2505, -2506, -2507, 2484, 2485, -2508, -2509, -2510, -2511, 2487, 2494, 2488, 2491,
+    2489, 2490, -2512, -2513, -2514, -2515, 2492, 2493, -2516, -2517, -2518, -2519, 2495, 2498, 2496, 2497,
+    -2520, -2521, -2522, -2523, 2499, 2500, -2524, -2525, -2526, -2527, 2502, 2533, 2503, 2518, 2504, 2511,
+    2505, 2508, 2506, 2507, -2528, -2529, -1023, -2530, 2509, 2510, -2531, -2532, -2533, -2534, 2512, 2515,
+    2513, 2514, -2535, -2536, -2537, -2538, 2516, 2517, -2539, -2540, -2541, -2542, 2519, 2526, 2520, 2523,
+    2521, 2522, -2543, -2544, -2545, -2546, 2524, 2525, -2547, -2548, -2549, -2550, 2527, 2530, 2528, 2529,
+    -2551, -2552, -2553, -2554, 2531, 2532, -2555, -2556, -2557, -2558, 2534, 2549, 2535, 2542, 2536, 2539,
+    2537, 2538, -2559, -2560, -2561, -2562, 2540, 2541, -2563, -2564, -2565, -2566, 2543, 2546, 2544, 2545,
+    -2567, -2568, -2569, -2570, 2547, 2548, -2571, -2572, -2573, -2574, 2550, 2557, 2551, 2554, 2552, 2553,
+    -2575, -2576, -2577, -2578, 2555, 2556, -2579, -2580, -2581, -2582, 2558, 2561, 2559, 2560, -2583, -2584,
+    -2585, -2586, -2587, 2562, -2588, -2589, 2564, 2590, 2565, 2576, 2566, 2569, 2567, -2593, 2568, -2592,
+    -2590, -2591, 2570, 2573, 2571, 2572, -2594, -2595, -2596, -2597, 2574, 2575, -2598, -2599, -2600, -2601,
+    2577, 2584, 2578, 2581, 2579, 2580, -2602, -2603, -2604, -2605, 2582, 2583, -2606, -2607, -2608, -2609,
+    2585, 2588, 2586, 2587, -2610, -2611, -2612, -2613, 2589, -2616, -2614, -2615, 2591, 2600, 2592, 2597,
+    2593, 2596, 2594, 2595, -2617, -2618, -2619, -2620, -2621, -2622, -2623, 2598, -2624, 2599, -2625, -2626,
+    2601, 2608, 2602, 2605, 2603, 2604, -2627, -2628, -2629, -2630, 2606, 2607, -2631, -2632, -2633, -2634,
+    2609, 2612, 2610, 2611, -2635, -2636, -2637, -2638, 2613, 2614, -2639, -2640, -2641, -2642, 2616, 2646,
+    2617, 2632, 2618, 2625, 2619, 2622, 2620, 2621, -2643, -2644, -2645, -2646, 2623, 2624, -2647, -2648,
+    -2649, -2650, 2626, 2629, 2627, 2628, -2651, -2652, -2653, -2654, 2630, 2631, -2655, -2656, -2657, -2658,
+    2633, 2640, 2634, 2637, 2635, 2636, -2659, -2660, -2661, -2662, 2638, 2639, -2663, -2664, -2665, -2666,
+    2641, 2643, -2667, 2642, -2668, -2669, 2644, 2645, -2670, -2671, -2672, -2673, 2647, 2662, 2648, 2655,
+    2649, 2652, 2650, 2651, -2674, -2675, -2676, -2677, 2653, 2654, -2678, -2679, -2680, -2681, 2656, 2659,
+    2657, 2658, -2682, -2683, -2684, -2685, 2660, 2661, -2686, -2687, -2688, -2689, 2663, 2670, 2664, 2667,
+    2665, 2666, -2690, -2691, -2692, -2693, 2668, 2669, -2694, -2695, -2696, -2697, -2698, 2671, 2672, 2673,
+    -2699, -2700, -2701, -2702,
+};
+
+static const double panel_leaf_value[8106] = {
+    27.765961403508747, 1.4761403508771938, 17.822807017543848,
+    33.2826, 1.5299999999999998, 21.75333333333333,
+    30.662730000000003, 1.5299999999999998, 20.040999999999997,
+    34.94979000000001, 1.5299999999999998, 22.843,
+    4228.619563636365, 906.1772727272727, 8.47272727272727,
+    5804.726670000001, 1245.6495000000002, 4.659999999999998,
+    5802.231240000001, 1245.114, 4.66,
+    356.7308602409639, 1276.626987951807, 0.28072289156626506,
+    5815.662525000001, 1247.9962500000001, 4.659999999999998,
+    5953.289454814818, 1267.9880000000005, 4.694518518518521,
+    5903.725404545455, 1297.0024999999991, 4.554090909090906,
+    5891.385583333334, 1264.2458333333334, 4.659999999999999,
+    57812.71678, 1938.0379999999998, 13.05,
+    6283.352422222221, 1368.836111111111, 4.271666666666665,
+    260.49011666666667, 1317.6008333333332, 0.19416666666666668,
+    6041.472195652172, 1311.052173913044, 4.609347826086965,
+    1563.5309666666665, 1342.2133333333334, 1.165,
+    6937.465731034483, 1484.7796551724139, 3.6958620689655155,
+    4305.802720000001, 2003.36, 0.932,
+    2102.2014476190475, 1349.8609523809525, 1.5533333333333335,
+    4293.006359999999, 2079.366, 0.932,
+    0.0, 3303.8669230769233, 0.0,
+    4466.54476, 4758.699, 0.932,
+    4651.462880000001, 4863.246, 0.932,
+    0.0, 4906.39, 0.0,
+    32214.91726666667, 5127.9525, 6.214166666666666,
+    12026.560388652486, 1314.0602836879427, 9.15475177304965,
+    42070.092092307685, 1874.0030769230773, 11.830769230769228,
+    5558.732454166665, 1336.9331249999998, 4.174583333333332,
+    99731.583425, 3017.273333333333, 22.529166666666665,
+    17861.4072, 1277.6399999999999, 13.980000000000002,
+    80630.95636000001, 1623.934, 25.633,
+    186284.95866000003, 2913.155, 43.34600000000001,
+    1385587.8862285714, 4867.87, 286.99142857142857,
+    6566.107760000002, 1409.036, 4.659999999999999,
+    11509.334571428579, 2504.19126984127, 4.586031746031746,
+    24352.92131739131, 3243.0852173913045, 6.686956521739129,
+    208714.14304666672, 4575.226666666667, 42.46688888888892,
+    63641.0798414286, 4626.21042857143, 13.283071428571462,
+    692163.0227454546, 5234.21, 131.7809090909091,
+    610282.3271727273, 5011.516363636363, 121.18909090909091,
+    1062096.9008399998, 5224.97, 202.759,
+    35501.42503076923, 3597.0223076923075, 8.962820512820512,
+    146675.0732863158, 4457.088105263159, 30.2716842105263,
+    68443.26269625, 4962.873625, 13.399499999999998,
+    85535.20658243247, 5118.964999999999, 16.88013513513514,
+    292303.0793824176, 4940.77835164835, 58.08439560439562,
+    518130.83629999997, 5068.683076923077, 101.11076923076922,
+    527714.5437884618, 4995.3919230769225, 105.23384615384612,
+    372532.1543488891, 5030.729, 73.64533333333333,
+    656205.2466789475, 5098.965263157896, 128.30368421052634,
+    938173.6109218749, 5161.3065625, 181.928125,
+    1004495.1815770832, 5199.747916666666, 193.62958333333336,
+    1350787.5326, 5132.5152941176475, 263.7641176470588,
+    719133.3267666666, 5118.369999999999, 138.79888888888888,
+    1209535.6416277778, 5132.785, 235.90388888888887,
+    1704008.464897561, 4814.802439024392, 353.6756097560975,
+    1516715.8645718747, 5051.892812500001, 301.80562499999996,
+    28.11440571428573, 1.4425714285714293, 18.3754285714286,
+    3256.025879999999, 1251.7105999999999, 2.6095999999999986,
+    2349.9168400000003, 1257.9399999999998, 1.864,
+    5824.581970588236, 1249.9102941176475, 4.6599999999999975,
+    5022.976577537785, 1311.2159179265643, 3.703866090712763,
+    5162.787551351352, 1585.4045945945945, 3.0227027027027016,
+    12929.977733333342, 1327.0364327485383, 9.892280701754379,
+    11818.07490792079, 2148.6602970297035, 5.813564356435647,
+    13331.145051851854, 3025.9914814814815, 4.487407407407405,
+    18418.94270625, 4217.32, 4.368749999999999,
+    328484.0619888889, 4728.665555555556, 68.87888888888888,
+    37798.28245882352, 4583.961764705883, 8.223529411764705,
+    23904.54728235294, 4764.0599999999995, 4.934117647058823,
+    104623.04462857141, 4516.686190476189, 22.638095238095236,
+    81944.52858235291, 4668.534509803922, 17.273137254901958,
+    386003.613925, 4972.71875, 78.65875000000001,
+    3439.319657142857, 1297.532857142857, 2.662857142857143,
+    96749.78475000002, 2163.46, 23.88625,
+    105282.1622125, 2133.2237499999997, 24.470000000000006,
+    71998.77224404758, 4249.1208333333325, 15.536190476190484,
+    41960.10252588235, 4803.939411764707, 8.663411764705879,
+    103150.9959309524, 4931.826904761906, 20.974047619047617,
+    32491.735999999994, 5049.9054716981145, 6.418867924528302,
+    79880.21326250001, 5163.691562499999, 16.1671875,
+    229294.751037931, 5123.101034482759, 45.483793103448285,
+    102411.20306530612, 5117.7699999999995, 20.07020408163266,
+    74911.00476666667, 3226.2433333333333, 17.09,
+    163919.39429333335, 4758.953333333334, 32.62733333333333,
+    312649.7376029411, 5011.829117647059, 62.03397058823531,
+    473429.1983333333, 5036.986666666667, 94.15366666666665,
+    496307.07053055544, 5029.847222222223, 99.43722222222223,
+    371492.4924666666, 5001.38238095238, 74.13523809523811,
+    624359.3385521739, 5085.53652173913, 121.79695652173913,
+    1043308.28882, 5013.7339999999995, 207.88599999999997,
+    658937.6037583334, 4493.6658333333335, 137.6970833333333,
+    1034115.4674399998, 4757.938, 218.13999999999996,
+    790137.4924464284, 5210.842857142858, 151.48714285714286,
+    1003014.8466500001, 5229.643076923076, 192.00192307692305,
+    1241899.91578, 5138.584, 242.37599999999998,
+    1030635.7945, 5178.789285714287, 200.76142857142855,
+    1153922.343718182, 5180.514545454545, 222.88636363636363,
+    1347195.95727, 5195.818, 261.953,
+    717248.1052333334, 4658.628333333333, 153.8166666666667,
+    611742.8424, 4361.414, 126.782,
+    1248836.2690666667, 5165.598333333333, 242.375,
+    681143.6617500001, 5246.233333333334, 128.95666666666668,
+    1265700.9434222223, 5084.9622222222215, 250.66555555555553,
+    1147450.5844115387, 5232.166923076923, 219.60884615384614,
+    1680436.128238889, 4935.64388888889, 341.81444444444446,
+    1944278.074972727, 4857.087272727274, 401.2790909090909,
+    1503093.2639444445, 5200.165185185185, 290.54185185185185,
+    1957795.4282499999, 4851.953333333334, 403.96166666666664,
+    27.959288764044945, 1.4784269662921357, 18.27404494382025,
+    32.885650000000005, 1.5300000000000002, 21.49388888888889,
+    505.38232571428574, 1314.8448571428573, 0.3994285714285714,
+    854.5042000000001, 1096.5028571428572, 3.3285714285714287,
+    6636.083159241702, 1255.6142654028465, 5.344644549763033,
+    9317.609023404255, 1305.594574468085, 7.188297872340434,
+    5951.387346853147, 1305.3840559440557, 4.562237762237763,
+    40789.26412266671, 1402.6260000000004, 14.354266666666687,
+    3990.200428813561, 1377.4812711864408, 2.8828813559322057,
+    18062.01486666667, 1656.535277777778, 6.213888888888887,
+    9916.004680000002, 2127.898, 4.66,
+    31282.533678125, 2839.0178124999993, 8.301562499999998,
+    4806.5104, 3365.6879999999996, 0.932,
+    72286.41474761904, 4844.904285714286, 15.092857142857142,
+    11709.94757142857, 2512.8642857142863, 4.660000000000001,
+    12072.861109090909, 2590.742727272727, 4.659999999999999,
+    15437.516113207552, 1294.60679245283, 11.957735849056617,
+    13945.76065, 2735.0975000000003, 5.159285714285711,
+    107332.11084285715, 2368.09, 27.964285714285705,
+    399035.14551764703, 4321.983529411765, 84.9958823529412,
+    61077.79861714285, 3714.8525714285724, 14.115428571428577,
+    147403.2699321428, 4418.71607142857, 31.461428571428566,
+    124414.16948217056, 4810.200310077519, 25.219844961240305,
+    273526.2038197183, 4710.785774647888, 57.24619718309859,
+    501629.02894999995, 4750.330833333333, 100.21249999999999,
+    803110.5944000001, 4936.768571428571, 163.14000000000001,
+    1170736.1024666664, 4834.656666666667, 243.41444444444448,
+    1157701.0608, 4830.966875000001, 241.21281249999996,
+    1074419.4245206895, 5253.358275862068, 204.9275862068965,
+    1459825.2036034483, 4994.1058620689655, 294.4531034482759,
+    1964464.7636794115, 4798.220294117646, 410.7255882352942,
+    3230.7780000000002, 1646.25375, 2.33,
+    88789.94744250001, 3594.2457499999996, 19.226000000000006,
+    68555.75795000001, 4677.027222222223, 14.758888888888887,
+    99044.82534999998, 4929.60125, 20.39,
+    23035.42384, 4943.224, 4.66,
+    81306.63323846155, 4999.764615384616, 16.13307692307692,
+    273189.12682999996, 5163.462, 51.737999999999985,
+    20113.6784, 3680.0980000000004, 5.126,
+    76612.95865789473, 4920.126315789474, 15.618421052631579,
+    38718.56958461539, 5135.777692307693, 7.528461538461536,
+    145198.91362061855, 5114.972680412371, 28.254329896907226,
+    412723.2486, 4923.410909090909, 83.05181818181818,
+    258826.54708, 5143.468, 50.338,
+    301327.15528181824, 5237.819090909091, 57.62818181818181,
+    207053.33391250003, 4841.27, 40.785,
+    327712.76946000004, 5139.195999999999, 62.46,
+    430028.211776, 5028.6320000000005, 86.1376,
+    557788.3440052632, 5036.388947368421, 110.63894736842104,
+    385323.6077142857, 5125.481428571429, 74.91142857142857,
+    606973.3431625001, 5158.73, 117.69375,
+    666714.5861187503, 5122.95875, 130.220625,
+    967698.23116, 4891.33, 199.49600000000004,
+    842721.5654192308, 5132.549615384614, 163.67653846153846,
+    1011253.4348875, 5189.063749999999, 192.27,
+    1305004.8367444442, 5230.973333333333, 248.07333333333332,
+    1045587.2429600001, 5221.407999999999, 200.11666666666667,
+    1318666.3561263157, 5265.006842105264, 250.47368421052633,
+    1559840.3093, 5270.365714285714, 295.6471428571428,
+    27.136379611650497, 1.3813592233009717, 17.556407766990308,
+    29.471880000000006, 1.5300000000000002, 19.262666666666657,
+    0.0, 1257.2064000000005, 0.0,
+    5455.3789937500005, 1249.2365624999995, 4.3687499999999995,
+    4884.933723144108, 1272.6476855895196, 3.8460262008733586,
+    4316.560061946901, 1327.8940707964596, 3.2166371681415966,
+    13565.350779220786, 1272.994025974027, 10.651428571428585,
+    47662.604511111116, 1456.7222222222226, 16.260000000000016,
+    13440.837077777776, 1682.9477777777777, 3.3661111111111106,
+    1535.4022181818182, 1342.1766666666665, 1.1296969696969696,
+    7122.107250574707, 1325.7524712643676, 5.383103448275862,
+    29852.607438461542, 1469.7215384615386, 10.575769230769229,
+    13711.64692333333, 2116.4790000000003, 4.893333333333335,
+    11883.71417209302, 2655.358139534884, 4.551627906976742,
+    303258.89458888886, 4595.7122222222215, 63.18222222222222,
+    21014.111559999998, 2499.084, 5.5920000000000005,
+    13084.319522222222, 2807.7938888888884, 4.659999999999998,
+    13844.869319999998, 2971.002, 4.66,
+    43744.40821428572, 4116.301428571429, 9.987142857142855,
+    52723.85445897436, 4649.901282051281, 10.874871794871801,
+    6653.863446153846, 3439.230769230769, 2.867692307692308,
+    31267.586450000003, 4811.69875, 6.4075,
+    57369.65351111111, 4620.133333333333, 12.42666666666667,
+    60855.06147777778, 4691.187777777777, 12.945555555555554,
+    341245.8679399999, 4564.714, 75.50999999999999,
+    121916.90915000002, 4640.44, 24.857500000000005,
+    285780.85715263156, 4780.29947368421, 58.631052631578946,
+    726032.6112833334, 4899.775000000001, 149.93166666666664,
+    1288193.1813400001, 5153.846, 249.836,
+    11157.224971428572, 2786.065714285714, 3.3285714285714287,
+    38417.96268, 4196.276, 8.388000000000002,
+    23528.272211111114, 4800.671333333334, 4.867333333333331,
+    11862.896760000001, 4029.6603333333337, 2.795999999999999,
+    55364.1194769231, 4912.200961538463, 11.352435897435912,
+    45079.88560714286, 5214.16642857143, 8.654999999999998,
+    668973.6394222223, 5159.07, 129.47444444444443,
+    126169.96517460319, 4918.769206349207, 25.746984126984138,
+    474015.5626851852, 5097.849999999999, 92.70444444444445,
+    213894.55395757564, 4932.104848484846, 43.15060606060607,
+    605807.9451323142, 5015.296200873364, 119.09205240174674,
+    664763.40001875, 5020.6040625, 132.55125,
+    1282323.9109470586, 5120.753333333332, 252.6137254901961,
+    454963.83892857144, 4498.517142857143, 91.22428571428573,
+    1254520.19082, 4689.866, 267.548,
+    888356.8565142859, 4913.657142857143, 179.1185714285714,
+    1503731.7188166666, 5229.700000000001, 287.43333333333334,
+    1918353.5505, 4803.876666666666, 401.6300000000001,
+    1853842.6287500001, 5000.256666666667, 372.1116666666667,
+    1810853.1922888889, 4845.5088888888895, 374.4422222222222,
+    2166666.6403400004, 4971.915999999999, 438.142,
+    28.083509638554208, 1.4927710843373503, 17.461325301204834,
+    32.58109285714287, 1.6385714285714286, 19.640714285714285,
+    34.13320714285715, 1.53, 22.309285714285714,
+    379.3882324324324, 1279.4531531531522, 0.2938738738738739,
+    5.7038400000000005, 762.212, 3.728,
+    993.1413181818182, 1426.7336363636364, 0.7413636363636364,
+    87074.413575, 2285.37125, 19.226249999999997,
+    6841.66800379147, 1263.7158767772544, 5.410900473933649,
+    5942.771463076926, 1316.6049615384616, 4.516615384615385,
+    24442.524077922077, 1341.3775324675328, 11.801948051948077,
+    139854.78421249997, 1782.4712499999998, 34.37375,
+    2392.5838000000003, 1323.8700000000001, 1.864,
+    6129.050437500002, 1399.85875, 4.368749999999999,
+    10458.92264, 2154.5586666666663, 4.815333333333331,
+    16514.83362857143, 2971.3928571428573, 5.325714285714286,
+    11842.0386, 2541.21, 4.66,
+    7657.6149000000005, 2334.403333333333, 3.106666666666667,
+    458473.19541249995, 3911.01875, 97.88125,
+    27554.59864, 3142.858, 7.456,
+    19911.67672, 3364.468, 5.5920000000000005,
+    3902.6368285714293, 4100.165714285714, 1.3314285714285714,
+    49889.710570588235, 4977.014705882353, 9.595882352941178,
+    272538.75712, 4929.6410000000005, 55.00100000000001,
+    825337.1294666667, 5104.799999999999, 159.51444444444442,
+    16774.155715384615, 1283.0488461538464, 13.083846153846157,
+    12189.890654545454, 1319.5136363636364, 9.32,
+    12357.495915789472, 1325.9115789473685, 9.319999999999997,
+    30612.117072727262, 1881.6602272727278, 9.74477272727273,
+    11843.455240000001, 2541.514, 4.66,
+    12945.033416666665, 2777.9041666666667, 4.659999999999999,
+    13418.936000000002, 2879.5999999999995, 4.660000000000001,
+    34310.79963076923, 3491.8284615384614, 8.245384615384614,
+    9726.119, 4298.943333333333, 2.33,
+    22612.581113043474, 4444.246086956521, 5.065217391304345,
+    19725.346620000004, 4705.282000000001, 4.194,
+    62601.39371428571, 4942.001428571429, 11.985714285714284,
+    71057.93860945119, 4838.710396341466, 14.621646341463364,
+    210985.8944391304, 4928.1, 43.06521739130435,
+    400353.9651644067, 4940.062033898305, 81.21415254237294,
+    825180.3300454546, 4905.02590909091, 169.49409090909091,
+    132205.68056341461, 5245.577560975611, 25.352195121951215,
+    399979.11208125006, 5278.064375, 75.743125,
+    286170.81362, 5295.79, 54.065999999999995,
+    882357.6757052633, 5296.0926315789475, 166.32736842105263,
+    698390.1884082707, 5040.66894736842, 136.08308270676685,
+    1244737.4429230774, 4936.367076923077, 252.27338461538463,
+    1696938.5398999997, 4980.594285714285, 344.92,
+    2125151.8959, 4918.345, 433.4833333333333,
+    1522980.124715, 4954.442000000001, 311.5949999999999,
+    1054961.7388571429, 5240.274285714286, 200.76000000000002,
+    1948255.1022200002, 4767.094, 411.108,
+    1431386.4808714285, 5188.381428571428, 276.33714285714285,
+    28.867441975308637, 1.529753086419754, 18.41037037037039,
+    31.044600000000006, 1.4400000000000002, 20.290588235294113,
+    2642.489707262571, 1251.1257541899445, 2.316983240223467,
+    2252.739652631579, 1440.1007894736842, 0.9810526315789474,
+    7056.462796103901, 1267.2466883116904, 5.567792207792208,
+    6517.08037551021, 1301.4502551020407, 5.016632653061219,
+    9570.245883333333, 1312.8316666666665, 7.378333333333331,
+    20325.831655555554, 1671.7544444444443, 7.767777777777777,
+    2347.0730750000002, 1348.2525000000003, 1.7475,
+    3950.7885870967743, 1461.7067741935482, 2.5554838709677408,
+    34594.426185714285, 2898.715714285714, 7.989999999999999,
+    56630.44766666667, 3601.064166666667, 13.205833333333333,
+    11247.238862857143, 2413.5705714285714, 4.6599999999999975,
+    13929.713117647061, 1287.662941176471, 10.82764705882353,
+    12308.249670588231, 1320.6276470588236, 9.319999999999995,
+    13931.633859999998, 1300.0610000000001, 10.718,
+    13251.609962499999, 1438.969375, 9.611249999999997,
+    11316.918733333334, 1325.2966666666669, 8.543333333333335,
+    11993.580007692308, 2522.3653846153848, 4.839230769230767,
+    12990.035954545454, 2787.5613636363637, 4.6599999999999975,
+    10741.652828571428, 3714.242857142857, 3.3285714285714287,
+    33226.6212875, 2555.13625, 13.39875,
+    70484.82084090909, 4304.376363636364, 15.253181818181817,
+    312434.3325264706, 4738.112352941176, 63.747352941176466,
+    851723.3099518517, 4812.327777777778, 175.0511111111111,
+    1578746.8963, 4874.236, 324.412,
+    1237104.432575, 5164.0725, 240.045,
+    1638999.8268777777, 4786.663333333333, 343.8855555555555,
+    8539.06788, 1311.966, 6.524000000000001,
+    10595.007066666667, 1564.9166666666667, 6.990000000000001,
+    3013.2647333333334, 1296.0433333333333, 2.33,
+    5427.728342857144, 1359.2371428571428, 3.994285714285714,
+    4185.213311111112, 1731.4477777777777, 3.106666666666667,
+    23684.437113043477, 3025.4952173913043, 6.079130434782607,
+    20927.608562500005, 3702.2118750000013, 5.824999999999999,
+    235101.52787500003, 4537.801666666665, 46.02708333333334,
+    14012.177300000001, 4166.0925, 3.495,
+    75411.5526868421, 4684.547631578949, 16.06789473684211,
+    94580.04738750002, 4654.462916666665, 19.760208333333335,
+    254768.91037291673, 4720.568333333334, 53.60270833333332,
+    56711.126050561754, 4929.809438202246, 11.415842696629209,
+    92784.84666639345, 5125.828278688523, 18.299180327868854,
+    261996.74967, 5138.507333333332, 51.350166666666645,
+    445568.0374705882, 5137.961960784313, 86.64156862745101,
+    431640.8215800001, 5043.651428571429, 85.498,
+    581572.7004965518, 4993.579310344829, 115.8848275862069,
+    753966.5774166667, 5099.46, 148.38,
+    962404.67023, 5157.052000000001, 187.84300000000002,
+    101166.65568, 3589.4359999999992, 21.439999999999998,
+    380019.0767111111, 5006.741666666668, 75.35388888888889,
+    848910.6072333334, 5025.183333333333, 168.57500000000002,
+    724925.1587272728, 5250.720909090909, 137.71272727272728,
+    740669.55472, 4907.508, 151.02399999999997,
+    735151.5832222222, 5191.458888888889, 141.38777777777779,
+    1065429.8100942855, 5179.226285714286, 205.3554285714286,
+    1229671.995653846, 5091.926923076922, 242.19730769230767,
+    1062749.47895, 5171.397999999999, 205.7875,
+    1274423.554609091, 5147.768181818182, 248.31090909090906,
+    1232456.7370250002, 4834.21, 258.10875,
+    1793232.9816819998, 4862.5452000000005, 370.74420000000003,
+    26.03573181818179, 1.3677272727272736, 17.016818181818177,
+    29.53992857142857, 1.5299999999999998, 19.307142857142857,
+    19.012800000000002, 1.02, 12.426666666666668,
+    33.71563636363637, 1.5299999999999998, 22.036363636363635,
+    31.117418181818177, 1.5299999999999998, 20.338181818181816,
+    4276.653137596896, 1287.7994767441864, 3.368565891472886,
+    13234.972006106873, 1292.7708396946573, 10.244885496183208,
+    16648.301557142855, 1714.7438095238097, 6.102857142857141,
+    10124.403375000002, 2786.55375, 4.077500000000001,
+    8256.431424, 1319.7817000000002, 6.2909999999999995,
+    36365.98976666666, 1812.6786111111107, 10.486388888888895,
+    6970.0848545454555, 1747.280909090909, 3.8127272727272725,
+    103651.87040555554, 2940.281388888888, 23.951944444444447,
+    14408.15148, 2125.763, 4.194,
+    12720.917262857147, 2729.810571428572, 4.6599999999999975,
+    8505.165991666667, 4629.375416666666, 1.7474999999999998,
+    15435.695036363637, 3312.3809090909085, 4.659999999999999,
+    33204.6433, 4307.953571428571, 7.3235714285714275,
+    70510.13391785714, 4491.540357142858, 15.147857142857147,
+    48022.481450000014, 4896.16388888889, 9.813000000000015,
+    330242.9232, 4985.31125, 65.83875,
+    359947.2697064516, 5027.078387096775, 72.02161290322582,
+    981668.8949, 5117.302857142857, 193.10142857142856,
+    702290.9833874999, 5045.0225, 138.08625,
+    1238625.6573499998, 4971.508333333333, 252.47500000000002,
+    1488002.8073142858, 5007.629999999999, 301.6414285714286,
+    1163711.9966444443, 5159.070000000001, 228.39333333333332,
+    1456971.2218833333, 5376.476666666667, 271.12,
+    7126.553533333335, 1316.1366666666668, 5.436666666666667,
+    10698.372080000001, 2039.378, 4.66,
+    24519.06532, 3419.1099999999997, 6.524000000000001,
+    26863.923118181818, 3353.729090909091, 7.626363636363636,
+    98015.22873333334, 4645.655, 20.973333333333333,
+    67252.14971428573, 4547.358571428572, 14.648571428571428,
+    71434.46391666666, 4589.4383333333335, 15.535000000000002,
+    73503.83874, 4637.0560000000005, 15.846,
+    161867.35722666667, 4685.796666666667, 34.804,
+    28194.3048, 4732.252857142857, 5.991428571428571,
+    77935.48166, 4166.36, 16.78,
+    117799.64147631577, 4864.60447368421, 24.409210526315793,
+    116057.65399333333, 5099.898533333329, 22.5592,
+    45620.89627500001, 4592.49125, 9.030624999999999,
+    71160.88752413793, 4955.475862068966, 14.14310344827586,
+    336053.6321494117, 4957.481058823533, 68.27070588235297,
+    565704.0421348838, 4963.973255813955, 113.32941860465117,
+    325242.69573, 5286.326, 61.528000000000006,
+    756691.2679666667, 5271.907692307691, 143.1802564102564,
+    469661.5019777778, 5015.346666666666, 93.48222222222222,
+    841012.0445576925, 5119.165384615387, 165.2896153846154,
+    692835.7188666665, 5008.331249999999, 139.05583333333337,
+    1186746.83424, 5069.801000000001, 236.00666666666666,
+    736766.736142857, 4662.371428571429, 151.15285714285713,
+    1350238.0323666667, 4798.28, 285.10166666666663,
+    1684143.72567027, 4921.708108108107, 343.28324324324325,
+    2116694.0675, 4840.202000000001, 440.009,
+    923712.3411555557, 5117.351111111111, 178.15777777777777,
+    1246583.7493999999, 5297.62, 234.91799999999998,
+    26.50277547169809, 1.3856603773584912, 17.322075471698103,
+    23.766000000000002, 1.2750000000000001, 15.533333333333333,
+    29.948220000000003, 1.5299999999999998, 19.574,
+    30.10700000000001, 1.5299999999999998, 19.67777777777778,
+    28.526000000000003, 1.3599999999999999, 18.644444444444446,
+    4475.735920599251, 1266.3318352059923, 3.5429962546816416,
+    11223.171294285712, 1277.9537142857153, 8.787428571428576,
+    4650.605157575757, 1266.5581818181818, 3.6715151515151496,
+    10408.704835294118, 1480.465882352941, 7.401176470588233,
+    1673.4659142857145, 356.49000000000007, 11.982857142857142,
+    5071.101316666668, 1263.145, 4.012777777777775,
+    9278.836666666666, 1283.027222222222, 7.248888888888885,
+    0.0, 1304.2430769230773, 0.0,
+    6433.559593749999, 1299.3668750000002, 4.951249999999997,
+    6080.8410606060625, 1304.9015151515152, 4.6599999999999975,
+    6130.391612765957, 1315.534680851065, 4.6599999999999975,
+    6733.011355555555, 1298.671111111111, 5.177777777777777,
+    12261.681955555556, 1315.631111111111, 9.32,
+    11244.6033, 1316.1383333333333, 8.543333333333335,
+    6202.28090980392, 1340.4183006535948, 4.660000000000002,
+    6682.66751764706, 1539.2708823529415, 3.9747058823529398,
+    8924.571039999999, 1360.1979999999999, 6.524000000000001,
+    17782.6066, 2160.79, 7.572500000000001,
+    69999.68983472223, 3705.4423611111115, 15.148194444444451,
+    126780.16956666665, 5063.932222222223, 23.823333333333334,
+    12447.78726101695, 2611.2094915254233, 4.738983050847458,
+    104272.60208000001, 3404.9139999999998, 23.770999999999994,
+    17357.42957058824, 1279.222647058824, 13.56882352941177,
+    15567.456960000001, 1284.492, 12.115999999999998,
+    15137.4275, 1298.0783333333334, 11.65,
+    101192.30589999999, 2568.6814285714286, 23.969999999999995,
+    29965.762188235294, 3309.0029411764704, 7.949999999999998,
+    163836.67323999997, 4340.965, 35.42200000000001,
+    16972.059514285713, 4254.317142857143, 3.994285714285714,
+    22369.0787037037, 4619.22962962963, 4.832592592592591,
+    49420.80818181818, 4741.023030303029, 10.309696969696974,
+    36560.836025, 5083.316785714285, 7.156607142857147,
+    201878.18782857145, 4819.858285714286, 41.54971428571431,
+    111191.10905666667, 5132.785, 21.439666666666668,
+    225654.81841250006, 5012.40125, 44.86375,
+    1159771.7048666666, 4994.913333333333, 235.38833333333332,
+    60656.75016000001, 4529.608, 13.516000000000002,
+    260747.29802000002, 4593.864, 56.4,
+    30709.040211111114, 2881.902222222222, 8.803333333333333,
+    162472.98790576926, 4677.608269230769, 34.689615384615394,
+    71060.18802222221, 3898.5555555555557, 16.055555555555557,
+    63460.85844761904, 4988.1171428571415, 12.539047619047622,
+    178714.04591639343, 5128.806393442623, 34.69081967213116,
+    315169.1112816668, 4563.747, 67.11916666666667,
+    378591.6800411765, 5141.911764705881, 73.57215686274508,
+    788588.87425, 5047.823333333334, 156.14666666666668,
+    1010754.3365636363, 5054.113636363637, 202.12363636363636,
+    774380.6762796296, 5075.548888888886, 151.7437037037037,
+    1220559.9811132734, 5107.675309734513, 239.65522123893817,
+    1361482.2151357145, 4603.719285714286, 285.9914285714286,
+    1750225.558918182, 4929.376363636364, 356.36227272727274,
+    29.818309090909096, 1.5299999999999998, 19.489090909090905,
+    26.004599999999975, 1.3500000000000008, 16.99647058823529,
+    34.71162, 1.5300000000000002, 22.687333333333335,
+    33.2826, 1.53, 21.75333333333333,
+    5803.657200000001, 1245.4199999999998, 4.659999999999998,
+    5802.638657142858, 1245.2014285714286, 4.660000000000001,
+    5810.77535, 1246.9475000000002, 4.66,
+    4608.175455963308, 1266.5448623853226, 3.6339449541284377,
+    1400.1370976744186, 1290.4979069767444, 1.083720930232558,
+    4705.488917355373, 1299.421404958677, 3.620165289256205,
+    1836.9454862068962, 1341.5760344827584, 1.3658620689655168,
+    11434.033313043474, 1268.1858695652172, 9.016086956521734,
+    6729.746988571428, 1320.2202142857143, 5.126000000000002,
+    13218.476664462798, 1307.026528925619, 10.12876033057852,
+    115245.97085000001, 1732.2950000000003, 30.294999999999995,
+    6382.405234285713, 1916.4488571428574, 3.461714285714284,
+    10746.73094385965, 2306.165438596491, 4.659999999999998,
+    104712.23160000001, 4711.540000000001, 22.372000000000003,
+    15060.356925, 3231.83625, 4.66,
+    362112.97245714284, 3952.9928571428577, 77.90571428571427,
+    661755.0137833332, 4818.631666666667, 136.725,
+    12607.800866666666, 2540.362222222222, 5.177777777777777,
+    12923.112000000001, 2773.2000000000003, 4.66,
+    99513.28012000001, 3504.886, 22.371999999999996,
+    7293.715500000001, 1500.055, 4.66,
+    32608.269088888886, 2978.1688888888893, 8.630370370370368,
+    18955.551900000002, 4087.429166666667, 4.659999999999999,
+    83132.36520000001, 4517.873333333333, 17.607777777777773,
+    31023.99869999999, 4502.080263157895, 6.745263157894735,
+    141104.09792666664, 4721.102666666667, 28.586,
+    86267.85775, 4596.152, 18.644,
+    422055.0628142857, 4722.878571428571, 89.89285714285714,
+    52591.44246282051, 4764.311794871794, 10.875256410256409,
+    303265.59555714286, 3894.34, 65.25571428571429,
+    57763.18705684212, 4850.941263157895, 11.823684210526324,
+    72182.40091743122, 5111.332935779816, 14.110366972477076,
+    80896.09267, 4971.968333333334, 16.313,
+    290776.9190775281, 4954.023707865171, 58.394943820224746,
+    878557.9701666665, 5127.953333333334, 170.90666666666667,
+    402203.15314761904, 4879.280476190476, 83.2352380952381,
+    1121053.5829315789, 4781.022105263158, 235.7531578947368,
+    247905.5498981818, 4536.629818181818, 52.37381818181817,
+    670951.9721081081, 4642.938378378379, 141.597027027027,
+    191836.68454375002, 5214.343125, 36.70562499999999,
+    497539.17901929823, 5089.835087719298, 96.32982456140344,
+    683337.8639504949, 5201.057623762378, 131.15673267326736,
+    1072700.4642875, 5242.1025, 204.50624999999997,
+    1710343.5094800002, 4866.605, 353.778,
+    2058265.3829599998, 4807.996000000001, 430.686,
+    2056293.50126, 4702.99, 437.20799999999997,
+    1232414.8262729733, 5118.6764864864845, 241.49567567567567,
+    1472209.2081459456, 5131.010810810812, 288.7356756756756,
+    1916680.8302875003, 4706.96125, 407.26249999999993,
+    1605253.4878421053, 4916.9394736842105, 324.80526315789473,
+    25.350400000000004, 1.3599999999999999, 16.56888888888889,
+    28.121361111111085, 1.487361111111112, 18.122777777777785,
+    27.6337125, 1.3387499999999999, 18.06125,
+    32.488699999999994, 1.5299999999999998, 21.234444444444446,
+    5484.581632460736, 1262.0512041884838, 4.342827225130887,
+    6440.74577142857, 1378.862857142857, 4.660000000000001,
+    5211.311285714284, 1189.081428571429, 4.659999999999998,
+    11018.044085714284, 1276.8214285714287, 8.654285714285715,
+    6532.346730751701, 1305.516150341684, 5.010318906605932,
+    12798.278615789473, 1527.5357894736842, 4.660526315789472,
+    9508.53428, 1364.9401818181816, 7.117090909090909,
+    12175.710133333332, 1968.9899999999998, 5.048333333333333,
+    75203.74646, 3994.504, 16.778,
+    6788.868808, 1545.7284, 4.473599999999999,
+    7148.688533333333, 2267.6722222222224, 3.624444444444445,
+    11150.914, 2392.9, 4.6599999999999975,
+    13276.4798, 2849.03, 4.659999999999998,
+    27281.611099999995, 2803.5016666666666, 7.670416666666678,
+    12541.88672, 4496.032, 2.7960000000000003,
+    116217.78263999999, 4554.334, 25.169999999999998,
+    39783.022979999994, 4759.767999999999, 8.389999999999997,
+    178028.58345714287, 4682.321428571428, 37.95428571428572,
+    950182.7552499999, 4843.303333333333, 198.87333333333333,
+    1507030.84468, 4959.7080000000005, 308.566,
+    1148665.575566667, 4895.96, 234.60999999999999,
+    6746.202982608697, 1408.663913043478, 4.862608695652173,
+    8062.53628, 1721.6109999999996, 3.2620000000000005,
+    66135.27286666668, 3296.0255555555555, 15.535555555555554,
+    13051.135514285716, 3681.1014285714286, 3.3285714285714287,
+    21224.977725000004, 4554.7162499999995, 4.66,
+    126602.86308181817, 5047.453636363637, 23.729090909090907,
+    12010.957775, 5127.44375, 2.33,
+    172082.75563292188, 4851.315967078195, 34.76557613168716,
+    1496934.7067875, 4936.0875, 303.55375000000004,
+    450013.99560588243, 5295.045882352941, 84.99588235294115,
+    1118679.7114714286, 5315.352857142857, 210.63714285714286,
+    51309.45117777777, 4908.763333333332, 10.356666666666667,
+    104417.37135999999, 4464.8949999999995, 21.906,
+    472446.20589677437, 4646.549677419353, 96.68064516129034,
+    1314696.938645, 4955.776749999999, 268.4792499999999,
+    122668.12011363638, 5075.064545454545, 24.151818181818182,
+    357394.1035666666, 5093.101428571429, 70.58261904761905,
+    530980.45229375, 5004.483124999999, 106.33187499999998,
+    722407.8182399999, 5096.764, 142.628,
+    259418.34235, 5140.22375, 51.271249999999995,
+    673166.4675333332, 5286.681666666666, 127.40333333333335,
+    324278.8486833333, 4872.556666666666, 66.80999999999999,
+    971387.1591611939, 5113.5808955223865, 189.6441791044776,
+    1643341.33752, 4936.201999999999, 337.462,
+    1960129.87775, 4765.33875, 413.09000000000003,
+    2067936.456511111, 4777.337777777778, 433.48111111111103,
+    1398697.1763571426, 5194.707142857143, 270.34285714285716,
+    1330551.34402, 5341.882, 248.902,
+    2086298.1733199998, 4965.202, 423.22799999999995,
+    1920906.8486666668, 4916.056666666667, 393.08666666666676,
+    25.520581159420264, 1.3524637681159428, 16.411739130434782,
+    29.94822, 1.53, 19.574,
+    26.486485714285717, 1.3114285714285714, 17.31142857142857,
+    30.900900000000004, 1.53, 20.19666666666667,
+    34.87039999999999, 1.5299999999999998, 22.79111111111111,
+    5802.587730000001, 1245.1905, 4.659999999999998,
+    5803.657200000001, 1245.42, 4.66,
+    5818.59716, 1248.626, 4.659999999999999,
+    1171.1667333333332, 1256.616666666667, 0.932,
+    5856.11715, 1256.6775000000002, 4.66,
+    4177.996228571429, 1255.4542857142858, 3.3285714285714287,
+    2732.9529265957444, 1274.956170212766, 2.156489361702131,
+    7360.26921543409, 1289.2821221864956, 5.723858520900343,
+    12258.116294117646, 1296.1479411764708, 9.457058823529408,
+    12953.93531111111, 1629.528888888889, 8.802222222222222,
+    10201.786635999995, 1318.9560000000004, 7.735599999999998,
+    4527.521629126216, 1387.9864077669902, 3.121747572815534,
+    9507.932317647059, 1733.911176470588, 3.8376470588235283,
+    87655.56600416667, 3045.508333333333, 19.031666666666666,
+    4038.8592799999997, 1317.9699999999998, 3.1066666666666665,
+    93137.54440833331, 1619.8625, 22.91583333333334,
+    10800.35653846154, 3941.8392307692307, 2.1507692307692308,
+    33280.75111489364, 2450.5748936170207, 9.221914893617033,
+    4369.8124800000005, 4645.602, 0.932,
+    10483.580818181817, 4951.577272727273, 2.118181818181818,
+    108502.79862857143, 5227.848571428572, 19.975714285714282,
+    17040.83599795919, 1407.0789795918367, 11.697755102040823,
+    39448.476437777776, 3639.0591111111116, 9.52844444444445,
+    396043.54148, 4862.94, 81.102,
+    1203572.39072, 4836.386, 247.96999999999997,
+    17924.773880000004, 2761.1711999999998, 5.964799999999999,
+    44854.579845614055, 4405.324736842106, 9.5661403508772,
+    145178.14974705884, 4299.629411764705, 31.805294117647055,
+    286806.7728257144, 4693.3974285714285, 60.46085714285713,
+    44171.62348432431, 4997.351891891892, 8.943135135135147,
+    274440.91951677424, 5014.612451612904, 54.76038709677421,
+    1143828.7871214289, 4992.587500000001, 232.55642857142854,
+    736521.22828, 5187.8055, 140.88174999999998,
+    135208.5070125, 4849.855416666665, 26.89729166666667,
+    308623.7671117647, 4830.556078431372, 62.4219607843137,
+    789764.9878626582, 5070.285189873419, 154.2884177215189,
+    1337104.91449375, 5107.125, 263.64375,
+    901632.7715500001, 4395.349999999999, 187.22166666666666,
+    1940443.164690909, 4744.976363636363, 408.90636363636366,
+    1689448.4907384613, 4717.407692307692, 358.1876923076924,
+    1192518.3681142856, 4897.522857142857, 241.71142857142857,
+    1584043.7995999998, 4995.062352941176, 317.5029411764706,
+    947722.6320500001, 5086.235, 185.66666666666666,
+    1317100.61674, 5136.752, 254.496,
+    1490009.9587222221, 5278.965555555555, 281.21999999999997,
+    27.955496039603972, 1.4390099009900998, 18.088217821782198,
+    5800.2404879999995, 1244.6867999999997, 4.6599999999999975,
+    627.1577785714286, 1257.1425000000004, 0.4992857142857143,
+    4931.770005128205, 1251.6453846153843, 3.9430769230769207,
+    2698.5361, 1261.8275, 2.135833333333333,
+    5605.3501233333345, 1266.1533333333332, 4.426999999999999,
+    10310.920975, 1263.735, 8.15625,
+    5901.81544, 1266.484, 4.659999999999999,
+    682.3094333333332, 1309.5579999999995, 0.5177777777777777,
+    5783.743595041327, 1286.341322314049, 4.5059504132231485,
+    5151.593990909091, 1289.0590909090906, 4.024545454545453,
+    7582.453760000001, 1627.136, 4.659999999999999,
+    18536.308699999998, 1878.0516666666665, 4.661666666666666,
+    2319.743094736842, 1347.7605263157895, 1.7168421052631582,
+    0.0, 1347.6799999999998, 0.0,
+    0.0, 1962.94875, 0.0,
+    153678.20627999998, 3946.886, 32.628,
+    0.0, 3235.3480000000004, 0.0,
+    7085.064000000001, 4630.6466666666665, 1.5533333333333335,
+    0.0, 4543.3949999999995, 0.0,
+    105576.66426666667, 5084.96, 20.198333333333334,
+    3767.757566666667, 4947.7266666666665, 0.7766666666666667,
+    9920.981056216222, 1300.5160540540542, 7.657513513513518,
+    23148.60533061225, 1403.2804081632657, 10.461836734693883,
+    8800.389561666667, 1394.8673333333334, 5.436833333333335,
+    123080.3153809524, 2761.42619047619, 28.18714285714286,
+    11782.299264, 1292.7364000000002, 9.133599999999996,
+    9626.789546666667, 1586.591333333333, 5.592,
+    8886.274383333333, 1373.3733333333337, 6.601666666666667,
+    330306.1760736842, 3730.722631578947, 68.68894736842105,
+    8460.121266666665, 1351.2416666666666, 6.213333333333334,
+    19323.66791875, 2466.5181249999996, 6.116562499999998,
+    14413.2547625, 2718.6840625, 5.024062500000004,
+    209723.35933333336, 2775.235, 48.16333333333335,
+    16887.055566666666, 3425.6733333333336, 4.66,
+    17186.23844, 3688.0339999999997, 4.66,
+    70782.53179499999, 4554.7155, 15.148000000000001,
+    775126.0909799999, 4981.076, 150.088,
+    6635.808933333334, 2487.791666666667, 3.106666666666667,
+    35217.412460833344, 4773.720666666667, 7.301166666666662,
+    123942.47888333334, 5243.4383333333335, 23.304999999999996,
+    40094.46276842105, 5184.276315789473, 7.848947368421049,
+    95183.37639189188, 4635.3083783783795, 20.532432432432433,
+    123295.5471, 5072.971999999999, 24.59911111111111,
+    1059968.4200533333, 4978.530666666667, 214.72266666666664,
+    630039.687765, 5228.633, 119.09149999999997,
+    40613.856692307694, 3920.3530769230765, 9.320769230769232,
+    56367.10170555556, 4352.2761111111095, 12.169444444444443,
+    187779.94160769242, 5036.086923076926, 37.512692307692284,
+    430116.96985517256, 4962.527931034481, 86.8739655172414,
+    477713.05560000014, 4581.214029850746, 98.92597014925373,
+    598868.1518424242, 5206.552828282828, 114.73838383838383,
+    1184063.58665034, 5107.180748299319, 233.1820408163266,
+    1824284.5053742856, 4866.955142857143, 376.3511428571428,
+    27.962203896103883, 1.470259740259741, 18.03545454545456,
+    30.900900000000004, 1.5299999999999998, 20.196666666666665,
+    837.2222571428573, 1256.5442857142857, 0.6657142857142857,
+    1183.5188400000002, 754.582, 8.388,
+    680.4737444444446, 280.49444444444447, 17.61,
+    5804.695991666664, 1245.6429166666658, 4.6599999999999975,
+    4661.4213, 1251.527, 3.728,
+    32.09175, 1.53, 20.975,
+    342.55480769230775, 1280.4812500000003, 0.26884615384615385,
+    5881.072184684682, 1279.680765765767, 4.597027027027017,
+    22364.516678571432, 1517.8585714285712, 8.655,
+    10682.655419565224, 1298.4433695652174, 8.256304347826092,
+    7823.769141666668, 1286.9701388888889, 6.083888888888895,
+    33688.0871923077, 2571.3823076923077, 9.679230769230768,
+    15800.869907692308, 1299.31, 12.187692307692306,
+    624539.5266857141, 3504.054285714286, 131.17714285714285,
+    3942.0655727272756, 1376.0786363636364, 2.6477272727272756,
+    8624.40646, 2231.836, 3.2620000000000005,
+    127567.45184, 3697.649, 29.363999999999997,
+    96084.16909166666, 1638.3050000000003, 25.63416666666667,
+    10998.876238709681, 2433.632419354839, 4.509677419354838,
+    8931.548478260871, 1829.9091304347824, 4.052173913043477,
+    12520.169904347826, 2880.034782608696, 4.457391304347824,
+    37314.328604, 4269.840800000002, 8.016600000000006,
+    57418.48303017245, 4675.961120689656, 12.093448275862078,
+    666852.4460875, 5008.108125, 130.21875,
+    60508.62001138213, 5088.398943089427, 11.82211382113822,
+    115528.56403333334, 5100.29303030303, 22.669242424242434,
+    364179.5592272727, 4516.5945454545445, 78.39272727272727,
+    226499.72898636368, 4989.871818181818, 45.551136363636374,
+    1116983.4575285716, 5012.864285714286, 225.73142857142858,
+    401969.6675111111, 4937.422222222222, 80.79222222222222,
+    39349.4534375, 3802.7518749999995, 9.03,
+    227790.04570000002, 5001.760769230769, 45.53384615384617,
+    253953.08699480517, 4902.5378571428555, 50.757597402597426,
+    620003.4308394364, 5021.324366197182, 122.10830985915494,
+    962381.4679941174, 5092.47294117647, 186.99235294117645,
+    222808.08855000001, 4243.486666666667, 45.83500000000001,
+    1737874.8000999999, 4692.905, 370.3629166666667,
+    1564492.5383655175, 5082.048965517241, 309.72172413793106,
+    165241.44967777777, 5069.36, 32.10888888888889,
+    806248.5960285714, 5261.642857142857, 152.4842857142857,
+    704688.09128, 5136.448, 137.036,
+    542277.2447285715, 5199.9400000000005, 104.54285714285716,
+    541988.25195, 5068.8725, 103.71,
+    1040598.1452666668, 5234.127333333333, 198.56266666666664,
+    1068068.3588, 5100.622857142857, 209.41714285714286,
+    1461386.3147049998, 5137.668000000001, 287.124,
+    1521786.11956, 4820.818, 319.752,
+    2059300.130018182, 4833.776363636363, 426.7018181818182,
+    1432165.43635, 4965.964000000001, 292.716,
+    28.40193709677417, 1.5051612903225815, 18.264677419354836,
+    33.21026666666667, 1.7816666666666665, 15.533333333333333,
+    32.602114285714286, 1.5299999999999998, 21.308571428571423,
+    23.175675000000002, 1.1475, 15.1475,
+    5596.383728571427, 1200.776785714285, 5.159285714285713,
+    4231.743962841522, 1275.3425683060113, 3.3231147540983623,
+    13030.645054237302, 1278.4307627118656, 10.18881355932204,
+    6757.681076923075, 1300.866923076923, 5.197692307692305,
+    5784.451897619047, 1321.6088095238106, 4.382619047619053,
+    2495.2681709090907, 1340.605272727273, 1.8639999999999992,
+    11971.640103703694, 1321.5081481481482, 9.061111111111106,
+    16924.073292307694, 1548.793846153846, 10.395384615384614,
+    9062.608545714287, 1990.3926666666673, 4.216380952380961,
+    28977.492065789465, 2636.117368421053, 8.2171052631579,
+    9251.01802, 2164.837, 4.194,
+    14851.042379310342, 3038.293793103449, 4.820689655172412,
+    12724.97545714286, 3320.4685714285724, 3.994285714285714,
+    28259.472285714284, 4002.4123809523803, 6.436190476190476,
+    106804.47973846152, 4513.4776923076915, 23.30384615384616,
+    59522.394870000004, 3971.307, 13.516000000000002,
+    92514.82932153287, 4800.2449270072975, 19.2049635036496,
+    366694.3977857143, 4919.435714285714, 75.57642857142858,
+    418808.33872777777, 5210.877777777779, 79.23833333333333,
+    79635.90746666669, 5108.771, 15.691666666666668,
+    134323.12972352948, 4574.714117647059, 28.10323529411765,
+    582909.7114173333, 4725.030800000001, 120.62946666666666,
+    1939549.3928800002, 4783.272, 405.518,
+    1836614.8108571428, 4729.851428571428, 388.2014285714286,
+    129941.8625880953, 5217.091071428572, 24.7472619047619,
+    554168.4722700001, 5196.428250000001, 105.6895,
+    1051708.0609363639, 5267.973333333334, 199.57909090909087,
+    1424364.856675, 5262.51625, 270.92625000000004,
+    982875.9207333332, 5311.355555555555, 185.4077777777778,
+    76205.01335714287, 4880.515, 15.647142857142857,
+    461315.71451875, 4758.565624999999, 95.55312500000001,
+    108230.52207999998, 5103.481, 20.972999999999995,
+    199920.0234, 5086.931304347827, 39.31565217391305,
+    396744.6151666666, 4996.056666666667, 78.84833333333333,
+    714429.0979217392, 5221.903043478262, 136.3882608695652,
+    700400.1819564517, 4984.663387096774, 140.88596774193545,
+    1155309.5679658535, 5132.857804878049, 226.80268292682922,
+    1717477.8449444445, 4686.438888888889, 366.1555555555555,
+    1289321.4892250001, 5226.078750000001, 247.03875,
+    1492403.5524099998, 4816.85, 310.89300000000003,
+    1201380.77284, 5242.674, 229.32800000000003,
+    1566677.9549333332, 4962.224166666667, 315.40000000000003,
+    1871349.4376166668, 4965.404583333334, 379.4920833333333,
+    27.73738681318682, 1.4459340659340667, 18.129010989011014,
+    32.07937, 1.6060000000000003, 20.040999999999993,
+    901.0791076923077, 1256.6946153846156, 0.716923076923077,
+    1463.36815, 1257.25, 1.165,
+    3872.6697000000004, 1039.631666666667, 6.213333333333334,
+    5803.657200000001, 1245.4199999999996, 4.659999999999998,
+    5831.776971428571, 1251.4542857142858, 4.659999999999998,
+    0.0, 1263.6708695652173, 0.0,
+    245.3266575342466, 1289.431095890411, 0.1915068493150685,
+    5963.316349720671, 1272.689832402236, 4.686033519553067,
+    6216.466498039215, 1308.5082352941176, 4.751372549019605,
+    5904.132625, 1266.9812499999998, 4.66,
+    21915.854452941174, 1478.3099999999997, 7.675882352941174,
+    6873.179625000001, 1802.1212500000001, 3.495,
+    3959.8548050000004, 1352.8452500000008, 2.9901666666666693,
+    7209.349166071428, 1553.5332142857146, 4.244107142857141,
+    8732.368822222223, 2028.22, 4.142222222222222,
+    4848.641977777778, 1340.643333333333, 3.6244444444444444,
+    144742.88902222223, 1971.75, 31.073333333333338,
+    9464.380780000001, 1890.4150000000002, 5.1259999999999994,
+    16589.118466666667, 2576.312222222222, 5.695555555555556,
+    66909.72817777778, 4404.168888888888, 13.724444444444444,
+    50363.87115454546, 4763.153636363637, 9.32181818181818,
+    6556.553428571429, 4744.0257142857145, 1.3314285714285714,
+    132690.22084000002, 4939.8640000000005, 27.965999999999998,
+    11524.8324, 2473.14, 4.66,
+    11819.581178378374, 1268.1954054054054, 9.319999999999995,
+    10159.452399999998, 1271.802857142857, 7.98857142857143,
+    13319.0256, 1286.63, 10.355555555555554,
+    11960.720062500002, 1283.3390625000002, 9.319999999999995,
+    13187.458266666668, 1307.9983333333334, 10.096666666666668,
+    12230.8457, 1312.3225, 9.319999999999999,
+    12289.649638709674, 1318.6319354838713, 9.319999999999995,
+    18882.055933333333, 1279.7616666666665, 14.756666666666668,
+    17198.387577777776, 1277.4711111111112, 13.462222222222225,
+    17897.0096, 1280.1866666666667, 13.980000000000002,
+    16186.94804, 1287.0869999999998, 12.582000000000003,
+    11953.940733333333, 1326.8219999999997, 9.00933333333333,
+    11897.623815789475, 2364.8871052631575, 5.27315789473684,
+    17323.659566666665, 3250.1695555555557, 5.177999999999997,
+    603552.34298, 4449.634, 125.84900000000002,
+    49300.61528135596, 4724.951101694915, 10.387542372881356,
+    70596.41715463919, 5096.295463917526, 13.549587628865977,
+    236429.72185707057, 4840.676262626261, 47.44631313131307,
+    546109.014925926, 5003.414666666665, 108.17177777777773,
+    1735646.121153846, 4719.815769230769, 368.22769230769245,
+    1159338.129370833, 4713.44625, 241.0183333333334,
+    931621.0347919997, 5225.518800000002, 177.6812,
+    1170551.9466825398, 5215.250634920636, 223.4371428571428,
+    1237433.98106, 4686.201999999999, 263.81800000000004,
+    1398848.37334, 4900.794, 285.258,
+    1977073.9548999998, 4689.951428571428, 421.4971428571428,
+    2051398.4332142859, 5021.584285714286, 409.50999999999993,
+    28.518557692307702, 1.4562500000000007, 18.283461538461562,
+    5563.026450000001, 1193.5912500000002, 5.242499999999997,
+    1899.2011523255808, 1320.5723837209289, 1.4359302325581387,
+    16922.670703703705, 1764.968888888889, 3.97037037037037,
+    9439.37917307692, 1315.1184188034176, 6.790897435897435,
+    12427.889860869565, 1467.0932608695655, 6.281086956521742,
+    15098.76348, 2834.706, 5.1259999999999994,
+    517776.3889333335, 4368.64, 110.70083333333334,
+    10599.961140909094, 2446.8934090909092, 4.342272727272725,
+    7824.98812, 1400.488, 5.5920000000000005,
+    11771.1134, 2703.3405714285723, 4.3937142857142835,
+    48166.335433333334, 4629.375, 9.321666666666667,
+    12398.576575000001, 2660.63875, 4.66,
+    46980.19901333334, 4206.147333333333, 10.253333333333332,
+    215451.5592875, 4376.907499999999, 46.61,
+    1379442.82708, 4781.136, 289.91999999999996,
+    92647.31025000001, 5086.827222222221, 17.867222222222225,
+    7256.00212, 3572.65, 2.7960000000000003,
+    543195.3413600001, 4809.067, 111.867,
+    960769.684975, 4785.75375, 202.17625,
+    667865.3854, 5312.371666666667, 125.84833333333336,
+    811221.6448, 5242.455714285715, 154.48428571428573,
+    1011420.7431000002, 5293.65, 191.10600000000002,
+    1195055.09284, 5045.4839999999995, 238.648,
+    1841960.28105, 4826.261666666666, 385.3166666666666,
+    4679.506211764706, 1317.9652941176473, 3.563529411764705,
+    2934.812927272727, 1869.9372727272728, 1.6945454545454546,
+    7684.16292, 2465.5080000000003, 1.864,
+    25209.88485714286, 2386.8378571428575, 8.654999999999998,
+    9901.169311111113, 1460.2844444444445, 7.248888888888889,
+    527118.93036, 2999.088, 110.93199999999999,
+    44150.41779473685, 4172.290000000001, 10.138596491228078,
+    56442.735499999995, 4691.3910000000005, 12.116,
+    123522.61081086953, 4500.650652173912, 26.851304347826083,
+    274887.25157, 4634.766999999999, 59.197,
+    537711.0794428571, 4641.331428571428, 115.86000000000001,
+    493360.24831999996, 4692.918, 103.478,
+    43422.46043297871, 4915.714893617021, 8.775638297872343,
+    37189.30046585367, 5045.117804878049, 7.445365853658542,
+    750112.6526333332, 5264.55, 142.165,
+    150882.83345714284, 4960.097142857143, 30.631428571428568,
+    103007.52807540982, 5058.44836065574, 20.400491803278694,
+    267318.3927555556, 5063.763333333332, 51.791111111111114,
+    297356.3859089286, 5021.2589285714275, 59.51267857142856,
+    900339.7156384616, 5177.161538461539, 173.89615384615385,
+    316189.9294234568, 5063.914691358029, 61.91802469135804,
+    1169512.5338409094, 4951.368636363636, 237.5040909090909,
+    754800.463836889, 5077.655955555554, 148.42986666666673,
+    1218048.1590560002, 5105.677999999999, 239.5816,
+    2159009.8488714285, 4771.28, 452.7928571428571,
+    1757612.5706, 5040.446666666667, 351.91499999999996,
+    1934986.8249, 4963.98, 394.328,
+    26.78533783783781, 1.4266216216216225, 17.50675675675677,
+    35.6643, 1.53, 23.31,
+    34.18576, 1.834, 18.64,
+    32.602114285714286, 1.5299999999999998, 21.30857142857143,
+    32.80626, 1.53, 21.442,
+    35.6643, 1.5299999999999998, 23.31,
+    6017.8370995555515, 1296.3649555555548, 4.287244444444462,
+    7196.826964015154, 1390.0698106060595, 4.6424242424242435,
+    3216.6298347826087, 1318.8147826086952, 2.4313043478260865,
+    21665.540531034487, 2473.264827586207, 7.552758620689652,
+    9913.2558625, 2352.303125, 4.174583333333331,
+    11770.913685714288, 3094.5842857142857, 3.994285714285714,
+    8904.63556, 4572.954, 1.864,
+    8868.066542857143, 3147.0221428571426, 3.3285714285714283,
+    17870.69754545455, 1278.3045454545454, 13.98,
+    14997.243050000003, 1287.775, 11.650000000000002,
+    11907.56485714286, 1325.222142857143, 8.987142857142855,
+    16554.0908, 2435.672222222222, 6.558518518518517,
+    10173.68537142857, 2340.7799999999997, 4.160714285714284,
+    18812.120428571427, 3450.636666666667, 5.325714285714283,
+    176856.67010000002, 3881.83125, 39.03625,
+    82189.36956000002, 3753.97, 18.644,
+    36034.240985714285, 4033.8842857142854, 8.655714285714284,
+    47956.68752, 4539.682, 10.254,
+    57948.757, 4440.954285714286, 12.649999999999997,
+    26888.692628571433, 4535.148571428572, 5.991428571428572,
+    34535.11502222222, 4433.931111111112, 7.766666666666666,
+    67038.21953999999, 4666.362, 13.982,
+    42981.58324666666, 4958.690666666667, 8.389333333333333,
+    34250.151880000005, 4594.628, 7.456,
+    161975.9462, 4932.5419999999995, 30.761999999999993,
+    676769.8642142856, 4871.795714285714, 139.83428571428573,
+    30181.694942857142, 5003.271428571429, 5.991428571428571,
+    189425.31155714285, 4926.520000000001, 37.95428571428572,
+    388183.9622999999, 4755.910714285715, 82.56714285714285,
+    1141055.2919785713, 5035.1050000000005, 230.72428571428574,
+    31366.976047457618, 4798.224406779662, 6.555932203389836,
+    35145.13723142856, 4944.575142857143, 7.1238571428571555,
+    127650.2285539326, 4699.122022471911, 27.127977528089882,
+    121448.07620215826, 5120.332446043164, 23.807266187050352,
+    263988.623690411, 5027.159589041095, 53.123561643835615,
+    559393.511525, 5083.435, 108.75916666666666,
+    759965.1931153847, 5049.073846153846, 150.2315384615385,
+    1394012.97964, 5081.5019999999995, 278.73199999999997,
+    36152.35693333333, 3518.5199999999995, 9.32111111111111,
+    253106.19414285716, 4639.260357142857, 52.77071428571429,
+    284822.2911727273, 5053.419999999999, 54.66181818181818,
+    461144.9750764705, 5293.490588235294, 86.64176470588234,
+    1204252.3555, 4912.089, 245.17299999999994,
+    203714.83664000002, 4178.114, 44.746000000000016,
+    456910.00238222216, 4822.310666666666, 95.08733333333336,
+    381558.8355272727, 5231.158181818181, 72.88181818181819,
+    675338.8667627907, 5205.192790697675, 129.5355813953488,
+    1299857.917466666, 4820.729375, 271.21791666666667,
+    1137947.334232039, 5200.473300970873, 218.03067961165047,
+    1869806.0670933335, 4882.377333333334, 383.45266666666674,
+    2136978.89378, 4812.728000000001, 444.204,
+    26.142600000000005, 1.4024999999999999, 17.086666666666662,
+    25.365928846153828, 1.3534615384615392, 16.579038461538453,
+    35.61478, 1.834, 19.574,
+    30.560657142857146, 1.5299999999999998, 19.974285714285713,
+    33.62284285714286, 1.5299999999999998, 21.975714285714282,
+    34.47345, 1.53, 22.531666666666666,
+    345.8576139534884, 1275.0062790697673, 0.2709302325581395,
+    3557.59778, 1276.864, 2.7960000000000003,
+    5017.94625, 1219.9827777777773, 4.530555555555554,
+    6114.385399082563, 1271.634587155965, 4.809678899082559,
+    1247.663222222222, 1393.8419999999999, 0.9319999999999999,
+    5923.105546153847, 1322.1000769230777, 4.480769230769236,
+    17136.80537, 1825.3970000000002, 6.524999999999999,
+    5221.640675, 1345.455, 3.8833333333333315,
+    2357.7386500000002, 1381.3528125, 1.7474999999999996,
+    3922.452205882353, 1503.2682352941179, 2.741176470588234,
+    4406.090580000001, 1484.738, 2.7960000000000003,
+    97176.0676, 2628.77875, 20.391249999999996,
+    4851.848147826087, 4362.2917391304345, 1.0130434782608695,
+    43757.91650625001, 5034.244374999999, 8.44875,
+    77543.73578947368, 3568.8584210526315, 17.662105263157905,
+    956444.2533, 5097.07, 190.17199999999997,
+    11787.491460526311, 1273.277236842106, 9.258684210526326,
+    15987.719577777778, 1286.12, 12.42666666666667,
+    11994.025513043476, 1315.3639130434788, 9.117391304347821,
+    11345.954416666667, 1333.4358333333337, 8.543333333333331,
+    17854.308466666665, 1277.1322222222223, 13.980000000000002,
+    17854.78068, 1277.1660000000002, 13.98,
+    17913.753562500002, 1281.384375, 13.979999999999997,
+    165397.87329999998, 1794.11, 40.2,
+    11438.539429268292, 2194.675609756098, 5.569268292682923,
+    43747.43936578947, 3008.844473684211, 11.161052631578961,
+    960184.4040571429, 4691.6957142857145, 204.42285714285717,
+    483512.77654999995, 4809.371000000001, 99.74899999999998,
+    67399.59880140846, 3379.7664788732395, 15.492394366197175,
+    69204.0202140496, 4787.768884297521, 14.03979338842975,
+    266388.7284535408, 4917.629830028328, 53.37133144475918,
+    490666.32182456134, 5109.971052631579, 96.00228070175433,
+    812241.12075, 4818.9487500000005, 168.96624999999997,
+    1412222.7388542856, 4812.882285714285, 294.58142857142855,
+    1447503.7624166664, 4899.266666666666, 299.47333333333336,
+    1958987.2134000005, 4706.195, 416.39166666666665,
+    947383.9671096151, 5085.557692307693, 185.6375,
+    1436417.2311200001, 5017.397999999999, 288.986,
+    1059112.53174, 5150.733600000001, 206.76640000000003,
+    1270297.8742833333, 5199.557777777777, 244.4486111111111,
+    1955042.3122500002, 4794.466666666666, 407.84666666666664,
+    2187180.917775, 4715.9275, 463.78000000000003,
+    2080370.7822, 4710.624, 441.8720000000001,
+    1903421.5246571426, 5110.762857142858, 373.55428571428575,
+    27.925474999999967, 1.487500000000001, 18.251944444444455,
+    31.377240000000008, 1.5299999999999998, 20.508,
+    27.810810000000004, 1.3769999999999998, 18.177,
+    41.5695, 1.7833333333333332, 23.31,
+    4972.526228571429, 1067.0657142857144, 3.994285714285714,
+    5804.115683870966, 1245.5183870967737, 4.6599999999999975,
+    5820.2545666666665, 1248.9816666666668, 4.66,
+    574.9723951219512, 1270.381341463414, 0.45463414634146343,
+    588.7188451612902, 1296.723870967742, 0.4509677419354839,
+    8703.121109939148, 1290.3400811359027, 6.748965517241375,
+    22012.061783333334, 1875.506666666667, 6.991666666666667,
+    12465.172349407112, 1806.8103952569156, 4.936561264822138,
+    29187.894514999993, 3307.1200000000003, 7.340250000000003,
+    9656.608745454547, 3140.887272727273, 3.389090909090909,
+    21181.03142857143, 4543.432142857143, 4.659999999999999,
+    107222.78148, 4920.636, 20.51,
+    9314.314800000002, 4826.924, 1.864,
+    3232.0495142857144, 4872.887142857143, 0.6657142857142857,
+    46428.915700000005, 5238.858333333334, 8.545,
+    22103.70344, 4743.284, 4.66,
+    587884.7635666666, 4766.483333333334, 124.29666666666667,
+    135102.36432, 5129.73, 26.1,
+    93361.28368000001, 4870.575999999999, 19.576,
+    62839.4427, 4037.175789473684, 14.350000000000005,
+    137592.96414000003, 4482.624923076923, 29.75892307692307,
+    81624.70568317754, 4892.506261682244, 16.55261682242992,
+    227659.61891818183, 4555.860909090909, 47.46000000000001,
+    28896.29795384615, 5040.620000000001, 5.735384615384616,
+    28842.537428571428, 5101.278571428571, 5.6585714285714275,
+    130711.92304875003, 5154.036875, 25.343750000000004,
+    295559.5059782609, 5098.034347826086, 57.08072463768116,
+    56324.15830000001, 3211.0142857142855, 15.978571428571428,
+    144897.0809428571, 4823.064285714286, 28.63214285714286,
+    86753.9229984127, 4830.004603174603, 18.051587301587315,
+    118735.68525750001, 5142.514249999999, 23.304500000000004,
+    440699.93284038466, 4972.909038461537, 89.00884615384614,
+    685974.1241819673, 5061.650655737705, 135.32475409836064,
+    1166863.7380000001, 5054.4383333333335, 233.0566666666667,
+    1289232.1487, 4880.734285714286, 265.68285714285713,
+    711556.9398800001, 4709.402, 151.952,
+    611389.7060199999, 5195.054000000001, 117.92699999999999,
+    1341479.641642857, 4712.4114285714295, 283.66142857142853,
+    913440.6990222224, 5142.721555555554, 177.12155555555552,
+    1151448.30484375, 5165.02625, 224.60624999999996,
+    1497291.9667599997, 5152.168000000001, 295.04599999999994,
+    963681.1569055556, 5058.5905555555555, 191.36444444444447,
+    1064798.5431846152, 5112.238461538462, 208.31461538461537,
+    1366715.87035, 5092.644000000002, 268.01099999999997,
+    1648478.034066667, 4863.484814814815, 340.4329629629629,
+    1867785.9036421054, 4768.572105263158, 392.5136842105263,
+    1379676.5599, 5152.625, 268.0133333333333,
+    1544665.6277818182, 5163.170909090909, 300.8518181818182,
+    26.710312676056308, 1.4005633802816908, 17.19690140845071,
+    29.3199, 1.3599999999999999, 19.163333333333334,
+    32.4887, 1.5299999999999998, 21.234444444444446,
+    34.23528, 1.5299999999999998, 22.376,
+    2931.4895, 1047.013333333333, 5.436666666666667,
+    3654.8554750000003, 1097.7575, 5.2425,
+    4650.046240000001, 1249.0859999999998, 3.728,
+    5814.45072413793, 1247.7362068965517, 4.6599999999999975,
+    217.5848925925926, 1263.2848148148148, 0.1725925925925926,
+    6367.1131381579, 1266.2580921052645, 5.028026315789468,
+    7454.143988571429, 1273.3317142857143, 5.858285714285711,
+    12024.228064516126, 1269.3029032258062, 9.470322580645158,
+    501.0633933333334, 1289.4269999999997, 0.38833333333333336,
+    6821.740714285714, 1282.1238095238095, 5.325714285714285,
+    17114.927625, 1277.4718750000002, 13.397499999999997,
+    13665.615298113207, 1284.7011320754725, 10.6388679245283,
+    5135.655161538462, 1302.0303846153834, 3.9430769230769247,
+    7167.309960869564, 1309.9078260869567, 5.470434782608703,
+    8221.973997163119, 1382.3409219858152, 5.254964539007097,
+    17933.475564285713, 1616.6275, 6.990714285714285,
+    12126.015226865673, 2400.9648507462693, 4.555820895522389,
+    25569.773973333333, 4442.816333333333, 5.126666666666666,
+    43602.163733333335, 3253.234074074074, 10.529629629629634,
+    346201.33006666665, 4802.094666666667, 73.02333333333334,
+    49877.04880000001, 4496.845, 10.875,
+    25649.60861428572, 4073.02, 6.657142857142857,
+    77244.062128, 4583.8816, 16.592000000000002,
+    33695.507028571425, 4255.188571428572, 7.324285714285712,
+    573676.8427, 4746.860000000001, 121.8542857142857,
+    35941.61023333333, 4846.404583333335, 7.281770833333337,
+    44042.40158620689, 5115.969137931037, 8.597931034482764,
+    61302.088449999996, 5028.0830000000005, 12.350499999999997,
+    241859.1683882353, 5057.459411764706, 48.52941176470588,
+    59625.0177, 4152.403103448277, 13.500689655172414,
+    101992.74763599997, 4639.9272, 22.000800000000005,
+    92445.27488454546, 5098.928545454547, 18.17745454545456,
+    50428.32787272728, 4841.13, 10.169090909090908,
+    209599.11606862742, 4633.519215686275, 44.05176470588235,
+    488056.78281666676, 4774.1146666666655, 102.07733333333333,
+    178843.74267142857, 5086.5599999999995, 33.958571428571425,
+    332169.52820000006, 5153.183870967742, 64.65462365591398,
+    997452.0721714285, 4666.185714285714, 213.74428571428572,
+    530165.4776600001, 4855.614, 108.138,
+    611423.7527714287, 5283.4457142857145, 115.19714285714285,
+    773771.7768785714, 5219.345714285714, 148.48999999999998,
+    1343033.2135833334, 4820.920000000001, 278.1116666666667,
+    899617.2051727272, 5076.591818181819, 177.9709090909091,
+    1078125.2168538463, 5206.865384615385, 207.59846153846152,
+    883801.1082853659, 5110.653780487805, 171.6087804878049,
+    1029373.5226852938, 5103.358529411766, 203.51235294117646,
+    1484289.8808296295, 4931.883333333332, 304.007037037037,
+    858632.3827099998, 5237.179999999999, 164.07,
+    1784873.8280333334, 4808.2, 371.3333333333333,
+    2052911.6693999998, 4912.392, 418.566,
+    2185156.729522222, 4693.561111111111, 465.59000000000015,
+    2074056.40478, 4943.375, 420.429,
+    27.18952799999997, 1.4280000000000008, 17.770933333333343,
+    29.412337500000003, 1.5299999999999998, 19.223750000000003,
+    29.313100000000002, 1.5299999999999998, 19.15888888888889,
+    32.091750000000005, 1.5300000000000002, 20.974999999999994,
+    501.9286, 1259.3328571428576, 0.39942857142857147,
+    5523.883366292139, 1255.9849438202243, 4.398202247191017,
+    3882.5756000000006, 830.96, 11.393333333333333,
+    4079.1883538461543, 1262.0915384615387, 3.226153846153846,
+    5133.531783838381, 1268.2245454545446, 4.048080808080814,
+    809.2669351351352, 1288.9805405405405, 0.6297297297297297,
+    10744.494218181815, 1268.490909090909, 8.472727272727267,
+    5732.254816000001, 1282.1732, 4.473599999999998,
+    31373.96427272727, 1676.6563636363637, 7.203636363636363,
+    6065.238533333334, 1301.5533333333333, 4.66,
+    27139.2439, 1798.3614285714289, 8.655714285714284,
+    0.0, 1304.9471428571428, 0.0,
+    6097.302364227643, 1308.4339837398377, 4.660000000000006,
+    5571.80822, 1329.061, 4.194,
+    10588.631230769231, 2370.3869230769233, 3.9430769230769225,
+    1947.2994416666663, 1344.692708333333, 1.4562499999999996,
+    5593.341414285714, 1584.3585714285714, 3.3285714285714283,
+    5228.723017054264, 1799.9596899224816, 2.7815503875969023,
+    31660.77721904762, 2337.4909523809524, 8.433333333333332,
+    4675.648279999999, 4752.748, 0.932,
+    1098.8590666666666, 4211.438333333334, 0.7766666666666667,
+    15045.51722352941, 4824.03411764706, 3.0152941176470582,
+    2919.614266666667, 3066.2400000000002, 0.7766666666666667,
+    6295.837079999999, 1364.7740000000001, 4.66,
+    11335.465533333334, 2005.3233333333333, 6.213333333333334,
+    11970.05716410256, 1334.5832478632476, 9.081025641025658,
+    15247.973636734701, 2139.6183673469395, 8.464081632653066,
+    37158.91946444444, 4370.336666666666, 8.182000000000002,
+    109052.34262941178, 4595.633137254901, 23.57921568627451,
+    107549.11853333331, 4159.543333333333, 22.526666666666667,
+    70456.42124636365, 4835.261636363638, 14.533090909090923,
+    92884.84050958902, 5143.050410958905, 18.00493150684931,
+    14417.930731034483, 2178.8565517241377, 7.552413793103446,
+    233320.15535500002, 4076.6174999999994, 49.872499999999995,
+    535058.5012375, 4797.2, 110.70125,
+    143150.7973090909, 4886.641818181818, 29.660000000000004,
+    98625.01497777778, 4806.692, 20.56000000000001,
+    278515.40335000004, 4818.279375, 57.97312499999999,
+    137171.96682166672, 5152.294500000001, 26.723000000000006,
+    309413.94316428574, 5075.987142857143, 60.59499999999999,
+    146016.50576666667, 4414.428888888889, 30.03777777777778,
+    521305.2999, 5248.97125, 100.79749999999999,
+    361418.21448888886, 4967.4400000000005, 72.67888888888889,
+    963880.8472399998, 5007.174, 192.97100000000003,
+    748189.7356666665, 5014.346666666667, 150.39733333333334,
+    406912.90340449446, 5042.15179775281, 80.75764044943821,
+    924093.5184086206, 4995.0532758620675, 185.27887931034476,
+    1072971.1117214286, 5342.535, 201.53738095238094,
+    1240616.3345636365, 5158.0363636363645, 240.6836363636363,
+    1934281.8564000002, 4750.520416666665, 407.84625,
+    1672384.9891772727, 4952.755454545453, 339.2004545454545,
+    27.68309999999997, 1.4175000000000009, 18.093529411764706,
+    33.395684210526326, 1.5294736842105265, 20.60842105263158,
+    5572.649816000001, 1195.6639999999998, 5.219199999999998,
+    5845.457399999999, 1254.39, 4.66,
+    3936.947008275863, 1263.031931034483, 3.117379310344834,
+    9940.943811224492, 1273.9930612244905, 7.798367346938785,
+    4894.0609414966, 1417.8782312925157, 2.377687074829935,
+    8066.675047540982, 1322.1794262295075, 6.111475409836081,
+    1598.85066, 1616.453, 0.932,
+    3909.5594250000004, 1340.335, 2.9124999999999996,
+    100549.77220000002, 2086.692, 25.168,
+    6623.0899575757585, 1918.3133333333335, 3.3890909090909074,
+    11794.498931645569, 2571.7921518987346, 4.601012658227853,
+    70532.53425555554, 3434.2355555555555, 16.05333333333333,
+    12796.2668, 2840.4377777777777, 4.40111111111111,
+    24251.714500000002, 3763.227777777778, 4.661111111111111,
+    22317.80391764706, 4684.602941176471, 4.386470588235294,
+    0.0, 2763.1279999999997, 0.0,
+    24073.81164, 5113.552000000001, 4.66,
+    29037.223319999997, 5090.356, 5.593999999999999,
+    54931.964428571424, 4948.324285714285, 10.652857142857142,
+    15398.19644, 3304.3340000000003, 4.66,
+    14447.184971428574, 3100.2542857142857, 4.660000000000001,
+    9510.368766666666, 1594.6783333333335, 6.213333333333334,
+    15022.133274999998, 1291.2087499999998, 11.65,
+    109203.23075555556, 3018.7566666666667, 27.44666666666666,
+    272033.72495999996, 4029.303000000001, 58.730000000000004,
+    55940.66494, 4629.424, 12.118,
+    290622.30068, 4844.322, 61.524,
+    79341.9465685185, 4421.791018518518, 17.348703703703713,
+    175428.72273125002, 4799.86875, 35.83125,
+    94496.09928, 4477.35, 19.948800000000002,
+    137512.19829454544, 4869.810999999998, 27.96563636363635,
+    9681.31776, 3655.068, 2.7960000000000003,
+    106301.71684615384, 4926.074871794872, 20.675384615384615,
+    82382.14280000005, 5102.877692307697, 16.198811188811202,
+    217387.28425142865, 5134.397714285714, 42.35028571428571,
+    293412.8203, 5040.1410000000005, 58.263999999999996,
+    521973.4805375001, 5039.110000000001, 101.37875000000003,
+    369716.53154999996, 5018.06, 73.02166666666666,
+    767234.0022, 5196.276, 145.424,
+    271932.9404588236, 4789.466470588235, 54.56117647058824,
+    856668.7452416667, 4868.9974999999995, 174.01333333333335,
+    699372.61352, 5204.21, 134.24,
+    931594.2566933334, 5130.139999999999, 183.026,
+    574375.1679909091, 5063.825454545454, 113.13818181818182,
+    985609.1930600001, 5072.548666666667, 194.52399999999994,
+    342115.50741842104, 4846.12947368421, 69.3036842105263,
+    512981.1898666667, 5037.833030303032, 102.6863636363636,
+    1253084.10684, 4905.830000000001, 257.29200000000003,
+    753463.4435753843, 5089.297692307691, 147.64907692307685,
+    688809.2098600001, 5072.039000000001, 135.17199999999997,
+    1457664.4407495577, 5042.087256637167, 291.79283185840706,
+    28.095217647058792, 1.484705882352942, 17.81823529411765,
+    22.815360000000002, 1.224, 14.912,
+    31.76697272727273, 1.5299999999999998, 20.762727272727265,
+    32.9848875, 1.5299999999999998, 21.558749999999996,
+    28.529399999999995, 1.2750000000000001, 18.64666666666667,
+    34.36519090909091, 1.5299999999999998, 22.46090909090909,
+    5817.269577777778, 1251.8140996168595, 4.749272030651347,
+    7569.30304583333, 1397.8560416666662, 5.242499999999997,
+    6263.70920900474, 1347.6159478672973, 4.726279620853094,
+    11255.942387368423, 1696.5175789473678, 6.524105263157898,
+    8804.178775, 1500.115, 5.824999999999999,
+    9630.933017647058, 2185.1879411764708, 4.385882352941174,
+    11829.94124, 2538.6140000000005, 4.659999999999999,
+    12877.683012903226, 2763.45129032258, 4.6599999999999975,
+    619726.70215, 4593.0625, 131.675,
+    73615.06173333335, 3987.8416666666667, 16.313333333333333,
+    13968.61096, 2997.556, 4.66,
+    85761.42253333333, 3485.1933333333327, 17.866666666666664,
+    127016.31183333334, 4081.705, 27.965,
+    529962.6206571428, 4981.685714285714, 104.53999999999999,
+    11464.430327272728, 3747.3636363636365, 2.965454545454546,
+    26641.785857142855, 4425.04, 5.991428571428571,
+    177241.38395000002, 4856.276666666666, 34.181666666666665,
+    17691.93076666667, 4552.046666666667, 3.8833333333333333,
+    102123.76458333334, 4461.996666666667, 22.528333333333332,
+    44427.14642222222, 4512.956666666667, 9.838888888888887,
+    588844.3394333333, 4636.751666666667, 125.85000000000001,
+    46069.908301992014, 4799.142988047811, 9.48820717131475,
+    885839.6441, 5147.54, 172.46166666666667,
+    256101.09886335622, 4920.686986301372, 51.14448630136981,
+    647240.3802170731, 5052.600487804877, 127.78243902439027,
+    307339.1415421053, 4507.369122807018, 61.82052631578946,
+    518696.9219894737, 5266.21105263158, 97.63631578947368,
+    721967.6539108106, 5010.394864864866, 144.49459459459456,
+    937615.8627500001, 5202.80125, 182.365,
+    444621.37394, 4852.258, 89.494,
+    795487.7462888887, 4879.087777777778, 164.17333333333332,
+    1040237.5394913042, 5171.073478260871, 201.23826086956515,
+    1259198.1793106387, 5082.125531914895, 249.41872340425525,
+    1942486.61665, 4932.46375, 397.36000000000007,
+    1636602.62063, 5137.362000000001, 322.082,
+    1590216.7972000001, 4884.363529411765, 327.9223529411764,
+    1407955.2438714285, 5162.546428571428, 273.34071428571434,
+    2088573.7132285717, 4709.575714285714, 443.47142857142853,
+    2155121.2748800004, 5242.37, 411.10999999999996,
+    2257184.829316667, 4725.2733333333335, 477.76500000000004,
+    26.76528771929822, 1.422456140350878, 17.16877192982455,
+    28.5192, 1.53, 18.64,
+    30.305475000000005, 1.53, 19.807499999999994,
+    30.900899999999996, 1.53, 20.19666666666667,
+    28.519200000000005, 1.5299999999999998, 18.64,
+    31.581385714285712, 1.5299999999999998, 20.641428571428573,
+    5802.468900000001, 1245.1650000000002, 4.66,
+    5803.657200000001, 1245.42, 4.659999999999999,
+    2917.284150000001, 622.9650000000001, 13.985,
+    371200.2659857143, 2369.3985714285714, 78.57142857142857,
+    714.576516, 1278.3123, 0.5591999999999999,
+    5824.52715793651, 1281.7801984126995, 4.549047619047618,
+    10856.71684568528, 1297.152944162437, 8.397461928934014,
+    8701.540333333332, 1427.0444444444445, 6.213333333333333,
+    10251.012079999999, 1274.841, 8.038499999999997,
+    5577.2511, 1416.3616666666667, 3.8833333333333333,
+    11062.5138, 1332.4180000000001, 8.388,
+    62898.02312499999, 3021.024999999999, 15.147499999999997,
+    3433.1985894736854, 1335.0692105263165, 2.5752631578947356,
+    40787.57710000001, 1526.7605555555556, 10.874999999999998,
+    9631.254929032257, 1345.4658064516132, 7.215483870967739,
+    51392.54556923077, 1967.2215384615379, 13.623846153846152,
+    7079.560631372546, 1621.9268627450983, 3.9290196078431356,
+    11097.187958064516, 2407.5879032258067, 4.5848387096774195,
+    12659.2395, 2820.105666666667, 4.504666666666664,
+    17611.69035102041, 4502.566734693877, 3.5191836734693873,
+    13133.62284, 2282.9660000000003, 6.524000000000001,
+    20837.842399999998, 4471.639999999999, 4.659999999999999,
+    23281.89801818182, 4231.046363636363, 5.507272727272727,
+    48852.54488064517, 4628.530322580646, 10.223225806451616,
+    22265.161566666666, 3564.815, 6.989999999999999,
+    109168.11426499998, 4303.9532500000005, 23.654000000000003,
+    73766.802775, 4924.410099999999, 14.976733333333305,
+    312448.91356, 4954.340166666667, 62.69200000000001,
+    1080893.1224625, 5235.233749999999, 208.0025,
+    134739.04317857142, 4612.386785714286, 27.300357142857145,
+    345003.83516571415, 4947.660857142856, 69.15057142857145,
+    867313.3875342106, 5088.593223684207, 171.11177631578934,
+    1202337.2030441174, 5050.53117647059, 239.543725490196,
+    358023.08580000006, 4535.187272727272, 74.57727272727273,
+    631909.10228, 5065.628, 126.78399999999999,
+    1433053.9659250001, 5054.3725, 286.075,
+    2095701.2238333332, 4972.358888888888, 422.08888888888885,
+    30.544007142857147, 1.5292857142857146, 18.309285714285714,
+    29.53617285714283, 1.5298571428571437, 19.040142857142868,
+    25.667280000000005, 1.3769999999999998, 16.776,
+    1097.5261125, 1256.966875, 0.87375,
+    356.0480060606061, 1262.30303030303, 0.2824242424242424,
+    5514.897970000002, 1183.225, 5.358999999999998,
+    5931.24151139241, 1264.5105063291148, 4.689493670886073,
+    257.56752, 1291.1867142857136, 0.19971428571428573,
+    5448.557433333333, 1292.7173809523795, 4.216190476190481,
+    2485.0521799999997, 1335.3210000000001, 1.864,
+    893.6149142857142, 1341.686071428571, 0.6657142857142857,
+    7859.8356, 1829.214, 1.864,
+    2088.6586, 1349.9716666666668, 1.5533333333333335,
+    0.0, 1494.2, 0.0,
+    0.0, 1930.708, 0.0,
+    20002.478185714284, 4757.490357142857, 3.9946428571428574,
+    38930.087360000005, 5039.988, 7.456,
+    2290.8221090909096, 1349.2081818181819, 1.6945454545454546,
+    27499.098437500004, 3247.8637500000004, 5.82625,
+    11174.99365384615, 1272.396538461539, 8.78230769230769,
+    17574.915060000003, 1278.5400000000002, 13.746999999999996,
+    8113.548496551726, 1307.806896551725, 6.213333333333338,
+    7534.285693069304, 1337.8126732673263, 5.675049504950496,
+    33610.7688, 1956.654, 13.982,
+    16431.835700000003, 1335.4683333333332, 12.42666666666667,
+    6102.39116, 1309.526, 4.66,
+    13772.600875, 1278.0462499999999, 10.776249999999997,
+    10751.26180909091, 1509.8099999999997, 7.4136363636363605,
+    38511.69914285715, 2898.788571428571, 11.984285714285715,
+    8723.99532, 1338.218, 6.524000000000001,
+    17870.45692, 1933.7620000000002, 9.32,
+    15018.194742857144, 3222.7885714285717, 4.660000000000001,
+    7228.61023478261, 1610.0643478260874, 4.457391304347824,
+    15660.415921153846, 2465.307692307693, 5.556538461538462,
+    12188.464941666667, 2486.709166666667, 5.048333333333331,
+    47332.140055555545, 3238.2394444444435, 11.392777777777775,
+    27199.742507692303, 4477.082307692308, 6.093846153846152,
+    494042.81083333335, 4845.34, 95.55166666666666,
+    94109.42763750002, 2956.1575000000003, 23.30375,
+    37512.29818421053, 4382.509999999999, 8.339999999999998,
+    51522.54265833334, 4064.694166666668, 11.554791666666668,
+    125170.16920232556, 4468.11953488372, 26.66511627906976,
+    90595.97731543027, 4945.711483679527, 18.2148664688427,
+    398561.08726649993, 5044.63545, 78.67925000000007,
+    1271597.1922220776, 4815.739740259738, 263.866883116883,
+    1016815.7653904108, 5217.0313013698615, 194.20191780821915,
+    2066580.449214286, 4805.9457142857145, 430.15285714285716,
+    2185391.3472333336, 4693.562222222222, 465.59222222222223,
+    912.6767723076923, 1272.729384615384, 0.7169230769230769,
+    2227.9692999999997, 798.80375, 8.737499999999999,
+    28.41233181818179, 1.4604545454545463, 18.570151515151522,
+    29.713450000000005, 1.4450000000000003, 19.420555555555552,
+    5305.4890173913045, 1138.1178260869558, 5.875652173913042,
+    2491.688685714286, 1262.6457142857146, 1.997142857142857,
+    6007.4993375722615, 1267.0367630057817, 4.740809248554907,
+    2324.7754230769233, 1297.3730769230763, 1.7923076923076915,
+    433.3433857142858, 1324.3500000000001, 0.33285714285714285,
+    5971.372235087717, 1304.705789473684, 4.578245614035087,
+    5826.483165517238, 1319.7627586206906, 4.418965517241377,
+    22227.4544, 1975.8859999999997, 7.456,
+    6140.9946, 1317.81, 4.660000000000001,
+    8826.412800000002, 1345.2400000000002, 6.524000000000001,
+    5971.988826666668, 1326.7706666666666, 4.504666666666664,
+    1855.7949481481478, 1344.7414814814817, 1.3807407407407408,
+    895.1394000000001, 1355.0928571428574, 0.6657142857142857,
+    13337.294075000002, 1350.5425, 9.903749999999997,
+    2765.6767142857143, 1364.902857142857, 1.997142857142857,
+    12653.469453333333, 1873.8306666666665, 4.660666666666666,
+    743.23738, 1605.922, 0.466,
+    58209.100366666666, 4496.337222222222, 12.428888888888888,
+    91998.16368888889, 3719.8144444444447, 17.607777777777777,
+    154172.3188166667, 5117.778333333334, 29.519999999999996,
+    0.0, 5056.472857142857, 0.0,
+    11396.694604761899, 1268.1002380952382, 8.987142857142853,
+    14767.95198636364, 1279.4845454545457, 11.54409090909091,
+    12293.93549253731, 1309.5014925373132, 9.389552238805976,
+    15203.940262500004, 1307.6156250000001, 11.649999999999999,
+    11818.365800000001, 1268.0649999999998, 9.32,
+    12062.518733333332, 1294.2616666666668, 9.32,
+    13393.59958, 1308.9145, 10.251999999999999,
+    17234.59992, 1893.468, 11.184000000000001,
+    42333.31019999999, 2989.924, 12.118,
+    8599.853829268293, 1987.999024390245, 4.2053658536585345,
+    22032.635626666666, 2713.675666666667, 6.524666666666664,
+    28664.725899999994, 3352.4982954545467, 7.837727272727282,
+    177521.199175, 4489.198306451614, 38.00193548387097,
+    105112.607566756, 4992.475281501342, 20.95533512064337,
+    353293.80585047626, 5065.716, 69.56171428571427,
+    677146.8018728816, 5089.699915254236, 133.27610169491524,
+    546553.1277121212, 4900.331515151516, 109.46515151515152,
+    965850.1631318181, 4985.848181818183, 190.25863636363638,
+    1088787.5435000001, 5267.329230769231, 207.23999999999998,
+    1141593.5082299998, 5184.0675, 219.53799999999995,
+    1508494.4196454545, 4929.375454545455, 310.17454545454547,
+    1341478.51115, 4792.175, 280.05333333333334,
+    1887127.9761102567, 4766.170256410257, 396.551282051282,
+    1134805.82398, 5238.172, 216.74100000000004,
+    1532726.9506333333, 5245.154583333333, 293.0666666666666,
+    29.298871951219503, 1.5297560975609765, 18.470609756097573,
+    34.867, 1.5299999999999998, 22.78888888888889,
+    33.715636363636364, 1.5299999999999998, 22.036363636363635,
+    5803.2611, 1245.3349999999996, 4.659999999999998,
+    5810.777680000001, 1246.9479999999999, 4.66,
+    5815.509133333333, 1247.9633333333334, 4.66,
+    901.6239692307694, 1257.0453846153848, 0.716923076923077,
+    0.0, 1261.3288461538464, 0.0,
+    2927.916833333333, 1256.6166666666666, 2.33,
+    5846.731133333334, 1254.6633333333334, 4.659999999999998,
+    3894.0047333333337, 1254.3266666666666, 3.106666666666667,
+    5897.237281250001, 1265.5015624999999, 4.660000000000001,
+    7877.326133333332, 1267.81, 6.213333333333334,
+    1221.224692307692, 1290.2896153846145, 0.9558974358974356,
+    3846.439725, 1544.4718750000002, 1.45625,
+    5638.456380327867, 1273.3960655737703, 4.430819672131146,
+    6254.151870422537, 1306.2687323943658, 4.791267605633803,
+    13879.100720588236, 1272.8727941176473, 10.896176470588246,
+    12188.418820779212, 1300.5057142857145, 9.38051948051949,
+    9313.673306382982, 1395.318510638298, 6.543829787234043,
+    199010.34163, 2614.7740000000003, 46.608999999999995,
+    3483.0104857142865, 1301.2385714285713, 2.662857142857143,
+    16392.149975, 1279.1900000000003, 12.815,
+    9990.056222222223, 1982.7705555555558, 5.177777777777776,
+    169487.79556666667, 3748.728333333333, 37.288333333333334,
+    1224539.6201000002, 4723.748, 258.224,
+    1688872.96756, 4720.390000000001, 357.97400000000005,
+    2602.321338888889, 1342.465555555555, 1.9416666666666664,
+    10824.13515869565, 1540.320108695652, 4.204347826086962,
+    17420.333218181822, 1889.1385454545457, 6.0160000000000045,
+    18768.47915757576, 2512.7193939393946, 6.637575757575756,
+    40890.285626315796, 2972.215263157895, 9.811842105263166,
+    43875.63972592593, 3712.295925925926, 10.356666666666664,
+    99422.66344096385, 4465.573012048193, 21.507349397590367,
+    314121.09870937513, 4704.6225, 66.71124999999999,
+    9681.072333333334, 2077.4833333333336, 4.66,
+    8298.667800000001, 1784.798, 4.66,
+    253915.52766, 4007.632, 51.274,
+    125597.45205573771, 4597.9704918032785, 25.97967213114755,
+    459226.6164390247, 4543.05487804878, 97.54170731707318,
+    1615202.92245, 4680.4425, 344.92125,
+    47434.28134496646, 4867.871476510067, 9.665167785234916,
+    71622.15472421053, 5171.969052631578, 13.736526315789483,
+    128956.42936756759, 4990.801621621622, 25.321081081081083,
+    244154.53139032258, 5100.879838709679, 47.73903225806451,
+    267099.5677541667, 4916.437916666667, 53.796666666666674,
+    518944.6740329788, 5114.160638297872, 101.3542553191489,
+    915079.21549375, 4823.05, 190.23125,
+    852233.00340625, 5248.2065625000005, 162.41031250000006,
+    1390555.591413333, 4800.976, 290.23066666666665,
+    1741577.8946599998, 4842.796, 358.90600000000006,
+    1986069.9494000003, 4701.361666666668, 422.6066666666666,
+    950638.0669568962, 5202.201896551725, 182.02431034482754,
+    1208908.5570821427, 5181.569285714286, 232.5560714285714,
+    1469793.96854, 5170.94, 286.192,
+    1880911.6743999997, 4985.206153846155, 378.2661538461538,
+    27.109298765432083, 1.435432098765433, 17.489876543209892,
+    27.429369230769233, 1.2946153846153845, 17.927692307692308,
+    4740.110798726116, 1259.4786624203834, 3.769617834394909,
+    9756.83571735538, 1271.6845454545464, 7.66396694214876,
+    8217.346319230766, 1223.9663461538462, 7.16923076923077,
+    17036.573885714282, 2123.0157142857142, 7.655714285714284,
+    728.6717733333332, 1343.4408888888884, 0.5522962962962961,
+    5777.482623430961, 1318.3509205020923, 4.387029288702921,
+    18980.654931730758, 1366.5823076923075, 10.843846153846167,
+    11667.78469583333, 2001.7747916666665, 6.213333333333339,
+    14763.172914285713, 3074.524285714286, 4.660000000000001,
+    12502.766020000003, 2765.3636666666666, 4.504666666666664,
+    14537.871037037039, 3074.0970370370364, 4.659999999999998,
+    134488.689725, 4754.083125, 26.218125,
+    19350.003425, 2898.925, 8.7375,
+    26332.506650000003, 3728.8224999999998, 6.99,
+    58791.00596, 4704.214, 12.117999999999999,
+    38385.97111333334, 4554.9439999999995, 8.388666666666664,
+    28083.047300000006, 4489.468333333333, 6.213333333333334,
+    117202.17527142855, 4696.712857142857, 23.97,
+    522084.07805714296, 4958.464999999999, 105.8742857142857,
+    1191806.5366, 4865.30875, 247.0375,
+    1512041.9826, 4780.0275, 317.53624999999994,
+    2071676.6301000002, 5088.83, 409.246,
+    124285.37021111112, 2521.538888888889, 25.376666666666665,
+    30950.16087647059, 3768.0458823529407, 7.12764705882353,
+    42090.564664516125, 4822.610645161292, 8.419354838709678,
+    91472.30343913045, 4903.381739130436, 18.035652173913057,
+    719179.40904, 5220.086, 137.036,
+    34379.226345, 4741.605999999999, 7.22325,
+    51233.71832244896, 5005.793265306122, 10.177346938775518,
+    23779.374200000002, 5102.870000000001, 4.66,
+    44298.42552499999, 5194.470833333334, 8.544166666666666,
+    54817.37767777778, 4995.591111111111, 10.875555555555554,
+    152952.42315, 5056.7266666666665, 30.298333333333336,
+    385377.92752, 5162.088, 74.578,
+    65988.73893076924, 3619.2115384615386, 15.416923076923077,
+    119388.74378947365, 4718.686842105263, 25.512894736842103,
+    80291.43381162793, 4939.8904651162775, 16.09569767441861,
+    253307.00725121956, 5020.32536585366, 50.24951219512194,
+    91326.69181785714, 4520.048928571429, 18.810714285714287,
+    308978.63943085104, 5030.428085106383, 61.18957446808511,
+    547224.9729273582, 4994.3990566037755, 108.30471698113207,
+    968442.4581970588, 5118.150294117648, 189.46000000000004,
+    1328990.696924242, 4818.2830303030305, 276.98242424242426,
+    1839919.4291176468, 4774.293529411764, 385.5005882352941,
+    854062.45185, 4679.490000000001, 182.56000000000003,
+    1581704.6737857144, 4702.598571428571, 336.26571428571424,
+    904585.6770222223, 5125.237777777777, 176.60333333333332,
+    1123996.2019684212, 5275.6894736842105, 212.6942105263158,
+    1178429.43675, 5253.064230769231, 224.09192307692305,
+    1659780.3088279997, 5237.7300000000005, 317.7,
+    1720.1724285714283, 1290.1200000000001, 1.3314285714285714,
+    3382.427714285714, 1265.482857142857, 2.662857142857143,
+    17804.6627875, 1637.4299999999996, 5.825624999999999,
+    185366.19185714287, 4557.712857142857, 36.29,
+    33404.239166666666, 4832.365000000001, 6.989999999999999,
+    1053187.98136, 4998.168, 215.342,
+    27.847409433962284, 1.4144339622641517, 17.982452830188702,
+    4088.8244297297283, 1217.2068918918917, 3.778378378378378,
+    4874.455803351955, 1293.7806703910617, 3.7618435754190034,
+    136113.49541578945, 1987.9042105263159, 31.890526315789472,
+    3928.455662365591, 1368.2440860215056, 2.906236559139784,
+    12618.963331250001, 2282.700625, 3.640937499999999,
+    495228.27966666664, 5021.111666666667, 94.77499999999999,
+    11284.932775757572, 1268.549696969697, 8.896363636363633,
+    11803.521995121953, 1281.9395121951222, 9.206341463414631,
+    12237.837589189188, 1313.072702702703, 9.319999999999995,
+    12522.452966666666, 1593.6616666666669, 8.543333333333335,
+    14189.012832500002, 2071.7727499999996, 5.359249999999998,
+    52474.35354705883, 2991.2735294117647, 12.062941176470588,
+    12992.559705882353, 1317.6941176470589, 9.868235294117643,
+    11692.676280000001, 2332.112666666667, 5.281333333333332,
+    16409.608559090902, 1810.6721590909094, 10.114318181818186,
+    15402.25862857143, 2959.837142857142, 4.992857142857141,
+    28515.569568749997, 4092.8353125000003, 6.844374999999997,
+    124812.74046224492, 4696.867857142856, 25.873061224489785,
+    496230.11040476186, 4729.126666666667, 102.32190476190478,
+    1095438.2784055555, 4783.441666666667, 229.6883333333333,
+    1493468.99016, 4801.892, 311.36199999999997,
+    1843717.357, 4940.1720000000005, 374.28600000000006,
+    39941.18062500001, 4081.4930555555557, 9.320833333333335,
+    789939.9869818181, 4827.672727272728, 157.20545454545456,
+    58471.686170247944, 5012.3993388429735, 11.63223140495869,
+    168818.15094144145, 5082.954504504505, 33.04702702702702,
+    297136.74850000005, 5150.796, 57.79600000000001,
+    296742.90080000006, 4784.494000000001, 59.66000000000001,
+    1139615.4547285715, 5003.270000000001, 228.39142857142855,
+    797049.8403272729, 5155.817272727273, 154.6627272727273,
+    57577.534888, 3321.3076, 13.422799999999997,
+    263847.78973157896, 4902.641578947368, 53.97105263157895,
+    153640.89943414638, 4524.740243902439, 31.83146341463415,
+    170682.78835818177, 5207.015636363635, 32.6269090909091,
+    469256.1085962263, 5073.029999999998, 92.43150943396228,
+    816699.9610435484, 5129.534193548385, 159.98096774193542,
+    1805185.4226090908, 4830.862727272728, 375.0072727272727,
+    1217800.9919533336, 5190.832333333334, 235.85133333333332,
+    18789.36232, 1949.634, 7.456,
+    25151.58886666667, 4366.861666666667, 5.436666666666667,
+    163970.0863333333, 5029.508333333334, 32.626666666666665,
+    73526.47258, 5186.506, 13.982,
+    106087.92686, 4169.719999999999, 22.374000000000002,
+    351052.6745307693, 4976.048461538461, 70.99307692307693,
+    652065.6429285714, 5155.2414285714285, 125.85,
+    510864.400175, 4586.005, 102.54250000000002,
+    975426.9988764705, 4779.860000000001, 196.04117647058823,
+    1377278.6947361701, 5055.822978723405, 274.21212765957443,
+    1014508.8432166666, 5143.723333333333, 194.98833333333332,
+    1839757.705609524, 4918.235714285715, 375.1066666666667,
+    26.25965121951218, 1.380731707317074, 17.163170731707332,
+    29.818309090909096, 1.5299999999999998, 19.48909090909091,
+    1639.255656, 1256.4748000000004, 1.3048000000000002,
+    345.15797647058827, 1261.6723529411768, 0.2741176470588235,
+    29.363400000000006, 1.4400000000000002, 19.191764705882353,
+    4703.280304761905, 1248.6914285714288, 3.772380952380951,
+    5623.571500000001, 1251.6360714285715, 4.4935714285714266,
+    7992.12381632653, 1266.7908163265329, 6.308571428571429,
+    4499.832072, 1271.2456, 3.5415999999999985,
+    6558.800558620691, 1275.7893103448273, 5.14206896551724,
+    6064.151199999999, 1301.32, 4.66,
+    7671.178828571429, 1281.6185714285714, 5.991428571428571,
+    10945.881169230772, 1272.0723076923075, 8.603076923076921,
+    16548.548851851854, 1278.32, 12.944444444444446,
+    7153.480289285714, 1285.4846428571434, 5.575357142857141,
+    1952.9283333333333, 1489.3687499999999, 1.3591666666666669,
+    1158.2585333333334, 1322.6966666666665, 0.862962962962963,
+    6113.512484563756, 1312.4963758389265, 4.659999999999999,
+    12217.469003571421, 1310.8600000000004, 9.319999999999997,
+    12066.08208, 1658.426, 7.922,
+    230895.93816666666, 4150.133333333333, 48.94166666666666,
+    12480.728879999999, 1339.1340000000002, 9.32,
+    6936.556457142857, 1318.3557142857142, 5.325714285714286,
+    9078.539769999998, 1719.7805, 4.892999999999999,
+    22052.96328888889, 2736.737777777778, 7.7666666666666675,
+    837912.0293875, 4678.915, 178.86875,
+    1321791.4831, 4773.7325, 277.335,
+    1726.825668965517, 1338.5755172413792, 1.2855172413793103,
+    5857.522361904762, 1325.6599999999996, 4.4380952380952365,
+    3684.9791388888893, 1436.5844444444444, 2.5888888888888877,
+    5538.320384615386, 1915.3284615384614, 2.1507692307692308,
+    7036.8330000000005, 1301.6576923076923, 5.376923076923077,
+    9845.841460606061, 2155.4839393939396, 4.518787878787876,
+    6993.100270588235, 1344.7182352941181, 5.208235294117645,
+    13803.113730769233, 1721.376153846154, 5.7361538461538455,
+    11714.428611764706, 2513.825882352941, 4.6599999999999975,
+    13207.056553846154, 2834.1323076923077, 4.659999999999998,
+    13214.713618181819, 2835.775454545455, 4.659999999999999,
+    15144.534, 3249.9, 4.66,
+    33630.90679999999, 3653.5221212121214, 7.626666666666664,
+    37810.7274, 4517.195555555556, 8.284444444444444,
+    6879.0454, 4968.6355, 1.3980000000000001,
+    19381.994325, 4692.8425, 4.077500000000001,
+    842366.8977777777, 4674.91, 178.15666666666667,
+    239637.28351111116, 4779.541111111112, 49.19888888888889,
+    79604.92345986624, 4912.314247491636, 16.22725752508357,
+    247539.87689866676, 4970.380733333334, 49.71846666666667,
+    302090.37894406787, 4995.343389830509, 60.35745762711861,
+    461800.25457499997, 5175.139999999999, 88.95,
+    752135.57825, 5054.56375, 149.73625,
+    1159421.4308941176, 5066.168823529411, 231.41000000000005,
+    369113.1392575758, 4541.338484848484, 78.8148484848485,
+    556724.2573155172, 5123.23206896552, 108.09,
+    1641392.00372, 4948.106, 332.8,
+    1778479.25398, 4911.782000000001, 361.702,
+    909934.666122549, 5095.27117647059, 178.81225490196076,
+    1300354.2745692309, 5128.205, 254.9265384615384,
+    1512413.976622222, 5030.524444444444, 301.93555555555554,
+    1971784.8453968747, 4848.8528125, 407.5543749999999,
+    35.614779999999996, 1.834, 19.574,
+    25.98225254237286, 1.3744067796610178, 16.98186440677965,
+    28.519200000000005, 1.5299999999999998, 18.640000000000004,
+    31.6948, 1.5299999999999998, 20.715555555555554,
+    31.1986125, 1.5299999999999998, 20.39125,
+    34.23528, 1.53, 22.375999999999998,
+    39.20742, 1.6819999999999997, 23.31,
+    3673.5220111111103, 1304.8605555555557, 2.847777777777777,
+    13564.112475, 1295.0249999999999, 10.485000000000001,
+    5587.334174999999, 1350.6066666666668, 4.271666666666666,
+    101805.13886129032, 2348.7541935483873, 23.003870967741918,
+    3139.523603686638, 1261.0008755760368, 2.576958525345626,
+    10129.839298285715, 1282.104571428571, 7.908685714285723,
+    9495.569990532544, 1357.1018343195267, 5.735502958579882,
+    18232.52397466666, 1721.5911999999998, 5.716933333333339,
+    7688.901452459015, 1273.2699999999998, 6.03508196721312,
+    6871.250344827587, 1434.572068965517, 4.820689655172413,
+    6406.535105882352, 1299.019411764706, 4.934117647058823,
+    63520.49248000001, 2099.512666666667, 18.331999999999997,
+    8751.163610526315, 1461.4257894736843, 6.1315789473684195,
+    11244.918909090908, 2413.0727272727277, 4.6599999999999975,
+    13712.5626, 2621.7588888888886, 5.695555555555554,
+    259650.76238750003, 4091.1150000000007, 56.51624999999999,
+    18446.967115, 4522.512000000001, 3.7284999999999995,
+    0.0, 4259.515, 0.0,
+    46817.62589000001, 3466.6505000000006, 11.185750000000013,
+    21121.57955789474, 2671.2621052631584, 6.37736842105263,
+    36384.03716153846, 4717.642307692308, 7.528461538461537,
+    19978.5384, 4287.24, 4.660000000000001,
+    31739.274830434795, 4757.126739130435, 6.686521739130437,
+    27740.464811111116, 4943.189444444444, 5.695555555555554,
+    171609.033172, 4561.232933333332, 36.29373333333334,
+    285134.12527222227, 4737.950833333332, 59.94583333333334,
+    85102.1989031579, 5049.217736842108, 16.90173684210526,
+    418686.41764418606, 5148.189302325581, 80.973488372093,
+    182217.773334375, 4927.36, 36.85125,
+    98019.06407142857, 3791.4271428571437, 20.642857142857142,
+    486326.4714444444, 5052.621888888887, 96.27799999999999,
+    943120.6313972409, 4998.579379310346, 187.34365517241397,
+    456150.05230754724, 5037.954339622642, 90.67169811320753,
+    994899.4994125001, 5095.20125, 195.1825,
+    1088476.2617, 4895.911, 223.73199999999997,
+    922024.2742644446, 5058.031777777776, 182.92333333333332,
+    1119486.103136364, 5159.423636363636, 217.37727272727273,
+    1734688.55316, 5088.8279999999995, 343.058,
+    868770.8851, 5277.165999999999, 165.002,
+    137544.87486666665, 4282.406666666667, 27.964999999999993,
+    742164.5081583333, 5247.634166666667, 140.99833333333336,
+    950555.4810299998, 5100.885, 186.44299999999998,
+    1335841.3179857142, 5064.104285714287, 264.35,
+    1539303.1104599999, 4973.442, 310.428,
+    1983608.7749499998, 4773.350833333333, 416.3925000000001,
+    1953888.83158, 5276.558, 371.024,
+    28.060200000000012, 1.4806451612903233, 18.340000000000032,
+    4321.092176923078, 1325.9038461538462, 1.254807692307692,
+    3559.351392592592, 785.256666666666, 9.925925925925931,
+    8916.711483663368, 1286.0878217821814, 6.297970297029708,
+    6516.161222976502, 1325.7751436031328, 4.903342036553541,
+    49248.47300862066, 1655.8782758620687, 14.38379310344828,
+    5006.506264864865, 1327.3032432432433, 3.778378378378377,
+    43645.41392195122, 1857.932926829268, 14.322682926829271,
+    9268.986238636366, 2185.7660227272727, 4.024545454545459,
+    58746.341324999994, 2892.7243749999993, 14.273749999999998,
+    5445.210000000001, 3177.964, 1.864,
+    92235.16183636364, 4857.780909090909, 17.797272727272727,
+    15945.208845454548, 3135.3377272727275, 5.083636363636362,
+    58850.32173333333, 4123.4220000000005, 13.359999999999996,
+    23035.829038095235, 4518.285714285715, 5.103809523809521,
+    150809.56725833332, 4588.673333333333, 32.2375,
+    7811.697799999999, 1736.1099999999997, 5.436666666666667,
+    5879.537533333333, 2014.1450000000002, 3.106666666666667,
+    273129.01372000005, 2083.336, 55.932000000000016,
+    70384.26087999999, 4413.3099999999995, 14.916,
+    102318.80947142858, 3802.982857142858, 22.638571428571424,
+    109528.45829565216, 4736.157826086956, 21.07478260869566,
+    23359.572275, 3741.3199999999997, 5.825,
+    57707.036093548406, 4569.301612903226, 12.17741935483872,
+    47369.76792000001, 5022.055249999999, 9.320500000000003,
+    28758.152289743583, 4741.202051282052, 6.094102564102561,
+    43960.32195714287, 4974.05380952381, 8.80285714285715,
+    180634.96261249998, 5122.863125, 37.287499999999994,
+    55896.203349999996, 5198.270937500001, 10.777187500000002,
+    566235.44709, 4746.1849999999995, 118.39200000000002,
+    252232.6278903846, 4702.263846153846, 53.244423076923084,
+    77456.62557272728, 3453.7681818181813, 19.067272727272726,
+    86983.9944, 4641.027999999999, 18.644,
+    121583.3310857143, 4947.780714285714, 24.635714285714293,
+    38054.9537, 4884.002999999999, 7.457999999999998,
+    177278.3330530121, 5127.21204819277, 34.481686746987954,
+    303402.9470148148, 5091.518148148149, 59.38481481481481,
+    183709.7481875, 3922.84875, 40.20125,
+    493392.9205022223, 4863.281777777777, 102.23355555555554,
+    1255217.7060428571, 4853.262857142858, 260.3542857142857,
+    782728.7723266667, 4945.766666666666, 158.47666666666663,
+    153316.6898857143, 3965.4185714285713, 31.961428571428574,
+    182457.0904666667, 4754.781666666667, 38.065,
+    395309.6067071428, 5147.029761904762, 76.4645238095238,
+    604358.3802689656, 5203.729310344827, 116.0451724137931,
+    666025.1776999999, 5130.1671428571435, 129.18,
+    1022438.1365625, 4963.179999999999, 206.2525,
+    1007460.111322222, 5245.217777777778, 191.10555555555555,
+    1067435.8524, 4820.818, 220.936,
+    859571.515668, 5152.6248, 166.86720000000003,
+    1468635.8933799998, 4908.728, 295.514,
+    1058886.4777499998, 5261.560625, 201.01187499999997,
+    502243.67981538456, 4957.733846153846, 100.75153846153846,
+    909315.2421208331, 5105.056666666666, 177.51125,
+    1040773.2883115388, 5063.163461538462, 207.23961538461543,
+    1230458.1267538464, 5264.042307692309, 235.5661538461538,
+    1515797.798730303, 4821.66, 315.8239393939393,
+    2004502.4232750004, 4765.211666666666, 421.24749999999995,
+    1108587.40855, 5145.248333333333, 212.8566666666667,
+    1653577.4418687497, 5315.075625, 311.419375,
+    28.195225555555552, 1.4955555555555562, 17.39811111111113,
+    31.64518125, 1.5300000000000002, 20.683124999999997,
+    5802.36087272727, 1245.1418181818176, 4.6599999999999975,
+    5947.34364, 1276.254, 4.66,
+    5807.222100000002, 1246.185, 4.66,
+    5809.351720000001, 1246.642, 4.66,
+    5907.491320000001, 1267.7020000000002, 4.66,
+    6973.551191489353, 1274.9323404255317, 5.465585106382993,
+    13856.35141701031, 1359.569123711341, 6.317783505154646,
+    3099.3705096774192, 1367.0787096774195, 2.2548387096774185,
+    5168.1264, 1832.3742857142859, 2.662857142857143,
+    8461.870419148938, 1284.8781914893614, 6.593404255319149,
+    12913.203984210528, 1516.211052631579, 5.396315789473682,
+    49464.44958947368, 2164.6257894736846, 13.001052631578947,
+    118023.35755833336, 3434.1941666666667, 26.412499999999998,
+    10701.91834, 2296.549, 4.659999999999999,
+    104119.24788, 2024.422, 26.1,
+    7880.470080000001, 1424.6039999999998, 5.5920000000000005,
+    11550.197832258063, 2478.583225806451, 4.6599999999999975,
+    12706.50460909091, 2726.717727272728, 4.6599999999999975,
+    13001.343044444446, 2789.987777777778, 4.66,
+    152609.1993125, 3298.6100000000006, 31.461249999999996,
+    17193.555971428574, 3689.6042857142857, 4.660000000000001,
+    66092.27997872341, 4511.243191489362, 14.08127659574468,
+    41968.94929482758, 4553.071724137931, 9.160517241379315,
+    123562.10321935482, 4774.803870967742, 26.01096774193548,
+    25509.708895833337, 4796.276458333334, 5.339583333333331,
+    135671.71168, 4845.39, 27.499000000000002,
+    213546.15311428576, 5128.314285714287, 42.615714285714276,
+    82846.95055000002, 4965.332857142857, 16.978571428571424,
+    85734.79032857144, 5079.801428571429, 16.647142857142857,
+    55018.05438541667, 4944.928124999999, 11.06854166666667,
+    35199.11542857143, 4135.414761904763, 7.989523809523807,
+    72021.7541173913, 4762.833913043477, 14.185652173913043,
+    40400.44351086957, 5154.0521739130445, 7.902608695652175,
+    70633.06338947368, 5141.660789473684, 13.736842105263158,
+    113768.6602, 5149.913333333334, 22.26888888888889,
+    248143.58873999998, 5202.686, 47.544000000000004,
+    276363.11745517247, 4969.751379310344, 55.53181034482761,
+    652914.5083434996, 5001.739899999997, 129.64849999999993,
+    504752.4202599999, 4997.253066666665, 100.99053333333335,
+    1121402.5517604167, 5014.356458333333, 226.06364583333334,
+    632600.4819928572, 5260.881428571428, 119.1907142857143,
+    1210302.8008884618, 5063.573846153847, 242.37692307692305,
+    2079771.8073, 4918.018571428572, 422.8285714285715,
+    1331129.662857143, 4930.447142857143, 273.00714285714287,
+    1751669.6739599998, 4721.002, 371.024,
+    2023942.3473666667, 4713.318333333334, 429.59666666666675,
+    2122384.829871428, 4955.738571428571, 429.4871428571429,
+    1958367.8059999999, 4687.118333333333, 417.94666666666666,
+    27.887819999999994, 1.4280000000000008, 18.227333333333352,
+    31.62970625000001, 1.6250000000000002, 19.515624999999996,
+    5079.091275000001, 1089.3600000000001, 6.407499999999999,
+    1830.0955875000002, 1256.8706250000002, 1.45625,
+    5341.064825, 1250.8270833333336, 4.271666666666665,
+    0.0, 1259.3919230769231, 0.0,
+    0.0, 1284.53125, 0.0,
+    3917.320266666667, 1260.006666666667, 3.106666666666667,
+    5985.335954285714, 1266.309857142857, 4.726571428571432,
+    1745.2560307692308, 1413.9534615384616, 0.8961538461538462,
+    0.0, 1291.0923076923075, 0.0,
+    215.0863172413793, 1302.6310344827587, 0.1606896551724138,
+    5910.565588571427, 1268.3617142857142, 4.6599999999999975,
+    6438.211426086957, 1271.2356521739127, 5.065217391304347,
+    5977.408628571428, 1282.7057142857143, 4.660000000000001,
+    3550.48196, 1275.6419999999998, 2.7960000000000003,
+    5960.13068, 1278.998, 4.66,
+    6186.654969590645, 1305.1251461988302, 4.741754385964907,
+    11833.760886666661, 1269.5386666666666, 9.319999999999995,
+    7628.465340540538, 1294.262432432433, 5.919459459459456,
+    7645.05154, 1772.132, 4.194,
+    12068.159985365848, 1303.7359756097565, 9.26317073170733,
+    16944.404944, 1280.6460000000004, 13.234399999999999,
+    14829.208745454544, 1299.5336363636363, 11.43818181818182,
+    121960.90270000002, 2131.9824999999996, 32.625,
+    1166.4240093023257, 1344.1672093023255, 0.8669767441860465,
+    4845.079666666667, 1339.583333333333, 3.6244444444444426,
+    7541.441100000001, 1615.7916666666667, 4.66,
+    1803.3682222222224, 1482.33, 1.0355555555555556,
+    5462.276695238096, 1367.1590476190477, 3.994285714285713,
+    9346.795, 2005.75, 4.66,
+    8428.826260000002, 1663.0040000000001, 5.5920000000000005,
+    55894.94748888889, 3024.2688888888893, 13.205555555555556,
+    11851.048808450701, 2564.962535211267, 4.594366197183102,
+    927018.1584600002, 4822.954, 193.9,
+    39226.19824285716, 3835.3177142857135, 8.788857142857147,
+    35576.626759349594, 4767.252845528456, 7.464308943089424,
+    135213.60294403412, 4918.649176136366, 27.317045454545415,
+    653032.5221333331, 5066.994561403509, 129.20315789473688,
+    12139.337280000002, 1955.434, 4.66,
+    183942.1943105263, 4577.870526315789, 38.02473684210526,
+    240145.52365714282, 5118.174285714286, 46.61,
+    379034.6128049999, 4976.419999999999, 76.44199999999998,
+    781842.4186428572, 5003.925714285715, 157.81285714285715,
+    545921.4056058823, 5095.165882352941, 107.47941176470589,
+    373966.43033750006, 4784.9887499999995, 73.99562499999999,
+    659604.6103448275, 5025.104482758621, 130.9941379310345,
+    872691.4044212122, 5104.803636363636, 171.33060606060604,
+    553590.7816600001, 4963.750999999999, 108.60324999999996,
+    1167072.3893760876, 5036.08804347826, 232.10942028985502,
+    1677959.2282705884, 4902.321176470588, 338.6152941176471,
+    1972621.14556, 4859.89, 407.6913333333334,
+    11.407680000000001, 0.612, 7.456,
+    28.733171641791017, 1.4843283582089561, 18.779850746268664,
+    33.40795263157895, 1.5300000000000005, 21.835263157894733,
+    607.9829689655173, 1260.316551724138, 0.4820689655172414,
+    6927.547813513515, 1257.7904504504527, 5.562612612612617,
+    6081.22322939481, 1332.2470893371753, 4.458587896253614,
+    9045.298564179102, 1590.0814925373138, 5.0773134328358225,
+    17646.666925714286, 2717.6434285714286, 3.9948571428571427,
+    6760.633635000001, 1418.423, 4.776499999999998,
+    12210.7844, 2202.0292307692303, 4.839230769230768,
+    35966.537744999994, 2469.20775, 10.253250000000017,
+    16828.60591764706, 1278.9982352941176, 13.157647058823526,
+    13246.155463157898, 1319.8863157894734, 10.055789473684206,
+    15119.397960000002, 1300.977, 11.65,
+    206409.16841999997, 2379.886, 46.61,
+    340791.7155111111, 4196.682222222222, 70.9511111111111,
+    16087.697288888889, 2227.6488888888894, 7.507777777777775,
+    21234.91968, 3436.9304615384617, 5.735692307692312,
+    75395.57840526316, 4102.001052631578, 17.416315789473682,
+    48364.707283673466, 4657.091428571428, 10.462040816326535,
+    46038.06505, 4975.580833333333, 9.321666666666664,
+    84270.582025, 4736.33875, 18.060000000000002,
+    167605.80895714287, 4582.548000000002, 35.82514285714285,
+    683849.3328186045, 4826.646046511628, 142.3260465116279,
+    398442.99915, 4904.609375000001, 80.98687500000003,
+    1301082.672148936, 4788.565106382978, 273.31893617021274,
+    16403.066857142858, 4092.7514285714283, 3.994285714285714,
+    24457.461531395347, 4871.511279069767, 4.98534883720931,
+    71096.75917708334, 5086.6946874999985, 13.933229166666678,
+    51271.56015, 5057.320555555556, 10.097777777777775,
+    232585.94084736842, 5078.321052631579, 44.77052631578949,
+    590355.3399714285, 5376.548571428572, 109.20142857142855,
+    71565.36723333334, 4207.111666666667, 15.534999999999998,
+    217034.51175624997, 4844.4175, 44.863125000000004,
+    81753.19974, 5088.522666666667, 16.15733333333333,
+    198685.36554038464, 5132.402884615386, 38.81307692307692,
+    334097.46979069774, 5076.526744186046, 65.6893023255814,
+    717221.7000000001, 5071.122, 141.696,
+    1246764.51385, 5125.698571428572, 247.70357142857145,
+    829965.1529624999, 5195.743125000001, 158.04125,
+    75087.58686666666, 5083.943333333334, 14.76,
+    83887.63491818182, 4607.891818181818, 16.524545454545454,
+    170732.92487692306, 5105.193846153846, 34.06230769230769,
+    347123.09565000003, 5045.5344444444445, 69.39999999999999,
+    164473.74026, 4518.316000000001, 34.494,
+    345876.936775, 5198.03125, 66.42,
+    620391.3481749999, 5149.953333333334, 120.41249999999998,
+    164003.58590434783, 5074.322608695652, 32.01913043478262,
+    522936.0995545454, 5135.142727272728, 101.69636363636364,
+    240487.74076000002, 4913.6140000000005, 47.541999999999994,
+    781446.5424269232, 4999.6775, 154.44423076923078,
+    887485.9194651163, 5120.502558139533, 173.4360465116279,
+    1436929.0506378377, 5152.459999999999, 281.0513513513513,
+    1232146.5117499998, 4907.151666666667, 253.25166666666664,
+    2035710.7079999999, 4885.276666666666, 416.3883333333334,
+    20.370857142857144, 1.092857142857143, 13.314285714285715,
+    27.123473170731696, 1.455121951219513, 17.27609756097563,
+    31.694800000000004, 1.5299999999999998, 20.715555555555554,
+    1672.4207428571428, 1256.11, 1.3314285714285714,
+    2342.8056800000004, 1256.718, 1.864,
+    450.8119846153847, 1257.7492307692312, 0.3584615384615385,
+    13957.723857142859, 1504.0114285714285, 2.9964285714285714,
+    29.71005, 1.53, 19.418333333333333,
+    29.119725000000006, 1.4024999999999999, 19.032499999999995,
+    22.815360000000002, 252.44599999999997, 14.912,
+    2378.3708, 1264.35, 1.864,
+    5806.298754285712, 1245.9868571428563, 4.6599999999999975,
+    5842.7866375, 1253.816875, 4.659999999999998,
+    5894.613339393941, 1264.9384848484847, 4.6599999999999975,
+    5920.306320000001, 1270.452, 4.659999999999999,
+    0.0, 1269.2313333333334, 0.0,
+    470.97090937499996, 1293.6651562499994, 0.3640625,
+    6101.716006703923, 1281.0728491620123, 4.764134078212286,
+    12826.697727419367, 1278.1382258064525, 10.034032258064524,
+    6747.798335757574, 1324.750303030303, 5.111878787878787,
+    7625.886871794872, 1402.6658974358975, 5.496410256410253,
+    3473.4853625000005, 1336.996875, 2.6212500000000003,
+    16246.589922448977, 1708.4369387755096, 5.7065306122449,
+    172443.40276000003, 2057.996, 39.152,
+    6669.875168421052, 1357.8031578947368, 4.905263157894736,
+    2602.0974, 2609.672857142857, 0.6657142857142857,
+    13539.529033333332, 1586.795, 7.766666666666668,
+    579264.0143599999, 3932.844, 123.05200000000002,
+    11213.233027272729, 2406.273181818182, 4.6599999999999975,
+    9838.135414285714, 2593.5928571428562, 3.827857142857141,
+    12867.248829268294, 2761.2121951219515, 4.6599999999999975,
+    16588.326266666667, 3559.7266666666674, 4.66,
+    0.0, 3470.355555555556, 0.0,
+    8207.030997674417, 4693.614186046511, 1.6258139534883718,
+    24782.19688, 4257.3240000000005, 5.591999999999998,
+    14938.159545454546, 3269.022272727272, 4.4481818181818165,
+    23423.156442105264, 4552.4068421052625, 5.150526315789473,
+    38512.72916385542, 4821.7959036144575, 7.917108433734936,
+    86847.20029275364, 4927.868357487924, 17.63024154589371,
+    173839.71201084333, 4905.970240963854, 35.182289156626474,
+    180984.2748583333, 5107.262499999998, 35.993333333333325,
+    505663.7170657534, 5019.570136986302, 101.20383561643835,
+    1498200.868635714, 4790.684999999999, 315.2907142857143,
+    1011186.60195, 5283.775000000001, 191.1057142857143,
+    118641.78953636363, 4505.632727272727, 25.424545454545456,
+    199397.35145000005, 4923.431666666667, 40.39666666666667,
+    227530.75884444444, 5229.615555555556, 43.50333333333333,
+    496431.6861733333, 5045.991111111112, 98.6082222222222,
+    888456.6149210526, 5189.254736842105, 171.48,
+    1137958.83006, 5255.8, 216.27400000000003,
+    790511.2170066667, 5035.713333333334, 156.9246666666667,
+    1861562.2901428572, 4733.124285714286, 392.86357142857145,
+    1578269.170309524, 4748.095238095238, 333.1580952380952,
+    963750.6012250001, 4774.49625, 202.17625,
+    785173.9597166666, 5112.180000000001, 153.04,
+    643685.3323818183, 5066.045454545456, 128.8163636363636,
+    1210689.9579074075, 5246.264074074075, 230.6381481481481,
+    1539413.204443478, 5107.766086956521, 303.5791304347826,
+    26.456518421052603, 1.389078947368422, 17.291842105263164,
+    32.984887500000006, 1.5300000000000002, 21.55875,
+    5800.601571428572, 1244.764285714286, 4.660000000000001,
+    5804.013690000002, 1245.4964999999997, 4.659999999999998,
+    334.4841485714286, 1259.5945714285713, 0.2662857142857143,
+    5841.256742857143, 1253.4885714285713, 4.659999999999998,
+    4906.917866666668, 1262.7191666666668, 3.883333333333333,
+    5895.427632258068, 1265.1132258064513, 4.6599999999999975,
+    7349.9595909482805, 1298.176939655171, 5.704482758620691,
+    6905.824179032258, 1558.1312096774195, 3.645403225806456,
+    16162.271342857144, 2792.6042857142857, 5.325714285714286,
+    34779.11815847457, 1536.0311016949163, 11.493474576271199,
+    44589.59993666667, 2232.0413333333336, 12.117666666666684,
+    1046141.5994000001, 4850.595555555556, 217.00111111111113,
+    15294.898885714289, 2864.8461904761903, 5.103809523809522,
+    11315.247346666667, 2428.164666666666, 4.659999999999998,
+    6825.582490909091, 1629.6218181818185, 2.9654545454545453,
+    19954.83453333333, 2003.4600000000003, 8.543333333333333,
+    13474.824045714286, 2688.3834285714283, 4.926285714285712,
+    194677.02304444448, 3733.718888888889, 40.913333333333334,
+    65041.19562857143, 4111.065714285714, 14.648571428571428,
+    0.0, 4306.474, 0.0,
+    269839.51536363637, 4686.425454545454, 53.39000000000001,
+    91963.24401666668, 4111.340833333333, 20.196666666666665,
+    27972.962152631586, 4564.8589473684215, 6.132105263157894,
+    91464.25147931033, 4631.436206896551, 19.767931034482757,
+    157516.28098285713, 4637.580285714285, 33.42628571428573,
+    113802.26187058823, 4852.22294117647, 23.579411764705892,
+    351524.55271818175, 4862.637272727273, 70.76454545454546,
+    1086013.3187, 5195.3583333333345, 211.30333333333337,
+    49355.82694545454, 4634.950000000001, 10.592727272727272,
+    18297.999271428573, 3490.319285714286, 4.992857142857141,
+    13510.088341176468, 4872.244705882353, 2.741176470588235,
+    46530.72574999999, 4854.035454545455, 9.32181818181818,
+    54562.44340112357, 4925.213258426966, 11.048988764044942,
+    135452.10051666666, 4894.243333333332, 27.578333333333344,
+    75541.63878979594, 5213.550816326529, 14.363061224489792,
+    146308.59473888887, 5106.328333333333, 29.51944444444444,
+    138325.84528333333, 5055.2, 26.411666666666665,
+    62244.2022, 4962.308260869566, 12.562608695652177,
+    197306.35358, 5016.18, 40.084,
+    153952.60411999997, 4485.654, 32.163,
+    318810.42574545456, 5085.852045454545, 62.5018181818182,
+    213073.31790000002, 4990.7474999999995, 42.533125,
+    939394.8629, 5255.6466666666665, 177.89833333333334,
+    326185.2367222223, 5079.534444444445, 64.22222222222223,
+    277634.87787884613, 4897.3596153846165, 55.126346153846185,
+    523775.91258269217, 5016.201923076923, 104.06788461538463,
+    168374.32852777775, 4949.719444444443, 33.14500000000001,
+    413829.03979230765, 5102.493846153846, 81.03076923076924,
+    515352.95486521756, 5075.648260869565, 100.92304347826087,
+    848975.9966896552, 5029.420344827587, 165.06758620689652,
+    1119780.4400526315, 4927.462105263158, 229.37526315789475,
+    920830.3457744186, 5189.893720930233, 177.4472093023256,
+    617076.0986583334, 4955.740000000001, 122.35499999999998,
+    1147066.937018182, 5240.5936363636365, 219.0727272727273,
+    878510.1249733333, 5099.306666666667, 170.596,
+    1272838.4730909092, 5099.138181818183, 251.27545454545455,
+    1456105.4302769229, 4688.524615384616, 310.50076923076915,
+    1926304.1303428567, 4908.206904761905, 394.3066666666667,
+    1400871.8651, 5346.333333333333, 262.18666666666667,
+    1681534.7153999999, 5186.011250000001, 325.10999999999996,
+    27.462143209876526, 1.435432098765433, 17.490370370370385,
+    30.717692307692307, 1.53, 20.076923076923073,
+    791.3926864864866, 1257.5089189189189, 0.6297297297297297,
+    5423.813491525423, 1249.042542372881, 4.344067796610167,
+    4.074171428571429, 1077.3185714285712, 2.662857142857143,
+    500.82628809523806, 1285.9939285714274, 0.38833333333333336,
+    5898.604700000003, 1265.7949999999987, 4.660000000000007,
+    6926.879054961836, 1288.175572519085, 5.389236641221386,
+    13798.63546285715, 1288.4615714285721, 10.718000000000012,
+    7895.704285714287, 2062.837142857143, 3.3285714285714287,
+    14725.108581818182, 1284.9645454545455, 11.43818181818182,
+    2020.1355548387094, 1342.1183870967743, 1.5032258064516126,
+    5308.797901754385, 1327.9468421052632, 4.0059649122806995,
+    894.1208571428571, 1344.4085714285716, 0.6657142857142857,
+    11923.834914285715, 1332.527619047619, 8.987142857142853,
+    5158.8064, 1329.618333333333, 3.8833333333333333,
+    8687.713725, 1698.3362500000003, 5.2425,
+    4700.633173913043, 1361.2178260869564, 3.4443478260869567,
+    77216.4829923077, 1713.2753846153848, 18.285384615384615,
+    22542.286886259535, 2742.0100763358773, 6.652519083969461,
+    571400.0581, 4403.234285714286, 117.86000000000001,
+    1813622.5232666666, 4938.696666666666, 369.00333333333333,
+    8181.5594111111095, 2011.8555555555556, 4.401111111111111,
+    21691.340675, 3911.0190000000002, 5.1265,
+    109893.81588888889, 4464.626666666667, 22.26888888888889,
+    27648.685371428575, 4637.405714285715, 5.991428571428571,
+    41453.96297647059, 4315.161960784313, 9.321176470588238,
+    106140.03764020622, 4688.046701030926, 22.247731958762895,
+    32618.81091944443, 4984.500388888891, 6.498500000000005,
+    183454.48330777773, 5081.026999999998, 36.09677777777776,
+    31470.64199375, 4403.998750000001, 6.990625,
+    92557.89871153848, 5044.7311538461545, 18.46423076923077,
+    358042.66689423076, 5025.697403846153, 71.12701923076925,
+    766537.7348384616, 5074.434615384616, 150.9476923076923,
+    1254210.8728111112, 5172.806666666666, 242.89777777777778,
+    64383.421247058825, 4517.973529411765, 13.981176470588233,
+    239850.05253500002, 4829.632749999999, 48.5925,
+    454779.4529105263, 4903.846842105263, 92.7321052631579,
+    643264.4221125, 5218.06375, 122.93625,
+    760657.2644600001, 5162.088, 146.35999999999999,
+    1109681.9784999997, 4921.55, 227.45999999999998,
+    1314406.908785714, 4962.717142857143, 265.6828571428572,
+    1248578.2247166666, 5085.723333333333, 247.8166666666667,
+    531836.7323874999, 4938.9503125, 105.6028125,
+    845986.5400557378, 5032.552295081967, 167.2645901639344,
+    980364.6842899999, 4805.556, 204.62300000000002,
+    983185.2010666667, 5262.388333333333, 186.83416666666668,
+    1624115.0895714292, 4973.998928571428, 328.60714285714295,
+    1227218.918265517, 5222.253793103447, 234.33965517241379,
+    1524947.6701714285, 5137.147142857143, 298.3085714285714,
+    1978506.4341687502, 4831.635, 410.17749999999995,
+    28.14746724137929, 1.5034482758620697, 18.077758620689647,
+    29.948220000000003, 1.53, 19.574,
+    31.37724, 1.53, 20.508000000000003,
+    32.9848875, 1.5299999999999998, 21.55875,
+    1672.926685714286, 1256.327142857143, 1.3314285714285714,
+    3596.4714999999997, 1538.5900000000004, 0.7766666666666667,
+    187.80965, 1283.84, 0.145625,
+    230.60368461538462, 1301.8923076923077, 0.17923076923076925,
+    4840.532283333332, 1251.3986111111108, 3.883333333333331,
+    5154.0739111111125, 1105.5144444444443, 6.213333333333332,
+    5844.349753846163, 1268.2995054945072, 4.608791208791203,
+    6267.205379527555, 1304.6945669291335, 4.8067716535433105,
+    5920.31564, 1272.59, 4.66,
+    11812.18664, 1267.402, 9.319999999999999,
+    11515.212009230767, 1274.6567692307692, 9.033230769230771,
+    16287.667303030305, 1282.1896969696973, 12.709090909090913,
+    8882.842293333331, 1304.0313333333334, 6.834666666666665,
+    12245.554213333335, 1313.9006666666667, 9.319999999999997,
+    9641.493400000001, 1295.484, 7.456,
+    15779.39376, 1301.28, 12.116000000000001,
+    3882.6310901098896, 1346.4059340659342, 2.9189010989010975,
+    12312.636466666663, 1321.0983333333336, 9.319999999999995,
+    10839.202716666667, 1335.0891666666666, 8.155,
+    48249.4400923077, 1919.673076923077, 11.473076923076924,
+    16659.441357377047, 1900.5586885245907, 5.500655737704924,
+    143441.2495923077, 2518.901538461538, 32.26846153846154,
+    36554.17090740741, 2393.67037037037, 10.184074074074077,
+    278205.1940545454, 3570.456363636364, 59.74545454545455,
+    269112.43134, 4260.684, 57.798,
+    13119.69846875, 2815.3859375, 4.660000000000001,
+    65250.37840400001, 4896.5816, 12.6776,
+    93080.22925714284, 4057.975, 20.64142857142857,
+    18068.464134482758, 3761.3675862068967, 4.338965517241378,
+    66077.29440833333, 4642.5391666666665, 13.205000000000005,
+    53852.51146190476, 5040.7, 10.209523809523809,
+    17776.567240000004, 4760.38, 3.728,
+    1191954.91648, 4703.604, 252.63199999999998,
+    315479.49136, 4592.796, 66.18800000000002,
+    59389.375701639336, 4519.005737704918, 13.065081967213118,
+    385010.14953437494, 4789.9975, 80.54875,
+    59755.27235384615, 4568.266153846154, 12.309230769230773,
+    79395.66523114753, 5110.465573770492, 15.433770491803278,
+    130764.812321875, 5029.538541666668, 26.023333333333323,
+    262008.08744390242, 5153.406829268291, 51.27121951219513,
+    113634.57948235294, 4124.111764705883, 25.22470588235294,
+    167991.88965175435, 4952.4186842105255, 33.608070175438584,
+    251579.70197, 4792.812000000001, 52.4375,
+    372682.83277142857, 5021.149523809524, 74.35571428571427,
+    672114.6809822693, 5073.18404255319, 132.52680851063826,
+    1238049.93898, 4903.9980000000005, 253.56300000000002,
+    981876.319602439, 5167.273658536587, 189.85451219512188,
+    1651843.1084797469, 4925.7934177215175, 337.30936708860764,
+    24.445028571428576, 1.3114285714285714, 15.977142857142853,
+    29.33507049180325, 1.5549180327868861, 18.86967213114754,
+    34.235279999999996, 1.53, 22.376,
+    21.394499999999997, 1.02, 13.983333333333334,
+    24.445028571428573, 1.3114285714285714, 15.977142857142857,
+    32.091750000000005, 1.5299999999999998, 20.975,
+    33.878025, 1.53, 22.1425,
+    4980.669007142858, 1068.047857142857, 6.990714285714284,
+    3513.61711607143, 1260.9428571428573, 2.7876785714285726,
+    6334.421744927534, 1267.4107246376811, 4.997681159420294,
+    6287.304620000001, 1272.6803999999997, 4.939599999999997,
+    10840.60848333333, 1269.0816666666667, 8.54333333333333,
+    13081.489269230773, 1280.641923076923, 10.216153846153842,
+    16647.510944827587, 1279.2089655172415, 13.015862068965518,
+    22891.846286956523, 1431.9552173913044, 10.333913043478258,
+    5810.692802446481, 1313.5248929663592, 4.417737003058116,
+    47283.520566666666, 1848.6725, 15.146666666666667,
+    6703.848743396227, 1321.7633962264147, 5.099622641509433,
+    3180.4033999999997, 1358.365, 2.33,
+    0.0, 1878.5100000000002, 0.0,
+    201694.23648571427, 2946.3185714285714, 44.611428571428576,
+    6725.225457142857, 1443.1814285714286, 4.660000000000001,
+    6265.9758, 1344.63, 4.66,
+    11760.238125, 2151.6324999999997, 5.825,
+    31413.159155555553, 2650.9288888888887, 8.803333333333331,
+    499.5054, 1531.8876923076923, 0.3584615384615385,
+    12733.62325641026, 2454.6030769230765, 4.898974358974356,
+    133727.38825999998, 4351.954, 28.898000000000003,
+    12204.773, 2619.05, 4.660000000000001,
+    14394.008597183098, 3210.1792957746475, 4.266338028169016,
+    0.0, 4778.693333333334, 0.0,
+    33099.50598823529, 4595.561411764705, 7.181999999999999,
+    150339.7573220588, 4429.923088235293, 32.55911764705883,
+    190523.177, 4804.03, 39.151999999999994,
+    438380.59295555553, 4804.301111111112, 92.1888888888889,
+    923365.9086181821, 4785.353636363638, 194.07227272727275,
+    10318.970857142858, 3901.097142857143, 2.662857142857143,
+    15183.243066666668, 4740.705555555555, 3.106666666666667,
+    19928.754621428576, 4793.35607142857, 4.160714285714284,
+    61225.089355555545, 4935.218888888889, 11.911111111111108,
+    70054.57614, 4895.909, 13.982,
+    18896.795125000004, 5009.729375000001, 3.7862499999999986,
+    94839.35282987548, 4982.597385892117, 18.836970954356826,
+    574746.9638565613, 5082.818009049773, 112.03493212669687,
+    1300781.2415952382, 4984.95619047619, 262.13142857142867,
+    1719315.0415038462, 4945.583076923077, 349.7607692307692,
+    415893.36443333334, 5082.0109999999995, 82.19099999999999,
+    1066224.3160269232, 4945.025576923077, 216.74192307692311,
+    789802.1617250001, 5148.581, 152.419,
+    1466130.4550377356, 5045.643207547169, 294.177358490566,
+    28.51595416666665, 1.4979166666666675, 18.25208333333332,
+    26.740575, 1.3387499999999999, 17.4775,
+    30.66273, 1.5299999999999998, 20.040999999999997,
+    35.65118571428572, 1.5299999999999998, 23.301428571428573,
+    487.9861388888889, 1262.1688888888891, 0.38833333333333336,
+    5571.796104000001, 1195.4807999999998, 5.219199999999998,
+    5630.544724000003, 1258.5462, 4.473599999999998,
+    8848.48460273973, 1271.6099315068511, 6.958082191780825,
+    5686.925806896551, 1263.2634482758624, 4.499310344827584,
+    11291.815454545454, 1269.9818181818182, 8.896363636363635,
+    9688.78075, 1278.61875, 7.5725,
+    12268.77477142857, 1883.1771428571426, 7.322857142857141,
+    883.6017882352943, 1289.0079411764707, 0.6852941176470588,
+    0.0, 1289.68, 0.0,
+    0.0, 1294.6790909090907, 0.0,
+    0.0, 1304.1230769230767, 0.0,
+    0.0, 1355.7823076923073, 0.0,
+    1042.5507333333333, 1341.96, 0.7766666666666667,
+    2275.3000727272724, 1342.9618181818184, 1.6945454545454546,
+    7373.694128979595, 1307.7244897959179, 5.649061224489809,
+    12903.750994444448, 1314.2727777777782, 9.837777777777776,
+    8288.921742857141, 1778.7385714285715, 4.660000000000001,
+    11400.380848780487, 1390.118292682927, 7.8424390243902415,
+    13013.92464615385, 1306.8230769230768, 10.036923076923078,
+    8943.759366666667, 1919.2616666666665, 4.66,
+    17571.7416, 2064.1040000000003, 8.388,
+    2093.393677777778, 1342.846111111111, 1.5533333333333335,
+    632.28744, 1430.556, 0.466,
+    34235.27255714285, 2818.115714285714, 7.324285714285714,
+    4810.6757230769235, 1343.1030769230772, 3.5846153846153843,
+    9040.328307692309, 1950.1984615384617, 4.659999999999998,
+    18163.854134666664, 2493.6308, 6.089466666666676,
+    13816.552292307693, 1716.918461538461, 7.527692307692309,
+    36070.88707241378, 3029.030344827585, 8.838965517241377,
+    36870.71700909091, 3964.854090909091, 8.049999999999997,
+    49701.90455714286, 3846.699285714286, 11.318571428571428,
+    278333.3882636363, 4606.227727272727, 57.20409090909091,
+    72131.46402539681, 4484.539047619048, 15.314126984126986,
+    65087.64219963376, 4962.151318681323, 13.230915750915738,
+    273924.7272136364, 4984.668181818181, 54.44954545454547,
+    957937.9598899999, 5085.012, 190.172,
+    96544.7383472222, 3801.808333333332, 21.880277777777774,
+    257366.97552432437, 4494.398108108107, 54.42135135135137,
+    267389.2455561905, 5110.936571428572, 52.026380952380975,
+    618980.4351243902, 5110.597073170732, 118.68756097560977,
+    357752.64888449607, 5006.744108527131, 71.65108527131785,
+    909690.8654100001, 5016.229, 182.55999999999995,
+    1087548.2270769232, 5124.683076923076, 212.2607692307692,
+    933274.9982333332, 5054.69, 184.89166666666665,
+    754171.7597499999, 4727.818333333333, 159.255,
+    1165844.9065416667, 5324.5841666666665, 218.6841666666667,
+    1452060.9076888892, 4777.166666666667, 304.00777777777773,
+    1750624.7531612238, 4739.944897959184, 369.65367346938774,
+    1436077.197190476, 5040.555238095238, 285.4366666666666,
+    1327275.0718333332, 5263.258974358975, 252.41666666666663,
+    910763.50225, 5272.945, 172.46166666666667,
+    27.600504285714255, 1.464285714285715, 17.775000000000006,
+    29.952299999999997, 1.4280000000000002, 19.576666666666664,
+    5803.381184615385, 1245.360769230769, 4.6599999999999975,
+    5809.00455, 1246.5675, 4.66,
+    5865.293466666667, 1258.6466666666668, 4.66,
+    4240.467455701751, 1307.125175438596, 3.2395175438596615,
+    6289.570227272727, 1536.3813636363643, 4.024545454545453,
+    4594.573600000001, 2060.188333333333, 1.5533333333333335,
+    5902.219528571429, 4197.410000000001, 1.3314285714285714,
+    10733.50297272727, 1266.3059090909092, 8.472727272727269,
+    11818.192714285708, 1268.0464285714284, 9.319999999999995,
+    10991.595257142855, 1270.0585714285714, 8.654285714285715,
+    5514.651556756758, 1371.275, 4.030270270270272,
+    11986.9413, 1286.1525, 9.319999999999995,
+    12288.2388754717, 1318.4805660377356, 9.319999999999995,
+    12024.5941, 1289.175, 9.32,
+    80198.6569, 1510.8200000000002, 23.303333333333327,
+    5887.59312, 1806.4720000000002, 2.7960000000000003,
+    6332.571436363636, 1343.658181818182, 4.659999999999999,
+    6505.414366666667, 1396.011666666667, 4.66,
+    40048.24341578948, 1977.5800000000006, 10.915789473684221,
+    11156.37063809524, 2501.3445238095246, 4.549047619047617,
+    4333.784466666667, 2148.7083333333335, 3.106666666666667,
+    29574.51651052632, 4861.834736842105, 5.6421052631578945,
+    18053.23144, 1385.8873333333336, 13.35866666666667,
+    13092.074783783783, 2809.458108108108, 4.6599999999999975,
+    20091.456025000003, 3893.46875, 5.2425,
+    282462.7672, 4650.8705, 59.894999999999996,
+    65700.49691470589, 3837.445588235294, 14.392941176470591,
+    176786.26077777776, 4528.84, 37.977777777777774,
+    108282.26095384615, 4848.546923076924, 22.588461538461537,
+    29080.543600000005, 4966.8025, 5.824999999999999,
+    193211.0980526315, 4322.183684210526, 39.741052631578945,
+    33979.81916363636, 3744.7281818181814, 8.897272727272728,
+    25390.901024137926, 4786.561379310344, 5.302758620689656,
+    111891.28070377362, 4884.4084905660375, 23.040754716981137,
+    63616.248412280744, 5111.483684210526, 12.51000000000001,
+    233865.57702941183, 5138.2605882352955, 45.239411764705885,
+    369828.05765, 5069.749, 72.24800000000002,
+    175557.8226605263, 5152.464736842106, 33.976842105263174,
+    62462.59912857142, 4843.45, 12.983571428571425,
+    172623.45945, 4903.083333333333, 35.73499999999999,
+    268111.68213636364, 4707.376363636364, 56.78,
+    277007.7052392857, 5130.387142857144, 53.769642857142856,
+    250204.38799743587, 4975.189230769231, 50.5553846153846,
+    462741.68696785724, 5065.520714285715, 91.89035714285716,
+    1174208.1548, 5144.42, 231.30749999999998,
+    767145.7265800001, 5084.248, 152.886,
+    427719.39070348814, 4961.311162790695, 84.658488372093,
+    851211.9834659998, 5082.0212, 167.05339999999995,
+    947949.0366571428, 5147.392040816326, 184.06632653061226,
+    1290717.606725, 5150.8609375, 252.5734375,
+    85412.81022000001, 4253.054, 17.711999999999996,
+    1070137.6761235294, 5001.884705882353, 213.58823529411768,
+    1478909.6793512201, 4988.366585365852, 297.17329268292684,
+    27.909438983050826, 1.4777966101694922, 17.613728813559316,
+    34.759687500000005, 1.5299999999999998, 22.718750000000004,
+    34.47344999999999, 1.53, 22.531666666666666,
+    30.6243, 1.4400000000000002, 20.015882352941176,
+    6196.358833684206, 1281.0432842105265, 4.836589473684224,
+    27390.536290000007, 2042.7350000000001, 8.389,
+    19057.372767032964, 1348.7210989010985, 8.296373626373631,
+    180259.25847058828, 2567.828529411764, 41.12647058823532,
+    2017.2984666666666, 1314.2580000000003, 1.5533333333333332,
+    1796.081926530612, 1385.368775510204, 1.331428571428571,
+    22710.16191204819, 1361.159638554216, 10.331204819277113,
+    26460.79298586956, 1710.0992391304342, 8.763695652173906,
+    27117.759695000004, 3776.0995000000003, 6.291499999999999,
+    17523.456870796465, 2705.543982300884, 5.443893805309735,
+    101936.67570151518, 4528.666136363637, 21.821742424242423,
+    633777.2695333334, 4825.3533333333335, 131.84285714285716,
+    21355.50316, 4582.726000000001, 4.66,
+    28015.48196, 4725.275333333333, 5.902666666666666,
+    24876.5712, 4844.323333333333, 5.177777777777777,
+    9949.133285714286, 4942.001428571429, 1.997142857142857,
+    84049.95976666668, 3046.6516666666666, 20.973333333333333,
+    37189.042109677415, 4394.766774193548, 8.11806451612903,
+    271970.17584615387, 4764.064769230768, 57.367846153846166,
+    70101.08923731344, 5082.269328358208, 13.668955223880603,
+    130445.09643461542, 5121.2780769230785, 25.27692307692307,
+    173825.34221617653, 4952.349117647059, 34.47735294117648,
+    212208.06971794876, 5230.385641025639, 40.276923076923076,
+    229848.10677837848, 5089.842702702702, 44.84702702702703,
+    306893.8023157895, 5254.723157894737, 58.38631578947368,
+    859392.82749, 5205.281, 164.53799999999998,
+    720478.2928, 5215.813, 137.502,
+    296634.42880000005, 5125.662222222222, 58.00555555555555,
+    512493.92781818187, 5156.371818181818, 99.15545454545455,
+    762533.75784, 5260.686000000001, 144.494,
+    63754.854011111114, 2994.503333333333, 17.08888888888889,
+    151918.41664, 5093.7119999999995, 28.898000000000003,
+    348706.88976, 4949.634, 70.85,
+    324597.5980375, 4565.782499999999, 65.25750000000001,
+    535277.8930375001, 4919.3, 105.45749999999998,
+    703699.0242, 5131.257142857142, 136.50428571428571,
+    461376.56588571426, 5066.7185714285715, 89.89285714285714,
+    1061998.3733285714, 5270.25642857143, 201.42714285714285,
+    780293.5282600002, 4751.222, 165.46800000000002,
+    1324971.9793999998, 5061.05, 264.51874999999995,
+    279925.93655000004, 5095.135, 55.155,
+    602683.8870153845, 4999.0623076923075, 119.39615384615382,
+    712014.9726625, 5231.22875, 135.7525,
+    663921.5663, 4761.905, 139.83333333333334,
+    897360.1023250001, 5065.552999999999, 177.35550000000003,
+    973344.0979833333, 5227.92, 185.66833333333332,
+    1141077.1536, 4817.6125, 236.55,
+    1193659.316057143, 4950.721428571429, 241.71,
+    1296193.4838833334, 4881.97, 266.46000000000004,
+    924596.61152, 5017.094, 181.31599999999997,
+    1101535.477291111, 5268.790222222222, 208.81733333333335,
+    1841979.531792308, 4993.308076923076, 370.3776923076922,
+    2149466.4546571425, 4890.328571428572, 440.80428571428575,
+    1751406.0453, 5291.818000000001, 331.87,
+    25.50153333333331, 1.3533333333333342, 16.43025641025642,
+    31.377240000000004, 1.5300000000000002, 20.507999999999996,
+    30.907699999999995, 1.3599999999999999, 20.20111111111111,
+    32.41652727272728, 1.5299999999999998, 21.187272727272727,
+    119.45862448979592, 1261.1520408163267, 0.09510204081632653,
+    2512.6853142857144, 1257.1971428571428, 1.997142857142857,
+    333.8838222222222, 1289.4275925925922, 0.2588888888888889,
+    1365.5715777777777, 1315.4611111111112, 1.0355555555555556,
+    48179.640583333334, 1616.5566666666666, 13.981666666666667,
+    7144.940026666664, 1273.2784615384646, 5.615948717948719,
+    5823.169822580647, 1292.3669354838703, 4.509677419354846,
+    6233.460649999998, 1314.9767857142865, 4.743214285714285,
+    11537.943568888888, 1280.660888888889, 9.00933333333333,
+    15234.826982352937, 1295.0250000000005, 11.787058823529412,
+    14895.00265, 1278.2358333333334, 11.65,
+    15318.88610769231, 1543.5115384615385, 10.036923076923076,
+    7758.922607920789, 1328.2023762376232, 5.859603960396048,
+    31691.378163999998, 1640.3552000000002, 10.9988,
+    16882.05446910569, 2356.7430081300827, 5.228617886178863,
+    28531.828599999997, 5088.218, 5.5920000000000005,
+    110538.82596666664, 4694.240000000001, 22.268888888888885,
+    632007.84424, 4813.798, 131.44400000000002,
+    8663.996266666669, 1394.6108333333332, 6.213333333333334,
+    6145.940025, 1840.4687499999998, 2.9125,
+    12570.424707936509, 2908.9866666666667, 4.438095238095237,
+    63727.3802074074, 4809.218148148148, 13.11925925925926,
+    15437.643763636366, 1734.6554545454544, 8.049090909090909,
+    36736.11436923077, 3525.0546153846153, 7.887692307692307,
+    47989.96478750001, 4596.5921875, 10.340937500000006,
+    77302.05527108433, 4951.472289156627, 15.274096385542183,
+    142926.2548897959, 4363.459489795919, 30.77173469387755,
+    166604.92717547785, 5015.47668789809, 33.14656050955407,
+    318688.8611431035, 5040.367068965517, 63.64844827586206,
+    653992.9748307691, 5013.618846153847, 129.61499999999998,
+    1125190.9300227275, 4930.693636363636, 228.8168181818182,
+    971945.0804458335, 5191.799166666667, 187.02625,
+    953259.2236923078, 5189.138461538461, 183.57692307692307,
+    363879.99720000004, 5147.793333333334, 69.14,
+    447148.2462641509, 4621.893018867925, 91.5507547169811,
+    1158954.2885882352, 4948.016470588235, 236.34294117647062,
+    522181.5438041668, 5217.746666666667, 99.24250000000002,
+    1123580.6888511109, 5273.470888888889, 213.06333333333333,
+    1846417.1597600002, 4931.93, 375.684,
+    1535172.11558, 4774.4220000000005, 321.61600000000004,
+    1125662.1175799998, 5305.2519999999995, 212.546,
+    1185579.29582, 5255.188, 225.59799999999996,
+    1193560.4713400002, 4789.986, 246.10800000000003,
+    613553.1848444445, 4894.35, 124.29666666666668,
+    1420463.2628333333, 4916.564444444444, 288.98777777777775,
+    1606111.3262999998, 4840.356, 332.802,
+    2020165.9077714288, 4898.83, 414.17285714285714,
+    2131417.8493333333, 4689.916666666667, 454.45666666666665,
+    1852801.48696, 4732.602000000001, 391.532,
+    28.514462318840554, 1.5075362318840588, 18.10014492753624,
+    33.28260000000001, 1.5300000000000002, 21.753333333333334,
+    2195.052225, 1257.06, 1.7475,
+    0.0, 1259.4485714285715, 0.0,
+    5804.449399999999, 1245.5899999999995, 4.6599999999999975,
+    5500.926312903228, 1261.6185483870966, 4.359354838709676,
+    706.2167589285715, 1305.585982142856, 0.540892857142857,
+    7074.339816828478, 1291.1760194174747, 5.489449838187724,
+    6574.169925490194, 1290.6707843137253, 5.116862745098038,
+    15977.863160000003, 2050.5199999999995, 6.058,
+    12456.621329411766, 1463.405882352941, 9.045882352941174,
+    12405.565897674416, 1316.197209302326, 9.42837209302325,
+    16742.10120930232, 1289.1858139534884, 13.004651162790704,
+    12398.73490909091, 1330.3363636363636, 9.319999999999999,
+    2206.0103444444444, 1525.4047222222225, 1.4238888888888885,
+    5624.708690322581, 1380.6177419354838, 4.058709677419353,
+    4473.656955555556, 1483.4333333333336, 2.847777777777777,
+    13189.104800000001, 2830.28, 4.66,
+    8704.0878, 1570.514, 5.5920000000000005,
+    10879.930763636365, 2334.7490909090907, 4.659999999999999,
+    44926.51906363636, 2576.3118181818177, 11.651818181818179,
+    15768.042000000001, 3383.7000000000003, 4.66,
+    12399.944553846155, 2823.2430769230773, 4.391153846153843,
+    37191.111922222226, 3912.037222222222, 9.579444444444443,
+    30010.04822571428, 4434.370857142858, 6.790571428571425,
+    355010.31530175434, 4726.292280701754, 75.14947368421053,
+    386193.25473, 4963.599, 77.84,
+    79576.0194894737, 4883.281315789473, 16.067631578947367,
+    354849.55137777777, 4897.317222222222, 71.98722222222221,
+    1084065.1882371795, 4897.036666666667, 219.66910256410245,
+    4896.131520000001, 1302.8080000000002, 3.728,
+    6119.446760000001, 1304.334, 4.66,
+    4062.161942857143, 1449.284285714286, 2.662857142857143,
+    312004.0358, 2512.514, 67.12,
+    80657.92913333334, 4400.895999999999, 15.847333333333333,
+    80017.08983333335, 4945.563333333333, 15.536666666666667,
+    62532.032466666686, 4383.8012, 13.17426666666667,
+    75381.77633846157, 5050.9147863247845, 14.858632478632483,
+    529921.8478, 5038.15625, 108.37,
+    483112.10503333336, 5012.465, 96.33,
+    156369.0754414894, 5011.836808510638, 31.239361702127646,
+    370871.30876995885, 4925.854609053498, 73.63777777777776,
+    813785.7014125, 5141.941875, 158.47812499999998,
+    1198675.548333333, 5155.171111111112, 233.05666666666664,
+    728013.5436000002, 5016.907692307693, 145.21153846153845,
+    856536.73358, 5309.219999999999, 161.274,
+    1085498.955616981, 5201.091320754716, 208.4303773584905,
+    1384011.3708499998, 5201.718333333333, 264.90333333333336,
+    1574544.6677625, 4824.29, 327.44374999999997,
+    1354422.6749999998, 5098.696666666667, 265.1644444444445,
+    1523780.0831444445, 5298.126666666667, 287.43444444444447,
+    1838382.4263100002, 4769.383, 385.472,
+    1715451.715542857, 5144.995714285715, 332.27,
+    28.91928428571426, 1.5295714285714292, 18.10785714285715,
+    32.806259999999995, 1.53, 21.442,
+    27.507214285714287, 1.3114285714285714, 17.97857142857143,
+    1169.318266666667, 1273.7866666666669, 0.9319999999999995,
+    4065.4119600000004, 1126.5260000000003, 5.126,
+    5788.0114568047375, 1264.5047928994102, 4.577278106508872,
+    12686.220773437506, 1335.5786718749994, 6.08015625,
+    6563.456048734177, 1377.4241772151904, 3.6279113924050685,
+    15158.752177777778, 1717.372222222222, 5.695555555555556,
+    93559.44159999998, 2540.065, 18.643749999999997,
+    11637.428177011492, 1278.3690804597707, 9.105747126436794,
+    13962.710610169494, 1303.004745762712, 10.741694915254243,
+    11322.531669565216, 1330.4278260869564, 8.5095652173913,
+    8784.059754545453, 1581.7527272727273, 5.295454545454544,
+    12065.911657142859, 1294.6257142857144, 9.319999999999997,
+    11601.638519999999, 1957.8760000000002, 6.524000000000001,
+    98772.37467200002, 2648.9624000000003, 24.05,
+    16811.188177777778, 1299.01, 12.944444444444448,
+    212043.24943333337, 2924.043333333333, 46.610000000000014,
+    11692.381273469384, 2509.0946938775514, 4.6599999999999975,
+    40886.331028571425, 3447.8014285714285, 9.987142857142857,
+    17177.70132, 3686.2019999999998, 4.66,
+    11007.050480000002, 2362.0280000000002, 4.659999999999999,
+    13040.460785714287, 2798.382142857143, 4.659999999999998,
+    251698.87647142858, 4160.561428571428, 48.607142857142875,
+    81916.76495999999, 3115.0788000000007, 18.456800000000005,
+    52731.846575, 4358.160833333333, 11.496333333333332,
+    51086.21254814816, 4439.865925925926, 10.356296296296296,
+    91144.04137269506, 4946.294432624113, 18.345744680851002,
+    131503.31577265623, 4932.463515625, 26.218203125000002,
+    258817.3751513157, 4943.10657894737, 52.43736842105263,
+    505651.07343552634, 4949.091184210526, 102.85144736842108,
+    1296500.7730428572, 5042.2985714285705, 258.35857142857145,
+    115466.55017272726, 4102.841818181818, 24.577272727272724,
+    323547.93673888885, 4998.389444444444, 64.47888888888889,
+    560258.6982344828, 4955.42275862069, 110.42034482758619,
+    867204.9384000001, 5113.960740740741, 170.04407407407402,
+    961875.158690909, 5029.137272727272, 191.95363636363638,
+    819505.1705571429, 5276.905714285714, 155.14714285714285,
+    999865.9848925925, 5109.946296296296, 195.42074074074074,
+    1211103.70386, 4949.3279999999995, 247.04000000000002,
+    824913.0462333335, 4894.181666666666, 169.35166666666666,
+    1223119.427, 5007.6325, 244.70666666666668,
+    137070.62353333333, 4735.193333333334, 29.51833333333333,
+    1111733.87184, 5180.0960000000005, 216.276,
+    1620401.55993, 4724.509, 343.05499999999995,
+    1509055.2436799998, 4804.638, 314.158,
+    1042544.1651899999, 4930.174499999999, 207.8855,
+    1360179.6049074074, 5293.775555555556, 256.53333333333336,
+    2069767.109342857, 4772.587142857143, 434.1485714285714,
+    1883664.95902, 4704.365, 400.38700000000006,
+    2144753.4512833334, 4695.511666666666, 456.78666666666663,
+    1793721.59661, 5175.213000000001, 348.65,
+    31.816938461538466, 1.53, 20.795384615384613,
+    26.679221505376336, 1.3818279569892482, 17.23827956989249,
+    1169.98154, 1256.109, 0.932,
+    0.0, 1258.1936842105267, 0.0,
+    2910.1467, 622.965, 8.543333333333335,
+    2590.473288888889, 1253.9033333333334, 2.071111111111111,
+    5816.500677777776, 1248.1761111111107, 4.6599999999999975,
+    4837.569300000001, 1247.4566666666667, 3.8833333333333333,
+    160.98851621621623, 1283.763378378378, 0.12594594594594594,
+    6172.888222499996, 1277.3782500000011, 4.8347500000000005,
+    6874.442310294112, 1376.2316176470579, 4.386029411764707,
+    21319.894392857146, 1595.9142857142858, 7.3235714285714275,
+    4199.584324705882, 1418.2927647058827, 2.878235294117653,
+    14156.501383333332, 2582.586666666667, 5.048333333333331,
+    6866.249040000001, 2592.1859999999997, 2.7960000000000003,
+    26943.76551111111, 4729.6, 5.178888888888888,
+    11390.341825531914, 1276.5651063829794, 8.923404255319145,
+    11881.244733333333, 1308.2717948717955, 9.081025641025636,
+    11399.951757894736, 1289.6836842105265, 8.829473684210525,
+    14248.049857142856, 1712.02, 7.98857142857143,
+    11190.75367142857, 1929.8371428571427, 6.324285714285712,
+    14423.79976, 3095.236, 4.66,
+    14138.137100000002, 3033.935, 4.66,
+    291830.1648, 4613.858333333334, 59.04,
+    34507.596542857136, 4747.732857142857, 7.324285714285712,
+    464459.0717, 4892.483333333334, 95.81111111111112,
+    112707.24706250001, 4888.2025, 22.138749999999998,
+    1030363.37124, 4811.05, 216.27399999999997,
+    609522.1862571428, 5119.05, 116.52857142857142,
+    1415842.4702142857, 4974.707142857143, 290.32,
+    11463.10811111111, 1302.5716666666667, 8.80222222222222,
+    16994.91748, 1279.7620000000002, 13.280999999999997,
+    64550.153763636365, 1978.9927272727275, 18.219999999999995,
+    11891.841290909088, 1336.1663636363635, 8.896363636363635,
+    14043.290566666667, 2151.3355555555554, 6.213333333333332,
+    2527.7238000000007, 1358.0579999999998, 1.864,
+    12326.849466666667, 2645.2466666666664, 4.66,
+    129376.07598000001, 3373.9339999999997, 28.897999999999996,
+    11821.117941176473, 2787.744117647059, 4.3858823529411755,
+    27825.119306250002, 3942.7849999999994, 6.699062499999998,
+    13102.3356, 2811.6600000000003, 4.66,
+    36053.1448137931, 4636.120689655172, 7.713448275862066,
+    71855.11356, 4556.164, 15.846,
+    98004.77472000002, 4824.786, 20.51,
+    315034.78380000003, 4707.086666666666, 64.47833333333334,
+    875919.3067666666, 4993.133333333333, 173.23666666666668,
+    10809.326680000002, 2319.598, 4.66,
+    65465.888060000005, 5105.312, 13.05,
+    31139.34458957056, 4918.39711656442, 6.289693251533739,
+    173847.45984767447, 4997.781744186047, 34.904186046511626,
+    103908.77974782609, 4819.571086956523, 21.68369565217391,
+    166692.19778333334, 5124.949000000001, 32.62766666666666,
+    345115.7198103449, 4906.530344827586, 70.3993103448276,
+    579204.1039111112, 5017.4672222222225, 114.19666666666669,
+    85284.49344583334, 3748.02875, 19.420000000000005,
+    373329.76580222225, 4482.39688888889, 79.13488888888891,
+    364724.12509385956, 5114.790350877192, 70.69359649122806,
+    707188.6906681819, 5128.414090909091, 136.86727272727273,
+    1108114.8954119047, 4906.499047619048, 224.95380952380938,
+    1749876.7285666666, 4753.611, 369.7796666666667,
+    382957.81545, 5095.962500000001, 74.57625,
+    1054851.1028528002, 5188.88888, 203.29855999999995,
+    26.916907499999972, 1.396125000000001, 17.59275000000001,
+    30.305475, 1.5299999999999998, 19.8075,
+    29.412337500000007, 1.5299999999999998, 19.223750000000003,
+    5294.086199999999, 1135.664999999999, 5.893529411764704,
+    5817.8857333333335, 1248.4733333333334, 4.66,
+    479.9089540983607, 1259.7844262295084, 0.3819672131147541,
+    383.6112, 1285.5574468085108, 0.2974468085106383,
+    5811.448276190476, 1247.091904761905, 4.659999999999998,
+    2332.85192, 1254.2779999999998, 1.864,
+    6077.334826865683, 1266.3002238805977, 4.799104477611943,
+    10625.482413559319, 1269.5072881355936, 8.372203389830506,
+    13961.313400000003, 1279.56052631579, 10.914210526315792,
+    7877.104578947369, 1286.3089473684213, 6.131578947368421,
+    12654.183400000002, 1512.993125, 9.028749999999999,
+    11738.905033333334, 2086.1316666666667, 6.213333333333334,
+    4455.5230477064215, 1303.5181651376136, 3.4201834862385363,
+    9036.5234406015, 1316.273157894737, 6.867368421052638,
+    4074.751048076923, 1364.3227884615385, 3.0021153846153847,
+    9291.077796296297, 2901.319444444445, 3.45185185185185,
+    5994.260520000001, 1295.1760000000002, 4.66,
+    6344.196018181819, 1362.110909090909, 4.66,
+    11921.519011764705, 2173.740588235294, 5.208235294117645,
+    19921.11265757575, 3149.3975757575754, 5.789999999999998,
+    2291.9511, 1309.7137500000003, 1.7475,
+    6241.2655368421065, 1340.211052631579, 4.659999999999999,
+    9573.198981818183, 2054.3345454545456, 4.659999999999999,
+    99293.99534166668, 3168.370833333333, 22.91666666666667,
+    11744.4582, 2907.6040624999996, 4.077499999999998,
+    40801.51971538461, 4519.583846153845, 8.962307692307691,
+    16137.880104, 3904.3348000000005, 4.100799999999998,
+    51454.34120588235, 4859.195490196077, 10.235294117647062,
+    31186.77557777778, 3868.198888888889, 7.7666666666666675,
+    78654.64321428571, 4537.000714285714, 17.312142857142856,
+    60621.43701333333, 4960.765666666665, 12.05540000000001,
+    234948.53383956043, 4966.0028571428575, 46.55989010989009,
+    127563.29287142855, 4894.6900000000005, 24.637142857142855,
+    799008.3377625, 5090.6224999999995, 155.565,
+    155644.78161132077, 4910.440566037736, 31.83547169811321,
+    359147.1244157894, 5059.202631578947, 70.40657894736843,
+    169591.589725, 4166.666249999999, 37.87125,
+    193551.92197572812, 4912.559611650488, 39.41524271844659,
+    200224.28672105263, 5211.8273684210535, 38.76157894736842,
+    409863.0331833333, 5141.433333333333, 79.24,
+    403171.9703826087, 5075.980869565216, 79.64478260869564,
+    610780.8077090909, 4915.778636363637, 124.36681818181819,
+    914172.3637, 5169.414, 177.122,
+    947843.3661333333, 4852.463333333334, 195.765,
+    522855.1204, 4808.345714285714, 109.20285714285716,
+    820446.6100000001, 4686.812, 175.256,
+    1060058.1338555557, 4837.37, 220.62555555555556,
+    1769784.4146999998, 4782.889999999999, 371.14000000000004,
+    457587.38011176465, 4620.501764705883, 95.96411764705881,
+    849986.428459091, 5266.123636363636, 161.23181818181814,
+    1265659.6335999998, 5192.69, 245.87249999999997,
+    1496032.74635, 5064.1033333333335, 294.42333333333335,
+    1062265.1557818183, 4993.757272727273, 212.71545454545458,
+    1556176.6888100004, 4913.522800000001, 319.9374,
+    920051.4495733331, 5242.267333333333, 175.5693333333334,
+    1104353.022403846, 5206.748846153847, 211.90038461538467,
+    1358180.1449666666, 5113.791111111112, 268.2711111111111,
+    2121739.93795, 4907.408333333333, 434.26000000000005,
+    2143971.0567833334, 4824.224999999999, 446.69000000000005,
+    27.94918666666664, 1.4278666666666675, 18.02053333333334,
+    32.086650000000006, 1.53, 20.971666666666668,
+    22.729106250000005, 1.1475, 14.855624999999996,
+    5212.624740000001, 1118.13, 6.057999999999998,
+    367.4338307692308, 1272.9407692307693, 0.2867692307692308,
+    532.1338727272728, 1265.5418181818184, 0.42363636363636364,
+    5309.546385454547, 1254.827818181818, 4.236363636363634,
+    6369.912086075966, 1270.577025316458, 5.013924050632909,
+    3547.6393599999997, 1278.084, 2.7960000000000003,
+    11204.382594736839, 1269.241842105263, 8.829473684210523,
+    11815.037077272727, 1282.1552272727272, 9.214090909090904,
+    17085.95058, 1279.4563333333333, 13.35866666666667,
+    813.1783641025642, 1309.0156410256407, 0.5974358974358974,
+    1253.5999142857142, 1346.067714285714, 0.9320000000000002,
+    6596.866549659864, 1308.1655782312932, 5.0404081632653055,
+    14375.517377272721, 1361.8331818181807, 7.413939393939396,
+    107506.86084285715, 2984.4757142857147, 25.30142857142857,
+    64921.50519999999, 2198.892857142857, 15.647142857142855,
+    3736.008542857143, 1532.1385714285716, 2.662857142857143,
+    3498.626327272727, 1379.5945454545451, 2.541818181818182,
+    7506.741045454547, 2114.690454545454, 3.3890909090909074,
+    14669.195359999998, 2793.958, 5.1259999999999994,
+    10620.490470833332, 2978.2258333333334, 3.7862499999999977,
+    62668.1545875, 4154.26375, 13.981250000000001,
+    146147.3752193549, 4934.765483870967, 29.018709677419352,
+    644035.2812333335, 5034.765000000001, 128.95777777777778,
+    1520423.5713666668, 4893.163333333334, 314.8833333333334,
+    10822.113720000001, 1296.7019999999998, 8.388000000000002,
+    25795.228066666667, 1887.971666666667, 11.65,
+    8198.159366666669, 1323.0083333333334, 6.213333333333334,
+    56913.33575555557, 3378.782222222222, 12.946666666666667,
+    13739.004771428574, 1299.9314285714286, 10.651428571428571,
+    11191.95462, 1837.7600000000002, 4.660000000000001,
+    16287.24988, 1347.0700000000002, 12.116000000000001,
+    9807.902, 1844.3220000000001, 5.5920000000000005,
+    41278.33606666667, 3264.9072222222217, 10.097777777777777,
+    68971.74578749998, 4452.934375, 14.273124999999995,
+    53385.25478181819, 4587.467636363637, 11.524363636363635,
+    93274.77165862068, 4409.55172413793, 20.411034482758623,
+    174030.43917142853, 4600.885714285715, 37.62214285714286,
+    394385.36400000006, 4864.773999999999, 82.034,
+    50010.93919195402, 4860.9528735632175, 10.124712643678166,
+    61413.689994886336, 5084.672443181818, 11.99579545454547,
+    247023.97290000017, 5026.324476190477, 49.007904761904776,
+    428833.95990322577, 5080.94064516129, 84.05000000000001,
+    308182.2814917807, 4928.4547945205495, 61.168493150684945,
+    780884.49807, 5130.8, 152.417,
+    958608.5228, 4986.263999999999, 192.1304,
+    1665467.353183333, 4805.405, 346.47333333333336,
+    440949.0319526316, 4982.608684210526, 89.1752631578947,
+    760060.8074062499, 5036.630625, 151.77749999999997,
+    999642.0044525001, 5140.14825, 194.36825000000002,
+    1606334.4006184617, 5036.81815384615, 323.19323076923075,
+    26.93564999999997, 1.423750000000001, 17.605000000000004,
+    34.85405, 1.6144444444444448, 21.493888888888886,
+    4831.686709433962, 1250.489433962264, 3.8686792452830168,
+    2556.1102913043487, 1261.0495652173915, 2.026086956521738,
+    6926.442688505754, 1267.7379310344854, 5.463448275862068,
+    7060.109887076925, 1322.6786153846142, 5.161876923076931,
+    5526.638840000001, 1522.7419999999997, 3.4949999999999988,
+    3614.5702230769234, 1378.822884615385, 2.5988461538461527,
+    775.2463375000001, 1349.5887500000001, 0.5825,
+    5432.9367250000005, 1334.135, 4.077500000000001,
+    9838.212260869568, 1916.5078260869566, 4.862608695652171,
+    11869.688968888888, 2446.818, 4.763555555555553,
+    11674.378457142857, 2505.2314285714283, 4.660000000000001,
+    12194.09228, 2616.758, 4.659999999999999,
+    45498.564452941166, 4362.475882352941, 8.773529411764704,
+    29619.81965555555, 3468.832222222222, 7.249999999999998,
+    18122.213808333334, 1278.425833333334, 14.17416666666667,
+    16674.132400000002, 1278.0819999999999, 13.047999999999998,
+    14219.135666666667, 1310.796111111111, 10.873333333333331,
+    17966.72273958333, 2655.773333333333, 6.213541666666667,
+    29282.56773448276, 3946.4651724137934, 6.58862068965517,
+    27678.031166666668, 4678.384444444444, 5.9544444444444435,
+    388709.2932680002, 4568.8036, 80.73000000000002,
+    110094.49783666668, 4750.610333333334, 23.149666666666665,
+    219244.50703333333, 2904.456666666667, 52.82333333333333,
+    654418.8293199999, 4814.104, 136.10399999999998,
+    887059.4280444444, 5229.446666666667, 171.42444444444448,
+    1214539.9471590908, 4912.309545454545, 248.5218181818182,
+    1061729.6401999998, 5295.178, 200.426,
+    1060526.5239555554, 5108.874444444445, 207.16,
+    1866636.15065, 4801.586874999999, 390.94874999999996,
+    27797.665192682925, 2412.260243902439, 7.616341463414637,
+    70369.98793437499, 3849.493125, 15.730312500000004,
+    177391.1069689655, 4751.115517241378, 37.770689655172404,
+    99491.52827000001, 4765.1095000000005, 21.2065,
+    23555.1583, 3907.7775, 5.824999999999999,
+    95989.756, 4744.830000000001, 20.390625,
+    385790.46903636365, 4624.403636363637, 82.20363636363636,
+    698852.6509, 4716.626666666667, 145.26833333333335,
+    81658.52125333335, 3964.083333333333, 18.644000000000002,
+    17612.390325, 2798.955, 4.661249999999999,
+    64403.345955752215, 4904.385840707964, 13.116106194690278,
+    188534.83721650482, 4819.81359223301, 38.1933009708738,
+    56911.60031206898, 5166.862068965517, 10.928103448275866,
+    117051.58189090912, 5153.953636363637, 22.760000000000005,
+    360739.89635625004, 5207.760937499999, 69.33406249999997,
+    289677.2775615385, 5210.211923076925, 55.753461538461536,
+    571627.1086581395, 4950.236511627907, 114.68465116279073,
+    678957.0574086957, 5331.528695652174, 127.26913043478257,
+    743912.7841543476, 5062.908478260869, 146.92673913043478,
+    1031569.1653727273, 5142.958787878788, 200.71151515151516,
+    959102.3842833332, 5206.551666666667, 186.4433333333333,
+    1233746.9723268289, 5149.386341463416, 240.10365853658533,
+    1215182.9939666667, 5200.701666666667, 235.385,
+    1659533.14204, 4942.612, 340.26,
+    2121293.37955, 4690.7425, 452.1262500000001,
+    1388292.6298666669, 4914.276666666667, 281.99666666666667,
+    1778121.6363249999, 5058.38, 351.9125,
+    1678782.7226272726, 4885.669999999999, 346.19363636363636,
+    2041195.40964, 5154.763999999999, 395.262,
+};
+
+const EPS_ForestMulti eps_panel_forest_multi = {
+    .n_features = 15,
+    .n_outputs = 3,
+    .n_trees = 50,
+    .n_nodes = 2674,
+    .n_leaves = 2702,
+    .scale = 0.02,
+    .roots = panel_roots,
+    .feature = panel_feature,
+    .threshold = panel_threshold,
+    .children = panel_children,
+    .leaf_value = panel_leaf_value,
+};
@@ -0,0 +1,36 @@
+/**
+ * EPS Predictive FDIR - Power model API
+ * Generated by eps_forest_export.py from power_forest.json -- do not edit
+ *
+ * Entry points follow eps_model_abi.h; the tables are in power_model.c
+ */
+
+#ifndef EPS_MODEL_POWER_H
+#define EPS_MODEL_POWER_H
+
+#include "eps_forest.h"
+#include "eps_model_abi.h"
+#include <stdint.h>
+
+#define EPS_MODEL_POWER_ABI         1
+#define EPS_MODEL_POWER_N_FEATURES  10
+#define EPS_MODEL_POWER_HASH        0x04881C27u   // CRC-32 of power_model.bin
+
+#if EPS_MODEL_POWER_ABI != EPS_MODEL_ABI_VERSION
+#error "power_model.h was generated for another model ABI; rerun eps_forest_export.py"
+#endif
+
+uint16_t eps_model_power_n_features(void);
+uint32_t eps_model_power_hash(void);
+
+#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_FIXED
+int64_t eps_model_power_score_fixed(const int64_t *x);
+#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_FLOAT32
+float eps_model_power_score_f32(const float *x);
+void eps_model_power_score_batch_f32(const float x[][EPS_MODEL_POWER_N_FEATURES], float *out, int n);
+#else
+double eps_model_power_score(const double *x);
+void eps_model_power_score_batch(const double x[][EPS_MODEL_POWER_N_FEATURES], double *out, int n);
+#endif
+
+#endif // EPS_MODEL_POWER_H
@@ -1,9495 +1,8016 @@
-double score_voltage(double * input) {
-    double var0;
-    if (input[0] <= 2865.5399169921875) {
-        if (input[0] <= 1430.8599853515625) {
-            if (input[4] <= 1266.0250244140625) {
-                if (input[0] <= 1279.0) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[4] <= 1258.39501953125) {
-                            var0 = 1256.7373293768533;
-                        } else {
-                            var0 = 1258.7764655172425;
-                        }
-                    } else {
-                        if (input[3] <= 1256.8699951171875) {
-                            var0 = 1289.68;
-                        } else {
-                            var0 = 1262.2384905660388;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1263.7350463867188) {
-                        if (input[3] <= 1258.39501953125) {
-                            var0 = 1308.0;
-                        } else {
-                            var0 = 1297.315;
-                        }
-                    } else {
-                        if (input[4] <= 1258.39501953125) {
-                            var0 = 1289.6825000000001;
-                        } else {
-                            var0 = 1279.6119999999999;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1266.0250244140625) {
-                    if (input[0] <= 1261.4450073242188) {
-                        if (input[4] <= 1270.60498046875) {
-                            var0 = 1257.63;
-                        } else {
-                            var0 = 1265.2649999999999;
-                        }
-                    } else {
-                        if (input[3] <= 1261.4450073242188) {
-                            var0 = 4548.23;
-                        } else {
-                            var0 = 2450.548;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1312.5750122070312) {
-                        if (input[0] <= 1284.3399658203125) {
-                            var0 = 1273.2333043478272;
-                        } else {
-                            var0 = 1302.3911224489793;
-                        }
-                    } else {
-                        if (input[2] <= 1308.760009765625) {
-                            var0 = 1732.2949999999998;
-                        } else {
-                            var0 = 1338.4759375000003;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1338.5250244140625) {
-                if (input[2] <= 1337.7599487304688) {
-                    if (input[2] <= 1324.7849731445312) {
-                        if (input[3] <= 1276.7100219726562) {
-                            var0 = 3220.39;
-                        } else {
-                            var0 = 3421.86;
-                        }
-                    } else {
-                        var0 = 3922.47;
-                    }
-                } else {
-                    if (input[1] <= 1585.7749633789062) {
-                        var0 = 4681.01;
-                    } else {
-                        var0 = 4629.12;
-                    }
-                }
-            } else {
-                if (input[0] <= 1730.0049438476562) {
-                    if (input[4] <= 4603.93994140625) {
-                        if (input[4] <= 2317.614990234375) {
-                            var0 = 1600.6550000000002;
-                        } else {
-                            var0 = 1470.7983333333334;
-                        }
-                    } else {
-                        if (input[0] <= 1539.2249755859375) {
-                            var0 = 1285.1;
-                        } else {
-                            var0 = 1289.68;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4043.0399169921875) {
-                        if (input[3] <= 4368.135009765625) {
-                            var0 = 2344.0045833333334;
-                        } else {
-                            var0 = 3174.0933333333337;
-                        }
-                    } else {
-                        var0 = 1265.26;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4824.47998046875) {
-            if (input[3] <= 5158.72998046875) {
-                if (input[0] <= 4177.35498046875) {
-                    if (input[0] <= 3351.6500244140625) {
-                        if (input[2] <= 2074.93994140625) {
-                            var0 = 4681.01;
-                        } else {
-                            var0 = 3161.741428571429;
-                        }
-                    } else {
-                        if (input[1] <= 2154.3050537109375) {
-                            var0 = 5183.15;
-                        } else {
-                            var0 = 4046.2204166666666;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5240.385009765625) {
-                        if (input[0] <= 4688.64501953125) {
-                            var0 = 4569.676802325581;
-                        } else {
-                            var0 = 4745.8473;
-                        }
-                    } else {
-                        if (input[2] <= 4990.844970703125) {
-                            var0 = 3147.13;
-                        } else {
-                            var0 = 3826.31;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4672.619873046875) {
-                    if (input[3] <= 5280.070068359375) {
-                        if (input[3] <= 5227.4150390625) {
-                            var0 = 1303.42;
-                        } else {
-                            var0 = 1349.21;
-                        }
-                    } else {
-                        var0 = 1613.25;
-                    }
-                } else {
-                    var0 = 2312.27;
-                }
-            }
-        } else {
-            if (input[0] <= 5182.385009765625) {
-                if (input[0] <= 4999.235107421875) {
-                    if (input[2] <= 5075.550048828125) {
-                        if (input[3] <= 4635.989990234375) {
-                            var0 = 5144.1050000000005;
-                        } else {
-                            var0 = 4910.816826923076;
-                        }
-                    } else {
-                        if (input[3] <= 5170.175048828125) {
-                            var0 = 4400.565;
-                        } else {
-                            var0 = 4777.319;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5264.804931640625) {
-                        if (input[0] <= 5069.445068359375) {
-                            var0 = 5015.3722857142875;
-                        } else {
-                            var0 = 5100.864214285711;
-                        }
-                    } else {
-                        var0 = 4618.44;
-                    }
-                }
-            } else {
-                if (input[0] <= 5288.4599609375) {
-                    if (input[0] <= 5217.489990234375) {
-                        if (input[2] <= 5066.394775390625) {
-                            var0 = 5258.443333333334;
-                        } else {
-                            var0 = 5195.32590909091;
-                        }
-                    } else {
-                        if (input[0] <= 5256.41015625) {
-                            var0 = 5229.665238095238;
-                        } else {
-                            var0 = 5264.551111111111;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 5399.114990234375) {
-                        if (input[0] <= 5306.014892578125) {
-                            var0 = 5299.143333333333;
-                        } else {
-                            var0 = 5359.195172413793;
-                        }
-                    } else {
-                        if (input[3] <= 5397.590087890625) {
-                            var0 = 5429.2575;
-                        } else {
-                            var0 = 5400.643333333333;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var1;
-    if (input[0] <= 3078.449951171875) {
-        if (input[0] <= 1666.6649780273438) {
-            if (input[0] <= 1332.4149780273438) {
-                if (input[0] <= 1264.5) {
-                    if (input[0] <= 1258.39501953125) {
-                        if (input[0] <= 1256.8699951171875) {
-                            var1 = 1256.5224120603018;
-                        } else {
-                            var1 = 1257.4305988023964;
-                        }
-                    } else {
-                        if (input[0] <= 1261.4450073242188) {
-                            var1 = 1259.6371532846715;
-                        } else {
-                            var1 = 1262.4964062500003;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1266.0250244140625) {
-                        if (input[3] <= 1266.0250244140625) {
-                            var1 = 1504.501875;
-                        } else {
-                            var1 = 1265.26;
-                        }
-                    } else {
-                        if (input[0] <= 1296.550048828125) {
-                            var1 = 1275.1901984126994;
-                        } else {
-                            var1 = 1314.8298809523806;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 1318.6799926757812) {
-                    if (input[0] <= 1406.4400024414062) {
-                        if (input[3] <= 1379.72998046875) {
-                            var1 = 1932.2366666666667;
-                        } else {
-                            var1 = 2466.42;
-                        }
-                    } else {
-                        if (input[3] <= 1295.0250244140625) {
-                            var1 = 3321.125;
-                        } else {
-                            var1 = 3644.69;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1592.64501953125) {
-                        if (input[2] <= 3037.239990234375) {
-                            var1 = 1412.546428571429;
-                        } else {
-                            var1 = 1311.658;
-                        }
-                    } else {
-                        var1 = 1891.03;
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1501.8300170898438) {
-                if (input[0] <= 2197.0399780273438) {
-                    if (input[3] <= 1284.3400268554688) {
-                        var1 = 4681.01;
-                    } else {
-                        var1 = 5170.94;
-                    }
-                } else {
-                    var1 = 3922.47;
-                }
-            } else {
-                if (input[4] <= 4969.47509765625) {
-                    if (input[0] <= 2560.2900390625) {
-                        if (input[2] <= 2061.2050170898438) {
-                            var1 = 2388.582;
-                        } else {
-                            var1 = 1633.6625;
-                        }
-                    } else {
-                        if (input[0] <= 3031.135009765625) {
-                            var1 = 3027.065;
-                        } else {
-                            var1 = 2558.0;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 2284.0350341796875) {
-                        if (input[2] <= 2864.7750244140625) {
-                            var1 = 3821.73;
-                        } else {
-                            var1 = 3444.75;
-                        }
-                    } else {
-                        var1 = 2255.8;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4892.400146484375) {
-            if (input[3] <= 5154.9150390625) {
-                if (input[0] <= 4530.675048828125) {
-                    if (input[4] <= 1526.25) {
-                        if (input[1] <= 4513.125) {
-                            var1 = 1491.15;
-                        } else {
-                            var1 = 1393.47;
-                        }
-                    } else {
-                        if (input[0] <= 3771.364990234375) {
-                            var1 = 3466.1184210526317;
-                        } else {
-                            var1 = 4393.384181818183;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4734.43505859375) {
-                        if (input[3] <= 4718.405029296875) {
-                            var1 = 4628.392810457514;
-                        } else {
-                            var1 = 4399.192;
-                        }
-                    } else {
-                        if (input[0] <= 4787.849853515625) {
-                            var1 = 4780.162962962962;
-                        } else {
-                            var1 = 4870.897936507936;
-                        }
-                    }
-                }
-            } else {
-                if (input[4] <= 5217.4951171875) {
-                    if (input[1] <= 4921.39501953125) {
-                        if (input[0] <= 4423.83984375) {
-                            var1 = 1349.21;
-                        } else {
-                            var1 = 1286.63;
-                        }
-                    } else {
-                        if (input[3] <= 5243.440185546875) {
-                            var1 = 1465.2;
-                        } else {
-                            var1 = 1613.25;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5195.360107421875) {
-                        if (input[3] <= 5186.965087890625) {
-                            var1 = 2917.886;
-                        } else {
-                            var1 = 1280.53;
-                        }
-                    } else {
-                        var1 = 4948.11;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5182.385009765625) {
-                if (input[0] <= 5048.074951171875) {
-                    if (input[3] <= 5219.02001953125) {
-                        if (input[3] <= 5144.994873046875) {
-                            var1 = 4990.294444444446;
-                        } else {
-                            var1 = 4857.782727272728;
-                        }
-                    } else {
-                        if (input[2] <= 5138.125) {
-                            var1 = 4600.12;
-                        } else {
-                            var1 = 4494.81;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 3008.2400512695312) {
-                        var1 = 4496.34;
-                    } else {
-                        if (input[2] <= 5248.02001953125) {
-                            var1 = 5104.900328947371;
-                        } else {
-                            var1 = 4618.44;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5289.22509765625) {
-                    if (input[0] <= 5204.51513671875) {
-                        if (input[3] <= 5238.094970703125) {
-                            var1 = 5179.8890909090915;
-                        } else {
-                            var1 = 5083.5625;
-                        }
-                    } else {
-                        if (input[0] <= 5222.8349609375) {
-                            var1 = 5206.436285714286;
-                        } else {
-                            var1 = 5237.892399999998;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5340.35498046875) {
-                        if (input[3] <= 5308.30517578125) {
-                            var1 = 5330.69;
-                        } else {
-                            var1 = 5298.4914285714285;
-                        }
-                    } else {
-                        if (input[2] <= 5396.824951171875) {
-                            var1 = 5365.894666666666;
-                        } else {
-                            var1 = 5410.5633333333335;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var2;
-    if (input[0] <= 1816.239990234375) {
-        if (input[0] <= 627.2899780273438) {
-            var2 = 5024.42;
-        } else {
-            if (input[0] <= 1425.52001953125) {
-                if (input[0] <= 1332.4149780273438) {
-                    if (input[4] <= 1266.0250244140625) {
-                        if (input[0] <= 1279.0) {
-                            var2 = 1258.4505584642238;
-                        } else {
-                            var2 = 1288.921;
-                        }
-                    } else {
-                        if (input[3] <= 1259.9199829101562) {
-                            var2 = 2907.51;
-                        } else {
-                            var2 = 1296.4139751552805;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 1304.1799926757812) {
-                        if (input[2] <= 1285.864990234375) {
-                            var2 = 2466.42;
-                        } else {
-                            var2 = 2052.81;
-                        }
-                    } else {
-                        if (input[3] <= 1299.60498046875) {
-                            var2 = 1704.82;
-                        } else {
-                            var2 = 1370.2100000000003;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1340.050048828125) {
-                    if (input[2] <= 1291.9700317382812) {
-                        var2 = 3644.69;
-                    } else {
-                        var2 = 3421.86;
-                    }
-                } else {
-                    if (input[0] <= 1512.5150146484375) {
-                        if (input[4] <= 2193.989990234375) {
-                            var2 = 1514.8025;
-                        } else {
-                            var2 = 1407.01125;
-                        }
-                    } else {
-                        if (input[1] <= 1619.3499755859375) {
-                            var2 = 1823.1100000000001;
-                        } else {
-                            var2 = 1513.0266666666666;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4775.639892578125) {
-            if (input[3] <= 5154.9150390625) {
-                if (input[0] <= 3736.2650146484375) {
-                    if (input[2] <= 2062.7249755859375) {
-                        if (input[3] <= 3005.9498901367188) {
-                            var2 = 4884.77;
-                        } else {
-                            var2 = 4049.15;
-                        }
-                    } else {
-                        if (input[1] <= 4271.21484375) {
-                            var2 = 3271.966250000001;
-                        } else {
-                            var2 = 2216.1150000000002;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4297.159912109375) {
-                        if (input[0] <= 4272.739990234375) {
-                            var2 = 4206.0445;
-                        } else {
-                            var2 = 1393.47;
-                        }
-                    } else {
-                        if (input[0] <= 4688.64501953125) {
-                            var2 = 4557.141813471502;
-                        } else {
-                            var2 = 4731.717012987015;
-                        }
-                    }
-                }
-            } else {
-                if (input[4] <= 5245.724853515625) {
-                    if (input[1] <= 4892.39990234375) {
-                        if (input[1] <= 4803.8798828125) {
-                            var2 = 1303.42;
-                        } else {
-                            var2 = 1280.53;
-                        }
-                    } else {
-                        if (input[1] <= 5000.0) {
-                            var2 = 1465.2;
-                        } else {
-                            var2 = 1613.25;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4877.14013671875) {
-                        var2 = 2312.27;
-                    } else {
-                        var2 = 3147.13;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5070.969970703125) {
-                if (input[3] <= 5156.440185546875) {
-                    if (input[0] <= 4905.369873046875) {
-                        if (input[4] <= 5223.594970703125) {
-                            var2 = 4876.624246575341;
-                        } else {
-                            var2 = 4183.46;
-                        }
-                    } else {
-                        if (input[3] <= 4775.639892578125) {
-                            var2 = 5114.775333333333;
-                        } else {
-                            var2 = 4985.06101010101;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4970.239990234375) {
-                        if (input[1] <= 4960.31494140625) {
-                            var2 = 3553.6233333333334;
-                        } else {
-                            var2 = 2991.45;
-                        }
-                    } else {
-                        if (input[3] <= 5260.989990234375) {
-                            var2 = 4710.359090909092;
-                        } else {
-                            var2 = 3992.67;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5257.175048828125) {
-                    if (input[0] <= 5181.625) {
-                        if (input[2] <= 5245.72998046875) {
-                            var2 = 5106.709915966388;
-                        } else {
-                            var2 = 4618.44;
-                        }
-                    } else {
-                        if (input[0] <= 5217.489990234375) {
-                            var2 = 5177.212;
-                        } else {
-                            var2 = 5223.661355932204;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5340.35498046875) {
-                        if (input[0] <= 5306.014892578125) {
-                            var2 = 5289.3772;
-                        } else {
-                            var2 = 5337.8116666666665;
-                        }
-                    } else {
-                        if (input[2] <= 5399.114990234375) {
-                            var2 = 5381.3725;
-                        } else {
-                            var2 = 5405.011363636363;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var3;
-    if (input[0] <= 2847.219970703125) {
-        if (input[0] <= 1659.0349731445312) {
-            if (input[0] <= 1370.5750122070312) {
-                if (input[0] <= 1264.5) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[0] <= 1258.39501953125) {
-                            var3 = 1256.9700261780104;
-                        } else {
-                            var3 = 1258.9846835443047;
-                        }
-                    } else {
-                        if (input[2] <= 1258.39501953125) {
-                            var3 = 1289.68;
-                        } else {
-                            var3 = 1261.460740740741;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1266.0250244140625) {
-                        if (input[4] <= 1267.5549926757812) {
-                            var3 = 1651.7849999999999;
-                        } else {
-                            var3 = 4674.91;
-                        }
-                    } else {
-                        if (input[2] <= 1266.0250244140625) {
-                            var3 = 843.5066666666667;
-                        } else {
-                            var3 = 1288.1479204892967;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 1350.7349853515625) {
-                    if (input[1] <= 1324.7849731445312) {
-                        var3 = 1927.66;
-                    } else {
-                        if (input[2] <= 1291.9700317382812) {
-                            var3 = 3644.69;
-                        } else {
-                            var3 = 3421.86;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1493.4400024414062) {
-                        if (input[0] <= 1495.7250366210938) {
-                            var3 = 1463.5363636363636;
-                        } else {
-                            var3 = 1691.85;
-                        }
-                    } else {
-                        if (input[2] <= 3043.3450927734375) {
-                            var3 = 1413.8183333333334;
-                        } else {
-                            var3 = 1312.268;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1454.5150146484375) {
-                if (input[2] <= 1344.625) {
-                    var3 = 5170.94;
-                } else {
-                    var3 = 4681.01;
-                }
-            } else {
-                if (input[0] <= 2377.135009765625) {
-                    if (input[0] <= 2131.4100341796875) {
-                        if (input[3] <= 2139.0449829101562) {
-                            var3 = 2040.6;
-                        } else {
-                            var3 = 1630.8;
-                        }
-                    } else {
-                        if (input[4] <= 2792.280029296875) {
-                            var3 = 2442.0;
-                        } else {
-                            var3 = 2168.8050000000003;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 1454.52001953125) {
-                        var3 = 2683.15;
-                    } else {
-                        if (input[2] <= 2378.6600341796875) {
-                            var3 = 2800.67;
-                        } else {
-                            var3 = 2916.67;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4822.190185546875) {
-            if (input[3] <= 5158.72998046875) {
-                if (input[0] <= 4087.300048828125) {
-                    if (input[0] <= 3321.8900146484375) {
-                        if (input[3] <= 2502.2900390625) {
-                            var3 = 3221.92;
-                        } else {
-                            var3 = 3373.02;
-                        }
-                    } else {
-                        if (input[2] <= 1455.2799682617188) {
-                            var3 = 5183.15;
-                        } else {
-                            var3 = 3998.34380952381;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5154.9150390625) {
-                        if (input[0] <= 4639.039794921875) {
-                            var3 = 4565.754620689654;
-                        } else {
-                            var3 = 4731.792364864865;
-                        }
-                    } else {
-                        if (input[1] <= 4916.820068359375) {
-                            var3 = 3147.13;
-                        } else {
-                            var3 = 3826.31;
-                        }
-                    }
-                }
-            } else {
-                if (input[4] <= 5245.724853515625) {
-                    if (input[1] <= 4841.27001953125) {
-                        if (input[1] <= 4685.594970703125) {
-                            var3 = 1349.21;
-                        } else {
-                            var3 = 1303.42;
-                        }
-                    } else {
-                        if (input[2] <= 5088.52001953125) {
-                            var3 = 1465.2;
-                        } else {
-                            var3 = 1613.25;
-                        }
-                    }
-                } else {
-                    var3 = 2312.27;
-                }
-            }
-        } else {
-            if (input[0] <= 5070.969970703125) {
-                if (input[3] <= 5162.545166015625) {
-                    if (input[3] <= 4757.324951171875) {
-                        if (input[3] <= 4442.919921875) {
-                            var3 = 5219.78;
-                        } else {
-                            var3 = 5108.976000000001;
-                        }
-                    } else {
-                        if (input[0] <= 4905.369873046875) {
-                            var3 = 4870.315538461539;
-                        } else {
-                            var3 = 4993.982884615383;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4897.7451171875) {
-                        var3 = 2991.45;
-                    } else {
-                        if (input[0] <= 5069.445068359375) {
-                            var3 = 4743.382272727273;
-                        } else {
-                            var3 = 3992.67;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5182.385009765625) {
-                    if (input[1] <= 3208.9400024414062) {
-                        var3 = 4496.34;
-                    } else {
-                        if (input[3] <= 5090.050048828125) {
-                            var3 = 5157.673333333333;
-                        } else {
-                            var3 = 5095.424456521737;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5291.514892578125) {
-                        if (input[4] <= 5162.545166015625) {
-                            var3 = 5204.918625;
-                        } else {
-                            var3 = 5239.889803921567;
-                        }
-                    } else {
-                        if (input[0] <= 5309.829833984375) {
-                            var3 = 5297.2375;
-                        } else {
-                            var3 = 5376.203777777778;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var4;
-    if (input[0] <= 1841.4249877929688) {
-        if (input[0] <= 627.2899780273438) {
-            var4 = 5024.42;
-        } else {
-            if (input[0] <= 1430.8599853515625) {
-                if (input[4] <= 1266.0250244140625) {
-                    if (input[0] <= 1266.0250244140625) {
-                        if (input[0] <= 1259.9200439453125) {
-                            var4 = 1257.3598689956334;
-                        } else {
-                            var4 = 1261.5939495798314;
-                        }
-                    } else {
-                        if (input[4] <= 1256.8699951171875) {
-                            var4 = 1294.0933333333332;
-                        } else {
-                            var4 = 1271.2592857142856;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1266.0250244140625) {
-                        if (input[0] <= 1266.0250244140625) {
-                            var4 = 1513.635333333333;
-                        } else {
-                            var4 = 4674.91;
-                        }
-                    } else {
-                        if (input[0] <= 1333.1799926757812) {
-                            var4 = 1281.3934650455935;
-                        } else {
-                            var4 = 1464.8360000000002;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 1393.469970703125) {
-                    if (input[2] <= 1317.9199829101562) {
-                        if (input[4] <= 4809.97998046875) {
-                            var4 = 3421.86;
-                        } else {
-                            var4 = 3644.69;
-                        }
-                    } else {
-                        var4 = 4629.12;
-                    }
-                } else {
-                    if (input[3] <= 1584.25) {
-                        if (input[2] <= 1495.7250366210938) {
-                            var4 = 1660.3066666666666;
-                        } else {
-                            var4 = 1990.743333333333;
-                        }
-                    } else {
-                        if (input[3] <= 3992.6749267578125) {
-                            var4 = 1463.2949999999998;
-                        } else {
-                            var4 = 1330.38;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4498.6298828125) {
-            if (input[0] <= 3530.97998046875) {
-                if (input[1] <= 1992.5199584960938) {
-                    if (input[0] <= 2154.3050537109375) {
-                        if (input[0] <= 1990.2350463867188) {
-                            var4 = 4681.01;
-                        } else {
-                            var4 = 4952.69;
-                        }
-                    } else {
-                        if (input[1] <= 1708.6349487304688) {
-                            var4 = 3922.47;
-                        } else {
-                            var4 = 3821.73;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 2865.5399169921875) {
-                        if (input[0] <= 2062.7249755859375) {
-                            var4 = 3444.75;
-                        } else {
-                            var4 = 2205.6237499999997;
-                        }
-                    } else {
-                        if (input[4] <= 4781.75) {
-                            var4 = 3250.289411764705;
-                        } else {
-                            var4 = 3823.263333333334;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 5078.60009765625) {
-                    if (input[0] <= 3936.2049560546875) {
-                        if (input[1] <= 3812.5799560546875) {
-                            var4 = 4025.4900000000002;
-                        } else {
-                            var4 = 3396.67;
-                        }
-                    } else {
-                        if (input[0] <= 4303.264892578125) {
-                            var4 = 4185.796666666667;
-                        } else {
-                            var4 = 4442.794;
-                        }
-                    }
-                } else {
-                    var4 = 1280.53;
-                }
-            }
-        } else {
-            if (input[0] <= 4914.530029296875) {
-                if (input[4] <= 5241.909912109375) {
-                    if (input[4] <= 5220.545166015625) {
-                        if (input[0] <= 4709.25) {
-                            var4 = 4615.197660818713;
-                        } else {
-                            var4 = 4832.288347107437;
-                        }
-                    } else {
-                        if (input[1] <= 4970.239990234375) {
-                            var4 = 3806.2166666666667;
-                        } else {
-                            var4 = 4948.11;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5245.724853515625) {
-                        var4 = 1303.42;
-                    } else {
-                        if (input[1] <= 4877.14013671875) {
-                            var4 = 2312.27;
-                        } else {
-                            var4 = 3147.13;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5184.675048828125) {
-                    if (input[0] <= 5070.969970703125) {
-                        if (input[3] <= 5141.94482421875) {
-                            var4 = 5005.439;
-                        } else {
-                            var4 = 4770.6647826086955;
-                        }
-                    } else {
-                        if (input[2] <= 3008.2400512695312) {
-                            var4 = 4496.34;
-                        } else {
-                            var4 = 5106.009448818896;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 5309.829833984375) {
-                        if (input[0] <= 5217.489990234375) {
-                            var4 = 5178.902826086955;
-                        } else {
-                            var4 = 5246.646410256409;
-                        }
-                    } else {
-                        if (input[1] <= 5355.614990234375) {
-                            var4 = 5338.826666666667;
-                        } else {
-                            var4 = 5395.9;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var5;
-    if (input[0] <= 3099.054931640625) {
-        if (input[0] <= 1666.6649780273438) {
-            if (input[0] <= 627.2899780273438) {
-                var5 = 5024.42;
-            } else {
-                if (input[0] <= 1469.7799682617188) {
-                    if (input[4] <= 1270.60498046875) {
-                        if (input[4] <= 1266.0250244140625) {
-                            var5 = 1259.4202080000007;
-                        } else {
-                            var5 = 1235.0268918918916;
-                        }
-                    } else {
-                        if (input[3] <= 1266.7899780273438) {
-                            var5 = 2470.748333333333;
-                        } else {
-                            var5 = 1292.895730337079;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 4423.074951171875) {
-                        if (input[0] <= 1592.64501953125) {
-                            var5 = 1521.367;
-                        } else {
-                            var5 = 1891.03;
-                        }
-                    } else {
-                        var5 = 3644.69;
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1403.3900146484375) {
-                if (input[2] <= 1337.7599487304688) {
-                    var5 = 3922.47;
-                } else {
-                    if (input[2] <= 1358.364990234375) {
-                        var5 = 4629.12;
-                    } else {
-                        var5 = 4681.01;
-                    }
-                }
-            } else {
-                if (input[4] <= 2799.9100341796875) {
-                    if (input[0] <= 2499.2349853515625) {
-                        if (input[3] <= 1567.4600219726562) {
-                            var5 = 2315.32;
-                        } else {
-                            var5 = 2562.58;
-                        }
-                    } else {
-                        if (input[0] <= 2799.909912109375) {
-                            var5 = 2916.67;
-                        } else {
-                            var5 = 3183.2533333333336;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 4973.2900390625) {
-                        if (input[0] <= 2453.449951171875) {
-                            var5 = 1571.785;
-                        } else {
-                            var5 = 2177.5271428571427;
-                        }
-                    } else {
-                        var5 = 3444.75;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4893.1650390625) {
-            if (input[3] <= 5168.650146484375) {
-                if (input[0] <= 4303.264892578125) {
-                    if (input[4] <= 1594.1700439453125) {
-                        var5 = 1393.47;
-                    } else {
-                        if (input[0] <= 3578.294921875) {
-                            var5 = 3518.9836363636364;
-                        } else {
-                            var5 = 4086.4704545454547;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4690.93505859375) {
-                        if (input[0] <= 4685.594970703125) {
-                            var5 = 4592.990967741935;
-                        } else {
-                            var5 = 3906.6949999999997;
-                        }
-                    } else {
-                        if (input[4] <= 5223.594970703125) {
-                            var5 = 4796.139166666664;
-                        } else {
-                            var5 = 4004.885;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4822.195068359375) {
-                    if (input[2] <= 4993.130126953125) {
-                        var5 = 1303.42;
-                    } else {
-                        var5 = 1465.2;
-                    }
-                } else {
-                    var5 = 2991.45;
-                }
-            }
-        } else {
-            if (input[0] <= 5125.9150390625) {
-                if (input[3] <= 5146.52001953125) {
-                    if (input[1] <= 5001.525146484375) {
-                        if (input[3] <= 4775.639892578125) {
-                            var5 = 5075.397999999999;
-                        } else {
-                            var5 = 4945.957346938777;
-                        }
-                    } else {
-                        if (input[0] <= 5083.18017578125) {
-                            var5 = 5049.429142857143;
-                        } else {
-                            var5 = 5122.143333333334;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 5075.550048828125) {
-                        if (input[4] <= 5207.5751953125) {
-                            var5 = 4665.241666666666;
-                        } else {
-                            var5 = 4923.6849999999995;
-                        }
-                    } else {
-                        if (input[4] <= 4676.429931640625) {
-                            var5 = 4663.21;
-                        } else {
-                            var5 = 4936.885882352941;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5267.85498046875) {
-                    if (input[0] <= 5182.385009765625) {
-                        if (input[2] <= 5032.050048828125) {
-                            var5 = 5228.327;
-                        } else {
-                            var5 = 5126.087014925374;
-                        }
-                    } else {
-                        if (input[0] <= 5214.440185546875) {
-                            var5 = 5187.858857142858;
-                        } else {
-                            var5 = 5229.239242424243;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5340.35498046875) {
-                        if (input[0] <= 5290.75) {
-                            var5 = 5268.745833333333;
-                        } else {
-                            var5 = 5309.321333333334;
-                        }
-                    } else {
-                        if (input[2] <= 5399.114990234375) {
-                            var5 = 5375.458125;
-                        } else {
-                            var5 = 5408.577;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var6;
-    if (input[0] <= 2865.5399169921875) {
-        if (input[0] <= 627.2899780273438) {
-            var6 = 5024.42;
-        } else {
-            if (input[0] <= 1430.8599853515625) {
-                if (input[4] <= 1266.0250244140625) {
-                    if (input[0] <= 1282.050048828125) {
-                        if (input[0] <= 1259.9200439453125) {
-                            var6 = 1257.3765145228206;
-                        } else {
-                            var6 = 1263.1875000000002;
-                        }
-                    } else {
-                        if (input[2] <= 1294.260009765625) {
-                            var6 = 1304.336;
-                        } else {
-                            var6 = 1289.6825000000003;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1266.0250244140625) {
-                        if (input[0] <= 1266.0250244140625) {
-                            var6 = 1637.9730000000002;
-                        } else {
-                            var6 = 4611.57;
-                        }
-                    } else {
-                        if (input[0] <= 1333.1799926757812) {
-                            var6 = 1281.5686024844733;
-                        } else {
-                            var6 = 1495.0836842105266;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1345.3900146484375) {
-                    if (input[2] <= 1317.9199829101562) {
-                        if (input[4] <= 4809.97998046875) {
-                            var6 = 3421.86;
-                        } else {
-                            var6 = 3644.69;
-                        }
-                    } else {
-                        var6 = 4629.12;
-                    }
-                } else {
-                    if (input[2] <= 2293.9549560546875) {
-                        if (input[0] <= 1498.780029296875) {
-                            var6 = 1488.398;
-                        } else {
-                            var6 = 1668.005;
-                        }
-                    } else {
-                        if (input[1] <= 2377.135009765625) {
-                            var6 = 3696.0699999999997;
-                        } else {
-                            var6 = 2247.2292307692305;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4893.1650390625) {
-            if (input[3] <= 5168.650146484375) {
-                if (input[0] <= 4087.300048828125) {
-                    if (input[2] <= 2574.784912109375) {
-                        if (input[2] <= 1452.22998046875) {
-                            var6 = 5183.15;
-                        } else {
-                            var6 = 4317.509999999999;
-                        }
-                    } else {
-                        if (input[0] <= 3308.9149169921875) {
-                            var6 = 3096.984285714286;
-                        } else {
-                            var6 = 3853.3370588235293;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4775.639892578125) {
-                        if (input[3] <= 5141.18017578125) {
-                            var6 = 4596.038819188189;
-                        } else {
-                            var6 = 3147.13;
-                        }
-                    } else {
-                        if (input[3] <= 5145.755126953125) {
-                            var6 = 4885.206499999999;
-                        } else {
-                            var6 = 3826.31;
-                        }
-                    }
-                }
-            } else {
-                if (input[4] <= 5216.72998046875) {
-                    if (input[3] <= 5213.68017578125) {
-                        var6 = 1465.2;
-                    } else {
-                        if (input[2] <= 5069.445068359375) {
-                            var6 = 1286.63;
-                        } else {
-                            var6 = 1349.21;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5194.60009765625) {
-                        var6 = 2991.45;
-                    } else {
-                        var6 = 3417.28;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5127.445068359375) {
-                if (input[3] <= 5165.594970703125) {
-                    if (input[0] <= 5048.074951171875) {
-                        if (input[3] <= 4830.5849609375) {
-                            var6 = 5119.189090909091;
-                        } else {
-                            var6 = 4962.104605263156;
-                        }
-                    } else {
-                        if (input[0] <= 5083.945068359375) {
-                            var6 = 5070.781000000001;
-                        } else {
-                            var6 = 5118.442857142855;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5281.594970703125) {
-                        if (input[1] <= 5092.340087890625) {
-                            var6 = 4673.38125;
-                        } else {
-                            var6 = 4919.491666666667;
-                        }
-                    } else {
-                        var6 = 3992.67;
-                    }
-                }
-            } else {
-                if (input[0] <= 5276.2548828125) {
-                    if (input[0] <= 5204.51513671875) {
-                        if (input[3] <= 5235.0400390625) {
-                            var6 = 5160.577236842104;
-                        } else {
-                            var6 = 5073.259333333333;
-                        }
-                    } else {
-                        if (input[1] <= 5282.35498046875) {
-                            var6 = 5222.885689655172;
-                        } else {
-                            var6 = 5120.57;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5337.30517578125) {
-                        if (input[4] <= 3250.1500244140625) {
-                            var6 = 5257.5575;
-                        } else {
-                            var6 = 5299.8629411764705;
-                        }
-                    } else {
-                        if (input[2] <= 5367.824951171875) {
-                            var6 = 5350.482727272727;
-                        } else {
-                            var6 = 5393.555714285714;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var7;
-    if (input[0] <= 2799.909912109375) {
-        if (input[0] <= 1666.6649780273438) {
-            if (input[0] <= 627.2899780273438) {
-                var7 = 5024.42;
-            } else {
-                if (input[0] <= 1433.9149780273438) {
-                    if (input[4] <= 1266.0250244140625) {
-                        if (input[0] <= 1279.0) {
-                            var7 = 1258.2884793388425;
-                        } else {
-                            var7 = 1290.4466666666667;
-                        }
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var7 = 2270.2988888888885;
-                        } else {
-                            var7 = 1302.3427914110432;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 1410.2550048828125) {
-                        if (input[3] <= 1276.7100219726562) {
-                            var7 = 3220.39;
-                        } else {
-                            var7 = 3421.86;
-                        }
-                    } else {
-                        if (input[0] <= 1620.8800048828125) {
-                            var7 = 1423.0746666666669;
-                        } else {
-                            var7 = 1891.03;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[4] <= 1333.1800537109375) {
-                if (input[2] <= 1338.5249633789062) {
-                    if (input[0] <= 1878.8150024414062) {
-                        var7 = 5170.94;
-                    } else {
-                        var7 = 4952.69;
-                    }
-                } else {
-                    var7 = 4629.12;
-                }
-            } else {
-                if (input[4] <= 4690.175048828125) {
-                    if (input[4] <= 2728.175048828125) {
-                        if (input[3] <= 1691.8499755859375) {
-                            var7 = 2360.5;
-                        } else {
-                            var7 = 2846.766;
-                        }
-                    } else {
-                        if (input[0] <= 2178.7249755859375) {
-                            var7 = 1606.1266666666668;
-                        } else {
-                            var7 = 2081.81;
-                        }
-                    }
-                } else {
-                    var7 = 3821.73;
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4858.059814453125) {
-            if (input[3] <= 5154.9150390625) {
-                if (input[0] <= 3985.0450439453125) {
-                    if (input[1] <= 2633.544921875) {
-                        if (input[0] <= 3433.3050537109375) {
-                            var7 = 4881.866;
-                        } else {
-                            var7 = 4099.003333333333;
-                        }
-                    } else {
-                        if (input[1] <= 4388.73486328125) {
-                            var7 = 3454.3843750000005;
-                        } else {
-                            var7 = 1944.44;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4582.570068359375) {
-                        if (input[4] <= 1379.72998046875) {
-                            var7 = 3089.135;
-                        } else {
-                            var7 = 4511.487247706421;
-                        }
-                    } else {
-                        if (input[3] <= 4523.044921875) {
-                            var7 = 4926.570740740741;
-                        } else {
-                            var7 = 4689.799558011047;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4696.27490234375) {
-                    if (input[4] <= 5067.919921875) {
-                        var7 = 1613.25;
-                    } else {
-                        if (input[0] <= 4243.739990234375) {
-                            var7 = 1349.21;
-                        } else {
-                            var7 = 1280.53;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5211.39013671875) {
-                        if (input[4] <= 5238.860107421875) {
-                            var7 = 4948.11;
-                        } else {
-                            var7 = 3147.13;
-                        }
-                    } else {
-                        var7 = 1286.63;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5073.260009765625) {
-                if (input[3] <= 5256.41015625) {
-                    if (input[3] <= 5131.260009765625) {
-                        if (input[0] <= 4938.18505859375) {
-                            var7 = 4889.200192307692;
-                        } else {
-                            var7 = 5030.120408163265;
-                        }
-                    } else {
-                        if (input[4] <= 5199.18017578125) {
-                            var7 = 4754.655;
-                        } else {
-                            var7 = 4888.58375;
-                        }
-                    }
-                } else {
-                    var7 = 3992.67;
-                }
-            } else {
-                if (input[0] <= 5276.2548828125) {
-                    if (input[0] <= 5182.385009765625) {
-                        if (input[3] <= 5264.804931640625) {
-                            var7 = 5120.325581395347;
-                        } else {
-                            var7 = 4618.44;
-                        }
-                    } else {
-                        if (input[0] <= 5204.51513671875) {
-                            var7 = 5175.2136;
-                        } else {
-                            var7 = 5222.356125;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5340.35498046875) {
-                        if (input[0] <= 5289.98486328125) {
-                            var7 = 5269.978888888889;
-                        } else {
-                            var7 = 5310.339166666668;
-                        }
-                    } else {
-                        if (input[2] <= 5399.114990234375) {
-                            var7 = 5363.338235294118;
-                        } else {
-                            var7 = 5408.317647058823;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var8;
-    if (input[0] <= 3419.570068359375) {
-        if (input[0] <= 1666.6649780273438) {
-            if (input[0] <= 1333.1799926757812) {
-                if (input[4] <= 1266.0250244140625) {
-                    if (input[0] <= 1279.0) {
-                        if (input[0] <= 1259.9200439453125) {
-                            var8 = 1257.2904845814971;
-                        } else {
-                            var8 = 1262.2096330275238;
-                        }
-                    } else {
-                        if (input[2] <= 1278.2350463867188) {
-                            var8 = 1304.565;
-                        } else {
-                            var8 = 1283.325;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1266.0250244140625) {
-                        if (input[0] <= 1266.0250244140625) {
-                            var8 = 1797.4885714285713;
-                        } else {
-                            var8 = 4611.57;
-                        }
-                    } else {
-                        if (input[0] <= 1288.9200439453125) {
-                            var8 = 1274.1061904761912;
-                        } else {
-                            var8 = 1315.8281159420287;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 1300.364990234375) {
-                    if (input[2] <= 1290.4450073242188) {
-                        if (input[3] <= 1374.3899536132812) {
-                            var8 = 2052.81;
-                        } else {
-                            var8 = 2466.42;
-                        }
-                    } else {
-                        var8 = 3421.86;
-                    }
-                } else {
-                    if (input[0] <= 1592.64501953125) {
-                        if (input[3] <= 1299.60498046875) {
-                            var8 = 1704.82;
-                        } else {
-                            var8 = 1390.601212121212;
-                        }
-                    } else {
-                        var8 = 1891.03;
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1437.72998046875) {
-                if (input[3] <= 1298.8400268554688) {
-                    var8 = 5170.94;
-                } else {
-                    var8 = 4629.12;
-                }
-            } else {
-                if (input[0] <= 2679.3349609375) {
-                    if (input[3] <= 4291.820068359375) {
-                        if (input[3] <= 2284.7999267578125) {
-                            var8 = 2370.7766666666666;
-                        } else {
-                            var8 = 1864.9122222222222;
-                        }
-                    } else {
-                        if (input[0] <= 2284.0350341796875) {
-                            var8 = 3538.995;
-                        } else {
-                            var8 = 2255.8;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5108.364990234375) {
-                        if (input[3] <= 2681.625) {
-                            var8 = 3112.7883333333334;
-                        } else {
-                            var8 = 3726.3433333333337;
-                        }
-                    } else {
-                        var8 = 1944.44;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4857.294921875) {
-            if (input[3] <= 5154.9150390625) {
-                if (input[0] <= 4297.159912109375) {
-                    if (input[0] <= 4252.135009765625) {
-                        if (input[4] <= 1797.925048828125) {
-                            var8 = 5183.15;
-                        } else {
-                            var8 = 4054.8062499999996;
-                        }
-                    } else {
-                        var8 = 1393.47;
-                    }
-                } else {
-                    if (input[0] <= 4688.64501953125) {
-                        if (input[2] <= 4698.56494140625) {
-                            var8 = 4564.043734939759;
-                        } else {
-                            var8 = 4050.452142857143;
-                        }
-                    } else {
-                        if (input[0] <= 4787.849853515625) {
-                            var8 = 4713.475897435896;
-                        } else {
-                            var8 = 4862.418095238095;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4750.454833984375) {
-                    if (input[0] <= 4672.619873046875) {
-                        if (input[4] <= 5090.81494140625) {
-                            var8 = 1613.25;
-                        } else {
-                            var8 = 1288.16;
-                        }
-                    } else {
-                        var8 = 2312.27;
-                    }
-                } else {
-                    if (input[4] <= 5192.30517578125) {
-                        var8 = 1286.63;
-                    } else {
-                        if (input[2] <= 5058.764892578125) {
-                            var8 = 3373.523333333333;
-                        } else {
-                            var8 = 4948.11;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5181.625) {
-                if (input[3] <= 5268.6201171875) {
-                    if (input[0] <= 4999.239990234375) {
-                        if (input[3] <= 5219.02001953125) {
-                            var8 = 4919.797741935485;
-                        } else {
-                            var8 = 4547.465;
-                        }
-                    } else {
-                        if (input[1] <= 3172.3098754882812) {
-                            var8 = 4496.34;
-                        } else {
-                            var8 = 5073.779350000001;
-                        }
-                    }
-                } else {
-                    var8 = 3992.67;
-                }
-            } else {
-                if (input[0] <= 5288.4599609375) {
-                    if (input[0] <= 5204.51513671875) {
-                        if (input[3] <= 5199.940185546875) {
-                            var8 = 5212.427272727273;
-                        } else {
-                            var8 = 5140.306428571428;
-                        }
-                    } else {
-                        if (input[0] <= 5254.885009765625) {
-                            var8 = 5221.251097560977;
-                        } else {
-                            var8 = 5260.926666666666;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5358.670166015625) {
-                        if (input[0] <= 5309.829833984375) {
-                            var8 = 5306.5216666666665;
-                        } else {
-                            var8 = 5340.481666666667;
-                        }
-                    } else {
-                        if (input[2] <= 5399.114990234375) {
-                            var8 = 5371.023333333334;
-                        } else {
-                            var8 = 5400.642;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var9;
-    if (input[0] <= 2407.659912109375) {
-        if (input[0] <= 1465.9649658203125) {
-            if (input[4] <= 1266.0250244140625) {
-                if (input[0] <= 1266.0250244140625) {
-                    if (input[0] <= 1258.39501953125) {
-                        if (input[3] <= 1256.8699951171875) {
-                            var9 = 1256.3896932515336;
-                        } else {
-                            var9 = 1257.3882474226814;
-                        }
-                    } else {
-                        if (input[1] <= 1261.4450073242188) {
-                            var9 = 1259.4694890510948;
-                        } else {
-                            var9 = 1262.577407407407;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 1295.0249633789062) {
-                        if (input[1] <= 1262.2100219726562) {
-                            var9 = 1306.47;
-                        } else {
-                            var9 = 1275.2353333333333;
-                        }
-                    } else {
-                        if (input[0] <= 1299.6050415039062) {
-                            var9 = 1289.68;
-                        } else {
-                            var9 = 1295.79;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1261.4450073242188) {
-                    if (input[1] <= 1262.2100219726562) {
-                        var9 = 1266.79;
-                    } else {
-                        var9 = 4674.91;
-                    }
-                } else {
-                    if (input[3] <= 1266.0250244140625) {
-                        if (input[0] <= 1320.2050170898438) {
-                            var9 = 1679.3844444444444;
-                        } else {
-                            var9 = 1927.66;
-                        }
-                    } else {
-                        if (input[0] <= 1333.9450073242188) {
-                            var9 = 1283.1566366366362;
-                        } else {
-                            var9 = 1405.2800000000002;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1351.4949951171875) {
-                if (input[4] <= 4693.22509765625) {
-                    if (input[0] <= 1816.239990234375) {
-                        var9 = 5170.94;
-                    } else {
-                        var9 = 4681.01;
-                    }
-                } else {
-                    if (input[2] <= 1302.655029296875) {
-                        var9 = 3644.69;
-                    } else {
-                        var9 = 3220.39;
-                    }
-                }
-            } else {
-                if (input[4] <= 4969.47509765625) {
-                    if (input[3] <= 1855.1600341796875) {
-                        if (input[2] <= 1712.4550170898438) {
-                            var9 = 1725.58;
-                        } else {
-                            var9 = 2522.3866666666668;
-                        }
-                    } else {
-                        if (input[2] <= 3622.56005859375) {
-                            var9 = 1517.0942857142857;
-                        } else {
-                            var9 = 1265.26;
-                        }
-                    }
-                } else {
-                    var9 = 3821.73;
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4892.400146484375) {
-            if (input[0] <= 3419.570068359375) {
-                if (input[3] <= 1588.0650024414062) {
-                    if (input[2] <= 1400.3349609375) {
-                        var9 = 3922.47;
-                    } else {
-                        var9 = 4681.01;
-                    }
-                } else {
-                    if (input[3] <= 5108.364990234375) {
-                        if (input[3] <= 4578.7548828125) {
-                            var9 = 2881.1825000000003;
-                        } else {
-                            var9 = 3854.55;
-                        }
-                    } else {
-                        var9 = 1944.44;
-                    }
-                }
-            } else {
-                if (input[3] <= 5158.72998046875) {
-                    if (input[0] <= 4689.41015625) {
-                        if (input[4] <= 2371.7950439453125) {
-                            var9 = 3198.3466666666664;
-                        } else {
-                            var9 = 4475.19292929293;
-                        }
-                    } else {
-                        if (input[4] <= 5224.360107421875) {
-                            var9 = 4797.448943661971;
-                        } else {
-                            var9 = 3897.7400000000002;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4970.239990234375) {
-                        if (input[0] <= 4858.824951171875) {
-                            var9 = 1489.318;
-                        } else {
-                            var9 = 3097.9075;
-                        }
-                    } else {
-                        var9 = 4948.11;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5182.385009765625) {
-                if (input[3] <= 5268.6201171875) {
-                    if (input[0] <= 5000.764892578125) {
-                        if (input[2] <= 5077.0751953125) {
-                            var9 = 4964.917464788733;
-                        } else {
-                            var9 = 4632.784000000001;
-                        }
-                    } else {
-                        if (input[1] <= 3321.8850708007812) {
-                            var9 = 4496.34;
-                        } else {
-                            var9 = 5088.918109452736;
-                        }
-                    }
-                } else {
-                    var9 = 3992.67;
-                }
-            } else {
-                if (input[0] <= 5291.514892578125) {
-                    if (input[0] <= 5204.51513671875) {
-                        if (input[2] <= 5177.044921875) {
-                            var9 = 5221.508666666667;
-                        } else {
-                            var9 = 5161.7065;
-                        }
-                    } else {
-                        if (input[1] <= 5258.7001953125) {
-                            var9 = 5225.122325581396;
-                        } else {
-                            var9 = 5261.6765;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5342.64501953125) {
-                        if (input[4] <= 5311.35498046875) {
-                            var9 = 5340.052;
-                        } else {
-                            var9 = 5303.5337500000005;
-                        }
-                    } else {
-                        if (input[2] <= 5396.824951171875) {
-                            var9 = 5367.023684210528;
-                        } else {
-                            var9 = 5414.487142857142;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var10;
-    if (input[0] <= 2896.0599365234375) {
-        if (input[0] <= 1659.0349731445312) {
-            if (input[0] <= 627.2899780273438) {
-                var10 = 5024.42;
-            } else {
-                if (input[0] <= 1456.0449829101562) {
-                    if (input[0] <= 1312.5750122070312) {
-                        if (input[0] <= 1264.5) {
-                            var10 = 1258.3421441441449;
-                        } else {
-                            var10 = 1284.2108408408424;
-                        }
-                    } else {
-                        if (input[3] <= 1291.2100219726562) {
-                            var10 = 1820.8166666666666;
-                        } else {
-                            var10 = 1357.9948484848485;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1351.4949951171875) {
-                        if (input[2] <= 1302.655029296875) {
-                            var10 = 3644.69;
-                        } else {
-                            var10 = 3220.39;
-                        }
-                    } else {
-                        if (input[2] <= 1520.9100341796875) {
-                            var10 = 1697.1916666666668;
-                        } else {
-                            var10 = 1417.9964285714286;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1437.72998046875) {
-                if (input[4] <= 3173.0751342773438) {
-                    if (input[3] <= 1298.8400268554688) {
-                        if (input[3] <= 1291.2050170898438) {
-                            var10 = 4952.69;
-                        } else {
-                            var10 = 5170.94;
-                        }
-                    } else {
-                        var10 = 4629.12;
-                    }
-                } else {
-                    var10 = 3922.47;
-                }
-            } else {
-                if (input[0] <= 2395.449951171875) {
-                    if (input[4] <= 2692.31005859375) {
-                        if (input[3] <= 1485.0450439453125) {
-                            var10 = 2040.5999999999997;
-                        } else {
-                            var10 = 2378.66;
-                        }
-                    } else {
-                        if (input[0] <= 2312.2698974609375) {
-                            var10 = 1796.4;
-                        } else {
-                            var10 = 1265.26;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 2951.0050048828125) {
-                        if (input[4] <= 1474.3600463867188) {
-                            var10 = 2712.53;
-                        } else {
-                            var10 = 2973.442;
-                        }
-                    } else {
-                        var10 = 2081.81;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4892.400146484375) {
-            if (input[3] <= 5158.72998046875) {
-                if (input[0] <= 4530.675048828125) {
-                    if (input[0] <= 4528.385009765625) {
-                        if (input[0] <= 4087.300048828125) {
-                            var10 = 4037.644642857143;
-                        } else {
-                            var10 = 4451.961000000001;
-                        }
-                    } else {
-                        var10 = 1491.15;
-                    }
-                } else {
-                    if (input[3] <= 5154.9150390625) {
-                        if (input[0] <= 4760.3798828125) {
-                            var10 = 4640.507368421052;
-                        } else {
-                            var10 = 4867.634945054944;
-                        }
-                    } else {
-                        if (input[0] <= 4797.77001953125) {
-                            var10 = 3147.13;
-                        } else {
-                            var10 = 3826.31;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4858.824951171875) {
-                    if (input[4] <= 5245.724853515625) {
-                        if (input[1] <= 4921.39501953125) {
-                            var10 = 1293.346;
-                        } else {
-                            var10 = 1514.55;
-                        }
-                    } else {
-                        var10 = 2312.27;
-                    }
-                } else {
-                    if (input[3] <= 5194.60009765625) {
-                        var10 = 2991.4499999999994;
-                    } else {
-                        var10 = 3417.28;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5182.385009765625) {
-                if (input[0] <= 5040.445068359375) {
-                    if (input[3] <= 5176.284912109375) {
-                        if (input[4] <= 5023.655029296875) {
-                            var10 = 4929.2925000000005;
-                        } else {
-                            var10 = 5019.31043478261;
-                        }
-                    } else {
-                        if (input[4] <= 5110.655029296875) {
-                            var10 = 4600.12;
-                        } else {
-                            var10 = 4806.928333333333;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5211.39013671875) {
-                        if (input[0] <= 5099.969970703125) {
-                            var10 = 5072.224150943399;
-                        } else {
-                            var10 = 5135.778734177215;
-                        }
-                    } else {
-                        if (input[0] <= 5122.85986328125) {
-                            var10 = 4844.76;
-                        } else {
-                            var10 = 5036.77;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5289.98486328125) {
-                    if (input[0] <= 5217.489990234375) {
-                        if (input[3] <= 5249.544921875) {
-                            var10 = 5192.18262295082;
-                        } else {
-                            var10 = 5069.19;
-                        }
-                    } else {
-                        if (input[0] <= 5258.7001953125) {
-                            var10 = 5230.0419999999995;
-                        } else {
-                            var10 = 5265.236086956522;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5358.670166015625) {
-                        if (input[0] <= 5339.58984375) {
-                            var10 = 5310.898;
-                        } else {
-                            var10 = 5346.154;
-                        }
-                    } else {
-                        if (input[2] <= 5399.114990234375) {
-                            var10 = 5377.746000000001;
-                        } else {
-                            var10 = 5400.968571428572;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var11;
-    if (input[0] <= 3419.570068359375) {
-        if (input[0] <= 1666.6649780273438) {
-            if (input[0] <= 627.2899780273438) {
-                var11 = 5024.42;
-            } else {
-                if (input[0] <= 1333.1799926757812) {
-                    if (input[0] <= 1266.0250244140625) {
-                        if (input[3] <= 1266.0250244140625) {
-                            var11 = 1258.3786837606833;
-                        } else {
-                            var11 = 1157.2783333333334;
-                        }
-                    } else {
-                        if (input[2] <= 1259.155029296875) {
-                            var11 = 4548.23;
-                        } else {
-                            var11 = 1293.47131097561;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1295.7899780273438) {
-                        if (input[2] <= 1290.4450073242188) {
-                            var11 = 2052.81;
-                        } else {
-                            var11 = 3421.86;
-                        }
-                    } else {
-                        if (input[0] <= 1620.8800048828125) {
-                            var11 = 1390.878787878788;
-                        } else {
-                            var11 = 1891.03;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1437.72998046875) {
-                if (input[4] <= 3173.0751342773438) {
-                    if (input[2] <= 1338.5249633789062) {
-                        if (input[3] <= 1291.2050170898438) {
-                            var11 = 4952.69;
-                        } else {
-                            var11 = 5170.94;
-                        }
-                    } else {
-                        var11 = 4629.12;
-                    }
-                } else {
-                    var11 = 3922.47;
-                }
-            } else {
-                if (input[0] <= 2131.4100341796875) {
-                    if (input[3] <= 2160.4099731445312) {
-                        if (input[2] <= 1644.5349731445312) {
-                            var11 = 2040.6;
-                        } else {
-                            var11 = 2315.32;
-                        }
-                    } else {
-                        if (input[3] <= 3166.2099609375) {
-                            var11 = 1556.78;
-                        } else {
-                            var11 = 1704.82;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5237.3349609375) {
-                        if (input[0] <= 2912.8499755859375) {
-                            var11 = 2666.778181818182;
-                        } else {
-                            var11 = 3373.5266666666666;
-                        }
-                    } else {
-                        if (input[1] <= 4072.0399169921875) {
-                            var11 = 2255.8;
-                        } else {
-                            var11 = 1944.4399999999998;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4863.400146484375) {
-            if (input[3] <= 5158.72998046875) {
-                if (input[0] <= 4297.159912109375) {
-                    if (input[1] <= 4413.9150390625) {
-                        if (input[3] <= 3770.6051025390625) {
-                            var11 = 4466.88;
-                        } else {
-                            var11 = 3737.6873333333338;
-                        }
-                    } else {
-                        var11 = 1393.47;
-                    }
-                } else {
-                    if (input[3] <= 5154.9150390625) {
-                        if (input[0] <= 4692.4599609375) {
-                            var11 = 4574.264589371981;
-                        } else {
-                            var11 = 4785.820094339622;
-                        }
-                    } else {
-                        if (input[3] <= 5156.440185546875) {
-                            var11 = 3147.13;
-                        } else {
-                            var11 = 3826.31;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 4935.1298828125) {
-                    if (input[4] <= 5245.724853515625) {
-                        if (input[1] <= 4685.594970703125) {
-                            var11 = 1349.21;
-                        } else {
-                            var11 = 1285.3616666666667;
-                        }
-                    } else {
-                        var11 = 2312.27;
-                    }
-                } else {
-                    if (input[4] <= 5225.885009765625) {
-                        var11 = 3417.28;
-                    } else {
-                        var11 = 4948.11;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5182.385009765625) {
-                if (input[3] <= 5268.6201171875) {
-                    if (input[0] <= 5000.764892578125) {
-                        if (input[3] <= 5178.574951171875) {
-                            var11 = 4938.690638297874;
-                        } else {
-                            var11 = 4349.0525;
-                        }
-                    } else {
-                        if (input[1] <= 3172.3098754882812) {
-                            var11 = 4496.34;
-                        } else {
-                            var11 = 5079.81699507389;
-                        }
-                    }
-                } else {
-                    var11 = 3992.67;
-                }
-            } else {
-                if (input[0] <= 5290.75) {
-                    if (input[1] <= 5254.885009765625) {
-                        if (input[3] <= 4865.68994140625) {
-                            var11 = 5239.813125000001;
-                        } else {
-                            var11 = 5206.513974358975;
-                        }
-                    } else {
-                        if (input[4] <= 3285.2550048828125) {
-                            var11 = 5219.0175;
-                        } else {
-                            var11 = 5266.89;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5358.670166015625) {
-                        if (input[0] <= 5324.330078125) {
-                            var11 = 5314.408888888888;
-                        } else {
-                            var11 = 5347.5485714285705;
-                        }
-                    } else {
-                        if (input[2] <= 5399.114990234375) {
-                            var11 = 5371.8966666666665;
-                        } else {
-                            var11 = 5406.898;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var12;
-    if (input[0] <= 3078.449951171875) {
-        if (input[0] <= 1730.0049438476562) {
-            if (input[0] <= 627.2899780273438) {
-                var12 = 5024.42;
-            } else {
-                if (input[0] <= 1331.6549682617188) {
-                    if (input[0] <= 1264.5) {
-                        if (input[0] <= 1259.9200439453125) {
-                            var12 = 1257.3947098214273;
-                        } else {
-                            var12 = 1262.209607843138;
-                        }
-                    } else {
-                        if (input[2] <= 1258.39501953125) {
-                            var12 = 4548.23;
-                        } else {
-                            var12 = 1293.870320855615;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1326.3150024414062) {
-                        if (input[0] <= 1420.9400024414062) {
-                            var12 = 2193.2239999999997;
-                        } else {
-                            var12 = 3220.39;
-                        }
-                    } else {
-                        if (input[0] <= 1475.1199951171875) {
-                            var12 = 1371.72;
-                        } else {
-                            var12 = 1567.3333333333333;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1374.3900146484375) {
-                if (input[2] <= 1334.7049560546875) {
-                    var12 = 3922.47;
-                } else {
-                    var12 = 4952.69;
-                }
-            } else {
-                if (input[0] <= 2313.7950439453125) {
-                    if (input[3] <= 2393.9249877929688) {
-                        if (input[0] <= 1823.1099853515625) {
-                            var12 = 2040.6;
-                        } else {
-                            var12 = 2248.165;
-                        }
-                    } else {
-                        if (input[0] <= 2178.7249755859375) {
-                            var12 = 1704.82;
-                        } else {
-                            var12 = 2139.806666666667;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 2876.2200317382812) {
-                        if (input[2] <= 2311.5050048828125) {
-                            var12 = 2653.0075;
-                        } else {
-                            var12 = 3011.2925;
-                        }
-                    } else {
-                        if (input[2] <= 3396.669921875) {
-                            var12 = 2211.03;
-                        } else {
-                            var12 = 2558.0;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4775.639892578125) {
-            if (input[3] <= 5157.969970703125) {
-                if (input[0] <= 4297.159912109375) {
-                    if (input[1] <= 4394.840087890625) {
-                        if (input[3] <= 1948.260009765625) {
-                            var12 = 4780.724999999999;
-                        } else {
-                            var12 = 3853.6636;
-                        }
-                    } else {
-                        if (input[0] <= 3851.4949951171875) {
-                            var12 = 1944.44;
-                        } else {
-                            var12 = 1393.47;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5224.360107421875) {
-                        if (input[0] <= 4688.64501953125) {
-                            var12 = 4548.444070351757;
-                        } else {
-                            var12 = 4734.95341772152;
-                        }
-                    } else {
-                        var12 = 3147.13;
-                    }
-                }
-            } else {
-                if (input[4] <= 5245.724853515625) {
-                    if (input[1] <= 4892.39990234375) {
-                        if (input[2] <= 5000.0) {
-                            var12 = 1294.264;
-                        } else {
-                            var12 = 1349.21;
-                        }
-                    } else {
-                        if (input[0] <= 4685.594970703125) {
-                            var12 = 1613.25;
-                        } else {
-                            var12 = 1465.2;
-                        }
-                    }
-                } else {
-                    var12 = 2312.27;
-                }
-            }
-        } else {
-            if (input[0] <= 5086.235107421875) {
-                if (input[3] <= 5178.574951171875) {
-                    if (input[0] <= 4945.81494140625) {
-                        if (input[4] <= 5235.0400390625) {
-                            var12 = 4873.687499999999;
-                        } else {
-                            var12 = 4183.46;
-                        }
-                    } else {
-                        if (input[3] <= 5165.594970703125) {
-                            var12 = 5031.205445544553;
-                        } else {
-                            var12 = 4311.66;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4970.239990234375) {
-                        if (input[3] <= 5194.60009765625) {
-                            var12 = 2991.45;
-                        } else {
-                            var12 = 3417.28;
-                        }
-                    } else {
-                        if (input[4] <= 4030.8299560546875) {
-                            var12 = 3992.67;
-                        } else {
-                            var12 = 4861.112;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5210.625) {
-                    if (input[2] <= 2563.3400268554688) {
-                        var12 = 4496.34;
-                    } else {
-                        if (input[0] <= 5156.440185546875) {
-                            var12 = 5095.9497560975615;
-                        } else {
-                            var12 = 5171.3062666666665;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 5289.98486328125) {
-                        if (input[0] <= 5275.489990234375) {
-                            var12 = 5228.938769230768;
-                        } else {
-                            var12 = 5272.590000000001;
-                        }
-                    } else {
-                        if (input[0] <= 5343.405029296875) {
-                            var12 = 5314.332;
-                        } else {
-                            var12 = 5382.071666666668;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var13;
-    if (input[0] <= 2905.97998046875) {
-        if (input[0] <= 627.2899780273438) {
-            var13 = 5024.42;
-        } else {
-            if (input[0] <= 1620.8800048828125) {
-                if (input[0] <= 1469.0149536132812) {
-                    if (input[0] <= 1264.5) {
-                        if (input[0] <= 1258.39501953125) {
-                            var13 = 1256.9490760869558;
-                        } else {
-                            var13 = 1260.780809248554;
-                        }
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var13 = 1750.6760869565219;
-                        } else {
-                            var13 = 1290.6765642458106;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1351.4949951171875) {
-                        var13 = 3644.69;
-                    } else {
-                        if (input[2] <= 1520.9100341796875) {
-                            var13 = 1699.8625;
-                        } else {
-                            var13 = 1429.5888888888887;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 1440.780029296875) {
-                    if (input[2] <= 1344.625) {
-                        var13 = 5170.94;
-                    } else {
-                        var13 = 4681.01;
-                    }
-                } else {
-                    if (input[1] <= 4043.0399169921875) {
-                        if (input[0] <= 2293.9549560546875) {
-                            var13 = 1845.6545454545455;
-                        } else {
-                            var13 = 2382.648888888889;
-                        }
-                    } else {
-                        var13 = 1265.26;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4893.1650390625) {
-            if (input[3] <= 5149.5751953125) {
-                if (input[0] <= 4298.68505859375) {
-                    if (input[0] <= 4272.739990234375) {
-                        if (input[3] <= 2193.219970703125) {
-                            var13 = 4644.19125;
-                        } else {
-                            var13 = 3716.026956521739;
-                        }
-                    } else {
-                        var13 = 1393.47;
-                    }
-                } else {
-                    if (input[0] <= 4669.56494140625) {
-                        if (input[0] <= 4668.039794921875) {
-                            var13 = 4565.649066666665;
-                        } else {
-                            var13 = 1286.63;
-                        }
-                    } else {
-                        if (input[4] <= 5224.360107421875) {
-                            var13 = 4786.901277777777;
-                        } else {
-                            var13 = 4183.46;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4672.619873046875) {
-                    if (input[4] <= 5067.919921875) {
-                        var13 = 1613.25;
-                    } else {
-                        if (input[4] <= 5206.044921875) {
-                            var13 = 1349.21;
-                        } else {
-                            var13 = 1295.79;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5190.780029296875) {
-                        var13 = 1286.63;
-                    } else {
-                        if (input[2] <= 4960.31494140625) {
-                            var13 = 2312.27;
-                        } else {
-                            var13 = 3248.032222222222;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5182.385009765625) {
-                if (input[0] <= 5038.920166015625) {
-                    if (input[3] <= 5155.675048828125) {
-                        if (input[4] <= 4848.900146484375) {
-                            var13 = 5182.278571428571;
-                        } else {
-                            var13 = 4987.241403508772;
-                        }
-                    } else {
-                        if (input[3] <= 5170.175048828125) {
-                            var13 = 4311.66;
-                        } else {
-                            var13 = 4775.423571428572;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5264.804931640625) {
-                        if (input[3] <= 5224.360107421875) {
-                            var13 = 5114.7275735294115;
-                        } else {
-                            var13 = 5017.510526315789;
-                        }
-                    } else {
-                        var13 = 4618.44;
-                    }
-                }
-            } else {
-                if (input[0] <= 5290.75) {
-                    if (input[0] <= 5217.489990234375) {
-                        if (input[3] <= 5247.2548828125) {
-                            var13 = 5206.044250000001;
-                        } else {
-                            var13 = 5093.712;
-                        }
-                    } else {
-                        if (input[0] <= 5275.489990234375) {
-                            var13 = 5227.6955714285705;
-                        } else {
-                            var13 = 5281.047142857143;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5358.670166015625) {
-                        if (input[0] <= 5324.330078125) {
-                            var13 = 5297.28;
-                        } else {
-                            var13 = 5348.875;
-                        }
-                    } else {
-                        if (input[1] <= 5402.169921875) {
-                            var13 = 5375.217368421052;
-                        } else {
-                            var13 = 5409.623846153846;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var14;
-    if (input[0] <= 1909.3450317382812) {
-        if (input[0] <= 627.2899780273438) {
-            var14 = 5024.42;
-        } else {
-            if (input[0] <= 1418.6499633789062) {
-                if (input[0] <= 1264.5) {
-                    if (input[0] <= 1258.39501953125) {
-                        if (input[4] <= 1270.60498046875) {
-                            var14 = 1256.9179945799444;
-                        } else {
-                            var14 = 1264.2483333333332;
-                        }
-                    } else {
-                        if (input[0] <= 1261.4450073242188) {
-                            var14 = 1259.7981249999998;
-                        } else {
-                            var14 = 1262.6592156862744;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1264.5) {
-                        if (input[4] <= 1262.9749755859375) {
-                            var14 = 1285.716;
-                        } else {
-                            var14 = 4632.683333333333;
-                        }
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var14 = 1648.2827272727272;
-                        } else {
-                            var14 = 1281.986069364162;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1338.5250244140625) {
-                    if (input[4] <= 2890.7200317382812) {
-                        var14 = 4629.12;
-                    } else {
-                        if (input[4] <= 4597.070068359375) {
-                            var14 = 3421.86;
-                        } else {
-                            var14 = 3220.39;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1620.8800048828125) {
-                        if (input[3] <= 3864.469970703125) {
-                            var14 = 1477.9654545454543;
-                        } else {
-                            var14 = 1338.52;
-                        }
-                    } else {
-                        if (input[1] <= 1918.5) {
-                            var14 = 1987.6899999999998;
-                        } else {
-                            var14 = 1556.78;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4297.159912109375) {
-            if (input[1] <= 4413.9150390625) {
-                if (input[3] <= 1420.1749877929688) {
-                    if (input[4] <= 4808.455078125) {
-                        if (input[4] <= 2943.3750610351562) {
-                            var14 = 5010.305;
-                        } else {
-                            var14 = 4690.167142857143;
-                        }
-                    } else {
-                        if (input[1] <= 1969.6249389648438) {
-                            var14 = 3922.47;
-                        } else {
-                            var14 = 4123.93;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 3308.9149169921875) {
-                        if (input[0] <= 1992.5199584960938) {
-                            var14 = 3444.75;
-                        } else {
-                            var14 = 2486.7000000000003;
-                        }
-                    } else {
-                        if (input[0] <= 4010.22998046875) {
-                            var14 = 3835.823076923077;
-                        } else {
-                            var14 = 4323.283846153847;
-                        }
-                    }
-                }
-            } else {
-                if (input[4] <= 5203.7548828125) {
-                    if (input[0] <= 3170.784912109375) {
-                        var14 = 1265.26;
-                    } else {
-                        if (input[4] <= 3240.22998046875) {
-                            var14 = 1393.47;
-                        } else {
-                            var14 = 1349.21;
-                        }
-                    }
-                } else {
-                    var14 = 4403.24;
-                }
-            }
-        } else {
-            if (input[0] <= 4931.31494140625) {
-                if (input[4] <= 5241.909912109375) {
-                    if (input[3] <= 5255.650146484375) {
-                        if (input[0] <= 4638.27490234375) {
-                            var14 = 4564.4544966442945;
-                        } else {
-                            var14 = 4769.211084337352;
-                        }
-                    } else {
-                        var14 = 1613.25;
-                    }
-                } else {
-                    if (input[2] <= 4943.52490234375) {
-                        var14 = 1303.42;
-                    } else {
-                        var14 = 2312.27;
-                    }
-                }
-            } else {
-                if (input[0] <= 5132.019775390625) {
-                    if (input[3] <= 5165.594970703125) {
-                        if (input[0] <= 5052.655029296875) {
-                            var14 = 5019.268854166668;
-                        } else {
-                            var14 = 5106.131052631577;
-                        }
-                    } else {
-                        if (input[3] <= 5170.175048828125) {
-                            var14 = 4311.66;
-                        } else {
-                            var14 = 4893.439090909091;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5275.489990234375) {
-                        if (input[0] <= 5217.489990234375) {
-                            var14 = 5172.118607594936;
-                        } else {
-                            var14 = 5225.412676056337;
-                        }
-                    } else {
-                        if (input[0] <= 5341.114990234375) {
-                            var14 = 5286.859;
-                        } else {
-                            var14 = 5381.2868181818185;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var15;
-    if (input[0] <= 3419.570068359375) {
-        if (input[0] <= 1666.6649780273438) {
-            if (input[0] <= 1465.9649658203125) {
-                if (input[4] <= 1266.0250244140625) {
-                    if (input[0] <= 1266.0250244140625) {
-                        if (input[0] <= 1258.39501953125) {
-                            var15 = 1256.9009919571035;
-                        } else {
-                            var15 = 1260.7353932584265;
-                        }
-                    } else {
-                        if (input[0] <= 1288.155029296875) {
-                            var15 = 1274.2411764705882;
-                        } else {
-                            var15 = 1297.314285714286;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1259.9199829101562) {
-                        var15 = 4674.91;
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var15 = 1630.5441666666666;
-                        } else {
-                            var15 = 1297.8368700265253;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 1419.4150390625) {
-                    if (input[0] <= 1469.7799682617188) {
-                        var15 = 3220.39;
-                    } else {
-                        var15 = 3644.69;
-                    }
-                } else {
-                    if (input[0] <= 1498.780029296875) {
-                        if (input[3] <= 1740.6900024414062) {
-                            var15 = 1533.88;
-                        } else {
-                            var15 = 1399.57;
-                        }
-                    } else {
-                        if (input[0] <= 1520.14501953125) {
-                            var15 = 1628.51;
-                        } else {
-                            var15 = 1782.3580000000002;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1547.6199951171875) {
-                if (input[2] <= 1338.5249633789062) {
-                    var15 = 4952.69;
-                } else {
-                    if (input[2] <= 1358.364990234375) {
-                        var15 = 4629.12;
-                    } else {
-                        var15 = 4681.01;
-                    }
-                }
-            } else {
-                if (input[1] <= 2293.9549560546875) {
-                    if (input[2] <= 2061.2050170898438) {
-                        if (input[3] <= 1567.4600219726562) {
-                            var15 = 2248.165;
-                        } else {
-                            var15 = 2562.58;
-                        }
-                    } else {
-                        if (input[1] <= 2178.7249755859375) {
-                            var15 = 1556.78;
-                        } else {
-                            var15 = 1704.82;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5237.3349609375) {
-                        if (input[0] <= 2912.8499755859375) {
-                            var15 = 2656.6958333333337;
-                        } else {
-                            var15 = 3394.6399999999994;
-                        }
-                    } else {
-                        if (input[2] <= 4794.719970703125) {
-                            var15 = 2255.8;
-                        } else {
-                            var15 = 1944.44;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4892.400146484375) {
-            if (input[3] <= 5154.9150390625) {
-                if (input[0] <= 4669.56494140625) {
-                    if (input[0] <= 4668.039794921875) {
-                        if (input[1] <= 4498.6298828125) {
-                            var15 = 4220.26231884058;
-                        } else {
-                            var15 = 4589.19169117647;
-                        }
-                    } else {
-                        if (input[4] <= 4957.26513671875) {
-                            var15 = 1286.63;
-                        } else {
-                            var15 = 4540.6;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4781.744873046875) {
-                        if (input[1] <= 4657.35498046875) {
-                            var15 = 5015.263333333333;
-                        } else {
-                            var15 = 4714.8816853932585;
-                        }
-                    } else {
-                        if (input[3] <= 4594.014892578125) {
-                            var15 = 5134.6925;
-                        } else {
-                            var15 = 4862.459666666667;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 4927.5) {
-                    if (input[3] <= 5170.179931640625) {
-                        if (input[3] <= 5157.969970703125) {
-                            var15 = 3147.1299999999997;
-                        } else {
-                            var15 = 2312.27;
-                        }
-                    } else {
-                        if (input[2] <= 5069.445068359375) {
-                            var15 = 1289.3025;
-                        } else {
-                            var15 = 1349.21;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4970.239990234375) {
-                        if (input[4] <= 5233.52001953125) {
-                            var15 = 2991.45;
-                        } else {
-                            var15 = 3826.31;
-                        }
-                    } else {
-                        var15 = 4948.11;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5181.625) {
-                if (input[0] <= 5072.5) {
-                    if (input[3] <= 5166.364990234375) {
-                        if (input[0] <= 4994.655029296875) {
-                            var15 = 4956.488852459014;
-                        } else {
-                            var15 = 5041.541304347826;
-                        }
-                    } else {
-                        if (input[4] <= 3866.7601318359375) {
-                            var15 = 3992.67;
-                        } else {
-                            var15 = 4773.0975;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 3008.2400512695312) {
-                        var15 = 4496.34;
-                    } else {
-                        if (input[3] <= 5211.39013671875) {
-                            var15 = 5130.055959595958;
-                        } else {
-                            var15 = 5035.976428571428;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5282.35498046875) {
-                    if (input[1] <= 5257.175048828125) {
-                        if (input[0] <= 5210.625) {
-                            var15 = 5196.203157894737;
-                        } else {
-                            var15 = 5222.664074074074;
-                        }
-                    } else {
-                        if (input[0] <= 5264.80517578125) {
-                            var15 = 5251.835;
-                        } else {
-                            var15 = 5272.739;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 5368.590087890625) {
-                        if (input[0] <= 5306.014892578125) {
-                            var15 = 5300.394545454546;
-                        } else {
-                            var15 = 5334.25;
-                        }
-                    } else {
-                        if (input[0] <= 5383.090087890625) {
-                            var15 = 5361.722;
-                        } else {
-                            var15 = 5393.86875;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var16;
-    if (input[0] <= 3419.570068359375) {
-        if (input[0] <= 1433.9149780273438) {
-            if (input[0] <= 1264.5) {
-                if (input[0] <= 1259.9200439453125) {
-                    if (input[4] <= 1258.39501953125) {
-                        if (input[1] <= 1256.8699951171875) {
-                            var16 = 1256.5261904761896;
-                        } else {
-                            var16 = 1257.2068707483006;
-                        }
-                    } else {
-                        if (input[4] <= 1270.60498046875) {
-                            var16 = 1258.677027027028;
-                        } else {
-                            var16 = 1265.2649999999999;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1256.8699951171875) {
-                        if (input[4] <= 1256.8699951171875) {
-                            var16 = 1268.32;
-                        } else {
-                            var16 = 1289.68;
-                        }
-                    } else {
-                        if (input[4] <= 1262.9749755859375) {
-                            var16 = 1260.585873015873;
-                        } else {
-                            var16 = 1262.8394117647058;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 1259.155029296875) {
-                    var16 = 4548.23;
-                } else {
-                    if (input[3] <= 1266.0250244140625) {
-                        if (input[4] <= 1266.0250244140625) {
-                            var16 = 1283.9608333333333;
-                        } else {
-                            var16 = 2058.4033333333336;
-                        }
-                    } else {
-                        if (input[0] <= 1312.5750122070312) {
-                            var16 = 1276.8193015873017;
-                        } else {
-                            var16 = 1382.524680851064;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1340.050048828125) {
-                if (input[4] <= 2892.2450561523438) {
-                    if (input[3] <= 1298.8400268554688) {
-                        if (input[2] <= 1324.7849731445312) {
-                            var16 = 5170.94;
-                        } else {
-                            var16 = 4952.69;
-                        }
-                    } else {
-                        var16 = 4629.12;
-                    }
-                } else {
-                    if (input[2] <= 1291.9700317382812) {
-                        var16 = 3644.69;
-                    } else {
-                        var16 = 3421.86;
-                    }
-                }
-            } else {
-                if (input[0] <= 1917.7349853515625) {
-                    if (input[0] <= 1730.0049438476562) {
-                        if (input[0] <= 1498.780029296875) {
-                            var16 = 1452.035;
-                        } else {
-                            var16 = 1690.1719999999998;
-                        }
-                    } else {
-                        if (input[4] <= 1382.02001953125) {
-                            var16 = 2040.6;
-                        } else {
-                            var16 = 2181.01;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 4877.14013671875) {
-                        if (input[1] <= 4090.349853515625) {
-                            var16 = 2820.6351999999997;
-                        } else {
-                            var16 = 1774.645;
-                        }
-                    } else {
-                        var16 = 3710.32;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4864.1650390625) {
-            if (input[3] <= 5158.72998046875) {
-                if (input[0] <= 4297.919921875) {
-                    if (input[0] <= 4272.739990234375) {
-                        if (input[2] <= 3847.679931640625) {
-                            var16 = 4340.222142857143;
-                        } else {
-                            var16 = 3852.4799999999996;
-                        }
-                    } else {
-                        var16 = 1393.47;
-                    }
-                } else {
-                    if (input[4] <= 5240.385009765625) {
-                        if (input[0] <= 4700.090087890625) {
-                            var16 = 4583.760236966826;
-                        } else {
-                            var16 = 4781.34588785047;
-                        }
-                    } else {
-                        if (input[0] <= 4797.77001953125) {
-                            var16 = 3147.13;
-                        } else {
-                            var16 = 3826.31;
-                        }
-                    }
-                }
-            } else {
-                if (input[4] <= 5190.780029296875) {
-                    if (input[3] <= 5255.650146484375) {
-                        var16 = 1286.63;
-                    } else {
-                        var16 = 1613.25;
-                    }
-                } else {
-                    if (input[4] <= 5235.0400390625) {
-                        if (input[4] <= 5225.885009765625) {
-                            var16 = 3417.28;
-                        } else {
-                            var16 = 4948.11;
-                        }
-                    } else {
-                        if (input[2] <= 4943.52490234375) {
-                            var16 = 1303.42;
-                        } else {
-                            var16 = 2312.27;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5073.260009765625) {
-                if (input[3] <= 5133.544921875) {
-                    if (input[4] <= 5023.655029296875) {
-                        if (input[2] <= 4680.25) {
-                            var16 = 5240.636666666666;
-                        } else {
-                            var16 = 4903.302602739726;
-                        }
-                    } else {
-                        if (input[1] <= 5070.969970703125) {
-                            var16 = 5016.684252873563;
-                        } else {
-                            var16 = 5099.486363636363;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5069.445068359375) {
-                        if (input[0] <= 5008.39501953125) {
-                            var16 = 4620.980833333333;
-                        } else {
-                            var16 = 4846.527777777778;
-                        }
-                    } else {
-                        var16 = 3992.67;
-                    }
-                }
-            } else {
-                if (input[0] <= 5258.699951171875) {
-                    if (input[0] <= 5182.385009765625) {
-                        if (input[1] <= 3279.1499633789062) {
-                            var16 = 4496.34;
-                        } else {
-                            var16 = 5109.647787610617;
-                        }
-                    } else {
-                        if (input[0] <= 5219.02001953125) {
-                            var16 = 5188.854035087718;
-                        } else {
-                            var16 = 5221.307192982456;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5339.58984375) {
-                        if (input[0] <= 5290.75) {
-                            var16 = 5269.744736842105;
-                        } else {
-                            var16 = 5304.233333333334;
-                        }
-                    } else {
-                        if (input[2] <= 5399.114990234375) {
-                            var16 = 5365.112592592592;
-                        } else {
-                            var16 = 5410.562222222222;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var17;
-    if (input[0] <= 2865.5399169921875) {
-        if (input[0] <= 1433.9149780273438) {
-            if (input[0] <= 627.2899780273438) {
-                var17 = 5024.42;
-            } else {
-                if (input[0] <= 1266.0250244140625) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[4] <= 1258.39501953125) {
-                            var17 = 1256.823971014492;
-                        } else {
-                            var17 = 1258.7700000000011;
-                        }
-                    } else {
-                        if (input[3] <= 1256.8699951171875) {
-                            var17 = 1289.68;
-                        } else {
-                            var17 = 1262.2359482758625;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1258.39501953125) {
-                        var17 = 4548.23;
-                    } else {
-                        if (input[2] <= 1264.5) {
-                            var17 = 1966.4239999999998;
-                        } else {
-                            var17 = 1297.6494017094021;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1343.864990234375) {
-                if (input[1] <= 1406.4400024414062) {
-                    if (input[3] <= 1276.7100219726562) {
-                        var17 = 3220.39;
-                    } else {
-                        var17 = 3421.86;
-                    }
-                } else {
-                    if (input[0] <= 1878.8150024414062) {
-                        var17 = 4629.12;
-                    } else {
-                        var17 = 4952.69;
-                    }
-                }
-            } else {
-                if (input[0] <= 1849.81494140625) {
-                    if (input[0] <= 1730.0049438476562) {
-                        if (input[0] <= 1620.8800048828125) {
-                            var17 = 1491.452;
-                        } else {
-                            var17 = 1723.905;
-                        }
-                    } else {
-                        var17 = 2040.6;
-                    }
-                } else {
-                    if (input[3] <= 4781.7451171875) {
-                        if (input[3] <= 2615.9949951171875) {
-                            var17 = 2676.027777777778;
-                        } else {
-                            var17 = 1776.8620000000003;
-                        }
-                    } else {
-                        if (input[2] <= 4072.0399169921875) {
-                            var17 = 3696.0699999999997;
-                        } else {
-                            var17 = 2255.8;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4893.1650390625) {
-            if (input[0] <= 4291.81494140625) {
-                if (input[4] <= 4419.260009765625) {
-                    if (input[0] <= 4079.669921875) {
-                        if (input[0] <= 3308.9149169921875) {
-                            var17 = 3076.9244444444444;
-                        } else {
-                            var17 = 3326.2100000000005;
-                        }
-                    } else {
-                        var17 = 1393.47;
-                    }
-                } else {
-                    if (input[3] <= 5108.364990234375) {
-                        if (input[3] <= 2864.7750244140625) {
-                            var17 = 4474.2025;
-                        } else {
-                            var17 = 4088.8300000000004;
-                        }
-                    } else {
-                        var17 = 1944.44;
-                    }
-                }
-            } else {
-                if (input[3] <= 5154.9150390625) {
-                    if (input[0] <= 4688.64501953125) {
-                        if (input[2] <= 4698.56494140625) {
-                            var17 = 4580.654791666667;
-                        } else {
-                            var17 = 3685.8969999999995;
-                        }
-                    } else {
-                        if (input[4] <= 5209.860107421875) {
-                            var17 = 4788.130196078429;
-                        } else {
-                            var17 = 4183.46;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4696.27490234375) {
-                        if (input[3] <= 5232.755126953125) {
-                            var17 = 1303.42;
-                        } else {
-                            var17 = 1613.25;
-                        }
-                    } else {
-                        if (input[0] <= 4877.14013671875) {
-                            var17 = 3391.0260000000003;
-                        } else {
-                            var17 = 2991.45;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5182.385009765625) {
-                if (input[3] <= 5268.6201171875) {
-                    if (input[0] <= 5057.235107421875) {
-                        if (input[2] <= 5076.31494140625) {
-                            var17 = 4991.3153999999995;
-                        } else {
-                            var17 = 4764.848571428572;
-                        }
-                    } else {
-                        if (input[3] <= 5220.544921875) {
-                            var17 = 5117.08216;
-                        } else {
-                            var17 = 4977.775;
-                        }
-                    }
-                } else {
-                    var17 = 3992.67;
-                }
-            } else {
-                if (input[1] <= 5317.4599609375) {
-                    if (input[0] <= 5210.625) {
-                        if (input[3] <= 5241.909912109375) {
-                            var17 = 5183.150000000001;
-                        } else {
-                            var17 = 5098.4425;
-                        }
-                    } else {
-                        if (input[0] <= 5262.51513671875) {
-                            var17 = 5226.262597402597;
-                        } else {
-                            var17 = 5275.869500000001;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 5369.35498046875) {
-                        if (input[4] <= 5353.330078125) {
-                            var17 = 5376.068000000001;
-                        } else {
-                            var17 = 5334.248333333334;
-                        }
-                    } else {
-                        if (input[4] <= 5403.69482421875) {
-                            var17 = 5407.440000000001;
-                        } else {
-                            var17 = 5369.099999999999;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var18;
-    if (input[0] <= 2902.929931640625) {
-        if (input[0] <= 1430.8599853515625) {
-            if (input[0] <= 627.2899780273438) {
-                var18 = 5024.42;
-            } else {
-                if (input[0] <= 1264.5) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[4] <= 1258.39501953125) {
-                            var18 = 1256.960164383561;
-                        } else {
-                            var18 = 1258.7676744186056;
-                        }
-                    } else {
-                        if (input[3] <= 1258.39501953125) {
-                            var18 = 1267.2285714285713;
-                        } else {
-                            var18 = 1261.534947368421;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1259.155029296875) {
-                        var18 = 4548.23;
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var18 = 1524.5219999999997;
-                        } else {
-                            var18 = 1288.1530303030306;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1336.9949951171875) {
-                if (input[4] <= 4877.900146484375) {
-                    if (input[2] <= 1304.9450073242188) {
-                        var18 = 3421.86;
-                    } else {
-                        var18 = 3220.39;
-                    }
-                } else {
-                    var18 = 3922.47;
-                }
-            } else {
-                if (input[0] <= 1730.0049438476562) {
-                    if (input[2] <= 1531.5950317382812) {
-                        if (input[2] <= 1474.3600463867188) {
-                            var18 = 1550.67;
-                        } else {
-                            var18 = 1823.1100000000001;
-                        }
-                    } else {
-                        if (input[2] <= 3350.125) {
-                            var18 = 1473.4857142857143;
-                        } else {
-                            var18 = 1289.68;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 4969.47509765625) {
-                        if (input[0] <= 2620.574951171875) {
-                            var18 = 1918.498;
-                        } else {
-                            var18 = 2780.0675;
-                        }
-                    } else {
-                        if (input[0] <= 2284.0350341796875) {
-                            var18 = 3696.0699999999997;
-                        } else {
-                            var18 = 2255.8;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4857.294921875) {
-            if (input[3] <= 5158.72998046875) {
-                if (input[0] <= 4304.02490234375) {
-                    if (input[2] <= 4425.369873046875) {
-                        if (input[4] <= 4456.655029296875) {
-                            var18 = 3645.538888888889;
-                        } else {
-                            var18 = 4256.992272727272;
-                        }
-                    } else {
-                        if (input[0] <= 3204.364990234375) {
-                            var18 = 3710.32;
-                        } else {
-                            var18 = 1668.955;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4690.93505859375) {
-                        if (input[2] <= 4698.56494140625) {
-                            var18 = 4599.931576086956;
-                        } else {
-                            var18 = 4158.3164705882355;
-                        }
-                    } else {
-                        if (input[4] <= 5224.35986328125) {
-                            var18 = 4764.179117647061;
-                        } else {
-                            var18 = 3826.31;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 5083.945068359375) {
-                    if (input[4] <= 5245.724853515625) {
-                        if (input[4] <= 5235.804931640625) {
-                            var18 = 1283.58;
-                        } else {
-                            var18 = 1303.42;
-                        }
-                    } else {
-                        var18 = 2312.27;
-                    }
-                } else {
-                    if (input[1] <= 5023.659912109375) {
-                        var18 = 4948.11;
-                    } else {
-                        var18 = 1613.25;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5178.574951171875) {
-                if (input[0] <= 4998.474853515625) {
-                    if (input[2] <= 5064.864990234375) {
-                        if (input[0] <= 4903.0849609375) {
-                            var18 = 4863.204571428571;
-                        } else {
-                            var18 = 4975.198076923077;
-                        }
-                    } else {
-                        if (input[0] <= 4902.320068359375) {
-                            var18 = 2991.45;
-                        } else {
-                            var18 = 4620.269;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 3008.2400512695312) {
-                        var18 = 4496.34;
-                    } else {
-                        if (input[3] <= 5215.965087890625) {
-                            var18 = 5087.773668639057;
-                        } else {
-                            var18 = 4915.587692307693;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5288.4599609375) {
-                    if (input[0] <= 5204.51513671875) {
-                        if (input[3] <= 5240.385009765625) {
-                            var18 = 5174.722608695652;
-                        } else {
-                            var18 = 5084.556;
-                        }
-                    } else {
-                        if (input[4] <= 5222.830078125) {
-                            var18 = 5218.459807692308;
-                        } else {
-                            var18 = 5258.992307692307;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5358.670166015625) {
-                        if (input[0] <= 5324.330078125) {
-                            var18 = 5305.3462500000005;
-                        } else {
-                            var18 = 5347.177647058824;
-                        }
-                    } else {
-                        if (input[2] <= 5393.77490234375) {
-                            var18 = 5373.931428571429;
-                        } else {
-                            var18 = 5403.946666666667;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var19;
-    if (input[0] <= 1909.3450317382812) {
-        if (input[0] <= 1433.9149780273438) {
-            if (input[0] <= 1333.9450073242188) {
-                if (input[0] <= 1264.5) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[4] <= 1258.39501953125) {
-                            var19 = 1256.830497382198;
-                        } else {
-                            var19 = 1258.737653061225;
-                        }
-                    } else {
-                        if (input[3] <= 1256.8699951171875) {
-                            var19 = 1282.5600000000002;
-                        } else {
-                            var19 = 1261.4177358490572;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1258.39501953125) {
-                        var19 = 4548.23;
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var19 = 1494.3794117647058;
-                        } else {
-                            var19 = 1278.5878885630493;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1301.8900146484375) {
-                    if (input[3] <= 1288.9199829101562) {
-                        var19 = 2052.81;
-                    } else {
-                        var19 = 1704.82;
-                    }
-                } else {
-                    if (input[3] <= 1385.8400268554688) {
-                        if (input[2] <= 1376.6799926757812) {
-                            var19 = 1396.7749999999999;
-                        } else {
-                            var19 = 1452.688;
-                        }
-                    } else {
-                        if (input[3] <= 2993.7449340820312) {
-                            var19 = 1352.26;
-                        } else {
-                            var19 = 1300.3675;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1377.4450073242188) {
-                if (input[2] <= 1317.9199829101562) {
-                    var19 = 3421.86;
-                } else {
-                    var19 = 4629.12;
-                }
-            } else {
-                if (input[0] <= 1797.9249877929688) {
-                    if (input[1] <= 1531.5950317382812) {
-                        if (input[4] <= 1349.9700317382812) {
-                            var19 = 1549.1433333333334;
-                        } else {
-                            var19 = 1755.19;
-                        }
-                    } else {
-                        if (input[1] <= 3183.760009765625) {
-                            var19 = 1495.3475;
-                        } else {
-                            var19 = 1350.73;
-                        }
-                    }
-                } else {
-                    var19 = 2181.01;
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4533.72998046875) {
-            if (input[3] <= 5160.255126953125) {
-                if (input[0] <= 3079.2099609375) {
-                    if (input[2] <= 1565.1699829101562) {
-                        if (input[1] <= 1469.7799682617188) {
-                            var19 = 4789.682;
-                        } else {
-                            var19 = 3922.47;
-                        }
-                    } else {
-                        if (input[3] <= 4781.7451171875) {
-                            var19 = 2334.401875;
-                        } else {
-                            var19 = 3628.335714285714;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 1381.2550048828125) {
-                        if (input[4] <= 1291.9700317382812) {
-                            var19 = 4884.003333333333;
-                        } else {
-                            var19 = 1417.8899999999999;
-                        }
-                    } else {
-                        if (input[0] <= 4177.35498046875) {
-                            var19 = 3909.2697058823524;
-                        } else {
-                            var19 = 4474.4073684210525;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4243.739990234375) {
-                    var19 = 1349.21;
-                } else {
-                    var19 = 1280.53;
-                }
-            }
-        } else {
-            if (input[0] <= 4892.400146484375) {
-                if (input[3] <= 5154.9150390625) {
-                    if (input[0] <= 4708.48486328125) {
-                        if (input[2] <= 4521.52001953125) {
-                            var19 = 4785.017857142857;
-                        } else {
-                            var19 = 4600.776024844719;
-                        }
-                    } else {
-                        if (input[2] <= 4658.8798828125) {
-                            var19 = 5081.400000000001;
-                        } else {
-                            var19 = 4810.10375;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5216.72998046875) {
-                        if (input[1] <= 4921.39501953125) {
-                            var19 = 1286.63;
-                        } else {
-                            var19 = 1563.8999999999999;
-                        }
-                    } else {
-                        if (input[2] <= 4946.580078125) {
-                            var19 = 1303.42;
-                        } else {
-                            var19 = 3342.66;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5156.440185546875) {
-                    if (input[0] <= 5057.235107421875) {
-                        if (input[3] <= 5131.260009765625) {
-                            var19 = 5012.564545454545;
-                        } else {
-                            var19 = 4821.663846153847;
-                        }
-                    } else {
-                        if (input[3] <= 5211.39013671875) {
-                            var19 = 5107.924999999999;
-                        } else {
-                            var19 = 4936.988571428572;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5275.489990234375) {
-                        if (input[0] <= 5204.51513671875) {
-                            var19 = 5159.786730769231;
-                        } else {
-                            var19 = 5222.563382352941;
-                        }
-                    } else {
-                        if (input[0] <= 5340.35498046875) {
-                            var19 = 5293.488823529413;
-                        } else {
-                            var19 = 5381.30888888889;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var20;
-    if (input[0] <= 2865.5399169921875) {
-        if (input[0] <= 1630.7999877929688) {
-            if (input[0] <= 1433.9149780273438) {
-                if (input[0] <= 1333.1799926757812) {
-                    if (input[0] <= 1266.0250244140625) {
-                        if (input[3] <= 1266.0250244140625) {
-                            var20 = 1258.266488413547;
-                        } else {
-                            var20 = 1136.2930000000001;
-                        }
-                    } else {
-                        if (input[2] <= 1264.5) {
-                            var20 = 2941.47;
-                        } else {
-                            var20 = 1285.3528220858896;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1304.1799926757812) {
-                        if (input[1] <= 1291.9700317382812) {
-                            var20 = 2466.42;
-                        } else {
-                            var20 = 1990.2350000000001;
-                        }
-                    } else {
-                        if (input[0] <= 1409.4950561523438) {
-                            var20 = 1341.45;
-                        } else {
-                            var20 = 1445.364;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 1419.4150390625) {
-                    if (input[3] <= 1276.7100219726562) {
-                        var20 = 3220.39;
-                    } else {
-                        var20 = 3421.86;
-                    }
-                } else {
-                    if (input[3] <= 1567.4599609375) {
-                        if (input[0] <= 1509.4600219726562) {
-                            var20 = 1533.88;
-                        } else {
-                            var20 = 1755.19;
-                        }
-                    } else {
-                        if (input[2] <= 3117.3650512695312) {
-                            var20 = 1439.472857142857;
-                        } else {
-                            var20 = 1306.9766666666667;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1454.5150146484375) {
-                if (input[2] <= 1334.7049560546875) {
-                    var20 = 3922.47;
-                } else {
-                    if (input[1] <= 1452.22998046875) {
-                        var20 = 4952.69;
-                    } else {
-                        if (input[2] <= 1358.364990234375) {
-                            var20 = 4629.12;
-                        } else {
-                            var20 = 4681.01;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 2500.0) {
-                    if (input[3] <= 3956.81005859375) {
-                        if (input[1] <= 2131.4100341796875) {
-                            var20 = 2168.42;
-                        } else {
-                            var20 = 2769.9575;
-                        }
-                    } else {
-                        var20 = 3821.73;
-                    }
-                } else {
-                    if (input[1] <= 4043.0399169921875) {
-                        if (input[4] <= 4171.2451171875) {
-                            var20 = 1704.82;
-                        } else {
-                            var20 = 2230.1083333333336;
-                        }
-                    } else {
-                        var20 = 1265.26;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4863.400146484375) {
-            if (input[3] <= 5154.9150390625) {
-                if (input[0] <= 4303.264892578125) {
-                    if (input[2] <= 1469.7799682617188) {
-                        if (input[4] <= 2974.6649169921875) {
-                            var20 = 5183.15;
-                        } else {
-                            var20 = 4681.01;
-                        }
-                    } else {
-                        if (input[4] <= 5241.909912109375) {
-                            var20 = 3947.3286842105267;
-                        } else {
-                            var20 = 1944.44;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4677.2001953125) {
-                        if (input[0] <= 4668.039794921875) {
-                            var20 = 4596.514545454543;
-                        } else {
-                            var20 = 4205.58625;
-                        }
-                    } else {
-                        if (input[4] <= 5223.594970703125) {
-                            var20 = 4770.823039215686;
-                        } else {
-                            var20 = 4183.46;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 4927.5) {
-                    if (input[4] <= 5245.724853515625) {
-                        if (input[3] <= 5186.965087890625) {
-                            var20 = 1303.42;
-                        } else {
-                            var20 = 1284.5966666666666;
-                        }
-                    } else {
-                        if (input[3] <= 5157.969970703125) {
-                            var20 = 3147.13;
-                        } else {
-                            var20 = 2312.27;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5247.255126953125) {
-                        if (input[2] <= 5060.2900390625) {
-                            var20 = 3553.6233333333334;
-                        } else {
-                            var20 = 4948.11;
-                        }
-                    } else {
-                        var20 = 1613.25;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5099.969970703125) {
-                if (input[3] <= 5165.594970703125) {
-                    if (input[0] <= 4932.079833984375) {
-                        if (input[4] <= 5056.469970703125) {
-                            var20 = 4894.281333333332;
-                        } else {
-                            var20 = 5000.654285714286;
-                        }
-                    } else {
-                        if (input[0] <= 5054.945068359375) {
-                            var20 = 5003.053033707865;
-                        } else {
-                            var20 = 5081.798125000001;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 4030.8299560546875) {
-                        var20 = 3992.67;
-                    } else {
-                        if (input[3] <= 5172.465087890625) {
-                            var20 = 4311.66;
-                        } else {
-                            var20 = 4806.267333333334;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5275.489990234375) {
-                    if (input[0] <= 5182.385009765625) {
-                        if (input[3] <= 5220.544921875) {
-                            var20 = 5135.771075268817;
-                        } else {
-                            var20 = 5043.1594444444445;
-                        }
-                    } else {
-                        if (input[3] <= 4507.78515625) {
-                            var20 = 5255.952;
-                        } else {
-                            var20 = 5209.033437499998;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5309.829833984375) {
-                        if (input[1] <= 5289.98486328125) {
-                            var20 = 5283.447142857142;
-                        } else {
-                            var20 = 5304.794;
-                        }
-                    } else {
-                        if (input[0] <= 5383.85009765625) {
-                            var20 = 5357.612307692307;
-                        } else {
-                            var20 = 5394.870800000001;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var21;
-    if (input[0] <= 1909.3450317382812) {
-        if (input[0] <= 1433.9149780273438) {
-            if (input[4] <= 1270.60498046875) {
-                if (input[0] <= 1275.9450073242188) {
-                    if (input[0] <= 1261.4450073242188) {
-                        if (input[0] <= 1258.39501953125) {
-                            var21 = 1256.998935064935;
-                        } else {
-                            var21 = 1259.9207142857135;
-                        }
-                    } else {
-                        if (input[0] <= 1264.5) {
-                            var21 = 1262.3599999999994;
-                        } else {
-                            var21 = 1267.0077142857142;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1263.7350463867188) {
-                        if (input[2] <= 1275.1800537109375) {
-                            var21 = 1308.0;
-                        } else {
-                            var21 = 1297.315;
-                        }
-                    } else {
-                        if (input[3] <= 1285.8699951171875) {
-                            var21 = 1289.03;
-                        } else {
-                            var21 = 1280.7816666666665;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1266.7899780273438) {
-                    if (input[4] <= 1272.1300048828125) {
-                        var21 = 4548.23;
-                    } else {
-                        if (input[4] <= 2988.4000854492188) {
-                            var21 = 1266.79;
-                        } else {
-                            var21 = 1927.66;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1312.5750122070312) {
-                        if (input[0] <= 1284.3399658203125) {
-                            var21 = 1275.3076351351344;
-                        } else {
-                            var21 = 1305.8406666666663;
-                        }
-                    } else {
-                        if (input[1] <= 1307.9949951171875) {
-                            var21 = 1820.8166666666666;
-                        } else {
-                            var21 = 1340.2744117647057;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1377.4450073242188) {
-                if (input[0] <= 1571.2749633789062) {
-                    var21 = 3421.86;
-                } else {
-                    var21 = 4629.12;
-                }
-            } else {
-                if (input[0] <= 1723.905029296875) {
-                    if (input[3] <= 1852.8699340820312) {
-                        if (input[2] <= 1465.2000122070312) {
-                            var21 = 1501.32;
-                        } else {
-                            var21 = 1755.1899999999998;
-                        }
-                    } else {
-                        if (input[3] <= 3864.469970703125) {
-                            var21 = 1474.8700000000001;
-                        } else {
-                            var21 = 1350.73;
-                        }
-                    }
-                } else {
-                    var21 = 2181.01;
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4824.47998046875) {
-            if (input[0] <= 3995.7249755859375) {
-                if (input[2] <= 1992.5199584960938) {
-                    if (input[0] <= 3433.3050537109375) {
-                        if (input[4] <= 2977.7149047851562) {
-                            var21 = 5067.92;
-                        } else {
-                            var21 = 4681.01;
-                        }
-                    } else {
-                        var21 = 4049.15;
-                    }
-                } else {
-                    if (input[0] <= 3431.780029296875) {
-                        if (input[1] <= 2013.125) {
-                            var21 = 3821.73;
-                        } else {
-                            var21 = 2574.69705882353;
-                        }
-                    } else {
-                        if (input[1] <= 4334.554931640625) {
-                            var21 = 3875.2372222222225;
-                        } else {
-                            var21 = 1349.21;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 5141.18017578125) {
-                    if (input[0] <= 4530.675048828125) {
-                        if (input[4] <= 1381.2550048828125) {
-                            var21 = 2030.5259999999998;
-                        } else {
-                            var21 = 4418.200972222221;
-                        }
-                    } else {
-                        if (input[0] <= 4669.56494140625) {
-                            var21 = 4559.481678832116;
-                        } else {
-                            var21 = 4718.197636363636;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 5006.10498046875) {
-                        if (input[4] <= 5245.72998046875) {
-                            var21 = 3826.31;
-                        } else {
-                            var21 = 3147.13;
-                        }
-                    } else {
-                        var21 = 1613.25;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5121.3349609375) {
-                if (input[4] <= 5220.544921875) {
-                    if (input[0] <= 4925.974853515625) {
-                        if (input[1] <= 4802.349853515625) {
-                            var21 = 5145.604;
-                        } else {
-                            var21 = 4867.822602739728;
-                        }
-                    } else {
-                        if (input[3] <= 5144.994873046875) {
-                            var21 = 5066.771224489796;
-                        } else {
-                            var21 = 4843.81375;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5228.175048828125) {
-                        if (input[3] <= 5194.60009765625) {
-                            var21 = 2991.45;
-                        } else {
-                            var21 = 3417.28;
-                        }
-                    } else {
-                        if (input[1] <= 5000.0) {
-                            var21 = 5021.37;
-                        } else {
-                            var21 = 4856.533333333334;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 5286.93505859375) {
-                    if (input[1] <= 3208.9400024414062) {
-                        var21 = 4496.34;
-                    } else {
-                        if (input[0] <= 5204.51513671875) {
-                            var21 = 5142.157547169813;
-                        } else {
-                            var21 = 5227.0449367088595;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5342.64501953125) {
-                        if (input[0] <= 5299.14501953125) {
-                            var21 = 5284.6449999999995;
-                        } else {
-                            var21 = 5331.366666666667;
-                        }
-                    } else {
-                        if (input[4] <= 5383.85009765625) {
-                            var21 = 5403.864444444445;
-                        } else {
-                            var21 = 5363.248461538462;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var22;
-    if (input[0] <= 3099.054931640625) {
-        if (input[0] <= 1433.9149780273438) {
-            if (input[0] <= 627.2899780273438) {
-                var22 = 5024.42;
-            } else {
-                if (input[0] <= 1332.4199829101562) {
-                    if (input[0] <= 1264.5) {
-                        if (input[0] <= 1259.9200439453125) {
-                            var22 = 1257.4425635103921;
-                        } else {
-                            var22 = 1261.5259701492544;
-                        }
-                    } else {
-                        if (input[2] <= 1259.9199829101562) {
-                            var22 = 4548.23;
-                        } else {
-                            var22 = 1292.3189972144853;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 1322.5) {
-                        if (input[3] <= 1288.9199829101562) {
-                            var22 = 2002.75;
-                        } else {
-                            var22 = 1704.82;
-                        }
-                    } else {
-                        if (input[0] <= 1352.260009765625) {
-                            var22 = 1321.2266666666667;
-                        } else {
-                            var22 = 1411.1299999999999;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1394.2300415039062) {
-                if (input[2] <= 1334.7049560546875) {
-                    if (input[4] <= 4877.900146484375) {
-                        if (input[2] <= 1304.9450073242188) {
-                            var22 = 3421.86;
-                        } else {
-                            var22 = 3220.39;
-                        }
-                    } else {
-                        if (input[2] <= 1311.8099975585938) {
-                            var22 = 3644.69;
-                        } else {
-                            var22 = 3922.47;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1990.2350463867188) {
-                        if (input[3] <= 1285.8699951171875) {
-                            var22 = 4681.01;
-                        } else {
-                            var22 = 4629.12;
-                        }
-                    } else {
-                        var22 = 4952.69;
-                    }
-                }
-            } else {
-                if (input[0] <= 1797.9249877929688) {
-                    if (input[1] <= 3183.760009765625) {
-                        if (input[2] <= 1520.9100341796875) {
-                            var22 = 1617.8257142857142;
-                        } else {
-                            var22 = 1498.78;
-                        }
-                    } else {
-                        if (input[4] <= 3276.1000366210938) {
-                            var22 = 1350.73;
-                        } else {
-                            var22 = 1285.1;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 2560.2900390625) {
-                        if (input[3] <= 4339.1298828125) {
-                            var22 = 2100.758333333333;
-                        } else {
-                            var22 = 2850.275;
-                        }
-                    } else {
-                        if (input[4] <= 4774.875) {
-                            var22 = 2779.68625;
-                        } else {
-                            var22 = 3710.32;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4776.39990234375) {
-            if (input[3] <= 5173.989990234375) {
-                if (input[0] <= 4297.159912109375) {
-                    if (input[0] <= 4262.054931640625) {
-                        if (input[4] <= 4472.679931640625) {
-                            var22 = 3769.0347058823527;
-                        } else {
-                            var22 = 4297.821999999999;
-                        }
-                    } else {
-                        var22 = 1393.47;
-                    }
-                } else {
-                    if (input[0] <= 4669.56494140625) {
-                        if (input[0] <= 4668.039794921875) {
-                            var22 = 4574.619054054052;
-                        } else {
-                            var22 = 2913.6150000000002;
-                        }
-                    } else {
-                        if (input[1] <= 4548.22998046875) {
-                            var22 = 4908.169999999999;
-                        } else {
-                            var22 = 4707.0599999999995;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 4892.39990234375) {
-                    if (input[2] <= 4991.60498046875) {
-                        var22 = 1280.53;
-                    } else {
-                        var22 = 1349.21;
-                    }
-                } else {
-                    var22 = 1465.2;
-                }
-            }
-        } else {
-            if (input[0] <= 5070.969970703125) {
-                if (input[3] <= 5162.545166015625) {
-                    if (input[0] <= 4905.369873046875) {
-                        if (input[2] <= 4752.75) {
-                            var22 = 4985.7072727272725;
-                        } else {
-                            var22 = 4858.411739130434;
-                        }
-                    } else {
-                        if (input[4] <= 5028.235107421875) {
-                            var22 = 4968.415918367347;
-                        } else {
-                            var22 = 5045.15104477612;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4970.239990234375) {
-                        var22 = 2991.45;
-                    } else {
-                        if (input[0] <= 5069.445068359375) {
-                            var22 = 4740.1788235294125;
-                        } else {
-                            var22 = 3992.67;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5204.51513671875) {
-                    if (input[3] <= 5251.070068359375) {
-                        if (input[3] <= 5023.66015625) {
-                            var22 = 5188.958888888888;
-                        } else {
-                            var22 = 5113.074296874997;
-                        }
-                    } else {
-                        if (input[4] <= 3088.3701171875) {
-                            var22 = 4618.44;
-                        } else {
-                            var22 = 4913.0;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5341.114990234375) {
-                        if (input[0] <= 5275.489990234375) {
-                            var22 = 5222.6359999999995;
-                        } else {
-                            var22 = 5295.9712;
-                        }
-                    } else {
-                        if (input[2] <= 5402.1650390625) {
-                            var22 = 5376.578;
-                        } else {
-                            var22 = 5409.4175000000005;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var23;
-    if (input[0] <= 1630.7999877929688) {
-        if (input[0] <= 1465.9649658203125) {
-            if (input[4] <= 1266.0250244140625) {
-                if (input[2] <= 1282.050048828125) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[0] <= 1258.39501953125) {
-                            var23 = 1256.793966480446;
-                        } else {
-                            var23 = 1259.0507070707076;
-                        }
-                    } else {
-                        if (input[2] <= 1258.39501953125) {
-                            var23 = 1289.68;
-                        } else {
-                            var23 = 1261.9936666666674;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 1258.39501953125) {
-                        if (input[3] <= 1263.7350463867188) {
-                            var23 = 1295.79;
-                        } else {
-                            var23 = 1288.3742857142859;
-                        }
-                    } else {
-                        if (input[0] <= 1285.10498046875) {
-                            var23 = 1279.0;
-                        } else {
-                            var23 = 1280.53;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1266.0250244140625) {
-                    if (input[0] <= 1266.0250244140625) {
-                        if (input[2] <= 1261.4450073242188) {
-                            var23 = 1264.5;
-                        } else {
-                            var23 = 2757.3239999999996;
-                        }
-                    } else {
-                        if (input[4] <= 1269.844970703125) {
-                            var23 = 4674.91;
-                        } else {
-                            var23 = 4548.23;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1314.864990234375) {
-                        if (input[2] <= 1266.0250244140625) {
-                            var23 = 1157.2783333333334;
-                        } else {
-                            var23 = 1281.992320261439;
-                        }
-                    } else {
-                        if (input[2] <= 1307.9949951171875) {
-                            var23 = 1486.876;
-                        } else {
-                            var23 = 1358.6258536585365;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1692.6150512695312) {
-                if (input[3] <= 1285.1050415039062) {
-                    var23 = 3220.39;
-                } else {
-                    var23 = 3644.69;
-                }
-            } else {
-                if (input[1] <= 2995.2649536132812) {
-                    if (input[2] <= 1630.7999877929688) {
-                        if (input[4] <= 3396.669921875) {
-                            var23 = 1423.99;
-                        } else {
-                            var23 = 1443.83;
-                        }
-                    } else {
-                        if (input[2] <= 1893.3150024414062) {
-                            var23 = 1466.73;
-                        } else {
-                            var23 = 1491.15;
-                        }
-                    }
-                } else {
-                    var23 = 1350.73;
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4863.400146484375) {
-            if (input[0] <= 3597.375) {
-                if (input[2] <= 1992.5199584960938) {
-                    if (input[0] <= 3332.5699462890625) {
-                        if (input[1] <= 1452.22998046875) {
-                            var23 = 5098.19;
-                        } else {
-                            var23 = 4669.478888888889;
-                        }
-                    } else {
-                        var23 = 4049.15;
-                    }
-                } else {
-                    if (input[0] <= 2739.625) {
-                        if (input[4] <= 4969.47509765625) {
-                            var23 = 2070.8892307692304;
-                        } else {
-                            var23 = 3520.1459999999997;
-                        }
-                    } else {
-                        if (input[0] <= 2954.0599365234375) {
-                            var23 = 3105.92;
-                        } else {
-                            var23 = 3474.443636363636;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 5158.72998046875) {
-                    if (input[0] <= 4297.159912109375) {
-                        if (input[4] <= 1929.945068359375) {
-                            var23 = 1393.47;
-                        } else {
-                            var23 = 4211.000476190477;
-                        }
-                    } else {
-                        if (input[4] <= 5240.385009765625) {
-                            var23 = 4650.157869415811;
-                        } else {
-                            var23 = 3554.6380000000004;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4943.52490234375) {
-                        if (input[4] <= 5245.724853515625) {
-                            var23 = 1339.6675;
-                        } else {
-                            var23 = 2312.27;
-                        }
-                    } else {
-                        var23 = 3417.28;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5110.655029296875) {
-                if (input[3] <= 5261.755126953125) {
-                    if (input[3] <= 5144.994873046875) {
-                        if (input[0] <= 4938.18505859375) {
-                            var23 = 4896.49530612245;
-                        } else {
-                            var23 = 5049.21080882353;
-                        }
-                    } else {
-                        if (input[1] <= 4990.844970703125) {
-                            var23 = 2991.45;
-                        } else {
-                            var23 = 4863.753076923077;
-                        }
-                    }
-                } else {
-                    var23 = 3992.67;
-                }
-            } else {
-                if (input[0] <= 5267.85498046875) {
-                    if (input[0] <= 5181.625) {
-                        if (input[2] <= 5248.02001953125) {
-                            var23 = 5136.107777777777;
-                        } else {
-                            var23 = 4618.44;
-                        }
-                    } else {
-                        if (input[0] <= 5208.3349609375) {
-                            var23 = 5181.543157894737;
-                        } else {
-                            var23 = 5225.674615384616;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5342.64501953125) {
-                        if (input[0] <= 5288.4599609375) {
-                            var23 = 5260.553571428572;
-                        } else {
-                            var23 = 5308.218888888889;
-                        }
-                    } else {
-                        if (input[2] <= 5396.824951171875) {
-                            var23 = 5374.542666666666;
-                        } else {
-                            var23 = 5408.655000000001;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var24;
-    if (input[0] <= 2865.5399169921875) {
-        if (input[0] <= 1465.9649658203125) {
-            if (input[0] <= 1332.4149780273438) {
-                if (input[0] <= 1264.5) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[4] <= 1258.39501953125) {
-                            var24 = 1256.8331621621617;
-                        } else {
-                            var24 = 1259.0274285714295;
-                        }
-                    } else {
-                        if (input[3] <= 1256.8699951171875) {
-                            var24 = 1279.0;
-                        } else {
-                            var24 = 1261.6409090909094;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1258.39501953125) {
-                        var24 = 4548.23;
-                    } else {
-                        if (input[2] <= 1264.5) {
-                            var24 = 1856.1766666666665;
-                        } else {
-                            var24 = 1293.4653804347834;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 1300.364990234375) {
-                    if (input[0] <= 1386.5999755859375) {
-                        if (input[1] <= 1291.9700317382812) {
-                            var24 = 2466.42;
-                        } else {
-                            var24 = 2052.81;
-                        }
-                    } else {
-                        var24 = 3421.86;
-                    }
-                } else {
-                    if (input[3] <= 1307.9949951171875) {
-                        var24 = 1704.82;
-                    } else {
-                        if (input[4] <= 1443.0750122070312) {
-                            var24 = 1443.7153846153847;
-                        } else {
-                            var24 = 1338.382727272727;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1374.3900146484375) {
-                if (input[4] <= 4693.22509765625) {
-                    if (input[2] <= 1327.8399658203125) {
-                        var24 = 5170.94;
-                    } else {
-                        if (input[2] <= 1358.364990234375) {
-                            var24 = 4629.12;
-                        } else {
-                            var24 = 4681.01;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1469.7799682617188) {
-                        var24 = 3220.39;
-                    } else {
-                        if (input[1] <= 1403.3849487304688) {
-                            var24 = 3644.69;
-                        } else {
-                            var24 = 3922.47;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 3704.9749755859375) {
-                    if (input[0] <= 2131.4100341796875) {
-                        if (input[3] <= 1794.1100463867188) {
-                            var24 = 2175.67;
-                        } else {
-                            var24 = 1512.5166666666667;
-                        }
-                    } else {
-                        if (input[2] <= 2564.864990234375) {
-                            var24 = 2610.196;
-                        } else {
-                            var24 = 2172.1116666666667;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 3015.1100463867188) {
-                        var24 = 1350.73;
-                    } else {
-                        if (input[3] <= 4948.10498046875) {
-                            var24 = 1265.26;
-                        } else {
-                            var24 = 1289.68;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4824.47998046875) {
-            if (input[3] <= 5168.650146484375) {
-                if (input[0] <= 4533.72998046875) {
-                    if (input[4] <= 1415.5950317382812) {
-                        if (input[1] <= 4579.51513671875) {
-                            var24 = 1458.5900000000001;
-                        } else {
-                            var24 = 4285.71;
-                        }
-                    } else {
-                        if (input[0] <= 3736.2650146484375) {
-                            var24 = 3596.8666666666663;
-                        } else {
-                            var24 = 4355.473333333332;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5219.01513671875) {
-                        if (input[0] <= 4688.64501953125) {
-                            var24 = 4538.951732283467;
-                        } else {
-                            var24 = 4742.7997752809;
-                        }
-                    } else {
-                        if (input[4] <= 5245.72998046875) {
-                            var24 = 3969.1699999999996;
-                        } else {
-                            var24 = 3147.13;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 5197.650146484375) {
-                    if (input[2] <= 4921.39501953125) {
-                        var24 = 1280.53;
-                    } else {
-                        var24 = 1303.42;
-                    }
-                } else {
-                    if (input[1] <= 5000.0) {
-                        var24 = 1465.2;
-                    } else {
-                        var24 = 1613.25;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5070.969970703125) {
-                if (input[3] <= 5144.994873046875) {
-                    if (input[0] <= 4948.869873046875) {
-                        if (input[2] <= 4760.3798828125) {
-                            var24 = 5168.105714285714;
-                        } else {
-                            var24 = 4891.570571428571;
-                        }
-                    } else {
-                        if (input[3] <= 4809.219970703125) {
-                            var24 = 5146.825999999999;
-                        } else {
-                            var24 = 5014.509090909092;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4897.7451171875) {
-                        if (input[1] <= 4970.239990234375) {
-                            var24 = 3204.365;
-                        } else {
-                            var24 = 4948.11;
-                        }
-                    } else {
-                        if (input[3] <= 5172.465087890625) {
-                            var24 = 4453.908;
-                        } else {
-                            var24 = 4779.416842105264;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5182.385009765625) {
-                    if (input[3] <= 5264.804931640625) {
-                        if (input[1] <= 3208.9400024414062) {
-                            var24 = 4496.34;
-                        } else {
-                            var24 = 5109.578106060606;
-                        }
-                    } else {
-                        var24 = 4618.44;
-                    }
-                } else {
-                    if (input[0] <= 5290.75) {
-                        if (input[0] <= 5217.489990234375) {
-                            var24 = 5191.629682539683;
-                        } else {
-                            var24 = 5240.632253521125;
-                        }
-                    } else {
-                        if (input[0] <= 5338.065185546875) {
-                            var24 = 5326.822;
-                        } else {
-                            var24 = 5396.626086956521;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var25;
-    if (input[0] <= 2799.909912109375) {
-        if (input[0] <= 1465.9649658203125) {
-            if (input[4] <= 1266.0250244140625) {
-                if (input[0] <= 1269.0799560546875) {
-                    if (input[0] <= 1258.39501953125) {
-                        if (input[1] <= 1256.8699951171875) {
-                            var25 = 1256.4424479166655;
-                        } else {
-                            var25 = 1257.5470555555564;
-                        }
-                    } else {
-                        if (input[0] <= 1261.4450073242188) {
-                            var25 = 1259.491197183099;
-                        } else {
-                            var25 = 1262.5688235294117;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 1292.7350463867188) {
-                        if (input[4] <= 1258.39501953125) {
-                            var25 = 1272.5125;
-                        } else {
-                            var25 = 1279.7649999999999;
-                        }
-                    } else {
-                        if (input[0] <= 1301.1300048828125) {
-                            var25 = 1288.5375000000001;
-                        } else {
-                            var25 = 1297.315;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1266.0250244140625) {
-                    if (input[0] <= 1266.0250244140625) {
-                        if (input[1] <= 1261.4450073242188) {
-                            var25 = 1264.7566666666667;
-                        } else {
-                            var25 = 2508.4777777777776;
-                        }
-                    } else {
-                        var25 = 4548.23;
-                    }
-                } else {
-                    if (input[0] <= 1312.5750122070312) {
-                        if (input[4] <= 1267.5549926757812) {
-                            var25 = 1054.6383333333333;
-                        } else {
-                            var25 = 1280.907535714286;
-                        }
-                    } else {
-                        if (input[2] <= 1307.9949951171875) {
-                            var25 = 1725.9714285714285;
-                        } else {
-                            var25 = 1366.4155;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1351.4949951171875) {
-                if (input[2] <= 1334.7049560546875) {
-                    if (input[3] <= 1275.9450073242188) {
-                        var25 = 3220.39;
-                    } else {
-                        if (input[4] <= 5090.81005859375) {
-                            var25 = 3922.47;
-                        } else {
-                            var25 = 3644.69;
-                        }
-                    }
-                } else {
-                    var25 = 4952.69;
-                }
-            } else {
-                if (input[0] <= 1797.9249877929688) {
-                    if (input[2] <= 3305.860107421875) {
-                        if (input[2] <= 1520.9100341796875) {
-                            var25 = 1612.8650000000002;
-                        } else {
-                            var25 = 1503.97;
-                        }
-                    } else {
-                        if (input[3] <= 5183.14990234375) {
-                            var25 = 1350.73;
-                        } else {
-                            var25 = 1289.68;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 2545.7899780273438) {
-                        if (input[2] <= 2241.2999877929688) {
-                            var25 = 2406.135;
-                        } else {
-                            var25 = 2916.67;
-                        }
-                    } else {
-                        if (input[3] <= 4210.925048828125) {
-                            var25 = 1950.5525;
-                        } else {
-                            var25 = 1265.26;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4780.21484375) {
-            if (input[3] <= 5154.9150390625) {
-                if (input[0] <= 4291.81494140625) {
-                    if (input[0] <= 4252.135009765625) {
-                        if (input[0] <= 3419.570068359375) {
-                            var25 = 3216.956875;
-                        } else {
-                            var25 = 4180.402857142856;
-                        }
-                    } else {
-                        var25 = 1393.47;
-                    }
-                } else {
-                    if (input[0] <= 4689.41015625) {
-                        if (input[2] <= 4698.56494140625) {
-                            var25 = 4583.295075376883;
-                        } else {
-                            var25 = 3928.9524999999994;
-                        }
-                    } else {
-                        if (input[1] <= 4657.35498046875) {
-                            var25 = 4825.2474999999995;
-                        } else {
-                            var25 = 4717.073582089554;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 4858.824951171875) {
-                    if (input[1] <= 4736.724853515625) {
-                        var25 = 1349.21;
-                    } else {
-                        var25 = 1280.53;
-                    }
-                } else {
-                    if (input[3] <= 5157.969970703125) {
-                        var25 = 3147.13;
-                    } else {
-                        var25 = 2312.27;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5069.445068359375) {
-                if (input[2] <= 5079.364990234375) {
-                    if (input[0] <= 4907.659912109375) {
-                        if (input[4] <= 5224.360107421875) {
-                            var25 = 4879.407999999998;
-                        } else {
-                            var25 = 4183.46;
-                        }
-                    } else {
-                        if (input[3] <= 4809.219970703125) {
-                            var25 = 5124.815;
-                        } else {
-                            var25 = 4983.55188235294;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4902.320068359375) {
-                        var25 = 2991.4499999999994;
-                    } else {
-                        if (input[1] <= 5092.340087890625) {
-                            var25 = 4629.8835714285715;
-                        } else {
-                            var25 = 4843.255;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5217.489990234375) {
-                    if (input[2] <= 3131.1050415039062) {
-                        var25 = 4496.34;
-                    } else {
-                        if (input[0] <= 5182.385009765625) {
-                            var25 = 5106.746600000001;
-                        } else {
-                            var25 = 5182.554878048781;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5340.35498046875) {
-                        if (input[0] <= 5267.85498046875) {
-                            var25 = 5234.909999999999;
-                        } else {
-                            var25 = 5298.3054999999995;
-                        }
-                    } else {
-                        if (input[2] <= 5396.824951171875) {
-                            var25 = 5371.751785714287;
-                        } else {
-                            var25 = 5405.9818749999995;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var26;
-    if (input[0] <= 3078.449951171875) {
-        if (input[0] <= 1666.6649780273438) {
-            if (input[0] <= 627.2899780273438) {
-                var26 = 5024.42;
-            } else {
-                if (input[0] <= 1430.8599853515625) {
-                    if (input[4] <= 1266.0250244140625) {
-                        if (input[0] <= 1279.0) {
-                            var26 = 1258.4359198542809;
-                        } else {
-                            var26 = 1294.044285714286;
-                        }
-                    } else {
-                        if (input[3] <= 1261.4450073242188) {
-                            var26 = 3177.657142857143;
-                        } else {
-                            var26 = 1303.4558753709198;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1353.7850341796875) {
-                        if (input[4] <= 4809.97998046875) {
-                            var26 = 3421.86;
-                        } else {
-                            var26 = 3644.69;
-                        }
-                    } else {
-                        if (input[3] <= 1575.0899658203125) {
-                            var26 = 1633.3433333333335;
-                        } else {
-                            var26 = 1397.5366666666669;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1454.5150146484375) {
-                if (input[4] <= 4871.795166015625) {
-                    if (input[2] <= 1327.8399658203125) {
-                        var26 = 5170.94;
-                    } else {
-                        if (input[3] <= 1285.8699951171875) {
-                            var26 = 4681.01;
-                        } else {
-                            var26 = 4629.12;
-                        }
-                    }
-                } else {
-                    var26 = 3922.47;
-                }
-            } else {
-                if (input[4] <= 4969.47509765625) {
-                    if (input[0] <= 2395.449951171875) {
-                        if (input[4] <= 2700.7050170898438) {
-                            var26 = 2330.585;
-                        } else {
-                            var26 = 1652.1675;
-                        }
-                    } else {
-                        if (input[4] <= 2896.8250122070312) {
-                            var26 = 2934.79125;
-                        } else {
-                            var26 = 2416.8199999999997;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 2128.35498046875) {
-                        var26 = 3821.73;
-                    } else {
-                        var26 = 3444.75;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4892.400146484375) {
-            if (input[3] <= 5168.650146484375) {
-                if (input[0] <= 4530.675048828125) {
-                    if (input[0] <= 4528.385009765625) {
-                        if (input[4] <= 5235.804931640625) {
-                            var26 = 4345.098505747126;
-                        } else {
-                            var26 = 1944.44;
-                        }
-                    } else {
-                        var26 = 1491.15;
-                    }
-                } else {
-                    if (input[4] <= 5240.385009765625) {
-                        if (input[0] <= 4709.25) {
-                            var26 = 4608.689587628865;
-                        } else {
-                            var26 = 4800.660512820513;
-                        }
-                    } else {
-                        if (input[1] <= 4916.820068359375) {
-                            var26 = 3147.13;
-                        } else {
-                            var26 = 3826.31;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4740.5400390625) {
-                    if (input[3] <= 5280.070068359375) {
-                        if (input[0] <= 4243.739990234375) {
-                            var26 = 1349.21;
-                        } else {
-                            var26 = 1288.16;
-                        }
-                    } else {
-                        var26 = 1613.25;
-                    }
-                } else {
-                    if (input[3] <= 5194.60009765625) {
-                        var26 = 2991.4499999999994;
-                    } else {
-                        var26 = 3417.28;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5125.9150390625) {
-                if (input[3] <= 5145.760009765625) {
-                    if (input[0] <= 5044.260009765625) {
-                        if (input[0] <= 4932.079833984375) {
-                            var26 = 4917.900000000001;
-                        } else {
-                            var26 = 5013.440000000001;
-                        }
-                    } else {
-                        if (input[2] <= 5020.60498046875) {
-                            var26 = 5182.597272727274;
-                        } else {
-                            var26 = 5095.194516129033;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5281.594970703125) {
-                        if (input[0] <= 5062.5751953125) {
-                            var26 = 4767.380588235295;
-                        } else {
-                            var26 = 4923.824545454546;
-                        }
-                    } else {
-                        var26 = 3992.67;
-                    }
-                }
-            } else {
-                if (input[0] <= 5258.7001953125) {
-                    if (input[1] <= 3208.9400024414062) {
-                        var26 = 4496.34;
-                    } else {
-                        if (input[0] <= 5182.385009765625) {
-                            var26 = 5132.057380952381;
-                        } else {
-                            var26 = 5205.063253968253;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5309.829833984375) {
-                        if (input[0] <= 5289.98486328125) {
-                            var26 = 5272.386;
-                        } else {
-                            var26 = 5305.098;
-                        }
-                    } else {
-                        if (input[1] <= 5402.169921875) {
-                            var26 = 5359.0505;
-                        } else {
-                            var26 = 5400.386666666667;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var27;
-    if (input[0] <= 2902.929931640625) {
-        if (input[0] <= 1465.9649658203125) {
-            if (input[4] <= 1266.0250244140625) {
-                if (input[0] <= 1266.0250244140625) {
-                    if (input[0] <= 1258.39501953125) {
-                        if (input[0] <= 1256.8699951171875) {
-                            var27 = 1256.5554807692295;
-                        } else {
-                            var27 = 1257.4977358490582;
-                        }
-                    } else {
-                        if (input[0] <= 1261.4450073242188) {
-                            var27 = 1259.7454128440368;
-                        } else {
-                            var27 = 1262.6801923076919;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1286.6300048828125) {
-                        if (input[2] <= 1260.6849975585938) {
-                            var27 = 1306.47;
-                        } else {
-                            var27 = 1270.60375;
-                        }
-                    } else {
-                        if (input[3] <= 1275.1800537109375) {
-                            var27 = 1300.368;
-                        } else {
-                            var27 = 1286.63;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1266.0250244140625) {
-                    if (input[0] <= 1266.0250244140625) {
-                        if (input[4] <= 1267.5549926757812) {
-                            var27 = 3130.34;
-                        } else {
-                            var27 = 1262.363;
-                        }
-                    } else {
-                        if (input[4] <= 1269.844970703125) {
-                            var27 = 4674.91;
-                        } else {
-                            var27 = 4548.23;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1333.1799926757812) {
-                        if (input[0] <= 1288.9200439453125) {
-                            var27 = 1275.2632780082993;
-                        } else {
-                            var27 = 1328.8668421052632;
-                        }
-                    } else {
-                        if (input[1] <= 1301.8900146484375) {
-                            var27 = 2466.42;
-                        } else {
-                            var27 = 1384.2603333333334;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1410.2550048828125) {
-                if (input[4] <= 4693.22509765625) {
-                    if (input[1] <= 1404.1549682617188) {
-                        var27 = 5170.94;
-                    } else {
-                        if (input[2] <= 1358.364990234375) {
-                            var27 = 4629.12;
-                        } else {
-                            var27 = 4681.01;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1469.7799682617188) {
-                        var27 = 3220.39;
-                    } else {
-                        if (input[2] <= 1311.8099975585938) {
-                            var27 = 3644.69;
-                        } else {
-                            var27 = 3922.47;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 1730.0049438476562) {
-                    if (input[0] <= 1620.8800048828125) {
-                        if (input[0] <= 1585.0150146484375) {
-                            var27 = 1467.1075;
-                        } else {
-                            var27 = 1289.68;
-                        }
-                    } else {
-                        if (input[4] <= 2668.655029296875) {
-                            var27 = 1891.03;
-                        } else {
-                            var27 = 1556.78;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 4969.47509765625) {
-                        if (input[2] <= 3984.280029296875) {
-                            var27 = 2124.135333333333;
-                        } else {
-                            var27 = 1265.26;
-                        }
-                    } else {
-                        if (input[3] <= 4909.949951171875) {
-                            var27 = 3821.73;
-                        } else {
-                            var27 = 3444.75;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4858.059814453125) {
-            if (input[3] <= 5158.72998046875) {
-                if (input[0] <= 4291.81494140625) {
-                    if (input[1] <= 4413.9150390625) {
-                        if (input[0] <= 3985.0450439453125) {
-                            var27 = 3695.216315789474;
-                        } else {
-                            var27 = 4298.042307692307;
-                        }
-                    } else {
-                        if (input[4] <= 5249.5400390625) {
-                            var27 = 1668.955;
-                        } else {
-                            var27 = 3710.32;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5154.9150390625) {
-                        if (input[0] <= 4688.64501953125) {
-                            var27 = 4546.584404145077;
-                        } else {
-                            var27 = 4773.068202247192;
-                        }
-                    } else {
-                        if (input[0] <= 4797.77001953125) {
-                            var27 = 3147.13;
-                        } else {
-                            var27 = 3826.31;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4785.559814453125) {
-                    if (input[4] <= 5245.724853515625) {
-                        if (input[1] <= 4911.47998046875) {
-                            var27 = 1318.6833333333334;
-                        } else {
-                            var27 = 1613.25;
-                        }
-                    } else {
-                        var27 = 2312.27;
-                    }
-                } else {
-                    if (input[3] <= 5211.39013671875) {
-                        var27 = 4948.11;
-                    } else {
-                        var27 = 1286.63;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5127.445068359375) {
-                if (input[3] <= 5281.594970703125) {
-                    if (input[0] <= 4998.47509765625) {
-                        if (input[2] <= 5075.550048828125) {
-                            var27 = 4942.128235294118;
-                        } else {
-                            var27 = 4606.662857142857;
-                        }
-                    } else {
-                        if (input[3] <= 5154.155029296875) {
-                            var27 = 5074.9221768707475;
-                        } else {
-                            var27 = 4898.473043478261;
-                        }
-                    }
-                } else {
-                    var27 = 3992.67;
-                }
-            } else {
-                if (input[0] <= 5293.0400390625) {
-                    if (input[0] <= 5181.625) {
-                        if (input[2] <= 5042.73486328125) {
-                            var27 = 5218.085555555556;
-                        } else {
-                            var27 = 5123.315306122449;
-                        }
-                    } else {
-                        if (input[0] <= 5217.489990234375) {
-                            var27 = 5197.093220338983;
-                        } else {
-                            var27 = 5236.830609756096;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 5358.670166015625) {
-                        if (input[0] <= 5324.330078125) {
-                            var27 = 5313.83625;
-                        } else {
-                            var27 = 5344.041666666667;
-                        }
-                    } else {
-                        if (input[4] <= 5402.169921875) {
-                            var27 = 5408.715263157896;
-                        } else {
-                            var27 = 5373.579230769231;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var28;
-    if (input[0] <= 2902.929931640625) {
-        if (input[0] <= 1469.7799682617188) {
-            if (input[0] <= 627.2899780273438) {
-                var28 = 5024.42;
-            } else {
-                if (input[4] <= 1267.5549926757812) {
-                    if (input[3] <= 1266.0250244140625) {
-                        if (input[4] <= 1266.0250244140625) {
-                            var28 = 1258.2987272727278;
-                        } else {
-                            var28 = 3129.58;
-                        }
-                    } else {
-                        if (input[1] <= 1266.0250244140625) {
-                            var28 = 721.9157142857144;
-                        } else {
-                            var28 = 1269.650625;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1261.4450073242188) {
-                        if (input[1] <= 1260.6849975585938) {
-                            var28 = 1266.0275;
-                        } else {
-                            var28 = 4611.57;
-                        }
-                    } else {
-                        if (input[0] <= 1312.5750122070312) {
-                            var28 = 1283.124880546076;
-                        } else {
-                            var28 = 1384.432;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1402.6300048828125) {
-                if (input[4] <= 3173.0751342773438) {
-                    if (input[2] <= 1338.5249633789062) {
-                        if (input[0] <= 1878.8150024414062) {
-                            var28 = 5170.94;
-                        } else {
-                            var28 = 4952.69;
-                        }
-                    } else {
-                        var28 = 4629.12;
-                    }
-                } else {
-                    if (input[1] <= 1403.3849487304688) {
-                        var28 = 3644.69;
-                    } else {
-                        var28 = 3922.47;
-                    }
-                }
-            } else {
-                if (input[0] <= 2560.2900390625) {
-                    if (input[2] <= 3790.445068359375) {
-                        if (input[0] <= 2131.4100341796875) {
-                            var28 = 1882.021;
-                        } else {
-                            var28 = 2322.04;
-                        }
-                    } else {
-                        if (input[4] <= 3015.1100463867188) {
-                            var28 = 1350.73;
-                        } else {
-                            var28 = 1265.26;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 2867.06494140625) {
-                        if (input[1] <= 2622.864990234375) {
-                            var28 = 2878.0033333333336;
-                        } else {
-                            var28 = 3011.2899999999995;
-                        }
-                    } else {
-                        var28 = 2275.64;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4754.27490234375) {
-            if (input[3] <= 5135.074951171875) {
-                if (input[0] <= 4531.440185546875) {
-                    if (input[0] <= 4524.570068359375) {
-                        if (input[4] <= 4480.31005859375) {
-                            var28 = 3701.245277777778;
-                        } else {
-                            var28 = 4394.041904761905;
-                        }
-                    } else {
-                        var28 = 1491.15;
-                    }
-                } else {
-                    if (input[3] <= 4398.655029296875) {
-                        if (input[3] <= 3521.0599365234375) {
-                            var28 = 4717.007500000001;
-                        } else {
-                            var28 = 4999.695000000001;
-                        }
-                    } else {
-                        if (input[0] <= 4689.41015625) {
-                            var28 = 4595.0701550387585;
-                        } else {
-                            var28 = 4715.669827586207;
-                        }
-                    }
-                }
-            } else {
-                if (input[4] <= 5238.85986328125) {
-                    if (input[1] <= 4892.39990234375) {
-                        var28 = 1280.53;
-                    } else {
-                        if (input[4] <= 5080.89501953125) {
-                            var28 = 1613.25;
-                        } else {
-                            var28 = 1465.2;
-                        }
-                    }
-                } else {
-                    var28 = 2312.27;
-                }
-            }
-        } else {
-            if (input[0] <= 5086.235107421875) {
-                if (input[3] <= 5145.760009765625) {
-                    if (input[0] <= 4907.659912109375) {
-                        if (input[3] <= 4590.199951171875) {
-                            var28 = 5080.383333333334;
-                        } else {
-                            var28 = 4846.83974025974;
-                        }
-                    } else {
-                        if (input[4] <= 4822.190185546875) {
-                            var28 = 5152.780000000001;
-                        } else {
-                            var28 = 5011.414086956523;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4970.239990234375) {
-                        if (input[4] <= 5233.52001953125) {
-                            var28 = 2991.45;
-                        } else {
-                            var28 = 3826.31;
-                        }
-                    } else {
-                        if (input[2] <= 5194.594970703125) {
-                            var28 = 4782.829999999999;
-                        } else {
-                            var28 = 3992.67;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5217.489990234375) {
-                    if (input[1] <= 3208.9400024414062) {
-                        var28 = 4496.34;
-                    } else {
-                        if (input[0] <= 5182.39013671875) {
-                            var28 = 5112.9571428571435;
-                        } else {
-                            var28 = 5190.155641025641;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5290.75) {
-                        if (input[4] <= 1288.155029296875) {
-                            var28 = 5275.032;
-                        } else {
-                            var28 = 5229.849193548386;
-                        }
-                    } else {
-                        if (input[0] <= 5369.35498046875) {
-                            var28 = 5337.1196;
-                        } else {
-                            var28 = 5398.828125;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var29;
-    if (input[0] <= 3419.570068359375) {
-        if (input[0] <= 1430.8599853515625) {
-            if (input[0] <= 627.2899780273438) {
-                var29 = 5024.42;
-            } else {
-                if (input[0] <= 1333.1799926757812) {
-                    if (input[4] <= 1266.0250244140625) {
-                        if (input[1] <= 1280.5250244140625) {
-                            var29 = 1258.2131475409835;
-                        } else {
-                            var29 = 1291.427142857143;
-                        }
-                    } else {
-                        if (input[3] <= 1259.9199829101562) {
-                            var29 = 3495.6266666666666;
-                        } else {
-                            var29 = 1299.1754385964916;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1336.9949951171875) {
-                        if (input[2] <= 1285.864990234375) {
-                            var29 = 2466.42;
-                        } else {
-                            var29 = 2052.81;
-                        }
-                    } else {
-                        if (input[2] <= 1326.3099975585938) {
-                            var29 = 1704.82;
-                        } else {
-                            var29 = 1364.13;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1410.2550048828125) {
-                if (input[0] <= 1588.824951171875) {
-                    if (input[3] <= 1295.0250244140625) {
-                        if (input[2] <= 1304.9450073242188) {
-                            var29 = 3421.86;
-                        } else {
-                            var29 = 3220.39;
-                        }
-                    } else {
-                        var29 = 3644.69;
-                    }
-                } else {
-                    if (input[3] <= 1278.2349853515625) {
-                        var29 = 4681.01;
-                    } else {
-                        if (input[1] <= 1389.6549682617188) {
-                            var29 = 5170.94;
-                        } else {
-                            var29 = 4952.69;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 2131.4100341796875) {
-                    if (input[3] <= 1605.614990234375) {
-                        if (input[4] <= 1376.6799926757812) {
-                            var29 = 1607.6500000000003;
-                        } else {
-                            var29 = 2315.32;
-                        }
-                    } else {
-                        if (input[0] <= 1523.9650268554688) {
-                            var29 = 1394.992;
-                        } else {
-                            var29 = 1550.6737500000002;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4090.349853515625) {
-                        if (input[0] <= 3078.449951171875) {
-                            var29 = 2613.2707142857143;
-                        } else {
-                            var29 = 3282.054;
-                        }
-                    } else {
-                        if (input[1] <= 4697.7998046875) {
-                            var29 = 1265.26;
-                        } else {
-                            var29 = 1944.44;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4825.2451171875) {
-            if (input[3] <= 5158.72998046875) {
-                if (input[0] <= 4303.264892578125) {
-                    if (input[4] <= 4485.64990234375) {
-                        if (input[1] <= 4350.580078125) {
-                            var29 = 3797.888125;
-                        } else {
-                            var29 = 1393.47;
-                        }
-                    } else {
-                        if (input[0] <= 3824.02001953125) {
-                            var29 = 4149.623333333334;
-                        } else {
-                            var29 = 4425.306923076923;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5240.385009765625) {
-                        if (input[0] <= 4688.64501953125) {
-                            var29 = 4529.068674698796;
-                        } else {
-                            var29 = 4742.298928571429;
-                        }
-                    } else {
-                        if (input[4] <= 5245.72998046875) {
-                            var29 = 3826.31;
-                        } else {
-                            var29 = 3147.13;
-                        }
-                    }
-                }
-            } else {
-                if (input[4] <= 5245.724853515625) {
-                    if (input[1] <= 4892.39990234375) {
-                        if (input[3] <= 5234.280029296875) {
-                            var29 = 1291.975;
-                        } else {
-                            var29 = 1349.21;
-                        }
-                    } else {
-                        if (input[0] <= 4685.594970703125) {
-                            var29 = 1613.25;
-                        } else {
-                            var29 = 1465.2;
-                        }
-                    }
-                } else {
-                    var29 = 2312.27;
-                }
-            }
-        } else {
-            if (input[0] <= 5070.969970703125) {
-                if (input[3] <= 5178.574951171875) {
-                    if (input[0] <= 4947.344970703125) {
-                        if (input[4] <= 3878.2049560546875) {
-                            var29 = 5224.36;
-                        } else {
-                            var29 = 4897.553013698629;
-                        }
-                    } else {
-                        if (input[4] <= 4719.169921875) {
-                            var29 = 5172.213333333333;
-                        } else {
-                            var29 = 5016.230731707317;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4970.239990234375) {
-                        if (input[0] <= 4877.14013671875) {
-                            var29 = 3417.28;
-                        } else {
-                            var29 = 2991.45;
-                        }
-                    } else {
-                        if (input[4] <= 4030.8299560546875) {
-                            var29 = 3992.67;
-                        } else {
-                            var29 = 4713.320000000001;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5204.51513671875) {
-                    if (input[2] <= 3208.9400024414062) {
-                        var29 = 4496.34;
-                    } else {
-                        if (input[3] <= 5272.434814453125) {
-                            var29 = 5131.671117647056;
-                        } else {
-                            var29 = 4618.44;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5309.829833984375) {
-                        if (input[0] <= 5276.2548828125) {
-                            var29 = 5227.946753246752;
-                        } else {
-                            var29 = 5290.523500000001;
-                        }
-                    } else {
-                        if (input[1] <= 5379.275146484375) {
-                            var29 = 5362.521904761905;
-                        } else {
-                            var29 = 5407.158461538462;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var30;
-    if (input[0] <= 1909.3450317382812) {
-        if (input[0] <= 1430.8599853515625) {
-            if (input[0] <= 1333.1799926757812) {
-                if (input[0] <= 1264.5) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[4] <= 1258.39501953125) {
-                            var30 = 1256.8088819875766;
-                        } else {
-                            var30 = 1258.8860396039618;
-                        }
-                    } else {
-                        if (input[3] <= 1256.8699951171875) {
-                            var30 = 1282.5600000000002;
-                        } else {
-                            var30 = 1261.5901980198028;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1258.39501953125) {
-                        var30 = 4548.23;
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var30 = 1542.4744444444445;
-                        } else {
-                            var30 = 1277.9971351351357;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 1314.0999755859375) {
-                    if (input[1] <= 1291.9700317382812) {
-                        var30 = 2466.42;
-                    } else {
-                        if (input[3] <= 1288.9199829101562) {
-                            var30 = 1990.2350000000001;
-                        } else {
-                            var30 = 1704.82;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1478.9400024414062) {
-                        if (input[0] <= 1394.9949951171875) {
-                            var30 = 1369.5935714285713;
-                        } else {
-                            var30 = 1421.9599999999998;
-                        }
-                    } else {
-                        if (input[2] <= 4139.18994140625) {
-                            var30 = 1292.7366666666667;
-                        } else {
-                            var30 = 1323.26;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1345.3900146484375) {
-                if (input[4] <= 2890.7200317382812) {
-                    var30 = 4629.12;
-                } else {
-                    if (input[3] <= 1295.0250244140625) {
-                        if (input[3] <= 1276.7100219726562) {
-                            var30 = 3220.39;
-                        } else {
-                            var30 = 3421.86;
-                        }
-                    } else {
-                        var30 = 3644.69;
-                    }
-                }
-            } else {
-                if (input[0] <= 1797.9249877929688) {
-                    if (input[2] <= 3305.860107421875) {
-                        if (input[0] <= 1498.780029296875) {
-                            var30 = 1460.8400000000001;
-                        } else {
-                            var30 = 1580.6899999999998;
-                        }
-                    } else {
-                        if (input[4] <= 3268.4699096679688) {
-                            var30 = 1350.73;
-                        } else {
-                            var30 = 1286.016;
-                        }
-                    }
-                } else {
-                    var30 = 2181.01;
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4758.85498046875) {
-            if (input[3] <= 5143.469970703125) {
-                if (input[0] <= 4297.159912109375) {
-                    if (input[1] <= 4394.840087890625) {
-                        if (input[3] <= 1398.0450439453125) {
-                            var30 = 4637.306363636364;
-                        } else {
-                            var30 = 3612.45303030303;
-                        }
-                    } else {
-                        if (input[1] <= 4774.114990234375) {
-                            var30 = 1562.574;
-                        } else {
-                            var30 = 4403.24;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4669.56494140625) {
-                        if (input[0] <= 4668.039794921875) {
-                            var30 = 4574.569727891156;
-                        } else {
-                            var30 = 1286.63;
-                        }
-                    } else {
-                        if (input[1] <= 4668.804931640625) {
-                            var30 = 4867.935294117647;
-                        } else {
-                            var30 = 4709.066630434781;
-                        }
-                    }
-                }
-            } else {
-                if (input[4] <= 5245.724853515625) {
-                    if (input[2] <= 4993.130126953125) {
-                        if (input[2] <= 4921.39501953125) {
-                            var30 = 1280.53;
-                        } else {
-                            var30 = 1303.42;
-                        }
-                    } else {
-                        if (input[1] <= 5000.0) {
-                            var30 = 1465.2;
-                        } else {
-                            var30 = 1613.25;
-                        }
-                    }
-                } else {
-                    var30 = 2312.27;
-                }
-            }
-        } else {
-            if (input[0] <= 5070.969970703125) {
-                if (input[3] <= 5205.28515625) {
-                    if (input[0] <= 4997.710205078125) {
-                        if (input[3] <= 4658.1201171875) {
-                            var30 = 5113.221818181818;
-                        } else {
-                            var30 = 4877.4567938931295;
-                        }
-                    } else {
-                        if (input[3] <= 4830.5849609375) {
-                            var30 = 5161.565714285714;
-                        } else {
-                            var30 = 5015.797375;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5212.9150390625) {
-                        var30 = 3417.28;
-                    } else {
-                        if (input[4] <= 3866.7601318359375) {
-                            var30 = 3992.67;
-                        } else {
-                            var30 = 4695.132500000001;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5204.51513671875) {
-                    if (input[3] <= 5265.56982421875) {
-                        if (input[3] <= 5048.080078125) {
-                            var30 = 5180.763076923076;
-                        } else {
-                            var30 = 5100.452183908047;
-                        }
-                    } else {
-                        var30 = 4618.44;
-                    }
-                } else {
-                    if (input[0] <= 5299.14501953125) {
-                        if (input[0] <= 5262.51513671875) {
-                            var30 = 5220.907619047621;
-                        } else {
-                            var30 = 5282.9920833333335;
-                        }
-                    } else {
-                        if (input[1] <= 5342.64501953125) {
-                            var30 = 5338.83;
-                        } else {
-                            var30 = 5383.2796875;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var31;
-    if (input[0] <= 2902.929931640625) {
-        if (input[0] <= 1430.8599853515625) {
-            if (input[0] <= 627.2899780273438) {
-                var31 = 5024.42;
-            } else {
-                if (input[0] <= 1333.1799926757812) {
-                    if (input[4] <= 1270.60498046875) {
-                        if (input[4] <= 1266.0250244140625) {
-                            var31 = 1258.9144293015343;
-                        } else {
-                            var31 = 1230.6376119402983;
-                        }
-                    } else {
-                        if (input[2] <= 1262.2100219726562) {
-                            var31 = 2360.603333333333;
-                        } else {
-                            var31 = 1288.055087719298;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 1315.6300048828125) {
-                        if (input[1] <= 1291.9700317382812) {
-                            var31 = 2466.42;
-                        } else {
-                            var31 = 2052.81;
-                        }
-                    } else {
-                        if (input[3] <= 3026.5599365234375) {
-                            var31 = 1381.64;
-                        } else {
-                            var31 = 1288.92;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1345.3900146484375) {
-                if (input[0] <= 1588.824951171875) {
-                    if (input[3] <= 1295.0250244140625) {
-                        if (input[1] <= 1355.3099975585938) {
-                            var31 = 3421.86;
-                        } else {
-                            var31 = 3220.39;
-                        }
-                    } else {
-                        var31 = 3644.69;
-                    }
-                } else {
-                    if (input[3] <= 1298.8400268554688) {
-                        if (input[1] <= 1389.6549682617188) {
-                            var31 = 5170.94;
-                        } else {
-                            var31 = 4952.69;
-                        }
-                    } else {
-                        var31 = 4629.12;
-                    }
-                }
-            } else {
-                if (input[0] <= 1823.1099853515625) {
-                    if (input[2] <= 1619.3499755859375) {
-                        if (input[0] <= 1581.1950073242188) {
-                            var31 = 1630.0366666666669;
-                        } else {
-                            var31 = 1940.8866666666665;
-                        }
-                    } else {
-                        if (input[1] <= 3037.239990234375) {
-                            var31 = 1507.634;
-                        } else {
-                            var31 = 1306.4685714285715;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 4738.25) {
-                        if (input[0] <= 2295.47998046875) {
-                            var31 = 1989.2133333333331;
-                        } else {
-                            var31 = 2613.1600000000003;
-                        }
-                    } else {
-                        var31 = 3444.75;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4864.1650390625) {
-            if (input[3] <= 5108.364990234375) {
-                if (input[0] <= 4531.440185546875) {
-                    if (input[0] <= 4527.625) {
-                        if (input[0] <= 3898.0499267578125) {
-                            var31 = 3746.4909999999995;
-                        } else {
-                            var31 = 4473.879795918367;
-                        }
-                    } else {
-                        var31 = 1491.15;
-                    }
-                } else {
-                    if (input[0] <= 4669.56494140625) {
-                        if (input[0] <= 4667.27490234375) {
-                            var31 = 4622.867686567164;
-                        } else {
-                            var31 = 1286.63;
-                        }
-                    } else {
-                        if (input[0] <= 4780.98486328125) {
-                            var31 = 4717.5321875;
-                        } else {
-                            var31 = 4855.560303030302;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4787.090087890625) {
-                    if (input[3] <= 5143.469970703125) {
-                        if (input[4] <= 5219.014892578125) {
-                            var31 = 4748.17;
-                        } else {
-                            var31 = 1944.44;
-                        }
-                    } else {
-                        if (input[3] <= 5170.179931640625) {
-                            var31 = 2312.27;
-                        } else {
-                            var31 = 1393.47;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5217.4951171875) {
-                        if (input[1] <= 4967.184814453125) {
-                            var31 = 3711.0825000000004;
-                        } else {
-                            var31 = 4948.11;
-                        }
-                    } else {
-                        var31 = 1286.63;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5078.60009765625) {
-                if (input[2] <= 5194.594970703125) {
-                    if (input[3] <= 5144.994873046875) {
-                        if (input[0] <= 4907.659912109375) {
-                            var31 = 4882.20090909091;
-                        } else {
-                            var31 = 5014.544214876035;
-                        }
-                    } else {
-                        if (input[3] <= 5221.31005859375) {
-                            var31 = 4856.083529411764;
-                        } else {
-                            var31 = 4649.345;
-                        }
-                    }
-                } else {
-                    var31 = 3992.67;
-                }
-            } else {
-                if (input[0] <= 5181.625) {
-                    if (input[4] <= 2599.969970703125) {
-                        if (input[4] <= 1669.7200317382812) {
-                            var31 = 4496.34;
-                        } else {
-                            var31 = 4618.44;
-                        }
-                    } else {
-                        if (input[3] <= 5226.64990234375) {
-                            var31 = 5126.7717241379305;
-                        } else {
-                            var31 = 4998.3553846153845;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5289.98486328125) {
-                        if (input[0] <= 5217.489990234375) {
-                            var31 = 5196.228275862069;
-                        } else {
-                            var31 = 5237.3646478873225;
-                        }
-                    } else {
-                        if (input[0] <= 5343.405029296875) {
-                            var31 = 5317.765;
-                        } else {
-                            var31 = 5387.269565217392;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var32;
-    if (input[0] <= 2902.929931640625) {
-        if (input[0] <= 1630.7999877929688) {
-            if (input[0] <= 1333.9450073242188) {
-                if (input[4] <= 1270.60498046875) {
-                    if (input[0] <= 1266.0250244140625) {
-                        if (input[0] <= 1259.9200439453125) {
-                            var32 = 1257.3325053533183;
-                        } else {
-                            var32 = 1262.3817293233087;
-                        }
-                    } else {
-                        if (input[0] <= 1275.1849975585938) {
-                            var32 = 1268.392833333333;
-                        } else {
-                            var32 = 1287.8519999999999;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1261.4450073242188) {
-                        if (input[0] <= 1265.2650146484375) {
-                            var32 = 1266.79;
-                        } else {
-                            var32 = 4548.23;
-                        }
-                    } else {
-                        if (input[0] <= 1284.3399658203125) {
-                            var32 = 1275.4454430379744;
-                        } else {
-                            var32 = 1307.8075000000001;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1299.60498046875) {
-                    if (input[4] <= 3102.10986328125) {
-                        var32 = 1704.82;
-                    } else {
-                        var32 = 2052.81;
-                    }
-                } else {
-                    if (input[0] <= 1427.0449829101562) {
-                        if (input[2] <= 1478.9400024414062) {
-                            var32 = 1367.5228571428572;
-                        } else {
-                            var32 = 1293.5;
-                        }
-                    } else {
-                        if (input[4] <= 1308.0) {
-                            var32 = 1350.73;
-                        } else {
-                            var32 = 1472.96;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1454.5150146484375) {
-                if (input[2] <= 1327.8399658203125) {
-                    var32 = 5170.94;
-                } else {
-                    if (input[4] <= 2986.8750610351562) {
-                        var32 = 4629.12;
-                    } else {
-                        var32 = 4681.01;
-                    }
-                }
-            } else {
-                if (input[4] <= 4969.47509765625) {
-                    if (input[3] <= 2615.9949951171875) {
-                        if (input[3] <= 1581.1950073242188) {
-                            var32 = 2276.4025;
-                        } else {
-                            var32 = 2735.0425;
-                        }
-                    } else {
-                        if (input[0] <= 2453.449951171875) {
-                            var32 = 1459.6066666666666;
-                        } else {
-                            var32 = 2159.3419999999996;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 4072.0399169921875) {
-                        if (input[2] <= 2864.7750244140625) {
-                            var32 = 3821.73;
-                        } else {
-                            var32 = 3444.75;
-                        }
-                    } else {
-                        var32 = 2255.8;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4863.400146484375) {
-            if (input[3] <= 5096.155029296875) {
-                if (input[0] <= 4144.53515625) {
-                    if (input[0] <= 3078.449951171875) {
-                        var32 = 2558.0;
-                    } else {
-                        if (input[4] <= 4562.724853515625) {
-                            var32 = 3793.717857142857;
-                        } else {
-                            var32 = 4358.668000000001;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4690.93505859375) {
-                        if (input[2] <= 4698.56494140625) {
-                            var32 = 4595.5813499999995;
-                        } else {
-                            var32 = 3710.316363636364;
-                        }
-                    } else {
-                        if (input[2] <= 4657.35498046875) {
-                            var32 = 5036.63;
-                        } else {
-                            var32 = 4752.844128440368;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 4935.89501953125) {
-                    if (input[3] <= 5157.969970703125) {
-                        if (input[1] <= 4697.7998046875) {
-                            var32 = 4339.135;
-                        } else {
-                            var32 = 3228.2766666666666;
-                        }
-                    } else {
-                        if (input[4] <= 5245.724853515625) {
-                            var32 = 1336.998;
-                        } else {
-                            var32 = 2312.27;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 5060.2900390625) {
-                        if (input[1] <= 4949.6298828125) {
-                            var32 = 3826.31;
-                        } else {
-                            var32 = 3417.28;
-                        }
-                    } else {
-                        var32 = 4948.11;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5144.9951171875) {
-                if (input[0] <= 4980.920166015625) {
-                    if (input[2] <= 5068.68017578125) {
-                        if (input[3] <= 4636.75) {
-                            var32 = 5125.537499999999;
-                        } else {
-                            var32 = 4924.288636363635;
-                        }
-                    } else {
-                        if (input[4] <= 5176.28515625) {
-                            var32 = 4618.129999999999;
-                        } else {
-                            var32 = 4311.66;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5161.019775390625) {
-                        if (input[0] <= 5052.655029296875) {
-                            var32 = 5015.190781249999;
-                        } else {
-                            var32 = 5102.801612903225;
-                        }
-                    } else {
-                        if (input[0] <= 5062.5751953125) {
-                            var32 = 4768.01;
-                        } else {
-                            var32 = 4977.0216666666665;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5288.4599609375) {
-                    if (input[0] <= 5204.51513671875) {
-                        if (input[2] <= 5139.64990234375) {
-                            var32 = 5232.388695652174;
-                        } else {
-                            var32 = 5133.277941176471;
-                        }
-                    } else {
-                        if (input[0] <= 5276.2548828125) {
-                            var32 = 5217.945443037976;
-                        } else {
-                            var32 = 5266.678181818182;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5340.35498046875) {
-                        if (input[0] <= 5296.094970703125) {
-                            var32 = 5304.995;
-                        } else {
-                            var32 = 5292.871111111111;
-                        }
-                    } else {
-                        if (input[0] <= 5390.719970703125) {
-                            var32 = 5365.462;
-                        } else {
-                            var32 = 5405.656428571428;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var33;
-    if (input[0] <= 3431.780029296875) {
-        if (input[0] <= 1666.6649780273438) {
-            if (input[0] <= 627.2899780273438) {
-                var33 = 5024.42;
-            } else {
-                if (input[0] <= 1333.1799926757812) {
-                    if (input[0] <= 1264.5) {
-                        if (input[0] <= 1259.9200439453125) {
-                            var33 = 1257.4105381165903;
-                        } else {
-                            var33 = 1261.9378813559329;
-                        }
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var33 = 1469.5384210526315;
-                        } else {
-                            var33 = 1284.644759036146;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1322.5) {
-                        if (input[0] <= 1406.4400024414062) {
-                            var33 = 2110.502;
-                        } else {
-                            var33 = 3321.125;
-                        }
-                    } else {
-                        if (input[0] <= 1620.8800048828125) {
-                            var33 = 1395.8161538461538;
-                        } else {
-                            var33 = 1891.03;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[1] <= 1550.6699829101562) {
-                if (input[4] <= 4871.795166015625) {
-                    if (input[1] <= 1404.1549682617188) {
-                        var33 = 5170.94;
-                    } else {
-                        var33 = 4681.01;
-                    }
-                } else {
-                    var33 = 3922.47;
-                }
-            } else {
-                if (input[0] <= 2620.574951171875) {
-                    if (input[1] <= 4043.0399169921875) {
-                        if (input[0] <= 1730.0049438476562) {
-                            var33 = 1556.78;
-                        } else {
-                            var33 = 2227.674285714286;
-                        }
-                    } else {
-                        var33 = 1265.26;
-                    }
-                } else {
-                    if (input[3] <= 5108.364990234375) {
-                        if (input[3] <= 4578.7548828125) {
-                            var33 = 3046.633076923077;
-                        } else {
-                            var33 = 3854.55;
-                        }
-                    } else {
-                        var33 = 1944.4399999999998;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4892.400146484375) {
-            if (input[3] <= 5158.72998046875) {
-                if (input[0] <= 4688.64501953125) {
-                    if (input[4] <= 1381.2550048828125) {
-                        if (input[1] <= 4579.51513671875) {
-                            var33 = 1426.03;
-                        } else {
-                            var33 = 4407.8099999999995;
-                        }
-                    } else {
-                        if (input[3] <= 4716.114990234375) {
-                            var33 = 4532.7788770053485;
-                        } else {
-                            var33 = 3679.8721052631577;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5225.125) {
-                        if (input[0] <= 4777.929931640625) {
-                            var33 = 4726.32375;
-                        } else {
-                            var33 = 4871.119;
-                        }
-                    } else {
-                        var33 = 3826.31;
-                    }
-                }
-            } else {
-                if (input[1] <= 4858.824951171875) {
-                    if (input[1] <= 4685.594970703125) {
-                        var33 = 1349.21;
-                    } else {
-                        if (input[1] <= 4803.8798828125) {
-                            var33 = 1303.42;
-                        } else {
-                            var33 = 1280.53;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5170.179931640625) {
-                        var33 = 2312.27;
-                    } else {
-                        if (input[3] <= 5194.60009765625) {
-                            var33 = 2991.4499999999994;
-                        } else {
-                            var33 = 3417.28;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5182.385009765625) {
-                if (input[0] <= 5057.235107421875) {
-                    if (input[3] <= 5144.994873046875) {
-                        if (input[0] <= 4958.02490234375) {
-                            var33 = 4937.578367346939;
-                        } else {
-                            var33 = 5013.943950617286;
-                        }
-                    } else {
-                        if (input[0] <= 4943.52490234375) {
-                            var33 = 4536.933999999999;
-                        } else {
-                            var33 = 4754.27375;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 3008.2400512695312) {
-                        var33 = 4496.34;
-                    } else {
-                        if (input[3] <= 5041.97509765625) {
-                            var33 = 5185.087307692307;
-                        } else {
-                            var33 = 5082.2487962963;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5289.98486328125) {
-                    if (input[0] <= 5217.489990234375) {
-                        if (input[3] <= 5244.96484375) {
-                            var33 = 5189.96534883721;
-                        } else {
-                            var33 = 5082.416666666667;
-                        }
-                    } else {
-                        if (input[0] <= 5257.175048828125) {
-                            var33 = 5224.060869565218;
-                        } else {
-                            var33 = 5262.75;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5340.35498046875) {
-                        if (input[3] <= 5311.35498046875) {
-                            var33 = 5333.814285714286;
-                        } else {
-                            var33 = 5301.243750000001;
-                        }
-                    } else {
-                        if (input[2] <= 5399.114990234375) {
-                            var33 = 5371.751428571429;
-                        } else {
-                            var33 = 5413.4745454545455;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var34;
-    if (input[0] <= 1666.6649780273438) {
-        if (input[0] <= 627.2899780273438) {
-            var34 = 5024.42;
-        } else {
-            if (input[0] <= 1333.9450073242188) {
-                if (input[0] <= 1264.5) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[4] <= 1258.39501953125) {
-                            var34 = 1256.9032208588953;
-                        } else {
-                            var34 = 1258.967250000001;
-                        }
-                    } else {
-                        if (input[3] <= 1256.8699951171875) {
-                            var34 = 1289.68;
-                        } else {
-                            var34 = 1261.5881415929202;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1266.0250244140625) {
-                        if (input[4] <= 1266.0250244140625) {
-                            var34 = 1279.255;
-                        } else {
-                            var34 = 1886.4466666666667;
-                        }
-                    } else {
-                        if (input[0] <= 1284.3399658203125) {
-                            var34 = 1273.0597297297306;
-                        } else {
-                            var34 = 1315.3599159663868;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1290.4450073242188) {
-                    if (input[2] <= 1290.4450073242188) {
-                        if (input[2] <= 1285.864990234375) {
-                            var34 = 1927.66;
-                        } else {
-                            var34 = 2052.81;
-                        }
-                    } else {
-                        if (input[3] <= 1276.7100219726562) {
-                            var34 = 3220.39;
-                        } else {
-                            var34 = 3421.86;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 1620.8800048828125) {
-                        if (input[3] <= 1299.60498046875) {
-                            var34 = 1704.82;
-                        } else {
-                            var34 = 1384.9033333333332;
-                        }
-                    } else {
-                        var34 = 1891.03;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4144.53515625) {
-            if (input[3] <= 1392.7050170898438) {
-                if (input[4] <= 4719.93505859375) {
-                    if (input[1] <= 1990.2350463867188) {
-                        if (input[2] <= 1338.5249633789062) {
-                            var34 = 4952.69;
-                        } else {
-                            var34 = 4660.254;
-                        }
-                    } else {
-                        var34 = 5183.15;
-                    }
-                } else {
-                    if (input[3] <= 1287.3900146484375) {
-                        var34 = 3922.47;
-                    } else {
-                        var34 = 4311.66;
-                    }
-                }
-            } else {
-                if (input[0] <= 3363.094970703125) {
-                    if (input[2] <= 2293.9549560546875) {
-                        if (input[4] <= 2692.31005859375) {
-                            var34 = 2345.0825;
-                        } else {
-                            var34 = 1556.78;
-                        }
-                    } else {
-                        if (input[2] <= 3031.135009765625) {
-                            var34 = 3263.342857142857;
-                        } else {
-                            var34 = 2440.2233333333334;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5171.705078125) {
-                        if (input[4] <= 4783.27001953125) {
-                            var34 = 3757.991764705882;
-                        } else {
-                            var34 = 4230.43;
-                        }
-                    } else {
-                        var34 = 1349.21;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 4914.530029296875) {
-                if (input[3] <= 5177.81005859375) {
-                    if (input[0] <= 4704.670166015625) {
-                        if (input[0] <= 4508.544921875) {
-                            var34 = 4477.773783783783;
-                        } else {
-                            var34 = 4617.830559006209;
-                        }
-                    } else {
-                        if (input[4] <= 5228.175048828125) {
-                            var34 = 4816.268656716417;
-                        } else {
-                            var34 = 3826.31;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4943.52490234375) {
-                        if (input[1] <= 4921.39501953125) {
-                            var34 = 1289.3025;
-                        } else {
-                            var34 = 1465.2;
-                        }
-                    } else {
-                        if (input[1] <= 4970.239990234375) {
-                            var34 = 3133.3933333333334;
-                        } else {
-                            var34 = 4645.91;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5197.650146484375) {
-                    if (input[0] <= 5057.235107421875) {
-                        if (input[3] <= 5159.494873046875) {
-                            var34 = 5002.378255813954;
-                        } else {
-                            var34 = 4804.946;
-                        }
-                    } else {
-                        if (input[1] <= 3172.3098754882812) {
-                            var34 = 4496.34;
-                        } else {
-                            var34 = 5110.533450292395;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5288.4599609375) {
-                        if (input[0] <= 5258.7001953125) {
-                            var34 = 5214.838181818181;
-                        } else {
-                            var34 = 5278.675294117646;
-                        }
-                    } else {
-                        if (input[0] <= 5342.64501953125) {
-                            var34 = 5305.42;
-                        } else {
-                            var34 = 5378.905925925927;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var35;
-    if (input[0] <= 2865.5399169921875) {
-        if (input[0] <= 1659.0349731445312) {
-            if (input[0] <= 1332.4149780273438) {
-                if (input[0] <= 1264.5) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[4] <= 1258.39501953125) {
-                            var35 = 1256.8535359116013;
-                        } else {
-                            var35 = 1258.6924576271201;
-                        }
-                    } else {
-                        if (input[3] <= 1259.155029296875) {
-                            var35 = 1266.792;
-                        } else {
-                            var35 = 1261.5238775510213;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1266.0250244140625) {
-                        if (input[4] <= 1267.5549926757812) {
-                            var35 = 1447.3718181818183;
-                        } else {
-                            var35 = 4674.91;
-                        }
-                    } else {
-                        if (input[2] <= 1266.0250244140625) {
-                            var35 = 1062.7783333333334;
-                        } else {
-                            var35 = 1284.4197196261684;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 1298.0750122070312) {
-                    if (input[0] <= 1423.989990234375) {
-                        if (input[3] <= 1374.3899536132812) {
-                            var35 = 1969.3766666666668;
-                        } else {
-                            var35 = 2466.42;
-                        }
-                    } else {
-                        var35 = 3644.69;
-                    }
-                } else {
-                    if (input[3] <= 3527.169921875) {
-                        if (input[4] <= 1455.2850341796875) {
-                            var35 = 1504.0509090909093;
-                        } else {
-                            var35 = 1388.0336000000002;
-                        }
-                    } else {
-                        if (input[4] <= 1310.2849731445312) {
-                            var35 = 1336.995;
-                        } else {
-                            var35 = 1290.1899999999998;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1437.72998046875) {
-                if (input[3] <= 1291.2050170898438) {
-                    var35 = 3922.47;
-                } else {
-                    if (input[4] <= 1288.155029296875) {
-                        var35 = 4629.12;
-                    } else {
-                        var35 = 5170.94;
-                    }
-                }
-            } else {
-                if (input[0] <= 1917.7349853515625) {
-                    if (input[4] <= 2679.3350219726562) {
-                        if (input[0] <= 1823.1099853515625) {
-                            var35 = 2040.5999999999997;
-                        } else {
-                            var35 = 2181.01;
-                        }
-                    } else {
-                        var35 = 1556.78;
-                    }
-                } else {
-                    if (input[1] <= 1992.5199584960938) {
-                        var35 = 3821.73;
-                    } else {
-                        if (input[0] <= 2013.125) {
-                            var35 = 3444.75;
-                        } else {
-                            var35 = 2422.0446153846156;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4822.190185546875) {
-            if (input[0] <= 3985.0450439453125) {
-                if (input[0] <= 3431.0150146484375) {
-                    if (input[2] <= 2074.93994140625) {
-                        var35 = 4681.01;
-                    } else {
-                        if (input[3] <= 5108.364990234375) {
-                            var35 = 3205.5125;
-                        } else {
-                            var35 = 1944.44;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 4493.284912109375) {
-                        if (input[3] <= 3753.8199462890625) {
-                            var35 = 3868.1339999999996;
-                        } else {
-                            var35 = 3558.835;
-                        }
-                    } else {
-                        if (input[2] <= 3906.4400634765625) {
-                            var35 = 4136.142500000001;
-                        } else {
-                            var35 = 4403.24;
-                        }
-                    }
-                }
-            } else {
-                if (input[4] <= 5241.909912109375) {
-                    if (input[0] <= 4688.64501953125) {
-                        if (input[4] <= 1821.5799560546875) {
-                            var35 = 3104.0150000000003;
-                        } else {
-                            var35 = 4524.6726767676755;
-                        }
-                    } else {
-                        if (input[3] <= 5103.784912109375) {
-                            var35 = 4750.219444444445;
-                        } else {
-                            var35 = 4004.885;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5167.89013671875) {
-                        var35 = 3147.13;
-                    } else {
-                        var35 = 1303.42;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5125.9150390625) {
-                if (input[3] <= 5162.545166015625) {
-                    if (input[0] <= 5014.5) {
-                        if (input[3] <= 4729.090087890625) {
-                            var35 = 5099.484545454546;
-                        } else {
-                            var35 = 4913.953469387755;
-                        }
-                    } else {
-                        if (input[3] <= 5154.155029296875) {
-                            var35 = 5079.337476635514;
-                        } else {
-                            var35 = 4874.85;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4916.820068359375) {
-                        if (input[3] <= 5194.60009765625) {
-                            var35 = 2991.45;
-                        } else {
-                            var35 = 3417.28;
-                        }
-                    } else {
-                        if (input[3] <= 5281.594970703125) {
-                            var35 = 4841.153076923078;
-                        } else {
-                            var35 = 3992.67;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5275.489990234375) {
-                    if (input[0] <= 5204.51513671875) {
-                        if (input[3] <= 5063.33984375) {
-                            var35 = 5203.755416666667;
-                        } else {
-                            var35 = 5124.209078947369;
-                        }
-                    } else {
-                        if (input[1] <= 5282.35498046875) {
-                            var35 = 5227.751388888887;
-                        } else {
-                            var35 = 5120.57;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5342.64501953125) {
-                        if (input[0] <= 5306.014892578125) {
-                            var35 = 5284.118461538462;
-                        } else {
-                            var35 = 5337.302;
-                        }
-                    } else {
-                        if (input[2] <= 5399.114990234375) {
-                            var35 = 5374.898333333333;
-                        } else {
-                            var35 = 5413.486666666667;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var36;
-    if (input[0] <= 2858.669921875) {
-        if (input[0] <= 1465.9649658203125) {
-            if (input[0] <= 627.2899780273438) {
-                var36 = 5024.42;
-            } else {
-                if (input[0] <= 1332.4149780273438) {
-                    if (input[0] <= 1266.0250244140625) {
-                        if (input[3] <= 1266.0250244140625) {
-                            var36 = 1258.4909290540554;
-                        } else {
-                            var36 = 1193.357777777778;
-                        }
-                    } else {
-                        if (input[2] <= 1258.39501953125) {
-                            var36 = 4548.23;
-                        } else {
-                            var36 = 1298.2418771331056;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1300.364990234375) {
-                        if (input[0] <= 1406.4400024414062) {
-                            var36 = 2331.73;
-                        } else {
-                            var36 = 3421.86;
-                        }
-                    } else {
-                        if (input[2] <= 1317.9199829101562) {
-                            var36 = 1704.82;
-                        } else {
-                            var36 = 1368.7083333333333;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1351.4949951171875) {
-                if (input[4] <= 4693.22509765625) {
-                    if (input[1] <= 1452.22998046875) {
-                        if (input[4] <= 1288.155029296875) {
-                            var36 = 4952.69;
-                        } else {
-                            var36 = 5170.94;
-                        }
-                    } else {
-                        if (input[0] <= 1816.239990234375) {
-                            var36 = 4629.12;
-                        } else {
-                            var36 = 4681.01;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 4912.239990234375) {
-                        var36 = 3220.39;
-                    } else {
-                        var36 = 3644.69;
-                    }
-                }
-            } else {
-                if (input[4] <= 4969.47509765625) {
-                    if (input[0] <= 2395.449951171875) {
-                        if (input[3] <= 1855.1600341796875) {
-                            var36 = 2040.4277777777777;
-                        } else {
-                            var36 = 1484.7562500000001;
-                        }
-                    } else {
-                        if (input[3] <= 2036.02001953125) {
-                            var36 = 2741.91;
-                        } else {
-                            var36 = 3011.29;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 2284.0350341796875) {
-                        if (input[3] <= 4909.949951171875) {
-                            var36 = 3821.73;
-                        } else {
-                            var36 = 3444.75;
-                        }
-                    } else {
-                        var36 = 2255.8;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4775.639892578125) {
-            if (input[3] <= 5157.969970703125) {
-                if (input[0] <= 4087.300048828125) {
-                    if (input[4] <= 4429.94482421875) {
-                        if (input[0] <= 3308.9149169921875) {
-                            var36 = 3123.221666666667;
-                        } else {
-                            var36 = 3615.69;
-                        }
-                    } else {
-                        if (input[1] <= 3917.1251220703125) {
-                            var36 = 4205.2585714285715;
-                        } else {
-                            var36 = 3873.63;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5224.360107421875) {
-                        if (input[0] <= 4533.72998046875) {
-                            var36 = 4352.868867924526;
-                        } else {
-                            var36 = 4626.238482142857;
-                        }
-                    } else {
-                        var36 = 3147.1299999999997;
-                    }
-                }
-            } else {
-                if (input[3] <= 5170.179931640625) {
-                    var36 = 2312.27;
-                } else {
-                    if (input[0] <= 4676.43505859375) {
-                        if (input[0] <= 4547.465087890625) {
-                            var36 = 1280.53;
-                        } else {
-                            var36 = 1303.42;
-                        }
-                    } else {
-                        var36 = 1465.2;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5099.969970703125) {
-                if (input[0] <= 4979.39501953125) {
-                    if (input[3] <= 5205.28515625) {
-                        if (input[0] <= 4976.344970703125) {
-                            var36 = 4891.377033898304;
-                        } else {
-                            var36 = 4311.66;
-                        }
-                    } else {
-                        if (input[1] <= 5006.864990234375) {
-                            var36 = 3417.28;
-                        } else {
-                            var36 = 4649.725;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5141.94482421875) {
-                        if (input[0] <= 5053.420166015625) {
-                            var36 = 5020.092328767126;
-                        } else {
-                            var36 = 5073.409512195123;
-                        }
-                    } else {
-                        if (input[0] <= 5075.550048828125) {
-                            var36 = 4798.028333333333;
-                        } else {
-                            var36 = 4957.7733333333335;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5269.3798828125) {
-                    if (input[1] <= 3208.9400024414062) {
-                        var36 = 4496.34;
-                    } else {
-                        if (input[0] <= 5181.625) {
-                            var36 = 5121.330353982301;
-                        } else {
-                            var36 = 5206.8462711864395;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5342.64501953125) {
-                        if (input[0] <= 5289.98486328125) {
-                            var36 = 5274.216666666666;
-                        } else {
-                            var36 = 5312.177692307693;
-                        }
-                    } else {
-                        if (input[4] <= 5389.955078125) {
-                            var36 = 5402.131904761905;
-                        } else {
-                            var36 = 5358.33;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var37;
-    if (input[0] <= 2865.5399169921875) {
-        if (input[0] <= 1433.9149780273438) {
-            if (input[0] <= 1333.1799926757812) {
-                if (input[0] <= 1264.5) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[4] <= 1258.39501953125) {
-                            var37 = 1256.8515838509302;
-                        } else {
-                            var37 = 1258.791680000001;
-                        }
-                    } else {
-                        if (input[0] <= 1262.9749755859375) {
-                            var37 = 1261.1797752808995;
-                        } else {
-                            var37 = 1263.6758333333337;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1258.39501953125) {
-                        var37 = 4548.23;
-                    } else {
-                        if (input[2] <= 1264.5) {
-                            var37 = 1973.75;
-                        } else {
-                            var37 = 1294.1684266666678;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 1311.8150024414062) {
-                    if (input[4] <= 5017.554931640625) {
-                        var37 = 2052.81;
-                    } else {
-                        var37 = 2466.42;
-                    }
-                } else {
-                    if (input[0] <= 1409.4950561523438) {
-                        if (input[3] <= 3026.5599365234375) {
-                            var37 = 1352.0421428571428;
-                        } else {
-                            var37 = 1301.8933333333334;
-                        }
-                    } else {
-                        if (input[2] <= 1433.1499633789062) {
-                            var37 = 1454.52;
-                        } else {
-                            var37 = 1390.42;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1343.864990234375) {
-                if (input[2] <= 1334.7049560546875) {
-                    if (input[1] <= 1423.989990234375) {
-                        if (input[0] <= 1452.22998046875) {
-                            var37 = 3421.8599999999997;
-                        } else {
-                            var37 = 3220.39;
-                        }
-                    } else {
-                        var37 = 3922.47;
-                    }
-                } else {
-                    if (input[1] <= 1452.22998046875) {
-                        var37 = 4952.69;
-                    } else {
-                        if (input[0] <= 1816.239990234375) {
-                            var37 = 4629.12;
-                        } else {
-                            var37 = 4681.01;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 1730.0049438476562) {
-                    if (input[4] <= 2208.489990234375) {
-                        if (input[2] <= 1474.3600463867188) {
-                            var37 = 1547.3120000000001;
-                        } else {
-                            var37 = 1845.75;
-                        }
-                    } else {
-                        if (input[0] <= 1659.0349731445312) {
-                            var37 = 1387.3633333333335;
-                        } else {
-                            var37 = 1556.78;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4043.0399169921875) {
-                        if (input[3] <= 4368.135009765625) {
-                            var37 = 2344.5131250000004;
-                        } else {
-                            var37 = 3174.0933333333337;
-                        }
-                    } else {
-                        var37 = 1265.26;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4863.400146484375) {
-            if (input[3] <= 5158.72998046875) {
-                if (input[0] <= 4087.300048828125) {
-                    if (input[2] <= 2574.784912109375) {
-                        if (input[4] <= 4710.77490234375) {
-                            var37 = 4932.08;
-                        } else {
-                            var37 = 4199.736666666667;
-                        }
-                    } else {
-                        if (input[0] <= 3578.294921875) {
-                            var37 = 3290.3227272727277;
-                        } else {
-                            var37 = 3831.400666666667;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5154.9150390625) {
-                        if (input[0] <= 4669.56494140625) {
-                            var37 = 4540.440413793105;
-                        } else {
-                            var37 = 4755.179548872179;
-                        }
-                    } else {
-                        if (input[4] <= 5245.72998046875) {
-                            var37 = 3826.31;
-                        } else {
-                            var37 = 3147.13;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4858.824951171875) {
-                    if (input[4] <= 5245.724853515625) {
-                        if (input[4] <= 5054.945068359375) {
-                            var37 = 1613.25;
-                        } else {
-                            var37 = 1293.346;
-                        }
-                    } else {
-                        var37 = 2312.27;
-                    }
-                } else {
-                    var37 = 3417.28;
-                }
-            }
-        } else {
-            if (input[0] <= 5072.5) {
-                if (input[3] <= 5177.81005859375) {
-                    if (input[0] <= 4902.320068359375) {
-                        if (input[1] <= 4970.23486328125) {
-                            var37 = 4883.468648648648;
-                        } else {
-                            var37 = 4735.96;
-                        }
-                    } else {
-                        if (input[3] <= 5140.414794921875) {
-                            var37 = 5005.704854368932;
-                        } else {
-                            var37 = 4792.620000000001;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4902.320068359375) {
-                        var37 = 2991.45;
-                    } else {
-                        if (input[4] <= 3866.7601318359375) {
-                            var37 = 3992.67;
-                        } else {
-                            var37 = 4719.873846153846;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5204.51513671875) {
-                    if (input[3] <= 5232.7548828125) {
-                        if (input[0] <= 5144.9951171875) {
-                            var37 = 5103.966559139784;
-                        } else {
-                            var37 = 5172.549636363636;
-                        }
-                    } else {
-                        if (input[0] <= 5153.39013671875) {
-                            var37 = 4940.47375;
-                        } else {
-                            var37 = 5086.580000000001;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5306.014892578125) {
-                        if (input[0] <= 5275.489990234375) {
-                            var37 = 5222.147640449438;
-                        } else {
-                            var37 = 5284.524210526317;
-                        }
-                    } else {
-                        if (input[2] <= 5396.824951171875) {
-                            var37 = 5360.8676000000005;
-                        } else {
-                            var37 = 5405.983333333333;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var38;
-    if (input[0] <= 1666.6649780273438) {
-        if (input[0] <= 627.2899780273438) {
-            var38 = 5024.42;
-        } else {
-            if (input[0] <= 1333.1799926757812) {
-                if (input[0] <= 1264.5) {
-                    if (input[0] <= 1258.39501953125) {
-                        if (input[4] <= 1270.60498046875) {
-                            var38 = 1257.0099483204133;
-                        } else {
-                            var38 = 1264.5025;
-                        }
-                    } else {
-                        if (input[0] <= 1261.4450073242188) {
-                            var38 = 1259.774452054795;
-                        } else {
-                            var38 = 1262.694;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1264.5) {
-                        if (input[4] <= 1262.2149658203125) {
-                            var38 = 1307.2350000000001;
-                        } else {
-                            var38 = 4674.91;
-                        }
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var38 = 1612.6231818181818;
-                        } else {
-                            var38 = 1283.5830473372782;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 1300.364990234375) {
-                    if (input[0] <= 1406.4400024414062) {
-                        if (input[3] <= 1374.3899536132812) {
-                            var38 = 1977.72;
-                        } else {
-                            var38 = 2466.42;
-                        }
-                    } else {
-                        if (input[0] <= 1455.2799682617188) {
-                            var38 = 3421.86;
-                        } else {
-                            var38 = 3644.69;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 1461.3900146484375) {
-                        if (input[4] <= 1343.10498046875) {
-                            var38 = 1419.0766666666668;
-                        } else {
-                            var38 = 1752.136;
-                        }
-                    } else {
-                        if (input[1] <= 1585.0150146484375) {
-                            var38 = 1392.7050000000002;
-                        } else {
-                            var38 = 1286.6280000000002;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4297.159912109375) {
-            if (input[3] <= 1391.175048828125) {
-                if (input[2] <= 1423.989990234375) {
-                    if (input[1] <= 1452.22998046875) {
-                        if (input[2] <= 1324.7849731445312) {
-                            var38 = 5170.94;
-                        } else {
-                            var38 = 4952.69;
-                        }
-                    } else {
-                        var38 = 4681.01;
-                    }
-                } else {
-                    if (input[4] <= 4841.27001953125) {
-                        var38 = 4311.66;
-                    } else {
-                        var38 = 4123.93;
-                    }
-                }
-            } else {
-                if (input[4] <= 4377.2900390625) {
-                    if (input[0] <= 2419.1099853515625) {
-                        if (input[4] <= 2692.31005859375) {
-                            var38 = 2246.2575;
-                        } else {
-                            var38 = 1826.0080000000003;
-                        }
-                    } else {
-                        if (input[3] <= 1797.9249877929688) {
-                            var38 = 1393.47;
-                        } else {
-                            var38 = 3351.7394117647063;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 4980.925048828125) {
-                        if (input[0] <= 3218.0999755859375) {
-                            var38 = 3721.763333333334;
-                        } else {
-                            var38 = 4190.105714285714;
-                        }
-                    } else {
-                        var38 = 1349.21;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 4892.400146484375) {
-                if (input[3] <= 5157.204833984375) {
-                    if (input[0] <= 4669.56494140625) {
-                        if (input[0] <= 4668.039794921875) {
-                            var38 = 4570.4395454545465;
-                        } else {
-                            var38 = 3455.943333333334;
-                        }
-                    } else {
-                        if (input[0] <= 4825.2451171875) {
-                            var38 = 4723.761304347827;
-                        } else {
-                            var38 = 4879.9468181818165;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4672.619873046875) {
-                        if (input[1] <= 4962.60986328125) {
-                            var38 = 1295.79;
-                        } else {
-                            var38 = 1613.25;
-                        }
-                    } else {
-                        if (input[1] <= 4970.239990234375) {
-                            var38 = 2501.9075000000003;
-                        } else {
-                            var38 = 4948.11;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5181.625) {
-                    if (input[0] <= 5072.5) {
-                        if (input[3] <= 5144.994873046875) {
-                            var38 = 5001.671825396827;
-                        } else {
-                            var38 = 4708.792666666666;
-                        }
-                    } else {
-                        if (input[2] <= 3008.2400512695312) {
-                            var38 = 4496.34;
-                        } else {
-                            var38 = 5106.977750000002;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5309.829833984375) {
-                        if (input[4] <= 5183.91015625) {
-                            var38 = 5203.134186046511;
-                        } else {
-                            var38 = 5253.8029166666665;
-                        }
-                    } else {
-                        if (input[0] <= 5342.64501953125) {
-                            var38 = 5317.4625;
-                        } else {
-                            var38 = 5389.510344827587;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var39;
-    if (input[0] <= 3099.054931640625) {
-        if (input[0] <= 1666.6649780273438) {
-            if (input[0] <= 627.2899780273438) {
-                var39 = 5024.42;
-            } else {
-                if (input[0] <= 1333.1799926757812) {
-                    if (input[4] <= 1266.0250244140625) {
-                        if (input[0] <= 1266.0250244140625) {
-                            var39 = 1258.223233215547;
-                        } else {
-                            var39 = 1279.5072222222223;
-                        }
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var39 = 2189.5278947368415;
-                        } else {
-                            var39 = 1278.2266346153845;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1318.6799926757812) {
-                        if (input[0] <= 1406.4400024414062) {
-                            var39 = 2032.9666666666665;
-                        } else {
-                            var39 = 3321.125;
-                        }
-                    } else {
-                        if (input[0] <= 1620.8800048828125) {
-                            var39 = 1398.2331707317073;
-                        } else {
-                            var39 = 1891.03;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1501.8300170898438) {
-                if (input[1] <= 1452.22998046875) {
-                    if (input[4] <= 1288.155029296875) {
-                        var39 = 4952.69;
-                    } else {
-                        var39 = 5170.94;
-                    }
-                } else {
-                    var39 = 4681.01;
-                }
-            } else {
-                if (input[0] <= 2560.2900390625) {
-                    if (input[4] <= 4969.47509765625) {
-                        if (input[4] <= 2740.3849487304688) {
-                            var39 = 2423.5177777777776;
-                        } else {
-                            var39 = 1890.857777777778;
-                        }
-                    } else {
-                        if (input[0] <= 2284.0350341796875) {
-                            var39 = 3633.24;
-                        } else {
-                            var39 = 2255.8;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 3099.054931640625) {
-                        if (input[4] <= 1485.0450439453125) {
-                            var39 = 2800.67;
-                        } else {
-                            var39 = 3133.3940000000002;
-                        }
-                    } else {
-                        var39 = 2558.0;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4822.190185546875) {
-            if (input[4] <= 5241.909912109375) {
-                if (input[0] <= 4530.675048828125) {
-                    if (input[0] <= 4528.385009765625) {
-                        if (input[0] <= 4303.264892578125) {
-                            var39 = 4201.007692307692;
-                        } else {
-                            var39 = 4517.29487804878;
-                        }
-                    } else {
-                        var39 = 1491.15;
-                    }
-                } else {
-                    if (input[0] <= 4690.93505859375) {
-                        if (input[3] <= 4716.114990234375) {
-                            var39 = 4629.973023255813;
-                        } else {
-                            var39 = 4017.9411111111112;
-                        }
-                    } else {
-                        if (input[4] <= 5200.699951171875) {
-                            var39 = 4763.341262135921;
-                        } else {
-                            var39 = 4004.885;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4663.4599609375) {
-                    var39 = 1303.42;
-                } else {
-                    if (input[1] <= 4877.14013671875) {
-                        var39 = 2312.27;
-                    } else {
-                        var39 = 3147.13;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5183.150146484375) {
-                if (input[0] <= 4986.264892578125) {
-                    if (input[3] <= 5205.28515625) {
-                        if (input[3] <= 4722.98486328125) {
-                            var39 = 5115.302727272728;
-                        } else {
-                            var39 = 4887.013523809524;
-                        }
-                    } else {
-                        if (input[4] <= 5181.625) {
-                            var39 = 4637.1325;
-                        } else {
-                            var39 = 3417.28;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5146.52001953125) {
-                        if (input[0] <= 5170.175048828125) {
-                            var39 = 5089.44569767442;
-                        } else {
-                            var39 = 4647.4375;
-                        }
-                    } else {
-                        if (input[0] <= 5127.43994140625) {
-                            var39 = 4887.107741935485;
-                        } else {
-                            var39 = 5096.619130434783;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5275.489990234375) {
-                    if (input[0] <= 5228.175048828125) {
-                        if (input[1] <= 5240.385009765625) {
-                            var39 = 5192.388245614035;
-                        } else {
-                            var39 = 5247.635;
-                        }
-                    } else {
-                        if (input[0] <= 5256.41015625) {
-                            var39 = 5228.0905555555555;
-                        } else {
-                            var39 = 5271.889999999999;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5343.405029296875) {
-                        if (input[3] <= 5345.695068359375) {
-                            var39 = 5287.288461538462;
-                        } else {
-                            var39 = 5324.3275;
-                        }
-                    } else {
-                        if (input[2] <= 5399.114990234375) {
-                            var39 = 5370.371666666667;
-                        } else {
-                            var39 = 5404.318181818182;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var40;
-    if (input[0] <= 3419.570068359375) {
-        if (input[0] <= 1433.9149780273438) {
-            if (input[0] <= 627.2899780273438) {
-                var40 = 5024.42;
-            } else {
-                if (input[4] <= 1267.5549926757812) {
-                    if (input[0] <= 1279.0) {
-                        if (input[0] <= 1259.9200439453125) {
-                            var40 = 1257.2345720720716;
-                        } else {
-                            var40 = 1263.2458955223888;
-                        }
-                    } else {
-                        if (input[3] <= 1279.760009765625) {
-                            var40 = 1299.86;
-                        } else {
-                            var40 = 1281.29;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1259.9199829101562) {
-                        if (input[1] <= 1260.6849975585938) {
-                            var40 = 1265.2649999999999;
-                        } else {
-                            var40 = 4611.57;
-                        }
-                    } else {
-                        if (input[0] <= 1333.1799926757812) {
-                            var40 = 1286.001206349207;
-                        } else {
-                            var40 = 1464.4394444444447;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1340.050048828125) {
-                if (input[0] <= 1588.824951171875) {
-                    if (input[1] <= 1355.3099975585938) {
-                        if (input[2] <= 1291.9700317382812) {
-                            var40 = 3644.69;
-                        } else {
-                            var40 = 3421.86;
-                        }
-                    } else {
-                        var40 = 3220.39;
-                    }
-                } else {
-                    if (input[3] <= 1284.3400268554688) {
-                        var40 = 4681.01;
-                    } else {
-                        var40 = 5170.94;
-                    }
-                }
-            } else {
-                if (input[0] <= 2395.449951171875) {
-                    if (input[0] <= 1730.0049438476562) {
-                        if (input[3] <= 1575.0899658203125) {
-                            var40 = 1633.3433333333332;
-                        } else {
-                            var40 = 1417.31375;
-                        }
-                    } else {
-                        if (input[1] <= 4043.0399169921875) {
-                            var40 = 2100.1214285714286;
-                        } else {
-                            var40 = 1265.26;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 3349.3599853515625) {
-                        if (input[4] <= 4782.510009765625) {
-                            var40 = 2611.4176923076925;
-                        } else {
-                            var40 = 3854.55;
-                        }
-                    } else {
-                        var40 = 1944.4399999999998;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4863.400146484375) {
-            if (input[3] <= 5157.204833984375) {
-                if (input[0] <= 4144.53515625) {
-                    if (input[3] <= 2614.469970703125) {
-                        if (input[4] <= 2940.3250732421875) {
-                            var40 = 5183.15;
-                        } else {
-                            var40 = 4529.91;
-                        }
-                    } else {
-                        if (input[0] <= 3597.375) {
-                            var40 = 3666.568333333333;
-                        } else {
-                            var40 = 3946.452857142857;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4689.41015625) {
-                        if (input[2] <= 4698.56494140625) {
-                            var40 = 4575.051420765026;
-                        } else {
-                            var40 = 4114.414117647058;
-                        }
-                    } else {
-                        if (input[4] <= 5209.860107421875) {
-                            var40 = 4779.279017857142;
-                        } else {
-                            var40 = 4183.46;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 4935.1298828125) {
-                    if (input[3] <= 5170.179931640625) {
-                        var40 = 2312.27;
-                    } else {
-                        if (input[2] <= 5069.445068359375) {
-                            var40 = 1287.548;
-                        } else {
-                            var40 = 1349.21;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4731.3798828125) {
-                        var40 = 1613.25;
-                    } else {
-                        if (input[0] <= 4853.47998046875) {
-                            var40 = 4948.11;
-                        } else {
-                            var40 = 3417.28;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5069.445068359375) {
-                if (input[3] <= 5144.994873046875) {
-                    if (input[4] <= 5025.945068359375) {
-                        if (input[2] <= 4805.405029296875) {
-                            var40 = 5159.240000000001;
-                        } else {
-                            var40 = 4914.2719718309845;
-                        }
-                    } else {
-                        if (input[1] <= 5101.494873046875) {
-                            var40 = 5019.435949367089;
-                        } else {
-                            var40 = 5137.976000000001;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4990.844970703125) {
-                        var40 = 2991.45;
-                    } else {
-                        if (input[3] <= 5170.175048828125) {
-                            var40 = 4489.469999999999;
-                        } else {
-                            var40 = 4793.156666666667;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5211.385009765625) {
-                    if (input[3] <= 5272.434814453125) {
-                        if (input[2] <= 2563.3400268554688) {
-                            var40 = 4496.34;
-                        } else {
-                            var40 = 5128.2377777777765;
-                        }
-                    } else {
-                        var40 = 4618.44;
-                    }
-                } else {
-                    if (input[0] <= 5326.6201171875) {
-                        if (input[0] <= 5275.489990234375) {
-                            var40 = 5225.958571428571;
-                        } else {
-                            var40 = 5282.051333333334;
-                        }
-                    } else {
-                        if (input[0] <= 5358.670166015625) {
-                            var40 = 5337.6825;
-                        } else {
-                            var40 = 5394.155357142858;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var41;
-    if (input[0] <= 1909.3450317382812) {
-        if (input[0] <= 627.2899780273438) {
-            var41 = 5024.42;
-        } else {
-            if (input[0] <= 1430.8599853515625) {
-                if (input[0] <= 1312.5750122070312) {
-                    if (input[0] <= 1264.5) {
-                        if (input[0] <= 1259.9200439453125) {
-                            var41 = 1257.4015800415787;
-                        } else {
-                            var41 = 1261.811081081081;
-                        }
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var41 = 1550.9053846153847;
-                        } else {
-                            var41 = 1279.6787662337665;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1308.760009765625) {
-                        if (input[4] <= 3234.1298828125) {
-                            var41 = 1704.82;
-                        } else {
-                            var41 = 2259.615;
-                        }
-                    } else {
-                        if (input[0] <= 1352.260009765625) {
-                            var41 = 1314.1872222222223;
-                        } else {
-                            var41 = 1382.5657142857144;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1340.050048828125) {
-                    if (input[1] <= 1520.1449584960938) {
-                        if (input[2] <= 1291.9700317382812) {
-                            var41 = 3644.69;
-                        } else {
-                            var41 = 3421.86;
-                        }
-                    } else {
-                        var41 = 4629.12;
-                    }
-                } else {
-                    if (input[0] <= 1730.0049438476562) {
-                        if (input[3] <= 1575.0899658203125) {
-                            var41 = 1621.6416666666667;
-                        } else {
-                            var41 = 1435.0155555555557;
-                        }
-                    } else {
-                        if (input[2] <= 1581.1950073242188) {
-                            var41 = 2040.6;
-                        } else {
-                            var41 = 2181.01;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4002.594970703125) {
-            if (input[3] <= 1398.0450439453125) {
-                if (input[4] <= 4719.93505859375) {
-                    if (input[4] <= 2977.7149047851562) {
-                        if (input[3] <= 1285.864990234375) {
-                            var41 = 4952.69;
-                        } else {
-                            var41 = 5183.15;
-                        }
-                    } else {
-                        var41 = 4681.01;
-                    }
-                } else {
-                    if (input[4] <= 4993.130126953125) {
-                        if (input[1] <= 3055.554931640625) {
-                            var41 = 4123.93;
-                        } else {
-                            var41 = 4311.66;
-                        }
-                    } else {
-                        var41 = 3922.47;
-                    }
-                }
-            } else {
-                if (input[3] <= 5108.364990234375) {
-                    if (input[0] <= 3078.449951171875) {
-                        if (input[4] <= 4753.510009765625) {
-                            var41 = 2576.783076923077;
-                        } else {
-                            var41 = 3523.605;
-                        }
-                    } else {
-                        if (input[3] <= 4590.965087890625) {
-                            var41 = 3574.342727272727;
-                        } else {
-                            var41 = 4284.1900000000005;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 3704.9749755859375) {
-                        var41 = 1944.44;
-                    } else {
-                        var41 = 1349.21;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 4822.190185546875) {
-                if (input[3] <= 5154.9150390625) {
-                    if (input[0] <= 4531.440185546875) {
-                        if (input[0] <= 4528.385009765625) {
-                            var41 = 4413.390769230769;
-                        } else {
-                            var41 = 1491.15;
-                        }
-                    } else {
-                        if (input[0] <= 4689.41015625) {
-                            var41 = 4572.406594202897;
-                        } else {
-                            var41 = 4715.03076923077;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4696.27490234375) {
-                        if (input[4] <= 5090.81494140625) {
-                            var41 = 1613.25;
-                        } else {
-                            var41 = 1291.975;
-                        }
-                    } else {
-                        var41 = 3147.13;
-                    }
-                }
-            } else {
-                if (input[0] <= 5099.969970703125) {
-                    if (input[3] <= 5144.994873046875) {
-                        if (input[0] <= 4938.18505859375) {
-                            var41 = 4908.026666666668;
-                        } else {
-                            var41 = 5045.246635514019;
-                        }
-                    } else {
-                        if (input[1] <= 4970.239990234375) {
-                            var41 = 3986.565;
-                        } else {
-                            var41 = 4796.662727272726;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5266.330078125) {
-                        if (input[0] <= 5181.625) {
-                            var41 = 5117.840608695651;
-                        } else {
-                            var41 = 5209.362844036697;
-                        }
-                    } else {
-                        if (input[0] <= 5324.330078125) {
-                            var41 = 5301.282800000002;
-                        } else {
-                            var41 = 5389.70303030303;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var42;
-    if (input[0] <= 3078.449951171875) {
-        if (input[0] <= 1430.8599853515625) {
-            if (input[0] <= 627.2899780273438) {
-                var42 = 5024.42;
-            } else {
-                if (input[0] <= 1333.1799926757812) {
-                    if (input[4] <= 1270.60498046875) {
-                        if (input[4] <= 1266.0250244140625) {
-                            var42 = 1258.8026833333342;
-                        } else {
-                            var42 = 1212.4414492753624;
-                        }
-                    } else {
-                        if (input[3] <= 1262.9749755859375) {
-                            var42 = 2085.625;
-                        } else {
-                            var42 = 1286.6570344827583;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 1322.5) {
-                        if (input[3] <= 1379.72998046875) {
-                            var42 = 1871.95;
-                        } else {
-                            var42 = 2466.42;
-                        }
-                    } else {
-                        if (input[0] <= 1409.4950561523438) {
-                            var42 = 1351.3623529411764;
-                        } else {
-                            var42 = 1431.625;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[4] <= 1305.7050170898438) {
-                if (input[2] <= 1338.5249633789062) {
-                    if (input[4] <= 1288.155029296875) {
-                        var42 = 4952.69;
-                    } else {
-                        var42 = 5170.94;
-                    }
-                } else {
-                    var42 = 4629.12;
-                }
-            } else {
-                if (input[4] <= 4278.844970703125) {
-                    if (input[0] <= 1797.9249877929688) {
-                        if (input[0] <= 1630.7999877929688) {
-                            var42 = 1489.01;
-                        } else {
-                            var42 = 1556.78;
-                        }
-                    } else {
-                        if (input[3] <= 2976.949951171875) {
-                            var42 = 2782.355714285714;
-                        } else {
-                            var42 = 2146.42;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 3464.5899658203125) {
-                        if (input[0] <= 2100.1199951171875) {
-                            var42 = 3407.93;
-                        } else {
-                            var42 = 3821.73;
-                        }
-                    } else {
-                        if (input[0] <= 1962.760009765625) {
-                            var42 = 1287.3899999999999;
-                        } else {
-                            var42 = 2598.9533333333334;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4864.93017578125) {
-            if (input[3] <= 5149.5751953125) {
-                if (input[0] <= 4087.300048828125) {
-                    if (input[4] <= 4553.56982421875) {
-                        if (input[0] <= 3415.75) {
-                            var42 = 3260.84;
-                        } else {
-                            var42 = 3823.6772727272723;
-                        }
-                    } else {
-                        if (input[1] <= 2091.7300415039062) {
-                            var42 = 4681.01;
-                        } else {
-                            var42 = 4220.595;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4556.625) {
-                        if (input[4] <= 2105.4649658203125) {
-                            var42 = 2888.4300000000003;
-                        } else {
-                            var42 = 4494.374166666666;
-                        }
-                    } else {
-                        if (input[0] <= 4703.905029296875) {
-                            var42 = 4639.167874015748;
-                        } else {
-                            var42 = 4783.96105769231;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 4943.52490234375) {
-                    if (input[3] <= 5170.179931640625) {
-                        if (input[0] <= 4750.454833984375) {
-                            var42 = 2312.27;
-                        } else {
-                            var42 = 3147.13;
-                        }
-                    } else {
-                        if (input[1] <= 4921.39501953125) {
-                            var42 = 1304.9475;
-                        } else {
-                            var42 = 1465.2;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5225.885009765625) {
-                        var42 = 3417.28;
-                    } else {
-                        var42 = 4948.11;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5127.445068359375) {
-                if (input[3] <= 5281.594970703125) {
-                    if (input[0] <= 4999.239990234375) {
-                        if (input[2] <= 5075.550048828125) {
-                            var42 = 4938.988024691358;
-                        } else {
-                            var42 = 4547.211111111112;
-                        }
-                    } else {
-                        if (input[3] <= 5225.885009765625) {
-                            var42 = 5063.822543859649;
-                        } else {
-                            var42 = 4807.885;
-                        }
-                    }
-                } else {
-                    var42 = 3992.67;
-                }
-            } else {
-                if (input[1] <= 5286.93505859375) {
-                    if (input[0] <= 5211.39013671875) {
-                        if (input[3] <= 5243.43505859375) {
-                            var42 = 5162.535584415586;
-                        } else {
-                            var42 = 5066.14;
-                        }
-                    } else {
-                        if (input[3] <= 5255.650146484375) {
-                            var42 = 5223.487714285715;
-                        } else {
-                            var42 = 5255.512941176472;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5355.614990234375) {
-                        if (input[0] <= 5336.5400390625) {
-                            var42 = 5303.1525;
-                        } else {
-                            var42 = 5342.97;
-                        }
-                    } else {
-                        if (input[0] <= 5408.27001953125) {
-                            var42 = 5381.780952380952;
-                        } else {
-                            var42 = 5420.634;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var43;
-    if (input[0] <= 2865.5399169921875) {
-        if (input[0] <= 1752.1400146484375) {
-            if (input[0] <= 628.0549926757812) {
-                var43 = 5024.42;
-            } else {
-                if (input[0] <= 1333.1799926757812) {
-                    if (input[4] <= 1266.0250244140625) {
-                        if (input[0] <= 1279.0) {
-                            var43 = 1258.2673157894733;
-                        } else {
-                            var43 = 1291.40125;
-                        }
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var43 = 2436.9144444444446;
-                        } else {
-                            var43 = 1286.1333227848106;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1322.5) {
-                        if (input[2] <= 1311.0499877929688) {
-                            var43 = 2001.87;
-                        } else {
-                            var43 = 3220.39;
-                        }
-                    } else {
-                        if (input[0] <= 1512.5150146484375) {
-                            var43 = 1370.389090909091;
-                        } else {
-                            var43 = 1638.8125;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[1] <= 1610.9599609375) {
-                var43 = 4681.01;
-            } else {
-                if (input[0] <= 2131.4100341796875) {
-                    if (input[1] <= 1986.4200439453125) {
-                        if (input[1] <= 1823.1099853515625) {
-                            var43 = 2181.01;
-                        } else {
-                            var43 = 2315.32;
-                        }
-                    } else {
-                        if (input[4] <= 4087.300048828125) {
-                            var43 = 1556.78;
-                        } else {
-                            var43 = 1704.82;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 2688.4949951171875) {
-                        if (input[1] <= 1992.5199584960938) {
-                            var43 = 3821.73;
-                        } else {
-                            var43 = 2718.7625000000003;
-                        }
-                    } else {
-                        if (input[1] <= 4043.0399169921875) {
-                            var43 = 2222.2225;
-                        } else {
-                            var43 = 1265.26;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4892.400146484375) {
-            if (input[3] <= 5168.650146484375) {
-                if (input[0] <= 3985.0450439453125) {
-                    if (input[2] <= 2574.784912109375) {
-                        if (input[1] <= 2259.614990234375) {
-                            var43 = 4848.39;
-                        } else {
-                            var43 = 4230.158;
-                        }
-                    } else {
-                        if (input[0] <= 3530.97998046875) {
-                            var43 = 3402.9700000000003;
-                        } else {
-                            var43 = 3908.3500000000004;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4688.64501953125) {
-                        if (input[3] <= 4716.114990234375) {
-                            var43 = 4574.296;
-                        } else {
-                            var43 = 4140.296111111111;
-                        }
-                    } else {
-                        if (input[3] <= 5150.335205078125) {
-                            var43 = 4786.982875816991;
-                        } else {
-                            var43 = 3826.31;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 4946.580078125) {
-                    if (input[1] <= 4921.39501953125) {
-                        if (input[3] <= 5250.31005859375) {
-                            var43 = 1287.7775000000001;
-                        } else {
-                            var43 = 1349.21;
-                        }
-                    } else {
-                        var43 = 1465.2;
-                    }
-                } else {
-                    if (input[2] <= 5103.02490234375) {
-                        var43 = 4948.11;
-                    } else {
-                        if (input[2] <= 5113.704833984375) {
-                            var43 = 2991.45;
-                        } else {
-                            var43 = 1613.25;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5182.385009765625) {
-                if (input[3] <= 5281.594970703125) {
-                    if (input[0] <= 5052.655029296875) {
-                        if (input[3] <= 5156.43994140625) {
-                            var43 = 4986.440096153847;
-                        } else {
-                            var43 = 4842.9655555555555;
-                        }
-                    } else {
-                        if (input[3] <= 5211.39013671875) {
-                            var43 = 5100.506446280991;
-                        } else {
-                            var43 = 4921.944285714286;
-                        }
-                    }
-                } else {
-                    var43 = 3992.67;
-                }
-            } else {
-                if (input[0] <= 5289.22509765625) {
-                    if (input[1] <= 5256.41015625) {
-                        if (input[0] <= 5228.175048828125) {
-                            var43 = 5203.685606060608;
-                        } else {
-                            var43 = 5231.196458333334;
-                        }
-                    } else {
-                        if (input[0] <= 5266.330078125) {
-                            var43 = 5254.1224999999995;
-                        } else {
-                            var43 = 5274.843846153846;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5340.35498046875) {
-                        if (input[4] <= 5293.0400390625) {
-                            var43 = 5344.933333333333;
-                        } else {
-                            var43 = 5297.958888888888;
-                        }
-                    } else {
-                        if (input[2] <= 5396.824951171875) {
-                            var43 = 5363.175238095238;
-                        } else {
-                            var43 = 5404.7108333333335;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var44;
-    if (input[0] <= 2865.5399169921875) {
-        if (input[0] <= 1666.6649780273438) {
-            if (input[0] <= 628.0549926757812) {
-                var44 = 5024.42;
-            } else {
-                if (input[0] <= 1465.9649658203125) {
-                    if (input[0] <= 1264.5) {
-                        if (input[0] <= 1259.9200439453125) {
-                            var44 = 1257.2396645702308;
-                        } else {
-                            var44 = 1261.875523809524;
-                        }
-                    } else {
-                        if (input[2] <= 1264.5) {
-                            var44 = 2565.43875;
-                        } else {
-                            var44 = 1305.174921052632;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 1419.4150390625) {
-                        if (input[4] <= 4912.239990234375) {
-                            var44 = 3220.39;
-                        } else {
-                            var44 = 3644.69;
-                        }
-                    } else {
-                        if (input[0] <= 1520.14501953125) {
-                            var44 = 1474.1385714285716;
-                        } else {
-                            var44 = 1845.75;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1382.0250244140625) {
-                if (input[0] <= 2259.614990234375) {
-                    if (input[0] <= 1878.8150024414062) {
-                        var44 = 4629.12;
-                    } else {
-                        var44 = 4952.69;
-                    }
-                } else {
-                    var44 = 3922.47;
-                }
-            } else {
-                if (input[4] <= 4969.47509765625) {
-                    if (input[3] <= 2615.9949951171875) {
-                        if (input[2] <= 2036.02001953125) {
-                            var44 = 2244.7325;
-                        } else {
-                            var44 = 2847.2200000000003;
-                        }
-                    } else {
-                        if (input[4] <= 4494.81005859375) {
-                            var44 = 1940.1719999999998;
-                        } else {
-                            var44 = 1265.26;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5227.4150390625) {
-                        if (input[2] <= 2864.7750244140625) {
-                            var44 = 3821.73;
-                        } else {
-                            var44 = 3444.75;
-                        }
-                    } else {
-                        var44 = 2255.8;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4863.400146484375) {
-            if (input[3] <= 5154.9150390625) {
-                if (input[0] <= 4304.02490234375) {
-                    if (input[4] <= 4410.864990234375) {
-                        if (input[1] <= 4250.610107421875) {
-                            var44 = 3408.763684210526;
-                        } else {
-                            var44 = 1393.47;
-                        }
-                    } else {
-                        if (input[4] <= 4489.47021484375) {
-                            var44 = 3913.9199999999996;
-                        } else {
-                            var44 = 4242.137586206897;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4672.6201171875) {
-                        if (input[1] <= 4144.53515625) {
-                            var44 = 4969.168;
-                        } else {
-                            var44 = 4574.223416149067;
-                        }
-                    } else {
-                        if (input[3] <= 5086.22998046875) {
-                            var44 = 4773.004000000001;
-                        } else {
-                            var44 = 4183.46;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4763.429931640625) {
-                    if (input[1] <= 4892.39990234375) {
-                        if (input[2] <= 4921.39501953125) {
-                            var44 = 1280.53;
-                        } else {
-                            var44 = 1303.42;
-                        }
-                    } else {
-                        if (input[4] <= 5080.89501953125) {
-                            var44 = 1613.25;
-                        } else {
-                            var44 = 1465.2;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5217.4951171875) {
-                        if (input[1] <= 4967.184814453125) {
-                            var44 = 3531.7450000000003;
-                        } else {
-                            var44 = 4948.11;
-                        }
-                    } else {
-                        var44 = 1286.63;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5040.445068359375) {
-                if (input[2] <= 5076.31494140625) {
-                    if (input[0] <= 4947.344970703125) {
-                        if (input[0] <= 4903.0849609375) {
-                            var44 = 4877.730277777778;
-                        } else {
-                            var44 = 4933.2259375;
-                        }
-                    } else {
-                        if (input[3] <= 4822.955078125) {
-                            var44 = 5111.99125;
-                        } else {
-                            var44 = 5001.999014084507;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4902.320068359375) {
-                        var44 = 2991.45;
-                    } else {
-                        if (input[1] <= 5077.0751953125) {
-                            var44 = 4573.79375;
-                        } else {
-                            var44 = 4818.682000000001;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5211.385009765625) {
-                    if (input[2] <= 3131.1050415039062) {
-                        var44 = 4496.34;
-                    } else {
-                        if (input[3] <= 5272.434814453125) {
-                            var44 = 5119.891955307261;
-                        } else {
-                            var44 = 4618.44;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5299.14501953125) {
-                        if (input[0] <= 5256.41015625) {
-                            var44 = 5217.37309859155;
-                        } else {
-                            var44 = 5271.037083333334;
-                        }
-                    } else {
-                        if (input[0] <= 5367.824951171875) {
-                            var44 = 5336.0536363636365;
-                        } else {
-                            var44 = 5395.043333333333;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var45;
-    if (input[0] <= 3419.570068359375) {
-        if (input[0] <= 1659.0349731445312) {
-            if (input[0] <= 627.2899780273438) {
-                var45 = 5024.42;
-            } else {
-                if (input[0] <= 1370.5750122070312) {
-                    if (input[0] <= 1266.0250244140625) {
-                        if (input[3] <= 1266.0250244140625) {
-                            var45 = 1258.0709965635735;
-                        } else {
-                            var45 = 1206.0845454545454;
-                        }
-                    } else {
-                        if (input[2] <= 1264.5) {
-                            var45 = 1714.3625;
-                        } else {
-                            var45 = 1288.0387643678162;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 1375.9150390625) {
-                        if (input[0] <= 1420.9400024414062) {
-                            var45 = 1927.66;
-                        } else {
-                            var45 = 3220.39;
-                        }
-                    } else {
-                        if (input[3] <= 1460.625) {
-                            var45 = 1526.0822222222223;
-                        } else {
-                            var45 = 1397.3536363636363;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[2] <= 1481.989990234375) {
-                if (input[1] <= 1455.2799682617188) {
-                    if (input[2] <= 1324.7849731445312) {
-                        var45 = 5170.94;
-                    } else {
-                        var45 = 4952.69;
-                    }
-                } else {
-                    var45 = 3922.47;
-                }
-            } else {
-                if (input[0] <= 2168.8050537109375) {
-                    if (input[1] <= 1986.4200439453125) {
-                        if (input[1] <= 1823.1099853515625) {
-                            var45 = 2181.01;
-                        } else {
-                            var45 = 2315.32;
-                        }
-                    } else {
-                        var45 = 1556.78;
-                    }
-                } else {
-                    if (input[1] <= 3974.35986328125) {
-                        if (input[3] <= 4368.135009765625) {
-                            var45 = 2817.97;
-                        } else {
-                            var45 = 3880.7466666666664;
-                        }
-                    } else {
-                        var45 = 1944.4399999999998;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4824.47998046875) {
-            if (input[3] <= 5158.72998046875) {
-                if (input[0] <= 4303.264892578125) {
-                    if (input[3] <= 2125.304931640625) {
-                        if (input[4] <= 4676.43505859375) {
-                            var45 = 4869.756666666667;
-                        } else {
-                            var45 = 4186.506666666667;
-                        }
-                    } else {
-                        if (input[4] <= 4465.81005859375) {
-                            var45 = 3814.714;
-                        } else {
-                            var45 = 4202.861428571428;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5154.9150390625) {
-                        if (input[0] <= 4688.64501953125) {
-                            var45 = 4546.232022471909;
-                        } else {
-                            var45 = 4742.834945054947;
-                        }
-                    } else {
-                        if (input[4] <= 5245.72998046875) {
-                            var45 = 3826.31;
-                        } else {
-                            var45 = 3147.13;
-                        }
-                    }
-                }
-            } else {
-                if (input[4] <= 5245.724853515625) {
-                    if (input[0] <= 4609.280029296875) {
-                        if (input[1] <= 4803.8798828125) {
-                            var45 = 1303.42;
-                        } else {
-                            var45 = 1280.53;
-                        }
-                    } else {
-                        if (input[2] <= 5088.52001953125) {
-                            var45 = 1465.2;
-                        } else {
-                            var45 = 1613.25;
-                        }
-                    }
-                } else {
-                    var45 = 2312.27;
-                }
-            }
-        } else {
-            if (input[0] <= 5110.655029296875) {
-                if (input[3] <= 5165.594970703125) {
-                    if (input[0] <= 4971.76513671875) {
-                        if (input[0] <= 4907.659912109375) {
-                            var45 = 4876.581818181819;
-                        } else {
-                            var45 = 4958.1433333333325;
-                        }
-                    } else {
-                        if (input[0] <= 5052.655029296875) {
-                            var45 = 5005.120379746836;
-                        } else {
-                            var45 = 5094.08980392157;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4970.239990234375) {
-                        var45 = 2991.45;
-                    } else {
-                        if (input[4] <= 3866.7601318359375) {
-                            var45 = 3992.67;
-                        } else {
-                            var45 = 4852.87;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5286.93505859375) {
-                    if (input[0] <= 5197.650146484375) {
-                        if (input[3] <= 5219.780029296875) {
-                            var45 = 5151.582653061223;
-                        } else {
-                            var45 = 5016.967647058824;
-                        }
-                    } else {
-                        if (input[0] <= 5226.650146484375) {
-                            var45 = 5199.753658536586;
-                        } else {
-                            var45 = 5235.472968750001;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 5358.670166015625) {
-                        if (input[0] <= 5339.58984375) {
-                            var45 = 5307.063124999999;
-                        } else {
-                            var45 = 5345.12375;
-                        }
-                    } else {
-                        if (input[0] <= 5354.85009765625) {
-                            var45 = 5428.88;
-                        } else {
-                            var45 = 5389.4225;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var46;
-    if (input[0] <= 3431.0150146484375) {
-        if (input[0] <= 1630.7999877929688) {
-            if (input[0] <= 1465.9649658203125) {
-                if (input[4] <= 1267.5549926757812) {
-                    if (input[4] <= 1266.0250244140625) {
-                        if (input[2] <= 1282.050048828125) {
-                            var46 = 1258.2210016977942;
-                        } else {
-                            var46 = 1285.4875;
-                        }
-                    } else {
-                        if (input[2] <= 1266.0250244140625) {
-                            var46 = 1148.849090909091;
-                        } else {
-                            var46 = 1265.566;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 1261.4450073242188) {
-                        if (input[0] <= 1262.2100219726562) {
-                            var46 = 1266.79;
-                        } else {
-                            var46 = 4611.57;
-                        }
-                    } else {
-                        if (input[3] <= 1266.0250244140625) {
-                            var46 = 1762.0600000000002;
-                        } else {
-                            var46 = 1296.094722222223;
-                        }
-                    }
-                }
-            } else {
-                if (input[1] <= 1433.1500244140625) {
-                    if (input[1] <= 1354.5449829101562) {
-                        var46 = 3644.69;
-                    } else {
-                        var46 = 3220.39;
-                    }
-                } else {
-                    if (input[2] <= 1520.9100341796875) {
-                        var46 = 1755.19;
-                    } else {
-                        if (input[4] <= 2290.9049682617188) {
-                            var46 = 1350.73;
-                        } else {
-                            var46 = 1438.49;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1403.3900146484375) {
-                if (input[2] <= 1337.7599487304688) {
-                    var46 = 3922.47;
-                } else {
-                    if (input[2] <= 1358.364990234375) {
-                        var46 = 4629.12;
-                    } else {
-                        var46 = 4681.01;
-                    }
-                }
-            } else {
-                if (input[0] <= 2560.2900390625) {
-                    if (input[1] <= 2228.324951171875) {
-                        if (input[1] <= 2036.02001953125) {
-                            var46 = 2315.32;
-                        } else {
-                            var46 = 2562.58;
-                        }
-                    } else {
-                        if (input[1] <= 2545.02490234375) {
-                            var46 = 1704.82;
-                        } else {
-                            var46 = 2081.81;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5108.364990234375) {
-                        if (input[4] <= 4782.510009765625) {
-                            var46 = 2753.138571428571;
-                        } else {
-                            var46 = 3854.55;
-                        }
-                    } else {
-                        var46 = 1944.44;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4857.294921875) {
-            if (input[3] <= 5199.18017578125) {
-                if (input[0] <= 4177.35498046875) {
-                    if (input[4] <= 4447.494873046875) {
-                        if (input[4] <= 3518.77490234375) {
-                            var46 = 3843.1033333333344;
-                        } else {
-                            var46 = 3495.3683333333333;
-                        }
-                    } else {
-                        if (input[2] <= 3964.4400634765625) {
-                            var46 = 4214.17125;
-                        } else {
-                            var46 = 4024.2166666666667;
-                        }
-                    }
-                } else {
-                    if (input[4] <= 5241.14501953125) {
-                        if (input[0] <= 4689.41015625) {
-                            var46 = 4536.627079646016;
-                        } else {
-                            var46 = 4770.942260869565;
-                        }
-                    } else {
-                        var46 = 1303.42;
-                    }
-                }
-            } else {
-                if (input[3] <= 5280.070068359375) {
-                    if (input[2] <= 5062.5751953125) {
-                        var46 = 1465.2;
-                    } else {
-                        if (input[4] <= 5170.175048828125) {
-                            var46 = 1286.63;
-                        } else {
-                            var46 = 1349.21;
-                        }
-                    }
-                } else {
-                    var46 = 1613.25;
-                }
-            }
-        } else {
-            if (input[0] <= 5070.969970703125) {
-                if (input[2] <= 5079.364990234375) {
-                    if (input[0] <= 4903.0849609375) {
-                        if (input[4] <= 5086.235107421875) {
-                            var46 = 4867.080882352942;
-                        } else {
-                            var46 = 4954.21;
-                        }
-                    } else {
-                        if (input[3] <= 4802.349853515625) {
-                            var46 = 5115.526153846154;
-                        } else {
-                            var46 = 4991.914954954956;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4992.3701171875) {
-                        var46 = 2991.45;
-                    } else {
-                        if (input[0] <= 4934.3701171875) {
-                            var46 = 4515.872;
-                        } else {
-                            var46 = 4805.068;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5204.51513671875) {
-                    if (input[2] <= 3268.4649047851562) {
-                        var46 = 4496.34;
-                    } else {
-                        if (input[3] <= 5041.97509765625) {
-                            var46 = 5187.992068965517;
-                        } else {
-                            var46 = 5103.22914728682;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 5309.829833984375) {
-                        if (input[0] <= 5275.489990234375) {
-                            var46 = 5224.089240506329;
-                        } else {
-                            var46 = 5294.289090909091;
-                        }
-                    } else {
-                        if (input[2] <= 5370.880126953125) {
-                            var46 = 5354.598888888889;
-                        } else {
-                            var46 = 5403.694375;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var47;
-    if (input[0] <= 1666.6649780273438) {
-        if (input[0] <= 627.2899780273438) {
-            var47 = 5024.42;
-        } else {
-            if (input[0] <= 1465.9649658203125) {
-                if (input[0] <= 1312.5750122070312) {
-                    if (input[0] <= 1266.0250244140625) {
-                        if (input[3] <= 1266.0250244140625) {
-                            var47 = 1258.2947160068848;
-                        } else {
-                            var47 = 1194.25;
-                        }
-                    } else {
-                        if (input[2] <= 1264.5) {
-                            var47 = 1714.5537499999998;
-                        } else {
-                            var47 = 1280.9302317880802;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1307.9949951171875) {
-                        if (input[4] <= 4779.4599609375) {
-                            var47 = 1702.6414285714288;
-                        } else {
-                            var47 = 2259.615;
-                        }
-                    } else {
-                        if (input[0] <= 1351.5) {
-                            var47 = 1315.165652173913;
-                        } else {
-                            var47 = 1382.306875;
-                        }
-                    }
-                }
-            } else {
-                if (input[2] <= 1380.4949951171875) {
-                    if (input[2] <= 1302.655029296875) {
-                        var47 = 3644.69;
-                    } else {
-                        var47 = 3220.39;
-                    }
-                } else {
-                    if (input[0] <= 1567.4600219726562) {
-                        if (input[0] <= 1498.780029296875) {
-                            var47 = 1488.855;
-                        } else {
-                            var47 = 1628.51;
-                        }
-                    } else {
-                        var47 = 1891.03;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4530.675048828125) {
-            if (input[2] <= 4902.320068359375) {
-                if (input[4] <= 4447.494873046875) {
-                    if (input[2] <= 1485.8049926757812) {
-                        if (input[3] <= 1298.8400268554688) {
-                            var47 = 5100.224999999999;
-                        } else {
-                            var47 = 4629.12;
-                        }
-                    } else {
-                        if (input[0] <= 2912.8499755859375) {
-                            var47 = 2377.4300000000003;
-                        } else {
-                            var47 = 3604.361538461538;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 2407.659912109375) {
-                        if (input[2] <= 4052.2000732421875) {
-                            var47 = 3444.75;
-                        } else {
-                            var47 = 1265.26;
-                        }
-                    } else {
-                        if (input[0] <= 3183.7598876953125) {
-                            var47 = 3852.8720000000003;
-                        } else {
-                            var47 = 4395.791836734695;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4243.739990234375) {
-                    var47 = 1349.21;
-                } else {
-                    var47 = 1280.53;
-                }
-            }
-        } else {
-            if (input[0] <= 4864.1650390625) {
-                if (input[3] <= 5168.650146484375) {
-                    if (input[3] <= 5120.5751953125) {
-                        if (input[0] <= 4678.72509765625) {
-                            var47 = 4594.487757009345;
-                        } else {
-                            var47 = 4772.011344537814;
-                        }
-                    } else {
-                        if (input[3] <= 5156.440185546875) {
-                            var47 = 3147.13;
-                        } else {
-                            var47 = 3826.31;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 4858.824951171875) {
-                        if (input[1] <= 4991.60498046875) {
-                            var47 = 1292.2266666666667;
-                        } else {
-                            var47 = 1613.25;
-                        }
-                    } else {
-                        var47 = 3417.28;
-                    }
-                }
-            } else {
-                if (input[0] <= 5182.385009765625) {
-                    if (input[0] <= 4980.920166015625) {
-                        if (input[2] <= 5028.235107421875) {
-                            var47 = 4930.750384615385;
-                        } else {
-                            var47 = 4746.7446666666665;
-                        }
-                    } else {
-                        if (input[3] <= 5264.804931640625) {
-                            var47 = 5065.615045871559;
-                        } else {
-                            var47 = 4305.555;
-                        }
-                    }
-                } else {
-                    if (input[0] <= 5289.98486328125) {
-                        if (input[0] <= 5211.385009765625) {
-                            var47 = 5186.711578947367;
-                        } else {
-                            var47 = 5231.768229166668;
-                        }
-                    } else {
-                        if (input[0] <= 5369.35498046875) {
-                            var47 = 5330.3347826086965;
-                        } else {
-                            var47 = 5396.616363636364;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var48;
-    if (input[0] <= 2902.929931640625) {
-        if (input[0] <= 1465.9649658203125) {
-            if (input[0] <= 627.2899780273438) {
-                var48 = 5024.42;
-            } else {
-                if (input[0] <= 1333.1799926757812) {
-                    if (input[4] <= 1266.0250244140625) {
-                        if (input[0] <= 1279.0) {
-                            var48 = 1258.5304227941178;
-                        } else {
-                            var48 = 1294.1109999999999;
-                        }
-                    } else {
-                        if (input[3] <= 1259.9199829101562) {
-                            var48 = 3822.88;
-                        } else {
-                            var48 = 1291.6270655270662;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1295.7849731445312) {
-                        if (input[4] <= 4942.005126953125) {
-                            var48 = 1927.66;
-                        } else {
-                            var48 = 2466.42;
-                        }
-                    } else {
-                        if (input[1] <= 1321.7349853515625) {
-                            var48 = 1704.82;
-                        } else {
-                            var48 = 1377.7819444444447;
-                        }
-                    }
-                }
-            }
-        } else {
-            if (input[3] <= 1351.4949951171875) {
-                if (input[0] <= 1588.824951171875) {
-                    if (input[1] <= 1354.5449829101562) {
-                        var48 = 3644.69;
-                    } else {
-                        var48 = 3220.39;
-                    }
-                } else {
-                    if (input[3] <= 1292.7349853515625) {
-                        var48 = 4952.69;
-                    } else {
-                        var48 = 4629.12;
-                    }
-                }
-            } else {
-                if (input[0] <= 2560.2900390625) {
-                    if (input[1] <= 3704.9749755859375) {
-                        if (input[3] <= 4339.1298828125) {
-                            var48 = 1857.2309523809527;
-                        } else {
-                            var48 = 2850.275;
-                        }
-                    } else {
-                        if (input[2] <= 4574.175048828125) {
-                            var48 = 1350.73;
-                        } else {
-                            var48 = 1273.3999999999999;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 2806.780029296875) {
-                        if (input[2] <= 2378.6600341796875) {
-                            var48 = 2800.67;
-                        } else {
-                            var48 = 2916.67;
-                        }
-                    } else {
-                        var48 = 2275.64;
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4864.1650390625) {
-            if (input[3] <= 5149.5751953125) {
-                if (input[0] <= 3985.0450439453125) {
-                    if (input[3] <= 5108.364990234375) {
-                        if (input[2] <= 2633.544921875) {
-                            var48 = 4359.16625;
-                        } else {
-                            var48 = 3677.7583333333337;
-                        }
-                    } else {
-                        var48 = 1944.44;
-                    }
-                } else {
-                    if (input[0] <= 4638.27490234375) {
-                        if (input[4] <= 2858.669921875) {
-                            var48 = 4096.677142857143;
-                        } else {
-                            var48 = 4549.231928571429;
-                        }
-                    } else {
-                        if (input[3] <= 4482.599853515625) {
-                            var48 = 4905.712777777778;
-                        } else {
-                            var48 = 4739.768029197079;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 4763.429931640625) {
-                    if (input[4] <= 5245.724853515625) {
-                        if (input[0] <= 4609.280029296875) {
-                            var48 = 1311.0533333333333;
-                        } else {
-                            var48 = 1563.8999999999999;
-                        }
-                    } else {
-                        var48 = 2312.27;
-                    }
-                } else {
-                    if (input[2] <= 5060.2900390625) {
-                        if (input[4] <= 5245.72998046875) {
-                            var48 = 3580.892;
-                        } else {
-                            var48 = 3147.13;
-                        }
-                    } else {
-                        var48 = 4948.11;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 5183.150146484375) {
-                if (input[0] <= 5057.235107421875) {
-                    if (input[0] <= 4931.31494140625) {
-                        if (input[2] <= 5028.235107421875) {
-                            var48 = 4897.359583333334;
-                        } else {
-                            var48 = 4668.04;
-                        }
-                    } else {
-                        if (input[3] <= 5144.994873046875) {
-                            var48 = 5019.291511627907;
-                        } else {
-                            var48 = 4806.860909090909;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 3208.9400024414062) {
-                        var48 = 4496.34;
-                    } else {
-                        if (input[3] <= 5220.544921875) {
-                            var48 = 5120.624090909091;
-                        } else {
-                            var48 = 4994.402777777777;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5290.75) {
-                    if (input[0] <= 5217.489990234375) {
-                        if (input[3] <= 5247.2548828125) {
-                            var48 = 5195.6466666666665;
-                        } else {
-                            var48 = 5079.365;
-                        }
-                    } else {
-                        if (input[0] <= 5258.7001953125) {
-                            var48 = 5224.608372093023;
-                        } else {
-                            var48 = 5268.390499999999;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 5389.955078125) {
-                        if (input[0] <= 5339.58984375) {
-                            var48 = 5310.594166666667;
-                        } else {
-                            var48 = 5355.34705882353;
-                        }
-                    } else {
-                        if (input[4] <= 5327.385009765625) {
-                            var48 = 5430.096;
-                        } else {
-                            var48 = 5397.883076923076;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    double var49;
-    if (input[0] <= 1659.0349731445312) {
-        if (input[0] <= 627.2899780273438) {
-            var49 = 5024.42;
-        } else {
-            if (input[0] <= 1433.9149780273438) {
-                if (input[0] <= 1266.0250244140625) {
-                    if (input[0] <= 1259.9200439453125) {
-                        if (input[4] <= 1258.39501953125) {
-                            var49 = 1256.8522916666666;
-                        } else {
-                            var49 = 1258.8628225806463;
-                        }
-                    } else {
-                        if (input[2] <= 1258.39501953125) {
-                            var49 = 1282.05;
-                        } else {
-                            var49 = 1262.0693577981656;
-                        }
-                    }
-                } else {
-                    if (input[2] <= 1258.39501953125) {
-                        var49 = 4548.23;
-                    } else {
-                        if (input[2] <= 1264.5) {
-                            var49 = 1856.1766666666665;
-                        } else {
-                            var49 = 1296.1151111111117;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 1351.4949951171875) {
-                    if (input[4] <= 4809.97998046875) {
-                        var49 = 3421.86;
-                    } else {
-                        var49 = 3644.69;
-                    }
-                } else {
-                    if (input[2] <= 3350.125) {
-                        if (input[2] <= 1468.2550048828125) {
-                            var49 = 1533.88;
-                        } else {
-                            var49 = 1451.8475;
-                        }
-                    } else {
-                        if (input[4] <= 5244.199951171875) {
-                            var49 = 1289.68;
-                        } else {
-                            var49 = 1285.1;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        if (input[0] <= 4669.56494140625) {
-            if (input[2] <= 4681.01513671875) {
-                if (input[0] <= 4297.159912109375) {
-                    if (input[3] <= 1398.8099975585938) {
-                        if (input[4] <= 4808.455078125) {
-                            var49 = 4832.569;
-                        } else {
-                            var49 = 4003.054;
-                        }
-                    } else {
-                        if (input[0] <= 3193.6849365234375) {
-                            var49 = 2610.2300000000005;
-                        } else {
-                            var49 = 3811.472068965518;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4153.695068359375) {
-                        var49 = 5157.2;
-                    } else {
-                        if (input[0] <= 4457.4150390625) {
-                            var49 = 4421.548823529412;
-                        } else {
-                            var49 = 4596.67872180451;
-                        }
-                    }
-                }
-            } else {
-                if (input[3] <= 5144.9951171875) {
-                    if (input[2] <= 4729.08984375) {
-                        if (input[3] <= 4693.985107421875) {
-                            var49 = 4636.75;
-                        } else {
-                            var49 = 1698.9357142857145;
-                        }
-                    } else {
-                        if (input[4] <= 5238.094970703125) {
-                            var49 = 4572.0380000000005;
-                        } else {
-                            var49 = 3710.32;
-                        }
-                    }
-                } else {
-                    if (input[3] <= 5280.070068359375) {
-                        if (input[4] <= 5206.044921875) {
-                            var49 = 1349.21;
-                        } else {
-                            var49 = 1297.6975;
-                        }
-                    } else {
-                        var49 = 1613.25;
-                    }
-                }
-            }
-        } else {
-            if (input[0] <= 4900.030029296875) {
-                if (input[3] <= 5150.335205078125) {
-                    if (input[0] <= 4824.47998046875) {
-                        if (input[3] <= 5069.445068359375) {
-                            var49 = 4729.573816793895;
-                        } else {
-                            var49 = 4183.46;
-                        }
-                    } else {
-                        if (input[2] <= 4668.0400390625) {
-                            var49 = 5162.545;
-                        } else {
-                            var49 = 4858.6392;
-                        }
-                    }
-                } else {
-                    if (input[1] <= 4935.89501953125) {
-                        if (input[4] <= 5228.93994140625) {
-                            var49 = 1375.915;
-                        } else {
-                            var49 = 2312.27;
-                        }
-                    } else {
-                        if (input[1] <= 4970.239990234375) {
-                            var49 = 3410.56;
-                        } else {
-                            var49 = 4948.11;
-                        }
-                    }
-                }
-            } else {
-                if (input[0] <= 5182.385009765625) {
-                    if (input[3] <= 5281.594970703125) {
-                        if (input[0] <= 5069.445068359375) {
-                            var49 = 4980.328492063496;
-                        } else {
-                            var49 = 5104.527638888888;
-                        }
-                    } else {
-                        var49 = 3992.67;
-                    }
-                } else {
-                    if (input[0] <= 5291.514892578125) {
-                        if (input[0] <= 5217.489990234375) {
-                            var49 = 5186.71119047619;
-                        } else {
-                            var49 = 5234.919729729729;
-                        }
-                    } else {
-                        if (input[0] <= 5342.64501953125) {
-                            var49 = 5317.46;
-                        } else {
-                            var49 = 5377.892162162161;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    return (var0 + var1 + var2 + var3 + var4 + var5 + var6 + var7 + var8 + var9 + var10 + var11 + var12 + var13 + var14 + var15 + var16 + var17 + var18 + var19 + var20 + var21 + var22 + var23 + var24 + var25 + var26 + var27 + var28 + var29 + var30 + var31 + var32 + var33 + var34 + var35 + var36 + var37 + var38 + var39 + var40 + var41 + var42 + var43 + var44 + var45 + var46 + var47 + var48 + var49) * 0.02;
+/**
+ * EPS Predictive FDIR - Voltage model (table-driven RandomForest)
+ * Generated by eps_forest_export.py from voltage_forest.json -- do not edit
+ *
+ * Trees: 50, internal nodes: 2348, leaves: 2398 (1525 distinct values), features: 5
+ * Backend selected with EPS_FOREST_BACKEND (eps_forest.h)
+ */
+
+#include "eps_forest.h"
+#include "eps_forest_binned.h"
+#include "eps_forest_f32.h"
+#include "eps_forest_fixed.h"
+#include "eps_forest_implicit.h"
+#include "eps_forest_q.h"
+#include "eps_forest_qs.h"
+#include "voltage_model.h"
+
+#if EPS_MODEL_VOLTAGE_N_FEATURES != 5
+#error "voltage_model.h does not match these tables; rerun eps_forest_export.py"
+#endif
+
+#if EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_TABLE) || EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_BINNED) || EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_FLOAT32)
+
+static const int16_t voltage_roots[50] = {
+    0, 54, 108, 152, 202, 245, 288, 331, 374, 422, 469, 516, 561, 606, 646, 686,
+    739, 791, 836, 882, 927, 980, 1030, 1078, 1127, 1179, 1230, 1274, 1329, 1375, 1425, 1474,
+    1522, 1575, 1620, 1663, 1715, 1762, 1814, 1858, 1902, 1950, 1992, 2038, 2082, 2129, 2174, 2221,
+    2259, 2306,
+};
+
+static const int16_t voltage_children[4696] = {
+    1, 28, 2, 17, 3, 10, 4, 7, 5, 6, -1, -2, -3, -4, 8, 9,
+    -5, -6, -7, -8, 11, 14, 12, 13, -9, -10, -11, -12, 15, 16, -13, -14,
+    -15, -16, 18, 22, 19, 21, 20, -19, -17, -18, -20, -21, 23, 26, 24, 25,
+    -22, -23, -24, -3, 27, -27, -25, -26, 29, 40, 30, 37, 31, 34, 32, 33,
+    -20, -28, -29, -30, 35, 36, -31, -32, -33, -34, 38, -38, 39, -37, -35, -36,
+    41, 47, 42, 45, 43, 44, -39, -40, -41, -42, 46, -45, -43, -44, 48, 51,
+    49, 50, -46, -47, -48, -49, 52, 53, -50, -51, -52, -53, 55, 79, 56, 70,
+    57, 64, 58, 61, 59, 60, -54, -55, -56, -57, 62, 63, -58, -27, -59, -60,
+    65, 68, 66, 67, -61, -62, -63, -64, 69, -67, -65, -66, 71, 73, 72, -19,
+    -20, -68, 74, 77, 75, 76, -69, -70, -71, -72, 78, -75, -73, -74, 80, 94,
+    81, 88, 82, 85, 83, 84, -76, -77, -78, -79, 86, 87, -80, -81, -82, -83,
+    89, 92, 90, 91, -36, -84, -85, -37, 93, -88, -86, -87, 95, 101, 96, 99,
+    97, 98, -89, -90, -91, -92, -93, 100, -94, -45, 102, 105, 103, 104, -95, -96,
+    -97, -98, 106, 107, -99, -100, -101, -102, 109, 123, -103, 110, 111, 118, 112, 115,
+    113, 114, -104, -105, -106, -107, 116, 117, -62, -108, -109, -110, 119, 120, -64, -18,
+    121, 122, -111, -112, -113, -114, 124, 137, 125, 132, 126, 129, 127, 128, -115, -116,
+    -117, -118, 130, 131, -119, -77, -120, -121, 133, 136, 134, 135, -35, -87, -85, -37,
+    -38, -33, 138, 145, 139, 142, 140, 141, -122, -123, -124, -125, 143, 144, -126, -127,
+    -128, -129, 146, 149, 147, 148, -130, -45, -131, -132, 150, 151, -133, -134, -135, -136,
+    153, 176, 154, 168, 155, 162, 156, 159, 157, 158, -137, -138, -3, -139, 160, 161,
+    -140, -141, -142, -143, 163, 165, -144, 164, -64, -18, 166, 167, -145, -146, -147, -148,
+    169, 170, -68, -20, 171, 174, 172, 173, -149, -150, -151, -152, -153, 175, -154, -155,
+    177, 189, 178, 185, 179, 182, 180, 181, -156, -157, -29, -158, 183, 184, -159, -160,
+    -33, -34, 186, -38, 187, 188, -36, -35, -85, -37, 190, 196, 191, 194, 192, 193,
+    -161, -162, -163, -164, -127, 195, -165, -129, 197, 199, -93, 198, -166, -167, 200, 201,
+    -168, -169, -170, -171, 203, 218, -103, 204, 205, 212, 206, 209, 207, 208, -172, -173,
+    -174, -175, 210, 211, -176, -141, -177, -178, 213, 215, 214, -21, -18, -64, 216, 217,
+    -179, -180, -181, -182, 219, 231, 220, 227, 221, 224, 222, 223, -20, -183, -19, -73,
+    225, 226, -74, -184, -185, -186, 228, -87, 229, 230, -187, -188, -189, -190, 232, 238,
+    233, 236, 234, 235, -191, -192, -193, -88, -35, 237, -38, -33, 239, 242, 240, 241,
+    -194, -195, -93, -196, 243, 244, -197, -198, -199, -200, 246, 263, 247, 254, -103, 248,
+    249, 252, 250, 251, -201, -202, -203, -204, 253, -64, -205, -67, 255, 257, -19, 256,
+    -21, -20, 258, 261, 259, 260, -206, -207, -155, -208, 262, -74, -209, -210, 264, 273,
+    265, 271, 266, 268, -77, 267, -211, -212, 269, 270, -213, -214, -215, -216, 272, -127,
+    -35, -85, 274, 281, 275, 278, 276, 277, -217, -218, -219, -220, 279, 280, -221, -222,
+    -223, -224, 282, 285, 283, 284, -225, -226, -227, -228, 286, 287, -229, -230, -231, -232,
+    289, 304, -103, 290, 291, 298, 292, 295, 293, 294, -233, -234, -235, -236, 296, 297,
+    -237, -238, -239, -240, 299, 301, 300, -21, -18, -64, 302, 303, -241, -242, -243, -244,
+    305, 317, 306, 313, 307, 310, 308, 309, -29, -245, -246, -247, 311, 312, -248, -33,
+    -249, -34, 314, 316, -85, 315, -84, -36, -127, -250, 318, 324, 319, 322, 320, 321,
+    -251, -252, -253, -254, 323, -129, -255, -256, 325, 328, 326, 327, -257, -258, -259, -260,
+    329, 330, -261, -262, -263, -264, 332, 348, 333, 341, -103, 334, 335, 338, 336, 337,
+    -265, -266, -267, -268, 339, 340, -17, -18, -269, -67, 342, 344, 343, -21, -68, -183,
+    345, -73, 346, 347, -270, -271, -272, -273, 349, 362, 350, 357, 351, 354, 352, 353,
+    -274, -275, -276, -277, 355, 356, -278, -279, -280, -281, 358, 360, -37, 359, -36, -87,
+    361, -84, -88, -33, 363, 367, 364, -129, 365, 366, -282, -283, -284, -285, 368, 371,
+    369, 370, -286, -45, -287, -288, 372, 373, -289, -290, -291, -292, 375, 397, 376, 389,
+    377, 384, 378, 381, 379, 380, -293, -294, -295, -296, 382, 383, -297, -238, -298, -299,
+    385, 387, 386, -18, -108, -62, 388, -67, -109, -300, 390, 391, -68, -21, 392, 395,
+    393, 394, -301, -302, -303, -75, 396, -277, -304, -305, 398, 410, 399, 405, 400, 402,
+    401, -77, -29, -306, 403, 404, -307, -308, -309, -310, 406, 408, 407, -38, -37, -311,
+    -84, 409, -312, -88, 411, 415, 412, -129, 413, 414, -313, -314, -93, -315, 416, 419,
+    417, 418, -316, -317, -318, -319, 420, 421, -320, -321, -322, -323, 423, 445, 424, 437,
+    425, 432, 426, 429, 427, 428, -324, -325, -326, -327, 430, 431, -328, -329, -3, -330,
+    433, 434, -331, -141, 435, 436, -332, -144, -333, -334, 438, 441, 439, 440, -68, -20,
+    -64, -17, 442, -73, 443, 444, -335, -336, -337, -27, 446, 457, 447, 451, 448, 449,
+    -19, -20, 450, -277, -338, -339, 452, 455, 453, 454, -340, -341, -342, -343, 456, -88,
+    -344, -345, 458, 462, 459, -129, 460, 461, -346, -347, -93, -348, 463, 466, 464, 465,
+    -349, -350, -351, -352, 467, 468, -353, -354, -355, -356, 470, 489, 471, 479, -103, 472,
+    473, 476, 474, 475, -357, -358, -359, -360, 477, 478, -64, -17, -361, -362, 480, 483,
+    481, -19, 482, -21, -183, -68, 484, 487, 485, 486, -363, -364, -365, -27, 488, -273,
+    -366, -367, 490, 501, 491, 497, 492, 494, 493, -76, -368, -369, 495, 496, -370, -371,
+    -33, -34, 498, 500, 499, -38, -372, -373, -374, -250, 502, 509, 503, 506, 504, 505,
+    -375, -376, -91, -377, 507, 508, -378, -379, -380, -381, 510, 513, 511, 512, -382, -383,
+    -384, -385, 514, 515, -386, -387, -388, -389, 517, 537, 518, 526, -103, 519, 520, 523,
+    521, 522, -390, -391, -11, -392, 524, 525, -108, -18, -393, -67, 527, 530, 528, -19,
+    529, -21, -183, -68, 531, 534, 532, 533, -149, -206, -394, -109, 535, 536, -395, -396,
+    -75, -397, 538, 549, 539, 545, 540, 542, 541, -77, -398, -399, 543, 544, -400, -401,
+    -33, -34, 546, 548, 547, -38, -36, -402, -250, -88, 550, 554, 551, -129, 552, 553,
+    -403, -404, -93, -405, 555, 558, 556, 557, -406, -407, -408, -409, 559, 560, -410, -411,
+    -412, -413, 562, 580, 563, 571, -103, 564, 565, 568, 566, 567, -414, -415, -11, -416,
+    569, 570, -417, -17, -418, -419, 572, 573, -19, -183, 574, 577, 575, 576, -149, -420,
+    -109, -421, 578, 579, -422, -423, -424, -72, 581, 592, 582, 588, 583, 586, 584, 585,
+    -425, -426, -277, -77, 587, -33, -427, -428, 589, -38, 590, 591, -429, -36, -37, -85,
+    593, 600, 594, 597, 595, 596, -430, -123, -431, -432, 598, 599, -127, -250, -129, -433,
+    601, 603, -93, 602, -434, -435, 604, 605, -436, -437, -438, -439, 607, 619, -103, 608,
+    609, 615, 610, 613, 611, 612, -440, -441, -442, -443, -64, 614, -444, -445, 616, 617,
+    -68, -20, 618, -27, -446, -447, 620, 632, 621, 627, 622, 624, 623, -77, -448, -449,
+    625, 626, -450, -84, -451, -123, 628, 630, -37, 629, -36, -330, -84, 631, -38, -452,
+    633, 639, 634, 637, 635, 636, -453, -454, -432, -455, 638, -45, -456, -457, 640, 643,
+    641, 642, -458, -459, -460, -461, 644, 645, -462, -463, -464, -465, 647, 662, -103, 648,
+    649, 656, 650, 653, 651, 652, -466, -467, -468, -469, 654, 655, -470, -471, -472, -473,
+    657, 659, -21, 658, -18, -17, 660, 661, -474, -475, -476, -394, 663, 674, 664, 671,
+    665, 668, 666, 667, -477, -478, -19, -479, 669, 670, -74, -480, -481, -482, 672, -483,
+    -27, 673, -77, -36, 675, 679, 676, 678, 677, -37, -484, -485, -35, -38, 680, 683,
+    681, 682, -486, -487, -432, -488, 684, 685, -489, -490, -491, -492, 687, 710, 688, 700,
+    689, 695, 690, 693, 691, 692, -493, -494, -495, -496, -141, 694, -497, -498, 696, 697,
+    -17, -64, 698, 699, -499, -500, -501, -502, 701, 703, -183, 702, -21, -20, 704, 707,
+    705, 706, -420, -207, -394, -109, 708, 709, -503, -504, -75, -277, 711, 725, 712, 719,
+    713, 716, 714, 715, -505, -506, -84, -507, 717, 718, -508, -509, -510, -511, 720, 723,
+    721, 722, -512, -38, -513, -36, 724, -88, -127, -34, 726, 732, 727, 730, 728, 729,
+    -514, -515, -129, -516, -93, 731, -517, -518, 733, 736, 734, 735, -519, -520, -521, -522,
+    737, 738, -523, -524, -525, -526, 740, 764, 741, 753, 742, 749, 743, 746, 744, 745,
+    -527, -528, -529, -10, 747, 748, -530, -3, -531, -532, -11, 750, 751, 752, -533, -534,
+    -535, -536, 754, 758, 755, 757, 756, -21, -68, -183, -64, -18, 759, 762, 760, 761,
+    -537, -538, -149, -539, 763, -542, -540, -541, 765, 777, 766, 772, 767, 769, 768, -77,
+    -543, -544, 770, 771, -545, -546, -33, -34, 773, 774, -84, -37, 775, 776, -250, -88,
+    -35, -38, 778, 784, 779, 782, 780, 781, -547, -548, -549, -550, 783, -129, -551, -552,
+    785, 788, 786, 787, -93, -553, -554, -555, 789, 790, -556, -557, -558, -559, 792, 810,
+    793, 800, -103, 794, 795, 798, 796, 797, -560, -561, -3, -562, -11, 799, -563, -564,
+    801, 804, 802, 803, -17, -18, -21, -183, 805, 807, 806, -149, -565, -566, 808, 809,
+    -567, -568, -243, -75, 811, 824, 812, 817, 813, 815, 814, -77, -569, -570, 816, -277,
+    -571, -572, 818, 821, 819, 820, -573, -574, -575, -123, 822, 823, -35, -37, -576, -127,
+    825, 829, 826, -129, 827, 828, -577, -578, -579, -580, 830, 833, 831, 832, -581, -582,
+    -583, -584, 834, 835, -585, -586, -587, -588, 837, 855, 838, 845, -103, 839, 840, 843,
+    841, 842, -589, -590, -591, -592, -11, 844, -593, -594, 846, 848, 847, -19, -18, -17,
+    849, 852, 850, 851, -595, -113, -596, -3, 853, 854, -597, -598, -243, -75, 856, 868,
+    857, 864, 858, 861, 859, 860, -599, -600, -542, -601, 862, 863, -602, -603, -604, -34,
+    865, 867, 866, -38, -605, -35, -88, -37, 869, 875, 870, 873, 871, 872, -606, -607,
+    -127, -608, -93, 874, -609, -610, 876, 879, 877, 878, -611, -612, -613, -614, 880, 881,
+    -615, -616, -617, -618, 883, 902, 884, 896, 885, 891, 886, 889, 887, 888, -619, -620,
+    -621, -622, -11, 890, -623, -624, 892, 893, -108, -109, 894, 895, -625, -626, -627, -628,
+    897, 898, -18, -21, 899, -539, 900, 901, -629, -630, -631, -632, 903, 912, 904, 911,
+    905, 908, 906, 907, -633, -19, -634, -635, 909, 910, -636, -637, -638, -639, -36, -87,
+    913, 920, 914, 917, 915, 916, -640, -641, -642, -643, 918, 919, -84, -644, -35, -645,
+    921, 924, 922, 923, -646, -647, -648, -649, 925, 926, -650, -651, -652, -653, 928, 951,
+    929, 942, 930, 937, 931, 934, 932, 933, -654, -655, -656, -657, 935, 936, -62, -658,
+    -659, -660, 938, 939, -17, -18, 940, 941, -499, -630, -661, -662, 943, 946, -19, 944,
+    -183, 945, -21, -20, 947, 949, 948, -73, -663, -664, 950, -27, -109, -665, 952, 966,
+    953, 960, 954, 957, 955, 956, -29, -20, -666, -277, 958, 959, -667, -668, -669, -123,
+    961, 964, 962, 963, -35, -670, -33, -38, 965, -37, -126, -88, 967, 973, 968, 971,
+    969, 970, -671, -672, -673, -674, -129, 972, -432, -675, 974, 977, 975, 976, -676, -677,
+    -678, -679, 978, 979, -680, -681, -682, -683, 981, 1002, 982, 996, 983, 990, 984, 987,
+    985, 986, -684, -685, -686, -687, 988, 989, -5, -6, -688, -689, 991, 993, -11, 992,
+    -331, -144, 994, 995, -690, -691, -359, -692, 997, 998, -18, -21, 999, -539, 1000, 1001,
+    -693, -694, -695, -632, 1003, 1016, 1004, 1010, 1005, 1007, 1006, -116, -696, -20, 1008, 1009,
+    -73, -697, -698, -36, 1011, 1014, 1012, 1013, -699, -700, -701, -702, 1015, -37, -34, -33,
+    1017, 1024, 1018, 1021, 1019, 1020, -703, -704, -705, -706, 1022, 1023, -127, -250, -707, -708,
+    1025, 1027, -93, 1026, -709, -710, 1028, 1029, -711, -712, -713, -714, 1031, 1054, 1032, 1040,
+    -103, 1033, 1034, 1037, 1035, 1036, -715, -716, -11, -717, 1038, 1039, -718, -109, -719, -720,
+    1041, 1047, 1042, 1045, 1043, 1044, -18, -17, -64, -19, 1046, -183, -20, -21, 1048, 1051,
+    1049, 1050, -721, -722, -632, -24, 1052, 1053, -723, -724, -725, -542, 1055, 1064, 1056, 1062,
+    1057, 1059, 1058, -77, -726, -727, 1060, 1061, -728, -729, -730, -731, 1063, -85, -87, -36,
+    1065, 1071, 1066, 1069, 1067, 1068, -732, -733, -734, -735, -127, 1070, -736, -129, 1072, 1075,
+    1073, 1074, -737, -738, -45, -739, 1076, 1077, -740, -741, -742, -743, 1079, 1101, 1080, 1095,
+    1081, 1088, 1082, 1085, 1083, 1084, -744, -745, -3, -746, 1086, 1087, -330, -747, -748, -87,
+    1089, 1092, 1090, 1091, -749, -750, -141, -11, 1093, 1094, -391, -751, -752, -753, 1096, 1097,
+    -17, -64, 1098, -632, 1099, 1100, -754, -755, -756, -76, 1102, 1115, 1103, 1109, 1104, 1106,
+    1105, -116, -757, -758, 1107, 1108, -759, -760, -761, -762, 1110, 1113, 1111, 1112, -77, -763,
+    -764, -765, 1114, -250, -766, -38, 1116, 1120, 1117, -129, 1118, 1119, -767, -768, -127, -769,
+    1121, 1124, 1122, 1123, -770, -45, -771, -772, 1125, 1126, -773, -774, -775, -776, 1128, 1153,
+    1129, 1141, 1130, 1136, 1131, 1134, 1132, 1133, -777, -778, -748, -779, -11, 1135, -780, -781,
+    1137, 1139, 1138, -18, -62, -108, -109, 1140, -782, -783, 1142, 1147, 1143, 1145, -68, 1144,
+    -21, -20, -17, 1146, -64, -19, 1148, 1151, 1149, 1150, -784, -785, -786, -787, -632, 1152,
+    -27, -3, 1154, 1165, 1155, 1162, 1156, 1159, 1157, 1158, -788, -789, -790, -791, 1160, 1161,
+    -792, -793, -794, -33, 1163, 1164, -87, -35, -85, -37, 1166, 1173, 1167, 1170, 1168, 1169,
+    -795, -796, -797, -798, 1171, 1172, -799, -88, -800, -801, 1174, 1176, 1175, -45, -93, -802,
+    1177, 1178, -803, -804, -805, -806, 1180, 1206, 1181, 1195, 1182, 1189, 1183, 1186, 1184, 1185,
+    -807, -808, -809, -810, 1187, 1188, -811, -812, -813, -6, 1190, 1192, 1191, -11, -814, -815,
+    1193, 1194, -816, -817, -818, -819, 1196, 1199, 1197, -183, -17, 1198, -19, -64, 1200, 1203,
+    1201, 1202, -820, -821, -632, -3, 1204, 1205, -822, -155, -823, -27, 1207, 1217, 1208, 1214,
+    1209, 1211, 1210, -77, -824, -825, 1212, 1213, -826, -827, -828, -829, 1215, 1216, -36, -87,
+    -33, -38, 1218, 1224, 1219, 1222, 1220, 1221, -830, -123, -831, -832, -374, 1223, -833, -834,
+    1225, 1227, -93, 1226, -835, -836, 1228, 1229, -837, -838, -839, -840, 1231, 1249, 1232, 1240,
+    -103, 1233, 1234, 1237, 1235, 1236, -841, -842, -843, -844, 1238, 1239, -18, -64, -845, -846,
+    1241, 1244, 1242, -19, -68, 1243, -20, -21, 1245, 1248, 1246, 1247, -847, -848, -849, -850,
+    -73, -74, 1250, 1261, 1251, 1257, 1252, 1254, 1253, -76, -851, -277, 1255, 1256, -852, -853,
+    -33, -34, 1258, 1260, 1259, -37, -36, -311, -374, -250, 1262, 1268, 1263, 1266, 1264, 1265,
+    -854, -855, -856, -857, 1267, -129, -858, -859, 1269, 1271, -93, 1270, -860, -861, 1272, 1273,
+    -862, -863, -864, -865, 1275, 1304, 1276, 1291, 1277, 1284, 1278, 1281, 1279, 1280, -866, -867,
+    -868, -869, 1282, 1283, -328, -870, -871, -84, 1285, 1288, 1286, 1287, -872, -873, -141, -11,
+    1289, 1290, -874, -875, -62, -876, 1292, 1297, 1293, 1295, -68, 1294, -21, -20, -17, 1296,
+    -64, -19, 1298, 1301, 1299, 1300, -877, -3, -67, -394, 1302, 1303, -878, -27, -73, -74,
+    1305, 1317, 1306, 1313, 1307, 1310, 1308, 1309, -879, -880, -601, -542, 1311, 1312, -881, -882,
+    -33, -34, 1314, 1316, 1315, -38, -883, -37, -88, -84, 1318, 1322, 1319, -129, 1320, 1321,
+    -884, -885, -886, -887, 1323, 1326, 1324, 1325, -888, -889, -890, -891, 1327, 1328, -892, -893,
+    -894, -895, 1330, 1350, 1331, 1339, -103, 1332, 1333, 1336, 1334, 1335, -896, -897, -898, -899,
+    1337, 1338, -900, -238, -901, -902, 1340, 1344, 1341, 1343, 1342, -21, -68, -183, -64, -19,
+    1345, 1348, 1346, 1347, -903, -904, -632, -27, 1349, -907, -905, -906, 1351, 1361, 1352, 1358,
+    1353, 1355, 1354, -76, -908, -909, 1356, 1357, -910, -911, -912, -913, 1359, -38, -87, 1360,
+    -37, -85, 1362, 1369, 1363, 1366, 1364, 1365, -914, -915, -916, -917, 1367, 1368, -127, -34,
+    -918, -129, 1370, 1372, -93, 1371, -919, -920, 1373, 1374, -921, -922, -923, -924, 1376, 1398,
+    1377, 1385, -103, 1378, 1379, 1382, 1380, 1381, -925, -926, -927, -928, 1383, 1384, -62, -108,
+    -109, -929, 1386, 1391, 1387, 1389, 1388, -64, -18, -17, -20, 1390, -68, -183, 1392, 1395,
+    1393, 1394, -930, -206, -931, -932, 1396, 1397, -933, -934, -27, -277, 1399, 1411, 1400, 1407,
+    1401, 1404, 1402, 1403, -935, -77, -936, -937, 1405, 1406, -938, -939, -34, -33, 1408, -38,
+    1409, 1410, -940, -36, -37, -85, 1412, 1419, 1413, 1416, 1414, 1415, -941, -942, -943, -944,
+    1417, 1418, -250, -127, -129, -945, 1420, 1422, -93, 1421, -946, -45, 1423, 1424, -947, -948,
+    -949, -950, 1426, 1448, 1427, 1440, 1428, 1434, 1429, 1432, 1430, 1431, -951, -952, -621, -953,
+    -11, 1433, -954, -955, 1435, 1437, -62, 1436, -658, -109, 1438, 1439, -956, -957, -958, -959,
+    1441, 1444, -21, 1442, 1443, -64, -17, -18, 1445, -539, 1446, 1447, -960, -961, -632, -962,
+    1449, 1461, 1450, 1457, 1451, 1454, 1452, 1453, -963, -964, -965, -483, 1455, 1456, -966, -84,
+    -967, -968, 1458, -38, 1459, 1460, -87, -35, -85, -37, 1462, 1468, 1463, 1466, 1464, 1465,
+    -969, -970, -971, -972, -250, 1467, -129, -973, 1469, 1471, 1470, -45, -974, -975, 1472, 1473,
+    -976, -977, -978, -979, 1475, 1496, 1476, 1484, -103, 1477, 1478, 1481, 1479, 1480, -980, -981,
+    -982, -983, 1482, 1483, -62, -108, -984, -985, 1485, 1490, 1486, 1488, 1487, -64, -18, -17,
+    1489, -21, -68, -183, 1491, 1494, 1492, 1493, -986, -987, -988, -989, 1495, -74, -990, -991,
+    1497, 1510, 1498, 1504, 1499, 1501, 1500, -76, -992, -993, 1502, 1503, -994, -84, -995, -996,
+    1505, 1508, 1506, 1507, -997, -277, -38, -77, 1509, -84, -998, -88, 1511, 1515, 1512, -129,
+    1513, 1514, -999, -1000, -1001, -1002, 1516, 1519, 1517, 1518, -93, -45, -1003, -1004, 1520, 1521,
+    -1005, -1006, -1007, -1008, 1523, 1546, 1524, 1537, 1525, 1532, 1526, 1529, 1527, 1528, -1009, -1010,
+    -1011, -1012, 1530, 1531, -331, -11, -1013, -1014, 1533, 1534, -109, -108, 1535, 1536, -1015, -1016,
+    -632, -1017, 1538, 1540, -68, 1539, -21, -20, 1541, 1544, 1542, 1543, -1018, -1019, -1020, -1021,
+    1545, -75, -73, -74, 1547, 1560, 1548, 1554, 1549, 1551, -72, 1550, -1022, -1023, 1552, 1553,
+    -1024, -1025, -1026, -1027, 1555, 1558, 1556, 1557, -1028, -1029, -1030, -38, 1559, -88, -34, -250,
+    1561, 1568, 1562, 1565, 1563, 1564, -1031, -1032, -1033, -432, 1566, 1567, -1034, -1035, -1036, -1037,
+    1569, 1572, 1570, 1571, -1038, -1039, -1040, -1041, 1573, 1574, -1042, -1043, -1044, -1045, 1576, 1593,
+    1577, 1585, -103, 1578, 1579, 1582, 1580, 1581, -1046, -1047, -1048, -1049, 1583, 1584, -1050, -63,
+    -1051, -67, 1586, 1588, 1587, -19, -68, -20, 1589, 1591, 1590, -27, -394, -1052, 1592, -397,
+    -1053, -339, 1594, 1606, 1595, 1601, 1596, 1599, 1597, 1598, -1054, -1055, -1056, -1057, 1600, -34,
+    -1058, -1059, 1602, 1604, -36, 1603, -35, -87, -38, 1605, -374, -250, 1607, 1613, 1608, 1611,
+    1609, 1610, -1060, -1061, -1062, -1063, -93, 1612, -1064, -1065, 1614, 1617, 1615, 1616, -1066, -1067,
+    -1068, -1069, 1618, 1619, -1070, -1071, -1072, -1073, 1621, 1636, -103, 1622, 1623, 1630, 1624, 1627,
+    1625, 1626, -1074, -1075, -3, -1076, 1628, 1629, -1077, -1078, -1079, -1080, 1631, 1634, 1632, 1633,
+    -144, -108, -17, -18, 1635, -67, -109, -1081, 1637, 1648, 1638, 1642, 1639, 1641, 1640, -29,
+    -183, -1082, -19, -432, 1643, 1646, 1644, 1645, -1083, -394, -1084, -1085, 1647, -36, -1086, -1087,
+    1649, 1656, 1650, 1653, 1651, 1652, -1088, -1089, -1090, -34, 1654, 1655, -513, -85, -1091, -1092,
+    1657, 1660, 1658, 1659, -1093, -1094, -93, -1095, 1661, 1662, -1096, -1097, -1098, -1099, 1664, 1687,
+    1665, 1679, 1666, 1673, 1667, 1670, 1668, 1669, -1100, -1101, -1102, -1103, 1671, 1672, -1104, -141,
+    -1105, -1106, 1674, 1676, 1675, -64, -1107, -62, 1677, 1678, -1108, -1109, -1110, -1111, 1680, 1682,
+    -19, 1681, -21, -68, 1683, 1685, 1684, -394, -363, -539, -73, 1686, -74, -1112, 1688, 1700,
+    1689, 1695, 1690, 1692, -20, 1691, -1113, -277, 1693, 1694, -1114, -1115, -1116, -483, 1696, 1699,
+    1697, 1698, -1117, -1118, -1119, -216, -33, -35, 1701, 1708, 1702, 1705, 1703, 1704, -1120, -1121,
+    -1122, -1123, 1706, 1707, -127, -250, -1124, -129, 1709, 1712, 1710, 1711, -1125, -1126, -1127, -260,
+    1713, 1714, -1128, -1129, -1130, -1131, 1716, 1737, 1717, 1725, -103, 1718, 1719, 1722, 1720, 1721,
+    -1132, -1133, -11, -1134, 1723, 1724, -1135, -18, -109, -1136, 1726, 1731, 1727, 1730, 1728, 1729,
+    -183, -68, -21, -20, -17, -64, 1732, 1735, 1733, 1734, -1137, -1138, -1139, -1140, 1736, -75,
+    -73, -74, 1738, 1748, 1739, 1745, 1740, 1743, 1741, 1742, -1141, -1142, -1143, -1144, 1744, -512,
+    -1145, -1146, -38, 1746, 1747, -85, -87, -35, 1749, 1756, 1750, 1753, 1751, 1752, -1147, -432,
+    -250, -1148, 1754, 1755, -1149, -1150, -1151, -1152, 1757, 1759, -93, 1758, -1153, -1154, 1760, 1761,
+    -1155, -1156, -1157, -1158, 1763, 1788, 1764, 1776, 1765, 1771, 1766, 1769, 1767, 1768, -1159, -1160,
+    -1161, -1162, -11, 1770, -1163, -1164, 1772, 1773, -108, -62, 1774, 1775, -1165, -1166, -1167, -1168,
+    1777, 1782, 1778, 1780, 1779, -19, -1169, -17, -183, 1781, -21, -20, 1783, 1786, 1784, 1785,
+    -1170, -1171, -1172, -394, 1787, -27, -1173, -26, 1789, 1800, 1790, 1797, 1791, 1794, 1792, 1793,
+    -1174, -1175, -1176, -1177, 1795, 1796, -1178, -1179, -34, -33, 1798, -250, 1799, -38, -37, -372,
+    1801, 1807, 1802, 1805, 1803, 1804, -1180, -1181, -1182, -1183, -127, 1806, -129, -1184, 1808, 1811,
+    1809, 1810, -1185, -1186, -1187, -1188, 1812, 1813, -1189, -1190, -1191, -1192, 1815, 1831, -103, 1816,
+    1817, 1824, 1818, 1821, 1819, 1820, -1193, -1194, -1195, -1196, 1822, 1823, -1197, -141, -1198, -1199,
+    1825, 1828, 1826, 1827, -1200, -62, -18, -64, 1829, 1830, -1201, -1202, -1203, -1204, 1832, 1843,
+    1833, 1837, 1834, 1836, 1835, -20, -68, -183, -432, -479, 1838, 1841, 1839, 1840, -1205, -1206,
+    -77, -1207, 1842, -36, -1208, -1209, 1844, 1851, 1845, 1848, 1846, 1847, -1210, -1211, -1212, -1213,
+    1849, 1850, -330, -37, -1214, -88, 1852, 1855, 1853, 1854, -1215, -1216, -93, -1217, 1856, 1857,
+    -1218, -1219, -1220, -1221, 1859, 1877, 1860, 1868, -103, 1861, 1862, 1865, 1863, 1864, -1222, -1223,
+    -1224, -1225, 1866, 1867, -1226, -63, -1227, -67, 1869, 1871, 1870, -20, -183, -68, 1872, 1875,
+    1873, 1874, -1228, -1229, -1230, -75, 1876, -72, -154, -1231, 1878, 1887, 1879, 1885, 1880, 1882,
+    1881, -76, -1232, -1233, 1883, 1884, -1234, -1235, -1236, -216, -35, 1886, -38, -33, 1888, 1895,
+    1889, 1892, 1890, 1891, -1237, -1238, -1239, -250, 1893, 1894, -1240, -1241, -1242, -1243, 1896, 1899,
+    1897, 1898, -1244, -1245, -1246, -1247, 1900, 1901, -1248, -1249, -1250, -1251, 1903, 1923, 1904, 1912,
+    -103, 1905, 1906, 1909, 1907, 1908, -1252, -1253, -1254, -1255, 1910, 1911, -10, -238, -1256, -1257,
+    1913, 1917, 1914, 1916, 1915, -17, -64, -18, -20, -68, 1918, 1921, 1919, 1920, -1258, -1259,
+    -1260, -27, 1922, -397, -1261, -339, 1924, 1937, 1925, 1932, 1926, 1929, 1927, 1928, -29, -1262,
+    -1263, -1264, 1930, 1931, -1265, -1266, -1267, -123, 1933, 1935, -38, 1934, -1268, -36, -37, 1936,
+    -88, -250, 1938, 1944, 1939, 1942, 1940, 1941, -1269, -1270, -1271, -1272, -127, 1943, -1273, -1274,
+    1945, 1947, 1946, -45, -93, -1275, 1948, 1949, -1276, -1277, -1278, -1279, 1951, 1966, -103, 1952,
+    1953, 1960, 1954, 1957, 1955, 1956, -1280, -1281, -1282, -1283, 1958, 1959, -109, -1284, -1285, -1286,
+    1961, 1963, 1962, -21, -64, -18, 1964, 1965, -1287, -1288, -149, -539, 1967, 1978, 1968, 1973,
+    1969, 1971, 1970, -20, -183, -29, 1972, -19, -479, -432, 1974, 1977, 1975, 1976, -1289, -1290,
+    -1291, -1292, -277, -36, 1979, 1985, 1980, 1983, 1981, 1982, -1293, -76, -1294, -1295, 1984, -33,
+    -37, -940, 1986, 1989, 1987, 1988, -1296, -1297, -1298, -1299, 1990, 1991, -1300, -1301, -1302, -1303,
+    1993, 2012, 1994, 2002, -103, 1995, 1996, 1999, 1997, 1998, -1304, -1305, -1306, -1307, 2000, 2001,
+    -1308, -62, -1309, -1310, 2003, 2005, 2004, -21, -183, -68, 2006, 2009, 2007, 2008, -1311, -394,
+    -1312, -1313, 2010, 2011, -1314, -73, -1315, -1316, 2013, 2026, 2014, 2021, 2015, 2018, 2016, 2017,
+    -1317, -1318, -20, -1319, 2019, 2020, -1320, -1321, -1322, -1323, 2022, 2025, 2023, 2024, -38, -33,
+    -1324, -85, -250, -88, 2027, 2031, 2028, -129, 2029, 2030, -1325, -1326, -1327, -1328, 2032, 2035,
+    2033, 2034, -1329, -1330, -1331, -1332, 2036, 2037, -1333, -1334, -1335, -1336, 2039, 2056, 2040, 2048,
+    -103, 2041, 2042, 2045, 2043, 2044, -1337, -1338, -1339, -1340, 2046, 2047, -1341, -17, -1342, -1343,
+    -20, 2049, 2050, 2053, 2051, 2052, -539, -206, -394, -109, 2054, 2055, -73, -1344, -1345, -27,
+    2057, 2070, 2058, 2065, 2059, 2062, 2060, 2061, -1346, -1347, -1348, -1349, 2063, 2064, -1350, -1351,
+    -1352, -34, 2066, 2068, 2067, -85, -1353, -36, -88, 2069, -127, -37, 2071, 2075, 2072, -129,
+    2073, 2074, -1354, -1355, -1356, -1357, 2076, 2079, 2077, 2078, -1358, -1359, -1360, -1361, 2080, 2081,
+    -1362, -1363, -1364, -1365, 2083, 2101, 2084, 2092, -103, 2085, 2086, 2089, 2087, 2088, -1366, -1367,
+    -1368, -1369, 2090, 2091, -17, -64, -1370, -1171, 2093, 2095, 2094, -19, -21, -183, 2096, 2099,
+    2097, 2098, -1371, -1372, -1373, -27, 2100, -75, -73, -74, 2102, 2116, 2103, 2110, 2104, 2107,
+    2105, 2106, -1374, -77, -1375, -1376, 2108, 2109, -1377, -1378, -1379, -123, 2111, 2114, 2112, 2113,
+    -87, -35, -37, -85, 2115, -84, -1380, -88, 2117, 2123, 2118, 2121, 2119, 2120, -1381, -1382,
+    -1383, -1384, -127, 2122, -1385, -1386, 2124, 2126, -93, 2125, -1387, -45, 2127, 2128, -1388, -1389,
+    -1390, -1391, 2130, 2147, 2131, 2139, -103, 2132, 2133, 2136, 2134, 2135, -1392, -1393, -1394, -1395,
+    2137, 2138, -144, -17, -1396, -1397, 2140, 2142, 2141, -19, -68, -183, 2143, 2145, 2144, -394,
+    -539, -206, 2146, -397, -1398, -1399, 2148, 2160, 2149, 2156, 2150, 2153, 2151, 2152, -1400, -1401,
+    -1402, -1403, 2154, 2155, -1404, -1405, -34, -33, 2157, -38, 2158, 2159, -35, -87, -85, -37,
+    2161, 2167, 2162, 2165, 2163, 2164, -1406, -1407, -1408, -1409, -127, 2166, -129, -1410, 2168, 2171,
+    2169, 2170, -1411, -1412, -1413, -1414, 2172, 2173, -1415, -1416, -1417, -1418, 2175, 2197, 2176, 2188,
+    2177, 2184, 2178, 2181, 2179, 2180, -1419, -1420, -1421, -1422, 2182, 2183, -331, -238, -1423, -1424,
+    2185, 2186, -64, -17, -630, 2187, -632, -1425, 2189, 2191, -19, 2190, -21, -20, 2192, 2195,
+    2193, 2194, -206, -207, -109, -273, 2196, -277, -1426, -339, 2198, 2208, 2199, 2205, 2200, 2203,
+    2201, 2202, -1427, -1428, -1429, -1430, 2204, -35, -1431, -1432, 2206, -37, -85, 2207, -84, -36,
+    2209, 2215, 2210, 2213, 2211, 2212, -1433, -1434, -1435, -1436, -127, 2214, -1437, -1438, 2216, 2218,
+    -93, 2217, -1439, -1440, 2219, 2220, -1441, -1442, -1443, -1444, 2222, 2235, -103, 2223, 2224, 2231,
+    2225, 2228, 2226, 2227, -1445, -1446, -1447, -1448, 2229, 2230, -1449, -1284, -1450, -1451, 2232, 2233,
+    -64, -17, 2234, -67, -1452, -501, 2236, 2245, 2237, 2244, 2238, 2241, 2239, 2240, -1453, -21,
+    -1454, -1455, 2242, 2243, -74, -27, -1456, -1457, -36, -87, 2246, 2252, 2247, 2250, 2248, 2249,
+    -1458, -1459, -33, -34, 2251, -250, -1460, -37, 2253, 2256, 2254, 2255, -1461, -1462, -1463, -1464,
+    2257, 2258, -1465, -1466, -1467, -1468, 2260, 2279, 2261, 2269, -103, 2262, 2263, 2266, 2264, 2265,
+    -1469, -1470, -1471, -1472, 2267, 2268, -144, -62, -109, -1473, 2270, 2273, 2271, 2272, -64, -17,
+    -183, -21, 2274, 2277, 2275, 2276, -1474, -724, -632, -1475, 2278, -907, -154, -155, 2280, 2292,
+    2281, 2287, 2282, 2284, 2283, -277, -1476, -1477, 2285, 2286, -1478, -1479, -1480, -1481, 2288, 2290,
+    2289, -38, -1482, -644, 2291, -88, -1483, -33, 2293, 2299, 2294, 2297, 2295, 2296, -1484, -1485,
+    -1486, -1487, -93, 2298, -1488, -1489, 2300, 2303, 2301, 2302, -1490, -1491, -1492, -1493, 2304, 2305,
+    -1494, -1495, -1496, -1497, 2307, 2320, -103, 2308, 2309, 2315, 2310, 2313, 2311, 2312, -1498, -1499,
+    -1500, -1501, -11, 2314, -780, -1502, 2316, 2317, -18, -64, 2318, 2319, -499, -1503, -3, -24,
+    2321, 2334, 2322, 2328, 2323, 2326, 2324, 2325, -1504, -1505, -1506, -1507, -1508, 2327, -1509, -1510,
+    2329, 2332, 2330, 2331, -1511, -1512, -1513, -542, 2333, -37, -36, -1514, 2335, 2342, 2336, 2339,
+    2337, 2338, -1515, -123, -1516, -1517, 2340, 2341, -1518, -38, -1519, -88, 2343, 2345, 2344, -129,
+    -1520, -1521, 2346, 2347, -1522, -1523, -1524, -1525,
+};
+
+#endif
+
+#if EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_TABLE) || EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_BINNED)
+
+static const double voltage_leaf_value[1525] = {
+    1256.7373293768533, 1258.7764655172425, 1289.68, 1262.2384905660388,
+    1308.0, 1297.315, 1289.6825000000001, 1279.6119999999999,
+    1257.63, 1265.2649999999999, 4548.23, 2450.548,
+    1273.2333043478272, 1302.3911224489793, 1732.2949999999998, 1338.4759375000003,
+    3220.39, 3421.86, 3922.47, 4681.01,
+    4629.12, 1600.6550000000002, 1470.7983333333334, 1285.1,
+    2344.0045833333334, 3174.0933333333337, 1265.26, 3161.741428571429,
+    5183.15, 4046.2204166666666, 4569.676802325581, 4745.8473,
+    3147.13, 3826.31, 1303.42, 1349.21,
+    1613.25, 2312.27, 5144.1050000000005, 4910.816826923076,
+    4400.565, 4777.319, 5015.3722857142875, 5100.864214285711,
+    4618.44, 5258.443333333334, 5195.32590909091, 5229.665238095238,
+    5264.551111111111, 5299.143333333333, 5359.195172413793, 5429.2575,
+    5400.643333333333, 1256.5224120603018, 1257.4305988023964, 1259.6371532846715,
+    1262.4964062500003, 1504.501875, 1275.1901984126994, 1314.8298809523806,
+    1932.2366666666667, 2466.42, 3321.125, 3644.69,
+    1412.546428571429, 1311.658, 1891.03, 5170.94,
+    2388.582, 1633.6625, 3027.065, 2558.0,
+    3821.73, 3444.75, 2255.8, 1491.15,
+    1393.47, 3466.1184210526317, 4393.384181818183, 4628.392810457514,
+    4399.192, 4780.162962962962, 4870.897936507936, 1286.63,
+    1465.2, 2917.886, 1280.53, 4948.11,
+    4990.294444444446, 4857.782727272728, 4600.12, 4494.81,
+    4496.34, 5104.900328947371, 5179.8890909090915, 5083.5625,
+    5206.436285714286, 5237.892399999998, 5330.69, 5298.4914285714285,
+    5365.894666666666, 5410.5633333333335, 5024.42, 1258.4505584642238,
+    1288.921, 2907.51, 1296.4139751552805, 2052.81,
+    1704.82, 1370.2100000000003, 1514.8025, 1407.01125,
+    1823.1100000000001, 1513.0266666666666, 4884.77, 4049.15,
+    3271.966250000001, 2216.1150000000002, 4206.0445, 4557.141813471502,
+    4731.717012987015, 4876.624246575341, 4183.46, 5114.775333333333,
+    4985.06101010101, 3553.6233333333334, 2991.45, 4710.359090909092,
+    3992.67, 5106.709915966388, 5177.212, 5223.661355932204,
+    5289.3772, 5337.8116666666665, 5381.3725, 5405.011363636363,
+    1256.9700261780104, 1258.9846835443047, 1261.460740740741, 1651.7849999999999,
+    4674.91, 843.5066666666667, 1288.1479204892967, 1927.66,
+    1463.5363636363636, 1691.85, 1413.8183333333334, 1312.268,
+    2040.6, 1630.8, 2442.0, 2168.8050000000003,
+    2683.15, 2800.67, 2916.67, 3221.92,
+    3373.02, 3998.34380952381, 4565.754620689654, 4731.792364864865,
+    5219.78, 5108.976000000001, 4870.315538461539, 4993.982884615383,
+    4743.382272727273, 5157.673333333333, 5095.424456521737, 5204.918625,
+    5239.889803921567, 5297.2375, 5376.203777777778, 1257.3598689956334,
+    1261.5939495798314, 1294.0933333333332, 1271.2592857142856, 1513.635333333333,
+    1281.3934650455935, 1464.8360000000002, 1660.3066666666666, 1990.743333333333,
+    1463.2949999999998, 1330.38, 4952.69, 2205.6237499999997,
+    3250.289411764705, 3823.263333333334, 4025.4900000000002, 3396.67,
+    4185.796666666667, 4442.794, 4615.197660818713, 4832.288347107437,
+    3806.2166666666667, 5005.439, 4770.6647826086955, 5106.009448818896,
+    5178.902826086955, 5246.646410256409, 5338.826666666667, 5395.9,
+    1259.4202080000007, 1235.0268918918916, 2470.748333333333, 1292.895730337079,
+    1521.367, 2315.32, 2562.58, 3183.2533333333336,
+    1571.785, 2177.5271428571427, 3518.9836363636364, 4086.4704545454547,
+    4592.990967741935, 3906.6949999999997, 4796.139166666664, 4004.885,
+    5075.397999999999, 4945.957346938777, 5049.429142857143, 5122.143333333334,
+    4665.241666666666, 4923.6849999999995, 4663.21, 4936.885882352941,
+    5228.327, 5126.087014925374, 5187.858857142858, 5229.239242424243,
+    5268.745833333333, 5309.321333333334, 5375.458125, 5408.577,
+    1257.3765145228206, 1263.1875000000002, 1304.336, 1289.6825000000003,
+    1637.9730000000002, 4611.57, 1281.5686024844733, 1495.0836842105266,
+    1488.398, 1668.005, 3696.0699999999997, 2247.2292307692305,
+    4317.509999999999, 3096.984285714286, 3853.3370588235293, 4596.038819188189,
+    4885.206499999999, 3417.28, 5119.189090909091, 4962.104605263156,
+    5070.781000000001, 5118.442857142855, 4673.38125, 4919.491666666667,
+    5160.577236842104, 5073.259333333333, 5222.885689655172, 5120.57,
+    5257.5575, 5299.8629411764705, 5350.482727272727, 5393.555714285714,
+    1258.2884793388425, 1290.4466666666667, 2270.2988888888885, 1302.3427914110432,
+    1423.0746666666669, 2360.5, 2846.766, 1606.1266666666668,
+    2081.81, 4881.866, 4099.003333333333, 3454.3843750000005,
+    1944.44, 3089.135, 4511.487247706421, 4926.570740740741,
+    4689.799558011047, 4889.200192307692, 5030.120408163265, 4754.655,
+    4888.58375, 5120.325581395347, 5175.2136, 5222.356125,
+    5269.978888888889, 5310.339166666668, 5363.338235294118, 5408.317647058823,
+    1257.2904845814971, 1262.2096330275238, 1304.565, 1283.325,
+    1797.4885714285713, 1274.1061904761912, 1315.8281159420287, 1390.601212121212,
+    2370.7766666666666, 1864.9122222222222, 3538.995, 3112.7883333333334,
+    3726.3433333333337, 4054.8062499999996, 4564.043734939759, 4050.452142857143,
+    4713.475897435896, 4862.418095238095, 1288.16, 3373.523333333333,
+    4919.797741935485, 4547.465, 5073.779350000001, 5212.427272727273,
+    5140.306428571428, 5221.251097560977, 5260.926666666666, 5306.5216666666665,
+    5340.481666666667, 5371.023333333334, 5400.642, 1256.3896932515336,
+    1257.3882474226814, 1259.4694890510948, 1262.577407407407, 1306.47,
+    1275.2353333333333, 1295.79, 1266.79, 1679.3844444444444,
+    1283.1566366366362, 1405.2800000000002, 1725.58, 2522.3866666666668,
+    1517.0942857142857, 2881.1825000000003, 3854.55, 3198.3466666666664,
+    4475.19292929293, 4797.448943661971, 3897.7400000000002, 1489.318,
+    3097.9075, 4964.917464788733, 4632.784000000001, 5088.918109452736,
+    5221.508666666667, 5161.7065, 5225.122325581396, 5261.6765,
+    5340.052, 5303.5337500000005, 5367.023684210528, 5414.487142857142,
+    1258.3421441441449, 1284.2108408408424, 1820.8166666666666, 1357.9948484848485,
+    1697.1916666666668, 1417.9964285714286, 2040.5999999999997, 2378.66,
+    1796.4, 2712.53, 2973.442, 4037.644642857143,
+    4451.961000000001, 4640.507368421052, 4867.634945054944, 1293.346,
+    1514.55, 2991.4499999999994, 4929.2925000000005, 5019.31043478261,
+    4806.928333333333, 5072.224150943399, 5135.778734177215, 4844.76,
+    5036.77, 5192.18262295082, 5069.19, 5230.0419999999995,
+    5265.236086956522, 5310.898, 5346.154, 5377.746000000001,
+    5400.968571428572, 1258.3786837606833, 1157.2783333333334, 1293.47131097561,
+    1390.878787878788, 1556.78, 2666.778181818182, 3373.5266666666666,
+    1944.4399999999998, 4466.88, 3737.6873333333338, 4574.264589371981,
+    4785.820094339622, 1285.3616666666667, 4938.690638297874, 4349.0525,
+    5079.81699507389, 5239.813125000001, 5206.513974358975, 5219.0175,
+    5266.89, 5314.408888888888, 5347.5485714285705, 5371.8966666666665,
+    5406.898, 1257.3947098214273, 1262.209607843138, 1293.870320855615,
+    2193.2239999999997, 1371.72, 1567.3333333333333, 2248.165,
+    2139.806666666667, 2653.0075, 3011.2925, 2211.03,
+    4780.724999999999, 3853.6636, 4548.444070351757, 4734.95341772152,
+    1294.264, 4873.687499999999, 5031.205445544553, 4311.66,
+    4861.112, 5095.9497560975615, 5171.3062666666665, 5228.938769230768,
+    5272.590000000001, 5314.332, 5382.071666666668, 1256.9490760869558,
+    1260.780809248554, 1750.6760869565219, 1290.6765642458106, 1699.8625,
+    1429.5888888888887, 1845.6545454545455, 2382.648888888889, 4644.19125,
+    3716.026956521739, 4565.649066666665, 4786.901277777777, 3248.032222222222,
+    5182.278571428571, 4987.241403508772, 4775.423571428572, 5114.7275735294115,
+    5017.510526315789, 5206.044250000001, 5093.712, 5227.6955714285705,
+    5281.047142857143, 5297.28, 5348.875, 5375.217368421052,
+    5409.623846153846, 1256.9179945799444, 1264.2483333333332, 1259.7981249999998,
+    1262.6592156862744, 1285.716, 4632.683333333333, 1648.2827272727272,
+    1281.986069364162, 1477.9654545454543, 1338.52, 1987.6899999999998,
+    5010.305, 4690.167142857143, 4123.93, 2486.7000000000003,
+    3835.823076923077, 4323.283846153847, 4403.24, 4564.4544966442945,
+    4769.211084337352, 5019.268854166668, 5106.131052631577, 4893.439090909091,
+    5172.118607594936, 5225.412676056337, 5286.859, 5381.2868181818185,
+    1256.9009919571035, 1260.7353932584265, 1274.2411764705882, 1297.314285714286,
+    1630.5441666666666, 1297.8368700265253, 1533.88, 1399.57,
+    1628.51, 1782.3580000000002, 2656.6958333333337, 3394.6399999999994,
+    4220.26231884058, 4589.19169117647, 4540.6, 5015.263333333333,
+    4714.8816853932585, 5134.6925, 4862.459666666667, 3147.1299999999997,
+    1289.3025, 4956.488852459014, 5041.541304347826, 4773.0975,
+    5130.055959595958, 5035.976428571428, 5196.203157894737, 5222.664074074074,
+    5251.835, 5272.739, 5300.394545454546, 5334.25,
+    5361.722, 5393.86875, 1256.5261904761896, 1257.2068707483006,
+    1258.677027027028, 1268.32, 1260.585873015873, 1262.8394117647058,
+    1283.9608333333333, 2058.4033333333336, 1276.8193015873017, 1382.524680851064,
+    1452.035, 1690.1719999999998, 2181.01, 2820.6351999999997,
+    1774.645, 3710.32, 4340.222142857143, 3852.4799999999996,
+    4583.760236966826, 4781.34588785047, 5240.636666666666, 4903.302602739726,
+    5016.684252873563, 5099.486363636363, 4620.980833333333, 4846.527777777778,
+    5109.647787610617, 5188.854035087718, 5221.307192982456, 5269.744736842105,
+    5304.233333333334, 5365.112592592592, 5410.562222222222, 1256.823971014492,
+    1258.7700000000011, 1262.2359482758625, 1966.4239999999998, 1297.6494017094021,
+    1491.452, 1723.905, 2676.027777777778, 1776.8620000000003,
+    3076.9244444444444, 3326.2100000000005, 4474.2025, 4088.8300000000004,
+    4580.654791666667, 3685.8969999999995, 4788.130196078429, 3391.0260000000003,
+    4991.3153999999995, 4764.848571428572, 5117.08216, 4977.775,
+    5183.150000000001, 5098.4425, 5226.262597402597, 5275.869500000001,
+    5376.068000000001, 5334.248333333334, 5407.440000000001, 5369.099999999999,
+    1256.960164383561, 1258.7676744186056, 1267.2285714285713, 1261.534947368421,
+    1524.5219999999997, 1288.1530303030306, 1550.67, 1473.4857142857143,
+    1918.498, 2780.0675, 3645.538888888889, 4256.992272727272,
+    1668.955, 4599.931576086956, 4158.3164705882355, 4764.179117647061,
+    1283.58, 4863.204571428571, 4975.198076923077, 4620.269,
+    5087.773668639057, 4915.587692307693, 5174.722608695652, 5084.556,
+    5218.459807692308, 5258.992307692307, 5305.3462500000005, 5347.177647058824,
+    5373.931428571429, 5403.946666666667, 1256.830497382198, 1258.737653061225,
+    1282.5600000000002, 1261.4177358490572, 1494.3794117647058, 1278.5878885630493,
+    1396.7749999999999, 1452.688, 1352.26, 1300.3675,
+    1549.1433333333334, 1755.19, 1495.3475, 1350.73,
+    4789.682, 2334.401875, 3628.335714285714, 4884.003333333333,
+    1417.8899999999999, 3909.2697058823524, 4474.4073684210525, 4785.017857142857,
+    4600.776024844719, 5081.400000000001, 4810.10375, 1563.8999999999999,
+    3342.66, 5012.564545454545, 4821.663846153847, 5107.924999999999,
+    4936.988571428572, 5159.786730769231, 5222.563382352941, 5293.488823529413,
+    5381.30888888889, 1258.266488413547, 1136.2930000000001, 2941.47,
+    1285.3528220858896, 1990.2350000000001, 1341.45, 1445.364,
+    1439.472857142857, 1306.9766666666667, 2168.42, 2769.9575,
+    2230.1083333333336, 3947.3286842105267, 4596.514545454543, 4205.58625,
+    4770.823039215686, 1284.5966666666666, 4894.281333333332, 5000.654285714286,
+    5003.053033707865, 5081.798125000001, 4806.267333333334, 5135.771075268817,
+    5043.1594444444445, 5255.952, 5209.033437499998, 5283.447142857142,
+    5304.794, 5357.612307692307, 5394.870800000001, 1256.998935064935,
+    1259.9207142857135, 1262.3599999999994, 1267.0077142857142, 1289.03,
+    1280.7816666666665, 1275.3076351351344, 1305.8406666666663, 1340.2744117647057,
+    1501.32, 1755.1899999999998, 1474.8700000000001, 5067.92,
+    2574.69705882353, 3875.2372222222225, 2030.5259999999998, 4418.200972222221,
+    4559.481678832116, 4718.197636363636, 5145.604, 4867.822602739728,
+    5066.771224489796, 4843.81375, 5021.37, 4856.533333333334,
+    5142.157547169813, 5227.0449367088595, 5284.6449999999995, 5331.366666666667,
+    5403.864444444445, 5363.248461538462, 1257.4425635103921, 1261.5259701492544,
+    1292.3189972144853, 2002.75, 1321.2266666666667, 1411.1299999999999,
+    1617.8257142857142, 1498.78, 2100.758333333333, 2850.275,
+    2779.68625, 3769.0347058823527, 4297.821999999999, 4574.619054054052,
+    2913.6150000000002, 4908.169999999999, 4707.0599999999995, 4985.7072727272725,
+    4858.411739130434, 4968.415918367347, 5045.15104477612, 4740.1788235294125,
+    5188.958888888888, 5113.074296874997, 4913.0, 5222.6359999999995,
+    5295.9712, 5376.578, 5409.4175000000005, 1256.793966480446,
+    1259.0507070707076, 1261.9936666666674, 1288.3742857142859, 1279.0,
+    1264.5, 2757.3239999999996, 1281.992320261439, 1486.876,
+    1358.6258536585365, 1423.99, 1443.83, 1466.73,
+    5098.19, 4669.478888888889, 2070.8892307692304, 3520.1459999999997,
+    3105.92, 3474.443636363636, 4211.000476190477, 4650.157869415811,
+    3554.6380000000004, 1339.6675, 4896.49530612245, 5049.21080882353,
+    4863.753076923077, 5136.107777777777, 5181.543157894737, 5225.674615384616,
+    5260.553571428572, 5308.218888888889, 5374.542666666666, 5408.655000000001,
+    1256.8331621621617, 1259.0274285714295, 1261.6409090909094, 1856.1766666666665,
+    1293.4653804347834, 1443.7153846153847, 1338.382727272727, 2175.67,
+    1512.5166666666667, 2610.196, 2172.1116666666667, 1458.5900000000001,
+    4285.71, 3596.8666666666663, 4355.473333333332, 4538.951732283467,
+    4742.7997752809, 3969.1699999999996, 5168.105714285714, 4891.570571428571,
+    5146.825999999999, 5014.509090909092, 3204.365, 4453.908,
+    4779.416842105264, 5109.578106060606, 5191.629682539683, 5240.632253521125,
+    5326.822, 5396.626086956521, 1256.4424479166655, 1257.5470555555564,
+    1259.491197183099, 1262.5688235294117, 1272.5125, 1279.7649999999999,
+    1288.5375000000001, 1264.7566666666667, 2508.4777777777776, 1054.6383333333333,
+    1280.907535714286, 1725.9714285714285, 1366.4155, 1612.8650000000002,
+    1503.97, 2406.135, 1950.5525, 3216.956875,
+    4180.402857142856, 4583.295075376883, 3928.9524999999994, 4825.2474999999995,
+    4717.073582089554, 4879.407999999998, 5124.815, 4983.55188235294,
+    4629.8835714285715, 4843.255, 5106.746600000001, 5182.554878048781,
+    5234.909999999999, 5298.3054999999995, 5371.751785714287, 5405.9818749999995,
+    1258.4359198542809, 1294.044285714286, 3177.657142857143, 1303.4558753709198,
+    1633.3433333333335, 1397.5366666666669, 2330.585, 1652.1675,
+    2934.79125, 2416.8199999999997, 4345.098505747126, 4608.689587628865,
+    4800.660512820513, 4917.900000000001, 5013.440000000001, 5182.597272727274,
+    5095.194516129033, 4767.380588235295, 4923.824545454546, 5132.057380952381,
+    5205.063253968253, 5272.386, 5305.098, 5359.0505,
+    5400.386666666667, 1256.5554807692295, 1257.4977358490582, 1259.7454128440368,
+    1262.6801923076919, 1270.60375, 1300.368, 3130.34,
+    1262.363, 1275.2632780082993, 1328.8668421052632, 1384.2603333333334,
+    1467.1075, 2124.135333333333, 3695.216315789474, 4298.042307692307,
+    4546.584404145077, 4773.068202247192, 1318.6833333333334, 4942.128235294118,
+    4606.662857142857, 5074.9221768707475, 4898.473043478261, 5218.085555555556,
+    5123.315306122449, 5197.093220338983, 5236.830609756096, 5313.83625,
+    5344.041666666667, 5408.715263157896, 5373.579230769231, 1258.2987272727278,
+    3129.58, 721.9157142857144, 1269.650625, 1266.0275,
+    1283.124880546076, 1384.432, 1882.021, 2322.04,
+    2878.0033333333336, 3011.2899999999995, 2275.64, 3701.245277777778,
+    4394.041904761905, 4717.007500000001, 4999.695000000001, 4595.0701550387585,
+    4715.669827586207, 5080.383333333334, 4846.83974025974, 5152.780000000001,
+    5011.414086956523, 4782.829999999999, 5112.9571428571435, 5190.155641025641,
+    5275.032, 5229.849193548386, 5337.1196, 5398.828125,
+    1258.2131475409835, 1291.427142857143, 3495.6266666666666, 1299.1754385964916,
+    1364.13, 1607.6500000000003, 1394.992, 1550.6737500000002,
+    2613.2707142857143, 3282.054, 3797.888125, 4149.623333333334,
+    4425.306923076923, 4529.068674698796, 4742.298928571429, 1291.975,
+    5224.36, 4897.553013698629, 5172.213333333333, 5016.230731707317,
+    4713.320000000001, 5131.671117647056, 5227.946753246752, 5290.523500000001,
+    5362.521904761905, 5407.158461538462, 1256.8088819875766, 1258.8860396039618,
+    1261.5901980198028, 1542.4744444444445, 1277.9971351351357, 1369.5935714285713,
+    1421.9599999999998, 1292.7366666666667, 1323.26, 1460.8400000000001,
+    1580.6899999999998, 1286.016, 4637.306363636364, 3612.45303030303,
+    1562.574, 4574.569727891156, 4867.935294117647, 4709.066630434781,
+    5113.221818181818, 4877.4567938931295, 5161.565714285714, 5015.797375,
+    4695.132500000001, 5180.763076923076, 5100.452183908047, 5220.907619047621,
+    5282.9920833333335, 5338.83, 5383.2796875, 1258.9144293015343,
+    1230.6376119402983, 2360.603333333333, 1288.055087719298, 1381.64,
+    1288.92, 1630.0366666666669, 1940.8866666666665, 1507.634,
+    1306.4685714285715, 1989.2133333333331, 2613.1600000000003, 3746.4909999999995,
+    4473.879795918367, 4622.867686567164, 4717.5321875, 4855.560303030302,
+    4748.17, 3711.0825000000004, 4882.20090909091, 5014.544214876035,
+    4856.083529411764, 4649.345, 5126.7717241379305, 4998.3553846153845,
+    5196.228275862069, 5237.3646478873225, 5317.765, 5387.269565217392,
+    1257.3325053533183, 1262.3817293233087, 1268.392833333333, 1287.8519999999999,
+    1275.4454430379744, 1307.8075000000001, 1367.5228571428572, 1293.5,
+    1472.96, 2276.4025, 2735.0425, 1459.6066666666666,
+    2159.3419999999996, 3793.717857142857, 4358.668000000001, 4595.5813499999995,
+    3710.316363636364, 5036.63, 4752.844128440368, 4339.135,
+    3228.2766666666666, 1336.998, 5125.537499999999, 4924.288636363635,
+    4618.129999999999, 5015.190781249999, 5102.801612903225, 4768.01,
+    4977.0216666666665, 5232.388695652174, 5133.277941176471, 5217.945443037976,
+    5266.678181818182, 5304.995, 5292.871111111111, 5365.462,
+    5405.656428571428, 1257.4105381165903, 1261.9378813559329, 1469.5384210526315,
+    1284.644759036146, 2110.502, 1395.8161538461538, 2227.674285714286,
+    3046.633076923077, 1426.03, 4407.8099999999995, 4532.7788770053485,
+    3679.8721052631577, 4726.32375, 4871.119, 4937.578367346939,
+    5013.943950617286, 4536.933999999999, 4754.27375, 5185.087307692307,
+    5082.2487962963, 5189.96534883721, 5082.416666666667, 5224.060869565218,
+    5262.75, 5333.814285714286, 5301.243750000001, 5371.751428571429,
+    5413.4745454545455, 1256.9032208588953, 1258.967250000001, 1261.5881415929202,
+    1279.255, 1886.4466666666667, 1273.0597297297306, 1315.3599159663868,
+    1384.9033333333332, 4660.254, 2345.0825, 3263.342857142857,
+    2440.2233333333334, 3757.991764705882, 4230.43, 4477.773783783783,
+    4617.830559006209, 4816.268656716417, 3133.3933333333334, 4645.91,
+    5002.378255813954, 4804.946, 5110.533450292395, 5214.838181818181,
+    5278.675294117646, 5305.42, 5378.905925925927, 1256.8535359116013,
+    1258.6924576271201, 1266.792, 1261.5238775510213, 1447.3718181818183,
+    1062.7783333333334, 1284.4197196261684, 1969.3766666666668, 1504.0509090909093,
+    1388.0336000000002, 1336.995, 1290.1899999999998, 2422.0446153846156,
+    3205.5125, 3868.1339999999996, 3558.835, 4136.142500000001,
+    3104.0150000000003, 4524.6726767676755, 4750.219444444445, 5099.484545454546,
+    4913.953469387755, 5079.337476635514, 4874.85, 4841.153076923078,
+    5203.755416666667, 5124.209078947369, 5227.751388888887, 5284.118461538462,
+    5337.302, 5374.898333333333, 5413.486666666667, 1258.4909290540554,
+    1193.357777777778, 1298.2418771331056, 2331.73, 1368.7083333333333,
+    2040.4277777777777, 1484.7562500000001, 2741.91, 3011.29,
+    3123.221666666667, 3615.69, 4205.2585714285715, 3873.63,
+    4352.868867924526, 4626.238482142857, 4891.377033898304, 4649.725,
+    5020.092328767126, 5073.409512195123, 4798.028333333333, 4957.7733333333335,
+    5121.330353982301, 5206.8462711864395, 5274.216666666666, 5312.177692307693,
+    5402.131904761905, 5358.33, 1256.8515838509302, 1258.791680000001,
+    1261.1797752808995, 1263.6758333333337, 1973.75, 1294.1684266666678,
+    1352.0421428571428, 1301.8933333333334, 1454.52, 1390.42,
+    3421.8599999999997, 1547.3120000000001, 1845.75, 1387.3633333333335,
+    2344.5131250000004, 4932.08, 4199.736666666667, 3290.3227272727277,
+    3831.400666666667, 4540.440413793105, 4755.179548872179, 4883.468648648648,
+    4735.96, 5005.704854368932, 4792.620000000001, 4719.873846153846,
+    5103.966559139784, 5172.549636363636, 4940.47375, 5086.580000000001,
+    5222.147640449438, 5284.524210526317, 5360.8676000000005, 5405.983333333333,
+    1257.0099483204133, 1264.5025, 1259.774452054795, 1262.694,
+    1307.2350000000001, 1612.6231818181818, 1283.5830473372782, 1977.72,
+    1419.0766666666668, 1752.136, 1392.7050000000002, 1286.6280000000002,
+    2246.2575, 1826.0080000000003, 3351.7394117647063, 3721.763333333334,
+    4190.105714285714, 4570.4395454545465, 3455.943333333334, 4723.761304347827,
+    4879.9468181818165, 2501.9075000000003, 5001.671825396827, 4708.792666666666,
+    5106.977750000002, 5203.134186046511, 5253.8029166666665, 5317.4625,
+    5389.510344827587, 1258.223233215547, 1279.5072222222223, 2189.5278947368415,
+    1278.2266346153845, 2032.9666666666665, 1398.2331707317073, 2423.5177777777776,
+    1890.857777777778, 3633.24, 3133.3940000000002, 4201.007692307692,
+    4517.29487804878, 4629.973023255813, 4017.9411111111112, 4763.341262135921,
+    5115.302727272728, 4887.013523809524, 4637.1325, 5089.44569767442,
+    4647.4375, 4887.107741935485, 5096.619130434783, 5192.388245614035,
+    5247.635, 5228.0905555555555, 5271.889999999999, 5287.288461538462,
+    5324.3275, 5370.371666666667, 5404.318181818182, 1257.2345720720716,
+    1263.2458955223888, 1299.86, 1281.29, 1286.001206349207,
+    1464.4394444444447, 1633.3433333333332, 1417.31375, 2100.1214285714286,
+    2611.4176923076925, 4529.91, 3666.568333333333, 3946.452857142857,
+    4575.051420765026, 4114.414117647058, 4779.279017857142, 1287.548,
+    5159.240000000001, 4914.2719718309845, 5019.435949367089, 5137.976000000001,
+    4489.469999999999, 4793.156666666667, 5128.2377777777765, 5225.958571428571,
+    5282.051333333334, 5337.6825, 5394.155357142858, 1257.4015800415787,
+    1261.811081081081, 1550.9053846153847, 1279.6787662337665, 2259.615,
+    1314.1872222222223, 1382.5657142857144, 1621.6416666666667, 1435.0155555555557,
+    2576.783076923077, 3523.605, 3574.342727272727, 4284.1900000000005,
+    4413.390769230769, 4572.406594202897, 4715.03076923077, 4908.026666666668,
+    5045.246635514019, 3986.565, 4796.662727272726, 5117.840608695651,
+    5209.362844036697, 5301.282800000002, 5389.70303030303, 1258.8026833333342,
+    1212.4414492753624, 2085.625, 1286.6570344827583, 1871.95,
+    1351.3623529411764, 1431.625, 1489.01, 2782.355714285714,
+    2146.42, 3407.93, 1287.3899999999999, 2598.9533333333334,
+    3260.84, 3823.6772727272723, 4220.595, 2888.4300000000003,
+    4494.374166666666, 4639.167874015748, 4783.96105769231, 1304.9475,
+    4938.988024691358, 4547.211111111112, 5063.822543859649, 4807.885,
+    5162.535584415586, 5066.14, 5223.487714285715, 5255.512941176472,
+    5303.1525, 5342.97, 5381.780952380952, 5420.634,
+    1258.2673157894733, 1291.40125, 2436.9144444444446, 1286.1333227848106,
+    2001.87, 1370.389090909091, 1638.8125, 2718.7625000000003,
+    2222.2225, 4848.39, 4230.158, 3402.9700000000003,
+    3908.3500000000004, 4574.296, 4140.296111111111, 4786.982875816991,
+    1287.7775000000001, 4986.440096153847, 4842.9655555555555, 5100.506446280991,
+    4921.944285714286, 5203.685606060608, 5231.196458333334, 5254.1224999999995,
+    5274.843846153846, 5344.933333333333, 5297.958888888888, 5363.175238095238,
+    5404.7108333333335, 1257.2396645702308, 1261.875523809524, 2565.43875,
+    1305.174921052632, 1474.1385714285716, 2244.7325, 2847.2200000000003,
+    1940.1719999999998, 3408.763684210526, 3913.9199999999996, 4242.137586206897,
+    4969.168, 4574.223416149067, 4773.004000000001, 3531.7450000000003,
+    4877.730277777778, 4933.2259375, 5111.99125, 5001.999014084507,
+    4573.79375, 4818.682000000001, 5119.891955307261, 5217.37309859155,
+    5271.037083333334, 5336.0536363636365, 5395.043333333333, 1258.0709965635735,
+    1206.0845454545454, 1714.3625, 1288.0387643678162, 1526.0822222222223,
+    1397.3536363636363, 2817.97, 3880.7466666666664, 4869.756666666667,
+    4186.506666666667, 3814.714, 4202.861428571428, 4546.232022471909,
+    4742.834945054947, 4876.581818181819, 4958.1433333333325, 5005.120379746836,
+    5094.08980392157, 4852.87, 5151.582653061223, 5016.967647058824,
+    5199.753658536586, 5235.472968750001, 5307.063124999999, 5345.12375,
+    5428.88, 5389.4225, 1258.2210016977942, 1285.4875,
+    1148.849090909091, 1265.566, 1762.0600000000002, 1296.094722222223,
+    1438.49, 2753.138571428571, 3843.1033333333344, 3495.3683333333333,
+    4214.17125, 4024.2166666666667, 4536.627079646016, 4770.942260869565,
+    4867.080882352942, 4954.21, 5115.526153846154, 4991.914954954956,
+    4515.872, 4805.068, 5187.992068965517, 5103.22914728682,
+    5224.089240506329, 5294.289090909091, 5354.598888888889, 5403.694375,
+    1258.2947160068848, 1194.25, 1714.5537499999998, 1280.9302317880802,
+    1702.6414285714288, 1315.165652173913, 1382.306875, 1488.855,
+    5100.224999999999, 2377.4300000000003, 3604.361538461538, 3852.8720000000003,
+    4395.791836734695, 4594.487757009345, 4772.011344537814, 1292.2266666666667,
+    4930.750384615385, 4746.7446666666665, 5065.615045871559, 4305.555,
+    5186.711578947367, 5231.768229166668, 5330.3347826086965, 5396.616363636364,
+    1258.5304227941178, 1294.1109999999999, 3822.88, 1291.6270655270662,
+    1377.7819444444447, 1857.2309523809527, 1273.3999999999999, 4359.16625,
+    3677.7583333333337, 4096.677142857143, 4549.231928571429, 4905.712777777778,
+    4739.768029197079, 1311.0533333333333, 3580.892, 4897.359583333334,
+    4668.04, 5019.291511627907, 4806.860909090909, 5120.624090909091,
+    4994.402777777777, 5195.6466666666665, 5079.365, 5224.608372093023,
+    5268.390499999999, 5310.594166666667, 5355.34705882353, 5430.096,
+    5397.883076923076, 1256.8522916666666, 1258.8628225806463, 1282.05,
+    1262.0693577981656, 1296.1151111111117, 1451.8475, 4832.569,
+    4003.054, 2610.2300000000005, 3811.472068965518, 5157.2,
+    4421.548823529412, 4596.67872180451, 4636.75, 1698.9357142857145,
+    4572.0380000000005, 1297.6975, 4729.573816793895, 5162.545,
+    4858.6392, 1375.915, 3410.56, 4980.328492063496,
+    5104.527638888888, 5186.71119047619, 5234.919729729729, 5317.46,
+    5377.892162162161,
+};
+
+#endif
+
+#if EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_TABLE) || EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_FLOAT32)
+
+static const uint8_t voltage_feature[2348] = {
+    0, 0, 4, 0, 0, 4, 3, 3, 3, 4, 3, 0, 4, 3, 0, 0, 2, 3, 2, 2, 3, 1, 0, 4,
+    4, 0, 1, 3, 0, 3, 0, 0, 2, 1, 4, 0, 2, 0, 3, 3, 0, 0, 2, 3, 3, 3, 0, 0,
+    0, 2, 0, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 2, 0, 3, 3, 0, 2, 2, 0,
+    3, 4, 0, 2, 0, 0, 2, 0, 3, 0, 4, 1, 0, 0, 3, 0, 4, 1, 0, 3, 3, 3, 0, 0,
+    3, 3, 2, 2, 2, 0, 0, 3, 0, 0, 3, 2, 0, 0, 0, 0, 4, 0, 3, 1, 2, 3, 3, 2,
+    0, 4, 1, 0, 3, 0, 2, 3, 1, 0, 0, 0, 4, 1, 1, 1, 1, 0, 3, 0, 4, 3, 1, 1,
+    3, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 3, 4, 2, 1, 1, 2, 3, 0, 2,
+    2, 2, 0, 0, 3, 4, 4, 2, 0, 3, 0, 0, 3, 2, 3, 0, 1, 4, 1, 1, 2, 0, 3, 3,
+    3, 0, 0, 0, 0, 1, 3, 0, 4, 0, 0, 0, 0, 4, 0, 0, 4, 3, 0, 0, 2, 2, 4, 3,
+    2, 3, 0, 0, 1, 0, 0, 1, 0, 0, 4, 3, 0, 1, 0, 0, 4, 4, 0, 1, 4, 1, 0, 0,
+    3, 2, 1, 0, 1, 0, 0, 0, 0, 4, 4, 3, 4, 0, 3, 2, 2, 4, 0, 3, 0, 4, 0, 0,
+    3, 0, 4, 0, 0, 0, 4, 0, 2, 0, 3, 1, 3, 0, 1, 4, 4, 0, 0, 2, 0, 0, 0, 2,
+    0, 0, 0, 4, 0, 0, 2, 3, 0, 0, 3, 2, 4, 2, 0, 1, 0, 3, 0, 2, 2, 0, 0, 3,
+    3, 4, 3, 2, 3, 0, 3, 0, 3, 0, 3, 1, 0, 0, 3, 1, 0, 4, 2, 0, 0, 0, 0, 4,
+    0, 3, 1, 3, 0, 4, 2, 0, 4, 4, 3, 0, 0, 3, 0, 1, 0, 1, 0, 4, 3, 0, 4, 0,
+    3, 4, 0, 3, 3, 0, 4, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 4, 0, 0, 2, 3, 0, 0,
+    2, 2, 3, 0, 3, 2, 3, 0, 3, 3, 0, 3, 3, 0, 3, 0, 0, 4, 0, 2, 0, 0, 0, 4,
+    4, 2, 0, 3, 0, 3, 1, 0, 0, 3, 0, 0, 0, 2, 0, 0, 4, 0, 0, 3, 1, 1, 1, 0,
+    3, 1, 3, 0, 0, 3, 4, 0, 2, 4, 3, 2, 2, 0, 0, 3, 2, 3, 3, 3, 0, 4, 4, 1,
+    0, 0, 3, 0, 2, 1, 0, 0, 2, 1, 0, 4, 2, 0, 0, 0, 0, 0, 0, 3, 3, 2, 2, 2,
+    4, 3, 3, 0, 4, 3, 0, 3, 4, 0, 3, 0, 0, 0, 3, 0, 0, 0, 4, 1, 3, 0, 0, 3,
+    4, 4, 3, 0, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 3, 2, 3, 2, 0, 2, 4,
+    2, 3, 0, 3, 2, 3, 4, 0, 1, 0, 3, 0, 1, 3, 3, 0, 3, 1, 4, 1, 4, 0, 3, 0,
+    3, 1, 0, 1, 3, 4, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 3, 2, 0, 3, 0,
+    0, 4, 2, 2, 0, 3, 0, 1, 3, 0, 4, 0, 4, 1, 2, 0, 0, 3, 0, 4, 3, 1, 3, 4,
+    0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 2, 2, 2, 1, 0, 0, 3, 0, 0, 3,
+    0, 0, 4, 0, 4, 4, 4, 2, 0, 0, 3, 4, 3, 3, 3, 0, 0, 3, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 4, 0, 2, 4, 3, 3, 4, 4, 0, 3, 1, 0, 1, 3, 4, 4, 1, 0, 0, 0, 4,
+    0, 4, 0, 4, 3, 0, 2, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 3, 3, 1,
+    0, 0, 3, 0, 2, 2, 2, 1, 2, 3, 1, 4, 0, 2, 0, 3, 0, 0, 1, 4, 0, 1, 3, 1,
+    3, 3, 2, 1, 4, 0, 0, 3, 0, 4, 2, 3, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 4,
+    1, 4, 3, 4, 4, 2, 3, 4, 0, 3, 4, 3, 2, 2, 0, 0, 0, 4, 2, 1, 0, 3, 0, 0,
+    2, 4, 0, 0, 4, 3, 4, 4, 2, 0, 3, 4, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 4, 3, 2, 2, 3, 1, 3, 0, 0, 0, 0, 3, 3, 2, 0, 0, 4, 0, 0, 3,
+    3, 3, 0, 2, 4, 0, 3, 0, 0, 3, 0, 2, 3, 1, 0, 3, 0, 2, 4, 4, 0, 0, 0, 0,
+    0, 4, 3, 2, 3, 3, 4, 2, 0, 2, 2, 2, 4, 0, 0, 0, 3, 0, 2, 4, 0, 0, 2, 4,
+    2, 4, 4, 1, 0, 0, 2, 0, 0, 2, 3, 0, 0, 3, 4, 0, 0, 2, 0, 0, 0, 0, 0, 4,
+    3, 2, 3, 3, 3, 3, 2, 3, 2, 2, 0, 1, 4, 1, 0, 3, 0, 2, 1, 3, 4, 4, 0, 0,
+    0, 3, 0, 2, 2, 4, 1, 2, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 2, 1,
+    0, 1, 3, 3, 0, 2, 2, 2, 1, 2, 2, 3, 1, 1, 4, 0, 3, 0, 2, 4, 4, 0, 0, 4,
+    1, 4, 3, 3, 3, 2, 0, 3, 0, 4, 0, 4, 3, 0, 0, 3, 3, 0, 1, 0, 0, 0, 4, 0,
+    0, 0, 0, 3, 2, 3, 3, 4, 4, 0, 0, 1, 2, 0, 0, 3, 2, 3, 0, 0, 2, 0, 4, 0,
+    1, 1, 3, 0, 4, 0, 1, 4, 0, 4, 0, 1, 3, 4, 3, 1, 2, 1, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 2, 1, 3, 0, 2, 2, 4, 2, 2, 0, 3, 0, 1, 2, 4, 0, 3, 4, 0, 3,
+    0, 0, 4, 0, 0, 1, 1, 2, 0, 3, 0, 2, 4, 1, 0, 0, 3, 3, 4, 0, 0, 2, 0, 0,
+    4, 2, 0, 0, 2, 4, 3, 0, 3, 0, 2, 4, 0, 2, 2, 3, 3, 1, 2, 4, 2, 0, 0, 2,
+    0, 1, 0, 4, 0, 3, 0, 4, 4, 1, 4, 0, 3, 3, 0, 1, 0, 0, 2, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 4, 3, 2, 2, 2, 0, 1, 3, 4, 3, 4, 2, 2, 0, 1, 1, 0, 3, 2, 4,
+    3, 0, 3, 0, 4, 1, 0, 4, 0, 4, 3, 2, 1, 0, 3, 0, 2, 3, 0, 1, 3, 0, 3, 1,
+    0, 0, 0, 0, 0, 4, 0, 0, 1, 0, 1, 4, 0, 3, 0, 1, 0, 4, 2, 3, 2, 3, 4, 0,
+    2, 2, 3, 3, 2, 3, 0, 3, 0, 0, 0, 0, 2, 1, 1, 1, 3, 0, 2, 0, 4, 3, 0, 1,
+    0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 4, 0, 3, 2, 4, 3, 2, 4, 2, 3, 4, 0, 4, 4,
+    1, 0, 3, 0, 0, 4, 4, 0, 1, 0, 3, 0, 3, 0, 3, 0, 0, 2, 3, 0, 0, 1, 0, 0,
+    0, 1, 0, 0, 4, 0, 0, 0, 0, 0, 2, 3, 3, 0, 4, 4, 0, 0, 1, 2, 4, 1, 2, 0,
+    2, 0, 0, 0, 4, 4, 2, 3, 0, 3, 0, 1, 0, 4, 3, 0, 0, 0, 4, 1, 3, 0, 3, 0,
+    2, 3, 0, 0, 2, 0, 1, 0, 4, 0, 0, 0, 4, 3, 4, 1, 3, 1, 0, 2, 4, 2, 0, 1,
+    0, 2, 0, 4, 1, 1, 0, 3, 0, 0, 4, 3, 3, 0, 4, 1, 4, 0, 3, 0, 3, 4, 1, 4,
+    2, 0, 1, 0, 0, 4, 0, 0, 0, 0, 0, 4, 1, 3, 0, 2, 2, 2, 0, 3, 2, 3, 1, 0,
+    3, 4, 0, 1, 0, 1, 0, 3, 0, 4, 1, 0, 4, 0, 4, 4, 1, 3, 0, 0, 3, 0, 4, 4,
+    1, 0, 4, 0, 2, 3, 0, 0, 1, 0, 0, 0, 0, 0, 4, 3, 2, 3, 2, 1, 3, 2, 0, 2,
+    3, 4, 3, 3, 0, 2, 0, 4, 0, 3, 0, 1, 3, 1, 0, 0, 1, 4, 2, 2, 1, 0, 3, 0,
+    3, 3, 3, 4, 0, 3, 3, 0, 0, 1, 0, 0, 0, 0, 4, 4, 2, 1, 1, 3, 3, 0, 3, 1,
+    3, 1, 0, 2, 0, 1, 4, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 1, 0, 2,
+    3, 0, 3, 0, 4, 4, 3, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 2, 0, 0, 3, 4, 0, 2,
+    4, 2, 2, 4, 4, 3, 3, 0, 2, 2, 0, 3, 0, 0, 4, 0, 2, 2, 1, 3, 1, 4, 2, 1,
+    0, 0, 2, 3, 4, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0,
+    0, 1, 4, 1, 0, 1, 0, 3, 3, 0, 3, 0, 4, 1, 3, 4, 0, 1, 1, 1, 3, 3, 0, 0,
+    3, 0, 0, 2, 3, 0, 0, 3, 0, 0, 3, 2, 0, 0, 0, 0, 0, 4, 3, 2, 4, 0, 3, 2,
+    2, 3, 0, 3, 0, 3, 4, 1, 2, 3, 0, 2, 4, 2, 3, 4, 0, 3, 0, 0, 4, 1, 1, 1,
+    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 3, 4, 2, 2, 0, 3, 3, 4, 4, 2,
+    3, 4, 0, 4, 0, 1, 0, 0, 0, 0, 2, 3, 3, 3, 2, 4, 0, 4, 3, 3, 0, 3, 0, 3,
+    3, 0, 3, 3, 0, 0, 3, 1, 0, 0, 2, 0, 0, 0, 0, 0, 3, 2, 2, 0, 2, 3, 4, 1,
+    4, 0, 4, 4, 0, 3, 3, 0, 3, 0, 3, 0, 4, 0, 1, 4, 0, 3, 0, 0, 0, 0, 3, 0,
+    1, 3, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 4, 0, 2, 2, 1, 4, 0, 3, 2,
+    3, 2, 1, 0, 1, 0, 0, 4, 2, 0, 1, 3, 0, 3, 0, 2, 4, 0, 3, 0, 4, 0, 4, 4,
+    0, 3, 0, 1, 3, 0, 4, 0, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 4, 0, 2, 4, 3,
+    2, 0, 3, 0, 4, 4, 1, 0, 3, 2, 1, 2, 4, 4, 0, 4, 3, 2, 0, 0, 3, 0, 0, 0,
+    0, 1, 1, 0, 0, 3, 2, 0, 4, 0, 0, 0, 0, 0, 4, 0, 3, 2, 0, 0, 2, 1, 4, 0,
+    4, 4, 0, 1, 4, 0, 4, 0, 0, 0, 0, 3, 4, 0, 1, 0, 0, 3, 3, 4, 3, 0, 0, 0,
+    0, 1, 0, 0, 3, 2, 0, 0, 0, 4, 0, 0, 3, 3, 1, 0, 3, 0, 1, 2, 3, 0, 0, 3,
+    1, 0, 4, 0, 3, 0, 3, 4, 0, 0, 2, 4, 1, 3, 2, 0, 0, 0, 3, 4, 2, 1, 1, 3,
+    0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 4, 0, 3, 1, 2, 0, 3, 2, 0, 3,
+    4, 4, 3, 4, 1, 3, 0, 4, 3, 0, 0, 3, 0, 0, 0, 0, 4, 0, 3, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 3, 1, 3, 0, 4, 2, 4, 4, 0, 0, 3, 2, 0, 0, 0, 3, 0, 4,
+    0, 1, 0, 4, 0, 1, 3, 0, 1, 4, 0, 3, 0, 2, 3, 1, 0, 3, 3, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 3, 2, 2, 0, 1, 0, 1, 1, 4, 2, 1, 1, 0, 3, 0, 2, 1, 0, 0, 3,
+    3, 1, 1, 3, 2, 2, 0, 3, 0, 3, 3, 0, 1, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 0,
+    2, 1, 4, 0, 3, 0, 0, 4, 3, 2, 4, 4, 2, 0, 3, 0, 4, 1, 4, 0, 1, 3, 0, 1,
+    2, 4, 3, 1, 0, 2, 0, 0, 3, 0, 1, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2,
+    1, 0, 3, 2, 1, 2, 0, 1, 1, 1, 3, 0, 3, 0, 3, 4, 4, 3, 0, 4, 4, 0, 1, 2,
+    0, 3, 0, 0, 0, 1, 4, 0, 0, 3, 0, 2, 0, 0, 0, 0, 0, 4, 4, 2, 2, 3, 0, 3,
+    1, 1, 2, 4, 3, 2, 2, 0, 1, 1, 1, 3, 4, 0, 3, 0, 4, 4, 2, 4, 0, 3, 2, 4,
+    0, 2, 0, 4, 3, 1, 0, 0, 2, 3, 1, 0, 2, 0, 0, 0, 0, 0, 3, 2, 2, 4, 0, 2,
+    2, 0, 0, 0, 2, 4, 2, 3, 0, 0, 2, 0, 0, 0, 3, 3, 0, 3, 0, 1, 0, 0, 2, 3,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 3, 2, 4, 1, 3, 0, 1, 3, 0, 1, 3, 2, 1, 2, 0,
+    3, 0, 3, 2, 0, 4, 3, 0, 4, 0, 2, 4, 0, 0, 0, 2, 3, 1, 3, 0, 0, 3, 0, 2,
+    0, 4, 0, 0, 0, 0, 0, 4, 2, 2, 2, 3, 4, 2, 2, 4, 0, 2, 0, 3, 4, 0, 1, 0,
+    3, 2, 3, 4, 3, 4, 0, 3, 0, 3, 2, 1, 4, 1, 0, 3, 0, 0, 0, 0,
+};
+
+#endif
+
+#if EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_TABLE)
+
+static const double voltage_threshold[2348] = {
+    2865.5399169921875, 1430.8599853515625, 1266.0250244140625, 1279.0,
+    1259.9200439453125, 1258.39501953125, 1256.8699951171875, 1263.7350463867188,
+    1258.39501953125, 1258.39501953125, 1266.0250244140625, 1261.4450073242188,
+    1270.60498046875, 1261.4450073242188, 1312.5750122070312, 1284.3399658203125,
+    1308.760009765625, 1338.5250244140625, 1337.7599487304688, 1324.7849731445312,
+    1276.7100219726562, 1585.7749633789062, 1730.0049438476562, 4603.93994140625,
+    2317.614990234375, 1539.2249755859375, 4043.0399169921875, 4368.135009765625,
+    4824.47998046875, 5158.72998046875, 4177.35498046875, 3351.6500244140625,
+    2074.93994140625, 2154.3050537109375, 5240.385009765625, 4688.64501953125,
+    4990.844970703125, 4672.619873046875, 5280.070068359375, 5227.4150390625,
+    5182.385009765625, 4999.235107421875, 5075.550048828125, 4635.989990234375,
+    5170.175048828125, 5264.804931640625, 5069.445068359375, 5288.4599609375,
+    5217.489990234375, 5066.394775390625, 5256.41015625, 5399.114990234375,
+    5306.014892578125, 5397.590087890625, 3078.449951171875, 1666.6649780273438,
+    1332.4149780273438, 1264.5, 1258.39501953125, 1256.8699951171875,
+    1261.4450073242188, 1266.0250244140625, 1266.0250244140625, 1296.550048828125,
+    1318.6799926757812, 1406.4400024414062, 1379.72998046875, 1295.0250244140625,
+    1592.64501953125, 3037.239990234375, 1501.8300170898438, 2197.0399780273438,
+    1284.3400268554688, 4969.47509765625, 2560.2900390625, 2061.2050170898438,
+    3031.135009765625, 2284.0350341796875, 2864.7750244140625, 4892.400146484375,
+    5154.9150390625, 4530.675048828125, 1526.25, 4513.125,
+    3771.364990234375, 4734.43505859375, 4718.405029296875, 4787.849853515625,
+    5217.4951171875, 4921.39501953125, 4423.83984375, 5243.440185546875,
+    5195.360107421875, 5186.965087890625, 5182.385009765625, 5048.074951171875,
+    5219.02001953125, 5144.994873046875, 5138.125, 3008.2400512695312,
+    5248.02001953125, 5289.22509765625, 5204.51513671875, 5238.094970703125,
+    5222.8349609375, 5340.35498046875, 5308.30517578125, 5396.824951171875,
+    1816.239990234375, 627.2899780273438, 1425.52001953125, 1332.4149780273438,
+    1266.0250244140625, 1279.0, 1259.9199829101562, 1304.1799926757812,
+    1285.864990234375, 1299.60498046875, 1340.050048828125, 1291.9700317382812,
+    1512.5150146484375, 2193.989990234375, 1619.3499755859375, 4775.639892578125,
+    5154.9150390625, 3736.2650146484375, 2062.7249755859375, 3005.9498901367188,
+    4271.21484375, 4297.159912109375, 4272.739990234375, 4688.64501953125,
+    5245.724853515625, 4892.39990234375, 4803.8798828125, 5000.0,
+    4877.14013671875, 5070.969970703125, 5156.440185546875, 4905.369873046875,
+    5223.594970703125, 4775.639892578125, 4970.239990234375, 4960.31494140625,
+    5260.989990234375, 5257.175048828125, 5181.625, 5245.72998046875,
+    5217.489990234375, 5340.35498046875, 5306.014892578125, 5399.114990234375,
+    2847.219970703125, 1659.0349731445312, 1370.5750122070312, 1264.5,
+    1259.9200439453125, 1258.39501953125, 1258.39501953125, 1266.0250244140625,
+    1267.5549926757812, 1266.0250244140625, 1350.7349853515625, 1324.7849731445312,
+    1291.9700317382812, 1493.4400024414062, 1495.7250366210938, 3043.3450927734375,
+    1454.5150146484375, 1344.625, 2377.135009765625, 2131.4100341796875,
+    2139.0449829101562, 2792.280029296875, 1454.52001953125, 2378.6600341796875,
+    4822.190185546875, 5158.72998046875, 4087.300048828125, 3321.8900146484375,
+    2502.2900390625, 1455.2799682617188, 5154.9150390625, 4639.039794921875,
+    4916.820068359375, 5245.724853515625, 4841.27001953125, 4685.594970703125,
+    5088.52001953125, 5070.969970703125, 5162.545166015625, 4757.324951171875,
+    4442.919921875, 4905.369873046875, 4897.7451171875, 5069.445068359375,
+    5182.385009765625, 3208.9400024414062, 5090.050048828125, 5291.514892578125,
+    5162.545166015625, 5309.829833984375, 1841.4249877929688, 627.2899780273438,
+    1430.8599853515625, 1266.0250244140625, 1266.0250244140625, 1259.9200439453125,
+    1256.8699951171875, 1266.0250244140625, 1266.0250244140625, 1333.1799926757812,
+    1393.469970703125, 1317.9199829101562, 4809.97998046875, 1584.25,
+    1495.7250366210938, 3992.6749267578125, 4498.6298828125, 3530.97998046875,
+    1992.5199584960938, 2154.3050537109375, 1990.2350463867188, 1708.6349487304688,
+    2865.5399169921875, 2062.7249755859375, 4781.75, 5078.60009765625,
+    3936.2049560546875, 3812.5799560546875, 4303.264892578125, 4914.530029296875,
+    5241.909912109375, 5220.545166015625, 4709.25, 4970.239990234375,
+    5245.724853515625, 4877.14013671875, 5184.675048828125, 5070.969970703125,
+    5141.94482421875, 3008.2400512695312, 5309.829833984375, 5217.489990234375,
+    5355.614990234375, 3099.054931640625, 1666.6649780273438, 627.2899780273438,
+    1469.7799682617188, 1270.60498046875, 1266.0250244140625, 1266.7899780273438,
+    4423.074951171875, 1592.64501953125, 1403.3900146484375, 1337.7599487304688,
+    1358.364990234375, 2799.9100341796875, 2499.2349853515625, 1567.4600219726562,
+    2799.909912109375, 4973.2900390625, 2453.449951171875, 4893.1650390625,
+    5168.650146484375, 4303.264892578125, 1594.1700439453125, 3578.294921875,
+    4690.93505859375, 4685.594970703125, 5223.594970703125, 4822.195068359375,
+    4993.130126953125, 5125.9150390625, 5146.52001953125, 5001.525146484375,
+    4775.639892578125, 5083.18017578125, 5075.550048828125, 5207.5751953125,
+    4676.429931640625, 5267.85498046875, 5182.385009765625, 5032.050048828125,
+    5214.440185546875, 5340.35498046875, 5290.75, 5399.114990234375,
+    2865.5399169921875, 627.2899780273438, 1430.8599853515625, 1266.0250244140625,
+    1282.050048828125, 1259.9200439453125, 1294.260009765625, 1266.0250244140625,
+    1266.0250244140625, 1333.1799926757812, 1345.3900146484375, 1317.9199829101562,
+    4809.97998046875, 2293.9549560546875, 1498.780029296875, 2377.135009765625,
+    4893.1650390625, 5168.650146484375, 4087.300048828125, 2574.784912109375,
+    1452.22998046875, 3308.9149169921875, 4775.639892578125, 5141.18017578125,
+    5145.755126953125, 5216.72998046875, 5213.68017578125, 5069.445068359375,
+    5194.60009765625, 5127.445068359375, 5165.594970703125, 5048.074951171875,
+    4830.5849609375, 5083.945068359375, 5281.594970703125, 5092.340087890625,
+    5276.2548828125, 5204.51513671875, 5235.0400390625, 5282.35498046875,
+    5337.30517578125, 3250.1500244140625, 5367.824951171875, 2799.909912109375,
+    1666.6649780273438, 627.2899780273438, 1433.9149780273438, 1266.0250244140625,
+    1279.0, 1266.0250244140625, 1410.2550048828125, 1276.7100219726562,
+    1620.8800048828125, 1333.1800537109375, 1338.5249633789062, 1878.8150024414062,
+    4690.175048828125, 2728.175048828125, 1691.8499755859375, 2178.7249755859375,
+    4858.059814453125, 5154.9150390625, 3985.0450439453125, 2633.544921875,
+    3433.3050537109375, 4388.73486328125, 4582.570068359375, 1379.72998046875,
+    4523.044921875, 4696.27490234375, 5067.919921875, 4243.739990234375,
+    5211.39013671875, 5238.860107421875, 5073.260009765625, 5256.41015625,
+    5131.260009765625, 4938.18505859375, 5199.18017578125, 5276.2548828125,
+    5182.385009765625, 5264.804931640625, 5204.51513671875, 5340.35498046875,
+    5289.98486328125, 5399.114990234375, 3419.570068359375, 1666.6649780273438,
+    1333.1799926757812, 1266.0250244140625, 1279.0, 1259.9200439453125,
+    1278.2350463867188, 1266.0250244140625, 1266.0250244140625, 1288.9200439453125,
+    1300.364990234375, 1290.4450073242188, 1374.3899536132812, 1592.64501953125,
+    1299.60498046875, 1437.72998046875, 1298.8400268554688, 2679.3349609375,
+    4291.820068359375, 2284.7999267578125, 2284.0350341796875, 5108.364990234375,
+    2681.625, 4857.294921875, 5154.9150390625, 4297.159912109375,
+    4252.135009765625, 1797.925048828125, 4688.64501953125, 4698.56494140625,
+    4787.849853515625, 4750.454833984375, 4672.619873046875, 5090.81494140625,
+    5192.30517578125, 5058.764892578125, 5181.625, 5268.6201171875,
+    4999.239990234375, 5219.02001953125, 3172.3098754882812, 5288.4599609375,
+    5204.51513671875, 5199.940185546875, 5254.885009765625, 5358.670166015625,
+    5309.829833984375, 5399.114990234375, 2407.659912109375, 1465.9649658203125,
+    1266.0250244140625, 1266.0250244140625, 1258.39501953125, 1256.8699951171875,
+    1261.4450073242188, 1295.0249633789062, 1262.2100219726562, 1299.6050415039062,
+    1261.4450073242188, 1262.2100219726562, 1266.0250244140625, 1320.2050170898438,
+    1333.9450073242188, 1351.4949951171875, 4693.22509765625, 1816.239990234375,
+    1302.655029296875, 4969.47509765625, 1855.1600341796875, 1712.4550170898438,
+    3622.56005859375, 4892.400146484375, 3419.570068359375, 1588.0650024414062,
+    1400.3349609375, 5108.364990234375, 4578.7548828125, 5158.72998046875,
+    4689.41015625, 2371.7950439453125, 5224.360107421875, 4970.239990234375,
+    4858.824951171875, 5182.385009765625, 5268.6201171875, 5000.764892578125,
+    5077.0751953125, 3321.8850708007812, 5291.514892578125, 5204.51513671875,
+    5177.044921875, 5258.7001953125, 5342.64501953125, 5311.35498046875,
+    5396.824951171875, 2896.0599365234375, 1659.0349731445312, 627.2899780273438,
+    1456.0449829101562, 1312.5750122070312, 1264.5, 1291.2100219726562,
+    1351.4949951171875, 1302.655029296875, 1520.9100341796875, 1437.72998046875,
+    3173.0751342773438, 1298.8400268554688, 1291.2050170898438, 2395.449951171875,
+    2692.31005859375, 1485.0450439453125, 2312.2698974609375, 2951.0050048828125,
+    1474.3600463867188, 4892.400146484375, 5158.72998046875, 4530.675048828125,
+    4528.385009765625, 4087.300048828125, 5154.9150390625, 4760.3798828125,
+    4797.77001953125, 4858.824951171875, 5245.724853515625, 4921.39501953125,
+    5194.60009765625, 5182.385009765625, 5040.445068359375, 5176.284912109375,
+    5023.655029296875, 5110.655029296875, 5211.39013671875, 5099.969970703125,
+    5122.85986328125, 5289.98486328125, 5217.489990234375, 5249.544921875,
+    5258.7001953125, 5358.670166015625, 5339.58984375, 5399.114990234375,
+    3419.570068359375, 1666.6649780273438, 627.2899780273438, 1333.1799926757812,
+    1266.0250244140625, 1266.0250244140625, 1259.155029296875, 1295.7899780273438,
+    1290.4450073242188, 1620.8800048828125, 1437.72998046875, 3173.0751342773438,
+    1338.5249633789062, 1291.2050170898438, 2131.4100341796875, 2160.4099731445312,
+    1644.5349731445312, 3166.2099609375, 5237.3349609375, 2912.8499755859375,
+    4072.0399169921875, 4863.400146484375, 5158.72998046875, 4297.159912109375,
+    4413.9150390625, 3770.6051025390625, 5154.9150390625, 4692.4599609375,
+    5156.440185546875, 4935.1298828125, 5245.724853515625, 4685.594970703125,
+    5225.885009765625, 5182.385009765625, 5268.6201171875, 5000.764892578125,
+    5178.574951171875, 3172.3098754882812, 5290.75, 5254.885009765625,
+    4865.68994140625, 3285.2550048828125, 5358.670166015625, 5324.330078125,
+    5399.114990234375, 3078.449951171875, 1730.0049438476562, 627.2899780273438,
+    1331.6549682617188, 1264.5, 1259.9200439453125, 1258.39501953125,
+    1326.3150024414062, 1420.9400024414062, 1475.1199951171875, 1374.3900146484375,
+    1334.7049560546875, 2313.7950439453125, 2393.9249877929688, 1823.1099853515625,
+    2178.7249755859375, 2876.2200317382812, 2311.5050048828125, 3396.669921875,
+    4775.639892578125, 5157.969970703125, 4297.159912109375, 4394.840087890625,
+    1948.260009765625, 3851.4949951171875, 5224.360107421875, 4688.64501953125,
+    5245.724853515625, 4892.39990234375, 5000.0, 4685.594970703125,
+    5086.235107421875, 5178.574951171875, 4945.81494140625, 5235.0400390625,
+    5165.594970703125, 4970.239990234375, 5194.60009765625, 4030.8299560546875,
+    5210.625, 2563.3400268554688, 5156.440185546875, 5289.98486328125,
+    5275.489990234375, 5343.405029296875, 2905.97998046875, 627.2899780273438,
+    1620.8800048828125, 1469.0149536132812, 1264.5, 1258.39501953125,
+    1266.0250244140625, 1351.4949951171875, 1520.9100341796875, 1440.780029296875,
+    1344.625, 4043.0399169921875, 2293.9549560546875, 4893.1650390625,
+    5149.5751953125, 4298.68505859375, 4272.739990234375, 2193.219970703125,
+    4669.56494140625, 4668.039794921875, 5224.360107421875, 4672.619873046875,
+    5067.919921875, 5206.044921875, 5190.780029296875, 4960.31494140625,
+    5182.385009765625, 5038.920166015625, 5155.675048828125, 4848.900146484375,
+    5170.175048828125, 5264.804931640625, 5224.360107421875, 5290.75,
+    5217.489990234375, 5247.2548828125, 5275.489990234375, 5358.670166015625,
+    5324.330078125, 5402.169921875, 1909.3450317382812, 627.2899780273438,
+    1418.6499633789062, 1264.5, 1258.39501953125, 1270.60498046875,
+    1261.4450073242188, 1264.5, 1262.9749755859375, 1266.0250244140625,
+    1338.5250244140625, 2890.7200317382812, 4597.070068359375, 1620.8800048828125,
+    3864.469970703125, 1918.5, 4297.159912109375, 4413.9150390625,
+    1420.1749877929688, 4808.455078125, 2943.3750610351562, 1969.6249389648438,
+    3308.9149169921875, 1992.5199584960938, 4010.22998046875, 5203.7548828125,
+    3170.784912109375, 3240.22998046875, 4931.31494140625, 5241.909912109375,
+    5255.650146484375, 4638.27490234375, 4943.52490234375, 5132.019775390625,
+    5165.594970703125, 5052.655029296875, 5170.175048828125, 5275.489990234375,
+    5217.489990234375, 5341.114990234375, 3419.570068359375, 1666.6649780273438,
+    1465.9649658203125, 1266.0250244140625, 1266.0250244140625, 1258.39501953125,
+    1288.155029296875, 1259.9199829101562, 1266.0250244140625, 1419.4150390625,
+    1469.7799682617188, 1498.780029296875, 1740.6900024414062, 1520.14501953125,
+    1547.6199951171875, 1338.5249633789062, 1358.364990234375, 2293.9549560546875,
+    2061.2050170898438, 1567.4600219726562, 2178.7249755859375, 5237.3349609375,
+    2912.8499755859375, 4794.719970703125, 4892.400146484375, 5154.9150390625,
+    4669.56494140625, 4668.039794921875, 4498.6298828125, 4957.26513671875,
+    4781.744873046875, 4657.35498046875, 4594.014892578125, 4927.5,
+    5170.179931640625, 5157.969970703125, 5069.445068359375, 4970.239990234375,
+    5233.52001953125, 5181.625, 5072.5, 5166.364990234375,
+    4994.655029296875, 3866.7601318359375, 3008.2400512695312, 5211.39013671875,
+    5282.35498046875, 5257.175048828125, 5210.625, 5264.80517578125,
+    5368.590087890625, 5306.014892578125, 5383.090087890625, 3419.570068359375,
+    1433.9149780273438, 1264.5, 1259.9200439453125, 1258.39501953125,
+    1256.8699951171875, 1270.60498046875, 1256.8699951171875, 1256.8699951171875,
+    1262.9749755859375, 1259.155029296875, 1266.0250244140625, 1266.0250244140625,
+    1312.5750122070312, 1340.050048828125, 2892.2450561523438, 1298.8400268554688,
+    1324.7849731445312, 1291.9700317382812, 1917.7349853515625, 1730.0049438476562,
+    1498.780029296875, 1382.02001953125, 4877.14013671875, 4090.349853515625,
+    4864.1650390625, 5158.72998046875, 4297.919921875, 4272.739990234375,
+    3847.679931640625, 5240.385009765625, 4700.090087890625, 4797.77001953125,
+    5190.780029296875, 5255.650146484375, 5235.0400390625, 5225.885009765625,
+    4943.52490234375, 5073.260009765625, 5133.544921875, 5023.655029296875,
+    4680.25, 5070.969970703125, 5069.445068359375, 5008.39501953125,
+    5258.699951171875, 5182.385009765625, 3279.1499633789062, 5219.02001953125,
+    5339.58984375, 5290.75, 5399.114990234375, 2865.5399169921875,
+    1433.9149780273438, 627.2899780273438, 1266.0250244140625, 1259.9200439453125,
+    1258.39501953125, 1256.8699951171875, 1258.39501953125, 1264.5,
+    1343.864990234375, 1406.4400024414062, 1276.7100219726562, 1878.8150024414062,
+    1849.81494140625, 1730.0049438476562, 1620.8800048828125, 4781.7451171875,
+    2615.9949951171875, 4072.0399169921875, 4893.1650390625, 4291.81494140625,
+    4419.260009765625, 4079.669921875, 3308.9149169921875, 5108.364990234375,
+    2864.7750244140625, 5154.9150390625, 4688.64501953125, 4698.56494140625,
+    5209.860107421875, 4696.27490234375, 5232.755126953125, 4877.14013671875,
+    5182.385009765625, 5268.6201171875, 5057.235107421875, 5076.31494140625,
+    5220.544921875, 5317.4599609375, 5210.625, 5241.909912109375,
+    5262.51513671875, 5369.35498046875, 5353.330078125, 5403.69482421875,
+    2902.929931640625, 1430.8599853515625, 627.2899780273438, 1264.5,
+    1259.9200439453125, 1258.39501953125, 1258.39501953125, 1259.155029296875,
+    1266.0250244140625, 1336.9949951171875, 4877.900146484375, 1304.9450073242188,
+    1730.0049438476562, 1531.5950317382812, 1474.3600463867188, 3350.125,
+    4969.47509765625, 2620.574951171875, 2284.0350341796875, 4857.294921875,
+    5158.72998046875, 4304.02490234375, 4425.369873046875, 4456.655029296875,
+    3204.364990234375, 4690.93505859375, 4698.56494140625, 5224.35986328125,
+    5083.945068359375, 5245.724853515625, 5235.804931640625, 5023.659912109375,
+    5178.574951171875, 4998.474853515625, 5064.864990234375, 4903.0849609375,
+    4902.320068359375, 3008.2400512695312, 5215.965087890625, 5288.4599609375,
+    5204.51513671875, 5240.385009765625, 5222.830078125, 5358.670166015625,
+    5324.330078125, 5393.77490234375, 1909.3450317382812, 1433.9149780273438,
+    1333.9450073242188, 1264.5, 1259.9200439453125, 1258.39501953125,
+    1256.8699951171875, 1258.39501953125, 1266.0250244140625, 1301.8900146484375,
+    1288.9199829101562, 1385.8400268554688, 1376.6799926757812, 2993.7449340820312,
+    1377.4450073242188, 1317.9199829101562, 1797.9249877929688, 1531.5950317382812,
+    1349.9700317382812, 3183.760009765625, 4533.72998046875, 5160.255126953125,
+    3079.2099609375, 1565.1699829101562, 1469.7799682617188, 4781.7451171875,
+    1381.2550048828125, 1291.9700317382812, 4177.35498046875, 4243.739990234375,
+    4892.400146484375, 5154.9150390625, 4708.48486328125, 4521.52001953125,
+    4658.8798828125, 5216.72998046875, 4921.39501953125, 4946.580078125,
+    5156.440185546875, 5057.235107421875, 5131.260009765625, 5211.39013671875,
+    5275.489990234375, 5204.51513671875, 5340.35498046875, 2865.5399169921875,
+    1630.7999877929688, 1433.9149780273438, 1333.1799926757812, 1266.0250244140625,
+    1266.0250244140625, 1264.5, 1304.1799926757812, 1291.9700317382812,
+    1409.4950561523438, 1419.4150390625, 1276.7100219726562, 1567.4599609375,
+    1509.4600219726562, 3117.3650512695312, 1454.5150146484375, 1334.7049560546875,
+    1452.22998046875, 1358.364990234375, 2500.0, 3956.81005859375,
+    2131.4100341796875, 4043.0399169921875, 4171.2451171875, 4863.400146484375,
+    5154.9150390625, 4303.264892578125, 1469.7799682617188, 2974.6649169921875,
+    5241.909912109375, 4677.2001953125, 4668.039794921875, 5223.594970703125,
+    4927.5, 5245.724853515625, 5186.965087890625, 5157.969970703125,
+    5247.255126953125, 5060.2900390625, 5099.969970703125, 5165.594970703125,
+    4932.079833984375, 5056.469970703125, 5054.945068359375, 4030.8299560546875,
+    5172.465087890625, 5275.489990234375, 5182.385009765625, 5220.544921875,
+    4507.78515625, 5309.829833984375, 5289.98486328125, 5383.85009765625,
+    1909.3450317382812, 1433.9149780273438, 1270.60498046875, 1275.9450073242188,
+    1261.4450073242188, 1258.39501953125, 1264.5, 1263.7350463867188,
+    1275.1800537109375, 1285.8699951171875, 1266.7899780273438, 1272.1300048828125,
+    2988.4000854492188, 1312.5750122070312, 1284.3399658203125, 1307.9949951171875,
+    1377.4450073242188, 1571.2749633789062, 1723.905029296875, 1852.8699340820312,
+    1465.2000122070312, 3864.469970703125, 4824.47998046875, 3995.7249755859375,
+    1992.5199584960938, 3433.3050537109375, 2977.7149047851562, 3431.780029296875,
+    2013.125, 4334.554931640625, 5141.18017578125, 4530.675048828125,
+    1381.2550048828125, 4669.56494140625, 5006.10498046875, 5245.72998046875,
+    5121.3349609375, 5220.544921875, 4925.974853515625, 4802.349853515625,
+    5144.994873046875, 5228.175048828125, 5194.60009765625, 5000.0,
+    5286.93505859375, 3208.9400024414062, 5204.51513671875, 5342.64501953125,
+    5299.14501953125, 5383.85009765625, 3099.054931640625, 1433.9149780273438,
+    627.2899780273438, 1332.4199829101562, 1264.5, 1259.9200439453125,
+    1259.9199829101562, 1322.5, 1288.9199829101562, 1352.260009765625,
+    1394.2300415039062, 1334.7049560546875, 4877.900146484375, 1304.9450073242188,
+    1311.8099975585938, 1990.2350463867188, 1285.8699951171875, 1797.9249877929688,
+    3183.760009765625, 1520.9100341796875, 3276.1000366210938, 2560.2900390625,
+    4339.1298828125, 4774.875, 4776.39990234375, 5173.989990234375,
+    4297.159912109375, 4262.054931640625, 4472.679931640625, 4669.56494140625,
+    4668.039794921875, 4548.22998046875, 4892.39990234375, 4991.60498046875,
+    5070.969970703125, 5162.545166015625, 4905.369873046875, 4752.75,
+    5028.235107421875, 4970.239990234375, 5069.445068359375, 5204.51513671875,
+    5251.070068359375, 5023.66015625, 3088.3701171875, 5341.114990234375,
+    5275.489990234375, 5402.1650390625, 1630.7999877929688, 1465.9649658203125,
+    1266.0250244140625, 1282.050048828125, 1259.9200439453125, 1258.39501953125,
+    1258.39501953125, 1258.39501953125, 1263.7350463867188, 1285.10498046875,
+    1266.0250244140625, 1266.0250244140625, 1261.4450073242188, 1269.844970703125,
+    1314.864990234375, 1266.0250244140625, 1307.9949951171875, 1692.6150512695312,
+    1285.1050415039062, 2995.2649536132812, 1630.7999877929688, 3396.669921875,
+    1893.3150024414062, 4863.400146484375, 3597.375, 1992.5199584960938,
+    3332.5699462890625, 1452.22998046875, 2739.625, 4969.47509765625,
+    2954.0599365234375, 5158.72998046875, 4297.159912109375, 1929.945068359375,
+    5240.385009765625, 4943.52490234375, 5245.724853515625, 5110.655029296875,
+    5261.755126953125, 5144.994873046875, 4938.18505859375, 4990.844970703125,
+    5267.85498046875, 5181.625, 5248.02001953125, 5208.3349609375,
+    5342.64501953125, 5288.4599609375, 5396.824951171875, 2865.5399169921875,
+    1465.9649658203125, 1332.4149780273438, 1264.5, 1259.9200439453125,
+    1258.39501953125, 1256.8699951171875, 1258.39501953125, 1264.5,
+    1300.364990234375, 1386.5999755859375, 1291.9700317382812, 1307.9949951171875,
+    1443.0750122070312, 1374.3900146484375, 4693.22509765625, 1327.8399658203125,
+    1358.364990234375, 1469.7799682617188, 1403.3849487304688, 3704.9749755859375,
+    2131.4100341796875, 1794.1100463867188, 2564.864990234375, 3015.1100463867188,
+    4948.10498046875, 4824.47998046875, 5168.650146484375, 4533.72998046875,
+    1415.5950317382812, 4579.51513671875, 3736.2650146484375, 5219.01513671875,
+    4688.64501953125, 5245.72998046875, 5197.650146484375, 4921.39501953125,
+    5000.0, 5070.969970703125, 5144.994873046875, 4948.869873046875,
+    4760.3798828125, 4809.219970703125, 4897.7451171875, 4970.239990234375,
+    5172.465087890625, 5182.385009765625, 5264.804931640625, 3208.9400024414062,
+    5290.75, 5217.489990234375, 5338.065185546875, 2799.909912109375,
+    1465.9649658203125, 1266.0250244140625, 1269.0799560546875, 1258.39501953125,
+    1256.8699951171875, 1261.4450073242188, 1292.7350463867188, 1258.39501953125,
+    1301.1300048828125, 1266.0250244140625, 1266.0250244140625, 1261.4450073242188,
+    1312.5750122070312, 1267.5549926757812, 1307.9949951171875, 1351.4949951171875,
+    1334.7049560546875, 1275.9450073242188, 5090.81005859375, 1797.9249877929688,
+    3305.860107421875, 1520.9100341796875, 5183.14990234375, 2545.7899780273438,
+    2241.2999877929688, 4210.925048828125, 4780.21484375, 5154.9150390625,
+    4291.81494140625, 4252.135009765625, 3419.570068359375, 4689.41015625,
+    4698.56494140625, 4657.35498046875, 4858.824951171875, 4736.724853515625,
+    5157.969970703125, 5069.445068359375, 5079.364990234375, 4907.659912109375,
+    5224.360107421875, 4809.219970703125, 4902.320068359375, 5092.340087890625,
+    5217.489990234375, 3131.1050415039062, 5182.385009765625, 5340.35498046875,
+    5267.85498046875, 5396.824951171875, 3078.449951171875, 1666.6649780273438,
+    627.2899780273438, 1430.8599853515625, 1266.0250244140625, 1279.0,
+    1261.4450073242188, 1353.7850341796875, 4809.97998046875, 1575.0899658203125,
+    1454.5150146484375, 4871.795166015625, 1327.8399658203125, 1285.8699951171875,
+    4969.47509765625, 2395.449951171875, 2700.7050170898438, 2896.8250122070312,
+    2128.35498046875, 4892.400146484375, 5168.650146484375, 4530.675048828125,
+    4528.385009765625, 5235.804931640625, 5240.385009765625, 4709.25,
+    4916.820068359375, 4740.5400390625, 5280.070068359375, 4243.739990234375,
+    5194.60009765625, 5125.9150390625, 5145.760009765625, 5044.260009765625,
+    4932.079833984375, 5020.60498046875, 5281.594970703125, 5062.5751953125,
+    5258.7001953125, 3208.9400024414062, 5182.385009765625, 5309.829833984375,
+    5289.98486328125, 5402.169921875, 2902.929931640625, 1465.9649658203125,
+    1266.0250244140625, 1266.0250244140625, 1258.39501953125, 1256.8699951171875,
+    1261.4450073242188, 1286.6300048828125, 1260.6849975585938, 1275.1800537109375,
+    1266.0250244140625, 1266.0250244140625, 1267.5549926757812, 1269.844970703125,
+    1333.1799926757812, 1288.9200439453125, 1301.8900146484375, 1410.2550048828125,
+    4693.22509765625, 1404.1549682617188, 1358.364990234375, 1469.7799682617188,
+    1311.8099975585938, 1730.0049438476562, 1620.8800048828125, 1585.0150146484375,
+    2668.655029296875, 4969.47509765625, 3984.280029296875, 4909.949951171875,
+    4858.059814453125, 5158.72998046875, 4291.81494140625, 4413.9150390625,
+    3985.0450439453125, 5249.5400390625, 5154.9150390625, 4688.64501953125,
+    4797.77001953125, 4785.559814453125, 5245.724853515625, 4911.47998046875,
+    5211.39013671875, 5127.445068359375, 5281.594970703125, 4998.47509765625,
+    5075.550048828125, 5154.155029296875, 5293.0400390625, 5181.625,
+    5042.73486328125, 5217.489990234375, 5358.670166015625, 5324.330078125,
+    5402.169921875, 2902.929931640625, 1469.7799682617188, 627.2899780273438,
+    1267.5549926757812, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1261.4450073242188, 1260.6849975585938, 1312.5750122070312, 1402.6300048828125,
+    3173.0751342773438, 1338.5249633789062, 1878.8150024414062, 1403.3849487304688,
+    2560.2900390625, 3790.445068359375, 2131.4100341796875, 3015.1100463867188,
+    2867.06494140625, 2622.864990234375, 4754.27490234375, 5135.074951171875,
+    4531.440185546875, 4524.570068359375, 4480.31005859375, 4398.655029296875,
+    3521.0599365234375, 4689.41015625, 5238.85986328125, 4892.39990234375,
+    5080.89501953125, 5086.235107421875, 5145.760009765625, 4907.659912109375,
+    4590.199951171875, 4822.190185546875, 4970.239990234375, 5233.52001953125,
+    5194.594970703125, 5217.489990234375, 3208.9400024414062, 5182.39013671875,
+    5290.75, 1288.155029296875, 5369.35498046875, 3419.570068359375,
+    1430.8599853515625, 627.2899780273438, 1333.1799926757812, 1266.0250244140625,
+    1280.5250244140625, 1259.9199829101562, 1336.9949951171875, 1285.864990234375,
+    1326.3099975585938, 1410.2550048828125, 1588.824951171875, 1295.0250244140625,
+    1304.9450073242188, 1278.2349853515625, 1389.6549682617188, 2131.4100341796875,
+    1605.614990234375, 1376.6799926757812, 1523.9650268554688, 4090.349853515625,
+    3078.449951171875, 4697.7998046875, 4825.2451171875, 5158.72998046875,
+    4303.264892578125, 4485.64990234375, 4350.580078125, 3824.02001953125,
+    5240.385009765625, 4688.64501953125, 5245.72998046875, 5245.724853515625,
+    4892.39990234375, 5234.280029296875, 4685.594970703125, 5070.969970703125,
+    5178.574951171875, 4947.344970703125, 3878.2049560546875, 4719.169921875,
+    4970.239990234375, 4877.14013671875, 4030.8299560546875, 5204.51513671875,
+    3208.9400024414062, 5272.434814453125, 5309.829833984375, 5276.2548828125,
+    5379.275146484375, 1909.3450317382812, 1430.8599853515625, 1333.1799926757812,
+    1264.5, 1259.9200439453125, 1258.39501953125, 1256.8699951171875,
+    1258.39501953125, 1266.0250244140625, 1314.0999755859375, 1291.9700317382812,
+    1288.9199829101562, 1478.9400024414062, 1394.9949951171875, 4139.18994140625,
+    1345.3900146484375, 2890.7200317382812, 1295.0250244140625, 1276.7100219726562,
+    1797.9249877929688, 3305.860107421875, 1498.780029296875, 3268.4699096679688,
+    4758.85498046875, 5143.469970703125, 4297.159912109375, 4394.840087890625,
+    1398.0450439453125, 4774.114990234375, 4669.56494140625, 4668.039794921875,
+    4668.804931640625, 5245.724853515625, 4993.130126953125, 4921.39501953125,
+    5000.0, 5070.969970703125, 5205.28515625, 4997.710205078125,
+    4658.1201171875, 4830.5849609375, 5212.9150390625, 3866.7601318359375,
+    5204.51513671875, 5265.56982421875, 5048.080078125, 5299.14501953125,
+    5262.51513671875, 5342.64501953125, 2902.929931640625, 1430.8599853515625,
+    627.2899780273438, 1333.1799926757812, 1270.60498046875, 1266.0250244140625,
+    1262.2100219726562, 1315.6300048828125, 1291.9700317382812, 3026.5599365234375,
+    1345.3900146484375, 1588.824951171875, 1295.0250244140625, 1355.3099975585938,
+    1298.8400268554688, 1389.6549682617188, 1823.1099853515625, 1619.3499755859375,
+    1581.1950073242188, 3037.239990234375, 4738.25, 2295.47998046875,
+    4864.1650390625, 5108.364990234375, 4531.440185546875, 4527.625,
+    3898.0499267578125, 4669.56494140625, 4667.27490234375, 4780.98486328125,
+    4787.090087890625, 5143.469970703125, 5219.014892578125, 5170.179931640625,
+    5217.4951171875, 4967.184814453125, 5078.60009765625, 5194.594970703125,
+    5144.994873046875, 4907.659912109375, 5221.31005859375, 5181.625,
+    2599.969970703125, 1669.7200317382812, 5226.64990234375, 5289.98486328125,
+    5217.489990234375, 5343.405029296875, 2902.929931640625, 1630.7999877929688,
+    1333.9450073242188, 1270.60498046875, 1266.0250244140625, 1259.9200439453125,
+    1275.1849975585938, 1261.4450073242188, 1265.2650146484375, 1284.3399658203125,
+    1299.60498046875, 3102.10986328125, 1427.0449829101562, 1478.9400024414062,
+    1308.0, 1454.5150146484375, 1327.8399658203125, 2986.8750610351562,
+    4969.47509765625, 2615.9949951171875, 1581.1950073242188, 2453.449951171875,
+    4072.0399169921875, 2864.7750244140625, 4863.400146484375, 5096.155029296875,
+    4144.53515625, 3078.449951171875, 4562.724853515625, 4690.93505859375,
+    4698.56494140625, 4657.35498046875, 4935.89501953125, 5157.969970703125,
+    4697.7998046875, 5245.724853515625, 5060.2900390625, 4949.6298828125,
+    5144.9951171875, 4980.920166015625, 5068.68017578125, 4636.75,
+    5176.28515625, 5161.019775390625, 5052.655029296875, 5062.5751953125,
+    5288.4599609375, 5204.51513671875, 5139.64990234375, 5276.2548828125,
+    5340.35498046875, 5296.094970703125, 5390.719970703125, 3431.780029296875,
+    1666.6649780273438, 627.2899780273438, 1333.1799926757812, 1264.5,
+    1259.9200439453125, 1266.0250244140625, 1322.5, 1406.4400024414062,
+    1620.8800048828125, 1550.6699829101562, 4871.795166015625, 1404.1549682617188,
+    2620.574951171875, 4043.0399169921875, 1730.0049438476562, 5108.364990234375,
+    4578.7548828125, 4892.400146484375, 5158.72998046875, 4688.64501953125,
+    1381.2550048828125, 4579.51513671875, 4716.114990234375, 5225.125,
+    4777.929931640625, 4858.824951171875, 4685.594970703125, 4803.8798828125,
+    5170.179931640625, 5194.60009765625, 5182.385009765625, 5057.235107421875,
+    5144.994873046875, 4958.02490234375, 4943.52490234375, 3008.2400512695312,
+    5041.97509765625, 5289.98486328125, 5217.489990234375, 5244.96484375,
+    5257.175048828125, 5340.35498046875, 5311.35498046875, 5399.114990234375,
+    1666.6649780273438, 627.2899780273438, 1333.9450073242188, 1264.5,
+    1259.9200439453125, 1258.39501953125, 1256.8699951171875, 1266.0250244140625,
+    1266.0250244140625, 1284.3399658203125, 1290.4450073242188, 1290.4450073242188,
+    1285.864990234375, 1276.7100219726562, 1620.8800048828125, 1299.60498046875,
+    4144.53515625, 1392.7050170898438, 4719.93505859375, 1990.2350463867188,
+    1338.5249633789062, 1287.3900146484375, 3363.094970703125, 2293.9549560546875,
+    2692.31005859375, 3031.135009765625, 5171.705078125, 4783.27001953125,
+    4914.530029296875, 5177.81005859375, 4704.670166015625, 4508.544921875,
+    5228.175048828125, 4943.52490234375, 4921.39501953125, 4970.239990234375,
+    5197.650146484375, 5057.235107421875, 5159.494873046875, 3172.3098754882812,
+    5288.4599609375, 5258.7001953125, 5342.64501953125, 2865.5399169921875,
+    1659.0349731445312, 1332.4149780273438, 1264.5, 1259.9200439453125,
+    1258.39501953125, 1259.155029296875, 1266.0250244140625, 1267.5549926757812,
+    1266.0250244140625, 1298.0750122070312, 1423.989990234375, 1374.3899536132812,
+    3527.169921875, 1455.2850341796875, 1310.2849731445312, 1437.72998046875,
+    1291.2050170898438, 1288.155029296875, 1917.7349853515625, 2679.3350219726562,
+    1823.1099853515625, 1992.5199584960938, 2013.125, 4822.190185546875,
+    3985.0450439453125, 3431.0150146484375, 2074.93994140625, 5108.364990234375,
+    4493.284912109375, 3753.8199462890625, 3906.4400634765625, 5241.909912109375,
+    4688.64501953125, 1821.5799560546875, 5103.784912109375, 5167.89013671875,
+    5125.9150390625, 5162.545166015625, 5014.5, 4729.090087890625,
+    5154.155029296875, 4916.820068359375, 5194.60009765625, 5281.594970703125,
+    5275.489990234375, 5204.51513671875, 5063.33984375, 5282.35498046875,
+    5342.64501953125, 5306.014892578125, 5399.114990234375, 2858.669921875,
+    1465.9649658203125, 627.2899780273438, 1332.4149780273438, 1266.0250244140625,
+    1266.0250244140625, 1258.39501953125, 1300.364990234375, 1406.4400024414062,
+    1317.9199829101562, 1351.4949951171875, 4693.22509765625, 1452.22998046875,
+    1288.155029296875, 1816.239990234375, 4912.239990234375, 4969.47509765625,
+    2395.449951171875, 1855.1600341796875, 2036.02001953125, 2284.0350341796875,
+    4909.949951171875, 4775.639892578125, 5157.969970703125, 4087.300048828125,
+    4429.94482421875, 3308.9149169921875, 3917.1251220703125, 5224.360107421875,
+    4533.72998046875, 5170.179931640625, 4676.43505859375, 4547.465087890625,
+    5099.969970703125, 4979.39501953125, 5205.28515625, 4976.344970703125,
+    5006.864990234375, 5141.94482421875, 5053.420166015625, 5075.550048828125,
+    5269.3798828125, 3208.9400024414062, 5181.625, 5342.64501953125,
+    5289.98486328125, 5389.955078125, 2865.5399169921875, 1433.9149780273438,
+    1333.1799926757812, 1264.5, 1259.9200439453125, 1258.39501953125,
+    1262.9749755859375, 1258.39501953125, 1264.5, 1311.8150024414062,
+    5017.554931640625, 1409.4950561523438, 3026.5599365234375, 1433.1499633789062,
+    1343.864990234375, 1334.7049560546875, 1423.989990234375, 1452.22998046875,
+    1452.22998046875, 1816.239990234375, 1730.0049438476562, 2208.489990234375,
+    1474.3600463867188, 1659.0349731445312, 4043.0399169921875, 4368.135009765625,
+    4863.400146484375, 5158.72998046875, 4087.300048828125, 2574.784912109375,
+    4710.77490234375, 3578.294921875, 5154.9150390625, 4669.56494140625,
+    5245.72998046875, 4858.824951171875, 5245.724853515625, 5054.945068359375,
+    5072.5, 5177.81005859375, 4902.320068359375, 4970.23486328125,
+    5140.414794921875, 4902.320068359375, 3866.7601318359375, 5204.51513671875,
+    5232.7548828125, 5144.9951171875, 5153.39013671875, 5306.014892578125,
+    5275.489990234375, 5396.824951171875, 1666.6649780273438, 627.2899780273438,
+    1333.1799926757812, 1264.5, 1258.39501953125, 1270.60498046875,
+    1261.4450073242188, 1264.5, 1262.2149658203125, 1266.0250244140625,
+    1300.364990234375, 1406.4400024414062, 1374.3899536132812, 1455.2799682617188,
+    1461.3900146484375, 1343.10498046875, 1585.0150146484375, 4297.159912109375,
+    1391.175048828125, 1423.989990234375, 1452.22998046875, 1324.7849731445312,
+    4841.27001953125, 4377.2900390625, 2419.1099853515625, 2692.31005859375,
+    1797.9249877929688, 4980.925048828125, 3218.0999755859375, 4892.400146484375,
+    5157.204833984375, 4669.56494140625, 4668.039794921875, 4825.2451171875,
+    4672.619873046875, 4962.60986328125, 4970.239990234375, 5181.625,
+    5072.5, 5144.994873046875, 3008.2400512695312, 5309.829833984375,
+    5183.91015625, 5342.64501953125, 3099.054931640625, 1666.6649780273438,
+    627.2899780273438, 1333.1799926757812, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1318.6799926757812, 1406.4400024414062, 1620.8800048828125,
+    1501.8300170898438, 1452.22998046875, 1288.155029296875, 2560.2900390625,
+    4969.47509765625, 2740.3849487304688, 2284.0350341796875, 3099.054931640625,
+    1485.0450439453125, 4822.190185546875, 5241.909912109375, 4530.675048828125,
+    4528.385009765625, 4303.264892578125, 4690.93505859375, 4716.114990234375,
+    5200.699951171875, 4663.4599609375, 4877.14013671875, 5183.150146484375,
+    4986.264892578125, 5205.28515625, 4722.98486328125, 5181.625,
+    5146.52001953125, 5170.175048828125, 5127.43994140625, 5275.489990234375,
+    5228.175048828125, 5240.385009765625, 5256.41015625, 5343.405029296875,
+    5345.695068359375, 5399.114990234375, 3419.570068359375, 1433.9149780273438,
+    627.2899780273438, 1267.5549926757812, 1279.0, 1259.9200439453125,
+    1279.760009765625, 1259.9199829101562, 1260.6849975585938, 1333.1799926757812,
+    1340.050048828125, 1588.824951171875, 1355.3099975585938, 1291.9700317382812,
+    1284.3400268554688, 2395.449951171875, 1730.0049438476562, 1575.0899658203125,
+    4043.0399169921875, 3349.3599853515625, 4782.510009765625, 4863.400146484375,
+    5157.204833984375, 4144.53515625, 2614.469970703125, 2940.3250732421875,
+    3597.375, 4689.41015625, 4698.56494140625, 5209.860107421875,
+    4935.1298828125, 5170.179931640625, 5069.445068359375, 4731.3798828125,
+    4853.47998046875, 5069.445068359375, 5144.994873046875, 5025.945068359375,
+    4805.405029296875, 5101.494873046875, 4990.844970703125, 5170.175048828125,
+    5211.385009765625, 5272.434814453125, 2563.3400268554688, 5326.6201171875,
+    5275.489990234375, 5358.670166015625, 1909.3450317382812, 627.2899780273438,
+    1430.8599853515625, 1312.5750122070312, 1264.5, 1259.9200439453125,
+    1266.0250244140625, 1308.760009765625, 3234.1298828125, 1352.260009765625,
+    1340.050048828125, 1520.1449584960938, 1291.9700317382812, 1730.0049438476562,
+    1575.0899658203125, 1581.1950073242188, 4002.594970703125, 1398.0450439453125,
+    4719.93505859375, 2977.7149047851562, 1285.864990234375, 4993.130126953125,
+    3055.554931640625, 5108.364990234375, 3078.449951171875, 4753.510009765625,
+    4590.965087890625, 3704.9749755859375, 4822.190185546875, 5154.9150390625,
+    4531.440185546875, 4528.385009765625, 4689.41015625, 4696.27490234375,
+    5090.81494140625, 5099.969970703125, 5144.994873046875, 4938.18505859375,
+    4970.239990234375, 5266.330078125, 5181.625, 5324.330078125,
+    3078.449951171875, 1430.8599853515625, 627.2899780273438, 1333.1799926757812,
+    1270.60498046875, 1266.0250244140625, 1262.9749755859375, 1322.5,
+    1379.72998046875, 1409.4950561523438, 1305.7050170898438, 1338.5249633789062,
+    1288.155029296875, 4278.844970703125, 1797.9249877929688, 1630.7999877929688,
+    2976.949951171875, 3464.5899658203125, 2100.1199951171875, 1962.760009765625,
+    4864.93017578125, 5149.5751953125, 4087.300048828125, 4553.56982421875,
+    3415.75, 2091.7300415039062, 4556.625, 2105.4649658203125,
+    4703.905029296875, 4943.52490234375, 5170.179931640625, 4750.454833984375,
+    4921.39501953125, 5225.885009765625, 5127.445068359375, 5281.594970703125,
+    4999.239990234375, 5075.550048828125, 5225.885009765625, 5286.93505859375,
+    5211.39013671875, 5243.43505859375, 5255.650146484375, 5355.614990234375,
+    5336.5400390625, 5408.27001953125, 2865.5399169921875, 1752.1400146484375,
+    628.0549926757812, 1333.1799926757812, 1266.0250244140625, 1279.0,
+    1266.0250244140625, 1322.5, 1311.0499877929688, 1512.5150146484375,
+    1610.9599609375, 2131.4100341796875, 1986.4200439453125, 1823.1099853515625,
+    4087.300048828125, 2688.4949951171875, 1992.5199584960938, 4043.0399169921875,
+    4892.400146484375, 5168.650146484375, 3985.0450439453125, 2574.784912109375,
+    2259.614990234375, 3530.97998046875, 4688.64501953125, 4716.114990234375,
+    5150.335205078125, 4946.580078125, 4921.39501953125, 5250.31005859375,
+    5103.02490234375, 5113.704833984375, 5182.385009765625, 5281.594970703125,
+    5052.655029296875, 5156.43994140625, 5211.39013671875, 5289.22509765625,
+    5256.41015625, 5228.175048828125, 5266.330078125, 5340.35498046875,
+    5293.0400390625, 5396.824951171875, 2865.5399169921875, 1666.6649780273438,
+    628.0549926757812, 1465.9649658203125, 1264.5, 1259.9200439453125,
+    1264.5, 1419.4150390625, 4912.239990234375, 1520.14501953125,
+    1382.0250244140625, 2259.614990234375, 1878.8150024414062, 4969.47509765625,
+    2615.9949951171875, 2036.02001953125, 4494.81005859375, 5227.4150390625,
+    2864.7750244140625, 4863.400146484375, 5154.9150390625, 4304.02490234375,
+    4410.864990234375, 4250.610107421875, 4489.47021484375, 4672.6201171875,
+    4144.53515625, 5086.22998046875, 4763.429931640625, 4892.39990234375,
+    4921.39501953125, 5080.89501953125, 5217.4951171875, 4967.184814453125,
+    5040.445068359375, 5076.31494140625, 4947.344970703125, 4903.0849609375,
+    4822.955078125, 4902.320068359375, 5077.0751953125, 5211.385009765625,
+    3131.1050415039062, 5272.434814453125, 5299.14501953125, 5256.41015625,
+    5367.824951171875, 3419.570068359375, 1659.0349731445312, 627.2899780273438,
+    1370.5750122070312, 1266.0250244140625, 1266.0250244140625, 1264.5,
+    1375.9150390625, 1420.9400024414062, 1460.625, 1481.989990234375,
+    1455.2799682617188, 1324.7849731445312, 2168.8050537109375, 1986.4200439453125,
+    1823.1099853515625, 3974.35986328125, 4368.135009765625, 4824.47998046875,
+    5158.72998046875, 4303.264892578125, 2125.304931640625, 4676.43505859375,
+    4465.81005859375, 5154.9150390625, 4688.64501953125, 5245.72998046875,
+    5245.724853515625, 4609.280029296875, 4803.8798828125, 5088.52001953125,
+    5110.655029296875, 5165.594970703125, 4971.76513671875, 4907.659912109375,
+    5052.655029296875, 4970.239990234375, 3866.7601318359375, 5286.93505859375,
+    5197.650146484375, 5219.780029296875, 5226.650146484375, 5358.670166015625,
+    5339.58984375, 5354.85009765625, 3431.0150146484375, 1630.7999877929688,
+    1465.9649658203125, 1267.5549926757812, 1266.0250244140625, 1282.050048828125,
+    1266.0250244140625, 1261.4450073242188, 1262.2100219726562, 1266.0250244140625,
+    1433.1500244140625, 1354.5449829101562, 1520.9100341796875, 2290.9049682617188,
+    1403.3900146484375, 1337.7599487304688, 1358.364990234375, 2560.2900390625,
+    2228.324951171875, 2036.02001953125, 2545.02490234375, 5108.364990234375,
+    4782.510009765625, 4857.294921875, 5199.18017578125, 4177.35498046875,
+    4447.494873046875, 3518.77490234375, 3964.4400634765625, 5241.14501953125,
+    4689.41015625, 5280.070068359375, 5062.5751953125, 5170.175048828125,
+    5070.969970703125, 5079.364990234375, 4903.0849609375, 5086.235107421875,
+    4802.349853515625, 4992.3701171875, 4934.3701171875, 5204.51513671875,
+    3268.4649047851562, 5041.97509765625, 5309.829833984375, 5275.489990234375,
+    5370.880126953125, 1666.6649780273438, 627.2899780273438, 1465.9649658203125,
+    1312.5750122070312, 1266.0250244140625, 1266.0250244140625, 1264.5,
+    1307.9949951171875, 4779.4599609375, 1351.5, 1380.4949951171875,
+    1302.655029296875, 1567.4600219726562, 1498.780029296875, 4530.675048828125,
+    4902.320068359375, 4447.494873046875, 1485.8049926757812, 1298.8400268554688,
+    2912.8499755859375, 2407.659912109375, 4052.2000732421875, 3183.7598876953125,
+    4243.739990234375, 4864.1650390625, 5168.650146484375, 5120.5751953125,
+    4678.72509765625, 5156.440185546875, 4858.824951171875, 4991.60498046875,
+    5182.385009765625, 4980.920166015625, 5028.235107421875, 5264.804931640625,
+    5289.98486328125, 5211.385009765625, 5369.35498046875, 2902.929931640625,
+    1465.9649658203125, 627.2899780273438, 1333.1799926757812, 1266.0250244140625,
+    1279.0, 1259.9199829101562, 1295.7849731445312, 4942.005126953125,
+    1321.7349853515625, 1351.4949951171875, 1588.824951171875, 1354.5449829101562,
+    1292.7349853515625, 2560.2900390625, 3704.9749755859375, 4339.1298828125,
+    4574.175048828125, 2806.780029296875, 2378.6600341796875, 4864.1650390625,
+    5149.5751953125, 3985.0450439453125, 5108.364990234375, 2633.544921875,
+    4638.27490234375, 2858.669921875, 4482.599853515625, 4763.429931640625,
+    5245.724853515625, 4609.280029296875, 5060.2900390625, 5245.72998046875,
+    5183.150146484375, 5057.235107421875, 4931.31494140625, 5028.235107421875,
+    5144.994873046875, 3208.9400024414062, 5220.544921875, 5290.75,
+    5217.489990234375, 5247.2548828125, 5258.7001953125, 5389.955078125,
+    5339.58984375, 5327.385009765625, 1659.0349731445312, 627.2899780273438,
+    1433.9149780273438, 1266.0250244140625, 1259.9200439453125, 1258.39501953125,
+    1258.39501953125, 1258.39501953125, 1264.5, 1351.4949951171875,
+    4809.97998046875, 3350.125, 1468.2550048828125, 5244.199951171875,
+    4669.56494140625, 4681.01513671875, 4297.159912109375, 1398.8099975585938,
+    4808.455078125, 3193.6849365234375, 4153.695068359375, 4457.4150390625,
+    5144.9951171875, 4729.08984375, 4693.985107421875, 5238.094970703125,
+    5280.070068359375, 5206.044921875, 4900.030029296875, 5150.335205078125,
+    4824.47998046875, 5069.445068359375, 4668.0400390625, 4935.89501953125,
+    5228.93994140625, 4970.239990234375, 5182.385009765625, 5281.594970703125,
+    5069.445068359375, 5291.514892578125, 5217.489990234375, 5342.64501953125,
+};
+
+const EPS_Forest eps_voltage_forest = {
+    .n_features = 5,
+    .n_trees = 50,
+    .n_nodes = 2348,
+    .n_leaves = 1525,
+    .scale = 0.02,
+    .roots = voltage_roots,
+    .feature = voltage_feature,
+    .threshold = voltage_threshold,
+    .children = voltage_children,
+    .leaf_value = voltage_leaf_value,
+};
+
+#endif
+
+#if EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_FLOAT32)
+
+static const float voltage_f32_threshold[2348] = {
+    2865.5398f, 1430.86f, 1266.025f, 1279.0f, 1259.92f, 1258.395f,
+    1256.87f, 1263.735f, 1258.395f, 1258.395f, 1266.025f, 1261.445f,
+    1270.605f, 1261.445f, 1312.575f, 1284.34f, 1308.76f, 1338.525f,
+    1337.7599f, 1324.7849f, 1276.71f, 1585.7749f, 1730.0049f, 4603.94f,
+    2317.615f, 1539.225f, 4043.0398f, 4368.135f, 4824.48f, 5158.73f,
+    4177.355f, 3351.65f, 2074.94f, 2154.305f, 5240.385f, 4688.645f,
+    4990.8447f, 4672.6196f, 5280.07f, 5227.415f, 5182.385f, 4999.235f,
+    5075.55f, 4635.9897f, 5170.175f, 5264.8047f, 5069.445f, 5288.46f,
+    5217.4897f, 5066.3945f, 5256.41f, 5399.1147f, 5306.0146f, 5397.59f,
+    3078.45f, 1666.6649f, 1332.4149f, 1264.5f, 1258.395f, 1256.87f,
+    1261.445f, 1266.025f, 1266.025f, 1296.55f, 1318.6799f, 1406.44f,
+    1379.73f, 1295.025f, 1592.645f, 3037.24f, 1501.83f, 2197.0398f,
+    1284.34f, 4969.475f, 2560.29f, 2061.2048f, 3031.135f, 2284.035f,
+    2864.775f, 4892.4f, 5154.915f, 4530.675f, 1526.25f, 4513.125f,
+    3771.365f, 4734.435f, 4718.405f, 4787.8496f, 5217.495f, 4921.395f,
+    4423.84f, 5243.44f, 5195.36f, 5186.965f, 5182.385f, 5048.0747f,
+    5219.02f, 5144.9946f, 5138.125f, 3008.24f, 5248.02f, 5289.225f,
+    5204.515f, 5238.0947f, 5222.835f, 5340.355f, 5308.305f, 5396.8247f,
+    1816.24f, 627.29f, 1425.52f, 1332.4149f, 1266.025f, 1279.0f,
+    1259.9199f, 1304.1799f, 1285.865f, 1299.605f, 1340.05f, 1291.97f,
+    1512.515f, 2193.99f, 1619.35f, 4775.6396f, 5154.915f, 3736.265f,
+    2062.7249f, 3005.9497f, 4271.215f, 4297.1597f, 4272.7397f, 4688.645f,
+    5245.7246f, 4892.4f, 4803.88f, 5000.0f, 4877.14f, 5070.9697f,
+    5156.44f, 4905.3696f, 5223.5947f, 4775.6396f, 4970.2397f, 4960.315f,
+    5260.9897f, 5257.175f, 5181.625f, 5245.73f, 5217.4897f, 5340.355f,
+    5306.0146f, 5399.1147f, 2847.22f, 1659.0349f, 1370.575f, 1264.5f,
+    1259.92f, 1258.395f, 1258.395f, 1266.025f, 1267.5549f, 1266.025f,
+    1350.735f, 1324.7849f, 1291.97f, 1493.44f, 1495.725f, 3043.345f,
+    1454.515f, 1344.625f, 2377.135f, 2131.41f, 2139.045f, 2792.28f,
+    1454.52f, 2378.66f, 4822.19f, 5158.73f, 4087.3f, 3321.89f,
+    2502.29f, 1455.2799f, 5154.915f, 4639.0396f, 4916.82f, 5245.7246f,
+    4841.27f, 4685.5947f, 5088.52f, 5070.9697f, 5162.545f, 4757.3247f,
+    4442.92f, 4905.3696f, 4897.745f, 5069.445f, 5182.385f, 3208.94f,
+    5090.05f, 5291.5146f, 5162.545f, 5309.8296f, 1841.4249f, 627.29f,
+    1430.86f, 1266.025f, 1266.025f, 1259.92f, 1256.87f, 1266.025f,
+    1266.025f, 1333.1799f, 1393.47f, 1317.9199f, 4809.98f, 1584.25f,
+    1495.725f, 3992.6748f, 4498.63f, 3530.98f, 1992.5199f, 2154.305f,
+    1990.235f, 1708.6349f, 2865.5398f, 2062.7249f, 4781.75f, 5078.6f,
+    3936.2048f, 3812.5798f, 4303.2646f, 4914.53f, 5241.9097f, 5220.545f,
+    4709.25f, 4970.2397f, 5245.7246f, 4877.14f, 5184.675f, 5070.9697f,
+    5141.945f, 3008.24f, 5309.8296f, 5217.4897f, 5355.6147f, 3099.055f,
+    1666.6649f, 627.29f, 1469.7799f, 1270.605f, 1266.025f, 1266.7899f,
+    4423.0747f, 1592.645f, 1403.39f, 1337.7599f, 1358.365f, 2799.91f,
+    2499.2349f, 1567.46f, 2799.91f, 4973.29f, 2453.45f, 4893.165f,
+    5168.65f, 4303.2646f, 1594.17f, 3578.295f, 4690.935f, 4685.5947f,
+    5223.5947f, 4822.195f, 4993.13f, 5125.915f, 5146.52f, 5001.525f,
+    4775.6396f, 5083.18f, 5075.55f, 5207.575f, 4676.4297f, 5267.855f,
+    5182.385f, 5032.05f, 5214.44f, 5340.355f, 5290.75f, 5399.1147f,
+    2865.5398f, 627.29f, 1430.86f, 1266.025f, 1282.05f, 1259.92f,
+    1294.26f, 1266.025f, 1266.025f, 1333.1799f, 1345.39f, 1317.9199f,
+    4809.98f, 2293.9548f, 1498.78f, 2377.135f, 4893.165f, 5168.65f,
+    4087.3f, 2574.785f, 1452.23f, 3308.9148f, 4775.6396f, 5141.18f,
+    5145.755f, 5216.73f, 5213.68f, 5069.445f, 5194.6f, 5127.445f,
+    5165.5947f, 5048.0747f, 4830.585f, 5083.945f, 5281.5947f, 5092.34f,
+    5276.255f, 5204.515f, 5235.04f, 5282.355f, 5337.305f, 3250.15f,
+    5367.8247f, 2799.91f, 1666.6649f, 627.29f, 1433.9149f, 1266.025f,
+    1279.0f, 1266.025f, 1410.255f, 1276.71f, 1620.88f, 1333.18f,
+    1338.5249f, 1878.815f, 4690.175f, 2728.175f, 1691.85f, 2178.7249f,
+    4858.0596f, 5154.915f, 3985.045f, 2633.545f, 3433.305f, 4388.735f,
+    4582.57f, 1379.73f, 4523.045f, 4696.275f, 5067.92f, 4243.7397f,
+    5211.39f, 5238.86f, 5073.26f, 5256.41f, 5131.26f, 4938.185f,
+    5199.18f, 5276.255f, 5182.385f, 5264.8047f, 5204.515f, 5340.355f,
+    5289.985f, 5399.1147f, 3419.57f, 1666.6649f, 1333.1799f, 1266.025f,
+    1279.0f, 1259.92f, 1278.235f, 1266.025f, 1266.025f, 1288.92f,
+    1300.365f, 1290.445f, 1374.3899f, 1592.645f, 1299.605f, 1437.73f,
+    1298.84f, 2679.335f, 4291.82f, 2284.7998f, 2284.035f, 5108.3647f,
+    2681.625f, 4857.295f, 5154.915f, 4297.1597f, 4252.135f, 1797.925f,
+    4688.645f, 4698.565f, 4787.8496f, 4750.4546f, 4672.6196f, 5090.815f,
+    5192.305f, 5058.7646f, 5181.625f, 5268.62f, 4999.2397f, 5219.02f,
+    3172.3098f, 5288.46f, 5204.515f, 5199.94f, 5254.885f, 5358.67f,
+    5309.8296f, 5399.1147f, 2407.66f, 1465.965f, 1266.025f, 1266.025f,
+    1258.395f, 1256.87f, 1261.445f, 1295.0249f, 1262.21f, 1299.605f,
+    1261.445f, 1262.21f, 1266.025f, 1320.205f, 1333.945f, 1351.495f,
+    4693.225f, 1816.24f, 1302.655f, 4969.475f, 1855.16f, 1712.455f,
+    3622.56f, 4892.4f, 3419.57f, 1588.065f, 1400.335f, 5108.3647f,
+    4578.755f, 5158.73f, 4689.41f, 2371.795f, 5224.36f, 4970.2397f,
+    4858.8247f, 5182.385f, 5268.62f, 5000.7646f, 5077.075f, 3321.885f,
+    5291.5146f, 5204.515f, 5177.045f, 5258.7f, 5342.645f, 5311.355f,
+    5396.8247f, 2896.0598f, 1659.0349f, 627.29f, 1456.0449f, 1312.575f,
+    1264.5f, 1291.21f, 1351.495f, 1302.655f, 1520.91f, 1437.73f,
+    3173.075f, 1298.84f, 1291.205f, 2395.45f, 2692.31f, 1485.045f,
+    2312.2698f, 2951.005f, 1474.36f, 4892.4f, 5158.73f, 4530.675f,
+    4528.385f, 4087.3f, 5154.915f, 4760.38f, 4797.77f, 4858.8247f,
+    5245.7246f, 4921.395f, 5194.6f, 5182.385f, 5040.445f, 5176.2847f,
+    5023.655f, 5110.655f, 5211.39f, 5099.9697f, 5122.86f, 5289.985f,
+    5217.4897f, 5249.545f, 5258.7f, 5358.67f, 5339.59f, 5399.1147f,
+    3419.57f, 1666.6649f, 627.29f, 1333.1799f, 1266.025f, 1266.025f,
+    1259.155f, 1295.7899f, 1290.445f, 1620.88f, 1437.73f, 3173.075f,
+    1338.5249f, 1291.205f, 2131.41f, 2160.41f, 1644.5349f, 3166.21f,
+    5237.335f, 2912.8499f, 4072.0398f, 4863.4f, 5158.73f, 4297.1597f,
+    4413.915f, 3770.605f, 5154.915f, 4692.46f, 5156.44f, 4935.13f,
+    5245.7246f, 4685.5947f, 5225.885f, 5182.385f, 5268.62f, 5000.7646f,
+    5178.5747f, 3172.3098f, 5290.75f, 5254.885f, 4865.69f, 3285.255f,
+    5358.67f, 5324.33f, 5399.1147f, 3078.45f, 1730.0049f, 627.29f,
+    1331.6549f, 1264.5f, 1259.92f, 1258.395f, 1326.315f, 1420.94f,
+    1475.12f, 1374.39f, 1334.705f, 2313.795f, 2393.9248f, 1823.11f,
+    2178.7249f, 2876.22f, 2311.505f, 3396.67f, 4775.6396f, 5157.9697f,
+    4297.1597f, 4394.84f, 1948.26f, 3851.4949f, 5224.36f, 4688.645f,
+    5245.7246f, 4892.4f, 5000.0f, 4685.5947f, 5086.235f, 5178.5747f,
+    4945.815f, 5235.04f, 5165.5947f, 4970.2397f, 5194.6f, 4030.8298f,
+    5210.625f, 2563.3398f, 5156.44f, 5289.985f, 5275.4897f, 5343.405f,
+    2905.98f, 627.29f, 1620.88f, 1469.0149f, 1264.5f, 1258.395f,
+    1266.025f, 1351.495f, 1520.91f, 1440.78f, 1344.625f, 4043.0398f,
+    2293.9548f, 4893.165f, 5149.575f, 4298.685f, 4272.7397f, 2193.22f,
+    4669.565f, 4668.0396f, 5224.36f, 4672.6196f, 5067.92f, 5206.045f,
+    5190.78f, 4960.315f, 5182.385f, 5038.92f, 5155.675f, 4848.9f,
+    5170.175f, 5264.8047f, 5224.36f, 5290.75f, 5217.4897f, 5247.255f,
+    5275.4897f, 5358.67f, 5324.33f, 5402.17f, 1909.345f, 627.29f,
+    1418.6499f, 1264.5f, 1258.395f, 1270.605f, 1261.445f, 1264.5f,
+    1262.975f, 1266.025f, 1338.525f, 2890.72f, 4597.07f, 1620.88f,
+    3864.47f, 1918.5f, 4297.1597f, 4413.915f, 1420.1749f, 4808.455f,
+    2943.375f, 1969.6249f, 3308.9148f, 1992.5199f, 4010.23f, 5203.755f,
+    3170.785f, 3240.23f, 4931.315f, 5241.9097f, 5255.65f, 4638.275f,
+    4943.525f, 5132.0195f, 5165.5947f, 5052.655f, 5170.175f, 5275.4897f,
+    5217.4897f, 5341.1147f, 3419.57f, 1666.6649f, 1465.965f, 1266.025f,
+    1266.025f, 1258.395f, 1288.155f, 1259.9199f, 1266.025f, 1419.415f,
+    1469.7799f, 1498.78f, 1740.69f, 1520.145f, 1547.62f, 1338.5249f,
+    1358.365f, 2293.9548f, 2061.2048f, 1567.46f, 2178.7249f, 5237.335f,
+    2912.8499f, 4794.7197f, 4892.4f, 5154.915f, 4669.565f, 4668.0396f,
+    4498.63f, 4957.265f, 4781.7446f, 4657.355f, 4594.0146f, 4927.5f,
+    5170.1797f, 5157.9697f, 5069.445f, 4970.2397f, 5233.52f, 5181.625f,
+    5072.5f, 5166.3647f, 4994.655f, 3866.76f, 3008.24f, 5211.39f,
+    5282.355f, 5257.175f, 5210.625f, 5264.805f, 5368.59f, 5306.0146f,
+    5383.09f, 3419.57f, 1433.9149f, 1264.5f, 1259.92f, 1258.395f,
+    1256.87f, 1270.605f, 1256.87f, 1256.87f, 1262.975f, 1259.155f,
+    1266.025f, 1266.025f, 1312.575f, 1340.05f, 2892.2449f, 1298.84f,
+    1324.7849f, 1291.97f, 1917.735f, 1730.0049f, 1498.78f, 1382.02f,
+    4877.14f, 4090.3499f, 4864.165f, 5158.73f, 4297.92f, 4272.7397f,
+    3847.68f, 5240.385f, 4700.09f, 4797.77f, 5190.78f, 5255.65f,
+    5235.04f, 5225.885f, 4943.525f, 5073.26f, 5133.545f, 5023.655f,
+    4680.25f, 5070.9697f, 5069.445f, 5008.395f, 5258.6997f, 5182.385f,
+    3279.15f, 5219.02f, 5339.59f, 5290.75f, 5399.1147f, 2865.5398f,
+    1433.9149f, 627.29f, 1266.025f, 1259.92f, 1258.395f, 1256.87f,
+    1258.395f, 1264.5f, 1343.865f, 1406.44f, 1276.71f, 1878.815f,
+    1849.815f, 1730.0049f, 1620.88f, 4781.745f, 2615.9949f, 4072.0398f,
+    4893.165f, 4291.815f, 4419.26f, 4079.67f, 3308.9148f, 5108.3647f,
+    2864.775f, 5154.915f, 4688.645f, 4698.565f, 5209.86f, 4696.275f,
+    5232.755f, 4877.14f, 5182.385f, 5268.62f, 5057.235f, 5076.315f,
+    5220.545f, 5317.46f, 5210.625f, 5241.9097f, 5262.515f, 5369.355f,
+    5353.33f, 5403.695f, 2902.93f, 1430.86f, 627.29f, 1264.5f,
+    1259.92f, 1258.395f, 1258.395f, 1259.155f, 1266.025f, 1336.995f,
+    4877.9f, 1304.945f, 1730.0049f, 1531.595f, 1474.36f, 3350.125f,
+    4969.475f, 2620.575f, 2284.035f, 4857.295f, 5158.73f, 4304.025f,
+    4425.3696f, 4456.655f, 3204.365f, 4690.935f, 4698.565f, 5224.36f,
+    5083.945f, 5245.7246f, 5235.8047f, 5023.6597f, 5178.5747f, 4998.4746f,
+    5064.8647f, 4903.085f, 4902.32f, 3008.24f, 5215.965f, 5288.46f,
+    5204.515f, 5240.385f, 5222.83f, 5358.67f, 5324.33f, 5393.775f,
+    1909.345f, 1433.9149f, 1333.945f, 1264.5f, 1259.92f, 1258.395f,
+    1256.87f, 1258.395f, 1266.025f, 1301.89f, 1288.9199f, 1385.84f,
+    1376.6799f, 2993.7449f, 1377.445f, 1317.9199f, 1797.9249f, 1531.595f,
+    1349.97f, 3183.76f, 4533.73f, 5160.255f, 3079.21f, 1565.1699f,
+    1469.7799f, 4781.745f, 1381.255f, 1291.97f, 4177.355f, 4243.7397f,
+    4892.4f, 5154.915f, 4708.485f, 4521.52f, 4658.88f, 5216.73f,
+    4921.395f, 4946.58f, 5156.44f, 5057.235f, 5131.26f, 5211.39f,
+    5275.4897f, 5204.515f, 5340.355f, 2865.5398f, 1630.7999f, 1433.9149f,
+    1333.1799f, 1266.025f, 1266.025f, 1264.5f, 1304.1799f, 1291.97f,
+    1409.495f, 1419.415f, 1276.71f, 1567.46f, 1509.46f, 3117.365f,
+    1454.515f, 1334.705f, 1452.23f, 1358.365f, 2500.0f, 3956.81f,
+    2131.41f, 4043.0398f, 4171.245f, 4863.4f, 5154.915f, 4303.2646f,
+    1469.7799f, 2974.6648f, 5241.9097f, 4677.2f, 4668.0396f, 5223.5947f,
+    4927.5f, 5245.7246f, 5186.965f, 5157.9697f, 5247.255f, 5060.29f,
+    5099.9697f, 5165.5947f, 4932.0796f, 5056.4697f, 5054.945f, 4030.8298f,
+    5172.465f, 5275.4897f, 5182.385f, 5220.545f, 4507.785f, 5309.8296f,
+    5289.985f, 5383.85f, 1909.345f, 1433.9149f, 1270.605f, 1275.945f,
+    1261.445f, 1258.395f, 1264.5f, 1263.735f, 1275.18f, 1285.87f,
+    1266.7899f, 1272.13f, 2988.4f, 1312.575f, 1284.34f, 1307.995f,
+    1377.445f, 1571.2749f, 1723.905f, 1852.8699f, 1465.2f, 3864.47f,
+    4824.48f, 3995.7249f, 1992.5199f, 3433.305f, 2977.7148f, 3431.78f,
+    2013.125f, 4334.5547f, 5141.18f, 4530.675f, 1381.255f, 4669.565f,
+    5006.105f, 5245.73f, 5121.335f, 5220.545f, 4925.9746f, 4802.3496f,
+    5144.9946f, 5228.175f, 5194.6f, 5000.0f, 5286.935f, 3208.94f,
+    5204.515f, 5342.645f, 5299.145f, 5383.85f, 3099.055f, 1433.9149f,
+    627.29f, 1332.4199f, 1264.5f, 1259.92f, 1259.9199f, 1322.5f,
+    1288.9199f, 1352.26f, 1394.23f, 1334.705f, 4877.9f, 1304.945f,
+    1311.8099f, 1990.235f, 1285.87f, 1797.9249f, 3183.76f, 1520.91f,
+    3276.0999f, 2560.29f, 4339.13f, 4774.875f, 4776.4f, 5173.9897f,
+    4297.1597f, 4262.0547f, 4472.6797f, 4669.565f, 4668.0396f, 4548.23f,
+    4892.4f, 4991.605f, 5070.9697f, 5162.545f, 4905.3696f, 4752.75f,
+    5028.235f, 4970.2397f, 5069.445f, 5204.515f, 5251.07f, 5023.66f,
+    3088.37f, 5341.1147f, 5275.4897f, 5402.165f, 1630.7999f, 1465.965f,
+    1266.025f, 1282.05f, 1259.92f, 1258.395f, 1258.395f, 1258.395f,
+    1263.735f, 1285.105f, 1266.025f, 1266.025f, 1261.445f, 1269.845f,
+    1314.865f, 1266.025f, 1307.995f, 1692.615f, 1285.105f, 2995.265f,
+    1630.7999f, 3396.67f, 1893.315f, 4863.4f, 3597.375f, 1992.5199f,
+    3332.5698f, 1452.23f, 2739.625f, 4969.475f, 2954.0598f, 5158.73f,
+    4297.1597f, 1929.9451f, 5240.385f, 4943.525f, 5245.7246f, 5110.655f,
+    5261.755f, 5144.9946f, 4938.185f, 4990.8447f, 5267.855f, 5181.625f,
+    5248.02f, 5208.335f, 5342.645f, 5288.46f, 5396.8247f, 2865.5398f,
+    1465.965f, 1332.4149f, 1264.5f, 1259.92f, 1258.395f, 1256.87f,
+    1258.395f, 1264.5f, 1300.365f, 1386.6f, 1291.97f, 1307.995f,
+    1443.075f, 1374.39f, 4693.225f, 1327.84f, 1358.365f, 1469.7799f,
+    1403.3849f, 3704.9749f, 2131.41f, 1794.11f, 2564.865f, 3015.1099f,
+    4948.105f, 4824.48f, 5168.65f, 4533.73f, 1415.595f, 4579.515f,
+    3736.265f, 5219.015f, 4688.645f, 5245.73f, 5197.65f, 4921.395f,
+    5000.0f, 5070.9697f, 5144.9946f, 4948.8696f, 4760.38f, 4809.2197f,
+    4897.745f, 4970.2397f, 5172.465f, 5182.385f, 5264.8047f, 3208.94f,
+    5290.75f, 5217.4897f, 5338.065f, 2799.91f, 1465.965f, 1266.025f,
+    1269.08f, 1258.395f, 1256.87f, 1261.445f, 1292.735f, 1258.395f,
+    1301.13f, 1266.025f, 1266.025f, 1261.445f, 1312.575f, 1267.5549f,
+    1307.995f, 1351.495f, 1334.705f, 1275.945f, 5090.81f, 1797.9249f,
+    3305.86f, 1520.91f, 5183.15f, 2545.7898f, 2241.2998f, 4210.925f,
+    4780.215f, 5154.915f, 4291.815f, 4252.135f, 3419.57f, 4689.41f,
+    4698.565f, 4657.355f, 4858.8247f, 4736.7246f, 5157.9697f, 5069.445f,
+    5079.3647f, 4907.6597f, 5224.36f, 4809.2197f, 4902.32f, 5092.34f,
+    5217.4897f, 3131.105f, 5182.385f, 5340.355f, 5267.855f, 5396.8247f,
+    3078.45f, 1666.6649f, 627.29f, 1430.86f, 1266.025f, 1279.0f,
+    1261.445f, 1353.785f, 4809.98f, 1575.09f, 1454.515f, 4871.795f,
+    1327.84f, 1285.87f, 4969.475f, 2395.45f, 2700.7048f, 2896.825f,
+    2128.355f, 4892.4f, 5168.65f, 4530.675f, 4528.385f, 5235.8047f,
+    5240.385f, 4709.25f, 4916.82f, 4740.54f, 5280.07f, 4243.7397f,
+    5194.6f, 5125.915f, 5145.76f, 5044.26f, 4932.0796f, 5020.605f,
+    5281.5947f, 5062.575f, 5258.7f, 3208.94f, 5182.385f, 5309.8296f,
+    5289.985f, 5402.17f, 2902.93f, 1465.965f, 1266.025f, 1266.025f,
+    1258.395f, 1256.87f, 1261.445f, 1286.63f, 1260.6849f, 1275.18f,
+    1266.025f, 1266.025f, 1267.5549f, 1269.845f, 1333.1799f, 1288.92f,
+    1301.89f, 1410.255f, 4693.225f, 1404.1549f, 1358.365f, 1469.7799f,
+    1311.8099f, 1730.0049f, 1620.88f, 1585.015f, 2668.655f, 4969.475f,
+    3984.28f, 4909.9497f, 4858.0596f, 5158.73f, 4291.815f, 4413.915f,
+    3985.045f, 5249.54f, 5154.915f, 4688.645f, 4797.77f, 4785.5596f,
+    5245.7246f, 4911.48f, 5211.39f, 5127.445f, 5281.5947f, 4998.475f,
+    5075.55f, 5154.155f, 5293.04f, 5181.625f, 5042.735f, 5217.4897f,
+    5358.67f, 5324.33f, 5402.17f, 2902.93f, 1469.7799f, 627.29f,
+    1267.5549f, 1266.025f, 1266.025f, 1266.025f, 1261.445f, 1260.6849f,
+    1312.575f, 1402.63f, 3173.075f, 1338.5249f, 1878.815f, 1403.3849f,
+    2560.29f, 3790.445f, 2131.41f, 3015.1099f, 2867.065f, 2622.865f,
+    4754.275f, 5135.0747f, 4531.44f, 4524.57f, 4480.31f, 4398.655f,
+    3521.0598f, 4689.41f, 5238.86f, 4892.4f, 5080.895f, 5086.235f,
+    5145.76f, 4907.6597f, 4590.1997f, 4822.19f, 4970.2397f, 5233.52f,
+    5194.5947f, 5217.4897f, 3208.94f, 5182.39f, 5290.75f, 1288.155f,
+    5369.355f, 3419.57f, 1430.86f, 627.29f, 1333.1799f, 1266.025f,
+    1280.525f, 1259.9199f, 1336.995f, 1285.865f, 1326.3099f, 1410.255f,
+    1588.825f, 1295.025f, 1304.945f, 1278.235f, 1389.6549f, 2131.41f,
+    1605.615f, 1376.6799f, 1523.965f, 4090.3499f, 3078.45f, 4697.8f,
+    4825.245f, 5158.73f, 4303.2646f, 4485.65f, 4350.58f, 3824.02f,
+    5240.385f, 4688.645f, 5245.73f, 5245.7246f, 4892.4f, 5234.28f,
+    4685.5947f, 5070.9697f, 5178.5747f, 4947.3447f, 3878.2048f, 4719.17f,
+    4970.2397f, 4877.14f, 4030.8298f, 5204.515f, 3208.94f, 5272.4346f,
+    5309.8296f, 5276.255f, 5379.275f, 1909.345f, 1430.86f, 1333.1799f,
+    1264.5f, 1259.92f, 1258.395f, 1256.87f, 1258.395f, 1266.025f,
+    1314.1f, 1291.97f, 1288.9199f, 1478.94f, 1394.995f, 4139.19f,
+    1345.39f, 2890.72f, 1295.025f, 1276.71f, 1797.9249f, 3305.86f,
+    1498.78f, 3268.4697f, 4758.855f, 5143.4697f, 4297.1597f, 4394.84f,
+    1398.045f, 4774.1147f, 4669.565f, 4668.0396f, 4668.8047f, 5245.7246f,
+    4993.13f, 4921.395f, 5000.0f, 5070.9697f, 5205.285f, 4997.71f,
+    4658.12f, 4830.585f, 5212.915f, 3866.76f, 5204.515f, 5265.57f,
+    5048.08f, 5299.145f, 5262.515f, 5342.645f, 2902.93f, 1430.86f,
+    627.29f, 1333.1799f, 1270.605f, 1266.025f, 1262.21f, 1315.63f,
+    1291.97f, 3026.5598f, 1345.39f, 1588.825f, 1295.025f, 1355.3099f,
+    1298.84f, 1389.6549f, 1823.11f, 1619.35f, 1581.195f, 3037.24f,
+    4738.25f, 2295.48f, 4864.165f, 5108.3647f, 4531.44f, 4527.625f,
+    3898.0498f, 4669.565f, 4667.275f, 4780.985f, 4787.09f, 5143.4697f,
+    5219.0146f, 5170.1797f, 5217.495f, 4967.1846f, 5078.6f, 5194.5947f,
+    5144.9946f, 4907.6597f, 5221.31f, 5181.625f, 2599.97f, 1669.72f,
+    5226.65f, 5289.985f, 5217.4897f, 5343.405f, 2902.93f, 1630.7999f,
+    1333.945f, 1270.605f, 1266.025f, 1259.92f, 1275.1849f, 1261.445f,
+    1265.265f, 1284.34f, 1299.605f, 3102.1099f, 1427.0449f, 1478.94f,
+    1308.0f, 1454.515f, 1327.84f, 2986.875f, 4969.475f, 2615.9949f,
+    1581.195f, 2453.45f, 4072.0398f, 2864.775f, 4863.4f, 5096.155f,
+    4144.535f, 3078.45f, 4562.7246f, 4690.935f, 4698.565f, 4657.355f,
+    4935.895f, 5157.9697f, 4697.8f, 5245.7246f, 5060.29f, 4949.63f,
+    5144.995f, 4980.92f, 5068.68f, 4636.75f, 5176.285f, 5161.0195f,
+    5052.655f, 5062.575f, 5288.46f, 5204.515f, 5139.65f, 5276.255f,
+    5340.355f, 5296.0947f, 5390.7197f, 3431.78f, 1666.6649f, 627.29f,
+    1333.1799f, 1264.5f, 1259.92f, 1266.025f, 1322.5f, 1406.44f,
+    1620.88f, 1550.6699f, 4871.795f, 1404.1549f, 2620.575f, 4043.0398f,
+    1730.0049f, 5108.3647f, 4578.755f, 4892.4f, 5158.73f, 4688.645f,
+    1381.255f, 4579.515f, 4716.1147f, 5225.125f, 4777.9297f, 4858.8247f,
+    4685.5947f, 4803.88f, 5170.1797f, 5194.6f, 5182.385f, 5057.235f,
+    5144.9946f, 4958.025f, 4943.525f, 3008.24f, 5041.975f, 5289.985f,
+    5217.4897f, 5244.965f, 5257.175f, 5340.355f, 5311.355f, 5399.1147f,
+    1666.6649f, 627.29f, 1333.945f, 1264.5f, 1259.92f, 1258.395f,
+    1256.87f, 1266.025f, 1266.025f, 1284.34f, 1290.445f, 1290.445f,
+    1285.865f, 1276.71f, 1620.88f, 1299.605f, 4144.535f, 1392.705f,
+    4719.935f, 1990.235f, 1338.5249f, 1287.39f, 3363.095f, 2293.9548f,
+    2692.31f, 3031.135f, 5171.705f, 4783.27f, 4914.53f, 5177.81f,
+    4704.67f, 4508.545f, 5228.175f, 4943.525f, 4921.395f, 4970.2397f,
+    5197.65f, 5057.235f, 5159.4946f, 3172.3098f, 5288.46f, 5258.7f,
+    5342.645f, 2865.5398f, 1659.0349f, 1332.4149f, 1264.5f, 1259.92f,
+    1258.395f, 1259.155f, 1266.025f, 1267.5549f, 1266.025f, 1298.075f,
+    1423.99f, 1374.3899f, 3527.17f, 1455.285f, 1310.2849f, 1437.73f,
+    1291.205f, 1288.155f, 1917.735f, 2679.335f, 1823.11f, 1992.5199f,
+    2013.125f, 4822.19f, 3985.045f, 3431.015f, 2074.94f, 5108.3647f,
+    4493.2847f, 3753.8198f, 3906.44f, 5241.9097f, 4688.645f, 1821.58f,
+    5103.7847f, 5167.89f, 5125.915f, 5162.545f, 5014.5f, 4729.09f,
+    5154.155f, 4916.82f, 5194.6f, 5281.5947f, 5275.4897f, 5204.515f,
+    5063.34f, 5282.355f, 5342.645f, 5306.0146f, 5399.1147f, 2858.67f,
+    1465.965f, 627.29f, 1332.4149f, 1266.025f, 1266.025f, 1258.395f,
+    1300.365f, 1406.44f, 1317.9199f, 1351.495f, 4693.225f, 1452.23f,
+    1288.155f, 1816.24f, 4912.2397f, 4969.475f, 2395.45f, 1855.16f,
+    2036.02f, 2284.035f, 4909.9497f, 4775.6396f, 5157.9697f, 4087.3f,
+    4429.945f, 3308.9148f, 3917.125f, 5224.36f, 4533.73f, 5170.1797f,
+    4676.435f, 4547.465f, 5099.9697f, 4979.395f, 5205.285f, 4976.3447f,
+    5006.8647f, 5141.945f, 5053.42f, 5075.55f, 5269.38f, 3208.94f,
+    5181.625f, 5342.645f, 5289.985f, 5389.955f, 2865.5398f, 1433.9149f,
+    1333.1799f, 1264.5f, 1259.92f, 1258.395f, 1262.975f, 1258.395f,
+    1264.5f, 1311.815f, 5017.5547f, 1409.495f, 3026.5598f, 1433.1499f,
+    1343.865f, 1334.705f, 1423.99f, 1452.23f, 1452.23f, 1816.24f,
+    1730.0049f, 2208.49f, 1474.36f, 1659.0349f, 4043.0398f, 4368.135f,
+    4863.4f, 5158.73f, 4087.3f, 2574.785f, 4710.775f, 3578.295f,
+    5154.915f, 4669.565f, 5245.73f, 4858.8247f, 5245.7246f, 5054.945f,
+    5072.5f, 5177.81f, 4902.32f, 4970.235f, 5140.4146f, 4902.32f,
+    3866.76f, 5204.515f, 5232.755f, 5144.995f, 5153.39f, 5306.0146f,
+    5275.4897f, 5396.8247f, 1666.6649f, 627.29f, 1333.1799f, 1264.5f,
+    1258.395f, 1270.605f, 1261.445f, 1264.5f, 1262.215f, 1266.025f,
+    1300.365f, 1406.44f, 1374.3899f, 1455.2799f, 1461.39f, 1343.105f,
+    1585.015f, 4297.1597f, 1391.175f, 1423.99f, 1452.23f, 1324.7849f,
+    4841.27f, 4377.29f, 2419.1099f, 2692.31f, 1797.9249f, 4980.925f,
+    3218.0999f, 4892.4f, 5157.2046f, 4669.565f, 4668.0396f, 4825.245f,
+    4672.6196f, 4962.61f, 4970.2397f, 5181.625f, 5072.5f, 5144.9946f,
+    3008.24f, 5309.8296f, 5183.91f, 5342.645f, 3099.055f, 1666.6649f,
+    627.29f, 1333.1799f, 1266.025f, 1266.025f, 1266.025f, 1318.6799f,
+    1406.44f, 1620.88f, 1501.83f, 1452.23f, 1288.155f, 2560.29f,
+    4969.475f, 2740.3848f, 2284.035f, 3099.055f, 1485.045f, 4822.19f,
+    5241.9097f, 4530.675f, 4528.385f, 4303.2646f, 4690.935f, 4716.1147f,
+    5200.6997f, 4663.46f, 4877.14f, 5183.15f, 4986.2646f, 5205.285f,
+    4722.985f, 5181.625f, 5146.52f, 5170.175f, 5127.44f, 5275.4897f,
+    5228.175f, 5240.385f, 5256.41f, 5343.405f, 5345.695f, 5399.1147f,
+    3419.57f, 1433.9149f, 627.29f, 1267.5549f, 1279.0f, 1259.92f,
+    1279.76f, 1259.9199f, 1260.6849f, 1333.1799f, 1340.05f, 1588.825f,
+    1355.3099f, 1291.97f, 1284.34f, 2395.45f, 1730.0049f, 1575.09f,
+    4043.0398f, 3349.3599f, 4782.51f, 4863.4f, 5157.2046f, 4144.535f,
+    2614.47f, 2940.325f, 3597.375f, 4689.41f, 4698.565f, 5209.86f,
+    4935.13f, 5170.1797f, 5069.445f, 4731.38f, 4853.48f, 5069.445f,
+    5144.9946f, 5025.945f, 4805.405f, 5101.4946f, 4990.8447f, 5170.175f,
+    5211.385f, 5272.4346f, 2563.3398f, 5326.62f, 5275.4897f, 5358.67f,
+    1909.345f, 627.29f, 1430.86f, 1312.575f, 1264.5f, 1259.92f,
+    1266.025f, 1308.76f, 3234.13f, 1352.26f, 1340.05f, 1520.1449f,
+    1291.97f, 1730.0049f, 1575.09f, 1581.195f, 4002.595f, 1398.045f,
+    4719.935f, 2977.7148f, 1285.865f, 4993.13f, 3055.555f, 5108.3647f,
+    3078.45f, 4753.51f, 4590.965f, 3704.9749f, 4822.19f, 5154.915f,
+    4531.44f, 4528.385f, 4689.41f, 4696.275f, 5090.815f, 5099.9697f,
+    5144.9946f, 4938.185f, 4970.2397f, 5266.33f, 5181.625f, 5324.33f,
+    3078.45f, 1430.86f, 627.29f, 1333.1799f, 1270.605f, 1266.025f,
+    1262.975f, 1322.5f, 1379.73f, 1409.495f, 1305.705f, 1338.5249f,
+    1288.155f, 4278.8447f, 1797.9249f, 1630.7999f, 2976.95f, 3464.5898f,
+    2100.1199f, 1962.76f, 4864.93f, 5149.575f, 4087.3f, 4553.57f,
+    3415.75f, 2091.73f, 4556.625f, 2105.4648f, 4703.905f, 4943.525f,
+    5170.1797f, 4750.4546f, 4921.395f, 5225.885f, 5127.445f, 5281.5947f,
+    4999.2397f, 5075.55f, 5225.885f, 5286.935f, 5211.39f, 5243.435f,
+    5255.65f, 5355.6147f, 5336.54f, 5408.27f, 2865.5398f, 1752.14f,
+    628.055f, 1333.1799f, 1266.025f, 1279.0f, 1266.025f, 1322.5f,
+    1311.0499f, 1512.515f, 1610.96f, 2131.41f, 1986.42f, 1823.11f,
+    4087.3f, 2688.4949f, 1992.5199f, 4043.0398f, 4892.4f, 5168.65f,
+    3985.045f, 2574.785f, 2259.615f, 3530.98f, 4688.645f, 4716.1147f,
+    5150.335f, 4946.58f, 4921.395f, 5250.31f, 5103.025f, 5113.7046f,
+    5182.385f, 5281.5947f, 5052.655f, 5156.44f, 5211.39f, 5289.225f,
+    5256.41f, 5228.175f, 5266.33f, 5340.355f, 5293.04f, 5396.8247f,
+    2865.5398f, 1666.6649f, 628.055f, 1465.965f, 1264.5f, 1259.92f,
+    1264.5f, 1419.415f, 4912.2397f, 1520.145f, 1382.025f, 2259.615f,
+    1878.815f, 4969.475f, 2615.9949f, 2036.02f, 4494.81f, 5227.415f,
+    2864.775f, 4863.4f, 5154.915f, 4304.025f, 4410.8647f, 4250.61f,
+    4489.47f, 4672.62f, 4144.535f, 5086.23f, 4763.4297f, 4892.4f,
+    4921.395f, 5080.895f, 5217.495f, 4967.1846f, 5040.445f, 5076.315f,
+    4947.3447f, 4903.085f, 4822.955f, 4902.32f, 5077.075f, 5211.385f,
+    3131.105f, 5272.4346f, 5299.145f, 5256.41f, 5367.8247f, 3419.57f,
+    1659.0349f, 627.29f, 1370.575f, 1266.025f, 1266.025f, 1264.5f,
+    1375.915f, 1420.94f, 1460.625f, 1481.99f, 1455.2799f, 1324.7849f,
+    2168.805f, 1986.42f, 1823.11f, 3974.3599f, 4368.135f, 4824.48f,
+    5158.73f, 4303.2646f, 2125.305f, 4676.435f, 4465.81f, 5154.915f,
+    4688.645f, 5245.73f, 5245.7246f, 4609.28f, 4803.88f, 5088.52f,
+    5110.655f, 5165.5947f, 4971.765f, 4907.6597f, 5052.655f, 4970.2397f,
+    3866.76f, 5286.935f, 5197.65f, 5219.78f, 5226.65f, 5358.67f,
+    5339.59f, 5354.85f, 3431.015f, 1630.7999f, 1465.965f, 1267.5549f,
+    1266.025f, 1282.05f, 1266.025f, 1261.445f, 1262.21f, 1266.025f,
+    1433.15f, 1354.5449f, 1520.91f, 2290.9048f, 1403.39f, 1337.7599f,
+    1358.365f, 2560.29f, 2228.325f, 2036.02f, 2545.025f, 5108.3647f,
+    4782.51f, 4857.295f, 5199.18f, 4177.355f, 4447.4946f, 3518.775f,
+    3964.44f, 5241.145f, 4689.41f, 5280.07f, 5062.575f, 5170.175f,
+    5070.9697f, 5079.3647f, 4903.085f, 5086.235f, 4802.3496f, 4992.37f,
+    4934.37f, 5204.515f, 3268.4648f, 5041.975f, 5309.8296f, 5275.4897f,
+    5370.88f, 1666.6649f, 627.29f, 1465.965f, 1312.575f, 1266.025f,
+    1266.025f, 1264.5f, 1307.995f, 4779.46f, 1351.5f, 1380.495f,
+    1302.655f, 1567.46f, 1498.78f, 4530.675f, 4902.32f, 4447.4946f,
+    1485.8049f, 1298.84f, 2912.8499f, 2407.66f, 4052.2f, 3183.7598f,
+    4243.7397f, 4864.165f, 5168.65f, 5120.575f, 4678.725f, 5156.44f,
+    4858.8247f, 4991.605f, 5182.385f, 4980.92f, 5028.235f, 5264.8047f,
+    5289.985f, 5211.385f, 5369.355f, 2902.93f, 1465.965f, 627.29f,
+    1333.1799f, 1266.025f, 1279.0f, 1259.9199f, 1295.7849f, 4942.005f,
+    1321.735f, 1351.495f, 1588.825f, 1354.5449f, 1292.735f, 2560.29f,
+    3704.9749f, 4339.13f, 4574.175f, 2806.78f, 2378.66f, 4864.165f,
+    5149.575f, 3985.045f, 5108.3647f, 2633.545f, 4638.275f, 2858.67f,
+    4482.5996f, 4763.4297f, 5245.7246f, 4609.28f, 5060.29f, 5245.73f,
+    5183.15f, 5057.235f, 4931.315f, 5028.235f, 5144.9946f, 3208.94f,
+    5220.545f, 5290.75f, 5217.4897f, 5247.255f, 5258.7f, 5389.955f,
+    5339.59f, 5327.385f, 1659.0349f, 627.29f, 1433.9149f, 1266.025f,
+    1259.92f, 1258.395f, 1258.395f, 1258.395f, 1264.5f, 1351.495f,
+    4809.98f, 3350.125f, 1468.255f, 5244.1997f, 4669.565f, 4681.015f,
+    4297.1597f, 1398.8099f, 4808.455f, 3193.6848f, 4153.695f, 4457.415f,
+    5144.995f, 4729.09f, 4693.985f, 5238.0947f, 5280.07f, 5206.045f,
+    4900.03f, 5150.335f, 4824.48f, 5069.445f, 4668.04f, 4935.895f,
+    5228.94f, 4970.2397f, 5182.385f, 5281.5947f, 5069.445f, 5291.5146f,
+    5217.4897f, 5342.645f,
+};
+
+static const float voltage_f32_leaf_value[1525] = {
+    1256.7373f, 1258.7765f, 1289.68f, 1262.2385f, 1308.0f, 1297.315f,
+    1289.6825f, 1279.612f, 1257.63f, 1265.265f, 4548.23f, 2450.548f,
+    1273.2333f, 1302.3911f, 1732.295f, 1338.476f, 3220.39f, 3421.86f,
+    3922.47f, 4681.01f, 4629.12f, 1600.655f, 1470.7983f, 1285.1f,
+    2344.0046f, 3174.0933f, 1265.26f, 3161.7415f, 5183.15f, 4046.2205f,
+    4569.677f, 4745.847f, 3147.13f, 3826.31f, 1303.42f, 1349.21f,
+    1613.25f, 2312.27f, 5144.105f, 4910.817f, 4400.565f, 4777.319f,
+    5015.372f, 5100.8643f, 4618.44f, 5258.4434f, 5195.3257f, 5229.665f,
+    5264.5513f, 5299.1436f, 5359.1953f, 5429.2573f, 5400.6436f, 1256.5225f,
+    1257.4305f, 1259.6372f, 1262.4965f, 1504.5018f, 1275.1902f, 1314.8298f,
+    1932.2367f, 2466.42f, 3321.125f, 3644.69f, 1412.5464f, 1311.658f,
+    1891.03f, 5170.94f, 2388.582f, 1633.6625f, 3027.065f, 2558.0f,
+    3821.73f, 3444.75f, 2255.8f, 1491.15f, 1393.47f, 3466.1184f,
+    4393.3843f, 4628.3926f, 4399.192f, 4780.163f, 4870.898f, 1286.63f,
+    1465.2f, 2917.886f, 1280.53f, 4948.11f, 4990.2944f, 4857.7827f,
+    4600.12f, 4494.81f, 4496.34f, 5104.9004f, 5179.889f, 5083.5625f,
+    5206.4365f, 5237.8926f, 5330.69f, 5298.491f, 5365.8945f, 5410.5635f,
+    5024.42f, 1258.4506f, 1288.921f, 2907.51f, 1296.414f, 2052.81f,
+    1704.82f, 1370.21f, 1514.8025f, 1407.0112f, 1823.11f, 1513.0266f,
+    4884.77f, 4049.15f, 3271.9663f, 2216.115f, 4206.0444f, 4557.1416f,
+    4731.717f, 4876.624f, 4183.46f, 5114.7754f, 4985.061f, 3553.6233f,
+    2991.45f, 4710.359f, 3992.67f, 5106.71f, 5177.212f, 5223.661f,
+    5289.3774f, 5337.8115f, 5381.3726f, 5405.011f, 1256.97f, 1258.9847f,
+    1261.4607f, 1651.785f, 4674.91f, 843.50665f, 1288.148f, 1927.66f,
+    1463.5364f, 1691.85f, 1413.8184f, 1312.268f, 2040.6f, 1630.8f,
+    2442.0f, 2168.805f, 2683.15f, 2800.67f, 2916.67f, 3221.92f,
+    3373.02f, 3998.3438f, 4565.7544f, 4731.7925f, 5219.78f, 5108.976f,
+    4870.3154f, 4993.983f, 4743.3823f, 5157.6733f, 5095.4243f, 5204.9185f,
+    5239.8896f, 5297.2373f, 5376.2036f, 1257.3599f, 1261.594f, 1294.0934f,
+    1271.2593f, 1513.6354f, 1281.3934f, 1464.836f, 1660.3066f, 1990.7433f,
+    1463.295f, 1330.38f, 4952.69f, 2205.6238f, 3250.2893f, 3823.2634f,
+    4025.49f, 3396.67f, 4185.797f, 4442.794f, 4615.1978f, 4832.2886f,
+    3806.2166f, 5005.439f, 4770.6646f, 5106.0093f, 5178.903f, 5246.6465f,
+    5338.8267f, 5395.9f, 1259.4202f, 1235.0269f, 2470.7483f, 1292.8958f,
+    1521.367f, 2315.32f, 2562.58f, 3183.2534f, 1571.785f, 2177.527f,
+    3518.9836f, 4086.4705f, 4592.991f, 3906.695f, 4796.139f, 4004.885f,
+    5075.398f, 4945.9575f, 5049.429f, 5122.1436f, 4665.2417f, 4923.685f,
+    4663.21f, 4936.8857f, 5228.327f, 5126.087f, 5187.859f, 5229.2393f,
+    5268.7456f, 5309.3213f, 5375.458f, 5408.577f, 1257.3765f, 1263.1875f,
+    1304.336f, 1289.6825f, 1637.973f, 4611.57f, 1281.5686f, 1495.0837f,
+    1488.398f, 1668.005f, 3696.07f, 2247.2292f, 4317.51f, 3096.9844f,
+    3853.3372f, 4596.039f, 4885.2065f, 3417.28f, 5119.189f, 4962.1045f,
+    5070.781f, 5118.443f, 4673.3813f, 4919.4917f, 5160.577f, 5073.2593f,
+    5222.8857f, 5120.57f, 5257.5576f, 5299.863f, 5350.483f, 5393.5557f,
+    1258.2885f, 1290.4467f, 2270.2988f, 1302.3428f, 1423.0747f, 2360.5f,
+    2846.766f, 1606.1267f, 2081.81f, 4881.866f, 4099.0034f, 3454.3843f,
+    1944.44f, 3089.135f, 4511.4873f, 4926.571f, 4689.7993f, 4889.2f,
+    5030.1206f, 4754.655f, 4888.584f, 5120.3257f, 5175.2134f, 5222.356f,
+    5269.979f, 5310.3394f, 5363.3384f, 5408.318f, 1257.2905f, 1262.2096f,
+    1304.565f, 1283.325f, 1797.4885f, 1274.1062f, 1315.8281f, 1390.6012f,
+    2370.7766f, 1864.9122f, 3538.995f, 3112.7883f, 3726.3433f, 4054.8062f,
+    4564.044f, 4050.4521f, 4713.476f, 4862.418f, 1288.16f, 3373.5234f,
+    4919.798f, 4547.465f, 5073.7793f, 5212.4272f, 5140.3066f, 5221.251f,
+    5260.927f, 5306.5215f, 5340.4814f, 5371.0234f, 5400.642f, 1256.3896f,
+    1257.3883f, 1259.4695f, 1262.5774f, 1306.47f, 1275.2354f, 1295.79f,
+    1266.79f, 1679.3844f, 1283.1566f, 1405.28f, 1725.58f, 2522.3867f,
+    1517.0942f, 2881.1826f, 3854.55f, 3198.3467f, 4475.193f, 4797.4487f,
+    3897.74f, 1489.318f, 3097.9075f, 4964.9175f, 4632.784f, 5088.918f,
+    5221.509f, 5161.7065f, 5225.1226f, 5261.6763f, 5340.052f, 5303.5337f,
+    5367.024f, 5414.4873f, 1258.3422f, 1284.2108f, 1820.8167f, 1357.9949f,
+    1697.1917f, 1417.9965f, 2040.6f, 2378.66f, 1796.4f, 2712.53f,
+    2973.442f, 4037.6445f, 4451.961f, 4640.5073f, 4867.635f, 1293.346f,
+    1514.55f, 2991.45f, 4929.2925f, 5019.3105f, 4806.928f, 5072.224f,
+    5135.779f, 4844.76f, 5036.77f, 5192.1826f, 5069.19f, 5230.042f,
+    5265.2363f, 5310.898f, 5346.154f, 5377.746f, 5400.9688f, 1258.3787f,
+    1157.2783f, 1293.4713f, 1390.8788f, 1556.78f, 2666.778f, 3373.5266f,
+    1944.44f, 4466.88f, 3737.6873f, 4574.2646f, 4785.8203f, 1285.3617f,
+    4938.6904f, 4349.0527f, 5079.817f, 5239.813f, 5206.514f, 5219.0176f,
+    5266.89f, 5314.4087f, 5347.5483f, 5371.8965f, 5406.898f, 1257.3947f,
+    1262.2096f, 1293.8704f, 2193.224f, 1371.72f, 1567.3334f, 2248.165f,
+    2139.8066f, 2653.0076f, 3011.2925f, 2211.03f, 4780.725f, 3853.6636f,
+    4548.444f, 4734.9536f, 1294.264f, 4873.6875f, 5031.2056f, 4311.66f,
+    4861.112f, 5095.9497f, 5171.306f, 5228.939f, 5272.59f, 5314.332f,
+    5382.072f, 1256.9491f, 1260.7808f, 1750.6761f, 1290.6765f, 1699.8625f,
+    1429.5889f, 1845.6545f, 2382.649f, 4644.1914f, 3716.0269f, 4565.649f,
+    4786.9014f, 3248.0322f, 5182.279f, 4987.241f, 4775.4233f, 5114.7275f,
+    5017.5107f, 5206.0444f, 5093.712f, 5227.696f, 5281.0474f, 5297.28f,
+    5348.875f, 5375.2173f, 5409.624f, 1256.918f, 1264.2483f, 1259.7981f,
+    1262.6592f, 1285.716f, 4632.683f, 1648.2827f, 1281.9861f, 1477.9655f,
+    1338.52f, 1987.69f, 5010.305f, 4690.167f, 4123.93f, 2486.7f,
+    3835.823f, 4323.2837f, 4403.24f, 4564.4546f, 4769.211f, 5019.269f,
+    5106.131f, 4893.439f, 5172.1187f, 5225.4126f, 5286.859f, 5381.2866f,
+    1256.901f, 1260.7354f, 1274.2412f, 1297.3143f, 1630.5442f, 1297.8369f,
+    1533.88f, 1399.57f, 1628.51f, 1782.358f, 2656.6958f, 3394.64f,
+    4220.262f, 4589.192f, 4540.6f, 5015.263f, 4714.882f, 5134.6924f,
+    4862.4595f, 3147.13f, 1289.3025f, 4956.489f, 5041.5415f, 4773.0977f,
+    5130.056f, 5035.9766f, 5196.203f, 5222.664f, 5251.835f, 5272.739f,
+    5300.3945f, 5334.25f, 5361.722f, 5393.8687f, 1256.5262f, 1257.2069f,
+    1258.677f, 1268.32f, 1260.5858f, 1262.8394f, 1283.9608f, 2058.4033f,
+    1276.8193f, 1382.5247f, 1452.035f, 1690.172f, 2181.01f, 2820.6353f,
+    1774.645f, 3710.32f, 4340.222f, 3852.48f, 4583.7603f, 4781.3457f,
+    5240.6367f, 4903.3027f, 5016.684f, 5099.4863f, 4620.981f, 4846.528f,
+    5109.648f, 5188.854f, 5221.307f, 5269.7446f, 5304.2334f, 5365.113f,
+    5410.562f, 1256.824f, 1258.77f, 1262.236f, 1966.424f, 1297.6494f,
+    1491.452f, 1723.905f, 2676.0278f, 1776.862f, 3076.9246f, 3326.21f,
+    4474.2026f, 4088.83f, 4580.655f, 3685.897f, 4788.1304f, 3391.026f,
+    4991.3154f, 4764.8486f, 5117.082f, 4977.775f, 5183.15f, 5098.4424f,
+    5226.2627f, 5275.8696f, 5376.068f, 5334.2485f, 5407.44f, 5369.1f,
+    1256.9602f, 1258.7677f, 1267.2285f, 1261.5349f, 1524.522f, 1288.1531f,
+    1550.67f, 1473.4857f, 1918.498f, 2780.0674f, 3645.5388f, 4256.992f,
+    1668.955f, 4599.9316f, 4158.3164f, 4764.179f, 1283.58f, 4863.2046f,
+    4975.198f, 4620.269f, 5087.7734f, 4915.588f, 5174.7227f, 5084.556f,
+    5218.46f, 5258.992f, 5305.346f, 5347.1777f, 5373.9316f, 5403.947f,
+    1256.8304f, 1258.7377f, 1282.56f, 1261.4177f, 1494.3794f, 1278.5879f,
+    1396.775f, 1452.688f, 1352.26f, 1300.3676f, 1549.1433f, 1755.19f,
+    1495.3475f, 1350.73f, 4789.682f, 2334.4019f, 3628.3357f, 4884.0034f,
+    1417.89f, 3909.2698f, 4474.407f, 4785.018f, 4600.776f, 5081.4f,
+    4810.1035f, 1563.9f, 3342.66f, 5012.5645f, 4821.664f, 5107.925f,
+    4936.989f, 5159.7866f, 5222.5635f, 5293.489f, 5381.309f, 1258.2665f,
+    1136.293f, 2941.47f, 1285.3528f, 1990.235f, 1341.45f, 1445.364f,
+    1439.4729f, 1306.9767f, 2168.42f, 2769.9575f, 2230.1084f, 3947.3286f,
+    4596.5146f, 4205.5864f, 4770.823f, 1284.5967f, 4894.2812f, 5000.6543f,
+    5003.053f, 5081.7983f, 4806.267f, 5135.771f, 5043.1597f, 5255.952f,
+    5209.033f, 5283.4473f, 5304.794f, 5357.6123f, 5394.8706f, 1256.9989f,
+    1259.9207f, 1262.36f, 1267.0077f, 1289.03f, 1280.7816f, 1275.3076f,
+    1305.8407f, 1340.2744f, 1501.32f, 1755.19f, 1474.87f, 5067.92f,
+    2574.697f, 3875.2373f, 2030.526f, 4418.201f, 4559.4814f, 4718.1978f,
+    5145.604f, 4867.8228f, 5066.771f, 4843.814f, 5021.37f, 4856.533f,
+    5142.1577f, 5227.045f, 5284.645f, 5331.3667f, 5403.8643f, 5363.2485f,
+    1257.4425f, 1261.526f, 1292.319f, 2002.75f, 1321.2267f, 1411.13f,
+    1617.8257f, 1498.78f, 2100.7583f, 2850.275f, 2779.6863f, 3769.0347f,
+    4297.822f, 4574.619f, 2913.615f, 4908.17f, 4707.06f, 4985.707f,
+    4858.4116f, 4968.416f, 5045.151f, 4740.1787f, 5188.959f, 5113.074f,
+    4913.0f, 5222.636f, 5295.971f, 5376.578f, 5409.4175f, 1256.794f,
+    1259.0507f, 1261.9937f, 1288.3743f, 1279.0f, 1264.5f, 2757.324f,
+    1281.9923f, 1486.876f, 1358.6259f, 1423.99f, 1443.83f, 1466.73f,
+    5098.19f, 4669.479f, 2070.8892f, 3520.146f, 3105.92f, 3474.4436f,
+    4211.0005f, 4650.1577f, 3554.638f, 1339.6675f, 4896.495f, 5049.211f,
+    4863.753f, 5136.108f, 5181.543f, 5225.675f, 5260.5537f, 5308.2188f,
+    5374.5425f, 5408.655f, 1256.8331f, 1259.0275f, 1261.6409f, 1856.1766f,
+    1293.4653f, 1443.7153f, 1338.3827f, 2175.67f, 1512.5167f, 2610.196f,
+    2172.1116f, 1458.59f, 4285.71f, 3596.8667f, 4355.473f, 4538.9517f,
+    4742.8f, 3969.17f, 5168.106f, 4891.571f, 5146.826f, 5014.5093f,
+    3204.365f, 4453.908f, 4779.417f, 5109.578f, 5191.63f, 5240.6323f,
+    5326.822f, 5396.626f, 1256.4425f, 1257.547f, 1259.4912f, 1262.5688f,
+    1272.5125f, 1279.765f, 1288.5375f, 1264.7567f, 2508.4778f, 1054.6383f,
+    1280.9076f, 1725.9714f, 1366.4155f, 1612.865f, 1503.97f, 2406.135f,
+    1950.5525f, 3216.9568f, 4180.403f, 4583.295f, 3928.9524f, 4825.2476f,
+    4717.0737f, 4879.408f, 5124.815f, 4983.552f, 4629.884f, 4843.255f,
+    5106.7466f, 5182.5547f, 5234.91f, 5298.3057f, 5371.752f, 5405.982f,
+    1258.4359f, 1294.0443f, 3177.6572f, 1303.4559f, 1633.3434f, 1397.5366f,
+    2330.585f, 1652.1675f, 2934.7913f, 2416.82f, 4345.0986f, 4608.6895f,
+    4800.6606f, 4917.9f, 5013.44f, 5182.597f, 5095.1943f, 4767.3804f,
+    4923.8247f, 5132.0576f, 5205.0635f, 5272.386f, 5305.098f, 5359.0503f,
+    5400.3867f, 1256.5554f, 1257.4977f, 1259.7454f, 1262.6802f, 1270.6038f,
+    1300.368f, 3130.34f, 1262.363f, 1275.2633f, 1328.8668f, 1384.2604f,
+    1467.1075f, 2124.1353f, 3695.2163f, 4298.0425f, 4546.5845f, 4773.0684f,
+    1318.6833f, 4942.1284f, 4606.663f, 5074.9224f, 4898.473f, 5218.0854f,
+    5123.3154f, 5197.0933f, 5236.8306f, 5313.8364f, 5344.0415f, 5408.7153f,
+    5373.579f, 1258.2987f, 3129.58f, 721.9157f, 1269.6506f, 1266.0275f,
+    1283.1249f, 1384.432f, 1882.021f, 2322.04f, 2878.0034f, 3011.29f,
+    2275.64f, 3701.2454f, 4394.042f, 4717.0073f, 4999.695f, 4595.0703f,
+    4715.67f, 5080.3833f, 4846.84f, 5152.78f, 5011.414f, 4782.83f,
+    5112.957f, 5190.156f, 5275.032f, 5229.849f, 5337.1196f, 5398.828f,
+    1258.2131f, 1291.4271f, 3495.6267f, 1299.1754f, 1364.13f, 1607.65f,
+    1394.992f, 1550.6737f, 2613.2708f, 3282.054f, 3797.8882f, 4149.6235f,
+    4425.307f, 4529.069f, 4742.299f, 1291.975f, 5224.36f, 4897.553f,
+    5172.2134f, 5016.231f, 4713.32f, 5131.671f, 5227.947f, 5290.5234f,
+    5362.522f, 5407.1587f, 1256.8088f, 1258.886f, 1261.5902f, 1542.4745f,
+    1277.9972f, 1369.5936f, 1421.96f, 1292.7367f, 1323.26f, 1460.84f,
+    1580.69f, 1286.016f, 4637.306f, 3612.4531f, 1562.574f, 4574.57f,
+    4867.935f, 4709.0664f, 5113.2217f, 4877.457f, 5161.566f, 5015.7974f,
+    4695.1323f, 5180.763f, 5100.452f, 5220.9077f, 5282.992f, 5338.83f,
+    5383.28f, 1258.9144f, 1230.6376f, 2360.6033f, 1288.055f, 1381.64f,
+    1288.92f, 1630.0366f, 1940.8867f, 1507.634f, 1306.4686f, 1989.2134f,
+    2613.16f, 3746.491f, 4473.88f, 4622.8677f, 4717.532f, 4855.5605f,
+    4748.17f, 3711.0825f, 4882.2007f, 5014.5444f, 4856.0835f, 4649.345f,
+    5126.7715f, 4998.3555f, 5196.2285f, 5237.3647f, 5317.765f, 5387.2695f,
+    1257.3325f, 1262.3817f, 1268.3928f, 1287.852f, 1275.4454f, 1307.8075f,
+    1367.5228f, 1293.5f, 1472.96f, 2276.4026f, 2735.0425f, 1459.6067f,
+    2159.342f, 3793.7178f, 4358.668f, 4595.5815f, 3710.3164f, 5036.63f,
+    4752.844f, 4339.135f, 3228.2766f, 1336.998f, 5125.5376f, 4924.2886f,
+    4618.13f, 5015.191f, 5102.802f, 4768.01f, 4977.0215f, 5232.3887f,
+    5133.278f, 5217.9453f, 5266.678f, 5304.995f, 5292.871f, 5365.462f,
+    5405.6562f, 1257.4105f, 1261.9379f, 1469.5385f, 1284.6448f, 2110.502f,
+    1395.8162f, 2227.6743f, 3046.633f, 1426.03f, 4407.81f, 4532.779f,
+    3679.872f, 4726.3237f, 4871.119f, 4937.578f, 5013.944f, 4536.934f,
+    4754.274f, 5185.0874f, 5082.249f, 5189.9653f, 5082.4165f, 5224.061f,
+    5262.75f, 5333.8145f, 5301.2437f, 5371.7515f, 5413.4746f, 1256.9032f,
+    1258.9673f, 1261.5881f, 1279.255f, 1886.4467f, 1273.0597f, 1315.3599f,
+    1384.9033f, 4660.254f, 2345.0825f, 3263.3428f, 2440.2234f, 3757.9917f,
+    4230.43f, 4477.774f, 4617.8306f, 4816.2686f, 3133.3933f, 4645.91f,
+    5002.3784f, 4804.946f, 5110.5337f, 5214.8384f, 5278.6753f, 5305.42f,
+    5378.906f, 1256.8535f, 1258.6925f, 1266.792f, 1261.5239f, 1447.3718f,
+    1062.7783f, 1284.4197f, 1969.3767f, 1504.0509f, 1388.0336f, 1336.995f,
+    1290.19f, 2422.0447f, 3205.5125f, 3868.134f, 3558.835f, 4136.1426f,
+    3104.015f, 4524.673f, 4750.219f, 5099.4844f, 4913.9536f, 5079.3374f,
+    4874.85f, 4841.1533f, 5203.7554f, 5124.209f, 5227.7515f, 5284.1187f,
+    5337.302f, 5374.8984f, 5413.487f, 1258.491f, 1193.3578f, 1298.2418f,
+    2331.73f, 1368.7084f, 2040.4277f, 1484.7562f, 2741.91f, 3011.29f,
+    3123.2217f, 3615.69f, 4205.259f, 3873.63f, 4352.8687f, 4626.2383f,
+    4891.377f, 4649.725f, 5020.0923f, 5073.4097f, 4798.0283f, 4957.7734f,
+    5121.3306f, 5206.846f, 5274.217f, 5312.1777f, 5402.132f, 5358.33f,
+    1256.8516f, 1258.7916f, 1261.1798f, 1263.6758f, 1973.75f, 1294.1685f,
+    1352.0421f, 1301.8933f, 1454.52f, 1390.42f, 3421.86f, 1547.312f,
+    1845.75f, 1387.3633f, 2344.5132f, 4932.08f, 4199.737f, 3290.3228f,
+    3831.4006f, 4540.4404f, 4755.1797f, 4883.4688f, 4735.96f, 5005.705f,
+    4792.62f, 4719.874f, 5103.967f, 5172.55f, 4940.4736f, 5086.58f,
+    5222.1475f, 5284.5244f, 5360.8677f, 5405.9834f, 1257.0099f, 1264.5024f,
+    1259.7744f, 1262.694f, 1307.235f, 1612.6232f, 1283.583f, 1977.72f,
+    1419.0767f, 1752.136f, 1392.705f, 1286.628f, 2246.2576f, 1826.008f,
+    3351.7395f, 3721.7634f, 4190.106f, 4570.4395f, 3455.9434f, 4723.761f,
+    4879.947f, 2501.9075f, 5001.672f, 4708.7925f, 5106.9775f, 5203.1343f,
+    5253.8027f, 5317.4624f, 5389.5103f, 1258.2233f, 1279.5072f, 2189.5278f,
+    1278.2267f, 2032.9667f, 1398.2332f, 2423.5178f, 1890.8578f, 3633.24f,
+    3133.394f, 4201.008f, 4517.295f, 4629.973f, 4017.9412f, 4763.3413f,
+    5115.3027f, 4887.0137f, 4637.1323f, 5089.446f, 4647.4375f, 4887.108f,
+    5096.619f, 5192.388f, 5247.635f, 5228.0903f, 5271.89f, 5287.2886f,
+    5324.3276f, 5370.3716f, 5404.3184f, 1257.2346f, 1263.2458f, 1299.86f,
+    1281.29f, 1286.0012f, 1464.4395f, 1633.3434f, 1417.3137f, 2100.1213f,
+    2611.4177f, 4529.91f, 3666.5684f, 3946.453f, 4575.0513f, 4114.414f,
+    4779.279f, 1287.548f, 5159.24f, 4914.272f, 5019.436f, 5137.976f,
+    4489.47f, 4793.1567f, 5128.238f, 5225.9585f, 5282.0513f, 5337.6826f,
+    5394.1553f, 1257.4016f, 1261.811f, 1550.9054f, 1279.6787f, 2259.615f,
+    1314.1873f, 1382.5657f, 1621.6417f, 1435.0155f, 2576.783f, 3523.605f,
+    3574.3428f, 4284.19f, 4413.3906f, 4572.4067f, 4715.031f, 4908.027f,
+    5045.2466f, 3986.565f, 4796.6626f, 5117.841f, 5209.363f, 5301.2827f,
+    5389.703f, 1258.8027f, 1212.4414f, 2085.625f, 1286.657f, 1871.95f,
+    1351.3623f, 1431.625f, 1489.01f, 2782.3557f, 2146.42f, 3407.93f,
+    1287.39f, 2598.9534f, 3260.84f, 3823.6772f, 4220.595f, 2888.43f,
+    4494.374f, 4639.168f, 4783.961f, 1304.9475f, 4938.988f, 4547.211f,
+    5063.8228f, 4807.885f, 5162.5356f, 5066.14f, 5223.488f, 5255.513f,
+    5303.1523f, 5342.97f, 5381.781f, 5420.634f, 1258.2673f, 1291.4012f,
+    2436.9146f, 1286.1333f, 2001.87f, 1370.389f, 1638.8125f, 2718.7625f,
+    2222.2224f, 4848.39f, 4230.158f, 3402.97f, 3908.35f, 4574.296f,
+    4140.296f, 4786.983f, 1287.7775f, 4986.44f, 4842.9653f, 5100.5063f,
+    4921.9443f, 5203.6855f, 5231.1963f, 5254.1226f, 5274.8438f, 5344.933f,
+    5297.959f, 5363.1753f, 5404.711f, 1257.2396f, 1261.8755f, 2565.4387f,
+    1305.1749f, 1474.1385f, 2244.7324f, 2847.22f, 1940.172f, 3408.7637f,
+    3913.92f, 4242.1377f, 4969.168f, 4574.2236f, 4773.004f, 3531.745f,
+    4877.7305f, 4933.226f, 5111.991f, 5001.999f, 4573.794f, 4818.682f,
+    5119.892f, 5217.373f, 5271.037f, 5336.0537f, 5395.0435f, 1258.071f,
+    1206.0846f, 1714.3625f, 1288.0388f, 1526.0823f, 1397.3536f, 2817.97f,
+    3880.7466f, 4869.757f, 4186.507f, 3814.714f, 4202.8613f, 4546.232f,
+    4742.835f, 4876.582f, 4958.1436f, 5005.1206f, 5094.09f, 4852.87f,
+    5151.5825f, 5016.968f, 5199.7534f, 5235.473f, 5307.063f, 5345.1235f,
+    5428.88f, 5389.4224f, 1258.221f, 1285.4875f, 1148.8491f, 1265.566f,
+    1762.06f, 1296.0947f, 1438.49f, 2753.1387f, 3843.1033f, 3495.3684f,
+    4214.1714f, 4024.2166f, 4536.627f, 4770.9424f, 4867.081f, 4954.21f,
+    5115.5264f, 4991.915f, 4515.872f, 4805.068f, 5187.992f, 5103.229f,
+    5224.0894f, 5294.289f, 5354.599f, 5403.6943f, 1258.2947f, 1194.25f,
+    1714.5537f, 1280.9302f, 1702.6415f, 1315.1656f, 1382.3069f, 1488.855f,
+    5100.225f, 2377.43f, 3604.3616f, 3852.872f, 4395.792f, 4594.488f,
+    4772.011f, 1292.2267f, 4930.7505f, 4746.7446f, 5065.615f, 4305.555f,
+    5186.7114f, 5231.768f, 5330.335f, 5396.616f, 1258.5304f, 1294.111f,
+    3822.88f, 1291.6271f, 1377.782f, 1857.231f, 1273.4f, 4359.166f,
+    3677.7583f, 4096.6772f, 4549.232f, 4905.713f, 4739.768f, 1311.0533f,
+    3580.892f, 4897.3594f, 4668.04f, 5019.2915f, 4806.861f, 5120.624f,
+    4994.403f, 5195.6465f, 5079.365f, 5224.6084f, 5268.3906f, 5310.594f,
+    5355.347f, 5430.096f, 5397.8833f, 1256.8523f, 1258.8628f, 1282.05f,
+    1262.0693f, 1296.1151f, 1451.8475f, 4832.569f, 4003.054f, 2610.23f,
+    3811.4722f, 5157.2f, 4421.549f, 4596.6787f, 4636.75f, 1698.9357f,
+    4572.038f, 1297.6975f, 4729.5737f, 5162.545f, 4858.639f, 1375.915f,
+    3410.56f, 4980.3286f, 5104.528f, 5186.7114f, 5234.92f, 5317.46f,
+    5377.892f,
+};
+
+const EPS_ForestF32 eps_voltage_forest_f32 = {
+    .n_features = 5,
+    .n_trees = 50,
+    .n_nodes = 2348,
+    .n_leaves = 1525,
+    .scale = 0.02f,
+    .roots = voltage_roots,
+    .feature = voltage_feature,
+    .threshold = voltage_f32_threshold,
+    .children = voltage_children,
+    .leaf_value = voltage_f32_leaf_value,
+};
+
+float eps_model_voltage_score_f32(const float *x) {
+    return eps_forest_f32_score(&eps_voltage_forest_f32, x);
 }
+
+void eps_model_voltage_score_batch_f32(const float x[][EPS_MODEL_VOLTAGE_N_FEATURES], float *out, int n) {
+    eps_forest_f32_score_batch(&eps_voltage_forest_f32, &x[0][0], EPS_MODEL_VOLTAGE_N_FEATURES, out, n);
+}
+
+#endif
+
+#if EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_QUICKSCORER)
+
+static const uint16_t voltage_qs_feature_offset[6] = {
+    0, 1012, 1251, 1565, 2023, 2348,
+};
+
+static const double voltage_qs_threshold[2348] = {
+    627.2899780273438, 627.2899780273438, 627.2899780273438, 627.2899780273438,
+    627.2899780273438, 627.2899780273438, 627.2899780273438, 627.2899780273438,
+    627.2899780273438, 627.2899780273438, 627.2899780273438, 627.2899780273438,
+    627.2899780273438, 627.2899780273438, 627.2899780273438, 627.2899780273438,
+    627.2899780273438, 627.2899780273438, 627.2899780273438, 627.2899780273438,
+    627.2899780273438, 627.2899780273438, 627.2899780273438, 627.2899780273438,
+    627.2899780273438, 627.2899780273438, 627.2899780273438, 627.2899780273438,
+    627.2899780273438, 628.0549926757812, 628.0549926757812, 1256.8699951171875,
+    1256.8699951171875, 1258.39501953125, 1258.39501953125, 1258.39501953125,
+    1258.39501953125, 1258.39501953125, 1258.39501953125, 1258.39501953125,
+    1258.39501953125, 1258.39501953125, 1258.39501953125, 1258.39501953125,
+    1259.9200439453125, 1259.9200439453125, 1259.9200439453125, 1259.9200439453125,
+    1259.9200439453125, 1259.9200439453125, 1259.9200439453125, 1259.9200439453125,
+    1259.9200439453125, 1259.9200439453125, 1259.9200439453125, 1259.9200439453125,
+    1259.9200439453125, 1259.9200439453125, 1259.9200439453125, 1259.9200439453125,
+    1259.9200439453125, 1259.9200439453125, 1259.9200439453125, 1259.9200439453125,
+    1259.9200439453125, 1259.9200439453125, 1259.9200439453125, 1261.4450073242188,
+    1261.4450073242188, 1261.4450073242188, 1261.4450073242188, 1261.4450073242188,
+    1261.4450073242188, 1261.4450073242188, 1262.2100219726562, 1262.9749755859375,
+    1264.5, 1264.5, 1264.5, 1264.5,
+    1264.5, 1264.5, 1264.5, 1264.5,
+    1264.5, 1264.5, 1264.5, 1264.5,
+    1264.5, 1264.5, 1264.5, 1264.5,
+    1264.5, 1264.5, 1264.5, 1264.5,
+    1265.2650146484375, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1269.0799560546875, 1275.1849975585938, 1275.9450073242188, 1279.0,
+    1279.0, 1279.0, 1279.0, 1279.0,
+    1279.0, 1279.0, 1279.0, 1282.050048828125,
+    1284.3399658203125, 1284.3399658203125, 1284.3399658203125, 1284.3399658203125,
+    1285.10498046875, 1286.6300048828125, 1288.155029296875, 1288.9200439453125,
+    1288.9200439453125, 1296.550048828125, 1299.6050415039062, 1301.1300048828125,
+    1312.5750122070312, 1312.5750122070312, 1312.5750122070312, 1312.5750122070312,
+    1312.5750122070312, 1312.5750122070312, 1312.5750122070312, 1312.5750122070312,
+    1314.864990234375, 1320.2050170898438, 1331.6549682617188, 1332.4149780273438,
+    1332.4149780273438, 1332.4149780273438, 1332.4149780273438, 1332.4149780273438,
+    1332.4199829101562, 1333.1799926757812, 1333.1799926757812, 1333.1799926757812,
+    1333.1799926757812, 1333.1799926757812, 1333.1799926757812, 1333.1799926757812,
+    1333.1799926757812, 1333.1799926757812, 1333.1799926757812, 1333.1799926757812,
+    1333.1799926757812, 1333.1799926757812, 1333.1799926757812, 1333.1799926757812,
+    1333.1799926757812, 1333.1799926757812, 1333.9450073242188, 1333.9450073242188,
+    1333.9450073242188, 1333.9450073242188, 1336.9949951171875, 1351.5,
+    1352.260009765625, 1352.260009765625, 1370.5750122070312, 1370.5750122070312,
+    1386.5999755859375, 1394.9949951171875, 1406.4400024414062, 1406.4400024414062,
+    1406.4400024414062, 1406.4400024414062, 1406.4400024414062, 1409.4950561523438,
+    1409.4950561523438, 1409.4950561523438, 1418.6499633789062, 1420.9400024414062,
+    1420.9400024414062, 1423.989990234375, 1425.52001953125, 1427.0449829101562,
+    1430.8599853515625, 1430.8599853515625, 1430.8599853515625, 1430.8599853515625,
+    1430.8599853515625, 1430.8599853515625, 1430.8599853515625, 1430.8599853515625,
+    1430.8599853515625, 1430.8599853515625, 1433.9149780273438, 1433.9149780273438,
+    1433.9149780273438, 1433.9149780273438, 1433.9149780273438, 1433.9149780273438,
+    1433.9149780273438, 1433.9149780273438, 1433.9149780273438, 1433.9149780273438,
+    1452.22998046875, 1455.2799682617188, 1456.0449829101562, 1465.9649658203125,
+    1465.9649658203125, 1465.9649658203125, 1465.9649658203125, 1465.9649658203125,
+    1465.9649658203125, 1465.9649658203125, 1465.9649658203125, 1465.9649658203125,
+    1465.9649658203125, 1465.9649658203125, 1469.0149536132812, 1469.7799682617188,
+    1469.7799682617188, 1469.7799682617188, 1469.7799682617188, 1469.7799682617188,
+    1475.1199951171875, 1495.7250366210938, 1498.780029296875, 1498.780029296875,
+    1498.780029296875, 1498.780029296875, 1498.780029296875, 1509.4600219726562,
+    1512.5150146484375, 1512.5150146484375, 1520.14501953125, 1520.14501953125,
+    1523.9650268554688, 1539.2249755859375, 1567.4600219726562, 1571.2749633789062,
+    1581.1950073242188, 1585.0150146484375, 1588.824951171875, 1588.824951171875,
+    1588.824951171875, 1588.824951171875, 1592.64501953125, 1592.64501953125,
+    1592.64501953125, 1620.8800048828125, 1620.8800048828125, 1620.8800048828125,
+    1620.8800048828125, 1620.8800048828125, 1620.8800048828125, 1620.8800048828125,
+    1620.8800048828125, 1620.8800048828125, 1630.7999877929688, 1630.7999877929688,
+    1630.7999877929688, 1630.7999877929688, 1630.7999877929688, 1659.0349731445312,
+    1659.0349731445312, 1659.0349731445312, 1659.0349731445312, 1659.0349731445312,
+    1659.0349731445312, 1666.6649780273438, 1666.6649780273438, 1666.6649780273438,
+    1666.6649780273438, 1666.6649780273438, 1666.6649780273438, 1666.6649780273438,
+    1666.6649780273438, 1666.6649780273438, 1666.6649780273438, 1666.6649780273438,
+    1666.6649780273438, 1666.6649780273438, 1723.905029296875, 1730.0049438476562,
+    1730.0049438476562, 1730.0049438476562, 1730.0049438476562, 1730.0049438476562,
+    1730.0049438476562, 1730.0049438476562, 1730.0049438476562, 1730.0049438476562,
+    1730.0049438476562, 1752.1400146484375, 1797.9249877929688, 1797.9249877929688,
+    1797.9249877929688, 1797.9249877929688, 1797.9249877929688, 1816.239990234375,
+    1816.239990234375, 1816.239990234375, 1816.239990234375, 1823.1099853515625,
+    1823.1099853515625, 1823.1099853515625, 1841.4249877929688, 1849.81494140625,
+    1878.8150024414062, 1878.8150024414062, 1878.8150024414062, 1878.8150024414062,
+    1909.3450317382812, 1909.3450317382812, 1909.3450317382812, 1909.3450317382812,
+    1909.3450317382812, 1917.7349853515625, 1917.7349853515625, 1962.760009765625,
+    1990.2350463867188, 1990.2350463867188, 1992.5199584960938, 2013.125,
+    2062.7249755859375, 2100.1199951171875, 2131.4100341796875, 2131.4100341796875,
+    2131.4100341796875, 2131.4100341796875, 2131.4100341796875, 2131.4100341796875,
+    2154.3050537109375, 2168.8050537109375, 2178.7249755859375, 2178.7249755859375,
+    2197.0399780273438, 2259.614990234375, 2284.0350341796875, 2284.0350341796875,
+    2284.0350341796875, 2284.0350341796875, 2284.0350341796875, 2293.9549560546875,
+    2295.47998046875, 2312.2698974609375, 2313.7950439453125, 2377.135009765625,
+    2395.449951171875, 2395.449951171875, 2395.449951171875, 2395.449951171875,
+    2407.659912109375, 2407.659912109375, 2419.1099853515625, 2453.449951171875,
+    2453.449951171875, 2499.2349853515625, 2560.2900390625, 2560.2900390625,
+    2560.2900390625, 2560.2900390625, 2560.2900390625, 2560.2900390625,
+    2620.574951171875, 2620.574951171875, 2679.3349609375, 2739.625,
+    2799.909912109375, 2799.909912109375, 2799.909912109375, 2847.219970703125,
+    2858.669921875, 2865.5399169921875, 2865.5399169921875, 2865.5399169921875,
+    2865.5399169921875, 2865.5399169921875, 2865.5399169921875, 2865.5399169921875,
+    2865.5399169921875, 2865.5399169921875, 2865.5399169921875, 2896.0599365234375,
+    2902.929931640625, 2902.929931640625, 2902.929931640625, 2902.929931640625,
+    2902.929931640625, 2902.929931640625, 2905.97998046875, 2912.8499755859375,
+    2912.8499755859375, 2912.8499755859375, 2954.0599365234375, 3031.135009765625,
+    3078.449951171875, 3078.449951171875, 3078.449951171875, 3078.449951171875,
+    3078.449951171875, 3078.449951171875, 3078.449951171875, 3079.2099609375,
+    3099.054931640625, 3099.054931640625, 3099.054931640625, 3170.784912109375,
+    3183.7598876953125, 3193.6849365234375, 3204.364990234375, 3218.0999755859375,
+    3308.9149169921875, 3308.9149169921875, 3308.9149169921875, 3308.9149169921875,
+    3321.8900146484375, 3332.5699462890625, 3349.3599853515625, 3351.6500244140625,
+    3363.094970703125, 3415.75, 3419.570068359375, 3419.570068359375,
+    3419.570068359375, 3419.570068359375, 3419.570068359375, 3419.570068359375,
+    3419.570068359375, 3419.570068359375, 3419.570068359375, 3431.0150146484375,
+    3431.0150146484375, 3431.780029296875, 3431.780029296875, 3433.3050537109375,
+    3433.3050537109375, 3530.97998046875, 3530.97998046875, 3578.294921875,
+    3578.294921875, 3597.375, 3597.375, 3704.9749755859375,
+    3736.2650146484375, 3736.2650146484375, 3771.364990234375, 3824.02001953125,
+    3851.4949951171875, 3898.0499267578125, 3936.2049560546875, 3985.0450439453125,
+    3985.0450439453125, 3985.0450439453125, 3985.0450439453125, 3985.0450439453125,
+    3995.7249755859375, 4002.594970703125, 4010.22998046875, 4079.669921875,
+    4087.300048828125, 4087.300048828125, 4087.300048828125, 4087.300048828125,
+    4087.300048828125, 4087.300048828125, 4144.53515625, 4144.53515625,
+    4144.53515625, 4177.35498046875, 4177.35498046875, 4177.35498046875,
+    4243.739990234375, 4243.739990234375, 4243.739990234375, 4243.739990234375,
+    4252.135009765625, 4252.135009765625, 4262.054931640625, 4272.739990234375,
+    4272.739990234375, 4272.739990234375, 4291.81494140625, 4291.81494140625,
+    4291.81494140625, 4297.159912109375, 4297.159912109375, 4297.159912109375,
+    4297.159912109375, 4297.159912109375, 4297.159912109375, 4297.159912109375,
+    4297.159912109375, 4297.159912109375, 4297.159912109375, 4297.919921875,
+    4298.68505859375, 4303.264892578125, 4303.264892578125, 4303.264892578125,
+    4303.264892578125, 4303.264892578125, 4303.264892578125, 4304.02490234375,
+    4304.02490234375, 4423.83984375, 4457.4150390625, 4498.6298828125,
+    4508.544921875, 4524.570068359375, 4527.625, 4528.385009765625,
+    4528.385009765625, 4528.385009765625, 4528.385009765625, 4530.675048828125,
+    4530.675048828125, 4530.675048828125, 4530.675048828125, 4530.675048828125,
+    4530.675048828125, 4531.440185546875, 4531.440185546875, 4531.440185546875,
+    4533.72998046875, 4533.72998046875, 4533.72998046875, 4547.465087890625,
+    4556.625, 4582.570068359375, 4609.280029296875, 4609.280029296875,
+    4638.27490234375, 4638.27490234375, 4639.039794921875, 4663.4599609375,
+    4667.27490234375, 4668.039794921875, 4668.039794921875, 4668.039794921875,
+    4668.039794921875, 4668.039794921875, 4668.039794921875, 4669.56494140625,
+    4669.56494140625, 4669.56494140625, 4669.56494140625, 4669.56494140625,
+    4669.56494140625, 4669.56494140625, 4669.56494140625, 4669.56494140625,
+    4672.619873046875, 4672.619873046875, 4672.619873046875, 4672.619873046875,
+    4672.6201171875, 4676.43505859375, 4677.2001953125, 4678.72509765625,
+    4685.594970703125, 4685.594970703125, 4685.594970703125, 4688.64501953125,
+    4688.64501953125, 4688.64501953125, 4688.64501953125, 4688.64501953125,
+    4688.64501953125, 4688.64501953125, 4688.64501953125, 4688.64501953125,
+    4688.64501953125, 4688.64501953125, 4688.64501953125, 4689.41015625,
+    4689.41015625, 4689.41015625, 4689.41015625, 4689.41015625,
+    4689.41015625, 4690.93505859375, 4690.93505859375, 4690.93505859375,
+    4690.93505859375, 4692.4599609375, 4696.27490234375, 4696.27490234375,
+    4696.27490234375, 4700.090087890625, 4703.905029296875, 4704.670166015625,
+    4708.48486328125, 4709.25, 4709.25, 4731.3798828125,
+    4734.43505859375, 4740.5400390625, 4750.454833984375, 4750.454833984375,
+    4754.27490234375, 4758.85498046875, 4760.3798828125, 4763.429931640625,
+    4763.429931640625, 4775.639892578125, 4775.639892578125, 4775.639892578125,
+    4775.639892578125, 4776.39990234375, 4777.929931640625, 4780.21484375,
+    4780.98486328125, 4781.744873046875, 4785.559814453125, 4787.090087890625,
+    4787.849853515625, 4787.849853515625, 4797.77001953125, 4797.77001953125,
+    4797.77001953125, 4822.190185546875, 4822.190185546875, 4822.190185546875,
+    4822.190185546875, 4822.195068359375, 4824.47998046875, 4824.47998046875,
+    4824.47998046875, 4824.47998046875, 4824.47998046875, 4825.2451171875,
+    4825.2451171875, 4853.47998046875, 4857.294921875, 4857.294921875,
+    4857.294921875, 4858.059814453125, 4858.059814453125, 4858.824951171875,
+    4858.824951171875, 4858.824951171875, 4858.824951171875, 4863.400146484375,
+    4863.400146484375, 4863.400146484375, 4863.400146484375, 4863.400146484375,
+    4863.400146484375, 4863.400146484375, 4864.1650390625, 4864.1650390625,
+    4864.1650390625, 4864.1650390625, 4864.93017578125, 4877.14013671875,
+    4877.14013671875, 4892.400146484375, 4892.400146484375, 4892.400146484375,
+    4892.400146484375, 4892.400146484375, 4892.400146484375, 4892.400146484375,
+    4892.400146484375, 4892.400146484375, 4893.1650390625, 4893.1650390625,
+    4893.1650390625, 4893.1650390625, 4897.7451171875, 4897.7451171875,
+    4900.030029296875, 4902.320068359375, 4902.320068359375, 4902.320068359375,
+    4902.320068359375, 4902.320068359375, 4903.0849609375, 4903.0849609375,
+    4903.0849609375, 4905.369873046875, 4905.369873046875, 4905.369873046875,
+    4907.659912109375, 4907.659912109375, 4907.659912109375, 4907.659912109375,
+    4914.530029296875, 4914.530029296875, 4916.820068359375, 4925.974853515625,
+    4931.31494140625, 4931.31494140625, 4932.079833984375, 4932.079833984375,
+    4934.3701171875, 4938.18505859375, 4938.18505859375, 4938.18505859375,
+    4943.52490234375, 4945.81494140625, 4947.344970703125, 4947.344970703125,
+    4948.869873046875, 4958.02490234375, 4971.76513671875, 4976.344970703125,
+    4979.39501953125, 4980.920166015625, 4980.920166015625, 4986.264892578125,
+    4994.655029296875, 4997.710205078125, 4998.474853515625, 4998.47509765625,
+    4999.235107421875, 4999.239990234375, 4999.239990234375, 5000.764892578125,
+    5000.764892578125, 5008.39501953125, 5014.5, 5038.920166015625,
+    5040.445068359375, 5040.445068359375, 5044.260009765625, 5048.074951171875,
+    5048.074951171875, 5052.655029296875, 5052.655029296875, 5052.655029296875,
+    5052.655029296875, 5053.420166015625, 5054.945068359375, 5057.235107421875,
+    5057.235107421875, 5057.235107421875, 5057.235107421875, 5057.235107421875,
+    5062.5751953125, 5062.5751953125, 5069.445068359375, 5069.445068359375,
+    5069.445068359375, 5069.445068359375, 5069.445068359375, 5069.445068359375,
+    5069.445068359375, 5070.969970703125, 5070.969970703125, 5070.969970703125,
+    5070.969970703125, 5070.969970703125, 5070.969970703125, 5070.969970703125,
+    5070.969970703125, 5072.5, 5072.5, 5072.5,
+    5073.260009765625, 5073.260009765625, 5075.550048828125, 5078.60009765625,
+    5083.18017578125, 5083.945068359375, 5086.235107421875, 5086.235107421875,
+    5099.969970703125, 5099.969970703125, 5099.969970703125, 5099.969970703125,
+    5110.655029296875, 5110.655029296875, 5121.3349609375, 5122.85986328125,
+    5125.9150390625, 5125.9150390625, 5125.9150390625, 5127.43994140625,
+    5127.445068359375, 5127.445068359375, 5127.445068359375, 5132.019775390625,
+    5144.9951171875, 5144.9951171875, 5153.39013671875, 5156.440185546875,
+    5156.440185546875, 5170.175048828125, 5178.574951171875, 5181.625,
+    5181.625, 5181.625, 5181.625, 5181.625,
+    5181.625, 5181.625, 5181.625, 5181.625,
+    5182.385009765625, 5182.385009765625, 5182.385009765625, 5182.385009765625,
+    5182.385009765625, 5182.385009765625, 5182.385009765625, 5182.385009765625,
+    5182.385009765625, 5182.385009765625, 5182.385009765625, 5182.385009765625,
+    5182.385009765625, 5182.385009765625, 5182.385009765625, 5182.385009765625,
+    5182.385009765625, 5182.385009765625, 5182.385009765625, 5182.39013671875,
+    5183.150146484375, 5183.150146484375, 5184.675048828125, 5197.650146484375,
+    5197.650146484375, 5204.51513671875, 5204.51513671875, 5204.51513671875,
+    5204.51513671875, 5204.51513671875, 5204.51513671875, 5204.51513671875,
+    5204.51513671875, 5204.51513671875, 5204.51513671875, 5204.51513671875,
+    5204.51513671875, 5204.51513671875, 5204.51513671875, 5204.51513671875,
+    5208.3349609375, 5210.625, 5210.625, 5210.625,
+    5211.385009765625, 5211.385009765625, 5211.385009765625, 5211.39013671875,
+    5214.440185546875, 5217.489990234375, 5217.489990234375, 5217.489990234375,
+    5217.489990234375, 5217.489990234375, 5217.489990234375, 5217.489990234375,
+    5217.489990234375, 5217.489990234375, 5217.489990234375, 5217.489990234375,
+    5217.489990234375, 5217.489990234375, 5217.489990234375, 5219.02001953125,
+    5222.8349609375, 5226.650146484375, 5228.175048828125, 5228.175048828125,
+    5254.885009765625, 5256.41015625, 5256.41015625, 5256.41015625,
+    5257.175048828125, 5257.175048828125, 5258.699951171875, 5258.7001953125,
+    5258.7001953125, 5258.7001953125, 5258.7001953125, 5262.51513671875,
+    5262.51513671875, 5264.80517578125, 5266.330078125, 5266.330078125,
+    5267.85498046875, 5267.85498046875, 5267.85498046875, 5269.3798828125,
+    5275.489990234375, 5275.489990234375, 5275.489990234375, 5275.489990234375,
+    5275.489990234375, 5275.489990234375, 5275.489990234375, 5275.489990234375,
+    5275.489990234375, 5275.489990234375, 5275.489990234375, 5276.2548828125,
+    5276.2548828125, 5276.2548828125, 5276.2548828125, 5282.35498046875,
+    5286.93505859375, 5288.4599609375, 5288.4599609375, 5288.4599609375,
+    5288.4599609375, 5288.4599609375, 5288.4599609375, 5289.22509765625,
+    5289.22509765625, 5289.98486328125, 5289.98486328125, 5289.98486328125,
+    5289.98486328125, 5289.98486328125, 5289.98486328125, 5289.98486328125,
+    5290.75, 5290.75, 5290.75, 5290.75,
+    5290.75, 5290.75, 5290.75, 5291.514892578125,
+    5291.514892578125, 5291.514892578125, 5293.0400390625, 5296.094970703125,
+    5299.14501953125, 5299.14501953125, 5299.14501953125, 5306.014892578125,
+    5306.014892578125, 5306.014892578125, 5306.014892578125, 5306.014892578125,
+    5309.829833984375, 5309.829833984375, 5309.829833984375, 5309.829833984375,
+    5309.829833984375, 5309.829833984375, 5324.330078125, 5324.330078125,
+    5324.330078125, 5324.330078125, 5324.330078125, 5326.6201171875,
+    5336.5400390625, 5337.30517578125, 5338.065185546875, 5339.58984375,
+    5339.58984375, 5339.58984375, 5339.58984375, 5340.35498046875,
+    5340.35498046875, 5340.35498046875, 5340.35498046875, 5340.35498046875,
+    5340.35498046875, 5340.35498046875, 5340.35498046875, 5340.35498046875,
+    5341.114990234375, 5341.114990234375, 5342.64501953125, 5342.64501953125,
+    5342.64501953125, 5342.64501953125, 5342.64501953125, 5342.64501953125,
+    5342.64501953125, 5342.64501953125, 5343.405029296875, 5343.405029296875,
+    5343.405029296875, 5354.85009765625, 5355.614990234375, 5358.670166015625,
+    5358.670166015625, 5358.670166015625, 5358.670166015625, 5358.670166015625,
+    5358.670166015625, 5367.824951171875, 5369.35498046875, 5369.35498046875,
+    5383.090087890625, 5383.85009765625, 5390.719970703125, 5408.27001953125,
+    1256.8699951171875, 1256.8699951171875, 1260.6849975585938, 1260.6849975585938,
+    1261.4450073242188, 1261.4450073242188, 1262.2100219726562, 1262.2100219726562,
+    1266.0250244140625, 1280.5250244140625, 1291.9700317382812, 1291.9700317382812,
+    1291.9700317382812, 1291.9700317382812, 1292.7350463867188, 1295.0249633789062,
+    1301.8900146484375, 1304.1799926757812, 1307.9949951171875, 1311.8150024414062,
+    1315.6300048828125, 1321.7349853515625, 1322.5, 1322.5,
+    1324.7849731445312, 1350.7349853515625, 1354.5449829101562, 1354.5449829101562,
+    1355.3099975585938, 1355.3099975585938, 1375.9150390625, 1389.6549682617188,
+    1389.6549682617188, 1403.3849487304688, 1403.3849487304688, 1404.1549682617188,
+    1404.1549682617188, 1406.4400024414062, 1410.2550048828125, 1419.4150390625,
+    1419.4150390625, 1419.4150390625, 1423.989990234375, 1433.1500244140625,
+    1452.22998046875, 1452.22998046875, 1452.22998046875, 1452.22998046875,
+    1452.22998046875, 1452.22998046875, 1455.2799682617188, 1469.7799682617188,
+    1520.1449584960938, 1531.5950317382812, 1550.6699829101562, 1585.0150146484375,
+    1585.7749633789062, 1610.9599609375, 1619.3499755859375, 1708.6349487304688,
+    1823.1099853515625, 1823.1099853515625, 1918.5, 1969.6249389648438,
+    1986.4200439453125, 1986.4200439453125, 1990.2350463867188, 1992.5199584960938,
+    1992.5199584960938, 1992.5199584960938, 2013.125, 2036.02001953125,
+    2091.7300415039062, 2128.35498046875, 2131.4100341796875, 2154.3050537109375,
+    2178.7249755859375, 2228.324951171875, 2259.614990234375, 2293.9549560546875,
+    2377.135009765625, 2545.02490234375, 2622.864990234375, 2633.544921875,
+    2806.780029296875, 2867.06494140625, 2995.2649536132812, 3037.239990234375,
+    3055.554931640625, 3099.054931640625, 3172.3098754882812, 3172.3098754882812,
+    3172.3098754882812, 3183.760009765625, 3183.760009765625, 3208.9400024414062,
+    3208.9400024414062, 3208.9400024414062, 3208.9400024414062, 3208.9400024414062,
+    3208.9400024414062, 3208.9400024414062, 3279.1499633789062, 3321.8850708007812,
+    3704.9749755859375, 3704.9749755859375, 3812.5799560546875, 3917.1251220703125,
+    3974.35986328125, 4043.0399169921875, 4043.0399169921875, 4043.0399169921875,
+    4043.0399169921875, 4043.0399169921875, 4043.0399169921875, 4043.0399169921875,
+    4072.0399169921875, 4090.349853515625, 4090.349853515625, 4144.53515625,
+    4153.695068359375, 4250.610107421875, 4271.21484375, 4334.554931640625,
+    4350.580078125, 4388.73486328125, 4394.840087890625, 4394.840087890625,
+    4413.9150390625, 4413.9150390625, 4413.9150390625, 4498.6298828125,
+    4513.125, 4548.22998046875, 4579.51513671875, 4579.51513671875,
+    4657.35498046875, 4657.35498046875, 4668.804931640625, 4685.594970703125,
+    4685.594970703125, 4685.594970703125, 4697.7998046875, 4697.7998046875,
+    4736.724853515625, 4774.114990234375, 4802.349853515625, 4803.8798828125,
+    4803.8798828125, 4803.8798828125, 4841.27001953125, 4858.824951171875,
+    4858.824951171875, 4877.14013671875, 4877.14013671875, 4877.14013671875,
+    4892.39990234375, 4892.39990234375, 4892.39990234375, 4892.39990234375,
+    4892.39990234375, 4892.39990234375, 4911.47998046875, 4916.820068359375,
+    4916.820068359375, 4921.39501953125, 4921.39501953125, 4921.39501953125,
+    4921.39501953125, 4921.39501953125, 4921.39501953125, 4927.5,
+    4927.5, 4935.1298828125, 4935.1298828125, 4935.89501953125,
+    4935.89501953125, 4943.52490234375, 4943.52490234375, 4943.52490234375,
+    4946.580078125, 4949.6298828125, 4960.31494140625, 4962.60986328125,
+    4967.184814453125, 4967.184814453125, 4970.23486328125, 4970.239990234375,
+    4970.239990234375, 4970.239990234375, 4970.239990234375, 4970.239990234375,
+    4970.239990234375, 4970.239990234375, 4970.239990234375, 4970.239990234375,
+    4970.239990234375, 4970.239990234375, 4970.239990234375, 4970.239990234375,
+    4970.239990234375, 4990.844970703125, 4990.844970703125, 4991.60498046875,
+    4992.3701171875, 5000.0, 5000.0, 5000.0,
+    5000.0, 5001.525146484375, 5006.10498046875, 5006.864990234375,
+    5023.659912109375, 5070.969970703125, 5075.550048828125, 5077.0751953125,
+    5092.340087890625, 5092.340087890625, 5101.494873046875, 5240.385009765625,
+    5254.885009765625, 5256.41015625, 5257.175048828125, 5258.7001953125,
+    5282.35498046875, 5282.35498046875, 5286.93505859375, 5289.98486328125,
+    5289.98486328125, 5309.829833984375, 5309.829833984375, 5317.4599609375,
+    5342.64501953125, 5355.614990234375, 5358.670166015625, 5368.590087890625,
+    5379.275146484375, 5402.169921875, 5402.169921875, 1258.39501953125,
+    1258.39501953125, 1258.39501953125, 1258.39501953125, 1258.39501953125,
+    1258.39501953125, 1258.39501953125, 1258.39501953125, 1258.39501953125,
+    1258.39501953125, 1258.39501953125, 1259.155029296875, 1259.155029296875,
+    1259.155029296875, 1259.9199829101562, 1260.6849975585938, 1261.4450073242188,
+    1261.4450073242188, 1262.2100219726562, 1264.5, 1264.5,
+    1264.5, 1264.5, 1264.5, 1264.5,
+    1264.5, 1264.5, 1264.5, 1264.5,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1275.1800537109375, 1278.2350463867188,
+    1282.050048828125, 1282.050048828125, 1285.864990234375, 1285.864990234375,
+    1285.864990234375, 1290.4450073242188, 1290.4450073242188, 1290.4450073242188,
+    1291.9700317382812, 1291.9700317382812, 1291.9700317382812, 1291.9700317382812,
+    1291.9700317382812, 1294.260009765625, 1295.7849731445312, 1298.0750122070312,
+    1300.364990234375, 1300.364990234375, 1300.364990234375, 1300.364990234375,
+    1302.655029296875, 1302.655029296875, 1302.655029296875, 1304.1799926757812,
+    1304.9450073242188, 1304.9450073242188, 1304.9450073242188, 1307.9949951171875,
+    1307.9949951171875, 1307.9949951171875, 1308.760009765625, 1308.760009765625,
+    1311.0499877929688, 1311.8099975585938, 1311.8099975585938, 1314.0999755859375,
+    1317.9199829101562, 1317.9199829101562, 1317.9199829101562, 1317.9199829101562,
+    1318.6799926757812, 1318.6799926757812, 1322.5, 1322.5,
+    1324.7849731445312, 1324.7849731445312, 1324.7849731445312, 1324.7849731445312,
+    1326.3099975585938, 1326.3150024414062, 1327.8399658203125, 1327.8399658203125,
+    1327.8399658203125, 1334.7049560546875, 1334.7049560546875, 1334.7049560546875,
+    1334.7049560546875, 1334.7049560546875, 1337.7599487304688, 1337.7599487304688,
+    1337.7599487304688, 1338.5249633789062, 1338.5249633789062, 1338.5249633789062,
+    1338.5249633789062, 1338.5249633789062, 1338.5249633789062, 1344.625,
+    1344.625, 1353.7850341796875, 1358.364990234375, 1358.364990234375,
+    1358.364990234375, 1358.364990234375, 1358.364990234375, 1358.364990234375,
+    1376.6799926757812, 1377.4450073242188, 1377.4450073242188, 1380.4949951171875,
+    1393.469970703125, 1394.2300415039062, 1400.3349609375, 1402.6300048828125,
+    1410.2550048828125, 1410.2550048828125, 1423.989990234375, 1433.1499633789062,
+    1437.72998046875, 1437.72998046875, 1437.72998046875, 1437.72998046875,
+    1440.780029296875, 1452.22998046875, 1454.5150146484375, 1454.5150146484375,
+    1454.5150146484375, 1454.5150146484375, 1455.2799682617188, 1465.2000122070312,
+    1468.2550048828125, 1469.7799682617188, 1474.3600463867188, 1474.3600463867188,
+    1478.9400024414062, 1478.9400024414062, 1481.989990234375, 1485.8049926757812,
+    1495.7250366210938, 1501.8300170898438, 1501.8300170898438, 1520.9100341796875,
+    1520.9100341796875, 1520.9100341796875, 1520.9100341796875, 1520.9100341796875,
+    1531.5950317382812, 1547.6199951171875, 1565.1699829101562, 1581.1950073242188,
+    1619.3499755859375, 1630.7999877929688, 1644.5349731445312, 1712.4550170898438,
+    1893.3150024414062, 1992.5199584960938, 1992.5199584960938, 2036.02001953125,
+    2061.2050170898438, 2061.2050170898438, 2062.7249755859375, 2074.93994140625,
+    2074.93994140625, 2241.2999877929688, 2293.9549560546875, 2293.9549560546875,
+    2311.5050048828125, 2378.6600341796875, 2378.6600341796875, 2500.0,
+    2563.3400268554688, 2563.3400268554688, 2564.864990234375, 2574.784912109375,
+    2574.784912109375, 2574.784912109375, 2633.544921875, 2688.4949951171875,
+    2864.7750244140625, 2864.7750244140625, 2864.7750244140625, 3008.2400512695312,
+    3008.2400512695312, 3008.2400512695312, 3008.2400512695312, 3008.2400512695312,
+    3008.2400512695312, 3031.135009765625, 3037.239990234375, 3043.3450927734375,
+    3117.3650512695312, 3131.1050415039062, 3131.1050415039062, 3208.9400024414062,
+    3268.4649047851562, 3305.860107421875, 3305.860107421875, 3350.125,
+    3350.125, 3396.669921875, 3464.5899658203125, 3622.56005859375,
+    3790.445068359375, 3847.679931640625, 3906.4400634765625, 3964.4400634765625,
+    3984.280029296875, 4052.2000732421875, 4072.0399169921875, 4072.0399169921875,
+    4139.18994140625, 4425.369873046875, 4521.52001953125, 4574.175048828125,
+    4657.35498046875, 4658.8798828125, 4668.0400390625, 4680.25,
+    4681.01513671875, 4698.56494140625, 4698.56494140625, 4698.56494140625,
+    4698.56494140625, 4698.56494140625, 4698.56494140625, 4729.08984375,
+    4752.75, 4760.3798828125, 4794.719970703125, 4805.405029296875,
+    4877.14013671875, 4902.320068359375, 4921.39501953125, 4921.39501953125,
+    4921.39501953125, 4943.52490234375, 4943.52490234375, 4946.580078125,
+    4960.31494140625, 4980.925048828125, 4990.844970703125, 4991.60498046875,
+    4993.130126953125, 4993.130126953125, 5000.0, 5020.60498046875,
+    5028.235107421875, 5028.235107421875, 5032.050048828125, 5042.73486328125,
+    5058.764892578125, 5060.2900390625, 5060.2900390625, 5060.2900390625,
+    5062.5751953125, 5064.864990234375, 5066.394775390625, 5068.68017578125,
+    5069.445068359375, 5069.445068359375, 5069.445068359375, 5075.550048828125,
+    5075.550048828125, 5075.550048828125, 5076.31494140625, 5076.31494140625,
+    5077.0751953125, 5079.364990234375, 5079.364990234375, 5083.945068359375,
+    5088.52001953125, 5088.52001953125, 5103.02490234375, 5113.704833984375,
+    5138.125, 5139.64990234375, 5177.044921875, 5194.594970703125,
+    5194.594970703125, 5245.72998046875, 5248.02001953125, 5248.02001953125,
+    5286.93505859375, 5358.670166015625, 5367.824951171875, 5369.35498046875,
+    5370.880126953125, 5389.955078125, 5393.77490234375, 5396.824951171875,
+    5396.824951171875, 5396.824951171875, 5396.824951171875, 5396.824951171875,
+    5396.824951171875, 5399.114990234375, 5399.114990234375, 5399.114990234375,
+    5399.114990234375, 5399.114990234375, 5399.114990234375, 5399.114990234375,
+    5399.114990234375, 5399.114990234375, 5399.114990234375, 5399.114990234375,
+    5402.1650390625, 1256.8699951171875, 1256.8699951171875, 1256.8699951171875,
+    1256.8699951171875, 1256.8699951171875, 1256.8699951171875, 1256.8699951171875,
+    1256.8699951171875, 1258.39501953125, 1258.39501953125, 1259.155029296875,
+    1259.9199829101562, 1259.9199829101562, 1259.9199829101562, 1259.9199829101562,
+    1259.9199829101562, 1261.4450073242188, 1261.4450073242188, 1261.4450073242188,
+    1261.4450073242188, 1261.4450073242188, 1262.9749755859375, 1263.7350463867188,
+    1263.7350463867188, 1263.7350463867188, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.7899780273438, 1266.7899780273438, 1275.1800537109375,
+    1275.9450073242188, 1276.7100219726562, 1276.7100219726562, 1276.7100219726562,
+    1276.7100219726562, 1276.7100219726562, 1276.7100219726562, 1278.2349853515625,
+    1279.760009765625, 1284.3400268554688, 1284.3400268554688, 1285.1050415039062,
+    1285.864990234375, 1285.8699951171875, 1285.8699951171875, 1285.8699951171875,
+    1287.3900146484375, 1288.9199829101562, 1288.9199829101562, 1288.9199829101562,
+    1290.4450073242188, 1291.2050170898438, 1291.2050170898438, 1291.2050170898438,
+    1291.2100219726562, 1292.7349853515625, 1295.0250244140625, 1295.0250244140625,
+    1295.0250244140625, 1295.0250244140625, 1295.7899780273438, 1298.8400268554688,
+    1298.8400268554688, 1298.8400268554688, 1298.8400268554688, 1298.8400268554688,
+    1299.60498046875, 1299.60498046875, 1299.60498046875, 1299.60498046875,
+    1301.8900146484375, 1307.9949951171875, 1336.9949951171875, 1338.5250244140625,
+    1338.5250244140625, 1340.050048828125, 1340.050048828125, 1340.050048828125,
+    1340.050048828125, 1343.864990234375, 1343.864990234375, 1345.3900146484375,
+    1345.3900146484375, 1345.3900146484375, 1351.4949951171875, 1351.4949951171875,
+    1351.4949951171875, 1351.4949951171875, 1351.4949951171875, 1351.4949951171875,
+    1351.4949951171875, 1374.3899536132812, 1374.3899536132812, 1374.3899536132812,
+    1374.3900146484375, 1374.3900146484375, 1379.72998046875, 1379.72998046875,
+    1382.0250244140625, 1385.8400268554688, 1391.175048828125, 1392.7050170898438,
+    1398.0450439453125, 1398.0450439453125, 1398.8099975585938, 1403.3900146484375,
+    1403.3900146484375, 1420.1749877929688, 1460.625, 1485.0450439453125,
+    1493.4400024414062, 1567.4599609375, 1567.4600219726562, 1567.4600219726562,
+    1575.0899658203125, 1575.0899658203125, 1575.0899658203125, 1581.1950073242188,
+    1584.25, 1588.0650024414062, 1605.614990234375, 1691.8499755859375,
+    1692.6150512695312, 1740.6900024414062, 1794.1100463867188, 1797.9249877929688,
+    1852.8699340820312, 1855.1600341796875, 1855.1600341796875, 1948.260009765625,
+    2036.02001953125, 2125.304931640625, 2139.0449829101562, 2160.4099731445312,
+    2193.219970703125, 2284.7999267578125, 2393.9249877929688, 2502.2900390625,
+    2545.7899780273438, 2614.469970703125, 2615.9949951171875, 2615.9949951171875,
+    2615.9949951171875, 2681.625, 2864.7750244140625, 2951.0050048828125,
+    2976.949951171875, 2993.7449340820312, 3005.9498901367188, 3026.5599365234375,
+    3026.5599365234375, 3166.2099609375, 3521.0599365234375, 3527.169921875,
+    3753.8199462890625, 3770.6051025390625, 3864.469970703125, 3864.469970703125,
+    3956.81005859375, 3992.6749267578125, 4210.925048828125, 4291.820068359375,
+    4339.1298828125, 4339.1298828125, 4368.135009765625, 4368.135009765625,
+    4368.135009765625, 4398.655029296875, 4442.919921875, 4482.599853515625,
+    4493.284912109375, 4507.78515625, 4523.044921875, 4578.7548828125,
+    4578.7548828125, 4590.199951171875, 4590.965087890625, 4594.014892578125,
+    4635.989990234375, 4636.75, 4658.1201171875, 4693.985107421875,
+    4716.114990234375, 4716.114990234375, 4716.114990234375, 4718.405029296875,
+    4722.98486328125, 4729.090087890625, 4757.324951171875, 4775.639892578125,
+    4775.639892578125, 4781.7451171875, 4781.7451171875, 4802.349853515625,
+    4809.219970703125, 4809.219970703125, 4822.955078125, 4830.5849609375,
+    4830.5849609375, 4865.68994140625, 4909.949951171875, 4909.949951171875,
+    4948.10498046875, 5023.66015625, 5041.97509765625, 5041.97509765625,
+    5048.080078125, 5063.33984375, 5069.445068359375, 5078.60009765625,
+    5086.22998046875, 5090.050048828125, 5096.155029296875, 5103.784912109375,
+    5108.364990234375, 5108.364990234375, 5108.364990234375, 5108.364990234375,
+    5108.364990234375, 5108.364990234375, 5108.364990234375, 5108.364990234375,
+    5108.364990234375, 5120.5751953125, 5131.260009765625, 5131.260009765625,
+    5133.544921875, 5135.074951171875, 5140.414794921875, 5141.18017578125,
+    5141.18017578125, 5141.94482421875, 5141.94482421875, 5143.469970703125,
+    5143.469970703125, 5144.994873046875, 5144.994873046875, 5144.994873046875,
+    5144.994873046875, 5144.994873046875, 5144.994873046875, 5144.994873046875,
+    5144.994873046875, 5144.994873046875, 5144.994873046875, 5144.9951171875,
+    5145.755126953125, 5145.760009765625, 5145.760009765625, 5146.52001953125,
+    5146.52001953125, 5149.5751953125, 5149.5751953125, 5149.5751953125,
+    5150.335205078125, 5150.335205078125, 5154.155029296875, 5154.155029296875,
+    5154.9150390625, 5154.9150390625, 5154.9150390625, 5154.9150390625,
+    5154.9150390625, 5154.9150390625, 5154.9150390625, 5154.9150390625,
+    5154.9150390625, 5154.9150390625, 5154.9150390625, 5154.9150390625,
+    5154.9150390625, 5154.9150390625, 5154.9150390625, 5154.9150390625,
+    5154.9150390625, 5155.675048828125, 5156.43994140625, 5156.440185546875,
+    5156.440185546875, 5156.440185546875, 5157.204833984375, 5157.204833984375,
+    5157.969970703125, 5157.969970703125, 5157.969970703125, 5157.969970703125,
+    5157.969970703125, 5157.969970703125, 5158.72998046875, 5158.72998046875,
+    5158.72998046875, 5158.72998046875, 5158.72998046875, 5158.72998046875,
+    5158.72998046875, 5158.72998046875, 5158.72998046875, 5158.72998046875,
+    5158.72998046875, 5158.72998046875, 5158.72998046875, 5159.494873046875,
+    5160.255126953125, 5161.019775390625, 5162.545166015625, 5162.545166015625,
+    5162.545166015625, 5165.594970703125, 5165.594970703125, 5165.594970703125,
+    5165.594970703125, 5165.594970703125, 5166.364990234375, 5167.89013671875,
+    5168.650146484375, 5168.650146484375, 5168.650146484375, 5168.650146484375,
+    5168.650146484375, 5168.650146484375, 5170.175048828125, 5170.175048828125,
+    5170.175048828125, 5170.175048828125, 5170.179931640625, 5170.179931640625,
+    5170.179931640625, 5170.179931640625, 5170.179931640625, 5170.179931640625,
+    5171.705078125, 5172.465087890625, 5172.465087890625, 5173.989990234375,
+    5176.284912109375, 5177.81005859375, 5177.81005859375, 5178.574951171875,
+    5178.574951171875, 5178.574951171875, 5183.14990234375, 5186.965087890625,
+    5186.965087890625, 5194.60009765625, 5194.60009765625, 5194.60009765625,
+    5194.60009765625, 5194.60009765625, 5194.60009765625, 5194.60009765625,
+    5195.360107421875, 5197.650146484375, 5199.18017578125, 5199.940185546875,
+    5205.28515625, 5205.28515625, 5205.28515625, 5211.39013671875,
+    5211.39013671875, 5211.39013671875, 5211.39013671875, 5211.39013671875,
+    5211.39013671875, 5212.9150390625, 5213.68017578125, 5215.965087890625,
+    5217.4951171875, 5217.4951171875, 5219.02001953125, 5219.02001953125,
+    5219.780029296875, 5220.544921875, 5220.544921875, 5220.544921875,
+    5221.31005859375, 5224.360107421875, 5225.885009765625, 5226.64990234375,
+    5227.4150390625, 5232.7548828125, 5232.755126953125, 5234.280029296875,
+    5235.0400390625, 5238.094970703125, 5240.385009765625, 5241.909912109375,
+    5243.43505859375, 5243.440185546875, 5244.96484375, 5247.2548828125,
+    5247.2548828125, 5247.255126953125, 5249.544921875, 5250.31005859375,
+    5251.070068359375, 5255.650146484375, 5255.650146484375, 5255.650146484375,
+    5256.41015625, 5260.989990234375, 5261.755126953125, 5264.804931640625,
+    5264.804931640625, 5264.804931640625, 5264.804931640625, 5264.804931640625,
+    5265.56982421875, 5268.6201171875, 5268.6201171875, 5268.6201171875,
+    5268.6201171875, 5272.434814453125, 5272.434814453125, 5272.434814453125,
+    5280.070068359375, 5280.070068359375, 5280.070068359375, 5280.070068359375,
+    5281.594970703125, 5281.594970703125, 5281.594970703125, 5281.594970703125,
+    5281.594970703125, 5281.594970703125, 5281.594970703125, 5308.30517578125,
+    5311.35498046875, 5345.695068359375, 5397.590087890625, 1256.8699951171875,
+    1256.8699951171875, 1258.39501953125, 1258.39501953125, 1258.39501953125,
+    1258.39501953125, 1258.39501953125, 1258.39501953125, 1258.39501953125,
+    1258.39501953125, 1258.39501953125, 1258.39501953125, 1258.39501953125,
+    1258.39501953125, 1258.39501953125, 1258.39501953125, 1262.2149658203125,
+    1262.9749755859375, 1262.9749755859375, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1266.0250244140625, 1266.0250244140625, 1266.0250244140625,
+    1266.0250244140625, 1267.5549926757812, 1267.5549926757812, 1267.5549926757812,
+    1267.5549926757812, 1267.5549926757812, 1267.5549926757812, 1267.5549926757812,
+    1269.844970703125, 1269.844970703125, 1270.60498046875, 1270.60498046875,
+    1270.60498046875, 1270.60498046875, 1270.60498046875, 1270.60498046875,
+    1270.60498046875, 1270.60498046875, 1270.60498046875, 1272.1300048828125,
+    1288.155029296875, 1288.155029296875, 1288.155029296875, 1288.155029296875,
+    1288.155029296875, 1291.9700317382812, 1305.7050170898438, 1308.0,
+    1310.2849731445312, 1333.1800537109375, 1343.10498046875, 1349.9700317382812,
+    1376.6799926757812, 1379.72998046875, 1381.2550048828125, 1381.2550048828125,
+    1381.2550048828125, 1382.02001953125, 1415.5950317382812, 1443.0750122070312,
+    1454.52001953125, 1455.2850341796875, 1461.3900146484375, 1474.3600463867188,
+    1485.0450439453125, 1526.25, 1594.1700439453125, 1669.7200317382812,
+    1797.925048828125, 1821.5799560546875, 1929.945068359375, 2105.4649658203125,
+    2193.989990234375, 2208.489990234375, 2290.9049682617188, 2317.614990234375,
+    2371.7950439453125, 2599.969970703125, 2668.655029296875, 2679.3350219726562,
+    2692.31005859375, 2692.31005859375, 2692.31005859375, 2700.7050170898438,
+    2728.175048828125, 2740.3849487304688, 2792.280029296875, 2799.9100341796875,
+    2858.669921875, 2876.2200317382812, 2890.7200317382812, 2890.7200317382812,
+    2892.2450561523438, 2896.8250122070312, 2940.3250732421875, 2943.3750610351562,
+    2974.6649169921875, 2977.7149047851562, 2977.7149047851562, 2986.8750610351562,
+    2988.4000854492188, 3015.1100463867188, 3015.1100463867188, 3088.3701171875,
+    3102.10986328125, 3173.0751342773438, 3173.0751342773438, 3173.0751342773438,
+    3234.1298828125, 3240.22998046875, 3250.1500244140625, 3268.4699096679688,
+    3276.1000366210938, 3285.2550048828125, 3396.669921875, 3518.77490234375,
+    3866.7601318359375, 3866.7601318359375, 3866.7601318359375, 3866.7601318359375,
+    3878.2049560546875, 4030.8299560546875, 4030.8299560546875, 4030.8299560546875,
+    4087.300048828125, 4171.2451171875, 4278.844970703125, 4377.2900390625,
+    4410.864990234375, 4419.260009765625, 4423.074951171875, 4429.94482421875,
+    4447.494873046875, 4447.494873046875, 4456.655029296875, 4465.81005859375,
+    4472.679931640625, 4480.31005859375, 4485.64990234375, 4489.47021484375,
+    4494.81005859375, 4553.56982421875, 4562.724853515625, 4597.070068359375,
+    4603.93994140625, 4676.429931640625, 4676.43505859375, 4690.175048828125,
+    4693.22509765625, 4693.22509765625, 4693.22509765625, 4693.22509765625,
+    4710.77490234375, 4719.169921875, 4719.93505859375, 4719.93505859375,
+    4738.25, 4753.510009765625, 4774.875, 4779.4599609375,
+    4781.75, 4782.510009765625, 4782.510009765625, 4783.27001953125,
+    4808.455078125, 4808.455078125, 4809.97998046875, 4809.97998046875,
+    4809.97998046875, 4809.97998046875, 4822.190185546875, 4841.27001953125,
+    4848.900146484375, 4871.795166015625, 4871.795166015625, 4877.900146484375,
+    4877.900146484375, 4912.239990234375, 4912.239990234375, 4942.005126953125,
+    4957.26513671875, 4969.47509765625, 4969.47509765625, 4969.47509765625,
+    4969.47509765625, 4969.47509765625, 4969.47509765625, 4969.47509765625,
+    4969.47509765625, 4969.47509765625, 4969.47509765625, 4973.2900390625,
+    4993.130126953125, 5017.554931640625, 5023.655029296875, 5023.655029296875,
+    5025.945068359375, 5028.235107421875, 5054.945068359375, 5056.469970703125,
+    5067.919921875, 5067.919921875, 5080.89501953125, 5080.89501953125,
+    5086.235107421875, 5090.81005859375, 5090.81494140625, 5090.81494140625,
+    5110.655029296875, 5162.545166015625, 5170.175048828125, 5176.28515625,
+    5181.625, 5183.91015625, 5190.780029296875, 5190.780029296875,
+    5192.30517578125, 5199.18017578125, 5200.699951171875, 5203.7548828125,
+    5206.044921875, 5206.044921875, 5207.5751953125, 5209.860107421875,
+    5209.860107421875, 5216.72998046875, 5216.72998046875, 5217.4951171875,
+    5219.014892578125, 5219.01513671875, 5220.544921875, 5220.545166015625,
+    5222.830078125, 5223.594970703125, 5223.594970703125, 5223.594970703125,
+    5224.35986328125, 5224.360107421875, 5224.360107421875, 5224.360107421875,
+    5224.360107421875, 5224.360107421875, 5225.125, 5225.885009765625,
+    5225.885009765625, 5225.885009765625, 5227.4150390625, 5228.175048828125,
+    5228.175048828125, 5228.93994140625, 5233.52001953125, 5233.52001953125,
+    5235.0400390625, 5235.0400390625, 5235.804931640625, 5235.804931640625,
+    5237.3349609375, 5237.3349609375, 5238.094970703125, 5238.85986328125,
+    5238.860107421875, 5240.385009765625, 5240.385009765625, 5240.385009765625,
+    5240.385009765625, 5240.385009765625, 5241.14501953125, 5241.909912109375,
+    5241.909912109375, 5241.909912109375, 5241.909912109375, 5241.909912109375,
+    5244.199951171875, 5245.724853515625, 5245.724853515625, 5245.724853515625,
+    5245.724853515625, 5245.724853515625, 5245.724853515625, 5245.724853515625,
+    5245.724853515625, 5245.724853515625, 5245.724853515625, 5245.724853515625,
+    5245.724853515625, 5245.724853515625, 5245.724853515625, 5245.724853515625,
+    5245.724853515625, 5245.72998046875, 5245.72998046875, 5245.72998046875,
+    5245.72998046875, 5245.72998046875, 5245.72998046875, 5249.5400390625,
+    5293.0400390625, 5311.35498046875, 5327.385009765625, 5353.330078125,
+    5383.85009765625, 5389.955078125, 5402.169921875, 5403.69482421875,
+};
+
+static const uint16_t voltage_qs_tree[2348] = {
+    2, 4, 5, 6, 7, 10, 11, 12, 13, 14, 17, 18, 22, 26, 28, 29,
+    31, 33, 34, 36, 38, 39, 40, 41, 42, 45, 47, 48, 49, 43, 44, 1,
+    27, 1, 3, 9, 13, 14, 15, 21, 23, 25, 27, 38, 0, 3, 4, 6,
+    8, 12, 16, 17, 18, 19, 22, 23, 24, 30, 32, 33, 34, 35, 37, 40,
+    41, 44, 49, 0, 1, 14, 21, 25, 27, 38, 46, 37, 1, 3, 10, 12,
+    13, 14, 16, 18, 19, 21, 22, 24, 30, 33, 34, 35, 37, 38, 41, 44,
+    32, 4, 4, 6, 8, 9, 11, 15, 17, 20, 23, 25, 27, 27, 32, 36,
+    39, 45, 47, 49, 25, 32, 21, 0, 2, 7, 8, 26, 40, 43, 48, 6,
+    0, 21, 32, 34, 23, 27, 15, 8, 27, 1, 9, 25, 0, 10, 16, 21,
+    25, 28, 41, 47, 23, 9, 12, 1, 2, 24, 35, 36, 22, 4, 6, 8,
+    11, 20, 27, 29, 30, 31, 33, 37, 38, 39, 40, 42, 43, 48, 9, 19,
+    32, 34, 29, 47, 22, 41, 3, 45, 24, 30, 1, 33, 36, 38, 39, 20,
+    37, 42, 14, 12, 45, 35, 2, 32, 0, 4, 6, 18, 26, 29, 30, 31,
+    41, 42, 7, 16, 17, 19, 20, 21, 22, 37, 40, 49, 37, 38, 10, 9,
+    15, 23, 24, 25, 27, 36, 44, 46, 47, 48, 13, 5, 15, 24, 27, 28,
+    12, 3, 6, 15, 16, 30, 47, 20, 2, 43, 15, 44, 29, 0, 47, 21,
+    31, 27, 29, 31, 40, 48, 1, 5, 8, 7, 11, 13, 14, 17, 27, 33,
+    34, 39, 20, 23, 32, 42, 46, 3, 10, 35, 37, 45, 49, 1, 5, 7,
+    8, 11, 15, 26, 33, 34, 38, 39, 44, 47, 21, 0, 12, 16, 17, 18,
+    27, 33, 37, 40, 41, 43, 19, 22, 25, 30, 42, 2, 9, 36, 37, 12,
+    31, 35, 4, 17, 7, 17, 28, 44, 14, 19, 21, 30, 41, 16, 35, 42,
+    4, 22, 14, 35, 4, 42, 3, 11, 24, 28, 29, 43, 4, 45, 7, 12,
+    1, 44, 1, 8, 18, 36, 39, 13, 31, 10, 12, 3, 10, 26, 36, 40,
+    9, 47, 38, 5, 32, 5, 1, 22, 28, 39, 46, 48, 18, 33, 8, 23,
+    5, 7, 25, 3, 36, 0, 4, 6, 17, 20, 24, 35, 37, 43, 44, 10,
+    18, 27, 28, 31, 32, 48, 13, 11, 15, 47, 23, 1, 1, 12, 26, 29,
+    32, 41, 42, 19, 5, 22, 39, 14, 47, 49, 18, 38, 6, 14, 17, 36,
+    3, 23, 40, 0, 34, 42, 8, 9, 11, 15, 16, 25, 29, 40, 45, 35,
+    46, 21, 33, 7, 21, 4, 43, 5, 37, 23, 40, 41, 2, 24, 1, 29,
+    12, 31, 4, 7, 27, 35, 43, 48, 21, 41, 14, 17, 3, 6, 10, 36,
+    37, 42, 32, 34, 40, 0, 19, 46, 7, 19, 26, 47, 8, 25, 22, 2,
+    13, 16, 17, 25, 27, 2, 8, 11, 12, 14, 22, 23, 30, 38, 49, 16,
+    13, 4, 5, 20, 29, 39, 45, 18, 44, 1, 49, 4, 34, 28, 31, 10,
+    26, 39, 41, 1, 10, 21, 26, 39, 47, 28, 31, 41, 19, 24, 36, 36,
+    42, 7, 45, 48, 14, 48, 3, 39, 31, 13, 15, 20, 22, 30, 38, 13,
+    15, 21, 22, 30, 31, 37, 38, 49, 0, 8, 13, 38, 44, 36, 20, 47,
+    5, 12, 29, 0, 2, 8, 12, 17, 24, 27, 29, 33, 35, 43, 45, 9,
+    25, 28, 40, 41, 46, 5, 18, 32, 39, 11, 7, 17, 41, 16, 42, 34,
+    19, 4, 26, 40, 1, 26, 8, 42, 28, 30, 10, 44, 48, 2, 6, 12,
+    36, 22, 33, 25, 31, 15, 27, 31, 1, 8, 10, 16, 27, 3, 35, 39,
+    41, 5, 0, 21, 24, 45, 49, 29, 38, 40, 8, 18, 46, 7, 27, 9,
+    10, 37, 47, 11, 20, 23, 32, 37, 40, 44, 16, 31, 47, 48, 42, 17,
+    29, 1, 9, 10, 15, 19, 26, 33, 38, 43, 5, 6, 13, 17, 3, 24,
+    49, 18, 25, 37, 37, 44, 18, 44, 46, 2, 3, 22, 25, 28, 31, 45,
+    4, 34, 35, 21, 14, 48, 20, 26, 46, 7, 23, 41, 33, 12, 29, 44,
+    24, 33, 45, 36, 36, 32, 47, 39, 15, 30, 18, 27, 0, 8, 42, 9,
+    11, 16, 35, 13, 10, 44, 26, 1, 6, 14, 32, 43, 45, 36, 20, 17,
+    19, 33, 34, 48, 26, 32, 0, 3, 16, 22, 25, 40, 49, 2, 3, 4,
+    22, 24, 29, 30, 46, 15, 37, 38, 7, 16, 36, 31, 5, 6, 12, 28,
+    10, 20, 36, 41, 23, 45, 21, 10, 5, 26, 35, 39, 6, 27, 42, 14,
+    32, 37, 37, 12, 19, 39, 18, 2, 8, 15, 23, 27, 31, 36, 38, 41,
+    0, 1, 3, 5, 7, 9, 10, 11, 13, 16, 17, 20, 24, 25, 26, 33,
+    43, 47, 49, 28, 39, 48, 4, 34, 45, 1, 6, 7, 8, 9, 18, 19,
+    21, 22, 29, 30, 32, 35, 37, 46, 23, 12, 15, 17, 40, 44, 47, 42,
+    5, 0, 2, 4, 10, 13, 14, 24, 25, 27, 28, 31, 33, 48, 49, 16,
+    1, 45, 39, 43, 8, 0, 39, 44, 2, 33, 16, 10, 26, 34, 48, 17,
+    30, 15, 41, 43, 5, 23, 25, 36, 12, 13, 14, 19, 20, 22, 35, 37,
+    39, 40, 46, 6, 7, 29, 32, 15, 45, 0, 8, 18, 23, 32, 34, 1,
+    43, 7, 10, 26, 31, 33, 36, 47, 5, 11, 13, 16, 24, 28, 48, 3,
+    9, 49, 27, 32, 21, 30, 44, 0, 2, 15, 35, 37, 3, 8, 20, 26,
+    29, 38, 11, 13, 18, 27, 41, 40, 42, 6, 24, 10, 16, 45, 48, 1,
+    2, 5, 7, 19, 25, 32, 33, 43, 14, 22, 9, 21, 23, 34, 35, 36,
+    38, 49, 12, 31, 39, 45, 42, 8, 10, 11, 13, 18, 40, 44, 28, 47,
+    15, 20, 32, 42, 16, 25, 28, 40, 9, 25, 9, 9, 28, 29, 20, 24,
+    30, 31, 25, 9, 27, 2, 21, 37, 31, 48, 22, 42, 3, 3, 46, 48,
+    31, 40, 45, 29, 31, 24, 28, 27, 33, 17, 7, 15, 20, 44, 37, 46,
+    20, 23, 36, 37, 38, 39, 45, 19, 41, 19, 33, 38, 0, 43, 2, 4,
+    43, 45, 14, 14, 43, 45, 34, 4, 35, 43, 21, 46, 42, 26, 20, 0,
+    15, 46, 43, 15, 6, 46, 28, 7, 48, 28, 23, 31, 41, 39, 8, 11,
+    34, 19, 22, 3, 21, 24, 26, 28, 36, 48, 16, 9, 24, 48, 4, 36,
+    45, 0, 13, 20, 33, 37, 40, 43, 11, 16, 29, 44, 49, 44, 2, 21,
+    29, 7, 12, 30, 11, 14, 27, 15, 1, 22, 24, 33, 15, 25, 30, 3,
+    11, 33, 29, 32, 25, 30, 21, 2, 33, 45, 3, 25, 33, 2, 4, 39,
+    2, 12, 22, 28, 29, 44, 27, 3, 26, 1, 10, 19, 34, 42, 43, 15,
+    20, 11, 40, 32, 49, 23, 34, 42, 43, 32, 2, 38, 31, 44, 37, 2,
+    4, 9, 12, 15, 22, 24, 28, 29, 34, 38, 41, 45, 49, 23, 40, 47,
+    46, 2, 21, 24, 30, 5, 21, 36, 18, 16, 5, 44, 6, 25, 40, 39,
+    11, 43, 15, 9, 6, 35, 42, 12, 20, 4, 46, 17, 30, 4, 27, 15,
+    29, 13, 26, 3, 12, 17, 19, 23, 24, 30, 36, 37, 49, 49, 11, 16,
+    18, 22, 27, 23, 32, 31, 14, 17, 20, 24, 37, 38, 44, 45, 47, 49,
+    1, 3, 23, 34, 35, 46, 21, 8, 23, 46, 2, 29, 34, 8, 11, 34,
+    2, 3, 16, 40, 41, 6, 48, 35, 8, 24, 36, 38, 9, 10, 47, 20,
+    18, 22, 29, 23, 25, 47, 0, 41, 43, 22, 27, 30, 4, 6, 19, 36,
+    1, 39, 33, 43, 0, 16, 38, 45, 29, 12, 24, 26, 32, 12, 20, 22,
+    25, 37, 0, 5, 46, 7, 11, 15, 28, 34, 42, 3, 13, 26, 5, 15,
+    20, 24, 27, 46, 19, 19, 21, 47, 4, 22, 9, 28, 27, 29, 38, 37,
+    8, 10, 11, 35, 13, 6, 3, 20, 26, 32, 3, 21, 49, 20, 18, 37,
+    30, 32, 45, 47, 4, 1, 39, 10, 13, 22, 25, 46, 18, 15, 19, 41,
+    31, 23, 11, 9, 23, 21, 23, 44, 1, 15, 2, 0, 35, 25, 6, 34,
+    12, 3, 48, 20, 12, 40, 24, 6, 37, 43, 48, 43, 1, 32, 44, 1,
+    4, 15, 18, 33, 38, 34, 1, 3, 20, 25, 44, 29, 46, 25, 30, 18,
+    49, 12, 42, 9, 28, 16, 35, 46, 27, 47, 17, 32, 30, 18, 19, 48,
+    32, 19, 49, 16, 49, 8, 17, 18, 25, 32, 40, 49, 22, 24, 15, 40,
+    16, 47, 24, 30, 44, 14, 16, 19, 13, 38, 0, 22, 5, 30, 12, 26,
+    47, 48, 5, 27, 8, 20, 32, 48, 46, 18, 0, 32, 6, 15, 40, 0,
+    27, 42, 17, 44, 9, 25, 46, 18, 3, 45, 43, 43, 1, 32, 9, 28,
+    31, 2, 1, 23, 21, 45, 6, 17, 46, 48, 18, 1, 9, 23, 25, 37,
+    43, 0, 2, 5, 7, 8, 10, 11, 16, 33, 35, 39, 22, 0, 9, 16,
+    17, 19, 24, 30, 34, 0, 18, 35, 2, 15, 29, 40, 48, 0, 9, 26,
+    28, 46, 42, 0, 21, 23, 0, 1, 3, 4, 6, 7, 8, 9, 11, 13,
+    14, 15, 16, 18, 19, 20, 23, 25, 27, 28, 30, 33, 35, 36, 38, 39,
+    41, 43, 45, 46, 47, 5, 21, 27, 25, 0, 7, 17, 20, 30, 34, 29,
+    40, 1, 40, 23, 41, 21, 22, 26, 34, 19, 22, 30, 34, 10, 11, 35,
+    10, 48, 1, 29, 30, 31, 11, 8, 10, 16, 31, 47, 2, 8, 32, 34,
+    19, 24, 18, 0, 14, 2, 16, 40, 41, 17, 37, 6, 30, 31, 9, 10,
+    13, 25, 36, 48, 49, 8, 35, 38, 12, 24, 1, 42, 44, 19, 38, 34,
+    30, 41, 49, 5, 46, 14, 45, 10, 3, 20, 5, 15, 26, 40, 41, 32,
+    4, 9, 29, 7, 23, 15, 24, 38, 21, 9, 36, 12, 36, 45, 3, 11,
+    13, 8, 12, 3, 25, 40, 17, 32, 44, 8, 17, 10, 42, 19, 2, 31,
+    37, 11, 28, 35, 35, 11, 14, 21, 20, 4, 25, 8, 22, 48, 0, 37,
+    45, 28, 3, 48, 35, 20, 7, 9, 33, 28, 41, 15, 0, 32, 30, 49,
+    33, 39, 43, 1, 39, 35, 3, 2, 5, 17, 19, 46, 24, 25, 44, 6,
+    30, 11, 27, 36, 24, 22, 33, 46, 30, 35, 49, 4, 44, 3, 32, 35,
+    8, 9, 17, 31, 33, 35, 41, 46, 48, 47, 7, 19, 16, 28, 37, 6,
+    21, 4, 36, 30, 31, 1, 21, 23, 24, 31, 33, 38, 40, 41, 48, 49,
+    6, 26, 28, 5, 39, 13, 42, 48, 43, 49, 27, 35, 1, 2, 3, 7,
+    8, 10, 11, 15, 17, 19, 20, 25, 27, 37, 41, 44, 45, 13, 43, 2,
+    11, 47, 38, 40, 12, 15, 20, 25, 32, 36, 0, 3, 9, 10, 11, 16,
+    18, 23, 27, 29, 33, 37, 45, 34, 19, 32, 3, 22, 35, 6, 12, 14,
+    20, 45, 15, 35, 5, 6, 24, 26, 43, 47, 0, 13, 14, 40, 15, 31,
+    33, 36, 40, 42, 34, 20, 24, 22, 10, 34, 37, 11, 12, 29, 25, 1,
+    20, 6, 10, 12, 21, 26, 33, 35, 1, 24, 46, 8, 30, 36, 39, 7,
+    10, 15, 19, 27, 43, 30, 6, 18, 31, 44, 1, 8, 45, 17, 20, 48,
+    31, 13, 42, 31, 0, 37, 17, 29, 6, 1, 18, 17, 42, 1, 33, 13,
+    48, 20, 10, 43, 22, 14, 16, 42, 7, 2, 23, 0, 7, 13, 24, 47,
+    30, 8, 9, 11, 17, 29, 40, 44, 0, 26, 46, 49, 6, 26, 27, 35,
+    42, 43, 49, 1, 33, 39, 0, 4, 16, 0, 0, 16, 17, 18, 19, 23,
+    24, 25, 30, 34, 35, 37, 49, 38, 14, 16, 0, 2, 4, 5, 6, 7,
+    8, 9, 15, 16, 23, 25, 26, 27, 28, 29, 31, 34, 39, 42, 43, 46,
+    48, 3, 25, 27, 28, 35, 40, 46, 23, 27, 0, 5, 14, 16, 21, 31,
+    32, 38, 42, 21, 28, 35, 36, 39, 42, 19, 42, 32, 35, 7, 38, 19,
+    29, 7, 19, 21, 33, 16, 24, 24, 3, 35, 38, 10, 39, 1, 5, 31,
+    8, 35, 23, 42, 2, 37, 46, 0, 9, 31, 27, 35, 10, 34, 38, 26,
+    7, 39, 3, 5, 48, 12, 14, 30, 16, 26, 40, 14, 20, 21, 41, 32,
+    21, 24, 28, 22, 32, 10, 11, 28, 41, 14, 6, 30, 22, 11, 23, 46,
+    15, 30, 37, 45, 29, 12, 20, 29, 43, 20, 42, 38, 44, 17, 5, 36,
+    46, 47, 18, 45, 22, 28, 29, 44, 44, 42, 32, 14, 0, 5, 45, 7,
+    9, 24, 27, 36, 37, 29, 34, 41, 31, 41, 22, 47, 4, 40, 46, 34,
+    14, 49, 4, 6, 26, 49, 28, 38, 13, 26, 33, 18, 22, 36, 44, 48,
+    15, 1, 9, 18, 23, 26, 27, 32, 36, 39, 44, 5, 41, 37, 10, 16,
+    40, 22, 37, 20, 7, 13, 28, 44, 46, 25, 8, 41, 10, 3, 46, 32,
+    39, 38, 13, 16, 8, 7, 39, 14, 13, 49, 5, 17, 40, 6, 19, 1,
+    31, 24, 21, 4, 18, 2, 5, 20, 18, 9, 12, 13, 25, 36, 33, 11,
+    16, 42, 44, 21, 34, 49, 15, 28, 12, 16, 18, 26, 11, 15, 49, 28,
+    7, 0, 16, 23, 26, 29, 46, 4, 14, 20, 35, 39, 49, 2, 3, 4,
+    10, 11, 12, 18, 20, 23, 27, 29, 30, 32, 37, 45, 48, 21, 24, 29,
+    37, 45, 48, 27, 43, 9, 48, 17, 21, 36, 27, 17,
+};
+
+static const uint64_t voltage_qs_mask[2348] = {
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFCULL,
+    0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFF9ULL,
+    0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFFDULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFFF9ULL,
+    0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFFCULL,
+    0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFDULL,
+    0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFFDULL,
+    0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFCFFULL,
+    0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFFBULL,
+    0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFFBULL,
+    0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFF9ULL,
+    0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFFE1ULL,
+    0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFF0ULL,
+    0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFF0ULL,
+    0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFF9ULL,
+    0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFDFULL,
+    0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFFCULL,
+    0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFCFFULL, 0xFFFFFFFFFFFFFCFFULL,
+    0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFCFFULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFF9ULL,
+    0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFE1ULL,
+    0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFFF0ULL,
+    0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFFCULL, 0xFFFFFFFFFFFFFFFDULL,
+    0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFF9ULL,
+    0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFFFFBFULL, 0xFFFFFFFFFFFFFF7FULL,
+    0xFFFFFFFFFFFFFFBFULL, 0xFFFFFFFFFFFFFFCFULL, 0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFFBFULL,
+    0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFFFFBFULL, 0xFFFFFFFFFFFFFFBFULL, 0xFFFFFFFFFFFFFFBFULL,
+    0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFFE7FFULL,
+    0xFFFFFFFFFFFFE7FFULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFE1ULL,
+    0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFFFBFFULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFF00ULL,
+    0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFF80ULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFFE1ULL,
+    0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFF00ULL,
+    0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFFFFE1ULL,
+    0xFFFFFFFFFFFFFF80ULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFF80ULL,
+    0xFFFFFFFFFFFFFE01ULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFFE1ULL,
+    0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFFFF80ULL,
+    0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFE01ULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFFF7FULL,
+    0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFFE1ULL,
+    0xFFFFFFFFFFFFFE7FULL, 0xFFFFFFFFFFFFFBFFULL, 0xFFFFFFFFFFFFFCFFULL, 0xFFFFFFFFFFFFFFDFULL,
+    0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFBFULL,
+    0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFE01ULL, 0xFFFFFFFFFFFFFFDFULL,
+    0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFCFFULL, 0xFFFFFFFFFFFFFE01ULL, 0xFFFFFFFFFFFFF3FFULL,
+    0xFFFFFFFFFFFF0000ULL, 0xFFFFFFFFFFFFFE01ULL, 0xFFFFFFFFFFFFFE01ULL, 0xFFFFFFFFFFFFFF00ULL,
+    0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFFFC000ULL, 0xFFFFFFFFFFFFFE00ULL,
+    0xFFFFFFFFFFFFFE01ULL, 0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFE000ULL,
+    0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFE000ULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFF8000ULL,
+    0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFFFE000ULL, 0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFFFFF01ULL,
+    0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFC000ULL,
+    0xFFFFFFFFFFFFFF80ULL, 0xFFFFFFFFFFFF0000ULL, 0xFFFFFFFFFFFFE000ULL, 0xFFFFFFFFFFFF8000ULL,
+    0xFFFFFFFFFFFF0000ULL, 0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFF00ULL,
+    0xFFFFFFFFFFFFFE01ULL, 0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFE1ULL,
+    0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFFFFE00ULL,
+    0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFFF9FFULL,
+    0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFFFBFFULL,
+    0xFFFFFFFFFFFFE7FFULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFFFF7FULL,
+    0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFFFFFE7FFULL, 0xFFFFFFFFFFFF7FFFULL,
+    0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFFF1FFULL,
+    0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFFFFDFULL,
+    0xFFFFFFFFFFFFE7FFULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFF01ULL,
+    0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFFFFFFF7FULL,
+    0xFFFFFFFFFFFF9FFFULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFC000ULL, 0xFFFFFFFFFF800000ULL,
+    0xFFFFFFFFFFFFC000ULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFFE000ULL, 0xFFFFFFFFFFFF8000ULL,
+    0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFFF8000ULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFFFFFE00ULL,
+    0xFFFFFFFFFFFFC000ULL, 0xFFFFFFFFFFFF8000ULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFE00ULL,
+    0xFFFFFFFFFFFFC000ULL, 0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFFFE000ULL, 0xFFFFFFFFFFFFFE00ULL,
+    0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFFF0000ULL, 0xFFFFFFFFFFFE0000ULL, 0xFFFFFFFFFFFFFE00ULL,
+    0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFFFC000ULL, 0xFFFFFFFFFFE1FFFFULL, 0xFFFFFFFFFE1FFFFFULL,
+    0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFF87FFULL,
+    0xFFFFFFFFFC3FFFFFULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFF87FFFFULL, 0xFFFFFFFFFFFF3FFFULL,
+    0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFFFE00ULL, 0xFFFFFFFFFFF87FFFULL, 0xFFFFFFFFFFF0FFFFULL,
+    0xFFFFFFFFFF87FFFFULL, 0xFFFFFFFFFFC3FFFFULL, 0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFF8000ULL,
+    0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFFFFF7FFULL,
+    0xFFFFFFFFFFF87FFFULL, 0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFFF0000ULL, 0xFFFFFFFFFFFF8FFFULL,
+    0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFFBFFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFFDFFULL,
+    0xFFFFFFFFFFFF0000ULL, 0xFFFFFFFFFFF00000ULL, 0xFFFFFFFFFFC00000ULL, 0xFFFFFFFFFF800000ULL,
+    0xFFFFFFFFFFFF0000ULL, 0xFFFFFFFFFFC3FFFFULL, 0xFFFFFFFFFFE3FFFFULL, 0xFFFFFFFFFFFBFFFFULL,
+    0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFFF9FFFULL, 0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFFBFFFFFULL,
+    0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFF9FFFFULL, 0xFFFFFFFFFFFE1FFFULL,
+    0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFF87FFFULL, 0xFFFFFFFFFFFFC3FFULL,
+    0xFFFFFFFFFFFCFFFFULL, 0xFFFFFFFFFFFF8FFFULL, 0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFFDFFFULL,
+    0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFFFFBFFFFULL,
+    0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFFFBFFULL,
+    0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFFF87FFULL, 0xFFFFFFFFFFE1FFFFULL,
+    0xFFFFFFFFFFFE1FFFULL, 0xFFFFFFFFFFFF9FFFULL, 0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFFFFC3FFFULL,
+    0xFFFFFFFFFF800000ULL, 0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFFFFF7FFFULL,
+    0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFFFE7FFULL, 0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFFFCFFFFFULL,
+    0xFFFFFFFFFFFC3FFFULL, 0xFFFFFFFFFFFF0FFFULL, 0xFFFFFFFFFFF0FFFFULL, 0xFFFFFFFFFFFE1FFFULL,
+    0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFFF8FFFULL, 0xFFFFFFFFFFF0FFFFULL, 0xFFFFFFFFF3FFFFFFULL,
+    0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFE0000ULL, 0xFFFFFFFFF8000000ULL, 0xFFFFFFFFFF000000ULL,
+    0xFFFFFFFFFFC00000ULL, 0xFFFFFFFFF0000000ULL, 0xFFFFFFFFFFCFFFFFULL, 0xFFFFFFFFFFFF0000ULL,
+    0xFFFFFFFFFFF80000ULL, 0xFFFFFFFFFF000000ULL, 0xFFFFFFFFFC000000ULL, 0xFFFFFFFFFF000000ULL,
+    0xFFFFFFFFFC000000ULL, 0xFFFFFFFFFFFC0000ULL, 0xFFFFFFFFFFF80000ULL, 0xFFFFFFFFFFF00000ULL,
+    0xFFFFFFFFFFF80000ULL, 0xFFFFFFFFC0000000ULL, 0xFFFFFFFFFFE00000ULL, 0xFFFFFFFFFFC00000ULL,
+    0xFFFFFFFFFF000000ULL, 0xFFFFFFFFFFF00000ULL, 0xFFFFFFFFFFFFE000ULL, 0xFFFFFFFFFFFDFFFFULL,
+    0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFFFEFFFFFULL,
+    0xFFFFFFFFFE000000ULL, 0xFFFFFFFFFFF80000ULL, 0xFFFFFFFFFFF80000ULL, 0xFFFFFFFFFFF7FFFFULL,
+    0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFFFF00000ULL, 0xFFFFFFFFFF0FFFFFULL,
+    0xFFFFFFFFFFFC0000ULL, 0xFFFFFFFFFF000000ULL, 0xFFFFFFFFFFF80000ULL, 0xFFFFFFFFFEFFFFFFULL,
+    0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFBFFFFFFULL,
+    0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFCFFFFFULL, 0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFBFFFFFULL,
+    0xFFFFFFFFFCFFFFFFULL, 0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFCFFFFFFFULL,
+    0xFFFFFFFFFE1FFFFFULL, 0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFF800000ULL, 0xFFFFFFFFF07FFFFFULL,
+    0xFFFFFFFFFFE00000ULL, 0xFFFFFFFFFF000000ULL, 0xFFFFFFFFFE000000ULL, 0xFFFFFFFFF7FFFFFFULL,
+    0xFFFFFFFFFF800000ULL, 0xFFFFFFFFFFE00000ULL, 0xFFFFFFFFFFFC0000ULL, 0xFFFFFFFFF8FFFFFFULL,
+    0xFFFFFFFFFF800000ULL, 0xFFFFFFFFF9FFFFFFULL, 0xFFFFFFFFFFFC0000ULL, 0xFFFFFFFFFFFDFFFFULL,
+    0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFFF00FFFFULL, 0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFFF7FFFFULL,
+    0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFC07FFFFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFFBFFFFFFULL,
+    0xFFFFFFFFFFF87FFFULL, 0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFFFDFFFFFFULL,
+    0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFCFFFFFFULL, 0xFFFFFFFFFFE1FFFFULL,
+    0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFF80FFFFFFULL, 0xFFFFFFFFFFC3FFFFULL, 0xFFFFFFFFFF8FFFFFULL,
+    0xFFFFFFFFE03FFFFFULL, 0xFFFFFFFFF000FFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFE7FFFFULL,
+    0xFFFFFFFFF0FFFFFFULL, 0xFFFFFFFFFFF0FFFFULL, 0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFC3FFFFFULL,
+    0xFFFFFFFFC3FFFFFFULL, 0xFFFFFFFFFF0FFFFFULL, 0xFFFFFFFFF8FFFFFFULL, 0xFFFFFFFFF000FFFFULL,
+    0xFFFFFFFFFE1FFFFFULL, 0xFFFFFFFF0FFFFFFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFF87FFFFFULL,
+    0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFFFBFFFFFULL,
+    0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFE7FFFFFFULL, 0xFFFFFFFFFCFFFFFFULL, 0xFFFFFFFFFFF7FFFFULL,
+    0xFFFFFFFFFFFF9FFFULL, 0xFFFFFFFFF9FFFFFFULL, 0xFFFFFFFFFE07FFFFULL, 0xFFFFFFFFC7FFFFFFULL,
+    0xFFFFFFFC3FFFFFFFULL, 0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFFC7FFFFFULL, 0xFFFFFFFFFF1FFFFFULL,
+    0xFFFFFFFFFF87FFFFULL, 0xFFFFFFFFF000FFFFULL, 0xFFFFFFFFF8FFFFFFULL, 0xFFFFFFFF3FFFFFFFULL,
+    0xFFFFFFFFF87FFFFFULL, 0xFFFFFFFFE001FFFFULL, 0xFFFFFFFFFFFC3FFFULL, 0xFFFFFFFFF1FFFFFFULL,
+    0xFFFFFFFFFFFF1FFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFFFE3FFFFULL, 0xFFFFFFFFF0FFFFFFULL,
+    0xFFFFFFFFF87FFFFFULL, 0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFC3FFFFULL, 0xFFFFFFFFFF87FFFFULL,
+    0xFFFFFFFFFF87FFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFE000FFFFULL,
+    0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFFF9FFFFFULL, 0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFFFCFFFFFULL,
+    0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFE1FFFFFFULL,
+    0xFFFFFFFFFF8FFFFFULL, 0xFFFFFFFF9FFFFFFFULL, 0xFFFFFFFFFFC7FFFFULL, 0xFFFFFFFFFFC7FFFFULL,
+    0xFFFFFFFFFF003FFFULL, 0xFFFFFFFFFF1FFFFFULL, 0xFFFFFFFFFE3FFFFFULL, 0xFFFFFFFFCFFFFFFFULL,
+    0xFFFFFFFFC00FFFFFULL, 0xFFFFFFFFC3FFFFFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL,
+    0xFFFFFFFFFCFFFFFFULL, 0xFFFFFFFFFF9FFFFFULL, 0xFFFFFFFFF3FFFFFFULL, 0xFFFFFFFFF7FFFFFFULL,
+    0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFFBFFFFFFULL,
+    0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFCFFFFFFULL, 0xFFFFFFFFEFFFFFFFULL,
+    0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFFFFFCFFFFULL,
+    0xFFFFFFFFF0FFFFFFULL, 0xFFFFFFFF7FFFFFFFULL, 0xFFFFFFFFE7FFFFFFULL, 0xFFFFFFFFE7FFFFFFULL,
+    0xFFFFFFFFF9FFFFFFULL, 0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFF9FFFFFFFULL, 0xFFFFFFFFF0003FFFULL,
+    0xFFFFFF8FFFFFFFFFULL, 0xFFFFFFFF3FFFFFFFULL, 0xFFFFFFFFFF8FFFFFULL, 0xFFFFFFF9FFFFFFFFULL,
+    0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFF3FFFFFFFULL, 0xFFFFFFFFCFFFFFFFULL, 0xFFFFFFFFFEFFFFFFULL,
+    0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL,
+    0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFF3FFFFFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFF9FFFFFFULL,
+    0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFFFFC3FFFFULL,
+    0xFFFFFFFE7FFFFFFFULL, 0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFCFFFFFFFULL,
+    0xFFFFFFFF3FFFFFFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFF9FFFFFFULL, 0xFFFFFFFFBFFFFFFFULL,
+    0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFFFF9FFFFFULL, 0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFE7FFFFFFULL,
+    0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFF1FFFFFFULL, 0xFFFFFFFF9FFFFFFFULL,
+    0xFFFFFFFCFFFFFFFFULL, 0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFCFFFFFFFULL,
+    0xFFFFFFFF3FFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFEFFFFFFFFULL,
+    0xFFFFFFFF9FFFFFFFULL, 0xFFFFFFFFE3FFFFFFULL, 0xFFFFFFFE3FFFFFFFULL, 0xFFFFFFFFEFFFFFFFULL,
+    0xFFFFFFFF001FFFFFULL, 0xFFFFFFF0007FFFFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFF87FFFFFFULL,
+    0xFFFFFFFFC7FFFFFFULL, 0xFFFFFFFFE0007FFFULL, 0xFFFFFFFFFFCFFFFFULL, 0xFFFFFFFF8007FFFFULL,
+    0xFFFFFFFE003FFFFFULL, 0xFFFFFFFC00FFFFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFC007FFFFFFULL,
+    0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFFCFFFFFFFULL, 0xFFFFFE3FFFFFFFFFULL, 0xFFFFFFFE1FFFFFFFULL,
+    0xFFFFFFFF7FFFFFFFULL, 0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL,
+    0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFE000FFFFFFULL, 0xFFFFFFE000FFFFFFULL, 0xFFFFFFFFE007FFFFULL,
+    0xFFFFFFF80FFFFFFFULL, 0xFFFFFFFFF9FFFFFFULL, 0xFFFFFF000FFFFFFFULL, 0xFFFFFFF0003FFFFFULL,
+    0xFFFFFFC003FFFFFFULL, 0xFFFFFFFF8003FFFFULL, 0xFFFFFFFFCFFFFFFFULL, 0xFFFFFFF0007FFFFFULL,
+    0xFFFFFFFF7FFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFF0007FFFFFULL, 0xFFFFFFFF0007FFFFULL,
+    0xFFFFFFFC007FFFFFULL, 0xFFFFFFFF8001FFFFULL, 0xFFFFF8003FFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL,
+    0xFFFFFFFFC7FFFFFFULL, 0xFFFFFFE3FFFFFFFFULL, 0xFFFFFFFFCFFFFFFFULL, 0xFFFFFFFE001FFFFFULL,
+    0xFFFFFF8000FFFFFFULL, 0xFFFFFFE0007FFFFFULL, 0xFFFFFFC000FFFFFFULL, 0xFFFFFFC003FFFFFFULL,
+    0xFFFFFFF8001FFFFFULL, 0xFFFFFFFC0007FFFFULL, 0xFFFFFFC001FFFFFFULL, 0xFFFFFFF0003FFFFFULL,
+    0xFFFFFFFF80FFFFFFULL, 0xFFFFFFFE000FFFFFULL, 0xFFFFFFFC000FFFFFULL, 0xFFFFFFFF7FFFFFFFULL,
+    0xFFFFFEFFFFFFFFFFULL, 0xFFFFFF0001FFFFFFULL, 0xFFFFFFF8007FFFFFULL, 0xFFFFFFFF000FFFFFULL,
+    0xFFFFFF8000FFFFFFULL, 0xFFFFFFC03FFFFFFFULL, 0xFFFFFFFF8007FFFFULL, 0xFFFFFFFF8003FFFFULL,
+    0xFFFFFFE01FFFFFFFULL, 0xFFFFFFFF0003FFFFULL, 0xFFFFFFFFF003FFFFULL, 0xFFFFFFFFE000FFFFULL,
+    0xFFFFFFFFFC001FFFULL, 0xFFFFFFFE0007FFFFULL, 0xFFFFFDFFFFFFFFFFULL, 0xFFFFF3FFFFFFFFFFULL,
+    0xFFFFFFF00FFFFFFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFFF3FFFFFFFFFULL,
+    0xFFFFFBFFFFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFBFFFFFFFFULL,
+    0xFFFFFFF3FFFFFFFFULL, 0xFFFFFFFF9FFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL, 0xFFFFFFF3FFFFFFFFULL,
+    0xFFFFFF3FFFFFFFFFULL, 0xFFFFFFFCFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL,
+    0xFFFFFFF01FFFFFFFULL, 0xFFFFFFF00FFFFFFFULL, 0xFFFFF9FFFFFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL,
+    0xFFFFFFFE0FFFFFFFULL, 0xFFFFFFF9FFFFFFFFULL, 0xFFFFFE7FFFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL,
+    0xFFFFFF7FFFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL,
+    0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFFE7FFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL, 0xFFFFFFF3FFFFFFFFULL,
+    0xFFFFFF3FFFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL, 0xFFFFFFFE7FFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL,
+    0xFFFFFFE1FFFFFFFFULL, 0xFFFFFC3FFFFFFFFFULL, 0xFFFFFFFE7FFFFFFFULL, 0xFFFFFFFE1FFFFFFFULL,
+    0xFFFFFF7FFFFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL, 0xFFFFFFF0FFFFFFFFULL, 0xFFFFE7FFFFFFFFFFULL,
+    0xFFFFF0FFFFFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL, 0xFFFFFFF3FFFFFFFFULL, 0xFFFFFFE7FFFFFFFFULL,
+    0xFFFFFFF9FFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFFF9FFFFFFFFFULL, 0xFFFFFFFFC3FFFFFFULL,
+    0xFFFFFFF0FFFFFFFFULL, 0xFFFFFE03FFFFFFFFULL, 0xFFFFFFFE7FFFFFFFULL, 0xFFFFF0FFFFFFFFFFULL,
+    0xFFFFFFFF9FFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFFFFCFFFFFFFFULL,
+    0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL, 0xFFFFFFF9FFFFFFFFULL,
+    0xFFFFFF3FFFFFFFFFULL, 0xFFFFFFF87FFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL, 0xFFFFFFE1FFFFFFFFULL,
+    0xFFFFFFF7FFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL,
+    0xFFFFF3FFFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL, 0xFFFFE03FFFFFFFFFULL, 0xFFFFFC07FFFFFFFFULL,
+    0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFE01FFFFFFFULL, 0xFFFFF01FFFFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL,
+    0xFFFFFE03FFFFFFFFULL, 0xFFFFC03FFFFFFFFFULL, 0xFFFFF00FFFFFFFFFULL, 0xFFFFF80FFFFFFFFFULL,
+    0xFFFFFE03FFFFFFFFULL, 0xFFFFF87FFFFFFFFFULL, 0xFFFFE03FFFFFFFFFULL, 0xFFFFFF9FFFFFFFFFULL,
+    0xFFFFFFF07FFFFFFFULL, 0xFFFFE03FFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL, 0xFFFFFE0FFFFFFFFFULL,
+    0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL, 0xFFFFFF807FFFFFFFULL, 0xFFFFFF00FFFFFFFFULL,
+    0xFFFFFFEFFFFFFFFFULL, 0xFFFFC07FFFFFFFFFULL, 0xFFFFFE01FFFFFFFFULL, 0xFFFFFF87FFFFFFFFULL,
+    0xFFFFFC1FFFFFFFFFULL, 0xFFFFFFC07FFFFFFFULL, 0xFFFFF00FFFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL,
+    0xFFFFFFF00FFFFFFFULL, 0xFFFFFFC07FFFFFFFULL, 0xFFFFE01FFFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL,
+    0xFFFFFFF01FFFFFFFULL, 0xFFFF07FFFFFFFFFFULL, 0xFFFFFF83FFFFFFFFULL, 0xFFFFFFE1FFFFFFFFULL,
+    0xFFFFC03FFFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFFF7FFFFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL,
+    0xFFFFFC3FFFFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFF80FFFFFFFFULL, 0xFFFFFF9FFFFFFFFFULL,
+    0xFFFFFE0FFFFFFFFFULL, 0xFFFFC07FFFFFFFFFULL, 0xFFFFF3FFFFFFFFFFULL, 0xFFFCFFFFFFFFFFFFULL,
+    0xFFFFE1FFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFFE1FFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL,
+    0xFFFF80FFFFFFFFFFULL, 0xFFFF80FFFFFFFFFFULL, 0xFFFF8FFFFFFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL,
+    0xFFFFFFCFFFFFFFFFULL, 0xFFFFFF07FFFFFFFFULL, 0xFFFFFF00FFFFFFFFULL, 0xFFFFFFC1FFFFFFFFULL,
+    0xFFFFFFFE03FFFFFFULL, 0xFFFF9FFFFFFFFFFFULL, 0xFFFFFFC1FFFFFFFFULL, 0xFFFF3FFFFFFFFFFFULL,
+    0xFFFE3FFFFFFFFFFFULL, 0xFFFFBFFFFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL, 0xFFFFFFC07FFFFFFFULL,
+    0xFFFFFFE0FFFFFFFFULL, 0xFFFFFFF87FFFFFFFULL, 0xFFFFFF8FFFFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL,
+    0xFFFFFFE01FFFFFFFULL, 0xFFFFFF01FFFFFFFFULL, 0xFFFFFF0FFFFFFFFFULL, 0xFFFFFF0FFFFFFFFFULL,
+    0xFFFFFF3FFFFFFFFFULL, 0xFFFE7FFFFFFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL,
+    0xFFFFF9FFFFFFFFFFULL, 0xFFFFFCFFFFFFFFFFULL, 0xFFFFFE7FFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL,
+    0xFFFFDFFFFFFFFFFFULL, 0xFFFFE1FFFFFFFFFFULL, 0xFFFF8FFFFFFFFFFFULL, 0xFFFFC7FFFFFFFFFFULL,
+    0xFFFF3FFFFFFFFFFFULL, 0xFFFF9FFFFFFFFFFFULL, 0xFFFE1FFFFFFFFFFFULL, 0xFFFFF1FFFFFFFFFFULL,
+    0xFFFFEFFFFFFFFFFFULL, 0xFFFFFC7FFFFFFFFFULL, 0xFFFFBFFFFFFFFFFFULL, 0xFFFFFF3FFFFFFFFFULL,
+    0xFFFFE3FFFFFFFFFFULL, 0xFFFFF1FFFFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL, 0xFFFFFE7FFFFFFFFFULL,
+    0xFFFFFFBFFFFFFFFFULL, 0xFFFE7FFFFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL,
+    0xFFFFFCFFFFFFFFFFULL, 0xFFFFFFF9FFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL, 0xFFFDFFFFFFFFFFFFULL,
+    0xFFFF1FFFFFFFFFFFULL, 0xFFFBFFFFFFFFFFFFULL, 0xFFFFF8FFFFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL,
+    0xFFFFFF3FFFFFFFFFULL, 0xFFFFFCFFFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL, 0xFFFF7FFFFFFFFFFFULL,
+    0xFFFDFFFFFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFF9FFFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL,
+    0xFFFFF7FFFFFFFFFFULL, 0xFFFDFFFFFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL,
+    0xFFFFFE1FFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFE1FFFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL,
+    0xFFFFFE3FFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL,
+    0xFFFFBFFFFFFFFFFFULL, 0xFFFEFFFFFFFFFFFFULL, 0xFFFFFE7FFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL,
+    0xFFFFFF0FFFFFFFFFULL, 0xFFFFC3FFFFFFFFFFULL, 0xFFFEFFFFFFFFFFFFULL, 0xFFFFF1FFFFFFFFFFULL,
+    0xFFFFFBFFFFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL, 0xFFFFFF9FFFFFFFFFULL, 0xFFFFF3FFFFFFFFFFULL,
+    0xFFFC3FFFFFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFFE1FFFFFFFFFFFULL, 0xFFFDFFFFFFFFFFFFULL,
+    0xFFFFFE1FFFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFFFFF0FFFFFFFFFULL,
+    0xFFFFFF0FFFFFFFFFULL, 0xFFFF7FFFFFFFFFFFULL, 0xFFFEFFFFFFFFFFFFULL, 0xFFFC3FFFFFFFFFFFULL,
+    0xFFFFFC3FFFFFFFFFULL, 0xFFF87FFFFFFFFFFFULL, 0xFFFFE1FFFFFFFFFFULL, 0xFFFFF87FFFFFFFFFULL,
+    0xFFFFBFFFFFFFFFFFULL, 0xFFFC3FFFFFFFFFFFULL, 0xFFFFFCFFFFFFFFFFULL, 0xFFF87FFFFFFFFFFFULL,
+    0xFFFFFE1FFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFF0FFFFFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL,
+    0xFFFF9FFFFFFFFFFFULL, 0xFFFFFC3FFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFFFFFE7FFFFFFFFULL,
+    0xFFFFFEFFFFFFFFFFULL, 0xFFFFFC3FFFFFFFFFULL, 0xFFFFFFE1FFFFFFFFULL, 0xFFFDFFFFFFFFFFFFULL,
+    0xFFF9FFFFFFFFFFFFULL, 0xFFFFE7FFFFFFFFFFULL, 0xFFFFF0FFFFFFFFFFULL, 0xFFFE7FFFFFFFFFFFULL,
+    0xFFFFF0FFFFFFFFFFULL, 0xFFFFFE7FFFFFFFFFULL, 0xFFF0FFFFFFFFFFFFULL, 0xFFFBFFFFFFFFFFFFULL,
+    0xFFFF7FFFFFFFFFFFULL, 0xFFFF3FFFFFFFFFFFULL, 0xFFFFCFFFFFFFFFFFULL, 0xFFF7FFFFFFFFFFFFULL,
+    0xFFFFFDFFFFFFFFFFULL, 0xFFFBFFFFFFFFFFFFULL, 0xFFFDFFFFFFFFFFFFULL, 0xFFF9FFFFFFFFFFFFULL,
+    0xFFFDFFFFFFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFF3FFFFFFFFFFFFULL, 0xFFFFF9FFFFFFFFFFULL,
+    0xFFFE7FFFFFFFFFFFULL, 0xFFFFF9FFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL,
+    0xFFFFF7FFFFFFFFFFULL, 0xFFEFFFFFFFFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL, 0xFFFF9FFFFFFFFFFFULL,
+    0xFFFFF7FFFFFFFFFFULL, 0xFFFFFCFFFFFFFFFFULL, 0xFFF7FFFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL,
+    0xFFF9FFFFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFE7FFFFFFFFFFFFULL,
+    0xFFFFF9FFFFFFFFFFULL, 0xFFFFFCFFFFFFFFFFULL, 0xFFFFFCFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL,
+    0xFFFCFFFFFFFFFFFFULL, 0xFFF3FFFFFFFFFFFFULL, 0xFFFFF3FFFFFFFFFFULL, 0xFFFFF9FFFFFFFFFFULL,
+    0xFFFFFF7FFFFFFFFFULL, 0xFFFF9FFFFFFFFFFFULL, 0xFFFFCFFFFFFFFFFFULL, 0xFFFE7FFFFFFFFFFFULL,
+    0xFFFF3FFFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFF9FFFFFFFFFFFFULL, 0xFFFFCFFFFFFFFFFFULL,
+    0xFFFFF7FFFFFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFFF7FFFFFFFFFFFULL,
+    0xFFFFF9FFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFFFE7FFFFFFFFFFULL, 0xFFFF9FFFFFFFFFFFULL,
+    0xFFFFCFFFFFFFFFFFULL, 0xFFFFF3FFFFFFFFFFULL, 0xFFFFFF9FFFFFFFFFULL, 0xFFFFE7FFFFFFFFFFULL,
+    0xFFFF7FFFFFFFFFFFULL, 0xFFFFBFFFFFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL,
+    0xFFEFFFFFFFFFFFFFULL, 0xFFEFFFFFFFFFFFFFULL, 0xFFEFFFFFFFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFDFULL,
+    0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFEFFULL,
+    0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFF7FULL,
+    0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFCFULL, 0xFFFFFFFFFFFFFFCFULL,
+    0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFFFE7FULL,
+    0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFFF9FULL,
+    0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFFFFFFF8FFULL, 0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFFFFFFFDFFULL,
+    0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFDFFFULL,
+    0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFEFFFFULL,
+    0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFFCFFULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFFE7FULL,
+    0xFFFFFFFFFFFFFCFFULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFF9FFFULL, 0xFFFFFFFFFFFFFCFFULL,
+    0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFEFFFFULL,
+    0xFFFFFFFFFFF9FFFFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFEFFFFFULL,
+    0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFF7FFFULL,
+    0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFBFFFFULL,
+    0xFFFFFFFFFFFFFBFFULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFBFFFFULL,
+    0xFFFFFFFFFFFFF3FFULL, 0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFCFFFFULL, 0xFFFFFFFFFFF0FFFFULL,
+    0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFFFFEFFFFULL,
+    0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFBFFFFFFFULL,
+    0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFFCFFFFULL, 0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFF0FFFFULL,
+    0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFF9FFFFULL,
+    0xFFFFFFFFFFF9FFFFULL, 0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFFFC3FFFFULL, 0xFFFFFFFFFFFDFFFFULL,
+    0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFFCFFFFULL, 0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL,
+    0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFFFCFFFFULL, 0xFFFFEFFFFFFFFFFFULL,
+    0xFFFFEFFFFFFFFFFFULL, 0xFFFFBFFFFFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL,
+    0xFFFFFDFFFFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL,
+    0xFFFFFFFFFF87FFFFULL, 0xFFFFFFFFFFFF9FFFULL, 0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFFEFFFFFFULL,
+    0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFF9FFFFFFULL, 0xFFFFFFFFFFFFF3FFULL, 0xFFFFFFFFFF9FFFFFULL,
+    0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFFEFFFFULL,
+    0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFFF7FFFFFULL,
+    0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFF7FFFFFFULL,
+    0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFFE7FFFFFULL,
+    0xFFFFFFFFFF9FFFFFULL, 0xFFFFFFFFFF00FFFFULL, 0xFFFFFFFF3FFFFFFFULL, 0xFFFFFFFFFEFFFFFFULL,
+    0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFFFFBFFFFULL,
+    0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL,
+    0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFF7FFFFFFFULL,
+    0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFFFFF7FFFFFULL,
+    0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFCFFFFFFFFULL, 0xFFFFFFF3FFFFFFFFULL,
+    0xFFFFFFFFF1FFFFFFULL, 0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFFF7FFFFFFULL,
+    0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFF3FFFFFFULL, 0xFFFFFFFE7FFFFFFFULL, 0xFFFFFFFFEFFFFFFFULL,
+    0xFFFFFFFE7FFFFFFFULL, 0xFFFFFFFFE7FFFFFFULL, 0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL,
+    0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFF9FFFFFFFFULL, 0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFBFFFFFFFFULL,
+    0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFFF3FFFFFFULL, 0xFFFFFFF0FFFFFFFFULL,
+    0xFFFFFFF0FFFFFFFFULL, 0xFFFFFFFF8FFFFFFFULL, 0xFFFFFFFF1FFFFFFFULL, 0xFFFFFFF87FFFFFFFULL,
+    0xFFFFFFFCFFFFFFFFULL, 0xFFFFFFF3FFFFFFFFULL, 0xFFFFFFFCFFFFFFFFULL, 0xFFFFFFFF0FFFFFFFULL,
+    0xFFFFFFFFE3FFFFFFULL, 0xFFFFFFF7FFFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL,
+    0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFF9FFFFFFFFULL,
+    0xFFFFFFFF7FFFFFFFULL, 0xFFFFFFFCFFFFFFFFULL, 0xFFFFFFE7FFFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL,
+    0xFFFFFFBFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL, 0xFFFFFCFFFFFFFFFFULL,
+    0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL,
+    0xFFFFFFFBFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL, 0xFFFFFFFFEFFFFFFFULL,
+    0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL,
+    0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFFFCFFFFFFFULL, 0xFFFFFFF9FFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL,
+    0xFFFFFFFFBFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFFCFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL,
+    0xFFFFFFFDFFFFFFFFULL, 0xFFFFF7FFFFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL,
+    0xFFFFFF3FFFFFFFFFULL, 0xFFFFFF9FFFFFFFFFULL, 0xFFFF3FFFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL,
+    0xFFFFFFBFFFFFFFFFULL, 0xFFFF7FFFFFFFFFFFULL, 0xFFFFF87FFFFFFFFFULL, 0xFFFFF3FFFFFFFFFFULL,
+    0xFFFBFFFFFFFFFFFFULL, 0xFFFFFCFFFFFFFFFFULL, 0xFFFFCFFFFFFFFFFFULL, 0xFFFFFC3FFFFFFFFFULL,
+    0xFFFEFFFFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFCFFFFFFFFFFFFFULL, 0xFFF3FFFFFFFFFFFFULL,
+    0xFFFDFFFFFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL, 0xFFFFF7FFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFBULL,
+    0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFFBULL,
+    0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFEFULL,
+    0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFEFFULL,
+    0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFEFFULL,
+    0xFFFFFFFFFFFFFFCFULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFFFBFULL,
+    0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFF9FULL,
+    0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFBFULL,
+    0xFFFFFFFFFFFFFFCFULL, 0xFFFFFFFFFFFFFFBFULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFFFF9FULL,
+    0xFFFFFFFFFFFFFFBFULL, 0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFFBULL,
+    0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFDFULL,
+    0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFFCFFULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFF9FFULL,
+    0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFFFFDFFULL,
+    0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFF8FFULL,
+    0xFFFFFFFFFFFFF8FFULL, 0xFFFFFFFFFFFFFC7FULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFE1FFULL,
+    0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFFFCFULL,
+    0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFBFFFULL,
+    0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFFFF9FULL,
+    0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFFFFFC7FULL,
+    0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFFFF7FULL,
+    0xFFFFFFFFFFFFF0FFULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFFF9FULL,
+    0xFFFFFFFFFFFCFFFFULL, 0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFFFFFDFFULL,
+    0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFFFDFFULL,
+    0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFFE1FFULL,
+    0xFFFFFFFFFFFC7FFFULL, 0xFFFFFFFFFFFF1FFFULL, 0xFFFFFFFFFFF8FFFFULL, 0xFFFFFFFFFFFFFEFFULL,
+    0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFDFFFULL,
+    0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFF7FFFULL,
+    0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFBFFFULL,
+    0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFFFFBFFFULL,
+    0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFF9FFFULL, 0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFFFFFF9FFULL,
+    0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFF01FFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFFFFFC1FFULL,
+    0xFFFFFFFFFFC0FFFFULL, 0xFFFFFFFFFFFF81FFULL, 0xFFFFFFFFFFF1FFFFULL, 0xFFFFFFFFFFFFF7FFULL,
+    0xFFFFFFFFFFFF3FFFULL, 0xFFFFFFFFFFFFE1FFULL, 0xFFFFFFFFFFFFE1FFULL, 0xFFFFFFFFFFFC7FFFULL,
+    0xFFFFFFFFFFFFFCFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFFFFC3FFFULL,
+    0xFFFFFFFFFFFFE1FFULL, 0xFFFFFFFFFFFE3FFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFFFFDFFFFULL,
+    0xFFFFFFFFFFFFFBFFULL, 0xFFFFFFFFFCFFFFFFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFF7FFFFULL,
+    0xFFFFFFFFFFFFF3FFULL, 0xFFFFFFFFFFFFFBFFULL, 0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFF3FFFULL,
+    0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFC7FFFULL, 0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFFFF7FULL,
+    0xFFFFFFFFFFFFFFBFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFFFFBFFULL,
+    0xFFFFFFFFFFFFE7FFULL, 0xFFFFFFFFFFFF1FFFULL, 0xFFFFFFFFFFCFFFFFULL, 0xFFFFFFFFFFFFBFFFULL,
+    0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFBFFFFULL,
+    0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFE3FFFFFULL, 0xFFFFFFFFFC7FFFFFULL, 0xFFFFFFFFFFFFEFFFULL,
+    0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFFCFFFFULL, 0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFEFFFFFFFULL,
+    0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFF9FFFFFULL,
+    0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFFE3FFFFULL,
+    0xFFFFFF7FFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFFFCFFFFULL,
+    0xFFFFFFFFF3FFFFFFULL, 0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFFFF3FFFULL,
+    0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFEFFFFFFFFFFFULL,
+    0xFFFFFFBFFFFFFFFFULL, 0xFFFFF7FFFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL,
+    0xFFFFFF7FFFFFFFFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFFDFFFULL,
+    0xFFFFFFFFFFFFEFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL,
+    0xFFFFFDFFFFFFFFFFULL, 0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFFFFFDFFFULL,
+    0xFFFFFFFFFFFFF3FFULL, 0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFFFCFFFFULL, 0xFFFFFFFFFFEFFFFFULL,
+    0xFFFFFFFFFFFF3FFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFFFDFFFFFFULL,
+    0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFF9FFFFFULL,
+    0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFFFFFF7FFFULL,
+    0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL,
+    0xFFFFFFFFFFE03FFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFFF7FFFFFULL,
+    0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFFF9FFFFFULL,
+    0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFF7FFFFFFFFULL,
+    0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFFFC03FFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL,
+    0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFF7FFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL,
+    0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFF3FFFFFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL,
+    0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFE7FFFFFFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL,
+    0xFFFFFFFF7FFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFEFFFFFFFFFFFFULL,
+    0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFE7FFFFFFFFULL, 0xFFFFFFFF3FFFFFFFULL,
+    0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFCFFFFFFFFULL, 0xFFFF7FFFFFFFFFFFULL, 0xFFFFFF3FFFFFFFFFULL,
+    0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL, 0xFFFFFCFFFFFFFFFFULL,
+    0xFFFFF7FFFFFFFFFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFC3FFFFFFFFULL,
+    0xFFFFFFF7FFFFFFFFULL, 0xFFFFFC3FFFFFFFFFULL, 0xFFFFFFC3FFFFFFFFULL, 0xFFFFFFFFC7FFFFFFULL,
+    0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL,
+    0xFFFFFBFFFFFFFFFFULL, 0xFFFFBFFFFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL,
+    0xFFFFFF0FFFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL,
+    0xFFFF8FFFFFFFFFFFULL, 0xFFFFF3FFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFF3FFFFFFFFFFULL,
+    0xFFFFBFFFFFFFFFFFULL, 0xFFFFCFFFFFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFDFFFFFFFFFFFFFULL,
+    0xFFFFBFFFFFFFFFFFULL, 0xFFFEFFFFFFFFFFFFULL, 0xFFFBFFFFFFFFFFFFULL, 0xFFF7FFFFFFFFFFFFULL,
+    0xFFFFF7FFFFFFFFFFULL, 0xFFE7FFFFFFFFFFFFULL, 0xFFFFF7FFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL,
+    0xFFFFFBFFFFFFFFFFULL, 0xFFFF7FFFFFFFFFFFULL, 0xFFFFBFFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL,
+    0xFFF7FFFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFF7FFFFFFFFFFFFULL, 0xFFFFF7FFFFFFFFFFULL,
+    0xFFFF7FFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFCFULL,
+    0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFFFBULL,
+    0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFFBULL,
+    0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFF9FULL,
+    0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFBFFULL, 0xFFFFFFFFFFFFFCFFULL, 0xFFFFFFFFFFFFFFF7ULL,
+    0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFFFCFULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFCFULL,
+    0xFFFFFFFFFFFFFFCFULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFF0FFULL, 0xFFFFFFFFFFFFFFEFULL,
+    0xFFFFFFFFFFFFFFCFULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFFFF7ULL,
+    0xFFFFFFFFFFFFFFCFULL, 0xFFFFFFFFFFFFF3FFULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFF7ULL,
+    0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFFFBFULL,
+    0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFF0FFULL, 0xFFFFFFFFFFFFF8FFULL,
+    0xFFFFFFFFFFFFF0FFULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFF7ULL,
+    0xFFFFFFFFFFFFFFCFULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFFF7ULL,
+    0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFBFULL,
+    0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFF8FFULL, 0xFFFFFFFFFFFFFFBFULL,
+    0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFEFFULL,
+    0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFFEFFFULL,
+    0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFEFFFFULL,
+    0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFFFFFBFULL, 0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFFFBFFULL,
+    0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFEFFULL,
+    0xFFFFFFFFFFFFE1FFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFF7FFFULL,
+    0xFFFFFFFFFFFFFFF7ULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFFFBFFULL, 0xFFFFFFFFFFFFF9FFULL,
+    0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFFFFBFFFULL,
+    0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFF9FFFULL, 0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFFBFFFULL,
+    0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFFFCFFULL, 0xFFFFFFFFFFFFDFFFULL,
+    0xFFFFFFFFFFFFFE7FULL, 0xFFFFFFFFFFFFFBFFULL, 0xFFFFFFFFFFFFF8FFULL, 0xFFFFFFFFFFE0FFFFULL,
+    0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFC1FFFULL, 0xFFFFFFFFFFFFC1FFULL,
+    0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFFF0FFULL, 0xFFFFFFFFFFF81FFFULL, 0xFFFFFFFFFFFFF1FFULL,
+    0xFFFFFFFFFFFC3FFFULL, 0xFFFFFFFFFFFF81FFULL, 0xFFFFFFFFFFFC3FFFULL, 0xFFFFFFFFFFFFFF9FULL,
+    0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFF87FFFULL, 0xFFFFFFFFFFFF81FFULL, 0xFFFFFFFFFFFFE1FFULL,
+    0xFFFFFFFFFFFFFCFFULL, 0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFFFFFFFDFFULL,
+    0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFF81FFFULL, 0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFFFFFFFFDFULL,
+    0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFC1FFFFULL, 0xFFFFFFFFFFE0FFFFULL,
+    0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFFFC0FFFFULL, 0xFFFFFFFFFFFF3FFFULL, 0xFFFFFFFFFFFFF8FFULL,
+    0xFFFFFFFFFFFF1FFFULL, 0xFFFFFFFFFFF0FFFFULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFDFFFULL,
+    0xFFFFFFFFFFFFE7FFULL, 0xFFFFFFFFFFFFF3FFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFEFFFFULL,
+    0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFFDFFFFULL,
+    0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFFFFFEFFFULL,
+    0xFFFFFFFFFFFCFFFFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFEFFFFFFULL,
+    0xFFFFFFFFFFF9FFFFULL, 0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFF7FFFFULL,
+    0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFFFFDFFFFULL, 0xFFFFFFFFFFFF9FFFULL,
+    0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFFFE7FFULL, 0xFFFFFFFFFEFFFFFFULL,
+    0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFFF9FFFFFULL, 0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFF9FFFFULL,
+    0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFF9FFFFULL,
+    0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFFFFF7FULL,
+    0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFFFFFE7FFULL,
+    0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFF7FFFFULL,
+    0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFFFFCFFFFULL,
+    0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFFF7FFFFFULL,
+    0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFCFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL, 0xFFFFFFFFFDFFFFFFULL,
+    0xFFFFFFFFE7FFFFFFULL, 0xFFFEFFFFFFFFFFFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFFDFFFFFFULL,
+    0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL,
+    0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFFFFFDFFFFFULL,
+    0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFDFFFFFFFULL,
+    0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL, 0xFFFFFF9FFFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL,
+    0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFEFFFFFFFFFULL,
+    0xFFFFFEFFFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL,
+    0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFFFF7FFFFULL,
+    0xFFFFFFFFFEFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL,
+    0xFFFFF7FFFFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFF0FFFFFFULL,
+    0xFFFFFFFFFDFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFFFFFFF80FFFFFFULL, 0xFFFFFFFDFFFFFFFFULL,
+    0xFFFFFFFFFFCFFFFFULL, 0xFFFFFFFFF9FFFFFFULL, 0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFE03FFFFFULL,
+    0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFFC3FFFFFULL, 0xFFFFFFFFFFCFFFFFULL,
+    0xFFFFFFFFFFCFFFFFULL, 0xFFFFFFFFFCFFFFFFULL, 0xFFFFFFFE7FFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL,
+    0xFFFFFC3FFFFFFFFFULL, 0xFFFFFFFFF01FFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFFFFFEFFFFFULL,
+    0xFFFFFFFE1FFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFFF9FFFFFFFFFULL, 0xFFFFFFFF807FFFFFULL,
+    0xFFFFFFFF9FFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL, 0xFFFFFF9FFFFFFFFFULL,
+    0xFFFFFC3FFFFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL, 0xFFFFFFFE7FFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL,
+    0xFFFFFF87FFFFFFFFULL, 0xFFFFFFE7FFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL, 0xFFFFFFFFFE1FFFFFULL,
+    0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFF87FFFFFFFULL, 0xFFFFFFF0FFFFFFFFULL, 0xFFFFFFFF0FFFFFFFULL,
+    0xFFFFFFF9FFFFFFFFULL, 0xFFFFFFFFFFF01FFFULL, 0xFFFFFFFFF00FFFFFULL, 0xFFFFFFFFF80FFFFFULL,
+    0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFF0FFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL,
+    0xFFFFFFFE01FFFFFFULL, 0xFFFFFFFFFF807FFFULL, 0xFFFFFFFFCFFFFFFFULL, 0xFFFFFFFFFE01FFFFULL,
+    0xFFFFFFFFC07FFFFFULL, 0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFFCFFFFFFULL, 0xFFFFFFFF00FFFFFFULL,
+    0xFFFFFFFFE1FFFFFFULL, 0xFFFFFFFC3FFFFFFFULL, 0xFFFFFFFF00FFFFFFULL, 0xFFFFFFFC07FFFFFFULL,
+    0xFFFFFFF3FFFFFFFFULL, 0xFFFFFFFF3FFFFFFFULL, 0xFFFFFFFF0FFFFFFFULL, 0xFFFFFFFFF807FFFFULL,
+    0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFF3FFFFFFULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFE1FFFFFFFULL,
+    0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFE1FFFFFFFULL, 0xFFFFFFFFE01FFFFFULL,
+    0xFFFFFFFFFC07FFFFULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL,
+    0xFFFFFFFE7FFFFFFFULL, 0xFFFFFFFFE03FFFFFULL, 0xFFFFFFF00FFFFFFFULL, 0xFFFFFFFF00FFFFFFULL,
+    0xFFFFFFFF0FFFFFFFULL, 0xFFFFFFFFF80FFFFFULL, 0xFFFFFFFFF01FFFFFULL, 0xFFFFFFFF01FFFFFFULL,
+    0xFFFFFFFFF807FFFFULL, 0xFFFFFFFC3FFFFFFFULL, 0xFFFFFFC03FFFFFFFULL, 0xFFFFFFFF807FFFFFULL,
+    0xFFFFFFFFFE03FFFFULL, 0xFFFFFFFC03FFFFFFULL, 0xFFFFFFFFFC03FFFFULL, 0xFFFFFFEFFFFFFFFFULL,
+    0xFFFFFFFFF00FFFFFULL, 0xFFFFF3FFFFFFFFFFULL, 0xFFFFFE1FFFFFFFFFULL, 0xFFFFFFC3FFFFFFFFULL,
+    0xFFFFFE1FFFFFFFFFULL, 0xFFFFFFFE1FFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFF9FFFFFFFFULL,
+    0xFFFFF87FFFFFFFFFULL, 0xFFFFFFF87FFFFFFFULL, 0xFFFFFE7FFFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL,
+    0xFFFFFFFFFE03FFFFULL, 0xFFFFFFFFFF00FFFFULL, 0xFFFFFFFC03FFFFFFULL, 0xFFFFFFFFFC07FFFFULL,
+    0xFFFFFFFFFC03FFFFULL, 0xFFFFFFFFF0FFFFFFULL, 0xFFFFFBFFFFFFFFFFULL, 0xFFFFFFFFEFFFFFFFULL,
+    0xFFFFFFF7FFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFFCFFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL,
+    0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFFCFFFFFFFULL,
+    0xFFFFFFFFF9FFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFFFFFFF80FFFFFFULL,
+    0xFFFFFFFCFFFFFFFFULL, 0xFFFFFFFF0FFFFFFFULL, 0xFFFFFC3FFFFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL,
+    0xFFFFFFF87FFFFFFFULL, 0xFFFFFF0FFFFFFFFFULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFDFFFFFFFFFULL,
+    0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL,
+    0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL,
+    0xFFFFFF9FFFFFFFFFULL, 0xFFFFFFF3FFFFFFFFULL, 0xFFFFFFFFC07FFFFFULL, 0xFFFFFDFFFFFFFFFFULL,
+    0xFFFFFF0FFFFFFFFFULL, 0xFFFFFFF9FFFFFFFFULL, 0xFFFFFFFF9FFFFFFFULL, 0xFFFFFFFFCFFFFFFFULL,
+    0xFFFFFFCFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL,
+    0xFFFFFFFBFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL,
+    0xFFFFFFF9FFFFFFFFULL, 0xFFFFFFFE7FFFFFFFULL, 0xFFFFFCFFFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL,
+    0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL, 0xFFFFBFFFFFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL,
+    0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFF7FFFFFFFFFFULL,
+    0xFFFFFFEFFFFFFFFFULL, 0xFFFF9FFFFFFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL,
+    0xFFFFFFEFFFFFFFFFULL, 0xFFFF7FFFFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL,
+    0xFFFFFF7FFFFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL,
+    0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFFFFBFFFFFFULL,
+    0xFFFFF9FFFFFFFFFFULL, 0xFFFFFFFFCFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL,
+    0xFFFFFFF87FFFFFFFULL, 0xFFFFFFF7FFFFFFFFULL, 0xFFFFFE1FFFFFFFFFULL, 0xFFFFCFFFFFFFFFFFULL,
+    0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFFF3FFFFFFFULL, 0xFFFF3FFFFFFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL,
+    0xFFFFE7FFFFFFFFFFULL, 0xFFFFFF0FFFFFFFFFULL, 0xFFFFFF87FFFFFFFFULL, 0xFFFFFFE1FFFFFFFFULL,
+    0xFFFFFFE1FFFFFFFFULL, 0xFFFFDFFFFFFFFFFFULL, 0xFFFFF3FFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL,
+    0xFFFFFFCFFFFFFFFFULL, 0xFFFFFFFFF3FFFFFFULL, 0xFFFFFFFE3FFFFFFFULL, 0xFFFFFFFFF9FFFFFFULL,
+    0xFFFFFFF9FFFFFFFFULL, 0xFFFFFFE7FFFFFFFFULL, 0xFFFF87FFFFFFFFFFULL, 0xFFFFF7FFFFFFFFFFULL,
+    0xFFFFFFC3FFFFFFFFULL, 0xFFFFFFF0FFFFFFFFULL, 0xFFFFFFCFFFFFFFFFULL, 0xFFF7FFFFFFFFFFFFULL,
+    0xFFFFFBFFFFFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL, 0xFFDFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFF7ULL,
+    0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFBFULL, 0xFFFFFFFFFFFFFFFCULL,
+    0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFCFULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFDULL,
+    0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFDFULL,
+    0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFBFULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFFF9ULL,
+    0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFF9ULL,
+    0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFDFFULL,
+    0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFF00ULL,
+    0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFDFULL,
+    0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFFCULL,
+    0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFFFEFFULL,
+    0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFEFULL, 0xFFFFFFFFFFFFFFE1ULL, 0xFFFFFFFFFFFFFFF0ULL,
+    0xFFFFFFFFFFFFFBFFULL, 0xFFFFFFFFFFFFFBFFULL, 0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFFFFFFFFF9ULL,
+    0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFFBULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFFF9ULL,
+    0xFFFFFFFFFFFFFFF0ULL, 0xFFFFFFFFFFFFFFFDULL, 0xFFFFFFFFFFFFFFF9ULL, 0xFFFFFFFFFFFFFEFFULL,
+    0xFFFFF7FFFFFFFFFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFFDFFULL,
+    0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFFEFFFULL,
+    0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFF7FFFULL,
+    0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFCFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL,
+    0xFFFFFFFFFFF3FFFFULL, 0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFF3FFFFFFULL, 0xFFFFFFFFFFFFF7FFULL,
+    0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFFF9FFFULL, 0xFFFFFFFFFFFDFFFFULL,
+    0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFF9FFFFFFULL, 0xFFFFFFFFFFFBFFFFULL, 0xFFFFFDFFFFFFFFFFULL,
+    0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFF7FFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFFFEFFFFFFULL,
+    0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFFFFFF7FFULL, 0xFFFFFFFFFFDFFFFFULL,
+    0xFFFFFFFFEFFFFFFFULL, 0xFFFFF9FFFFFFFFFFULL, 0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFFFF3FFFFULL,
+    0xFFFFFFFFFFFF9FFFULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFFFDFFFULL,
+    0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFFF87FFULL,
+    0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFFFFE7FFFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFBFFFULL,
+    0xFFFFFFFFFFFF1FFFULL, 0xFFFFFFFFFFFF7FFFULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFFFEFFFFULL,
+    0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFFCFFFFULL, 0xFFFFFFFFFFFF7FFFULL,
+    0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFF7FFFFFFFFFFULL,
+    0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFFF1FFULL,
+    0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFFFFFEFFFFFULL,
+    0xFFFFFFFFFFFBFFFFULL, 0xFFFFFEFFFFFFFFFFULL, 0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFF7FFFFFULL,
+    0xFFFFFDFFFFFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL, 0xFFFFF7FFFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL,
+    0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFDFFFFFFFFFULL, 0xFFFFF7FFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL,
+    0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFFFF0FFFULL, 0xFFFFFFFFFC3FFFFFULL,
+    0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFFFC7FFFFULL, 0xFFFFFFFFFFFFFF9FULL, 0xFFFFFFFFFF3FFFFFULL,
+    0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFFFFC3FFFULL, 0xFFFFFFFFFFF7FFFFULL, 0xFFFFFFFFFFEFFFFFULL,
+    0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFFFDFFFFFULL,
+    0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFCFFFFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFFFFFFBFFULL,
+    0xFFFFFFFFFF9FFFFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFFF0FFFULL,
+    0xFFFFFFFFFFFF3FFFULL, 0xFFFFFFFFFFFF1FFFULL, 0xFFFFFFFFFFF8FFFFULL, 0xFFFFFFFFFFFFE1FFULL,
+    0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFFFFFF8FFFFULL, 0xFFFFFFFFFFF8FFFFULL,
+    0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFFFFFDFULL,
+    0xFFFFFFFFFFBFFFFFULL, 0xFFFFFFFFFFFBFFFFULL, 0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFFDFFFFFFULL,
+    0xFFFFFFFFFFFCFFFFULL, 0xFFFFFFFFFFFFBFFFULL, 0xFFFFFFFFFFFFFDFFULL, 0xFFFFFFFFFFFFFDFFULL,
+    0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFEFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFFFFEFFFFFULL,
+    0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFFFFFF1FFULL, 0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFFCFFULL,
+    0xFFFFFFFFFFFFF9FFULL, 0xFFFFFFFFFFFFDFFFULL, 0xFFFFFFFFFFFFFFDFULL, 0xFFFFFFFFFFFFFFDFULL,
+    0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFFFC3FFFFULL, 0xFFFFFFFFFFC3FFFFULL, 0xFFFFFFFFFFFE7FFFULL,
+    0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFFFFFFE1FFFULL, 0xFFFFFFFFF3FFFFFFULL, 0xFFFFFFFFFFE1FFFFULL,
+    0xFFFFFFFFFFF87FFFULL, 0xFFFFFFFFFFFFCFFFULL, 0xFFFFFFFFFFFF0FFFULL, 0xFFFFFFFFFFFE7FFFULL,
+    0xFFFFFFFFFFE7FFFFULL, 0xFFFFFFFFFFFFFF7FULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFF3FFFFFFFFFULL,
+    0xFFFFFFE7FFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFF7FFFFFFFFFULL,
+    0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFFFEFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL,
+    0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFFFFFEFFFFULL, 0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL,
+    0xFFFFFFFBFFFFFFFFULL, 0xFFFF7FFFFFFFFFFFULL, 0xFFFFFFFF7FFFFFFFULL, 0xFFFFFEFFFFFFFFFFULL,
+    0xFFFFFFFF7FFFFFFFULL, 0xFFFFFDFFFFFFFFFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFCFFFFFFFFULL,
+    0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFF8FFFFFFULL,
+    0xFFFFFFFFFFDFFFFFULL, 0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFFF7FFFFFFULL,
+    0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFFF8FFFFFFULL, 0xFFFFFFF3FFFFFFFFULL, 0xFFFFFFE1FFFFFFFFULL,
+    0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFF3FFFFFFFULL, 0xFFFFFF0FFFFFFFFFULL, 0xFFFFFFFF9FFFFFFFULL,
+    0xFFFFFDFFFFFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFFBFFFFFFFULL,
+    0xFFFFFFFFFDFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFFFE7FFFFFULL, 0xFFFFFFFFFFFBFFFFULL,
+    0xFFFFFFBFFFFFFFFFULL, 0xFFFFFFFFF3FFFFFFULL, 0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFF7FFFFFFFULL,
+    0xFFFFFFFBFFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFFFFFCFFFFULL, 0xFFFFFCFFFFFFFFFFULL,
+    0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL, 0xFFFFFFEFFFFFFFFFULL,
+    0xFFFFFFFF7FFFFFFFULL, 0xFFFFFFF3FFFFFFFFULL, 0xFFFFFFFFF7FFFFFFULL, 0xFFFFFFFFFFF7FFFFULL,
+    0xFFFFFFFFFFF9FFFFULL, 0xFFFFFFFFFFCFFFFFULL, 0xFFFFFFFFFF7FFFFFULL, 0xFFFFFFFF8FFFFFFFULL,
+    0xFFFFFFFFEFFFFFFFULL, 0xFFFFFFFCFFFFFFFFULL, 0xFFFFFFFFCFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL,
+    0xFFFFFFFFFF3FFFFFULL, 0xFFFFFFFFE7FFFFFFULL, 0xFFFFFFFFE7FFFFFFULL, 0xFFFFFFFE1FFFFFFFULL,
+    0xFFFFFFFF8FFFFFFFULL, 0xFFFFFFFFFBFFFFFFULL, 0xFFFFFFF87FFFFFFFULL, 0xFFFFFFFFFC07FFFFULL,
+    0xFFFFFFFFFFFFEFFFULL, 0xFFFFFFFFF87FFFFFULL, 0xFFFFFFF0FFFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL,
+    0xFFFFFFFFE7FFFFFFULL, 0xFFFFFFFFCFFFFFFFULL, 0xFFFFFFFFC3FFFFFFULL, 0xFFFFFFFFE7FFFFFFULL,
+    0xFFFFFFFCFFFFFFFFULL, 0xFFFFFFFBFFFFFFFFULL, 0xFFFFFF3FFFFFFFFFULL, 0xFFFFFFF87FFFFFFFULL,
+    0xFFFFFFF87FFFFFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFF3FFFFFFFFULL, 0xFFFFFFFFC3FFFFFFULL,
+    0xFFFFFFFFE7FFFFFFULL, 0xFFFFFFFDFFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFFDFFFFFFFULL,
+    0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFFFEFFFFFFULL, 0xFFFFFFFFBFFFFFFFULL, 0xFFFFFFFEFFFFFFFFULL,
+    0xFFFFFDFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL, 0xFFFFBFFFFFFFFFFFULL, 0xFFFFFBFFFFFFFFFFULL,
+    0xFFFDFFFFFFFFFFFFULL, 0xFFFFBFFFFFFFFFFFULL, 0xFFBFFFFFFFFFFFFFULL, 0xFFFFEFFFFFFFFFFFULL,
+};
+
+static const uint16_t voltage_qs_leaf_offset[50] = {
+    0, 55, 110, 155, 206, 250, 294, 338, 382, 431, 479, 527, 573, 619, 660, 701,
+    755, 808, 854, 901, 947, 1001, 1052, 1101, 1151, 1204, 1256, 1301, 1357, 1404, 1455, 1505,
+    1554, 1608, 1654, 1698, 1751, 1799, 1852, 1897, 1942, 1991, 2034, 2081, 2126, 2174, 2220, 2268,
+    2307, 2355,
+};
+
+static const double voltage_qs_leaf_value[2398] = {
+    1256.7373293768533, 1258.7764655172425, 1289.68, 1262.2384905660388,
+    1308.0, 1297.315, 1289.6825000000001, 1279.6119999999999,
+    1257.63, 1265.2649999999999, 4548.23, 2450.548,
+    1273.2333043478272, 1302.3911224489793, 1732.2949999999998, 1338.4759375000003,
+    3220.39, 3421.86, 3922.47, 4681.01,
+    4629.12, 1600.6550000000002, 1470.7983333333334, 1285.1,
+    1289.68, 2344.0045833333334, 3174.0933333333337, 1265.26,
+    4681.01, 3161.741428571429, 5183.15, 4046.2204166666666,
+    4569.676802325581, 4745.8473, 3147.13, 3826.31,
+    1303.42, 1349.21, 1613.25, 2312.27,
+    5144.1050000000005, 4910.816826923076, 4400.565, 4777.319,
+    5015.3722857142875, 5100.864214285711, 4618.44, 5258.443333333334,
+    5195.32590909091, 5229.665238095238, 5264.551111111111, 5299.143333333333,
+    5359.195172413793, 5429.2575, 5400.643333333333, 1256.5224120603018,
+    1257.4305988023964, 1259.6371532846715, 1262.4964062500003, 1504.501875,
+    1265.26, 1275.1901984126994, 1314.8298809523806, 1932.2366666666667,
+    2466.42, 3321.125, 3644.69, 1412.546428571429,
+    1311.658, 1891.03, 4681.01, 5170.94,
+    3922.47, 2388.582, 1633.6625, 3027.065,
+    2558.0, 3821.73, 3444.75, 2255.8,
+    1491.15, 1393.47, 3466.1184210526317, 4393.384181818183,
+    4628.392810457514, 4399.192, 4780.162962962962, 4870.897936507936,
+    1349.21, 1286.63, 1465.2, 1613.25,
+    2917.886, 1280.53, 4948.11, 4990.294444444446,
+    4857.782727272728, 4600.12, 4494.81, 4496.34,
+    5104.900328947371, 4618.44, 5179.8890909090915, 5083.5625,
+    5206.436285714286, 5237.892399999998, 5330.69, 5298.4914285714285,
+    5365.894666666666, 5410.5633333333335, 5024.42, 1258.4505584642238,
+    1288.921, 2907.51, 1296.4139751552805, 2466.42,
+    2052.81, 1704.82, 1370.2100000000003, 3644.69,
+    3421.86, 1514.8025, 1407.01125, 1823.1100000000001,
+    1513.0266666666666, 4884.77, 4049.15, 3271.966250000001,
+    2216.1150000000002, 4206.0445, 1393.47, 4557.141813471502,
+    4731.717012987015, 1303.42, 1280.53, 1465.2,
+    1613.25, 2312.27, 3147.13, 4876.624246575341,
+    4183.46, 5114.775333333333, 4985.06101010101, 3553.6233333333334,
+    2991.45, 4710.359090909092, 3992.67, 5106.709915966388,
+    4618.44, 5177.212, 5223.661355932204, 5289.3772,
+    5337.8116666666665, 5381.3725, 5405.011363636363, 1256.9700261780104,
+    1258.9846835443047, 1289.68, 1261.460740740741, 1651.7849999999999,
+    4674.91, 843.5066666666667, 1288.1479204892967, 1927.66,
+    3644.69, 3421.86, 1463.5363636363636, 1691.85,
+    1413.8183333333334, 1312.268, 5170.94, 4681.01,
+    2040.6, 1630.8, 2442.0, 2168.8050000000003,
+    2683.15, 2800.67, 2916.67, 3221.92,
+    3373.02, 5183.15, 3998.34380952381, 4565.754620689654,
+    4731.792364864865, 3147.13, 3826.31, 1349.21,
+    1303.42, 1465.2, 1613.25, 2312.27,
+    5219.78, 5108.976000000001, 4870.315538461539, 4993.982884615383,
+    2991.45, 4743.382272727273, 3992.67, 4496.34,
+    5157.673333333333, 5095.424456521737, 5204.918625, 5239.889803921567,
+    5297.2375, 5376.203777777778, 5024.42, 1257.3598689956334,
+    1261.5939495798314, 1294.0933333333332, 1271.2592857142856, 1513.635333333333,
+    4674.91, 1281.3934650455935, 1464.8360000000002, 3421.86,
+    3644.69, 4629.12, 1660.3066666666666, 1990.743333333333,
+    1463.2949999999998, 1330.38, 4681.01, 4952.69,
+    3922.47, 3821.73, 3444.75, 2205.6237499999997,
+    3250.289411764705, 3823.263333333334, 4025.4900000000002, 3396.67,
+    4185.796666666667, 4442.794, 1280.53, 4615.197660818713,
+    4832.288347107437, 3806.2166666666667, 4948.11, 1303.42,
+    2312.27, 3147.13, 5005.439, 4770.6647826086955,
+    4496.34, 5106.009448818896, 5178.902826086955, 5246.646410256409,
+    5338.826666666667, 5395.9, 5024.42, 1259.4202080000007,
+    1235.0268918918916, 2470.748333333333, 1292.895730337079, 1521.367,
+    1891.03, 3644.69, 3922.47, 4629.12,
+    4681.01, 2315.32, 2562.58, 2916.67,
+    3183.2533333333336, 1571.785, 2177.5271428571427, 3444.75,
+    1393.47, 3518.9836363636364, 4086.4704545454547, 4592.990967741935,
+    3906.6949999999997, 4796.139166666664, 4004.885, 1303.42,
+    1465.2, 2991.45, 5075.397999999999, 4945.957346938777,
+    5049.429142857143, 5122.143333333334, 4665.241666666666, 4923.6849999999995,
+    4663.21, 4936.885882352941, 5228.327, 5126.087014925374,
+    5187.858857142858, 5229.239242424243, 5268.745833333333, 5309.321333333334,
+    5375.458125, 5408.577, 5024.42, 1257.3765145228206,
+    1263.1875000000002, 1304.336, 1289.6825000000003, 1637.9730000000002,
+    4611.57, 1281.5686024844733, 1495.0836842105266, 3421.86,
+    3644.69, 4629.12, 1488.398, 1668.005,
+    3696.0699999999997, 2247.2292307692305, 5183.15, 4317.509999999999,
+    3096.984285714286, 3853.3370588235293, 4596.038819188189, 3147.13,
+    4885.206499999999, 3826.31, 1465.2, 1286.63,
+    1349.21, 2991.45, 3417.28, 5119.189090909091,
+    4962.104605263156, 5070.781000000001, 5118.442857142855, 4673.38125,
+    4919.491666666667, 3992.67, 5160.577236842104, 5073.259333333333,
+    5222.885689655172, 5120.57, 5257.5575, 5299.8629411764705,
+    5350.482727272727, 5393.555714285714, 5024.42, 1258.2884793388425,
+    1290.4466666666667, 2270.2988888888885, 1302.3427914110432, 3220.39,
+    3421.86, 1423.0746666666669, 1891.03, 5170.94,
+    4952.69, 4629.12, 2360.5, 2846.766,
+    1606.1266666666668, 2081.81, 3821.73, 4881.866,
+    4099.003333333333, 3454.3843750000005, 1944.44, 3089.135,
+    4511.487247706421, 4926.570740740741, 4689.799558011047, 1613.25,
+    1349.21, 1280.53, 4948.11, 3147.13,
+    1286.63, 4889.200192307692, 5030.120408163265, 4754.655,
+    4888.58375, 3992.67, 5120.325581395347, 4618.44,
+    5175.2136, 5222.356125, 5269.978888888889, 5310.339166666668,
+    5363.338235294118, 5408.317647058823, 1257.2904845814971, 1262.2096330275238,
+    1304.565, 1283.325, 1797.4885714285713, 4611.57,
+    1274.1061904761912, 1315.8281159420287, 2052.81, 2466.42,
+    3421.86, 1704.82, 1390.601212121212, 1891.03,
+    5170.94, 4629.12, 2370.7766666666666, 1864.9122222222222,
+    3538.995, 2255.8, 3112.7883333333334, 3726.3433333333337,
+    1944.44, 5183.15, 4054.8062499999996, 1393.47,
+    4564.043734939759, 4050.452142857143, 4713.475897435896, 4862.418095238095,
+    1613.25, 1288.16, 2312.27, 1286.63,
+    3373.523333333333, 4948.11, 4919.797741935485, 4547.465,
+    4496.34, 5073.779350000001, 3992.67, 5212.427272727273,
+    5140.306428571428, 5221.251097560977, 5260.926666666666, 5306.5216666666665,
+    5340.481666666667, 5371.023333333334, 5400.642, 1256.3896932515336,
+    1257.3882474226814, 1259.4694890510948, 1262.577407407407, 1306.47,
+    1275.2353333333333, 1289.68, 1295.79, 1266.79,
+    4674.91, 1679.3844444444444, 1927.66, 1283.1566366366362,
+    1405.2800000000002, 5170.94, 4681.01, 3644.69,
+    3220.39, 1725.58, 2522.3866666666668, 1517.0942857142857,
+    1265.26, 3821.73, 3922.47, 4681.01,
+    2881.1825000000003, 3854.55, 1944.44, 3198.3466666666664,
+    4475.19292929293, 4797.448943661971, 3897.7400000000002, 1489.318,
+    3097.9075, 4948.11, 4964.917464788733, 4632.784000000001,
+    4496.34, 5088.918109452736, 3992.67, 5221.508666666667,
+    5161.7065, 5225.122325581396, 5261.6765, 5340.052,
+    5303.5337500000005, 5367.023684210528, 5414.487142857142, 5024.42,
+    1258.3421441441449, 1284.2108408408424, 1820.8166666666666, 1357.9948484848485,
+    3644.69, 3220.39, 1697.1916666666668, 1417.9964285714286,
+    4952.69, 5170.94, 4629.12, 3922.47,
+    2040.5999999999997, 2378.66, 1796.4, 1265.26,
+    2712.53, 2973.442, 2081.81, 4037.644642857143,
+    4451.961000000001, 1491.15, 4640.507368421052, 4867.634945054944,
+    3147.13, 3826.31, 1293.346, 1514.55,
+    2312.27, 2991.4499999999994, 3417.28, 4929.2925000000005,
+    5019.31043478261, 4600.12, 4806.928333333333, 5072.224150943399,
+    5135.778734177215, 4844.76, 5036.77, 5192.18262295082,
+    5069.19, 5230.0419999999995, 5265.236086956522, 5310.898,
+    5346.154, 5377.746000000001, 5400.968571428572, 5024.42,
+    1258.3786837606833, 1157.2783333333334, 4548.23, 1293.47131097561,
+    2052.81, 3421.86, 1390.878787878788, 1891.03,
+    4952.69, 5170.94, 4629.12, 3922.47,
+    2040.6, 2315.32, 1556.78, 1704.82,
+    2666.778181818182, 3373.5266666666666, 2255.8, 1944.4399999999998,
+    4466.88, 3737.6873333333338, 1393.47, 4574.264589371981,
+    4785.820094339622, 3147.13, 3826.31, 1349.21,
+    1285.3616666666667, 2312.27, 3417.28, 4948.11,
+    4938.690638297874, 4349.0525, 4496.34, 5079.81699507389,
+    3992.67, 5239.813125000001, 5206.513974358975, 5219.0175,
+    5266.89, 5314.408888888888, 5347.5485714285705, 5371.8966666666665,
+    5406.898, 5024.42, 1257.3947098214273, 1262.209607843138,
+    4548.23, 1293.870320855615, 2193.2239999999997, 3220.39,
+    1371.72, 1567.3333333333333, 3922.47, 4952.69,
+    2040.6, 2248.165, 1704.82, 2139.806666666667,
+    2653.0075, 3011.2925, 2211.03, 2558.0,
+    4780.724999999999, 3853.6636, 1944.44, 1393.47,
+    4548.444070351757, 4734.95341772152, 3147.13, 1294.264,
+    1349.21, 1613.25, 1465.2, 2312.27,
+    4873.687499999999, 4183.46, 5031.205445544553, 4311.66,
+    2991.45, 3417.28, 3992.67, 4861.112,
+    4496.34, 5095.9497560975615, 5171.3062666666665, 5228.938769230768,
+    5272.590000000001, 5314.332, 5382.071666666668, 5024.42,
+    1256.9490760869558, 1260.780809248554, 1750.6760869565219, 1290.6765642458106,
+    3644.69, 1699.8625, 1429.5888888888887, 5170.94,
+    4681.01, 1845.6545454545455, 2382.648888888889, 1265.26,
+    4644.19125, 3716.026956521739, 1393.47, 4565.649066666665,
+    1286.63, 4786.901277777777, 4183.46, 1613.25,
+    1349.21, 1295.79, 1286.63, 2312.27,
+    3248.032222222222, 5182.278571428571, 4987.241403508772, 4311.66,
+    4775.423571428572, 5114.7275735294115, 5017.510526315789, 4618.44,
+    5206.044250000001, 5093.712, 5227.6955714285705, 5281.047142857143,
+    5297.28, 5348.875, 5375.217368421052, 5409.623846153846,
+    5024.42, 1256.9179945799444, 1264.2483333333332, 1259.7981249999998,
+    1262.6592156862744, 1285.716, 4632.683333333333, 1648.2827272727272,
+    1281.986069364162, 4629.12, 3421.86, 3220.39,
+    1477.9654545454543, 1338.52, 1987.6899999999998, 1556.78,
+    5010.305, 4690.167142857143, 3922.47, 4123.93,
+    3444.75, 2486.7000000000003, 3835.823076923077, 4323.283846153847,
+    1265.26, 1393.47, 1349.21, 4403.24,
+    4564.4544966442945, 4769.211084337352, 1613.25, 1303.42,
+    2312.27, 5019.268854166668, 5106.131052631577, 4311.66,
+    4893.439090909091, 5172.118607594936, 5225.412676056337, 5286.859,
+    5381.2868181818185, 1256.9009919571035, 1260.7353932584265, 1274.2411764705882,
+    1297.314285714286, 4674.91, 1630.5441666666666, 1297.8368700265253,
+    3220.39, 3644.69, 1533.88, 1399.57,
+    1628.51, 1782.3580000000002, 4952.69, 4629.12,
+    4681.01, 2248.165, 2562.58, 1556.78,
+    1704.82, 2656.6958333333337, 3394.6399999999994, 2255.8,
+    1944.44, 4220.26231884058, 4589.19169117647, 1286.63,
+    4540.6, 5015.263333333333, 4714.8816853932585, 5134.6925,
+    4862.459666666667, 3147.1299999999997, 2312.27, 1289.3025,
+    1349.21, 2991.45, 3826.31, 4948.11,
+    4956.488852459014, 5041.541304347826, 3992.67, 4773.0975,
+    4496.34, 5130.055959595958, 5035.976428571428, 5196.203157894737,
+    5222.664074074074, 5251.835, 5272.739, 5300.394545454546,
+    5334.25, 5361.722, 5393.86875, 1256.5261904761896,
+    1257.2068707483006, 1258.677027027028, 1265.2649999999999, 1268.32,
+    1289.68, 1260.585873015873, 1262.8394117647058, 4548.23,
+    1283.9608333333333, 2058.4033333333336, 1276.8193015873017, 1382.524680851064,
+    5170.94, 4952.69, 4629.12, 3644.69,
+    3421.86, 1452.035, 1690.1719999999998, 2040.6,
+    2181.01, 2820.6351999999997, 1774.645, 3710.32,
+    4340.222142857143, 3852.4799999999996, 1393.47, 4583.760236966826,
+    4781.34588785047, 3147.13, 3826.31, 1286.63,
+    1613.25, 3417.28, 4948.11, 1303.42,
+    2312.27, 5240.636666666666, 4903.302602739726, 5016.684252873563,
+    5099.486363636363, 4620.980833333333, 4846.527777777778, 3992.67,
+    4496.34, 5109.647787610617, 5188.854035087718, 5221.307192982456,
+    5269.744736842105, 5304.233333333334, 5365.112592592592, 5410.562222222222,
+    5024.42, 1256.823971014492, 1258.7700000000011, 1289.68,
+    1262.2359482758625, 4548.23, 1966.4239999999998, 1297.6494017094021,
+    3220.39, 3421.86, 4629.12, 4952.69,
+    1491.452, 1723.905, 2040.6, 2676.027777777778,
+    1776.8620000000003, 3696.0699999999997, 2255.8, 3076.9244444444444,
+    3326.2100000000005, 1393.47, 4474.2025, 4088.8300000000004,
+    1944.44, 4580.654791666667, 3685.8969999999995, 4788.130196078429,
+    4183.46, 1303.42, 1613.25, 3391.0260000000003,
+    2991.45, 4991.3153999999995, 4764.848571428572, 5117.08216,
+    4977.775, 3992.67, 5183.150000000001, 5098.4425,
+    5226.262597402597, 5275.869500000001, 5376.068000000001, 5334.248333333334,
+    5407.440000000001, 5369.099999999999, 5024.42, 1256.960164383561,
+    1258.7676744186056, 1267.2285714285713, 1261.534947368421, 4548.23,
+    1524.5219999999997, 1288.1530303030306, 3421.86, 3220.39,
+    3922.47, 1550.67, 1823.1100000000001, 1473.4857142857143,
+    1289.68, 1918.498, 2780.0675, 3696.0699999999997,
+    2255.8, 3645.538888888889, 4256.992272727272, 3710.32,
+    1668.955, 4599.931576086956, 4158.3164705882355, 4764.179117647061,
+    3826.31, 1283.58, 1303.42, 2312.27,
+    4948.11, 1613.25, 4863.204571428571, 4975.198076923077,
+    2991.45, 4620.269, 4496.34, 5087.773668639057,
+    4915.587692307693, 5174.722608695652, 5084.556, 5218.459807692308,
+    5258.992307692307, 5305.3462500000005, 5347.177647058824, 5373.931428571429,
+    5403.946666666667, 1256.830497382198, 1258.737653061225, 1282.5600000000002,
+    1261.4177358490572, 4548.23, 1494.3794117647058, 1278.5878885630493,
+    2052.81, 1704.82, 1396.7749999999999, 1452.688,
+    1352.26, 1300.3675, 3421.86, 4629.12,
+    1549.1433333333334, 1755.19, 1495.3475, 1350.73,
+    2181.01, 4789.682, 3922.47, 2334.401875,
+    3628.335714285714, 4884.003333333333, 1417.8899999999999, 3909.2697058823524,
+    4474.4073684210525, 1349.21, 1280.53, 4785.017857142857,
+    4600.776024844719, 5081.400000000001, 4810.10375, 1286.63,
+    1563.8999999999999, 1303.42, 3342.66, 5012.564545454545,
+    4821.663846153847, 5107.924999999999, 4936.988571428572, 5159.786730769231,
+    5222.563382352941, 5293.488823529413, 5381.30888888889, 1258.266488413547,
+    1136.2930000000001, 2941.47, 1285.3528220858896, 2466.42,
+    1990.2350000000001, 1341.45, 1445.364, 3220.39,
+    3421.86, 1533.88, 1755.19, 1439.472857142857,
+    1306.9766666666667, 3922.47, 4952.69, 4629.12,
+    4681.01, 2168.42, 2769.9575, 3821.73,
+    1704.82, 2230.1083333333336, 1265.26, 5183.15,
+    4681.01, 3947.3286842105267, 1944.44, 4596.514545454543,
+    4205.58625, 4770.823039215686, 4183.46, 1303.42,
+    1284.5966666666666, 3147.13, 2312.27, 3553.6233333333334,
+    4948.11, 1613.25, 4894.281333333332, 5000.654285714286,
+    5003.053033707865, 5081.798125000001, 3992.67, 4311.66,
+    4806.267333333334, 5135.771075268817, 5043.1594444444445, 5255.952,
+    5209.033437499998, 5283.447142857142, 5304.794, 5357.612307692307,
+    5394.870800000001, 1256.998935064935, 1259.9207142857135, 1262.3599999999994,
+    1267.0077142857142, 1308.0, 1297.315, 1289.03,
+    1280.7816666666665, 4548.23, 1266.79, 1927.66,
+    1275.3076351351344, 1305.8406666666663, 1820.8166666666666, 1340.2744117647057,
+    3421.86, 4629.12, 1501.32, 1755.1899999999998,
+    1474.8700000000001, 1350.73, 2181.01, 5067.92,
+    4681.01, 4049.15, 3821.73, 2574.69705882353,
+    3875.2372222222225, 1349.21, 2030.5259999999998, 4418.200972222221,
+    4559.481678832116, 4718.197636363636, 3826.31, 3147.13,
+    1613.25, 5145.604, 4867.822602739728, 5066.771224489796,
+    4843.81375, 2991.45, 3417.28, 5021.37,
+    4856.533333333334, 4496.34, 5142.157547169813, 5227.0449367088595,
+    5284.6449999999995, 5331.366666666667, 5403.864444444445, 5363.248461538462,
+    5024.42, 1257.4425635103921, 1261.5259701492544, 4548.23,
+    1292.3189972144853, 2002.75, 1704.82, 1321.2266666666667,
+    1411.1299999999999, 3421.86, 3220.39, 3644.69,
+    3922.47, 4681.01, 4629.12, 4952.69,
+    1617.8257142857142, 1498.78, 1350.73, 1285.1,
+    2100.758333333333, 2850.275, 2779.68625, 3710.32,
+    3769.0347058823527, 4297.821999999999, 1393.47, 4574.619054054052,
+    2913.6150000000002, 4908.169999999999, 4707.0599999999995, 1280.53,
+    1349.21, 1465.2, 4985.7072727272725, 4858.411739130434,
+    4968.415918367347, 5045.15104477612, 2991.45, 4740.1788235294125,
+    3992.67, 5188.958888888888, 5113.074296874997, 4618.44,
+    4913.0, 5222.6359999999995, 5295.9712, 5376.578,
+    5409.4175000000005, 1256.793966480446, 1259.0507070707076, 1289.68,
+    1261.9936666666674, 1295.79, 1288.3742857142859, 1279.0,
+    1280.53, 1264.5, 2757.3239999999996, 4674.91,
+    4548.23, 1157.2783333333334, 1281.992320261439, 1486.876,
+    1358.6258536585365, 3220.39, 3644.69, 1423.99,
+    1443.83, 1466.73, 1491.15, 1350.73,
+    5098.19, 4669.478888888889, 4049.15, 2070.8892307692304,
+    3520.1459999999997, 3105.92, 3474.443636363636, 1393.47,
+    4211.000476190477, 4650.157869415811, 3554.6380000000004, 1339.6675,
+    2312.27, 3417.28, 4896.49530612245, 5049.21080882353,
+    2991.45, 4863.753076923077, 3992.67, 5136.107777777777,
+    4618.44, 5181.543157894737, 5225.674615384616, 5260.553571428572,
+    5308.218888888889, 5374.542666666666, 5408.655000000001, 1256.8331621621617,
+    1259.0274285714295, 1279.0, 1261.6409090909094, 4548.23,
+    1856.1766666666665, 1293.4653804347834, 2466.42, 2052.81,
+    3421.86, 1704.82, 1443.7153846153847, 1338.382727272727,
+    5170.94, 4629.12, 4681.01, 3220.39,
+    3644.69, 3922.47, 2175.67, 1512.5166666666667,
+    2610.196, 2172.1116666666667, 1350.73, 1265.26,
+    1289.68, 1458.5900000000001, 4285.71, 3596.8666666666663,
+    4355.473333333332, 4538.951732283467, 4742.7997752809, 3969.1699999999996,
+    3147.13, 1280.53, 1303.42, 1465.2,
+    1613.25, 5168.105714285714, 4891.570571428571, 5146.825999999999,
+    5014.509090909092, 3204.365, 4948.11, 4453.908,
+    4779.416842105264, 4496.34, 5109.578106060606, 4618.44,
+    5191.629682539683, 5240.632253521125, 5326.822, 5396.626086956521,
+    1256.4424479166655, 1257.5470555555564, 1259.491197183099, 1262.5688235294117,
+    1272.5125, 1279.7649999999999, 1288.5375000000001, 1297.315,
+    1264.7566666666667, 2508.4777777777776, 4548.23, 1054.6383333333333,
+    1280.907535714286, 1725.9714285714285, 1366.4155, 3220.39,
+    3922.47, 3644.69, 4952.69, 1612.8650000000002,
+    1503.97, 1350.73, 1289.68, 2406.135,
+    2916.67, 1950.5525, 1265.26, 3216.956875,
+    4180.402857142856, 1393.47, 4583.295075376883, 3928.9524999999994,
+    4825.2474999999995, 4717.073582089554, 1349.21, 1280.53,
+    3147.13, 2312.27, 4879.407999999998, 4183.46,
+    5124.815, 4983.55188235294, 2991.4499999999994, 4629.8835714285715,
+    4843.255, 4496.34, 5106.746600000001, 5182.554878048781,
+    5234.909999999999, 5298.3054999999995, 5371.751785714287, 5405.9818749999995,
+    5024.42, 1258.4359198542809, 1294.044285714286, 3177.657142857143,
+    1303.4558753709198, 3421.86, 3644.69, 1633.3433333333335,
+    1397.5366666666669, 5170.94, 4681.01, 4629.12,
+    3922.47, 2330.585, 1652.1675, 2934.79125,
+    2416.8199999999997, 3821.73, 3444.75, 4345.098505747126,
+    1944.44, 1491.15, 4608.689587628865, 4800.660512820513,
+    3147.13, 3826.31, 1349.21, 1288.16,
+    1613.25, 2991.4499999999994, 3417.28, 4917.900000000001,
+    5013.440000000001, 5182.597272727274, 5095.194516129033, 4767.380588235295,
+    4923.824545454546, 3992.67, 4496.34, 5132.057380952381,
+    5205.063253968253, 5272.386, 5305.098, 5359.0505,
+    5400.386666666667, 1256.5554807692295, 1257.4977358490582, 1259.7454128440368,
+    1262.6801923076919, 1306.47, 1270.60375, 1300.368,
+    1286.63, 3130.34, 1262.363, 4674.91,
+    4548.23, 1275.2632780082993, 1328.8668421052632, 2466.42,
+    1384.2603333333334, 5170.94, 4629.12, 4681.01,
+    3220.39, 3644.69, 3922.47, 1467.1075,
+    1289.68, 1891.03, 1556.78, 2124.135333333333,
+    1265.26, 3821.73, 3444.75, 3695.216315789474,
+    4298.042307692307, 1668.955, 3710.32, 4546.584404145077,
+    4773.068202247192, 3147.13, 3826.31, 1318.6833333333334,
+    1613.25, 2312.27, 4948.11, 1286.63,
+    4942.128235294118, 4606.662857142857, 5074.9221768707475, 4898.473043478261,
+    3992.67, 5218.085555555556, 5123.315306122449, 5197.093220338983,
+    5236.830609756096, 5313.83625, 5344.041666666667, 5408.715263157896,
+    5373.579230769231, 5024.42, 1258.2987272727278, 3129.58,
+    721.9157142857144, 1269.650625, 1266.0275, 4611.57,
+    1283.124880546076, 1384.432, 5170.94, 4952.69,
+    4629.12, 3644.69, 3922.47, 1882.021,
+    2322.04, 1350.73, 1265.26, 2878.0033333333336,
+    3011.2899999999995, 2275.64, 3701.245277777778, 4394.041904761905,
+    1491.15, 4717.007500000001, 4999.695000000001, 4595.0701550387585,
+    4715.669827586207, 1280.53, 1613.25, 1465.2,
+    2312.27, 5080.383333333334, 4846.83974025974, 5152.780000000001,
+    5011.414086956523, 2991.45, 3826.31, 4782.829999999999,
+    3992.67, 4496.34, 5112.9571428571435, 5190.155641025641,
+    5275.032, 5229.849193548386, 5337.1196, 5398.828125,
+    5024.42, 1258.2131475409835, 1291.427142857143, 3495.6266666666666,
+    1299.1754385964916, 2466.42, 2052.81, 1704.82,
+    1364.13, 3421.86, 3220.39, 3644.69,
+    4681.01, 5170.94, 4952.69, 1607.6500000000003,
+    2315.32, 1394.992, 1550.6737500000002, 2613.2707142857143,
+    3282.054, 1265.26, 1944.44, 3797.888125,
+    1393.47, 4149.623333333334, 4425.306923076923, 4529.068674698796,
+    4742.298928571429, 3826.31, 3147.13, 1291.975,
+    1349.21, 1613.25, 1465.2, 2312.27,
+    5224.36, 4897.553013698629, 5172.213333333333, 5016.230731707317,
+    3417.28, 2991.45, 3992.67, 4713.320000000001,
+    4496.34, 5131.671117647056, 4618.44, 5227.946753246752,
+    5290.523500000001, 5362.521904761905, 5407.158461538462, 1256.8088819875766,
+    1258.8860396039618, 1282.5600000000002, 1261.5901980198028, 4548.23,
+    1542.4744444444445, 1277.9971351351357, 2466.42, 1990.2350000000001,
+    1704.82, 1369.5935714285713, 1421.9599999999998, 1292.7366666666667,
+    1323.26, 4629.12, 3220.39, 3421.86,
+    3644.69, 1460.8400000000001, 1580.6899999999998, 1350.73,
+    1286.016, 2181.01, 4637.306363636364, 3612.45303030303,
+    1562.574, 4403.24, 4574.569727891156, 1286.63,
+    4867.935294117647, 4709.066630434781, 1280.53, 1303.42,
+    1465.2, 1613.25, 2312.27, 5113.221818181818,
+    4877.4567938931295, 5161.565714285714, 5015.797375, 3417.28,
+    3992.67, 4695.132500000001, 5180.763076923076, 5100.452183908047,
+    4618.44, 5220.907619047621, 5282.9920833333335, 5338.83,
+    5383.2796875, 5024.42, 1258.9144293015343, 1230.6376119402983,
+    2360.603333333333, 1288.055087719298, 2466.42, 2052.81,
+    1381.64, 1288.92, 3421.86, 3220.39,
+    3644.69, 5170.94, 4952.69, 4629.12,
+    1630.0366666666669, 1940.8866666666665, 1507.634, 1306.4685714285715,
+    1989.2133333333331, 2613.1600000000003, 3444.75, 3746.4909999999995,
+    4473.879795918367, 1491.15, 4622.867686567164, 1286.63,
+    4717.5321875, 4855.560303030302, 4748.17, 1944.44,
+    2312.27, 1393.47, 3711.0825000000004, 4948.11,
+    1286.63, 4882.20090909091, 5014.544214876035, 4856.083529411764,
+    4649.345, 3992.67, 4496.34, 4618.44,
+    5126.7717241379305, 4998.3553846153845, 5196.228275862069, 5237.3646478873225,
+    5317.765, 5387.269565217392, 1257.3325053533183, 1262.3817293233087,
+    1268.392833333333, 1287.8519999999999, 1266.79, 4548.23,
+    1275.4454430379744, 1307.8075000000001, 1704.82, 2052.81,
+    1367.5228571428572, 1293.5, 1350.73, 1472.96,
+    5170.94, 4629.12, 4681.01, 2276.4025,
+    2735.0425, 1459.6066666666666, 2159.3419999999996, 3821.73,
+    3444.75, 2255.8, 2558.0, 3793.717857142857,
+    4358.668000000001, 4595.5813499999995, 3710.316363636364, 5036.63,
+    4752.844128440368, 4339.135, 3228.2766666666666, 1336.998,
+    2312.27, 3826.31, 3417.28, 4948.11,
+    5125.537499999999, 4924.288636363635, 4618.129999999999, 4311.66,
+    5015.190781249999, 5102.801612903225, 4768.01, 4977.0216666666665,
+    5232.388695652174, 5133.277941176471, 5217.945443037976, 5266.678181818182,
+    5304.995, 5292.871111111111, 5365.462, 5405.656428571428,
+    5024.42, 1257.4105381165903, 1261.9378813559329, 1469.5384210526315,
+    1284.644759036146, 2110.502, 3321.125, 1395.8161538461538,
+    1891.03, 5170.94, 4681.01, 3922.47,
+    1556.78, 2227.674285714286, 1265.26, 3046.633076923077,
+    3854.55, 1944.4399999999998, 1426.03, 4407.8099999999995,
+    4532.7788770053485, 3679.8721052631577, 4726.32375, 4871.119,
+    3826.31, 1349.21, 1303.42, 1280.53,
+    2312.27, 2991.4499999999994, 3417.28, 4937.578367346939,
+    5013.943950617286, 4536.933999999999, 4754.27375, 4496.34,
+    5185.087307692307, 5082.2487962963, 5189.96534883721, 5082.416666666667,
+    5224.060869565218, 5262.75, 5333.814285714286, 5301.243750000001,
+    5371.751428571429, 5413.4745454545455, 5024.42, 1256.9032208588953,
+    1258.967250000001, 1289.68, 1261.5881415929202, 1279.255,
+    1886.4466666666667, 1273.0597297297306, 1315.3599159663868, 1927.66,
+    2052.81, 3220.39, 3421.86, 1704.82,
+    1384.9033333333332, 1891.03, 4952.69, 4660.254,
+    5183.15, 3922.47, 4311.66, 2345.0825,
+    1556.78, 3263.342857142857, 2440.2233333333334, 3757.991764705882,
+    4230.43, 1349.21, 4477.773783783783, 4617.830559006209,
+    4816.268656716417, 3826.31, 1289.3025, 1465.2,
+    3133.3933333333334, 4645.91, 5002.378255813954, 4804.946,
+    4496.34, 5110.533450292395, 5214.838181818181, 5278.675294117646,
+    5305.42, 5378.905925925927, 1256.8535359116013, 1258.6924576271201,
+    1266.792, 1261.5238775510213, 1447.3718181818183, 4674.91,
+    1062.7783333333334, 1284.4197196261684, 1969.3766666666668, 2466.42,
+    3644.69, 1504.0509090909093, 1388.0336000000002, 1336.995,
+    1290.1899999999998, 3922.47, 4629.12, 5170.94,
+    2040.5999999999997, 2181.01, 1556.78, 3821.73,
+    3444.75, 2422.0446153846156, 4681.01, 3205.5125,
+    1944.44, 3868.1339999999996, 3558.835, 4136.142500000001,
+    4403.24, 3104.0150000000003, 4524.6726767676755, 4750.219444444445,
+    4004.885, 3147.13, 1303.42, 5099.484545454546,
+    4913.953469387755, 5079.337476635514, 4874.85, 2991.45,
+    3417.28, 4841.153076923078, 3992.67, 5203.755416666667,
+    5124.209078947369, 5227.751388888887, 5120.57, 5284.118461538462,
+    5337.302, 5374.898333333333, 5413.486666666667, 5024.42,
+    1258.4909290540554, 1193.357777777778, 4548.23, 1298.2418771331056,
+    2331.73, 3421.86, 1704.82, 1368.7083333333333,
+    4952.69, 5170.94, 4629.12, 4681.01,
+    3220.39, 3644.69, 2040.4277777777777, 1484.7562500000001,
+    2741.91, 3011.29, 3821.73, 3444.75,
+    2255.8, 3123.221666666667, 3615.69, 4205.2585714285715,
+    3873.63, 4352.868867924526, 4626.238482142857, 3147.1299999999997,
+    2312.27, 1280.53, 1303.42, 1465.2,
+    4891.377033898304, 4311.66, 3417.28, 4649.725,
+    5020.092328767126, 5073.409512195123, 4798.028333333333, 4957.7733333333335,
+    4496.34, 5121.330353982301, 5206.8462711864395, 5274.216666666666,
+    5312.177692307693, 5402.131904761905, 5358.33, 1256.8515838509302,
+    1258.791680000001, 1261.1797752808995, 1263.6758333333337, 4548.23,
+    1973.75, 1294.1684266666678, 2052.81, 2466.42,
+    1352.0421428571428, 1301.8933333333334, 1454.52, 1390.42,
+    3421.8599999999997, 3220.39, 3922.47, 4952.69,
+    4629.12, 4681.01, 1547.3120000000001, 1845.75,
+    1387.3633333333335, 1556.78, 2344.5131250000004, 3174.0933333333337,
+    1265.26, 4932.08, 4199.736666666667, 3290.3227272727277,
+    3831.400666666667, 4540.440413793105, 4755.179548872179, 3826.31,
+    3147.13, 1613.25, 1293.346, 2312.27,
+    3417.28, 4883.468648648648, 4735.96, 5005.704854368932,
+    4792.620000000001, 2991.45, 3992.67, 4719.873846153846,
+    5103.966559139784, 5172.549636363636, 4940.47375, 5086.580000000001,
+    5222.147640449438, 5284.524210526317, 5360.8676000000005, 5405.983333333333,
+    5024.42, 1257.0099483204133, 1264.5025, 1259.774452054795,
+    1262.694, 1307.2350000000001, 4674.91, 1612.6231818181818,
+    1283.5830473372782, 1977.72, 2466.42, 3421.86,
+    3644.69, 1419.0766666666668, 1752.136, 1392.7050000000002,
+    1286.6280000000002, 5170.94, 4952.69, 4681.01,
+    4311.66, 4123.93, 2246.2575, 1826.0080000000003,
+    1393.47, 3351.7394117647063, 3721.763333333334, 4190.105714285714,
+    1349.21, 4570.4395454545465, 3455.943333333334, 4723.761304347827,
+    4879.9468181818165, 1295.79, 1613.25, 2501.9075000000003,
+    4948.11, 5001.671825396827, 4708.792666666666, 4496.34,
+    5106.977750000002, 5203.134186046511, 5253.8029166666665, 5317.4625,
+    5389.510344827587, 5024.42, 1258.223233215547, 1279.5072222222223,
+    2189.5278947368415, 1278.2266346153845, 2032.9666666666665, 3321.125,
+    1398.2331707317073, 1891.03, 4952.69, 5170.94,
+    4681.01, 2423.5177777777776, 1890.857777777778, 3633.24,
+    2255.8, 2800.67, 3133.3940000000002, 2558.0,
+    4201.007692307692, 4517.29487804878, 1491.15, 4629.973023255813,
+    4017.9411111111112, 4763.341262135921, 4004.885, 1303.42,
+    2312.27, 3147.13, 5115.302727272728, 4887.013523809524,
+    4637.1325, 3417.28, 5089.44569767442, 4647.4375,
+    4887.107741935485, 5096.619130434783, 5192.388245614035, 5247.635,
+    5228.0905555555555, 5271.889999999999, 5287.288461538462, 5324.3275,
+    5370.371666666667, 5404.318181818182, 5024.42, 1257.2345720720716,
+    1263.2458955223888, 1299.86, 1281.29, 1265.2649999999999,
+    4611.57, 1286.001206349207, 1464.4394444444447, 3644.69,
+    3421.86, 3220.39, 4681.01, 5170.94,
+    1633.3433333333332, 1417.31375, 2100.1214285714286, 1265.26,
+    2611.4176923076925, 3854.55, 1944.4399999999998, 5183.15,
+    4529.91, 3666.568333333333, 3946.452857142857, 4575.051420765026,
+    4114.414117647058, 4779.279017857142, 4183.46, 2312.27,
+    1287.548, 1349.21, 1613.25, 4948.11,
+    3417.28, 5159.240000000001, 4914.2719718309845, 5019.435949367089,
+    5137.976000000001, 2991.45, 4489.469999999999, 4793.156666666667,
+    4496.34, 5128.2377777777765, 4618.44, 5225.958571428571,
+    5282.051333333334, 5337.6825, 5394.155357142858, 5024.42,
+    1257.4015800415787, 1261.811081081081, 1550.9053846153847, 1279.6787662337665,
+    1704.82, 2259.615, 1314.1872222222223, 1382.5657142857144,
+    3644.69, 3421.86, 4629.12, 1621.6416666666667,
+    1435.0155555555557, 2040.6, 2181.01, 4952.69,
+    5183.15, 4681.01, 4123.93, 4311.66,
+    3922.47, 2576.783076923077, 3523.605, 3574.342727272727,
+    4284.1900000000005, 1944.44, 1349.21, 4413.390769230769,
+    1491.15, 4572.406594202897, 4715.03076923077, 1613.25,
+    1291.975, 3147.13, 4908.026666666668, 5045.246635514019,
+    3986.565, 4796.662727272726, 5117.840608695651, 5209.362844036697,
+    5301.282800000002, 5389.70303030303, 5024.42, 1258.8026833333342,
+    1212.4414492753624, 2085.625, 1286.6570344827583, 1871.95,
+    2466.42, 1351.3623529411764, 1431.625, 4952.69,
+    5170.94, 4629.12, 1489.01, 1556.78,
+    2782.355714285714, 2146.42, 3407.93, 3821.73,
+    1287.3899999999999, 2598.9533333333334, 3260.84, 3823.6772727272723,
+    4681.01, 4220.595, 2888.4300000000003, 4494.374166666666,
+    4639.167874015748, 4783.96105769231, 2312.27, 3147.13,
+    1304.9475, 1465.2, 3417.28, 4948.11,
+    4938.988024691358, 4547.211111111112, 5063.822543859649, 4807.885,
+    3992.67, 5162.535584415586, 5066.14, 5223.487714285715,
+    5255.512941176472, 5303.1525, 5342.97, 5381.780952380952,
+    5420.634, 5024.42, 1258.2673157894733, 1291.40125,
+    2436.9144444444446, 1286.1333227848106, 2001.87, 3220.39,
+    1370.389090909091, 1638.8125, 4681.01, 2181.01,
+    2315.32, 1556.78, 1704.82, 3821.73,
+    2718.7625000000003, 2222.2225, 1265.26, 4848.39,
+    4230.158, 3402.9700000000003, 3908.3500000000004, 4574.296,
+    4140.296111111111, 4786.982875816991, 3826.31, 1287.7775000000001,
+    1349.21, 1465.2, 4948.11, 2991.45,
+    1613.25, 4986.440096153847, 4842.9655555555555, 5100.506446280991,
+    4921.944285714286, 3992.67, 5203.685606060608, 5231.196458333334,
+    5254.1224999999995, 5274.843846153846, 5344.933333333333, 5297.958888888888,
+    5363.175238095238, 5404.7108333333335, 5024.42, 1257.2396645702308,
+    1261.875523809524, 2565.43875, 1305.174921052632, 3220.39,
+    3644.69, 1474.1385714285716, 1845.75, 4629.12,
+    4952.69, 3922.47, 2244.7325, 2847.2200000000003,
+    1940.1719999999998, 1265.26, 3821.73, 3444.75,
+    2255.8, 3408.763684210526, 1393.47, 3913.9199999999996,
+    4242.137586206897, 4969.168, 4574.223416149067, 4773.004000000001,
+    4183.46, 1280.53, 1303.42, 1613.25,
+    1465.2, 3531.7450000000003, 4948.11, 1286.63,
+    4877.730277777778, 4933.2259375, 5111.99125, 5001.999014084507,
+    2991.45, 4573.79375, 4818.682000000001, 4496.34,
+    5119.891955307261, 4618.44, 5217.37309859155, 5271.037083333334,
+    5336.0536363636365, 5395.043333333333, 5024.42, 1258.0709965635735,
+    1206.0845454545454, 1714.3625, 1288.0387643678162, 1927.66,
+    3220.39, 1526.0822222222223, 1397.3536363636363, 5170.94,
+    4952.69, 3922.47, 2181.01, 2315.32,
+    1556.78, 2817.97, 3880.7466666666664, 1944.4399999999998,
+    4869.756666666667, 4186.506666666667, 3814.714, 4202.861428571428,
+    4546.232022471909, 4742.834945054947, 3826.31, 3147.13,
+    1303.42, 1280.53, 1465.2, 1613.25,
+    2312.27, 4876.581818181819, 4958.1433333333325, 5005.120379746836,
+    5094.08980392157, 2991.45, 3992.67, 4852.87,
+    5151.582653061223, 5016.967647058824, 5199.753658536586, 5235.472968750001,
+    5307.063124999999, 5345.12375, 5428.88, 5389.4225,
+    1258.2210016977942, 1285.4875, 1148.849090909091, 1265.566,
+    1266.79, 4611.57, 1762.0600000000002, 1296.094722222223,
+    3644.69, 3220.39, 1755.19, 1350.73,
+    1438.49, 3922.47, 4629.12, 4681.01,
+    2315.32, 2562.58, 1704.82, 2081.81,
+    2753.138571428571, 3854.55, 1944.44, 3843.1033333333344,
+    3495.3683333333333, 4214.17125, 4024.2166666666667, 4536.627079646016,
+    4770.942260869565, 1303.42, 1465.2, 1286.63,
+    1349.21, 1613.25, 4867.080882352942, 4954.21,
+    5115.526153846154, 4991.914954954956, 2991.45, 4515.872,
+    4805.068, 4496.34, 5187.992068965517, 5103.22914728682,
+    5224.089240506329, 5294.289090909091, 5354.598888888889, 5403.694375,
+    5024.42, 1258.2947160068848, 1194.25, 1714.5537499999998,
+    1280.9302317880802, 1702.6414285714288, 2259.615, 1315.165652173913,
+    1382.306875, 3644.69, 3220.39, 1488.855,
+    1628.51, 1891.03, 5100.224999999999, 4629.12,
+    2377.4300000000003, 3604.361538461538, 3444.75, 1265.26,
+    3852.8720000000003, 4395.791836734695, 1349.21, 1280.53,
+    4594.487757009345, 4772.011344537814, 3147.13, 3826.31,
+    1292.2266666666667, 1613.25, 3417.28, 4930.750384615385,
+    4746.7446666666665, 5065.615045871559, 4305.555, 5186.711578947367,
+    5231.768229166668, 5330.3347826086965, 5396.616363636364, 5024.42,
+    1258.5304227941178, 1294.1109999999999, 3822.88, 1291.6270655270662,
+    1927.66, 2466.42, 1704.82, 1377.7819444444447,
+    3644.69, 3220.39, 4952.69, 4629.12,
+    1857.2309523809527, 2850.275, 1350.73, 1273.3999999999999,
+    2800.67, 2916.67, 2275.64, 4359.16625,
+    3677.7583333333337, 1944.44, 4096.677142857143, 4549.231928571429,
+    4905.712777777778, 4739.768029197079, 1311.0533333333333, 1563.8999999999999,
+    2312.27, 3580.892, 3147.13, 4948.11,
+    4897.359583333334, 4668.04, 5019.291511627907, 4806.860909090909,
+    4496.34, 5120.624090909091, 4994.402777777777, 5195.6466666666665,
+    5079.365, 5224.608372093023, 5268.390499999999, 5310.594166666667,
+    5355.34705882353, 5430.096, 5397.883076923076, 5024.42,
+    1256.8522916666666, 1258.8628225806463, 1282.05, 1262.0693577981656,
+    4548.23, 1856.1766666666665, 1296.1151111111117, 3421.86,
+    3644.69, 1533.88, 1451.8475, 1289.68,
+    1285.1, 4832.569, 4003.054, 2610.2300000000005,
+    3811.472068965518, 5157.2, 4421.548823529412, 4596.67872180451,
+    4636.75, 1698.9357142857145, 4572.0380000000005, 3710.32,
+    1349.21, 1297.6975, 1613.25, 4729.573816793895,
+    4183.46, 5162.545, 4858.6392, 1375.915,
+    2312.27, 3410.56, 4948.11, 4980.328492063496,
+    5104.527638888888, 3992.67, 5186.71119047619, 5234.919729729729,
+    5317.46, 5377.892162162161,
+};
+
+const EPS_ForestQS eps_voltage_forest_qs = {
+    .n_features = 5,
+    .n_trees = 50,
+    .n_nodes = 2348,
+    .scale = 0.02,
+    .feature_offset = voltage_qs_feature_offset,
+    .threshold = voltage_qs_threshold,
+    .tree = voltage_qs_tree,
+    .mask = voltage_qs_mask,
+    .leaf_offset = voltage_qs_leaf_offset,
+    .leaf_value = voltage_qs_leaf_value,
+};
+
+#endif
+
+#if EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_QUANTIZED)
+
+static const EPS_QFeature voltage_q_feature[5] = {
+    {627.125, 8.0, 38251, 0, NULL},
+    {1256.625, 8.0, 33166, 0, NULL},
+    {1258.25, 8.0, 33153, 0, NULL},
+    {1256.625, 8.0, 33129, 0, NULL},
+    {1256.625, 8.0, 33178, 0, NULL},
+};
+
+static const int16_t voltage_q_roots[50] = {
+    0, 54, 108, 152, 202, 245, 288, 331, 374, 422, 469, 516, 561, 606, 646, 686,
+    739, 791, 836, 882, 927, 980, 1030, 1078, 1127, 1179, 1230, 1274, 1329, 1375, 1425, 1474,
+    1522, 1575, 1620, 1663, 1715, 1762, 1814, 1858, 1902, 1950, 1992, 2038, 2082, 2129, 2174, 2221,
+    2259, 2306,
+};
+
+static const uint8_t voltage_q_feature_index[2348] = {
+    0, 0, 4, 0, 0, 4, 3, 3, 3, 4, 3, 0, 4, 3, 0, 0, 2, 3, 2, 2, 3, 1, 0, 4,
+    4, 0, 1, 3, 0, 3, 0, 0, 2, 1, 4, 0, 2, 0, 3, 3, 0, 0, 2, 3, 3, 3, 0, 0,
+    0, 2, 0, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 2, 0, 3, 3, 0, 2, 2, 0,
+    3, 4, 0, 2, 0, 0, 2, 0, 3, 0, 4, 1, 0, 0, 3, 0, 4, 1, 0, 3, 3, 3, 0, 0,
+    3, 3, 2, 2, 2, 0, 0, 3, 0, 0, 3, 2, 0, 0, 0, 0, 4, 0, 3, 1, 2, 3, 3, 2,
+    0, 4, 1, 0, 3, 0, 2, 3, 1, 0, 0, 0, 4, 1, 1, 1, 1, 0, 3, 0, 4, 3, 1, 1,
+    3, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 3, 4, 2, 1, 1, 2, 3, 0, 2,
+    2, 2, 0, 0, 3, 4, 4, 2, 0, 3, 0, 0, 3, 2, 3, 0, 1, 4, 1, 1, 2, 0, 3, 3,
+    3, 0, 0, 0, 0, 1, 3, 0, 4, 0, 0, 0, 0, 4, 0, 0, 4, 3, 0, 0, 2, 2, 4, 3,
+    2, 3, 0, 0, 1, 0, 0, 1, 0, 0, 4, 3, 0, 1, 0, 0, 4, 4, 0, 1, 4, 1, 0, 0,
+    3, 2, 1, 0, 1, 0, 0, 0, 0, 4, 4, 3, 4, 0, 3, 2, 2, 4, 0, 3, 0, 4, 0, 0,
+    3, 0, 4, 0, 0, 0, 4, 0, 2, 0, 3, 1, 3, 0, 1, 4, 4, 0, 0, 2, 0, 0, 0, 2,
+    0, 0, 0, 4, 0, 0, 2, 3, 0, 0, 3, 2, 4, 2, 0, 1, 0, 3, 0, 2, 2, 0, 0, 3,
+    3, 4, 3, 2, 3, 0, 3, 0, 3, 0, 3, 1, 0, 0, 3, 1, 0, 4, 2, 0, 0, 0, 0, 4,
+    0, 3, 1, 3, 0, 4, 2, 0, 4, 4, 3, 0, 0, 3, 0, 1, 0, 1, 0, 4, 3, 0, 4, 0,
+    3, 4, 0, 3, 3, 0, 4, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 4, 0, 0, 2, 3, 0, 0,
+    2, 2, 3, 0, 3, 2, 3, 0, 3, 3, 0, 3, 3, 0, 3, 0, 0, 4, 0, 2, 0, 0, 0, 4,
+    4, 2, 0, 3, 0, 3, 1, 0, 0, 3, 0, 0, 0, 2, 0, 0, 4, 0, 0, 3, 1, 1, 1, 0,
+    3, 1, 3, 0, 0, 3, 4, 0, 2, 4, 3, 2, 2, 0, 0, 3, 2, 3, 3, 3, 0, 4, 4, 1,
+    0, 0, 3, 0, 2, 1, 0, 0, 2, 1, 0, 4, 2, 0, 0, 0, 0, 0, 0, 3, 3, 2, 2, 2,
+    4, 3, 3, 0, 4, 3, 0, 3, 4, 0, 3, 0, 0, 0, 3, 0, 0, 0, 4, 1, 3, 0, 0, 3,
+    4, 4, 3, 0, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 3, 2, 3, 2, 0, 2, 4,
+    2, 3, 0, 3, 2, 3, 4, 0, 1, 0, 3, 0, 1, 3, 3, 0, 3, 1, 4, 1, 4, 0, 3, 0,
+    3, 1, 0, 1, 3, 4, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 3, 2, 0, 3, 0,
+    0, 4, 2, 2, 0, 3, 0, 1, 3, 0, 4, 0, 4, 1, 2, 0, 0, 3, 0, 4, 3, 1, 3, 4,
+    0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 2, 2, 2, 1, 0, 0, 3, 0, 0, 3,
+    0, 0, 4, 0, 4, 4, 4, 2, 0, 0, 3, 4, 3, 3, 3, 0, 0, 3, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 4, 0, 2, 4, 3, 3, 4, 4, 0, 3, 1, 0, 1, 3, 4, 4, 1, 0, 0, 0, 4,
+    0, 4, 0, 4, 3, 0, 2, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 3, 3, 1,
+    0, 0, 3, 0, 2, 2, 2, 1, 2, 3, 1, 4, 0, 2, 0, 3, 0, 0, 1, 4, 0, 1, 3, 1,
+    3, 3, 2, 1, 4, 0, 0, 3, 0, 4, 2, 3, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 4,
+    1, 4, 3, 4, 4, 2, 3, 4, 0, 3, 4, 3, 2, 2, 0, 0, 0, 4, 2, 1, 0, 3, 0, 0,
+    2, 4, 0, 0, 4, 3, 4, 4, 2, 0, 3, 4, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 4, 3, 2, 2, 3, 1, 3, 0, 0, 0, 0, 3, 3, 2, 0, 0, 4, 0, 0, 3,
+    3, 3, 0, 2, 4, 0, 3, 0, 0, 3, 0, 2, 3, 1, 0, 3, 0, 2, 4, 4, 0, 0, 0, 0,
+    0, 4, 3, 2, 3, 3, 4, 2, 0, 2, 2, 2, 4, 0, 0, 0, 3, 0, 2, 4, 0, 0, 2, 4,
+    2, 4, 4, 1, 0, 0, 2, 0, 0, 2, 3, 0, 0, 3, 4, 0, 0, 2, 0, 0, 0, 0, 0, 4,
+    3, 2, 3, 3, 3, 3, 2, 3, 2, 2, 0, 1, 4, 1, 0, 3, 0, 2, 1, 3, 4, 4, 0, 0,
+    0, 3, 0, 2, 2, 4, 1, 2, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 2, 1,
+    0, 1, 3, 3, 0, 2, 2, 2, 1, 2, 2, 3, 1, 1, 4, 0, 3, 0, 2, 4, 4, 0, 0, 4,
+    1, 4, 3, 3, 3, 2, 0, 3, 0, 4, 0, 4, 3, 0, 0, 3, 3, 0, 1, 0, 0, 0, 4, 0,
+    0, 0, 0, 3, 2, 3, 3, 4, 4, 0, 0, 1, 2, 0, 0, 3, 2, 3, 0, 0, 2, 0, 4, 0,
+    1, 1, 3, 0, 4, 0, 1, 4, 0, 4, 0, 1, 3, 4, 3, 1, 2, 1, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 2, 1, 3, 0, 2, 2, 4, 2, 2, 0, 3, 0, 1, 2, 4, 0, 3, 4, 0, 3,
+    0, 0, 4, 0, 0, 1, 1, 2, 0, 3, 0, 2, 4, 1, 0, 0, 3, 3, 4, 0, 0, 2, 0, 0,
+    4, 2, 0, 0, 2, 4, 3, 0, 3, 0, 2, 4, 0, 2, 2, 3, 3, 1, 2, 4, 2, 0, 0, 2,
+    0, 1, 0, 4, 0, 3, 0, 4, 4, 1, 4, 0, 3, 3, 0, 1, 0, 0, 2, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 4, 3, 2, 2, 2, 0, 1, 3, 4, 3, 4, 2, 2, 0, 1, 1, 0, 3, 2, 4,
+    3, 0, 3, 0, 4, 1, 0, 4, 0, 4, 3, 2, 1, 0, 3, 0, 2, 3, 0, 1, 3, 0, 3, 1,
+    0, 0, 0, 0, 0, 4, 0, 0, 1, 0, 1, 4, 0, 3, 0, 1, 0, 4, 2, 3, 2, 3, 4, 0,
+    2, 2, 3, 3, 2, 3, 0, 3, 0, 0, 0, 0, 2, 1, 1, 1, 3, 0, 2, 0, 4, 3, 0, 1,
+    0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 4, 0, 3, 2, 4, 3, 2, 4, 2, 3, 4, 0, 4, 4,
+    1, 0, 3, 0, 0, 4, 4, 0, 1, 0, 3, 0, 3, 0, 3, 0, 0, 2, 3, 0, 0, 1, 0, 0,
+    0, 1, 0, 0, 4, 0, 0, 0, 0, 0, 2, 3, 3, 0, 4, 4, 0, 0, 1, 2, 4, 1, 2, 0,
+    2, 0, 0, 0, 4, 4, 2, 3, 0, 3, 0, 1, 0, 4, 3, 0, 0, 0, 4, 1, 3, 0, 3, 0,
+    2, 3, 0, 0, 2, 0, 1, 0, 4, 0, 0, 0, 4, 3, 4, 1, 3, 1, 0, 2, 4, 2, 0, 1,
+    0, 2, 0, 4, 1, 1, 0, 3, 0, 0, 4, 3, 3, 0, 4, 1, 4, 0, 3, 0, 3, 4, 1, 4,
+    2, 0, 1, 0, 0, 4, 0, 0, 0, 0, 0, 4, 1, 3, 0, 2, 2, 2, 0, 3, 2, 3, 1, 0,
+    3, 4, 0, 1, 0, 1, 0, 3, 0, 4, 1, 0, 4, 0, 4, 4, 1, 3, 0, 0, 3, 0, 4, 4,
+    1, 0, 4, 0, 2, 3, 0, 0, 1, 0, 0, 0, 0, 0, 4, 3, 2, 3, 2, 1, 3, 2, 0, 2,
+    3, 4, 3, 3, 0, 2, 0, 4, 0, 3, 0, 1, 3, 1, 0, 0, 1, 4, 2, 2, 1, 0, 3, 0,
+    3, 3, 3, 4, 0, 3, 3, 0, 0, 1, 0, 0, 0, 0, 4, 4, 2, 1, 1, 3, 3, 0, 3, 1,
+    3, 1, 0, 2, 0, 1, 4, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 1, 0, 2,
+    3, 0, 3, 0, 4, 4, 3, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 2, 0, 0, 3, 4, 0, 2,
+    4, 2, 2, 4, 4, 3, 3, 0, 2, 2, 0, 3, 0, 0, 4, 0, 2, 2, 1, 3, 1, 4, 2, 1,
+    0, 0, 2, 3, 4, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0,
+    0, 1, 4, 1, 0, 1, 0, 3, 3, 0, 3, 0, 4, 1, 3, 4, 0, 1, 1, 1, 3, 3, 0, 0,
+    3, 0, 0, 2, 3, 0, 0, 3, 0, 0, 3, 2, 0, 0, 0, 0, 0, 4, 3, 2, 4, 0, 3, 2,
+    2, 3, 0, 3, 0, 3, 4, 1, 2, 3, 0, 2, 4, 2, 3, 4, 0, 3, 0, 0, 4, 1, 1, 1,
+    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 3, 4, 2, 2, 0, 3, 3, 4, 4, 2,
+    3, 4, 0, 4, 0, 1, 0, 0, 0, 0, 2, 3, 3, 3, 2, 4, 0, 4, 3, 3, 0, 3, 0, 3,
+    3, 0, 3, 3, 0, 0, 3, 1, 0, 0, 2, 0, 0, 0, 0, 0, 3, 2, 2, 0, 2, 3, 4, 1,
+    4, 0, 4, 4, 0, 3, 3, 0, 3, 0, 3, 0, 4, 0, 1, 4, 0, 3, 0, 0, 0, 0, 3, 0,
+    1, 3, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 4, 0, 2, 2, 1, 4, 0, 3, 2,
+    3, 2, 1, 0, 1, 0, 0, 4, 2, 0, 1, 3, 0, 3, 0, 2, 4, 0, 3, 0, 4, 0, 4, 4,
+    0, 3, 0, 1, 3, 0, 4, 0, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 4, 0, 2, 4, 3,
+    2, 0, 3, 0, 4, 4, 1, 0, 3, 2, 1, 2, 4, 4, 0, 4, 3, 2, 0, 0, 3, 0, 0, 0,
+    0, 1, 1, 0, 0, 3, 2, 0, 4, 0, 0, 0, 0, 0, 4, 0, 3, 2, 0, 0, 2, 1, 4, 0,
+    4, 4, 0, 1, 4, 0, 4, 0, 0, 0, 0, 3, 4, 0, 1, 0, 0, 3, 3, 4, 3, 0, 0, 0,
+    0, 1, 0, 0, 3, 2, 0, 0, 0, 4, 0, 0, 3, 3, 1, 0, 3, 0, 1, 2, 3, 0, 0, 3,
+    1, 0, 4, 0, 3, 0, 3, 4, 0, 0, 2, 4, 1, 3, 2, 0, 0, 0, 3, 4, 2, 1, 1, 3,
+    0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 4, 0, 3, 1, 2, 0, 3, 2, 0, 3,
+    4, 4, 3, 4, 1, 3, 0, 4, 3, 0, 0, 3, 0, 0, 0, 0, 4, 0, 3, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 3, 1, 3, 0, 4, 2, 4, 4, 0, 0, 3, 2, 0, 0, 0, 3, 0, 4,
+    0, 1, 0, 4, 0, 1, 3, 0, 1, 4, 0, 3, 0, 2, 3, 1, 0, 3, 3, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 3, 2, 2, 0, 1, 0, 1, 1, 4, 2, 1, 1, 0, 3, 0, 2, 1, 0, 0, 3,
+    3, 1, 1, 3, 2, 2, 0, 3, 0, 3, 3, 0, 1, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 0,
+    2, 1, 4, 0, 3, 0, 0, 4, 3, 2, 4, 4, 2, 0, 3, 0, 4, 1, 4, 0, 1, 3, 0, 1,
+    2, 4, 3, 1, 0, 2, 0, 0, 3, 0, 1, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2,
+    1, 0, 3, 2, 1, 2, 0, 1, 1, 1, 3, 0, 3, 0, 3, 4, 4, 3, 0, 4, 4, 0, 1, 2,
+    0, 3, 0, 0, 0, 1, 4, 0, 0, 3, 0, 2, 0, 0, 0, 0, 0, 4, 4, 2, 2, 3, 0, 3,
+    1, 1, 2, 4, 3, 2, 2, 0, 1, 1, 1, 3, 4, 0, 3, 0, 4, 4, 2, 4, 0, 3, 2, 4,
+    0, 2, 0, 4, 3, 1, 0, 0, 2, 3, 1, 0, 2, 0, 0, 0, 0, 0, 3, 2, 2, 4, 0, 2,
+    2, 0, 0, 0, 2, 4, 2, 3, 0, 0, 2, 0, 0, 0, 3, 3, 0, 3, 0, 1, 0, 0, 2, 3,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 3, 2, 4, 1, 3, 0, 1, 3, 0, 1, 3, 2, 1, 2, 0,
+    3, 0, 3, 2, 0, 4, 3, 0, 4, 0, 2, 4, 0, 0, 0, 2, 3, 1, 3, 0, 0, 3, 0, 2,
+    0, 4, 0, 0, 0, 0, 0, 4, 2, 2, 2, 3, 4, 2, 2, 4, 0, 2, 0, 3, 4, 0, 1, 0,
+    3, 2, 3, 4, 3, 4, 0, 3, 0, 3, 2, 1, 4, 1, 0, 3, 0, 0, 0, 0,
+};
+
+static const uint16_t voltage_q_threshold[2348] = {
+    17907, 6429, 75, 5215, 5062, 14, 1, 55, 14, 14, 75, 5074,
+    111, 38, 5482, 5257, 404, 655, 636, 531, 160, 2632, 8823, 26778,
+    8487, 7296, 22290, 24892, 33577, 31215, 28401, 21796, 6533, 7181, 31870, 32492,
+    29860, 32363, 32187, 31766, 36442, 34976, 30538, 27034, 31308, 32065, 35538, 37289,
+    36722, 30465, 37034, 33126, 37431, 33127, 19609, 8315, 5641, 5099, 5050, 5037,
+    5074, 62, 75, 5355, 482, 6234, 983, 307, 7724, 14231, 1948, 12559,
+    221, 29702, 15465, 6423, 19231, 13255, 12852, 34122, 31186, 31228, 2157, 26051,
+    25153, 32858, 27694, 33284, 31686, 29318, 30373, 31894, 31509, 31442, 36442, 35367,
+    31699, 31106, 31039, 13999, 31918, 37296, 36618, 31850, 36765, 37705, 32413, 33107,
+    9512, 1, 6387, 5641, 75, 5215, 26, 380, 220, 343, 667, 269,
+    7083, 7498, 2901, 33187, 31186, 24873, 6435, 13994, 24116, 29360, 29164, 32492,
+    31911, 29086, 28378, 29947, 28964, 35550, 31198, 34224, 31735, 28151, 29708, 29628,
+    32033, 37040, 36436, 31898, 36722, 37705, 37431, 33126, 17760, 8255, 5947, 5099,
+    5062, 5050, 1, 75, 87, 62, 752, 544, 269, 1894, 6947, 14280,
+    1569, 690, 14000, 12034, 7059, 12285, 1583, 8963, 33560, 31215, 27681, 21558,
+    9965, 1576, 31186, 32095, 29281, 31911, 28677, 27431, 30642, 35550, 31247, 28004,
+    25489, 34224, 34164, 35538, 36442, 15618, 30667, 37315, 31247, 37460, 9714, 1,
+    6429, 75, 5111, 5062, 1, 75, 5111, 5648, 1080, 477, 28426, 2621,
+    1898, 21888, 30972, 23230, 5887, 12217, 10904, 3616, 17907, 11484, 28201, 30575,
+    26472, 20447, 29409, 34299, 31882, 31711, 32657, 29708, 31911, 28964, 36459, 35550,
+    31082, 13999, 32424, 36722, 32790, 19775, 8315, 1, 6740, 111, 75, 80,
+    25330, 7724, 1174, 636, 800, 12346, 14976, 2486, 17382, 29733, 14610, 34128,
+    31296, 29409, 2700, 23609, 32510, 32467, 31735, 33560, 29879, 35990, 31119, 29958,
+    28151, 35648, 30551, 31607, 27357, 37125, 36442, 30190, 36698, 37705, 37309, 33126,
+    17907, 1, 6429, 75, 5239, 5062, 288, 75, 5111, 5648, 710, 477,
+    28426, 8284, 6973, 8964, 34128, 31296, 27681, 10531, 1551, 21454, 33187, 31076,
+    31113, 31679, 31656, 30489, 31503, 36002, 31271, 35367, 28590, 35654, 32199, 30685,
+    37193, 36618, 31827, 32204, 37681, 15948, 32875, 17382, 8315, 1, 6454, 75,
+    5215, 75, 1228, 160, 7950, 612, 642, 10013, 27468, 11772, 3481, 12412,
+    33846, 31186, 26863, 11015, 22449, 25056, 31643, 983, 26131, 32552, 30490, 28932,
+    31638, 31857, 35569, 31998, 30997, 34488, 31540, 37193, 36442, 32065, 36618, 37705,
+    37301, 33126, 22339, 8315, 5648, 75, 5215, 5062, 159, 75, 5111, 5294,
+    335, 257, 942, 7724, 343, 1434, 337, 16417, 24281, 8224, 13255, 30813,
+    11400, 33841, 31186, 29360, 28999, 4330, 32492, 27522, 33284, 32986, 32363, 30673,
+    31484, 30404, 36436, 32095, 34976, 31699, 15325, 37289, 36618, 31546, 37022, 37852,
+    37460, 33126, 14244, 6710, 75, 5111, 5050, 1, 38, 307, 44, 5379,
+    38, 44, 75, 5543, 5654, 758, 27492, 9512, 355, 29702, 4788, 3633,
+    18914, 34122, 22339, 2651, 1136, 30813, 26577, 31215, 32498, 8921, 31741, 29708,
+    33853, 36442, 32095, 34989, 30550, 16522, 37315, 36618, 31349, 32016, 37724, 32436,
+    33107, 18151, 8255, 1, 6631, 5482, 5099, 276, 758, 355, 2101, 1434,
+    15331, 337, 275, 14146, 11485, 1827, 13480, 13555, 1741, 34122, 31215, 31228,
+    31209, 27681, 31186, 33065, 33365, 33853, 31911, 29318, 31503, 36442, 35306, 31357,
+    30136, 30832, 31638, 35782, 35965, 37301, 36722, 31943, 37052, 37852, 37699, 33126,
+    22339, 8315, 1, 5648, 5111, 75, 6, 312, 257, 7950, 1434, 15331,
+    642, 275, 12034, 7230, 3090, 15276, 31845, 18285, 22522, 33890, 31215, 29360,
+    25257, 20111, 31186, 32522, 31198, 29428, 31911, 27431, 31753, 36442, 32095, 34989,
+    31375, 15325, 37309, 31986, 28871, 16229, 37852, 37577, 33126, 19609, 8823, 1,
+    5636, 5099, 5062, 1, 544, 6350, 6783, 942, 611, 13492, 9098, 9567,
+    12412, 12956, 8426, 17107, 33187, 31210, 29360, 25105, 5533, 25794, 31741, 32492,
+    31911, 29086, 29934, 32467, 35672, 31375, 34549, 31827, 31271, 29708, 31503, 22192,
+    36668, 10440, 36234, 32265, 37186, 37729, 18229, 1, 7950, 6735, 5099, 5050,
+    75, 758, 2101, 1460, 690, 22290, 13333, 34128, 31143, 29372, 29164, 7491,
+    32339, 32327, 31741, 32363, 30490, 31595, 31473, 29615, 36442, 35294, 31191, 28738,
+    31308, 32065, 31741, 37309, 36722, 31925, 37186, 37852, 37577, 33164, 10257, 1,
+    6332, 5099, 5050, 111, 5074, 50, 50, 75, 655, 13072, 26723, 7950,
+    20862, 5295, 29360, 25257, 1308, 28414, 13494, 5703, 21454, 10923, 27064, 31577,
+    20349, 15868, 34432, 31882, 31992, 32088, 29481, 36039, 31271, 35404, 31308, 37186,
+    36722, 37711, 22339, 8315, 6710, 75, 5111, 5050, 5287, 26, 75, 1302,
+    6740, 6973, 3872, 7143, 2313, 642, 800, 8297, 6423, 2486, 7376, 31845,
+    18285, 28291, 34122, 31186, 32339, 32327, 25936, 29605, 33236, 27205, 26698, 29367,
+    31308, 31210, 30489, 29708, 31815, 36436, 35563, 31277, 34940, 20881, 13999, 31638,
+    37240, 32004, 36668, 37101, 32895, 37431, 38047, 22339, 6454, 5099, 5062, 14,
+    1, 111, 1, 1, 50, 6, 75, 75, 5482, 667, 13084, 337,
+    531, 269, 10324, 8823, 6973, 1003, 28951, 22668, 33896, 31215, 29365, 29164,
+    20715, 31870, 32583, 33365, 31473, 31992, 31827, 31753, 29481, 35569, 31015, 30136,
+    27376, 30514, 35538, 35050, 37052, 36442, 16180, 36735, 37699, 37309, 33126, 17907,
+    6454, 1, 5111, 5062, 14, 1, 1, 50, 697, 1198, 160, 10013,
+    9781, 8823, 7950, 28200, 10874, 22509, 34128, 29316, 25301, 27619, 21454, 30813,
+    12865, 31186, 32492, 27522, 31625, 32552, 31809, 34000, 36442, 32095, 35440, 30544,
+    31711, 32485, 36668, 31882, 37082, 32888, 32773, 33176, 18205, 6429, 1, 5099,
+    5062, 14, 14, 6, 75, 642, 28970, 372, 8823, 2186, 1728, 16735,
+    29702, 15947, 13255, 33841, 31215, 29414, 25336, 25600, 20617, 32510, 27522, 31740,
+    30605, 31911, 31833, 30136, 36411, 34970, 30452, 34207, 34201, 13999, 31674, 37289,
+    36618, 31870, 31729, 37852, 37577, 33084, 10257, 6454, 5654, 5099, 5062, 14,
+    1, 1, 75, 362, 258, 1033, 946, 13896, 953, 477, 9366, 2199,
+    746, 15417, 31252, 31228, 19616, 2455, 1704, 28200, 996, 282, 28401, 28932,
+    34122, 31186, 32649, 26106, 27205, 31679, 29318, 29506, 36234, 35440, 30997, 31638,
+    37186, 36618, 37705, 17907, 8029, 6454, 5648, 5111, 75, 50, 367, 282,
+    6258, 1302, 160, 2485, 7058, 14872, 1569, 611, 1564, 800, 9934, 21601,
+    6998, 22290, 23316, 33890, 31186, 29409, 1691, 13744, 31882, 32400, 32327, 31735,
+    29367, 31911, 31442, 31210, 31925, 30416, 35782, 31271, 34439, 30397, 35421, 22192,
+    31325, 37186, 36442, 31711, 26009, 37460, 32265, 38053, 10257, 6454, 111, 5189,
+    5074, 5050, 5099, 55, 135, 233, 80, 124, 13854, 5482, 5257, 410,
+    953, 7553, 8774, 4769, 1655, 20862, 33577, 26947, 5874, 22449, 13767, 22437,
+    6051, 24623, 31076, 31228, 996, 32339, 29994, 31911, 35953, 31711, 34390, 28365,
+    31106, 31772, 31503, 29947, 32228, 15618, 36618, 37724, 37375, 33017, 19775, 6454,
+    1, 5641, 5099, 5062, 13, 527, 258, 5801, 1087, 611, 28970, 372,
+    428, 10904, 233, 9366, 15417, 2101, 16155, 15465, 24659, 28146, 33194, 31337,
+    29360, 29079, 25728, 32339, 32327, 26331, 29086, 29866, 35550, 31247, 34224, 27956,
+    30172, 29708, 35538, 36618, 31955, 30136, 14653, 37711, 37186, 33151, 8029, 6710,
+    75, 190, 5062, 5050, 1, 14, 55, 5263, 75, 5111, 25, 105,
+    5501, 62, 397, 3487, 227, 13909, 2980, 17120, 5080, 33890, 23762, 5874,
+    21643, 1564, 16900, 29702, 18615, 31215, 29360, 5386, 31870, 29494, 31911, 35868,
+    32041, 31106, 34488, 29873, 37125, 36436, 31918, 36649, 37724, 37289, 33107, 17907,
+    6710, 5641, 5099, 5062, 14, 1, 1, 50, 335, 6075, 282, 410,
+    1491, 942, 27492, 555, 800, 6740, 1174, 19586, 12034, 4299, 10452, 14067,
+    29530, 33577, 31296, 31252, 1271, 26583, 24873, 31699, 32492, 31911, 31528, 29305,
+    29947, 35550, 31106, 34573, 28016, 28419, 34164, 29708, 31325, 36442, 32065, 15618,
+    37309, 36722, 37687, 17382, 6710, 75, 5135, 5050, 1, 5074, 287, 14,
+    5392, 75, 5111, 38, 5482, 87, 397, 758, 611, 153, 30673, 9366,
+    16380, 2101, 31411, 10312, 7864, 23633, 33223, 31186, 29316, 28999, 22339, 32498,
+    27522, 27205, 28817, 27840, 31210, 35538, 30567, 34244, 31741, 28419, 34201, 30685,
+    36722, 14982, 36442, 37705, 37125, 33107, 19609, 8315, 1, 6429, 75, 5215,
+    38, 763, 28426, 2546, 1569, 28921, 555, 233, 29702, 14146, 11552, 13120,
+    6973, 34122, 31296, 31228, 31209, 31833, 31870, 32657, 29281, 32907, 32187, 28932,
+    31503, 35990, 31113, 35337, 34439, 30098, 32199, 35482, 37052, 15618, 36442, 37460,
+    37301, 33164, 18205, 6710, 75, 5111, 5050, 5037, 5074, 5276, 19, 148,
+    75, 5111, 87, 105, 5648, 5294, 362, 1215, 27492, 1180, 800, 6740,
+    428, 8823, 7950, 7663, 11296, 29702, 21808, 29225, 33846, 31215, 29316, 25257,
+    26863, 31943, 31186, 32492, 33365, 33267, 31911, 29237, 31638, 36002, 32199, 34970,
+    30538, 31180, 37327, 36436, 30274, 36722, 32816, 37577, 33164, 18205, 6740, 1,
+    87, 75, 75, 75, 38, 32, 5482, 1155, 15331, 642, 10013, 1174,
+    15465, 20257, 12034, 14067, 12883, 10929, 33017, 31027, 31234, 31179, 25789, 25136,
+    18115, 32498, 31857, 29086, 30594, 35672, 31113, 34244, 26668, 28524, 29708, 31815,
+    31490, 36722, 15618, 36442, 37309, 251, 37937, 22339, 6429, 1, 5648, 75,
+    190, 26, 5678, 220, 543, 1215, 7692, 307, 372, 172, 1064, 12034,
+    2790, 959, 7174, 22668, 19609, 27528, 33584, 31215, 29409, 25831, 24751, 25575,
+    31870, 32492, 31911, 31911, 29086, 31821, 32467, 35550, 31375, 34561, 20971, 27699,
+    29708, 34000, 22192, 36618, 15605, 32126, 37460, 37193, 32981, 10257, 6429, 5648,
+    5099, 5062, 14, 1, 1, 75, 445, 282, 258, 1765, 6142, 23046,
+    710, 13072, 307, 160, 9366, 16380, 6973, 16094, 33053, 31093, 29360, 25105,
+    1130, 28139, 32339, 32327, 27297, 31911, 29879, 29305, 29947, 35550, 31589, 34964,
+    27211, 28590, 31650, 20881, 36618, 32070, 30331, 37375, 37082, 32688, 18205, 6429,
+    1, 5648, 111, 75, 31, 472, 282, 14159, 710, 7692, 307, 788,
+    337, 1064, 9567, 2888, 7631, 14244, 27853, 13345, 33896, 30813, 31234, 31204,
+    26167, 32339, 32320, 33230, 33279, 31093, 31699, 31308, 31686, 29684, 35611, 31490,
+    31106, 34244, 31717, 36436, 10746, 3304, 31760, 37301, 36722, 37729, 18205, 8029,
+    5654, 111, 5111, 5062, 5184, 25, 5105, 5257, 343, 14763, 6398, 1765,
+    411, 1569, 555, 13842, 29702, 10874, 2595, 14610, 22509, 12852, 33890, 30716,
+    28139, 19609, 26448, 32510, 27522, 27192, 29433, 31210, 27528, 31911, 30416, 29543,
+    36142, 34830, 30483, 27041, 31357, 31235, 35404, 35482, 37289, 36618, 31051, 37193,
+    37705, 37351, 38107, 22437, 8315, 1, 5648, 5099, 5062, 75, 514, 6234,
+    7950, 2352, 28921, 1180, 15947, 22290, 8823, 30813, 26577, 34122, 31215, 32492,
+    996, 26583, 27674, 31748, 33206, 28817, 27431, 28378, 31308, 31503, 36442, 35440,
+    31106, 34647, 34530, 13999, 30282, 37301, 36722, 31906, 37040, 37705, 32436, 33126,
+    8315, 1, 5654, 5099, 5062, 14, 1, 62, 75, 5257, 270, 257,
+    220, 160, 7950, 343, 28139, 1088, 27706, 5868, 642, 246, 21887, 8284,
+    11485, 14182, 31320, 28213, 34299, 31369, 32620, 31050, 31772, 29494, 29318, 29708,
+    36564, 35440, 31222, 15325, 37289, 37052, 37724, 17907, 8255, 5641, 5099, 5062,
+    14, 19, 75, 87, 62, 318, 6373, 942, 18163, 1589, 429, 1434,
+    275, 251, 10324, 11381, 9567, 5887, 11087, 33560, 26863, 22431, 6533, 30813,
+    25893, 19977, 21185, 31882, 32492, 4519, 30776, 31290, 35990, 31247, 35099, 27779,
+    31180, 34317, 31503, 32199, 37186, 36618, 30453, 32204, 37724, 37431, 33126, 17851,
+    6710, 1, 5641, 5111, 75, 1, 335, 6234, 477, 758, 27492, 1564,
+    251, 9512, 29244, 29702, 14146, 4788, 6235, 13255, 29225, 33187, 31210, 27681,
+    25386, 21454, 21284, 31741, 31252, 31308, 32394, 31362, 35782, 34818, 31589, 34793,
+    30001, 31082, 35410, 35587, 37138, 15618, 36436, 37724, 37301, 33066, 17907, 6454,
+    5648, 5099, 5062, 14, 5086, 1, 50, 441, 30087, 6258, 14159, 1398,
+    697, 611, 1337, 6600, 1564, 9512, 8823, 7613, 1728, 8255, 22290, 24892,
+    33890, 31215, 27681, 10531, 27633, 23609, 31186, 32339, 31911, 33853, 31911, 30385,
+    35563, 31369, 34201, 29708, 31069, 34201, 20881, 36618, 31809, 36142, 36210, 37431,
+    37186, 33107, 8315, 1, 5648, 5099, 5050, 111, 5074, 50, 44, 75,
+    335, 6234, 942, 6625, 1638, 691, 2627, 29360, 1076, 1324, 1564, 531,
+    28677, 24965, 14334, 11485, 4330, 29781, 20727, 34122, 31204, 32339, 32327, 33584,
+    32363, 29647, 29708, 36436, 35563, 31106, 13999, 37460, 31418, 37724, 19775, 8315,
+    1, 5648, 75, 5111, 75, 482, 6234, 7950, 1948, 1564, 251, 15465,
+    29702, 11870, 13255, 14739, 1827, 33560, 31882, 31228, 31209, 29409, 32510, 27674,
+    31552, 32290, 28964, 36448, 34873, 31589, 27730, 31400, 31119, 36344, 36002, 37186,
+    36808, 31870, 37034, 37729, 32712, 33126, 22339, 6454, 1, 87, 5215, 5062,
+    185, 26, 32, 5648, 667, 7692, 788, 269, 221, 14146, 8823, 2546,
+    22290, 21777, 28207, 33890, 31204, 28139, 10861, 13469, 23762, 32498, 27522, 31625,
+    29428, 31308, 30489, 32833, 33809, 35538, 31106, 30153, 28377, 30758, 29873, 31308,
+    36674, 32126, 10440, 37595, 37186, 37852, 10257, 1, 6429, 5482, 5099, 5062,
+    75, 404, 15820, 5801, 667, 2107, 269, 8823, 2546, 2582, 27003, 1130,
+    27706, 13767, 233, 29892, 14390, 30813, 19609, 27975, 26674, 24622, 33560, 31186,
+    31234, 31209, 32498, 32552, 30673, 35782, 31106, 34488, 29708, 37113, 36436, 37577,
+    19609, 6429, 1, 5648, 111, 75, 50, 527, 983, 6258, 392, 642,
+    251, 24177, 9366, 8029, 13762, 17650, 11782, 10685, 33902, 31143, 27681, 26375,
+    22309, 6680, 31436, 6790, 32613, 29494, 31308, 32986, 29318, 31753, 36002, 32199,
+    34976, 30538, 31753, 32241, 36674, 31894, 31992, 37826, 37675, 38249, 17907, 9000,
+    7, 5648, 75, 5215, 75, 514, 421, 7083, 2834, 12034, 5838, 4531,
+    22645, 11441, 5887, 22290, 34122, 31296, 26863, 10531, 8023, 23230, 32492, 27674,
+    31149, 29519, 29318, 31949, 30758, 30843, 36442, 32199, 35404, 31198, 31638, 37296,
+    31998, 36808, 37113, 37705, 32291, 33107, 17907, 8315, 7, 6710, 5099, 5062,
+    50, 1302, 29244, 7143, 1003, 13059, 10013, 29702, 10874, 6222, 25905, 31766,
+    12852, 33890, 31186, 29414, 25232, 23951, 25862, 32363, 23103, 30636, 33089, 29086,
+    29305, 30594, 31686, 29684, 35306, 30544, 34561, 34207, 28530, 34201, 30563, 36674,
+    14982, 32126, 37375, 37034, 37924, 22339, 8255, 1, 5947, 5111, 75, 50,
+    954, 6350, 1632, 1788, 1589, 531, 12333, 5838, 4531, 21741, 24892, 33577,
+    31215, 29409, 6949, 27358, 25673, 31186, 32492, 31911, 31911, 31857, 28378, 30642,
+    35868, 31271, 34757, 34244, 35404, 29708, 20881, 37277, 36564, 31705, 36796, 32803,
+    37699, 37821, 22431, 8029, 6710, 87, 75, 190, 62, 38, 5080, 75,
+    1412, 783, 2101, 8274, 1174, 636, 800, 15465, 7772, 6235, 10307, 30813,
+    28207, 33841, 31540, 28401, 25526, 18097, 21649, 31875, 32498, 32187, 30433, 31308,
+    35550, 30567, 34207, 30636, 28365, 29885, 34457, 36618, 16081, 30282, 32424, 37186,
+    32901, 8315, 1, 6710, 5482, 5111, 75, 50, 397, 28182, 5795, 977,
+    355, 7522, 6973, 31228, 29152, 25526, 1820, 337, 18285, 14244, 22351, 20453,
+    28932, 33896, 31296, 30911, 32412, 31198, 33853, 29879, 36442, 34830, 30159, 32065,
+    37301, 36674, 37937, 18205, 6710, 1, 5648, 75, 5215, 26, 299, 29483,
+    520, 758, 7692, 783, 287, 15465, 19586, 24659, 26526, 12401, 8963, 33896,
+    31143, 26863, 30813, 11002, 32088, 12815, 25806, 33089, 31911, 31857, 30416, 31911,
+    36448, 35440, 34432, 30159, 31106, 15618, 31711, 37309, 36722, 31925, 37052, 33053,
+    37699, 32566, 8255, 1, 6454, 5111, 5062, 14, 1, 1, 50, 758,
+    28426, 16735, 1680, 31899, 32339, 27382, 29360, 1137, 28414, 20532, 23176, 30642,
+    31106, 27766, 27498, 31850, 32187, 31595, 34183, 31149, 33577, 30502, 27278, 29433,
+    31777, 29708, 36442, 32199, 35538, 37315, 36722, 37724,
+};
+
+static const int16_t voltage_q_children[4696] = {
+    1, 28, 2, 17, 3, 10, 4, 7, 5, 6, -1, -2, -3, -4, 8, 9,
+    -5, -6, -7, -8, 11, 14, 12, 13, -9, -10, -11, -12, 15, 16, -13, -14,
+    -15, -16, 18, 22, 19, 21, 20, -19, -17, -18, -20, -21, 23, 26, 24, 25,
+    -22, -23, -24, -3, 27, -27, -25, -26, 29, 40, 30, 37, 31, 34, 32, 33,
+    -20, -28, -29, -30, 35, 36, -31, -32, -33, -34, 38, -38, 39, -37, -35, -36,
+    41, 47, 42, 45, 43, 44, -39, -40, -41, -42, 46, -45, -43, -44, 48, 51,
+    49, 50, -46, -47, -48, -49, 52, 53, -50, -51, -52, -53, 55, 79, 56, 70,
+    57, 64, 58, 61, 59, 60, -54, -55, -56, -57, 62, 63, -58, -27, -59, -60,
+    65, 68, 66, 67, -61, -62, -63, -64, 69, -67, -65, -66, 71, 73, 72, -19,
+    -20, -68, 74, 77, 75, 76, -69, -70, -71, -72, 78, -75, -73, -74, 80, 94,
+    81, 88, 82, 85, 83, 84, -76, -77, -78, -79, 86, 87, -80, -81, -82, -83,
+    89, 92, 90, 91, -36, -84, -85, -37, 93, -88, -86, -87, 95, 101, 96, 99,
+    97, 98, -89, -90, -91, -92, -93, 100, -94, -45, 102, 105, 103, 104, -95, -96,
+    -97, -98, 106, 107, -99, -100, -101, -102, 109, 123, -103, 110, 111, 118, 112, 115,
+    113, 114, -104, -105, -106, -107, 116, 117, -62, -108, -109, -110, 119, 120, -64, -18,
+    121, 122, -111, -112, -113, -114, 124, 137, 125, 132, 126, 129, 127, 128, -115, -116,
+    -117, -118, 130, 131, -119, -77, -120, -121, 133, 136, 134, 135, -35, -87, -85, -37,
+    -38, -33, 138, 145, 139, 142, 140, 141, -122, -123, -124, -125, 143, 144, -126, -127,
+    -128, -129, 146, 149, 147, 148, -130, -45, -131, -132, 150, 151, -133, -134, -135, -136,
+    153, 176, 154, 168, 155, 162, 156, 159, 157, 158, -137, -138, -3, -139, 160, 161,
+    -140, -141, -142, -143, 163, 165, -144, 164, -64, -18, 166, 167, -145, -146, -147, -148,
+    169, 170, -68, -20, 171, 174, 172, 173, -149, -150, -151, -152, -153, 175, -154, -155,
+    177, 189, 178, 185, 179, 182, 180, 181, -156, -157, -29, -158, 183, 184, -159, -160,
+    -33, -34, 186, -38, 187, 188, -36, -35, -85, -37, 190, 196, 191, 194, 192, 193,
+    -161, -162, -163, -164, -127, 195, -165, -129, 197, 199, -93, 198, -166, -167, 200, 201,
+    -168, -169, -170, -171, 203, 218, -103, 204, 205, 212, 206, 209, 207, 208, -172, -173,
+    -174, -175, 210, 211, -176, -141, -177, -178, 213, 215, 214, -21, -18, -64, 216, 217,
+    -179, -180, -181, -182, 219, 231, 220, 227, 221, 224, 222, 223, -20, -183, -19, -73,
+    225, 226, -74, -184, -185, -186, 228, -87, 229, 230, -187, -188, -189, -190, 232, 238,
+    233, 236, 234, 235, -191, -192, -193, -88, -35, 237, -38, -33, 239, 242, 240, 241,
+    -194, -195, -93, -196, 243, 244, -197, -198, -199, -200, 246, 263, 247, 254, -103, 248,
+    249, 252, 250, 251, -201, -202, -203, -204, 253, -64, -205, -67, 255, 257, -19, 256,
+    -21, -20, 258, 261, 259, 260, -206, -207, -155, -208, 262, -74, -209, -210, 264, 273,
+    265, 271, 266, 268, -77, 267, -211, -212, 269, 270, -213, -214, -215, -216, 272, -127,
+    -35, -85, 274, 281, 275, 278, 276, 277, -217, -218, -219, -220, 279, 280, -221, -222,
+    -223, -224, 282, 285, 283, 284, -225, -226, -227, -228, 286, 287, -229, -230, -231, -232,
+    289, 304, -103, 290, 291, 298, 292, 295, 293, 294, -233, -234, -235, -236, 296, 297,
+    -237, -238, -239, -240, 299, 301, 300, -21, -18, -64, 302, 303, -241, -242, -243, -244,
+    305, 317, 306, 313, 307, 310, 308, 309, -29, -245, -246, -247, 311, 312, -248, -33,
+    -249, -34, 314, 316, -85, 315, -84, -36, -127, -250, 318, 324, 319, 322, 320, 321,
+    -251, -252, -253, -254, 323, -129, -255, -256, 325, 328, 326, 327, -257, -258, -259, -260,
+    329, 330, -261, -262, -263, -264, 332, 348, 333, 341, -103, 334, 335, 338, 336, 337,
+    -265, -266, -267, -268, 339, 340, -17, -18, -269, -67, 342, 344, 343, -21, -68, -183,
+    345, -73, 346, 347, -270, -271, -272, -273, 349, 362, 350, 357, 351, 354, 352, 353,
+    -274, -275, -276, -277, 355, 356, -278, -279, -280, -281, 358, 360, -37, 359, -36, -87,
+    361, -84, -88, -33, 363, 367, 364, -129, 365, 366, -282, -283, -284, -285, 368, 371,
+    369, 370, -286, -45, -287, -288, 372, 373, -289, -290, -291, -292, 375, 397, 376, 389,
+    377, 384, 378, 381, 379, 380, -293, -294, -295, -296, 382, 383, -297, -238, -298, -299,
+    385, 387, 386, -18, -108, -62, 388, -67, -109, -300, 390, 391, -68, -21, 392, 395,
+    393, 394, -301, -302, -303, -75, 396, -277, -304, -305, 398, 410, 399, 405, 400, 402,
+    401, -77, -29, -306, 403, 404, -307, -308, -309, -310, 406, 408, 407, -38, -37, -311,
+    -84, 409, -312, -88, 411, 415, 412, -129, 413, 414, -313, -314, -93, -315, 416, 419,
+    417, 418, -316, -317, -318, -319, 420, 421, -320, -321, -322, -323, 423, 445, 424, 437,
+    425, 432, 426, 429, 427, 428, -324, -325, -326, -327, 430, 431, -328, -329, -3, -330,
+    433, 434, -331, -141, 435, 436, -332, -144, -333, -334, 438, 441, 439, 440, -68, -20,
+    -64, -17, 442, -73, 443, 444, -335, -336, -337, -27, 446, 457, 447, 451, 448, 449,
+    -19, -20, 450, -277, -338, -339, 452, 455, 453, 454, -340, -341, -342, -343, 456, -88,
+    -344, -345, 458, 462, 459, -129, 460, 461, -346, -347, -93, -348, 463, 466, 464, 465,
+    -349, -350, -351, -352, 467, 468, -353, -354, -355, -356, 470, 489, 471, 479, -103, 472,
+    473, 476, 474, 475, -357, -358, -359, -360, 477, 478, -64, -17, -361, -362, 480, 483,
+    481, -19, 482, -21, -183, -68, 484, 487, 485, 486, -363, -364, -365, -27, 488, -273,
+    -366, -367, 490, 501, 491, 497, 492, 494, 493, -76, -368, -369, 495, 496, -370, -371,
+    -33, -34, 498, 500, 499, -38, -372, -373, -374, -250, 502, 509, 503, 506, 504, 505,
+    -375, -376, -91, -377, 507, 508, -378, -379, -380, -381, 510, 513, 511, 512, -382, -383,
+    -384, -385, 514, 515, -386, -387, -388, -389, 517, 537, 518, 526, -103, 519, 520, 523,
+    521, 522, -390, -391, -11, -392, 524, 525, -108, -18, -393, -67, 527, 530, 528, -19,
+    529, -21, -183, -68, 531, 534, 532, 533, -149, -206, -394, -109, 535, 536, -395, -396,
+    -75, -397, 538, 549, 539, 545, 540, 542, 541, -77, -398, -399, 543, 544, -400, -401,
+    -33, -34, 546, 548, 547, -38, -36, -402, -250, -88, 550, 554, 551, -129, 552, 553,
+    -403, -404, -93, -405, 555, 558, 556, 557, -406, -407, -408, -409, 559, 560, -410, -411,
+    -412, -413, 562, 580, 563, 571, -103, 564, 565, 568, 566, 567, -414, -415, -11, -416,
+    569, 570, -417, -17, -418, -419, 572, 573, -19, -183, 574, 577, 575, 576, -149, -420,
+    -109, -421, 578, 579, -422, -423, -424, -72, 581, 592, 582, 588, 583, 586, 584, 585,
+    -425, -426, -277, -77, 587, -33, -427, -428, 589, -38, 590, 591, -429, -36, -37, -85,
+    593, 600, 594, 597, 595, 596, -430, -123, -431, -432, 598, 599, -127, -250, -129, -433,
+    601, 603, -93, 602, -434, -435, 604, 605, -436, -437, -438, -439, 607, 619, -103, 608,
+    609, 615, 610, 613, 611, 612, -440, -441, -442, -443, -64, 614, -444, -445, 616, 617,
+    -68, -20, 618, -27, -446, -447, 620, 632, 621, 627, 622, 624, 623, -77, -448, -449,
+    625, 626, -450, -84, -451, -123, 628, 630, -37, 629, -36, -330, -84, 631, -38, -452,
+    633, 639, 634, 637, 635, 636, -453, -454, -432, -455, 638, -45, -456, -457, 640, 643,
+    641, 642, -458, -459, -460, -461, 644, 645, -462, -463, -464, -465, 647, 662, -103, 648,
+    649, 656, 650, 653, 651, 652, -466, -467, -468, -469, 654, 655, -470, -471, -472, -473,
+    657, 659, -21, 658, -18, -17, 660, 661, -474, -475, -476, -394, 663, 674, 664, 671,
+    665, 668, 666, 667, -477, -478, -19, -479, 669, 670, -74, -480, -481, -482, 672, -483,
+    -27, 673, -77, -36, 675, 679, 676, 678, 677, -37, -484, -485, -35, -38, 680, 683,
+    681, 682, -486, -487, -432, -488, 684, 685, -489, -490, -491, -492, 687, 710, 688, 700,
+    689, 695, 690, 693, 691, 692, -493, -494, -495, -496, -141, 694, -497, -498, 696, 697,
+    -17, -64, 698, 699, -499, -500, -501, -502, 701, 703, -183, 702, -21, -20, 704, 707,
+    705, 706, -420, -207, -394, -109, 708, 709, -503, -504, -75, -277, 711, 725, 712, 719,
+    713, 716, 714, 715, -505, -506, -84, -507, 717, 718, -508, -509, -510, -511, 720, 723,
+    721, 722, -512, -38, -513, -36, 724, -88, -127, -34, 726, 732, 727, 730, 728, 729,
+    -514, -515, -129, -516, -93, 731, -517, -518, 733, 736, 734, 735, -519, -520, -521, -522,
+    737, 738, -523, -524, -525, -526, 740, 764, 741, 753, 742, 749, 743, 746, 744, 745,
+    -527, -528, -529, -10, 747, 748, -530, -3, -531, -532, -11, 750, 751, 752, -533, -534,
+    -535, -536, 754, 758, 755, 757, 756, -21, -68, -183, -64, -18, 759, 762, 760, 761,
+    -537, -538, -149, -539, 763, -542, -540, -541, 765, 777, 766, 772, 767, 769, 768, -77,
+    -543, -544, 770, 771, -545, -546, -33, -34, 773, 774, -84, -37, 775, 776, -250, -88,
+    -35, -38, 778, 784, 779, 782, 780, 781, -547, -548, -549, -550, 783, -129, -551, -552,
+    785, 788, 786, 787, -93, -553, -554, -555, 789, 790, -556, -557, -558, -559, 792, 810,
+    793, 800, -103, 794, 795, 798, 796, 797, -560, -561, -3, -562, -11, 799, -563, -564,
+    801, 804, 802, 803, -17, -18, -21, -183, 805, 807, 806, -149, -565, -566, 808, 809,
+    -567, -568, -243, -75, 811, 824, 812, 817, 813, 815, 814, -77, -569, -570, 816, -277,
+    -571, -572, 818, 821, 819, 820, -573, -574, -575, -123, 822, 823, -35, -37, -576, -127,
+    825, 829, 826, -129, 827, 828, -577, -578, -579, -580, 830, 833, 831, 832, -581, -582,
+    -583, -584, 834, 835, -585, -586, -587, -588, 837, 855, 838, 845, -103, 839, 840, 843,
+    841, 842, -589, -590, -591, -592, -11, 844, -593, -594, 846, 848, 847, -19, -18, -17,
+    849, 852, 850, 851, -595, -113, -596, -3, 853, 854, -597, -598, -243, -75, 856, 868,
+    857, 864, 858, 861, 859, 860, -599, -600, -542, -601, 862, 863, -602, -603, -604, -34,
+    865, 867, 866, -38, -605, -35, -88, -37, 869, 875, 870, 873, 871, 872, -606, -607,
+    -127, -608, -93, 874, -609, -610, 876, 879, 877, 878, -611, -612, -613, -614, 880, 881,
+    -615, -616, -617, -618, 883, 902, 884, 896, 885, 891, 886, 889, 887, 888, -619, -620,
+    -621, -622, -11, 890, -623, -624, 892, 893, -108, -109, 894, 895, -625, -626, -627, -628,
+    897, 898, -18, -21, 899, -539, 900, 901, -629, -630, -631, -632, 903, 912, 904, 911,
+    905, 908, 906, 907, -633, -19, -634, -635, 909, 910, -636, -637, -638, -639, -36, -87,
+    913, 920, 914, 917, 915, 916, -640, -641, -642, -643, 918, 919, -84, -644, -35, -645,
+    921, 924, 922, 923, -646, -647, -648, -649, 925, 926, -650, -651, -652, -653, 928, 951,
+    929, 942, 930, 937, 931, 934, 932, 933, -654, -655, -656, -657, 935, 936, -62, -658,
+    -659, -660, 938, 939, -17, -18, 940, 941, -499, -630, -661, -662, 943, 946, -19, 944,
+    -183, 945, -21, -20, 947, 949, 948, -73, -663, -664, 950, -27, -109, -665, 952, 966,
+    953, 960, 954, 957, 955, 956, -29, -20, -666, -277, 958, 959, -667, -668, -669, -123,
+    961, 964, 962, 963, -35, -670, -33, -38, 965, -37, -126, -88, 967, 973, 968, 971,
+    969, 970, -671, -672, -673, -674, -129, 972, -432, -675, 974, 977, 975, 976, -676, -677,
+    -678, -679, 978, 979, -680, -681, -682, -683, 981, 1002, 982, 996, 983, 990, 984, 987,
+    985, 986, -684, -685, -686, -687, 988, 989, -5, -6, -688, -689, 991, 993, -11, 992,
+    -331, -144, 994, 995, -690, -691, -359, -692, 997, 998, -18, -21, 999, -539, 1000, 1001,
+    -693, -694, -695, -632, 1003, 1016, 1004, 1010, 1005, 1007, 1006, -116, -696, -20, 1008, 1009,
+    -73, -697, -698, -36, 1011, 1014, 1012, 1013, -699, -700, -701, -702, 1015, -37, -34, -33,
+    1017, 1024, 1018, 1021, 1019, 1020, -703, -704, -705, -706, 1022, 1023, -127, -250, -707, -708,
+    1025, 1027, -93, 1026, -709, -710, 1028, 1029, -711, -712, -713, -714, 1031, 1054, 1032, 1040,
+    -103, 1033, 1034, 1037, 1035, 1036, -715, -716, -11, -717, 1038, 1039, -718, -109, -719, -720,
+    1041, 1047, 1042, 1045, 1043, 1044, -18, -17, -64, -19, 1046, -183, -20, -21, 1048, 1051,
+    1049, 1050, -721, -722, -632, -24, 1052, 1053, -723, -724, -725, -542, 1055, 1064, 1056, 1062,
+    1057, 1059, 1058, -77, -726, -727, 1060, 1061, -728, -729, -730, -731, 1063, -85, -87, -36,
+    1065, 1071, 1066, 1069, 1067, 1068, -732, -733, -734, -735, -127, 1070, -736, -129, 1072, 1075,
+    1073, 1074, -737, -738, -45, -739, 1076, 1077, -740, -741, -742, -743, 1079, 1101, 1080, 1095,
+    1081, 1088, 1082, 1085, 1083, 1084, -744, -745, -3, -746, 1086, 1087, -330, -747, -748, -87,
+    1089, 1092, 1090, 1091, -749, -750, -141, -11, 1093, 1094, -391, -751, -752, -753, 1096, 1097,
+    -17, -64, 1098, -632, 1099, 1100, -754, -755, -756, -76, 1102, 1115, 1103, 1109, 1104, 1106,
+    1105, -116, -757, -758, 1107, 1108, -759, -760, -761, -762, 1110, 1113, 1111, 1112, -77, -763,
+    -764, -765, 1114, -250, -766, -38, 1116, 1120, 1117, -129, 1118, 1119, -767, -768, -127, -769,
+    1121, 1124, 1122, 1123, -770, -45, -771, -772, 1125, 1126, -773, -774, -775, -776, 1128, 1153,
+    1129, 1141, 1130, 1136, 1131, 1134, 1132, 1133, -777, -778, -748, -779, -11, 1135, -780, -781,
+    1137, 1139, 1138, -18, -62, -108, -109, 1140, -782, -783, 1142, 1147, 1143, 1145, -68, 1144,
+    -21, -20, -17, 1146, -64, -19, 1148, 1151, 1149, 1150, -784, -785, -786, -787, -632, 1152,
+    -27, -3, 1154, 1165, 1155, 1162, 1156, 1159, 1157, 1158, -788, -789, -790, -791, 1160, 1161,
+    -792, -793, -794, -33, 1163, 1164, -87, -35, -85, -37, 1166, 1173, 1167, 1170, 1168, 1169,
+    -795, -796, -797, -798, 1171, 1172, -799, -88, -800, -801, 1174, 1176, 1175, -45, -93, -802,
+    1177, 1178, -803, -804, -805, -806, 1180, 1206, 1181, 1195, 1182, 1189, 1183, 1186, 1184, 1185,
+    -807, -808, -809, -810, 1187, 1188, -811, -812, -813, -6, 1190, 1192, 1191, -11, -814, -815,
+    1193, 1194, -816, -817, -818, -819, 1196, 1199, 1197, -183, -17, 1198, -19, -64, 1200, 1203,
+    1201, 1202, -820, -821, -632, -3, 1204, 1205, -822, -155, -823, -27, 1207, 1217, 1208, 1214,
+    1209, 1211, 1210, -77, -824, -825, 1212, 1213, -826, -827, -828, -829, 1215, 1216, -36, -87,
+    -33, -38, 1218, 1224, 1219, 1222, 1220, 1221, -830, -123, -831, -832, -374, 1223, -833, -834,
+    1225, 1227, -93, 1226, -835, -836, 1228, 1229, -837, -838, -839, -840, 1231, 1249, 1232, 1240,
+    -103, 1233, 1234, 1237, 1235, 1236, -841, -842, -843, -844, 1238, 1239, -18, -64, -845, -846,
+    1241, 1244, 1242, -19, -68, 1243, -20, -21, 1245, 1248, 1246, 1247, -847, -848, -849, -850,
+    -73, -74, 1250, 1261, 1251, 1257, 1252, 1254, 1253, -76, -851, -277, 1255, 1256, -852, -853,
+    -33, -34, 1258, 1260, 1259, -37, -36, -311, -374, -250, 1262, 1268, 1263, 1266, 1264, 1265,
+    -854, -855, -856, -857, 1267, -129, -858, -859, 1269, 1271, -93, 1270, -860, -861, 1272, 1273,
+    -862, -863, -864, -865, 1275, 1304, 1276, 1291, 1277, 1284, 1278, 1281, 1279, 1280, -866, -867,
+    -868, -869, 1282, 1283, -328, -870, -871, -84, 1285, 1288, 1286, 1287, -872, -873, -141, -11,
+    1289, 1290, -874, -875, -62, -876, 1292, 1297, 1293, 1295, -68, 1294, -21, -20, -17, 1296,
+    -64, -19, 1298, 1301, 1299, 1300, -877, -3, -67, -394, 1302, 1303, -878, -27, -73, -74,
+    1305, 1317, 1306, 1313, 1307, 1310, 1308, 1309, -879, -880, -601, -542, 1311, 1312, -881, -882,
+    -33, -34, 1314, 1316, 1315, -38, -883, -37, -88, -84, 1318, 1322, 1319, -129, 1320, 1321,
+    -884, -885, -886, -887, 1323, 1326, 1324, 1325, -888, -889, -890, -891, 1327, 1328, -892, -893,
+    -894, -895, 1330, 1350, 1331, 1339, -103, 1332, 1333, 1336, 1334, 1335, -896, -897, -898, -899,
+    1337, 1338, -900, -238, -901, -902, 1340, 1344, 1341, 1343, 1342, -21, -68, -183, -64, -19,
+    1345, 1348, 1346, 1347, -903, -904, -632, -27, 1349, -907, -905, -906, 1351, 1361, 1352, 1358,
+    1353, 1355, 1354, -76, -908, -909, 1356, 1357, -910, -911, -912, -913, 1359, -38, -87, 1360,
+    -37, -85, 1362, 1369, 1363, 1366, 1364, 1365, -914, -915, -916, -917, 1367, 1368, -127, -34,
+    -918, -129, 1370, 1372, -93, 1371, -919, -920, 1373, 1374, -921, -922, -923, -924, 1376, 1398,
+    1377, 1385, -103, 1378, 1379, 1382, 1380, 1381, -925, -926, -927, -928, 1383, 1384, -62, -108,
+    -109, -929, 1386, 1391, 1387, 1389, 1388, -64, -18, -17, -20, 1390, -68, -183, 1392, 1395,
+    1393, 1394, -930, -206, -931, -932, 1396, 1397, -933, -934, -27, -277, 1399, 1411, 1400, 1407,
+    1401, 1404, 1402, 1403, -935, -77, -936, -937, 1405, 1406, -938, -939, -34, -33, 1408, -38,
+    1409, 1410, -940, -36, -37, -85, 1412, 1419, 1413, 1416, 1414, 1415, -941, -942, -943, -944,
+    1417, 1418, -250, -127, -129, -945, 1420, 1422, -93, 1421, -946, -45, 1423, 1424, -947, -948,
+    -949, -950, 1426, 1448, 1427, 1440, 1428, 1434, 1429, 1432, 1430, 1431, -951, -952, -621, -953,
+    -11, 1433, -954, -955, 1435, 1437, -62, 1436, -658, -109, 1438, 1439, -956, -957, -958, -959,
+    1441, 1444, -21, 1442, 1443, -64, -17, -18, 1445, -539, 1446, 1447, -960, -961, -632, -962,
+    1449, 1461, 1450, 1457, 1451, 1454, 1452, 1453, -963, -964, -965, -483, 1455, 1456, -966, -84,
+    -967, -968, 1458, -38, 1459, 1460, -87, -35, -85, -37, 1462, 1468, 1463, 1466, 1464, 1465,
+    -969, -970, -971, -972, -250, 1467, -129, -973, 1469, 1471, 1470, -45, -974, -975, 1472, 1473,
+    -976, -977, -978, -979, 1475, 1496, 1476, 1484, -103, 1477, 1478, 1481, 1479, 1480, -980, -981,
+    -982, -983, 1482, 1483, -62, -108, -984, -985, 1485, 1490, 1486, 1488, 1487, -64, -18, -17,
+    1489, -21, -68, -183, 1491, 1494, 1492, 1493, -986, -987, -988, -989, 1495, -74, -990, -991,
+    1497, 1510, 1498, 1504, 1499, 1501, 1500, -76, -992, -993, 1502, 1503, -994, -84, -995, -996,
+    1505, 1508, 1506, 1507, -997, -277, -38, -77, 1509, -84, -998, -88, 1511, 1515, 1512, -129,
+    1513, 1514, -999, -1000, -1001, -1002, 1516, 1519, 1517, 1518, -93, -45, -1003, -1004, 1520, 1521,
+    -1005, -1006, -1007, -1008, 1523, 1546, 1524, 1537, 1525, 1532, 1526, 1529, 1527, 1528, -1009, -1010,
+    -1011, -1012, 1530, 1531, -331, -11, -1013, -1014, 1533, 1534, -109, -108, 1535, 1536, -1015, -1016,
+    -632, -1017, 1538, 1540, -68, 1539, -21, -20, 1541, 1544, 1542, 1543, -1018, -1019, -1020, -1021,
+    1545, -75, -73, -74, 1547, 1560, 1548, 1554, 1549, 1551, -72, 1550, -1022, -1023, 1552, 1553,
+    -1024, -1025, -1026, -1027, 1555, 1558, 1556, 1557, -1028, -1029, -1030, -38, 1559, -88, -34, -250,
+    1561, 1568, 1562, 1565, 1563, 1564, -1031, -1032, -1033, -432, 1566, 1567, -1034, -1035, -1036, -1037,
+    1569, 1572, 1570, 1571, -1038, -1039, -1040, -1041, 1573, 1574, -1042, -1043, -1044, -1045, 1576, 1593,
+    1577, 1585, -103, 1578, 1579, 1582, 1580, 1581, -1046, -1047, -1048, -1049, 1583, 1584, -1050, -63,
+    -1051, -67, 1586, 1588, 1587, -19, -68, -20, 1589, 1591, 1590, -27, -394, -1052, 1592, -397,
+    -1053, -339, 1594, 1606, 1595, 1601, 1596, 1599, 1597, 1598, -1054, -1055, -1056, -1057, 1600, -34,
+    -1058, -1059, 1602, 1604, -36, 1603, -35, -87, -38, 1605, -374, -250, 1607, 1613, 1608, 1611,
+    1609, 1610, -1060, -1061, -1062, -1063, -93, 1612, -1064, -1065, 1614, 1617, 1615, 1616, -1066, -1067,
+    -1068, -1069, 1618, 1619, -1070, -1071, -1072, -1073, 1621, 1636, -103, 1622, 1623, 1630, 1624, 1627,
+    1625, 1626, -1074, -1075, -3, -1076, 1628, 1629, -1077, -1078, -1079, -1080, 1631, 1634, 1632, 1633,
+    -144, -108, -17, -18, 1635, -67, -109, -1081, 1637, 1648, 1638, 1642, 1639, 1641, 1640, -29,
+    -183, -1082, -19, -432, 1643, 1646, 1644, 1645, -1083, -394, -1084, -1085, 1647, -36, -1086, -1087,
+    1649, 1656, 1650, 1653, 1651, 1652, -1088, -1089, -1090, -34, 1654, 1655, -513, -85, -1091, -1092,
+    1657, 1660, 1658, 1659, -1093, -1094, -93, -1095, 1661, 1662, -1096, -1097, -1098, -1099, 1664, 1687,
+    1665, 1679, 1666, 1673, 1667, 1670, 1668, 1669, -1100, -1101, -1102, -1103, 1671, 1672, -1104, -141,
+    -1105, -1106, 1674, 1676, 1675, -64, -1107, -62, 1677, 1678, -1108, -1109, -1110, -1111, 1680, 1682,
+    -19, 1681, -21, -68, 1683, 1685, 1684, -394, -363, -539, -73, 1686, -74, -1112, 1688, 1700,
+    1689, 1695, 1690, 1692, -20, 1691, -1113, -277, 1693, 1694, -1114, -1115, -1116, -483, 1696, 1699,
+    1697, 1698, -1117, -1118, -1119, -216, -33, -35, 1701, 1708, 1702, 1705, 1703, 1704, -1120, -1121,
+    -1122, -1123, 1706, 1707, -127, -250, -1124, -129, 1709, 1712, 1710, 1711, -1125, -1126, -1127, -260,
+    1713, 1714, -1128, -1129, -1130, -1131, 1716, 1737, 1717, 1725, -103, 1718, 1719, 1722, 1720, 1721,
+    -1132, -1133, -11, -1134, 1723, 1724, -1135, -18, -109, -1136, 1726, 1731, 1727, 1730, 1728, 1729,
+    -183, -68, -21, -20, -17, -64, 1732, 1735, 1733, 1734, -1137, -1138, -1139, -1140, 1736, -75,
+    -73, -74, 1738, 1748, 1739, 1745, 1740, 1743, 1741, 1742, -1141, -1142, -1143, -1144, 1744, -512,
+    -1145, -1146, -38, 1746, 1747, -85, -87, -35, 1749, 1756, 1750, 1753, 1751, 1752, -1147, -432,
+    -250, -1148, 1754, 1755, -1149, -1150, -1151, -1152, 1757, 1759, -93, 1758, -1153, -1154, 1760, 1761,
+    -1155, -1156, -1157, -1158, 1763, 1788, 1764, 1776, 1765, 1771, 1766, 1769, 1767, 1768, -1159, -1160,
+    -1161, -1162, -11, 1770, -1163, -1164, 1772, 1773, -108, -62, 1774, 1775, -1165, -1166, -1167, -1168,
+    1777, 1782, 1778, 1780, 1779, -19, -1169, -17, -183, 1781, -21, -20, 1783, 1786, 1784, 1785,
+    -1170, -1171, -1172, -394, 1787, -27, -1173, -26, 1789, 1800, 1790, 1797, 1791, 1794, 1792, 1793,
+    -1174, -1175, -1176, -1177, 1795, 1796, -1178, -1179, -34, -33, 1798, -250, 1799, -38, -37, -372,
+    1801, 1807, 1802, 1805, 1803, 1804, -1180, -1181, -1182, -1183, -127, 1806, -129, -1184, 1808, 1811,
+    1809, 1810, -1185, -1186, -1187, -1188, 1812, 1813, -1189, -1190, -1191, -1192, 1815, 1831, -103, 1816,
+    1817, 1824, 1818, 1821, 1819, 1820, -1193, -1194, -1195, -1196, 1822, 1823, -1197, -141, -1198, -1199,
+    1825, 1828, 1826, 1827, -1200, -62, -18, -64, 1829, 1830, -1201, -1202, -1203, -1204, 1832, 1843,
+    1833, 1837, 1834, 1836, 1835, -20, -68, -183, -432, -479, 1838, 1841, 1839, 1840, -1205, -1206,
+    -77, -1207, 1842, -36, -1208, -1209, 1844, 1851, 1845, 1848, 1846, 1847, -1210, -1211, -1212, -1213,
+    1849, 1850, -330, -37, -1214, -88, 1852, 1855, 1853, 1854, -1215, -1216, -93, -1217, 1856, 1857,
+    -1218, -1219, -1220, -1221, 1859, 1877, 1860, 1868, -103, 1861, 1862, 1865, 1863, 1864, -1222, -1223,
+    -1224, -1225, 1866, 1867, -1226, -63, -1227, -67, 1869, 1871, 1870, -20, -183, -68, 1872, 1875,
+    1873, 1874, -1228, -1229, -1230, -75, 1876, -72, -154, -1231, 1878, 1887, 1879, 1885, 1880, 1882,
+    1881, -76, -1232, -1233, 1883, 1884, -1234, -1235, -1236, -216, -35, 1886, -38, -33, 1888, 1895,
+    1889, 1892, 1890, 1891, -1237, -1238, -1239, -250, 1893, 1894, -1240, -1241, -1242, -1243, 1896, 1899,
+    1897, 1898, -1244, -1245, -1246, -1247, 1900, 1901, -1248, -1249, -1250, -1251, 1903, 1923, 1904, 1912,
+    -103, 1905, 1906, 1909, 1907, 1908, -1252, -1253, -1254, -1255, 1910, 1911, -10, -238, -1256, -1257,
+    1913, 1917, 1914, 1916, 1915, -17, -64, -18, -20, -68, 1918, 1921, 1919, 1920, -1258, -1259,
+    -1260, -27, 1922, -397, -1261, -339, 1924, 1937, 1925, 1932, 1926, 1929, 1927, 1928, -29, -1262,
+    -1263, -1264, 1930, 1931, -1265, -1266, -1267, -123, 1933, 1935, -38, 1934, -1268, -36, -37, 1936,
+    -88, -250, 1938, 1944, 1939, 1942, 1940, 1941, -1269, -1270, -1271, -1272, -127, 1943, -1273, -1274,
+    1945, 1947, 1946, -45, -93, -1275, 1948, 1949, -1276, -1277, -1278, -1279, 1951, 1966, -103, 1952,
+    1953, 1960, 1954, 1957, 1955, 1956, -1280, -1281, -1282, -1283, 1958, 1959, -109, -1284, -1285, -1286,
+    1961, 1963, 1962, -21, -64, -18, 1964, 1965, -1287, -1288, -149, -539, 1967, 1978, 1968, 1973,
+    1969, 1971, 1970, -20, -183, -29, 1972, -19, -479, -432, 1974, 1977, 1975, 1976, -1289, -1290,
+    -1291, -1292, -277, -36, 1979, 1985, 1980, 1983, 1981, 1982, -1293, -76, -1294, -1295, 1984, -33,
+    -37, -940, 1986, 1989, 1987, 1988, -1296, -1297, -1298, -1299, 1990, 1991, -1300, -1301, -1302, -1303,
+    1993, 2012, 1994, 2002, -103, 1995, 1996, 1999, 1997, 1998, -1304, -1305, -1306, -1307, 2000, 2001,
+    -1308, -62, -1309, -1310, 2003, 2005, 2004, -21, -183, -68, 2006, 2009, 2007, 2008, -1311, -394,
+    -1312, -1313, 2010, 2011, -1314, -73, -1315, -1316, 2013, 2026, 2014, 2021, 2015, 2018, 2016, 2017,
+    -1317, -1318, -20, -1319, 2019, 2020, -1320, -1321, -1322, -1323, 2022, 2025, 2023, 2024, -38, -33,
+    -1324, -85, -250, -88, 2027, 2031, 2028, -129, 2029, 2030, -1325, -1326, -1327, -1328, 2032, 2035,
+    2033, 2034, -1329, -1330, -1331, -1332, 2036, 2037, -1333, -1334, -1335, -1336, 2039, 2056, 2040, 2048,
+    -103, 2041, 2042, 2045, 2043, 2044, -1337, -1338, -1339, -1340, 2046, 2047, -1341, -17, -1342, -1343,
+    -20, 2049, 2050, 2053, 2051, 2052, -539, -206, -394, -109, 2054, 2055, -73, -1344, -1345, -27,
+    2057, 2070, 2058, 2065, 2059, 2062, 2060, 2061, -1346, -1347, -1348, -1349, 2063, 2064, -1350, -1351,
+    -1352, -34, 2066, 2068, 2067, -85, -1353, -36, -88, 2069, -127, -37, 2071, 2075, 2072, -129,
+    2073, 2074, -1354, -1355, -1356, -1357, 2076, 2079, 2077, 2078, -1358, -1359, -1360, -1361, 2080, 2081,
+    -1362, -1363, -1364, -1365, 2083, 2101, 2084, 2092, -103, 2085, 2086, 2089, 2087, 2088, -1366, -1367,
+    -1368, -1369, 2090, 2091, -17, -64, -1370, -1171, 2093, 2095, 2094, -19, -21, -183, 2096, 2099,
+    2097, 2098, -1371, -1372, -1373, -27, 2100, -75, -73, -74, 2102, 2116, 2103, 2110, 2104, 2107,
+    2105, 2106, -1374, -77, -1375, -1376, 2108, 2109, -1377, -1378, -1379, -123, 2111, 2114, 2112, 2113,
+    -87, -35, -37, -85, 2115, -84, -1380, -88, 2117, 2123, 2118, 2121, 2119, 2120, -1381, -1382,
+    -1383, -1384, -127, 2122, -1385, -1386, 2124, 2126, -93, 2125, -1387, -45, 2127, 2128, -1388, -1389,
+    -1390, -1391, 2130, 2147, 2131, 2139, -103, 2132, 2133, 2136, 2134, 2135, -1392, -1393, -1394, -1395,
+    2137, 2138, -144, -17, -1396, -1397, 2140, 2142, 2141, -19, -68, -183, 2143, 2145, 2144, -394,
+    -539, -206, 2146, -397, -1398, -1399, 2148, 2160, 2149, 2156, 2150, 2153, 2151, 2152, -1400, -1401,
+    -1402, -1403, 2154, 2155, -1404, -1405, -34, -33, 2157, -38, 2158, 2159, -35, -87, -85, -37,
+    2161, 2167, 2162, 2165, 2163, 2164, -1406, -1407, -1408, -1409, -127, 2166, -129, -1410, 2168, 2171,
+    2169, 2170, -1411, -1412, -1413, -1414, 2172, 2173, -1415, -1416, -1417, -1418, 2175, 2197, 2176, 2188,
+    2177, 2184, 2178, 2181, 2179, 2180, -1419, -1420, -1421, -1422, 2182, 2183, -331, -238, -1423, -1424,
+    2185, 2186, -64, -17, -630, 2187, -632, -1425, 2189, 2191, -19, 2190, -21, -20, 2192, 2195,
+    2193, 2194, -206, -207, -109, -273, 2196, -277, -1426, -339, 2198, 2208, 2199, 2205, 2200, 2203,
+    2201, 2202, -1427, -1428, -1429, -1430, 2204, -35, -1431, -1432, 2206, -37, -85, 2207, -84, -36,
+    2209, 2215, 2210, 2213, 2211, 2212, -1433, -1434, -1435, -1436, -127, 2214, -1437, -1438, 2216, 2218,
+    -93, 2217, -1439, -1440, 2219, 2220, -1441, -1442, -1443, -1444, 2222, 2235, -103, 2223, 2224, 2231,
+    2225, 2228, 2226, 2227, -1445, -1446, -1447, -1448, 2229, 2230, -1449, -1284, -1450, -1451, 2232, 2233,
+    -64, -17, 2234, -67, -1452, -501, 2236, 2245, 2237, 2244, 2238, 2241, 2239, 2240, -1453, -21,
+    -1454, -1455, 2242, 2243, -74, -27, -1456, -1457, -36, -87, 2246, 2252, 2247, 2250, 2248, 2249,
+    -1458, -1459, -33, -34, 2251, -250, -1460, -37, 2253, 2256, 2254, 2255, -1461, -1462, -1463, -1464,
+    2257, 2258, -1465, -1466, -1467, -1468, 2260, 2279, 2261, 2269, -103, 2262, 2263, 2266, 2264, 2265,
+    -1469, -1470, -1471, -1472, 2267, 2268, -144, -62, -109, -1473, 2270, 2273, 2271, 2272, -64, -17,
+    -183, -21, 2274, 2277, 2275, 2276, -1474, -724, -632, -1475, 2278, -907, -154, -155, 2280, 2292,
+    2281, 2287, 2282, 2284, 2283, -277, -1476, -1477, 2285, 2286, -1478, -1479, -1480, -1481, 2288, 2290,
+    2289, -38, -1482, -644, 2291, -88, -1483, -33, 2293, 2299, 2294, 2297, 2295, 2296, -1484, -1485,
+    -1486, -1487, -93, 2298, -1488, -1489, 2300, 2303, 2301, 2302, -1490, -1491, -1492, -1493, 2304, 2305,
+    -1494, -1495, -1496, -1497, 2307, 2320, -103, 2308, 2309, 2315, 2310, 2313, 2311, 2312, -1498, -1499,
+    -1500, -1501, -11, 2314, -780, -1502, 2316, 2317, -18, -64, 2318, 2319, -499, -1503, -3, -24,
+    2321, 2334, 2322, 2328, 2323, 2326, 2324, 2325, -1504, -1505, -1506, -1507, -1508, 2327, -1509, -1510,
+    2329, 2332, 2330, 2331, -1511, -1512, -1513, -542, 2333, -37, -36, -1514, 2335, 2342, 2336, 2339,
+    2337, 2338, -1515, -123, -1516, -1517, 2340, 2341, -1518, -38, -1519, -88, 2343, 2345, 2344, -129,
+    -1520, -1521, 2346, 2347, -1522, -1523, -1524, -1525,
+};
+
+static const int32_t voltage_q_leaf_value[1525] = {
+    5147596, 5155948, 5282529, 5170129, 5357568, 5313802, 5282540, 5241291,
+    5151252, 5182525, 18629550, 10037445, 5215164, 5334594, 7095480, 5482397,
+    13190717, 14015939, 16066437, 19173417, 18960876, 6556283, 6024390, 5263770,
+    9601043, 13001086, 5182505, 12950493, 21230182, 16573319, 18717396, 19438991,
+    12890644, 15672566, 5338808, 5526364, 6607872, 9471058, 21070254, 20114706,
+    18024714, 19567899, 20542965, 20893140, 18917130, 21538584, 21280055, 21420709,
+    21563601, 21705291, 21951263, 22238239, 22121035, 5146716, 5150436, 5159474,
+    5171185, 6162440, 5223179, 5385543, 7914441, 10102456, 13603328, 14928650,
+    5785790, 5372551, 7745659, 21180170, 9783632, 6691482, 12398858, 10477568,
+    15653806, 14109696, 9239757, 6107750, 5707653, 14197221, 17995302, 18957897,
+    18019090, 19579547, 19951198, 5270036, 6001459, 11951661, 5245051, 20267459,
+    20440246, 19897478, 18842092, 18410742, 18417009, 20909672, 21216826, 20822272,
+    21325563, 21454407, 21834506, 21702621, 21978705, 22161667, 20580024, 5154613,
+    5279420, 11909161, 5310112, 8408310, 6982943, 5612380, 6204631, 5763118,
+    7467459, 6197357, 20008018, 16585318, 13401974, 9077207, 17227958, 18666053,
+    19381113, 19974653, 17135452, 20950120, 20418810, 14555641, 12252979, 19293631,
+    16353976, 20917084, 21205860, 21396117, 21665289, 21863677, 22042102, 22138927,
+    5148549, 5156801, 5166943, 6765711, 19148431, 3455003, 5276254, 7895695,
+    5994645, 6929818, 5791000, 5375050, 8358298, 6679757, 10002432, 8883425,
+    10990182, 11471544, 11946680, 13196984, 13815890, 16377216, 18701331, 19381422,
+    21380219, 20926366, 19948812, 20455354, 19428894, 21125830, 20870859, 21319347,
+    21462589, 21697485, 22020931, 5150146, 5167489, 5300606, 5207078, 6199850,
+    5248588, 5999968, 6800616, 8154085, 5993656, 5449236, 20286218, 9034235,
+    13313185, 15660087, 16488407, 13912760, 17145023, 18197684, 18903850, 19793053,
+    15590263, 20502278, 19540643, 20914215, 21212786, 21490264, 21867834, 22101606,
+    5158585, 5058670, 10120185, 5295701, 6231519, 9483551, 10496328, 13038606,
+    6438031, 8919151, 14413757, 16738183, 18812891, 16001823, 19644986, 16404009,
+    20788830, 20258641, 20682462, 20980299, 19108830, 20167414, 19100508, 20221485,
+    21415227, 20996452, 21249470, 21418964, 21580783, 21746980, 22017876, 22153531,
+    5150214, 5174016, 5342560, 5282540, 6709137, 18888991, 5249305, 6123863,
+    6096478, 6832148, 15139103, 9204651, 17684521, 12685248, 15783269, 18825375,
+    20009806, 13997179, 20968199, 20324780, 20769919, 20965142, 19142170, 20150238,
+    21137724, 20780070, 21392940, 20973855, 21534956, 21708239, 21915577, 22092004,
+    5153950, 5285670, 9299144, 5334396, 5828914, 9668608, 11660354, 6578695,
+    8527094, 19996123, 16789518, 14149158, 7964426, 12653097, 18479052, 20179234,
+    19209419, 20026164, 20603373, 19475067, 20023639, 20972854, 21197675, 21390771,
+    21585834, 21751149, 21968233, 22152469, 5149862, 5170011, 5343498, 5256499,
+    7362513, 5218739, 5389632, 5695903, 9710701, 7638680, 14495724, 12749981,
+    15263102, 16608486, 18694323, 16590652, 19306397, 19916465, 5276303, 13817952,
+    20151492, 18626417, 20782200, 21350102, 21054695, 21386244, 21548756, 21735513,
+    21874613, 21999712, 22121030, 5146172, 5150262, 5158787, 5171517, 5351301,
+    5223364, 5307556, 5188772, 6878759, 5255810, 5756027, 7067976, 10331696,
+    6214018, 11801324, 15788237, 13100428, 18330390, 19650351, 15965143, 6100247,
+    12689029, 20336302, 18975883, 20844209, 21387299, 21142350, 21402101, 21551827,
+    21872853, 21723274, 21983329, 22177739, 5154169, 5260128, 7458065, 5562347,
+    6951697, 5808113, 8358298, 9742991, 7358054, 11110523, 12179218, 16538192,
+    18235232, 19007518, 19937833, 5297545, 6203597, 12252979, 20190382, 20559096,
+    19689178, 20775830, 21036150, 19844137, 20630610, 21267180, 20763402, 21422252,
+    21566407, 21753438, 21897847, 22027248, 22122367, 5154319, 4740212, 5298058,
+    5697040, 6376571, 10923123, 13817965, 7964426, 18296340, 15309567, 18736188,
+    19602719, 5264841, 20228877, 17813719, 20806930, 21462275, 21325881, 21377096,
+    21573181, 21767819, 21903559, 22003289, 22146654, 5150289, 5170011, 5299693,
+    8983446, 5618565, 6419797, 9208484, 8764648, 10866719, 12334254, 9056379,
+    19581850, 15784606, 18630427, 19394369, 5301305, 19962624, 20607818, 17660559,
+    19911115, 20873010, 21181670, 21417733, 21596529, 21767504, 22044966, 5148463,
+    5164158, 7170769, 5286611, 6962637, 5855596, 7559801, 9759330, 19022607,
+    15220846, 18700899, 19607148, 13303940, 21226613, 20427741, 19560135, 20949924,
+    20551723, 21323957, 20863844, 21412641, 21631169, 21697659, 21908992, 22016890,
+    22157819, 5148336, 5178361, 5160133, 5171852, 5266293, 18975471, 6751366,
+    5251015, 6053747, 5482578, 8141578, 20522209, 19210925, 16891617, 10185523,
+    15711531, 17708171, 18035671, 18696006, 19534689, 20558925, 20914713, 20043527,
+    21184998, 21403290, 21654974, 22041751, 5148266, 5163972, 5219292, 5313799,
+    6678709, 5315940, 6282772, 5732639, 6670377, 7300538, 10881826, 13904445,
+    17286194, 18797329, 18598298, 20542519, 19312155, 21031700, 19916635, 12890644,
+    5280983, 20301778, 20650153, 19550607, 21012709, 20627359, 21283648, 21392032,
+    21511516, 21597139, 21710416, 21849088, 21961613, 22093286, 5146731, 5149519,
+    5155541, 5195039, 5163360, 5172590, 5259104, 8431220, 5229852, 5662821,
+    5947535, 6922945, 8933417, 11553322, 7268946, 15197471, 17777550, 15779758,
+    18775082, 19584393, 21465648, 20083927, 20548339, 20887496, 18927537, 19851378,
+    20929117, 21253546, 21386474, 21584874, 21726140, 21975501, 22161663, 5147951,
+    5155922, 5170118, 8054473, 5315172, 6108987, 7061115, 10961010, 7278027,
+    12603083, 13624156, 18326333, 16747848, 18762362, 15097434, 19612181, 13889642,
+    20444428, 19516820, 20959569, 20388966, 21230182, 20883220, 21406772, 21609961,
+    22020375, 21849081, 22148874, 21991834, 5148509, 5155912, 5190568, 5167247,
+    6244442, 5276275, 6351544, 6035397, 7858168, 11387156, 14932127, 17436640,
+    6836040, 18841320, 17032464, 19514078, 5257544, 19919686, 20378411, 18924622,
+    20839521, 20134247, 21195664, 20826341, 21374811, 21540832, 21730698, 21902040,
+    22011623, 22134566, 5147978, 5155789, 5253366, 5166767, 6120978, 5237096,
+    5721190, 5950210, 5538857, 5326305, 6345291, 7189258, 6124943, 5532590,
+    19618537, 9561710, 14861663, 20004878, 5807677, 16012369, 18327173, 19599433,
+    18844779, 20813414, 19702185, 6405734, 13691535, 20531464, 19749535, 20922061,
+    20221905, 21134486, 21391620, 21682130, 22041841, 5153860, 4654256, 12048261,
+    5264805, 8152003, 5494579, 5920211, 5896081, 5353376, 8881848, 11345746,
+    9134524, 16168258, 18827324, 17226081, 19541291, 5261708, 20046976, 20482680,
+    20492505, 20815045, 19686471, 21036118, 20656781, 21528379, 21336201, 21640999,
+    21728436, 21944780, 22097391, 5148668, 5160635, 5170627, 5189664, 5279867,
+    5246082, 5223660, 5348723, 5489764, 6149407, 7189258, 6041068, 20758200,
+    10545959, 15872972, 8317034, 18096951, 18675637, 19325738, 21076394, 19938601,
+    20753495, 19840261, 20567532, 19892361, 21062277, 21409976, 21645906, 21837278,
+    22134229, 21967866, 5150485, 5167210, 5293339, 8203264, 5411744, 5779988,
+    6626614, 6139003, 8604706, 11674726, 11385595, 15437966, 17603879, 18737640,
+    11934167, 20103864, 19280118, 20421457, 19900054, 20350632, 20664939, 19415772,
+    21253976, 20943152, 20123648, 21391917, 21692298, 22022463, 22156974, 5147828,
+    5157072, 5169126, 5277181, 5238784, 5179392, 11293999, 5251041, 6090244,
+    5564931, 5832663, 5913928, 6007726, 20882186, 19126186, 8482362, 14418518,
+    12721848, 14231321, 17248258, 19047047, 14559797, 5487278, 20056045, 20681567,
+    19921933, 21037497, 21223601, 21404363, 21547227, 21742465, 22014127, 22153851,
+    5147989, 5156976, 5167681, 7602900, 5298034, 5913458, 5482016, 8911544,
+    6195268, 10691363, 8896969, 5974385, 17554268, 14732766, 17840019, 18591546,
+    19426508, 16257720, 21168561, 20035873, 21081399, 20539429, 13125079, 18243207,
+    19576491, 20928832, 21264915, 21465630, 21818663, 22104580, 5146388, 5150913,
+    5158876, 5171482, 5212211, 5241917, 5277850, 5180443, 10274725, 4319799,
+    5246597, 7069579, 5596838, 6606295, 6160261, 9855529, 7989463, 13176655,
+    17122930, 18773177, 16092989, 19764214, 19321133, 19986055, 20991242, 20412629,
+    18964003, 19837972, 20917234, 21227745, 21442191, 21701859, 22002695, 22142902,
+    5154554, 5300405, 13015684, 5338955, 6690174, 5724310, 9546076, 6767278,
+    12020905, 9899295, 17797523, 18877193, 19663505, 20143718, 20535050, 21227918,
+    20869917, 19527191, 20167985, 21020907, 21319939, 21595693, 21729681, 21950671,
+    22119984, 5146851, 5150711, 5159917, 5171938, 5204393, 5326307, 12821873,
+    5170639, 5223478, 5443039, 5669930, 6009272, 8700458, 15135606, 17604781,
+    18622810, 19550487, 5401327, 20242957, 18868891, 20786881, 20064146, 21373278,
+    20985099, 21287294, 21450058, 21765473, 21889195, 22154098, 22010181, 5153992,
+    12818760, 2956967, 5200489, 5185649, 5255680, 5670633, 7708758, 9511076,
+    11788302, 12334244, 9321021, 15160301, 17997996, 19320863, 20478751, 18821407,
+    19315384, 20809250, 19852656, 21105787, 20526752, 19590472, 20942672, 21258878,
+    21606531, 21421462, 21860842, 22113600, 5153641, 5289686, 14318087, 5321423,
+    5587476, 6584934, 5713887, 6351560, 10703957, 13443293, 15556150, 16996857,
+    18126057, 18551065, 19424456, 5291930, 21398979, 20060377, 21185386, 20546481,
+    19305759, 21019325, 21413670, 21669984, 21964890, 22147721, 5147889, 5156397,
+    5167473, 6317975, 5234676, 5609855, 5824348, 5295049, 5420073, 5983601,
+    6474506, 5267522, 18994407, 14796608, 6400303, 18737438, 19939063, 19288337,
+    20943757, 19978063, 21141773, 20544706, 19231263, 21220406, 20891452, 21384838,
+    21639136, 21867848, 22049914, 5156514, 5040692, 9669031, 5275874, 5659197,
+    5279416, 6676630, 7949872, 6175269, 5351295, 8147818, 10703503, 15345627,
+    18325012, 18935266, 19323012, 19888375, 19448504, 15200594, 19997495, 20539573,
+    19890518, 19043717, 20999257, 20473264, 21283751, 21452246, 21781565, 22066256,
+    5150034, 5170716, 5195337, 5275042, 5224225, 5356780, 5601374, 5298176,
+    6033244, 9324145, 11202734, 5978549, 8844665, 15539068, 17853104, 18823501,
+    15197456, 20630036, 19467650, 17773097, 13223021, 5476344, 20994202, 20169886,
+    18915860, 20542221, 20901075, 19529769, 20385881, 21431864, 21025906, 21372705,
+    21572314, 21729260, 21679600, 21976932, 22141569, 5150354, 5168898, 6019229,
+    5261905, 8644616, 5717263, 9124554, 12479009, 5841019, 18054390, 18566262,
+    15072756, 19359022, 19952103, 20224321, 20537114, 18583282, 19473505, 21238118,
+    20816891, 21258098, 20817579, 21397753, 21556224, 21847303, 21713894, 22002694,
+    22173592, 5148276, 5156730, 5167465, 5239828, 7726886, 5214453, 5387714,
+    5672564, 19088400, 9605458, 13366652, 9995155, 15392734, 17327841, 18340961,
+    18914634, 19727436, 12834379, 19029647, 20489741, 19681059, 20932745, 21359977,
+    21621454, 21731000, 22031999, 5148072, 5155604, 5188780, 5167202, 5928435,
+    4353140, 5260983, 8066567, 6160593, 5685386, 5476332, 5284618, 9920695,
+    13129779, 15843877, 14576988, 16941640, 12714045, 18533059, 19456899, 20887489,
+    20127553, 20804966, 19967386, 19829363, 21314582, 20988760, 21412870, 21643749,
+    21861589, 22015584, 22173641, 5154779, 4887993, 5317599, 9550766, 5606229,
+    8357592, 6081562, 11230863, 12334244, 12792716, 14809866, 17224739, 15866388,
+    17829351, 18949073, 20035080, 19045274, 20562298, 20780685, 19652724, 20307040,
+    20976969, 21327242, 21603191, 21758680, 22127132, 21947720, 5148064, 5156011,
+    5165792, 5176016, 8084480, 5300914, 5537965, 5332555, 5957714, 5695160,
+    14015939, 6337790, 7560192, 5682640, 9603126, 20201800, 17202121, 13477162,
+    15693417, 18597644, 19477215, 20002688, 19398492, 20503367, 19630572, 19332603,
+    20905847, 21186763, 20236180, 20834632, 21389917, 21645411, 21958114, 22142908,
+    5148713, 5179402, 5160036, 5171995, 5354435, 6605305, 5257556, 8100741,
+    5812538, 7176749, 5704520, 5270028, 9200671, 7479329, 13728725, 15244343,
+    17162673, 18720520, 14155544, 19348526, 19988262, 10247813, 20486848, 19287215,
+    20918181, 21312038, 21519577, 21780326, 22075434, 5153682, 5240862, 8968306,
+    5235616, 8327031, 5727163, 9926729, 7744953, 14881751, 12834382, 17207328,
+    18502840, 18964370, 16457487, 19510646, 20952280, 20017207, 18993695, 20846370,
+    19035904, 20017593, 20875752, 21268022, 21494313, 21414259, 21593661, 21656734,
+    21808445, 21997042, 22136087, 5149633, 5174255, 5324227, 5248164, 5267461,
+    5998344, 6690174, 5805317, 8602097, 10696367, 18554511, 15018264, 16164671,
+    18739411, 16852640, 19575927, 5273797, 21132247, 20128858, 20559610, 21045150,
+    18388869, 19632770, 21005262, 21405526, 21635282, 21863148, 22094460, 5150317,
+    5168378, 6352508, 5241564, 9255383, 5382911, 5662989, 6642244, 5877824,
+    10554503, 14432686, 14640508, 17548042, 18077249, 18728577, 19312766, 20103277,
+    20665330, 16328970, 19647131, 20962675, 21337550, 21714054, 22076224, 5156056,
+    4966160, 8542720, 5270147, 7667507, 5535180, 5863936, 6098985, 11396529,
+    8791736, 13958881, 5273149, 10645313, 13356401, 15661782, 17287557, 11831009,
+    18408957, 19002032, 19595104, 5345065, 20230095, 18625377, 20741417, 19693097,
+    21145746, 20750909, 21395406, 21526581, 21721713, 21884805, 22043775, 22202917,
+    5153863, 5289580, 9981602, 5268002, 8199660, 5613114, 6712576, 11136051,
+    9102223, 19859005, 17326727, 13938565, 16008602, 18736316, 16958653, 19607482,
+    5274737, 20424459, 19836787, 20891674, 20160284, 21314296, 21426981, 21520886,
+    21605760, 21892847, 21700440, 21967566, 22137696, 5149654, 5168642, 10508037,
+    5345996, 6038072, 9194424, 11662213, 7946945, 13962296, 16031416, 17375796,
+    20353712, 18736019, 19550224, 14466028, 19979183, 20206493, 20938716, 20488188,
+    18734259, 19737321, 20971077, 21370360, 21590168, 21856476, 22098097, 5153059,
+    4940122, 7022029, 5275807, 6250833, 5723560, 11542405, 15895538, 19946523,
+    17147931, 15625069, 17214920, 18621366, 19426652, 19974479, 20308555, 20500973,
+    20865392, 19877356, 21100883, 20549499, 21298191, 21444497, 21737731, 21893627,
+    22236692, 22075075, 5153673, 5265357, 4705686, 5183758, 7217398, 5308804,
+    5892055, 11276856, 15741351, 14317029, 17261245, 16483191, 18582025, 19541780,
+    19935563, 20292444, 20953195, 20446884, 18497012, 19681559, 21250016, 20902827,
+    21397870, 21685408, 21932437, 22133532, 5153975, 4891648, 7022812, 5246690,
+    6974019, 5386919, 5661929, 6098350, 20890522, 9737953, 14763465, 15781364,
+    18005163, 18819022, 19546158, 5292960, 20196354, 19442666, 20748759, 17635553,
+    21244771, 21429323, 21833051, 22104541, 5154941, 5300679, 15658516, 5290504,
+    5643395, 7607218, 5215846, 17855145, 15064098, 16779990, 18633654, 20093800,
+    19414090, 5370074, 14667334, 20059585, 19120292, 20559018, 19688902, 20974076,
+    20457074, 21281369, 20805079, 21399996, 21579327, 21752194, 21935502, 22241673,
+    22109729, 5148067, 5156302, 5251277, 5169436, 5308887, 5946767, 19794203,
+    16396509, 10691502, 15611790, 21123891, 18110664, 18827996, 18992128, 6958841,
+    18727068, 5315369, 19372334, 21145784, 19900986, 5635748, 13969654, 20399426,
+    20908145, 21244769, 21442231, 21780316, 22027846,
+};
+
+const EPS_ForestQ eps_voltage_forest_q = {
+    .n_features = 5,
+    .n_trees = 50,
+    .n_nodes = 2348,
+    .n_leaves = 1525,
+    .leaf_scale = 4.8828125e-06,
+    .quant = voltage_q_feature,
+    .roots = voltage_q_roots,
+    .feature = voltage_q_feature_index,
+    .threshold = voltage_q_threshold,
+    .children = voltage_q_children,
+    .leaf_value = voltage_q_leaf_value,
+};
+
+#endif
+
+#if EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_FIXED)
+
+static const EPS_FixedFeature voltage_fx_feature[5] = {
+    {627072LL, 7, 37355, 0, NULL},
+    {1256768LL, 6, 64773, 0, NULL},
+    {1258304LL, 6, 64749, 0, NULL},
+    {1256768LL, 6, 64702, 0, NULL},
+    {1256768LL, 6, 64797, 0, NULL},
+};
+
+static const int16_t voltage_fx_roots[50] = {
+    0, 54, 108, 152, 202, 245, 288, 331, 374, 422, 469, 516, 561, 606, 646, 686,
+    739, 791, 836, 882, 927, 980, 1030, 1078, 1127, 1179, 1230, 1274, 1329, 1375, 1425, 1474,
+    1522, 1575, 1620, 1663, 1715, 1762, 1814, 1858, 1902, 1950, 1992, 2038, 2082, 2129, 2174, 2221,
+    2259, 2306,
+};
+
+static const uint8_t voltage_fx_feature_index[2348] = {
+    0, 0, 4, 0, 0, 4, 3, 3, 3, 4, 3, 0, 4, 3, 0, 0, 2, 3, 2, 2, 3, 1, 0, 4,
+    4, 0, 1, 3, 0, 3, 0, 0, 2, 1, 4, 0, 2, 0, 3, 3, 0, 0, 2, 3, 3, 3, 0, 0,
+    0, 2, 0, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 2, 0, 3, 3, 0, 2, 2, 0,
+    3, 4, 0, 2, 0, 0, 2, 0, 3, 0, 4, 1, 0, 0, 3, 0, 4, 1, 0, 3, 3, 3, 0, 0,
+    3, 3, 2, 2, 2, 0, 0, 3, 0, 0, 3, 2, 0, 0, 0, 0, 4, 0, 3, 1, 2, 3, 3, 2,
+    0, 4, 1, 0, 3, 0, 2, 3, 1, 0, 0, 0, 4, 1, 1, 1, 1, 0, 3, 0, 4, 3, 1, 1,
+    3, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 3, 4, 2, 1, 1, 2, 3, 0, 2,
+    2, 2, 0, 0, 3, 4, 4, 2, 0, 3, 0, 0, 3, 2, 3, 0, 1, 4, 1, 1, 2, 0, 3, 3,
+    3, 0, 0, 0, 0, 1, 3, 0, 4, 0, 0, 0, 0, 4, 0, 0, 4, 3, 0, 0, 2, 2, 4, 3,
+    2, 3, 0, 0, 1, 0, 0, 1, 0, 0, 4, 3, 0, 1, 0, 0, 4, 4, 0, 1, 4, 1, 0, 0,
+    3, 2, 1, 0, 1, 0, 0, 0, 0, 4, 4, 3, 4, 0, 3, 2, 2, 4, 0, 3, 0, 4, 0, 0,
+    3, 0, 4, 0, 0, 0, 4, 0, 2, 0, 3, 1, 3, 0, 1, 4, 4, 0, 0, 2, 0, 0, 0, 2,
+    0, 0, 0, 4, 0, 0, 2, 3, 0, 0, 3, 2, 4, 2, 0, 1, 0, 3, 0, 2, 2, 0, 0, 3,
+    3, 4, 3, 2, 3, 0, 3, 0, 3, 0, 3, 1, 0, 0, 3, 1, 0, 4, 2, 0, 0, 0, 0, 4,
+    0, 3, 1, 3, 0, 4, 2, 0, 4, 4, 3, 0, 0, 3, 0, 1, 0, 1, 0, 4, 3, 0, 4, 0,
+    3, 4, 0, 3, 3, 0, 4, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 4, 0, 0, 2, 3, 0, 0,
+    2, 2, 3, 0, 3, 2, 3, 0, 3, 3, 0, 3, 3, 0, 3, 0, 0, 4, 0, 2, 0, 0, 0, 4,
+    4, 2, 0, 3, 0, 3, 1, 0, 0, 3, 0, 0, 0, 2, 0, 0, 4, 0, 0, 3, 1, 1, 1, 0,
+    3, 1, 3, 0, 0, 3, 4, 0, 2, 4, 3, 2, 2, 0, 0, 3, 2, 3, 3, 3, 0, 4, 4, 1,
+    0, 0, 3, 0, 2, 1, 0, 0, 2, 1, 0, 4, 2, 0, 0, 0, 0, 0, 0, 3, 3, 2, 2, 2,
+    4, 3, 3, 0, 4, 3, 0, 3, 4, 0, 3, 0, 0, 0, 3, 0, 0, 0, 4, 1, 3, 0, 0, 3,
+    4, 4, 3, 0, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 3, 2, 3, 2, 0, 2, 4,
+    2, 3, 0, 3, 2, 3, 4, 0, 1, 0, 3, 0, 1, 3, 3, 0, 3, 1, 4, 1, 4, 0, 3, 0,
+    3, 1, 0, 1, 3, 4, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 3, 2, 0, 3, 0,
+    0, 4, 2, 2, 0, 3, 0, 1, 3, 0, 4, 0, 4, 1, 2, 0, 0, 3, 0, 4, 3, 1, 3, 4,
+    0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 2, 2, 2, 1, 0, 0, 3, 0, 0, 3,
+    0, 0, 4, 0, 4, 4, 4, 2, 0, 0, 3, 4, 3, 3, 3, 0, 0, 3, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 4, 0, 2, 4, 3, 3, 4, 4, 0, 3, 1, 0, 1, 3, 4, 4, 1, 0, 0, 0, 4,
+    0, 4, 0, 4, 3, 0, 2, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 3, 3, 1,
+    0, 0, 3, 0, 2, 2, 2, 1, 2, 3, 1, 4, 0, 2, 0, 3, 0, 0, 1, 4, 0, 1, 3, 1,
+    3, 3, 2, 1, 4, 0, 0, 3, 0, 4, 2, 3, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 4,
+    1, 4, 3, 4, 4, 2, 3, 4, 0, 3, 4, 3, 2, 2, 0, 0, 0, 4, 2, 1, 0, 3, 0, 0,
+    2, 4, 0, 0, 4, 3, 4, 4, 2, 0, 3, 4, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 4, 3, 2, 2, 3, 1, 3, 0, 0, 0, 0, 3, 3, 2, 0, 0, 4, 0, 0, 3,
+    3, 3, 0, 2, 4, 0, 3, 0, 0, 3, 0, 2, 3, 1, 0, 3, 0, 2, 4, 4, 0, 0, 0, 0,
+    0, 4, 3, 2, 3, 3, 4, 2, 0, 2, 2, 2, 4, 0, 0, 0, 3, 0, 2, 4, 0, 0, 2, 4,
+    2, 4, 4, 1, 0, 0, 2, 0, 0, 2, 3, 0, 0, 3, 4, 0, 0, 2, 0, 0, 0, 0, 0, 4,
+    3, 2, 3, 3, 3, 3, 2, 3, 2, 2, 0, 1, 4, 1, 0, 3, 0, 2, 1, 3, 4, 4, 0, 0,
+    0, 3, 0, 2, 2, 4, 1, 2, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 2, 1,
+    0, 1, 3, 3, 0, 2, 2, 2, 1, 2, 2, 3, 1, 1, 4, 0, 3, 0, 2, 4, 4, 0, 0, 4,
+    1, 4, 3, 3, 3, 2, 0, 3, 0, 4, 0, 4, 3, 0, 0, 3, 3, 0, 1, 0, 0, 0, 4, 0,
+    0, 0, 0, 3, 2, 3, 3, 4, 4, 0, 0, 1, 2, 0, 0, 3, 2, 3, 0, 0, 2, 0, 4, 0,
+    1, 1, 3, 0, 4, 0, 1, 4, 0, 4, 0, 1, 3, 4, 3, 1, 2, 1, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 2, 1, 3, 0, 2, 2, 4, 2, 2, 0, 3, 0, 1, 2, 4, 0, 3, 4, 0, 3,
+    0, 0, 4, 0, 0, 1, 1, 2, 0, 3, 0, 2, 4, 1, 0, 0, 3, 3, 4, 0, 0, 2, 0, 0,
+    4, 2, 0, 0, 2, 4, 3, 0, 3, 0, 2, 4, 0, 2, 2, 3, 3, 1, 2, 4, 2, 0, 0, 2,
+    0, 1, 0, 4, 0, 3, 0, 4, 4, 1, 4, 0, 3, 3, 0, 1, 0, 0, 2, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 4, 3, 2, 2, 2, 0, 1, 3, 4, 3, 4, 2, 2, 0, 1, 1, 0, 3, 2, 4,
+    3, 0, 3, 0, 4, 1, 0, 4, 0, 4, 3, 2, 1, 0, 3, 0, 2, 3, 0, 1, 3, 0, 3, 1,
+    0, 0, 0, 0, 0, 4, 0, 0, 1, 0, 1, 4, 0, 3, 0, 1, 0, 4, 2, 3, 2, 3, 4, 0,
+    2, 2, 3, 3, 2, 3, 0, 3, 0, 0, 0, 0, 2, 1, 1, 1, 3, 0, 2, 0, 4, 3, 0, 1,
+    0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 4, 0, 3, 2, 4, 3, 2, 4, 2, 3, 4, 0, 4, 4,
+    1, 0, 3, 0, 0, 4, 4, 0, 1, 0, 3, 0, 3, 0, 3, 0, 0, 2, 3, 0, 0, 1, 0, 0,
+    0, 1, 0, 0, 4, 0, 0, 0, 0, 0, 2, 3, 3, 0, 4, 4, 0, 0, 1, 2, 4, 1, 2, 0,
+    2, 0, 0, 0, 4, 4, 2, 3, 0, 3, 0, 1, 0, 4, 3, 0, 0, 0, 4, 1, 3, 0, 3, 0,
+    2, 3, 0, 0, 2, 0, 1, 0, 4, 0, 0, 0, 4, 3, 4, 1, 3, 1, 0, 2, 4, 2, 0, 1,
+    0, 2, 0, 4, 1, 1, 0, 3, 0, 0, 4, 3, 3, 0, 4, 1, 4, 0, 3, 0, 3, 4, 1, 4,
+    2, 0, 1, 0, 0, 4, 0, 0, 0, 0, 0, 4, 1, 3, 0, 2, 2, 2, 0, 3, 2, 3, 1, 0,
+    3, 4, 0, 1, 0, 1, 0, 3, 0, 4, 1, 0, 4, 0, 4, 4, 1, 3, 0, 0, 3, 0, 4, 4,
+    1, 0, 4, 0, 2, 3, 0, 0, 1, 0, 0, 0, 0, 0, 4, 3, 2, 3, 2, 1, 3, 2, 0, 2,
+    3, 4, 3, 3, 0, 2, 0, 4, 0, 3, 0, 1, 3, 1, 0, 0, 1, 4, 2, 2, 1, 0, 3, 0,
+    3, 3, 3, 4, 0, 3, 3, 0, 0, 1, 0, 0, 0, 0, 4, 4, 2, 1, 1, 3, 3, 0, 3, 1,
+    3, 1, 0, 2, 0, 1, 4, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 3, 4, 3, 3, 1, 0, 2,
+    3, 0, 3, 0, 4, 4, 3, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 2, 0, 0, 3, 4, 0, 2,
+    4, 2, 2, 4, 4, 3, 3, 0, 2, 2, 0, 3, 0, 0, 4, 0, 2, 2, 1, 3, 1, 4, 2, 1,
+    0, 0, 2, 3, 4, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0,
+    0, 1, 4, 1, 0, 1, 0, 3, 3, 0, 3, 0, 4, 1, 3, 4, 0, 1, 1, 1, 3, 3, 0, 0,
+    3, 0, 0, 2, 3, 0, 0, 3, 0, 0, 3, 2, 0, 0, 0, 0, 0, 4, 3, 2, 4, 0, 3, 2,
+    2, 3, 0, 3, 0, 3, 4, 1, 2, 3, 0, 2, 4, 2, 3, 4, 0, 3, 0, 0, 4, 1, 1, 1,
+    0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 3, 4, 2, 2, 0, 3, 3, 4, 4, 2,
+    3, 4, 0, 4, 0, 1, 0, 0, 0, 0, 2, 3, 3, 3, 2, 4, 0, 4, 3, 3, 0, 3, 0, 3,
+    3, 0, 3, 3, 0, 0, 3, 1, 0, 0, 2, 0, 0, 0, 0, 0, 3, 2, 2, 0, 2, 3, 4, 1,
+    4, 0, 4, 4, 0, 3, 3, 0, 3, 0, 3, 0, 4, 0, 1, 4, 0, 3, 0, 0, 0, 0, 3, 0,
+    1, 3, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 4, 0, 2, 2, 1, 4, 0, 3, 2,
+    3, 2, 1, 0, 1, 0, 0, 4, 2, 0, 1, 3, 0, 3, 0, 2, 4, 0, 3, 0, 4, 0, 4, 4,
+    0, 3, 0, 1, 3, 0, 4, 0, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 4, 0, 2, 4, 3,
+    2, 0, 3, 0, 4, 4, 1, 0, 3, 2, 1, 2, 4, 4, 0, 4, 3, 2, 0, 0, 3, 0, 0, 0,
+    0, 1, 1, 0, 0, 3, 2, 0, 4, 0, 0, 0, 0, 0, 4, 0, 3, 2, 0, 0, 2, 1, 4, 0,
+    4, 4, 0, 1, 4, 0, 4, 0, 0, 0, 0, 3, 4, 0, 1, 0, 0, 3, 3, 4, 3, 0, 0, 0,
+    0, 1, 0, 0, 3, 2, 0, 0, 0, 4, 0, 0, 3, 3, 1, 0, 3, 0, 1, 2, 3, 0, 0, 3,
+    1, 0, 4, 0, 3, 0, 3, 4, 0, 0, 2, 4, 1, 3, 2, 0, 0, 0, 3, 4, 2, 1, 1, 3,
+    0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 4, 0, 3, 1, 2, 0, 3, 2, 0, 3,
+    4, 4, 3, 4, 1, 3, 0, 4, 3, 0, 0, 3, 0, 0, 0, 0, 4, 0, 3, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 3, 1, 3, 0, 4, 2, 4, 4, 0, 0, 3, 2, 0, 0, 0, 3, 0, 4,
+    0, 1, 0, 4, 0, 1, 3, 0, 1, 4, 0, 3, 0, 2, 3, 1, 0, 3, 3, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 3, 2, 2, 0, 1, 0, 1, 1, 4, 2, 1, 1, 0, 3, 0, 2, 1, 0, 0, 3,
+    3, 1, 1, 3, 2, 2, 0, 3, 0, 3, 3, 0, 1, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 0,
+    2, 1, 4, 0, 3, 0, 0, 4, 3, 2, 4, 4, 2, 0, 3, 0, 4, 1, 4, 0, 1, 3, 0, 1,
+    2, 4, 3, 1, 0, 2, 0, 0, 3, 0, 1, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2,
+    1, 0, 3, 2, 1, 2, 0, 1, 1, 1, 3, 0, 3, 0, 3, 4, 4, 3, 0, 4, 4, 0, 1, 2,
+    0, 3, 0, 0, 0, 1, 4, 0, 0, 3, 0, 2, 0, 0, 0, 0, 0, 4, 4, 2, 2, 3, 0, 3,
+    1, 1, 2, 4, 3, 2, 2, 0, 1, 1, 1, 3, 4, 0, 3, 0, 4, 4, 2, 4, 0, 3, 2, 4,
+    0, 2, 0, 4, 3, 1, 0, 0, 2, 3, 1, 0, 2, 0, 0, 0, 0, 0, 3, 2, 2, 4, 0, 2,
+    2, 0, 0, 0, 2, 4, 2, 3, 0, 0, 2, 0, 0, 0, 3, 3, 0, 3, 0, 1, 0, 0, 2, 3,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 3, 2, 4, 1, 3, 0, 1, 3, 0, 1, 3, 2, 1, 2, 0,
+    3, 0, 3, 2, 0, 4, 3, 0, 4, 0, 2, 4, 0, 0, 0, 2, 3, 1, 3, 0, 0, 3, 0, 2,
+    0, 4, 0, 0, 0, 0, 0, 4, 2, 2, 2, 3, 4, 2, 2, 4, 0, 2, 0, 3, 4, 0, 1, 0,
+    3, 2, 3, 4, 3, 4, 0, 3, 0, 3, 2, 1, 4, 1, 0, 3, 0, 0, 0, 0,
+};
+
+static const uint16_t voltage_fx_threshold[2348] = {
+    17488, 6279, 144, 5093, 4944, 25, 1, 107, 25, 25, 144, 4956,
+    216, 73, 5354, 5134, 788, 1277, 1241, 1037, 311, 5139, 8616, 52299,
+    16575, 7126, 43534, 48615, 32791, 60967, 27736, 21285, 12759, 14024, 62244, 31731,
+    58320, 31605, 62864, 62041, 35588, 34157, 59644, 52800, 61146, 62625, 34706, 36416,
+    35862, 59501, 36166, 64700, 36554, 64700, 19150, 8120, 5509, 4979, 4932, 4920,
+    4956, 120, 144, 5230, 942, 6088, 1920, 597, 7543, 27795, 3805, 12265,
+    430, 58011, 15103, 12545, 18780, 12945, 25101, 33322, 60908, 30496, 4210, 50879,
+    24564, 32088, 54088, 32505, 61886, 57259, 29662, 62291, 61540, 61409, 35588, 34539,
+    61910, 60753, 60622, 27342, 62339, 36423, 35760, 62207, 35904, 36822, 63305, 64663,
+    9290, 1, 6237, 5509, 144, 5093, 49, 740, 430, 669, 1301, 526,
+    6917, 14644, 5665, 32409, 60908, 24290, 12569, 27330, 47100, 28672, 28481, 31731,
+    62326, 56806, 55423, 58488, 56568, 34717, 60932, 33423, 61981, 54981, 58022, 57867,
+    62564, 36172, 35582, 62302, 35862, 36822, 36554, 64700, 17344, 8062, 5808, 4979,
+    4944, 4932, 1, 144, 168, 120, 1468, 1061, 526, 3698, 6785, 27891,
+    3064, 1347, 13672, 11752, 13785, 23992, 3089, 17505, 32774, 60967, 27033, 21053,
+    19461, 3077, 60908, 31343, 57188, 62326, 56007, 53575, 59847, 34717, 61027, 54695,
+    49782, 33423, 33364, 34706, 35588, 30502, 59895, 36440, 61027, 36583, 9487, 1,
+    6279, 144, 4991, 4944, 1, 144, 4991, 5516, 2110, 931, 55518, 5116,
+    3708, 42748, 30246, 22686, 11496, 11931, 10649, 7060, 17488, 11216, 55077, 59716,
+    25852, 39934, 28720, 33495, 62267, 61934, 31892, 58022, 62326, 56568, 35605, 34717,
+    60705, 27342, 63328, 35862, 64043, 19312, 8120, 1, 6582, 216, 144, 155,
+    49472, 7543, 2290, 1241, 1563, 24111, 14626, 4854, 16975, 58070, 14268, 33328,
+    61123, 28720, 5271, 23056, 31748, 31707, 61981, 32774, 58356, 35147, 60777, 58510,
+    54981, 34813, 59668, 61731, 53431, 36256, 35588, 58964, 35838, 36822, 36434, 64700,
+    17488, 1, 6279, 144, 5117, 4944, 561, 144, 4991, 5516, 1384, 931,
+    55518, 16181, 6810, 17505, 33328, 61123, 27033, 20569, 3030, 20951, 32409, 60693,
+    60765, 61873, 61826, 59549, 61528, 35159, 61075, 34539, 55839, 34819, 62887, 59930,
+    36321, 35760, 62160, 62898, 36798, 31146, 64210, 16975, 8120, 1, 6303, 144,
+    5093, 144, 2397, 311, 7764, 1193, 1253, 9779, 53646, 22990, 6798, 12122,
+    33053, 60908, 26234, 21512, 21923, 48936, 30902, 1920, 51035, 31789, 59549, 28255,
+    61790, 62220, 34735, 62494, 60538, 33680, 61600, 36321, 35588, 62625, 35760, 36822,
+    36428, 64700, 21816, 8120, 5516, 144, 5093, 4944, 311, 144, 4991, 5170,
+    656, 502, 1837, 7543, 669, 2802, 657, 16033, 47422, 16062, 12945, 60181,
+    22263, 33048, 60908, 28672, 28319, 8455, 31731, 53754, 32505, 32213, 31605, 59906,
+    61491, 59382, 35582, 62685, 34157, 61910, 29930, 36416, 35760, 61612, 36154, 36965,
+    36583, 64700, 13910, 6553, 144, 4991, 4932, 1, 73, 597, 85, 5254,
+    73, 85, 144, 5414, 5522, 1480, 53694, 9290, 692, 58011, 9349, 7096,
+    36941, 33322, 21816, 5176, 2219, 60181, 51906, 60967, 31737, 17422, 61993, 58022,
+    33060, 35588, 62685, 34169, 59668, 32267, 36440, 35760, 61229, 62530, 36840, 63352,
+    64663, 17726, 8062, 1, 6476, 5354, 4979, 538, 1480, 692, 4103, 2802,
+    29942, 657, 537, 13815, 22430, 3566, 13164, 26472, 3399, 33322, 60967, 30496,
+    30478, 27033, 60908, 32290, 32583, 33060, 62326, 57259, 61528, 35588, 34479, 61242,
+    58857, 60216, 61790, 34944, 35123, 36428, 35862, 62387, 36184, 36965, 36816, 64700,
+    21816, 8120, 1, 5516, 4991, 144, 12, 608, 502, 7764, 2802, 29942,
+    1253, 537, 11752, 14119, 6034, 29835, 62196, 17857, 43987, 33096, 60967, 28672,
+    49329, 39278, 60908, 31760, 60932, 57474, 62326, 53575, 62016, 35588, 62685, 34169,
+    61278, 29930, 36434, 62470, 56388, 31695, 36965, 36697, 64700, 19150, 8616, 1,
+    5504, 4979, 4944, 1, 1062, 6202, 6625, 1837, 1193, 13176, 17768, 9344,
+    12122, 25303, 16456, 33411, 32409, 60956, 28672, 49032, 10804, 25190, 61993, 31731,
+    62326, 56806, 58464, 31707, 34837, 61278, 33740, 62160, 61075, 58022, 61528, 43343,
+    35809, 20391, 35385, 63018, 36315, 36845, 17802, 1, 7764, 6577, 4979, 4932,
+    144, 1480, 4103, 2851, 1347, 43534, 13021, 33328, 60825, 28684, 28481, 14631,
+    31581, 31570, 61993, 31605, 59549, 61707, 61468, 57843, 35588, 34467, 60919, 56127,
+    61146, 62625, 61993, 36434, 35862, 62351, 36315, 36965, 36697, 64771, 10017, 1,
+    6184, 4979, 4932, 216, 4956, 96, 96, 144, 1277, 25530, 52192, 7764,
+    40745, 10339, 28672, 49329, 2553, 55495, 26353, 11138, 20951, 10667, 26430, 61671,
+    19872, 30991, 33625, 62267, 62482, 31336, 57580, 35194, 61075, 34574, 61146, 36315,
+    35862, 36828, 21816, 8120, 6553, 144, 4991, 4932, 5163, 49, 144, 2541,
+    6582, 6810, 7561, 6976, 4519, 1253, 1563, 16205, 12545, 4854, 14405, 62196,
+    17857, 55256, 33322, 60908, 31581, 31570, 50654, 57820, 32457, 53134, 52143, 57355,
+    61147, 60956, 59549, 58022, 62136, 35582, 34729, 61087, 34121, 40781, 27342, 61790,
+    36368, 62506, 35809, 36232, 64247, 36554, 37156, 21816, 6303, 4979, 4944, 25,
+    1, 216, 1, 1, 96, 12, 144, 144, 5354, 1301, 25553, 657,
+    1037, 526, 10083, 8616, 6810, 1957, 56544, 44273, 33102, 60967, 28677, 28481,
+    40458, 62244, 31820, 32583, 61468, 62482, 62160, 62016, 57580, 34735, 60574, 58857,
+    53467, 59596, 34706, 34229, 36184, 35588, 31599, 35874, 36816, 36434, 64700, 17488,
+    6303, 1, 4991, 4944, 25, 1, 1, 96, 1360, 2338, 311, 9779,
+    9552, 8616, 7764, 55076, 21237, 43963, 33328, 28629, 49413, 26972, 20951, 60181,
+    25125, 60908, 31731, 53754, 61767, 31789, 62124, 33203, 35588, 62685, 34610, 59656,
+    61934, 63447, 35809, 62267, 36213, 64235, 64008, 64795, 17779, 6279, 1, 4979,
+    4944, 25, 25, 12, 144, 1252, 56580, 727, 8616, 4270, 3375, 32684,
+    58011, 15574, 12945, 33048, 60967, 28725, 49485, 49998, 20135, 31748, 53754, 61992,
+    59775, 62326, 62172, 58857, 35558, 34151, 59477, 33406, 33400, 27342, 61862, 36416,
+    35760, 62244, 61969, 36965, 36697, 64616, 10017, 6303, 5522, 4979, 4944, 25,
+    1, 1, 144, 705, 502, 2016, 1848, 27140, 1861, 931, 9147, 4294,
+    1456, 30109, 30520, 60991, 19157, 4794, 3327, 55076, 1944, 550, 27736, 28255,
+    33322, 60908, 31885, 50987, 53133, 61873, 57259, 57629, 35385, 34610, 60538, 61790,
+    36315, 35760, 36822, 17488, 7841, 6303, 5516, 4991, 144, 96, 716, 550,
+    6112, 2541, 311, 4853, 6893, 29047, 3064, 1193, 3054, 1563, 19401, 42188,
+    13666, 43534, 45537, 33096, 60908, 28720, 3303, 26842, 62267, 31641, 31570, 61981,
+    57355, 62326, 61409, 60956, 62351, 59406, 34944, 61075, 33632, 59369, 34591, 43343,
+    61181, 36315, 35588, 61934, 50797, 36583, 63018, 37162, 10017, 6303, 216, 5068,
+    4956, 4932, 4979, 107, 263, 454, 155, 240, 27056, 5354, 5134, 799,
+    1861, 7376, 8569, 9314, 3232, 40745, 32791, 26316, 11472, 21923, 26888, 21911,
+    11817, 48090, 60693, 30496, 1944, 31581, 58582, 62326, 35111, 61934, 33585, 55399,
+    60753, 62053, 61528, 58488, 62946, 30502, 35760, 36840, 36499, 64485, 19312, 6303,
+    1, 5509, 4979, 4944, 25, 1027, 502, 5665, 2123, 1193, 56580, 727,
+    836, 10649, 454, 9147, 30109, 4103, 31552, 15103, 48160, 54970, 32416, 61205,
+    28672, 28398, 50248, 31581, 31570, 51428, 56806, 58332, 34717, 61027, 33423, 54600,
+    58929, 58022, 34706, 35760, 62410, 58857, 28618, 36828, 36315, 64747, 7841, 6553,
+    144, 371, 4944, 4932, 1, 25, 107, 5140, 144, 4991, 49, 204,
+    5373, 120, 775, 6810, 442, 27164, 5820, 33435, 9922, 33096, 23205, 11472,
+    21136, 3054, 16504, 58011, 18179, 60967, 28672, 10518, 62244, 57604, 62326, 35027,
+    62577, 60753, 33680, 58344, 36256, 35582, 62339, 35791, 36840, 36416, 64663, 17488,
+    6553, 5509, 4979, 4944, 25, 1, 1, 96, 656, 5933, 550, 799,
+    2911, 1837, 53694, 1085, 1563, 6582, 2290, 38253, 11752, 8395, 20415, 27474,
+    57676, 32791, 61123, 30520, 2481, 51917, 24290, 61910, 31731, 62326, 61576, 57235,
+    58488, 34717, 60753, 33764, 54718, 55506, 33364, 58022, 61181, 35588, 62625, 30502,
+    36434, 35862, 36804, 16975, 6553, 144, 5015, 4932, 1, 4956, 561, 25,
+    5266, 144, 4991, 73, 5354, 168, 775, 1480, 1193, 298, 59906, 9147,
+    31993, 4103, 61348, 20139, 15359, 46157, 32445, 60908, 28629, 28319, 21816, 31737,
+    53754, 53134, 56282, 54374, 60956, 34706, 59703, 33442, 61993, 55506, 33400, 59930,
+    35862, 29262, 35588, 36822, 36256, 64663, 19150, 8120, 1, 6279, 144, 5093,
+    73, 1490, 55518, 4972, 3064, 56484, 1085, 454, 58011, 13815, 22561, 25624,
+    13618, 33322, 61123, 30496, 30478, 62172, 62244, 31892, 57188, 32136, 62864, 28255,
+    61528, 35147, 60765, 34509, 33632, 58785, 62887, 34651, 36184, 30502, 35588, 36583,
+    36428, 64771, 17779, 6553, 144, 4991, 4932, 4920, 4956, 5152, 37, 287,
+    144, 4991, 168, 204, 5516, 5170, 705, 2373, 53694, 2302, 1563, 6582,
+    836, 8616, 7764, 7483, 22060, 58011, 42593, 57079, 33053, 60967, 28629, 49329,
+    26234, 62387, 60908, 31731, 32583, 32488, 62326, 57103, 61790, 35159, 62887, 34151,
+    59644, 60896, 36452, 35582, 59130, 35862, 64092, 36697, 64771, 17779, 6582, 1,
+    168, 144, 144, 144, 73, 61, 5354, 2255, 29942, 1253, 9779, 2290,
+    15103, 39564, 11752, 27474, 25160, 21345, 32243, 60598, 30502, 30449, 50367, 49091,
+    35379, 31737, 62220, 56806, 59751, 34837, 60765, 33442, 52084, 55709, 58022, 62136,
+    61504, 35862, 30502, 35588, 36434, 489, 37049, 21816, 6279, 1, 5516, 144,
+    370, 49, 5545, 430, 1061, 2373, 7512, 597, 727, 335, 2076, 11752,
+    5449, 1872, 7006, 44273, 19150, 53765, 32798, 60967, 28720, 50450, 48340, 24976,
+    62244, 31731, 62326, 62326, 56806, 62148, 31707, 34717, 61278, 33752, 40959, 54099,
+    58022, 33203, 43343, 35760, 30478, 62744, 36583, 36321, 64414, 10017, 6279, 5516,
+    4979, 4944, 25, 1, 1, 144, 870, 550, 502, 3447, 5999, 45012,
+    1384, 25530, 597, 311, 9147, 31993, 6810, 31432, 32279, 60728, 28672, 49032,
+    2206, 54958, 31581, 31570, 53313, 62326, 58356, 57235, 58488, 34717, 61695, 34145,
+    53146, 55839, 61814, 40781, 35760, 62636, 59239, 36499, 36213, 63841, 17779, 6279,
+    1, 5516, 216, 144, 61, 919, 550, 27652, 1384, 7512, 597, 1538,
+    657, 2076, 9344, 5641, 7453, 27819, 54398, 13033, 33102, 60181, 30502, 30473,
+    25554, 31581, 31563, 32452, 32500, 60728, 61910, 61147, 61886, 57975, 34777, 61504,
+    60753, 33442, 61945, 35582, 20987, 6452, 62029, 36428, 35862, 36845, 17779, 7841,
+    5522, 216, 4991, 4944, 5063, 49, 4985, 5134, 669, 28833, 6248, 3447,
+    800, 3064, 1085, 27032, 58011, 21237, 5068, 14268, 43963, 25101, 33096, 59990,
+    27480, 19150, 51655, 31748, 53754, 53110, 57485, 60956, 53765, 62326, 59406, 57699,
+    35296, 34014, 59537, 52812, 61242, 61003, 34574, 34651, 36416, 35760, 60646, 36321,
+    36822, 36476, 37215, 21911, 8120, 1, 5516, 4979, 4944, 144, 1003, 6088,
+    7764, 4592, 56484, 2302, 15574, 43534, 8616, 60181, 51906, 33322, 60967, 31731,
+    1944, 51917, 54051, 62005, 32428, 56282, 53575, 55423, 61147, 61528, 35588, 34610,
+    60753, 33835, 33721, 27342, 59143, 36428, 35862, 62315, 36172, 36822, 63352, 64700,
+    8120, 1, 5522, 4979, 4944, 25, 1, 120, 144, 5134, 526, 502,
+    430, 311, 7764, 669, 27480, 2124, 54111, 11460, 1253, 478, 21375, 16181,
+    22430, 27699, 61170, 55101, 33495, 61266, 31856, 30323, 62053, 57604, 57259, 58022,
+    35707, 34610, 60980, 29930, 36416, 36184, 36840, 17488, 8062, 5509, 4979, 4944,
+    25, 36, 144, 168, 120, 621, 6224, 1837, 35474, 3101, 836, 2802,
+    537, 489, 10083, 22227, 9344, 11496, 10827, 32774, 26234, 21905, 12759, 60181,
+    50570, 39016, 41377, 62267, 31731, 8825, 60108, 61111, 35147, 61027, 34276, 54255,
+    60896, 33513, 61528, 62887, 36315, 35760, 59477, 62898, 36840, 36554, 64700, 17433,
+    6553, 1, 5509, 4991, 144, 1, 656, 6088, 931, 1480, 53694, 3054,
+    489, 9290, 57116, 58011, 13815, 9349, 12175, 12945, 57079, 32409, 60956, 27033,
+    49580, 20951, 41568, 61993, 30520, 61147, 31635, 30628, 34944, 34002, 61695, 33978,
+    58595, 60705, 34580, 34753, 36268, 30502, 35582, 36840, 36428, 64581, 17488, 6303,
+    5516, 4979, 4944, 25, 4967, 1, 96, 860, 58762, 6112, 27652, 2730,
+    1360, 1193, 2611, 6446, 3054, 9290, 8616, 14869, 3375, 8062, 43534, 48615,
+    33096, 60967, 27033, 20569, 53968, 23056, 60908, 31581, 62326, 33060, 62326, 59345,
+    34729, 61266, 33400, 58022, 60681, 33400, 40781, 35760, 62124, 35296, 35361, 36554,
+    36315, 64663, 8120, 1, 5516, 4979, 4932, 216, 4956, 96, 85, 144,
+    656, 6088, 1837, 6470, 3197, 1349, 5128, 28672, 2100, 2587, 3054, 1037,
+    56007, 48758, 13999, 22430, 8455, 58165, 20242, 33322, 60944, 31581, 31570, 32798,
+    31605, 57903, 58022, 35582, 34729, 60753, 27342, 36583, 61361, 36840, 19312, 8120,
+    1, 5516, 144, 4991, 144, 942, 6088, 7764, 3805, 3054, 489, 15103,
+    58011, 23181, 12945, 28785, 3566, 32774, 62267, 30496, 30478, 28720, 31748, 54051,
+    61623, 31534, 56568, 35594, 34056, 61695, 54159, 61325, 60777, 35492, 35159, 36315,
+    35946, 62244, 36166, 36845, 63889, 64700, 21816, 6303, 1, 168, 5093, 4944,
+    359, 49, 61, 5516, 1301, 7512, 1538, 526, 430, 13815, 8616, 4972,
+    43534, 21267, 55089, 33096, 60944, 27480, 21213, 26305, 23205, 31737, 53754, 61767,
+    57474, 61147, 59549, 32063, 33017, 34706, 60753, 58892, 55423, 60073, 58344, 61146,
+    35814, 62744, 20391, 36715, 36315, 36965, 10017, 1, 6279, 5354, 4979, 4944,
+    144, 788, 30896, 5665, 1301, 4114, 526, 8616, 4972, 5044, 26371, 2206,
+    54111, 26888, 454, 58380, 28105, 60181, 19150, 54636, 52096, 24046, 32774, 60908,
+    30502, 30478, 31737, 31789, 59906, 34944, 60753, 33680, 58022, 36244, 35582, 36697,
+    19150, 6279, 1, 5516, 216, 144, 96, 1027, 1920, 6112, 764, 1253,
+    489, 47219, 9147, 7841, 26877, 34473, 11507, 10435, 33108, 60825, 27033, 51512,
+    21786, 13046, 30699, 13260, 31849, 57604, 61147, 32213, 57259, 62016, 35159, 62887,
+    34157, 59644, 62016, 62970, 35814, 62291, 62482, 36940, 36792, 37353, 17488, 8789,
+    7, 5516, 144, 5093, 144, 1003, 823, 6917, 5534, 11752, 11400, 8849,
+    44227, 22346, 11496, 43534, 33322, 61123, 26234, 20569, 15669, 22686, 31731, 54051,
+    60836, 57653, 57259, 62399, 60073, 60240, 35588, 62887, 34574, 60932, 61790, 36423,
+    62494, 35946, 36244, 36822, 63066, 64663, 17488, 8120, 7, 6553, 4979, 4944,
+    96, 2541, 57116, 6976, 1957, 12754, 9779, 58011, 21237, 12151, 50594, 62041,
+    25101, 33096, 60908, 28725, 49281, 46778, 50510, 31605, 45121, 59835, 32314, 56806,
+    57235, 59751, 61886, 57975, 34479, 59656, 33752, 33406, 55721, 33400, 59692, 35814,
+    29262, 62744, 36499, 36166, 37036, 21816, 8062, 1, 5808, 4991, 144, 96,
+    1861, 6202, 3185, 3494, 3101, 1037, 12044, 11400, 8849, 42462, 48615, 32791,
+    60967, 28720, 13570, 53432, 50141, 60908, 31731, 62326, 62326, 31111, 55423, 59847,
+    35027, 61075, 33942, 33442, 34574, 58022, 40781, 36404, 35707, 61922, 35934, 64068,
+    36816, 36935, 21905, 7841, 6553, 168, 144, 371, 120, 73, 4962, 144,
+    2755, 1527, 4103, 16158, 2290, 1241, 1563, 15103, 15179, 12175, 20129, 60181,
+    55089, 33048, 61600, 27736, 49854, 35343, 42283, 62254, 31737, 62864, 59440, 61146,
+    34717, 59703, 33406, 59835, 55399, 58368, 33650, 35760, 31408, 59143, 63328, 36315,
+    64259, 8120, 1, 6553, 5354, 4991, 144, 96, 775, 55042, 5659, 1909,
+    692, 7346, 6810, 30496, 56937, 49854, 3554, 657, 17857, 13910, 43654, 19974,
+    28255, 33102, 61123, 60371, 31653, 60932, 33060, 58356, 35588, 34014, 58905, 62625,
+    36428, 35814, 37049, 17779, 6553, 1, 5516, 144, 5093, 49, 584, 57581,
+    1015, 1480, 7512, 1527, 561, 15103, 38253, 48160, 51809, 24218, 17505, 33102,
+    60825, 26234, 60181, 21488, 31336, 25028, 50402, 32314, 62326, 31111, 59406, 62326,
+    35594, 34610, 33625, 58905, 60753, 30502, 61934, 36434, 35862, 62351, 36184, 64557,
+    36816, 63603, 8062, 1, 6303, 4991, 4944, 25, 1, 1, 96, 1480,
+    55518, 32684, 3280, 62302, 31581, 53479, 28672, 2219, 55495, 20051, 45264, 29924,
+    60753, 54231, 53706, 62207, 62864, 61707, 33382, 60836, 32791, 59573, 53277, 57485,
+    62064, 58022, 35588, 62887, 34706, 36440, 35862, 36840,
+};
+
+static const int16_t voltage_fx_children[4696] = {
+    1, 28, 2, 17, 3, 10, 4, 7, 5, 6, -1, -2, -3, -4, 8, 9,
+    -5, -6, -7, -8, 11, 14, 12, 13, -9, -10, -11, -12, 15, 16, -13, -14,
+    -15, -16, 18, 22, 19, 21, 20, -19, -17, -18, -20, -21, 23, 26, 24, 25,
+    -22, -23, -24, -3, 27, -27, -25, -26, 29, 40, 30, 37, 31, 34, 32, 33,
+    -20, -28, -29, -30, 35, 36, -31, -32, -33, -34, 38, -38, 39, -37, -35, -36,
+    41, 47, 42, 45, 43, 44, -39, -40, -41, -42, 46, -45, -43, -44, 48, 51,
+    49, 50, -46, -47, -48, -49, 52, 53, -50, -51, -52, -53, 55, 79, 56, 70,
+    57, 64, 58, 61, 59, 60, -54, -55, -56, -57, 62, 63, -58, -27, -59, -60,
+    65, 68, 66, 67, -61, -62, -63, -64, 69, -67, -65, -66, 71, 73, 72, -19,
+    -20, -68, 74, 77, 75, 76, -69, -70, -71, -72, 78, -75, -73, -74, 80, 94,
+    81, 88, 82, 85, 83, 84, -76, -77, -78, -79, 86, 87, -80, -81, -82, -83,
+    89, 92, 90, 91, -36, -84, -85, -37, 93, -88, -86, -87, 95, 101, 96, 99,
+    97, 98, -89, -90, -91, -92, -93, 100, -94, -45, 102, 105, 103, 104, -95, -96,
+    -97, -98, 106, 107, -99, -100, -101, -102, 109, 123, -103, 110, 111, 118, 112, 115,
+    113, 114, -104, -105, -106, -107, 116, 117, -62, -108, -109, -110, 119, 120, -64, -18,
+    121, 122, -111, -112, -113, -114, 124, 137, 125, 132, 126, 129, 127, 128, -115, -116,
+    -117, -118, 130, 131, -119, -77, -120, -121, 133, 136, 134, 135, -35, -87, -85, -37,
+    -38, -33, 138, 145, 139, 142, 140, 141, -122, -123, -124, -125, 143, 144, -126, -127,
+    -128, -129, 146, 149, 147, 148, -130, -45, -131, -132, 150, 151, -133, -134, -135, -136,
+    153, 176, 154, 168, 155, 162, 156, 159, 157, 158, -137, -138, -3, -139, 160, 161,
+    -140, -141, -142, -143, 163, 165, -144, 164, -64, -18, 166, 167, -145, -146, -147, -148,
+    169, 170, -68, -20, 171, 174, 172, 173, -149, -150, -151, -152, -153, 175, -154, -155,
+    177, 189, 178, 185, 179, 182, 180, 181, -156, -157, -29, -158, 183, 184, -159, -160,
+    -33, -34, 186, -38, 187, 188, -36, -35, -85, -37, 190, 196, 191, 194, 192, 193,
+    -161, -162, -163, -164, -127, 195, -165, -129, 197, 199, -93, 198, -166, -167, 200, 201,
+    -168, -169, -170, -171, 203, 218, -103, 204, 205, 212, 206, 209, 207, 208, -172, -173,
+    -174, -175, 210, 211, -176, -141, -177, -178, 213, 215, 214, -21, -18, -64, 216, 217,
+    -179, -180, -181, -182, 219, 231, 220, 227, 221, 224, 222, 223, -20, -183, -19, -73,
+    225, 226, -74, -184, -185, -186, 228, -87, 229, 230, -187, -188, -189, -190, 232, 238,
+    233, 236, 234, 235, -191, -192, -193, -88, -35, 237, -38, -33, 239, 242, 240, 241,
+    -194, -195, -93, -196, 243, 244, -197, -198, -199, -200, 246, 263, 247, 254, -103, 248,
+    249, 252, 250, 251, -201, -202, -203, -204, 253, -64, -205, -67, 255, 257, -19, 256,
+    -21, -20, 258, 261, 259, 260, -206, -207, -155, -208, 262, -74, -209, -210, 264, 273,
+    265, 271, 266, 268, -77, 267, -211, -212, 269, 270, -213, -214, -215, -216, 272, -127,
+    -35, -85, 274, 281, 275, 278, 276, 277, -217, -218, -219, -220, 279, 280, -221, -222,
+    -223, -224, 282, 285, 283, 284, -225, -226, -227, -228, 286, 287, -229, -230, -231, -232,
+    289, 304, -103, 290, 291, 298, 292, 295, 293, 294, -233, -234, -235, -236, 296, 297,
+    -237, -238, -239, -240, 299, 301, 300, -21, -18, -64, 302, 303, -241, -242, -243, -244,
+    305, 317, 306, 313, 307, 310, 308, 309, -29, -245, -246, -247, 311, 312, -248, -33,
+    -249, -34, 314, 316, -85, 315, -84, -36, -127, -250, 318, 324, 319, 322, 320, 321,
+    -251, -252, -253, -254, 323, -129, -255, -256, 325, 328, 326, 327, -257, -258, -259, -260,
+    329, 330, -261, -262, -263, -264, 332, 348, 333, 341, -103, 334, 335, 338, 336, 337,
+    -265, -266, -267, -268, 339, 340, -17, -18, -269, -67, 342, 344, 343, -21, -68, -183,
+    345, -73, 346, 347, -270, -271, -272, -273, 349, 362, 350, 357, 351, 354, 352, 353,
+    -274, -275, -276, -277, 355, 356, -278, -279, -280, -281, 358, 360, -37, 359, -36, -87,
+    361, -84, -88, -33, 363, 367, 364, -129, 365, 366, -282, -283, -284, -285, 368, 371,
+    369, 370, -286, -45, -287, -288, 372, 373, -289, -290, -291, -292, 375, 397, 376, 389,
+    377, 384, 378, 381, 379, 380, -293, -294, -295, -296, 382, 383, -297, -238, -298, -299,
+    385, 387, 386, -18, -108, -62, 388, -67, -109, -300, 390, 391, -68, -21, 392, 395,
+    393, 394, -301, -302, -303, -75, 396, -277, -304, -305, 398, 410, 399, 405, 400, 402,
+    401, -77, -29, -306, 403, 404, -307, -308, -309, -310, 406, 408, 407, -38, -37, -311,
+    -84, 409, -312, -88, 411, 415, 412, -129, 413, 414, -313, -314, -93, -315, 416, 419,
+    417, 418, -316, -317, -318, -319, 420, 421, -320, -321, -322, -323, 423, 445, 424, 437,
+    425, 432, 426, 429, 427, 428, -324, -325, -326, -327, 430, 431, -328, -329, -3, -330,
+    433, 434, -331, -141, 435, 436, -332, -144, -333, -334, 438, 441, 439, 440, -68, -20,
+    -64, -17, 442, -73, 443, 444, -335, -336, -337, -27, 446, 457, 447, 451, 448, 449,
+    -19, -20, 450, -277, -338, -339, 452, 455, 453, 454, -340, -341, -342, -343, 456, -88,
+    -344, -345, 458, 462, 459, -129, 460, 461, -346, -347, -93, -348, 463, 466, 464, 465,
+    -349, -350, -351, -352, 467, 468, -353, -354, -355, -356, 470, 489, 471, 479, -103, 472,
+    473, 476, 474, 475, -357, -358, -359, -360, 477, 478, -64, -17, -361, -362, 480, 483,
+    481, -19, 482, -21, -183, -68, 484, 487, 485, 486, -363, -364, -365, -27, 488, -273,
+    -366, -367, 490, 501, 491, 497, 492, 494, 493, -76, -368, -369, 495, 496, -370, -371,
+    -33, -34, 498, 500, 499, -38, -372, -373, -374, -250, 502, 509, 503, 506, 504, 505,
+    -375, -376, -91, -377, 507, 508, -378, -379, -380, -381, 510, 513, 511, 512, -382, -383,
+    -384, -385, 514, 515, -386, -387, -388, -389, 517, 537, 518, 526, -103, 519, 520, 523,
+    521, 522, -390, -391, -11, -392, 524, 525, -108, -18, -393, -67, 527, 530, 528, -19,
+    529, -21, -183, -68, 531, 534, 532, 533, -149, -206, -394, -109, 535, 536, -395, -396,
+    -75, -397, 538, 549, 539, 545, 540, 542, 541, -77, -398, -399, 543, 544, -400, -401,
+    -33, -34, 546, 548, 547, -38, -36, -402, -250, -88, 550, 554, 551, -129, 552, 553,
+    -403, -404, -93, -405, 555, 558, 556, 557, -406, -407, -408, -409, 559, 560, -410, -411,
+    -412, -413, 562, 580, 563, 571, -103, 564, 565, 568, 566, 567, -414, -415, -11, -416,
+    569, 570, -417, -17, -418, -419, 572, 573, -19, -183, 574, 577, 575, 576, -149, -420,
+    -109, -421, 578, 579, -422, -423, -424, -72, 581, 592, 582, 588, 583, 586, 584, 585,
+    -425, -426, -277, -77, 587, -33, -427, -428, 589, -38, 590, 591, -429, -36, -37, -85,
+    593, 600, 594, 597, 595, 596, -430, -123, -431, -432, 598, 599, -127, -250, -129, -433,
+    601, 603, -93, 602, -434, -435, 604, 605, -436, -437, -438, -439, 607, 619, -103, 608,
+    609, 615, 610, 613, 611, 612, -440, -441, -442, -443, -64, 614, -444, -445, 616, 617,
+    -68, -20, 618, -27, -446, -447, 620, 632, 621, 627, 622, 624, 623, -77, -448, -449,
+    625, 626, -450, -84, -451, -123, 628, 630, -37, 629, -36, -330, -84, 631, -38, -452,
+    633, 639, 634, 637, 635, 636, -453, -454, -432, -455, 638, -45, -456, -457, 640, 643,
+    641, 642, -458, -459, -460, -461, 644, 645, -462, -463, -464, -465, 647, 662, -103, 648,
+    649, 656, 650, 653, 651, 652, -466, -467, -468, -469, 654, 655, -470, -471, -472, -473,
+    657, 659, -21, 658, -18, -17, 660, 661, -474, -475, -476, -394, 663, 674, 664, 671,
+    665, 668, 666, 667, -477, -478, -19, -479, 669, 670, -74, -480, -481, -482, 672, -483,
+    -27, 673, -77, -36, 675, 679, 676, 678, 677, -37, -484, -485, -35, -38, 680, 683,
+    681, 682, -486, -487, -432, -488, 684, 685, -489, -490, -491, -492, 687, 710, 688, 700,
+    689, 695, 690, 693, 691, 692, -493, -494, -495, -496, -141, 694, -497, -498, 696, 697,
+    -17, -64, 698, 699, -499, -500, -501, -502, 701, 703, -183, 702, -21, -20, 704, 707,
+    705, 706, -420, -207, -394, -109, 708, 709, -503, -504, -75, -277, 711, 725, 712, 719,
+    713, 716, 714, 715, -505, -506, -84, -507, 717, 718, -508, -509, -510, -511, 720, 723,
+    721, 722, -512, -38, -513, -36, 724, -88, -127, -34, 726, 732, 727, 730, 728, 729,
+    -514, -515, -129, -516, -93, 731, -517, -518, 733, 736, 734, 735, -519, -520, -521, -522,
+    737, 738, -523, -524, -525, -526, 740, 764, 741, 753, 742, 749, 743, 746, 744, 745,
+    -527, -528, -529, -10, 747, 748, -530, -3, -531, -532, -11, 750, 751, 752, -533, -534,
+    -535, -536, 754, 758, 755, 757, 756, -21, -68, -183, -64, -18, 759, 762, 760, 761,
+    -537, -538, -149, -539, 763, -542, -540, -541, 765, 777, 766, 772, 767, 769, 768, -77,
+    -543, -544, 770, 771, -545, -546, -33, -34, 773, 774, -84, -37, 775, 776, -250, -88,
+    -35, -38, 778, 784, 779, 782, 780, 781, -547, -548, -549, -550, 783, -129, -551, -552,
+    785, 788, 786, 787, -93, -553, -554, -555, 789, 790, -556, -557, -558, -559, 792, 810,
+    793, 800, -103, 794, 795, 798, 796, 797, -560, -561, -3, -562, -11, 799, -563, -564,
+    801, 804, 802, 803, -17, -18, -21, -183, 805, 807, 806, -149, -565, -566, 808, 809,
+    -567, -568, -243, -75, 811, 824, 812, 817, 813, 815, 814, -77, -569, -570, 816, -277,
+    -571, -572, 818, 821, 819, 820, -573, -574, -575, -123, 822, 823, -35, -37, -576, -127,
+    825, 829, 826, -129, 827, 828, -577, -578, -579, -580, 830, 833, 831, 832, -581, -582,
+    -583, -584, 834, 835, -585, -586, -587, -588, 837, 855, 838, 845, -103, 839, 840, 843,
+    841, 842, -589, -590, -591, -592, -11, 844, -593, -594, 846, 848, 847, -19, -18, -17,
+    849, 852, 850, 851, -595, -113, -596, -3, 853, 854, -597, -598, -243, -75, 856, 868,
+    857, 864, 858, 861, 859, 860, -599, -600, -542, -601, 862, 863, -602, -603, -604, -34,
+    865, 867, 866, -38, -605, -35, -88, -37, 869, 875, 870, 873, 871, 872, -606, -607,
+    -127, -608, -93, 874, -609, -610, 876, 879, 877, 878, -611, -612, -613, -614, 880, 881,
+    -615, -616, -617, -618, 883, 902, 884, 896, 885, 891, 886, 889, 887, 888, -619, -620,
+    -621, -622, -11, 890, -623, -624, 892, 893, -108, -109, 894, 895, -625, -626, -627, -628,
+    897, 898, -18, -21, 899, -539, 900, 901, -629, -630, -631, -632, 903, 912, 904, 911,
+    905, 908, 906, 907, -633, -19, -634, -635, 909, 910, -636, -637, -638, -639, -36, -87,
+    913, 920, 914, 917, 915, 916, -640, -641, -642, -643, 918, 919, -84, -644, -35, -645,
+    921, 924, 922, 923, -646, -647, -648, -649, 925, 926, -650, -651, -652, -653, 928, 951,
+    929, 942, 930, 937, 931, 934, 932, 933, -654, -655, -656, -657, 935, 936, -62, -658,
+    -659, -660, 938, 939, -17, -18, 940, 941, -499, -630, -661, -662, 943, 946, -19, 944,
+    -183, 945, -21, -20, 947, 949, 948, -73, -663, -664, 950, -27, -109, -665, 952, 966,
+    953, 960, 954, 957, 955, 956, -29, -20, -666, -277, 958, 959, -667, -668, -669, -123,
+    961, 964, 962, 963, -35, -670, -33, -38, 965, -37, -126, -88, 967, 973, 968, 971,
+    969, 970, -671, -672, -673, -674, -129, 972, -432, -675, 974, 977, 975, 976, -676, -677,
+    -678, -679, 978, 979, -680, -681, -682, -683, 981, 1002, 982, 996, 983, 990, 984, 987,
+    985, 986, -684, -685, -686, -687, 988, 989, -5, -6, -688, -689, 991, 993, -11, 992,
+    -331, -144, 994, 995, -690, -691, -359, -692, 997, 998, -18, -21, 999, -539, 1000, 1001,
+    -693, -694, -695, -632, 1003, 1016, 1004, 1010, 1005, 1007, 1006, -116, -696, -20, 1008, 1009,
+    -73, -697, -698, -36, 1011, 1014, 1012, 1013, -699, -700, -701, -702, 1015, -37, -34, -33,
+    1017, 1024, 1018, 1021, 1019, 1020, -703, -704, -705, -706, 1022, 1023, -127, -250, -707, -708,
+    1025, 1027, -93, 1026, -709, -710, 1028, 1029, -711, -712, -713, -714, 1031, 1054, 1032, 1040,
+    -103, 1033, 1034, 1037, 1035, 1036, -715, -716, -11, -717, 1038, 1039, -718, -109, -719, -720,
+    1041, 1047, 1042, 1045, 1043, 1044, -18, -17, -64, -19, 1046, -183, -20, -21, 1048, 1051,
+    1049, 1050, -721, -722, -632, -24, 1052, 1053, -723, -724, -725, -542, 1055, 1064, 1056, 1062,
+    1057, 1059, 1058, -77, -726, -727, 1060, 1061, -728, -729, -730, -731, 1063, -85, -87, -36,
+    1065, 1071, 1066, 1069, 1067, 1068, -732, -733, -734, -735, -127, 1070, -736, -129, 1072, 1075,
+    1073, 1074, -737, -738, -45, -739, 1076, 1077, -740, -741, -742, -743, 1079, 1101, 1080, 1095,
+    1081, 1088, 1082, 1085, 1083, 1084, -744, -745, -3, -746, 1086, 1087, -330, -747, -748, -87,
+    1089, 1092, 1090, 1091, -749, -750, -141, -11, 1093, 1094, -391, -751, -752, -753, 1096, 1097,
+    -17, -64, 1098, -632, 1099, 1100, -754, -755, -756, -76, 1102, 1115, 1103, 1109, 1104, 1106,
+    1105, -116, -757, -758, 1107, 1108, -759, -760, -761, -762, 1110, 1113, 1111, 1112, -77, -763,
+    -764, -765, 1114, -250, -766, -38, 1116, 1120, 1117, -129, 1118, 1119, -767, -768, -127, -769,
+    1121, 1124, 1122, 1123, -770, -45, -771, -772, 1125, 1126, -773, -774, -775, -776, 1128, 1153,
+    1129, 1141, 1130, 1136, 1131, 1134, 1132, 1133, -777, -778, -748, -779, -11, 1135, -780, -781,
+    1137, 1139, 1138, -18, -62, -108, -109, 1140, -782, -783, 1142, 1147, 1143, 1145, -68, 1144,
+    -21, -20, -17, 1146, -64, -19, 1148, 1151, 1149, 1150, -784, -785, -786, -787, -632, 1152,
+    -27, -3, 1154, 1165, 1155, 1162, 1156, 1159, 1157, 1158, -788, -789, -790, -791, 1160, 1161,
+    -792, -793, -794, -33, 1163, 1164, -87, -35, -85, -37, 1166, 1173, 1167, 1170, 1168, 1169,
+    -795, -796, -797, -798, 1171, 1172, -799, -88, -800, -801, 1174, 1176, 1175, -45, -93, -802,
+    1177, 1178, -803, -804, -805, -806, 1180, 1206, 1181, 1195, 1182, 1189, 1183, 1186, 1184, 1185,
+    -807, -808, -809, -810, 1187, 1188, -811, -812, -813, -6, 1190, 1192, 1191, -11, -814, -815,
+    1193, 1194, -816, -817, -818, -819, 1196, 1199, 1197, -183, -17, 1198, -19, -64, 1200, 1203,
+    1201, 1202, -820, -821, -632, -3, 1204, 1205, -822, -155, -823, -27, 1207, 1217, 1208, 1214,
+    1209, 1211, 1210, -77, -824, -825, 1212, 1213, -826, -827, -828, -829, 1215, 1216, -36, -87,
+    -33, -38, 1218, 1224, 1219, 1222, 1220, 1221, -830, -123, -831, -832, -374, 1223, -833, -834,
+    1225, 1227, -93, 1226, -835, -836, 1228, 1229, -837, -838, -839, -840, 1231, 1249, 1232, 1240,
+    -103, 1233, 1234, 1237, 1235, 1236, -841, -842, -843, -844, 1238, 1239, -18, -64, -845, -846,
+    1241, 1244, 1242, -19, -68, 1243, -20, -21, 1245, 1248, 1246, 1247, -847, -848, -849, -850,
+    -73, -74, 1250, 1261, 1251, 1257, 1252, 1254, 1253, -76, -851, -277, 1255, 1256, -852, -853,
+    -33, -34, 1258, 1260, 1259, -37, -36, -311, -374, -250, 1262, 1268, 1263, 1266, 1264, 1265,
+    -854, -855, -856, -857, 1267, -129, -858, -859, 1269, 1271, -93, 1270, -860, -861, 1272, 1273,
+    -862, -863, -864, -865, 1275, 1304, 1276, 1291, 1277, 1284, 1278, 1281, 1279, 1280, -866, -867,
+    -868, -869, 1282, 1283, -328, -870, -871, -84, 1285, 1288, 1286, 1287, -872, -873, -141, -11,
+    1289, 1290, -874, -875, -62, -876, 1292, 1297, 1293, 1295, -68, 1294, -21, -20, -17, 1296,
+    -64, -19, 1298, 1301, 1299, 1300, -877, -3, -67, -394, 1302, 1303, -878, -27, -73, -74,
+    1305, 1317, 1306, 1313, 1307, 1310, 1308, 1309, -879, -880, -601, -542, 1311, 1312, -881, -882,
+    -33, -34, 1314, 1316, 1315, -38, -883, -37, -88, -84, 1318, 1322, 1319, -129, 1320, 1321,
+    -884, -885, -886, -887, 1323, 1326, 1324, 1325, -888, -889, -890, -891, 1327, 1328, -892, -893,
+    -894, -895, 1330, 1350, 1331, 1339, -103, 1332, 1333, 1336, 1334, 1335, -896, -897, -898, -899,
+    1337, 1338, -900, -238, -901, -902, 1340, 1344, 1341, 1343, 1342, -21, -68, -183, -64, -19,
+    1345, 1348, 1346, 1347, -903, -904, -632, -27, 1349, -907, -905, -906, 1351, 1361, 1352, 1358,
+    1353, 1355, 1354, -76, -908, -909, 1356, 1357, -910, -911, -912, -913, 1359, -38, -87, 1360,
+    -37, -85, 1362, 1369, 1363, 1366, 1364, 1365, -914, -915, -916, -917, 1367, 1368, -127, -34,
+    -918, -129, 1370, 1372, -93, 1371, -919, -920, 1373, 1374, -921, -922, -923, -924, 1376, 1398,
+    1377, 1385, -103, 1378, 1379, 1382, 1380, 1381, -925, -926, -927, -928, 1383, 1384, -62, -108,
+    -109, -929, 1386, 1391, 1387, 1389, 1388, -64, -18, -17, -20, 1390, -68, -183, 1392, 1395,
+    1393, 1394, -930, -206, -931, -932, 1396, 1397, -933, -934, -27, -277, 1399, 1411, 1400, 1407,
+    1401, 1404, 1402, 1403, -935, -77, -936, -937, 1405, 1406, -938, -939, -34, -33, 1408, -38,
+    1409, 1410, -940, -36, -37, -85, 1412, 1419, 1413, 1416, 1414, 1415, -941, -942, -943, -944,
+    1417, 1418, -250, -127, -129, -945, 1420, 1422, -93, 1421, -946, -45, 1423, 1424, -947, -948,
+    -949, -950, 1426, 1448, 1427, 1440, 1428, 1434, 1429, 1432, 1430, 1431, -951, -952, -621, -953,
+    -11, 1433, -954, -955, 1435, 1437, -62, 1436, -658, -109, 1438, 1439, -956, -957, -958, -959,
+    1441, 1444, -21, 1442, 1443, -64, -17, -18, 1445, -539, 1446, 1447, -960, -961, -632, -962,
+    1449, 1461, 1450, 1457, 1451, 1454, 1452, 1453, -963, -964, -965, -483, 1455, 1456, -966, -84,
+    -967, -968, 1458, -38, 1459, 1460, -87, -35, -85, -37, 1462, 1468, 1463, 1466, 1464, 1465,
+    -969, -970, -971, -972, -250, 1467, -129, -973, 1469, 1471, 1470, -45, -974, -975, 1472, 1473,
+    -976, -977, -978, -979, 1475, 1496, 1476, 1484, -103, 1477, 1478, 1481, 1479, 1480, -980, -981,
+    -982, -983, 1482, 1483, -62, -108, -984, -985, 1485, 1490, 1486, 1488, 1487, -64, -18, -17,
+    1489, -21, -68, -183, 1491, 1494, 1492, 1493, -986, -987, -988, -989, 1495, -74, -990, -991,
+    1497, 1510, 1498, 1504, 1499, 1501, 1500, -76, -992, -993, 1502, 1503, -994, -84, -995, -996,
+    1505, 1508, 1506, 1507, -997, -277, -38, -77, 1509, -84, -998, -88, 1511, 1515, 1512, -129,
+    1513, 1514, -999, -1000, -1001, -1002, 1516, 1519, 1517, 1518, -93, -45, -1003, -1004, 1520, 1521,
+    -1005, -1006, -1007, -1008, 1523, 1546, 1524, 1537, 1525, 1532, 1526, 1529, 1527, 1528, -1009, -1010,
+    -1011, -1012, 1530, 1531, -331, -11, -1013, -1014, 1533, 1534, -109, -108, 1535, 1536, -1015, -1016,
+    -632, -1017, 1538, 1540, -68, 1539, -21, -20, 1541, 1544, 1542, 1543, -1018, -1019, -1020, -1021,
+    1545, -75, -73, -74, 1547, 1560, 1548, 1554, 1549, 1551, -72, 1550, -1022, -1023, 1552, 1553,
+    -1024, -1025, -1026, -1027, 1555, 1558, 1556, 1557, -1028, -1029, -1030, -38, 1559, -88, -34, -250,
+    1561, 1568, 1562, 1565, 1563, 1564, -1031, -1032, -1033, -432, 1566, 1567, -1034, -1035, -1036, -1037,
+    1569, 1572, 1570, 1571, -1038, -1039, -1040, -1041, 1573, 1574, -1042, -1043, -1044, -1045, 1576, 1593,
+    1577, 1585, -103, 1578, 1579, 1582, 1580, 1581, -1046, -1047, -1048, -1049, 1583, 1584, -1050, -63,
+    -1051, -67, 1586, 1588, 1587, -19, -68, -20, 1589, 1591, 1590, -27, -394, -1052, 1592, -397,
+    -1053, -339, 1594, 1606, 1595, 1601, 1596, 1599, 1597, 1598, -1054, -1055, -1056, -1057, 1600, -34,
+    -1058, -1059, 1602, 1604, -36, 1603, -35, -87, -38, 1605, -374, -250, 1607, 1613, 1608, 1611,
+    1609, 1610, -1060, -1061, -1062, -1063, -93, 1612, -1064, -1065, 1614, 1617, 1615, 1616, -1066, -1067,
+    -1068, -1069, 1618, 1619, -1070, -1071, -1072, -1073, 1621, 1636, -103, 1622, 1623, 1630, 1624, 1627,
+    1625, 1626, -1074, -1075, -3, -1076, 1628, 1629, -1077, -1078, -1079, -1080, 1631, 1634, 1632, 1633,
+    -144, -108, -17, -18, 1635, -67, -109, -1081, 1637, 1648, 1638, 1642, 1639, 1641, 1640, -29,
+    -183, -1082, -19, -432, 1643, 1646, 1644, 1645, -1083, -394, -1084, -1085, 1647, -36, -1086, -1087,
+    1649, 1656, 1650, 1653, 1651, 1652, -1088, -1089, -1090, -34, 1654, 1655, -513, -85, -1091, -1092,
+    1657, 1660, 1658, 1659, -1093, -1094, -93, -1095, 1661, 1662, -1096, -1097, -1098, -1099, 1664, 1687,
+    1665, 1679, 1666, 1673, 1667, 1670, 1668, 1669, -1100, -1101, -1102, -1103, 1671, 1672, -1104, -141,
+    -1105, -1106, 1674, 1676, 1675, -64, -1107, -62, 1677, 1678, -1108, -1109, -1110, -1111, 1680, 1682,
+    -19, 1681, -21, -68, 1683, 1685, 1684, -394, -363, -539, -73, 1686, -74, -1112, 1688, 1700,
+    1689, 1695, 1690, 1692, -20, 1691, -1113, -277, 1693, 1694, -1114, -1115, -1116, -483, 1696, 1699,
+    1697, 1698, -1117, -1118, -1119, -216, -33, -35, 1701, 1708, 1702, 1705, 1703, 1704, -1120, -1121,
+    -1122, -1123, 1706, 1707, -127, -250, -1124, -129, 1709, 1712, 1710, 1711, -1125, -1126, -1127, -260,
+    1713, 1714, -1128, -1129, -1130, -1131, 1716, 1737, 1717, 1725, -103, 1718, 1719, 1722, 1720, 1721,
+    -1132, -1133, -11, -1134, 1723, 1724, -1135, -18, -109, -1136, 1726, 1731, 1727, 1730, 1728, 1729,
+    -183, -68, -21, -20, -17, -64, 1732, 1735, 1733, 1734, -1137, -1138, -1139, -1140, 1736, -75,
+    -73, -74, 1738, 1748, 1739, 1745, 1740, 1743, 1741, 1742, -1141, -1142, -1143, -1144, 1744, -512,
+    -1145, -1146, -38, 1746, 1747, -85, -87, -35, 1749, 1756, 1750, 1753, 1751, 1752, -1147, -432,
+    -250, -1148, 1754, 1755, -1149, -1150, -1151, -1152, 1757, 1759, -93, 1758, -1153, -1154, 1760, 1761,
+    -1155, -1156, -1157, -1158, 1763, 1788, 1764, 1776, 1765, 1771, 1766, 1769, 1767, 1768, -1159, -1160,
+    -1161, -1162, -11, 1770, -1163, -1164, 1772, 1773, -108, -62, 1774, 1775, -1165, -1166, -1167, -1168,
+    1777, 1782, 1778, 1780, 1779, -19, -1169, -17, -183, 1781, -21, -20, 1783, 1786, 1784, 1785,
+    -1170, -1171, -1172, -394, 1787, -27, -1173, -26, 1789, 1800, 1790, 1797, 1791, 1794, 1792, 1793,
+    -1174, -1175, -1176, -1177, 1795, 1796, -1178, -1179, -34, -33, 1798, -250, 1799, -38, -37, -372,
+    1801, 1807, 1802, 1805, 1803, 1804, -1180, -1181, -1182, -1183, -127, 1806, -129, -1184, 1808, 1811,
+    1809, 1810, -1185, -1186, -1187, -1188, 1812, 1813, -1189, -1190, -1191, -1192, 1815, 1831, -103, 1816,
+    1817, 1824, 1818, 1821, 1819, 1820, -1193, -1194, -1195, -1196, 1822, 1823, -1197, -141, -1198, -1199,
+    1825, 1828, 1826, 1827, -1200, -62, -18, -64, 1829, 1830, -1201, -1202, -1203, -1204, 1832, 1843,
+    1833, 1837, 1834, 1836, 1835, -20, -68, -183, -432, -479, 1838, 1841, 1839, 1840, -1205, -1206,
+    -77, -1207, 1842, -36, -1208, -1209, 1844, 1851, 1845, 1848, 1846, 1847, -1210, -1211, -1212, -1213,
+    1849, 1850, -330, -37, -1214, -88, 1852, 1855, 1853, 1854, -1215, -1216, -93, -1217, 1856, 1857,
+    -1218, -1219, -1220, -1221, 1859, 1877, 1860, 1868, -103, 1861, 1862, 1865, 1863, 1864, -1222, -1223,
+    -1224, -1225, 1866, 1867, -1226, -63, -1227, -67, 1869, 1871, 1870, -20, -183, -68, 1872, 1875,
+    1873, 1874, -1228, -1229, -1230, -75, 1876, -72, -154, -1231, 1878, 1887, 1879, 1885, 1880, 1882,
+    1881, -76, -1232, -1233, 1883, 1884, -1234, -1235, -1236, -216, -35, 1886, -38, -33, 1888, 1895,
+    1889, 1892, 1890, 1891, -1237, -1238, -1239, -250, 1893, 1894, -1240, -1241, -1242, -1243, 1896, 1899,
+    1897, 1898, -1244, -1245, -1246, -1247, 1900, 1901, -1248, -1249, -1250, -1251, 1903, 1923, 1904, 1912,
+    -103, 1905, 1906, 1909, 1907, 1908, -1252, -1253, -1254, -1255, 1910, 1911, -10, -238, -1256, -1257,
+    1913, 1917, 1914, 1916, 1915, -17, -64, -18, -20, -68, 1918, 1921, 1919, 1920, -1258, -1259,
+    -1260, -27, 1922, -397, -1261, -339, 1924, 1937, 1925, 1932, 1926, 1929, 1927, 1928, -29, -1262,
+    -1263, -1264, 1930, 1931, -1265, -1266, -1267, -123, 1933, 1935, -38, 1934, -1268, -36, -37, 1936,
+    -88, -250, 1938, 1944, 1939, 1942, 1940, 1941, -1269, -1270, -1271, -1272, -127, 1943, -1273, -1274,
+    1945, 1947, 1946, -45, -93, -1275, 1948, 1949, -1276, -1277, -1278, -1279, 1951, 1966, -103, 1952,
+    1953, 1960, 1954, 1957, 1955, 1956, -1280, -1281, -1282, -1283, 1958, 1959, -109, -1284, -1285, -1286,
+    1961, 1963, 1962, -21, -64, -18, 1964, 1965, -1287, -1288, -149, -539, 1967, 1978, 1968, 1973,
+    1969, 1971, 1970, -20, -183, -29, 1972, -19, -479, -432, 1974, 1977, 1975, 1976, -1289, -1290,
+    -1291, -1292, -277, -36, 1979, 1985, 1980, 1983, 1981, 1982, -1293, -76, -1294, -1295, 1984, -33,
+    -37, -940, 1986, 1989, 1987, 1988, -1296, -1297, -1298, -1299, 1990, 1991, -1300, -1301, -1302, -1303,
+    1993, 2012, 1994, 2002, -103, 1995, 1996, 1999, 1997, 1998, -1304, -1305, -1306, -1307, 2000, 2001,
+    -1308, -62, -1309, -1310, 2003, 2005, 2004, -21, -183, -68, 2006, 2009, 2007, 2008, -1311, -394,
+    -1312, -1313, 2010, 2011, -1314, -73, -1315, -1316, 2013, 2026, 2014, 2021, 2015, 2018, 2016, 2017,
+    -1317, -1318, -20, -1319, 2019, 2020, -1320, -1321, -1322, -1323, 2022, 2025, 2023, 2024, -38, -33,
+    -1324, -85, -250, -88, 2027, 2031, 2028, -129, 2029, 2030, -1325, -1326, -1327, -1328, 2032, 2035,
+    2033, 2034, -1329, -1330, -1331, -1332, 2036, 2037, -1333, -1334, -1335, -1336, 2039, 2056, 2040, 2048,
+    -103, 2041, 2042, 2045, 2043, 2044, -1337, -1338, -1339, -1340, 2046, 2047, -1341, -17, -1342, -1343,
+    -20, 2049, 2050, 2053, 2051, 2052, -539, -206, -394, -109, 2054, 2055, -73, -1344, -1345, -27,
+    2057, 2070, 2058, 2065, 2059, 2062, 2060, 2061, -1346, -1347, -1348, -1349, 2063, 2064, -1350, -1351,
+    -1352, -34, 2066, 2068, 2067, -85, -1353, -36, -88, 2069, -127, -37, 2071, 2075, 2072, -129,
+    2073, 2074, -1354, -1355, -1356, -1357, 2076, 2079, 2077, 2078, -1358, -1359, -1360, -1361, 2080, 2081,
+    -1362, -1363, -1364, -1365, 2083, 2101, 2084, 2092, -103, 2085, 2086, 2089, 2087, 2088, -1366, -1367,
+    -1368, -1369, 2090, 2091, -17, -64, -1370, -1171, 2093, 2095, 2094, -19, -21, -183, 2096, 2099,
+    2097, 2098, -1371, -1372, -1373, -27, 2100, -75, -73, -74, 2102, 2116, 2103, 2110, 2104, 2107,
+    2105, 2106, -1374, -77, -1375, -1376, 2108, 2109, -1377, -1378, -1379, -123, 2111, 2114, 2112, 2113,
+    -87, -35, -37, -85, 2115, -84, -1380, -88, 2117, 2123, 2118, 2121, 2119, 2120, -1381, -1382,
+    -1383, -1384, -127, 2122, -1385, -1386, 2124, 2126, -93, 2125, -1387, -45, 2127, 2128, -1388, -1389,
+    -1390, -1391, 2130, 2147, 2131, 2139, -103, 2132, 2133, 2136, 2134, 2135, -1392, -1393, -1394, -1395,
+    2137, 2138, -144, -17, -1396, -1397, 2140, 2142, 2141, -19, -68, -183, 2143, 2145, 2144, -394,
+    -539, -206, 2146, -397, -1398, -1399, 2148, 2160, 2149, 2156, 2150, 2153, 2151, 2152, -1400, -1401,
+    -1402, -1403, 2154, 2155, -1404, -1405, -34, -33, 2157, -38, 2158, 2159, -35, -87, -85, -37,
+    2161, 2167, 2162, 2165, 2163, 2164, -1406, -1407, -1408, -1409, -127, 2166, -129, -1410, 2168, 2171,
+    2169, 2170, -1411, -1412, -1413, -1414, 2172, 2173, -1415, -1416, -1417, -1418, 2175, 2197, 2176, 2188,
+    2177, 2184, 2178, 2181, 2179, 2180, -1419, -1420, -1421, -1422, 2182, 2183, -331, -238, -1423, -1424,
+    2185, 2186, -64, -17, -630, 2187, -632, -1425, 2189, 2191, -19, 2190, -21, -20, 2192, 2195,
+    2193, 2194, -206, -207, -109, -273, 2196, -277, -1426, -339, 2198, 2208, 2199, 2205, 2200, 2203,
+    2201, 2202, -1427, -1428, -1429, -1430, 2204, -35, -1431, -1432, 2206, -37, -85, 2207, -84, -36,
+    2209, 2215, 2210, 2213, 2211, 2212, -1433, -1434, -1435, -1436, -127, 2214, -1437, -1438, 2216, 2218,
+    -93, 2217, -1439, -1440, 2219, 2220, -1441, -1442, -1443, -1444, 2222, 2235, -103, 2223, 2224, 2231,
+    2225, 2228, 2226, 2227, -1445, -1446, -1447, -1448, 2229, 2230, -1449, -1284, -1450, -1451, 2232, 2233,
+    -64, -17, 2234, -67, -1452, -501, 2236, 2245, 2237, 2244, 2238, 2241, 2239, 2240, -1453, -21,
+    -1454, -1455, 2242, 2243, -74, -27, -1456, -1457, -36, -87, 2246, 2252, 2247, 2250, 2248, 2249,
+    -1458, -1459, -33, -34, 2251, -250, -1460, -37, 2253, 2256, 2254, 2255, -1461, -1462, -1463, -1464,
+    2257, 2258, -1465, -1466, -1467, -1468, 2260, 2279, 2261, 2269, -103, 2262, 2263, 2266, 2264, 2265,
+    -1469, -1470, -1471, -1472, 2267, 2268, -144, -62, -109, -1473, 2270, 2273, 2271, 2272, -64, -17,
+    -183, -21, 2274, 2277, 2275, 2276, -1474, -724, -632, -1475, 2278, -907, -154, -155, 2280, 2292,
+    2281, 2287, 2282, 2284, 2283, -277, -1476, -1477, 2285, 2286, -1478, -1479, -1480, -1481, 2288, 2290,
+    2289, -38, -1482, -644, 2291, -88, -1483, -33, 2293, 2299, 2294, 2297, 2295, 2296, -1484, -1485,
+    -1486, -1487, -93, 2298, -1488, -1489, 2300, 2303, 2301, 2302, -1490, -1491, -1492, -1493, 2304, 2305,
+    -1494, -1495, -1496, -1497, 2307, 2320, -103, 2308, 2309, 2315, 2310, 2313, 2311, 2312, -1498, -1499,
+    -1500, -1501, -11, 2314, -780, -1502, 2316, 2317, -18, -64, 2318, 2319, -499, -1503, -3, -24,
+    2321, 2334, 2322, 2328, 2323, 2326, 2324, 2325, -1504, -1505, -1506, -1507, -1508, 2327, -1509, -1510,
+    2329, 2332, 2330, 2331, -1511, -1512, -1513, -542, 2333, -37, -36, -1514, 2335, 2342, 2336, 2339,
+    2337, 2338, -1515, -123, -1516, -1517, 2340, 2341, -1518, -38, -1519, -88, 2343, 2345, 2344, -129,
+    -1520, -1521, 2346, 2347, -1522, -1523, -1524, -1525,
+};
+
+static const int32_t voltage_fx_leaf_value[1525] = {
+    5147596, 5155948, 5282529, 5170129, 5357568, 5313802, 5282540, 5241291,
+    5151252, 5182525, 18629550, 10037445, 5215164, 5334594, 7095480, 5482397,
+    13190717, 14015939, 16066437, 19173417, 18960876, 6556283, 6024390, 5263770,
+    9601043, 13001086, 5182505, 12950493, 21230182, 16573319, 18717396, 19438991,
+    12890644, 15672566, 5338808, 5526364, 6607872, 9471058, 21070254, 20114706,
+    18024714, 19567899, 20542965, 20893140, 18917130, 21538584, 21280055, 21420709,
+    21563601, 21705291, 21951263, 22238239, 22121035, 5146716, 5150436, 5159474,
+    5171185, 6162440, 5223179, 5385543, 7914441, 10102456, 13603328, 14928650,
+    5785790, 5372551, 7745659, 21180170, 9783632, 6691482, 12398858, 10477568,
+    15653806, 14109696, 9239757, 6107750, 5707653, 14197221, 17995302, 18957897,
+    18019090, 19579547, 19951198, 5270036, 6001459, 11951661, 5245051, 20267459,
+    20440246, 19897478, 18842092, 18410742, 18417009, 20909672, 21216826, 20822272,
+    21325563, 21454407, 21834506, 21702621, 21978705, 22161667, 20580024, 5154613,
+    5279420, 11909161, 5310112, 8408310, 6982943, 5612380, 6204631, 5763118,
+    7467459, 6197357, 20008018, 16585318, 13401974, 9077207, 17227958, 18666053,
+    19381113, 19974653, 17135452, 20950120, 20418810, 14555641, 12252979, 19293631,
+    16353976, 20917084, 21205860, 21396117, 21665289, 21863677, 22042102, 22138927,
+    5148549, 5156801, 5166943, 6765711, 19148431, 3455003, 5276254, 7895695,
+    5994645, 6929818, 5791000, 5375050, 8358298, 6679757, 10002432, 8883425,
+    10990182, 11471544, 11946680, 13196984, 13815890, 16377216, 18701331, 19381422,
+    21380219, 20926366, 19948812, 20455354, 19428894, 21125830, 20870859, 21319347,
+    21462589, 21697485, 22020931, 5150146, 5167489, 5300606, 5207078, 6199850,
+    5248588, 5999968, 6800616, 8154085, 5993656, 5449236, 20286218, 9034235,
+    13313185, 15660087, 16488407, 13912760, 17145023, 18197684, 18903850, 19793053,
+    15590263, 20502278, 19540643, 20914215, 21212786, 21490264, 21867834, 22101606,
+    5158585, 5058670, 10120185, 5295701, 6231519, 9483551, 10496328, 13038606,
+    6438031, 8919151, 14413757, 16738183, 18812891, 16001823, 19644986, 16404009,
+    20788830, 20258641, 20682462, 20980299, 19108830, 20167414, 19100508, 20221485,
+    21415227, 20996452, 21249470, 21418964, 21580783, 21746980, 22017876, 22153531,
+    5150214, 5174016, 5342560, 5282540, 6709137, 18888991, 5249305, 6123863,
+    6096478, 6832148, 15139103, 9204651, 17684521, 12685248, 15783269, 18825375,
+    20009806, 13997179, 20968199, 20324780, 20769919, 20965142, 19142170, 20150238,
+    21137724, 20780070, 21392940, 20973855, 21534956, 21708239, 21915577, 22092004,
+    5153950, 5285670, 9299144, 5334396, 5828914, 9668608, 11660354, 6578695,
+    8527094, 19996123, 16789518, 14149158, 7964426, 12653097, 18479052, 20179234,
+    19209419, 20026164, 20603373, 19475067, 20023639, 20972854, 21197675, 21390771,
+    21585834, 21751149, 21968233, 22152469, 5149862, 5170011, 5343498, 5256499,
+    7362513, 5218739, 5389632, 5695903, 9710701, 7638680, 14495724, 12749981,
+    15263102, 16608486, 18694323, 16590652, 19306397, 19916465, 5276303, 13817952,
+    20151492, 18626417, 20782200, 21350102, 21054695, 21386244, 21548756, 21735513,
+    21874613, 21999712, 22121030, 5146172, 5150262, 5158787, 5171517, 5351301,
+    5223364, 5307556, 5188772, 6878759, 5255810, 5756027, 7067976, 10331696,
+    6214018, 11801324, 15788237, 13100428, 18330390, 19650351, 15965143, 6100247,
+    12689029, 20336302, 18975883, 20844209, 21387299, 21142350, 21402101, 21551827,
+    21872853, 21723274, 21983329, 22177739, 5154169, 5260128, 7458065, 5562347,
+    6951697, 5808113, 8358298, 9742991, 7358054, 11110523, 12179218, 16538192,
+    18235232, 19007518, 19937833, 5297545, 6203597, 12252979, 20190382, 20559096,
+    19689178, 20775830, 21036150, 19844137, 20630610, 21267180, 20763402, 21422252,
+    21566407, 21753438, 21897847, 22027248, 22122367, 5154319, 4740212, 5298058,
+    5697040, 6376571, 10923123, 13817965, 7964426, 18296340, 15309567, 18736188,
+    19602719, 5264841, 20228877, 17813719, 20806930, 21462275, 21325881, 21377096,
+    21573181, 21767819, 21903559, 22003289, 22146654, 5150289, 5170011, 5299693,
+    8983446, 5618565, 6419797, 9208484, 8764648, 10866719, 12334254, 9056379,
+    19581850, 15784606, 18630427, 19394369, 5301305, 19962624, 20607818, 17660559,
+    19911115, 20873010, 21181670, 21417733, 21596529, 21767504, 22044966, 5148463,
+    5164158, 7170769, 5286611, 6962637, 5855596, 7559801, 9759330, 19022607,
+    15220846, 18700899, 19607148, 13303940, 21226613, 20427741, 19560135, 20949924,
+    20551723, 21323957, 20863844, 21412641, 21631169, 21697659, 21908992, 22016890,
+    22157819, 5148336, 5178361, 5160133, 5171852, 5266293, 18975471, 6751366,
+    5251015, 6053747, 5482578, 8141578, 20522209, 19210925, 16891617, 10185523,
+    15711531, 17708171, 18035671, 18696006, 19534689, 20558925, 20914713, 20043527,
+    21184998, 21403290, 21654974, 22041751, 5148266, 5163972, 5219292, 5313799,
+    6678709, 5315940, 6282772, 5732639, 6670377, 7300538, 10881826, 13904445,
+    17286194, 18797329, 18598298, 20542519, 19312155, 21031700, 19916635, 12890644,
+    5280983, 20301778, 20650153, 19550607, 21012709, 20627359, 21283648, 21392032,
+    21511516, 21597139, 21710416, 21849088, 21961613, 22093286, 5146731, 5149519,
+    5155541, 5195039, 5163360, 5172590, 5259104, 8431220, 5229852, 5662821,
+    5947535, 6922945, 8933417, 11553322, 7268946, 15197471, 17777550, 15779758,
+    18775082, 19584393, 21465648, 20083927, 20548339, 20887496, 18927537, 19851378,
+    20929117, 21253546, 21386474, 21584874, 21726140, 21975501, 22161663, 5147951,
+    5155922, 5170118, 8054473, 5315172, 6108987, 7061115, 10961010, 7278027,
+    12603083, 13624156, 18326333, 16747848, 18762362, 15097434, 19612181, 13889642,
+    20444428, 19516820, 20959569, 20388966, 21230182, 20883220, 21406772, 21609961,
+    22020375, 21849081, 22148874, 21991834, 5148509, 5155912, 5190568, 5167247,
+    6244442, 5276275, 6351544, 6035397, 7858168, 11387156, 14932127, 17436640,
+    6836040, 18841320, 17032464, 19514078, 5257544, 19919686, 20378411, 18924622,
+    20839521, 20134247, 21195664, 20826341, 21374811, 21540832, 21730698, 21902040,
+    22011623, 22134566, 5147978, 5155789, 5253366, 5166767, 6120978, 5237096,
+    5721190, 5950210, 5538857, 5326305, 6345291, 7189258, 6124943, 5532590,
+    19618537, 9561710, 14861663, 20004878, 5807677, 16012369, 18327173, 19599433,
+    18844779, 20813414, 19702185, 6405734, 13691535, 20531464, 19749535, 20922061,
+    20221905, 21134486, 21391620, 21682130, 22041841, 5153860, 4654256, 12048261,
+    5264805, 8152003, 5494579, 5920211, 5896081, 5353376, 8881848, 11345746,
+    9134524, 16168258, 18827324, 17226081, 19541291, 5261708, 20046976, 20482680,
+    20492505, 20815045, 19686471, 21036118, 20656781, 21528379, 21336201, 21640999,
+    21728436, 21944780, 22097391, 5148668, 5160635, 5170627, 5189664, 5279867,
+    5246082, 5223660, 5348723, 5489764, 6149407, 7189258, 6041068, 20758200,
+    10545959, 15872972, 8317034, 18096951, 18675637, 19325738, 21076394, 19938601,
+    20753495, 19840261, 20567532, 19892361, 21062277, 21409976, 21645906, 21837278,
+    22134229, 21967866, 5150485, 5167210, 5293339, 8203264, 5411744, 5779988,
+    6626614, 6139003, 8604706, 11674726, 11385595, 15437966, 17603879, 18737640,
+    11934167, 20103864, 19280118, 20421457, 19900054, 20350632, 20664939, 19415772,
+    21253976, 20943152, 20123648, 21391917, 21692298, 22022463, 22156974, 5147828,
+    5157072, 5169126, 5277181, 5238784, 5179392, 11293999, 5251041, 6090244,
+    5564931, 5832663, 5913928, 6007726, 20882186, 19126186, 8482362, 14418518,
+    12721848, 14231321, 17248258, 19047047, 14559797, 5487278, 20056045, 20681567,
+    19921933, 21037497, 21223601, 21404363, 21547227, 21742465, 22014127, 22153851,
+    5147989, 5156976, 5167681, 7602900, 5298034, 5913458, 5482016, 8911544,
+    6195268, 10691363, 8896969, 5974385, 17554268, 14732766, 17840019, 18591546,
+    19426508, 16257720, 21168561, 20035873, 21081399, 20539429, 13125079, 18243207,
+    19576491, 20928832, 21264915, 21465630, 21818663, 22104580, 5146388, 5150913,
+    5158876, 5171482, 5212211, 5241917, 5277850, 5180443, 10274725, 4319799,
+    5246597, 7069579, 5596838, 6606295, 6160261, 9855529, 7989463, 13176655,
+    17122930, 18773177, 16092989, 19764214, 19321133, 19986055, 20991242, 20412629,
+    18964003, 19837972, 20917234, 21227745, 21442191, 21701859, 22002695, 22142902,
+    5154554, 5300405, 13015684, 5338955, 6690174, 5724310, 9546076, 6767278,
+    12020905, 9899295, 17797523, 18877193, 19663505, 20143718, 20535050, 21227918,
+    20869917, 19527191, 20167985, 21020907, 21319939, 21595693, 21729681, 21950671,
+    22119984, 5146851, 5150711, 5159917, 5171938, 5204393, 5326307, 12821873,
+    5170639, 5223478, 5443039, 5669930, 6009272, 8700458, 15135606, 17604781,
+    18622810, 19550487, 5401327, 20242957, 18868891, 20786881, 20064146, 21373278,
+    20985099, 21287294, 21450058, 21765473, 21889195, 22154098, 22010181, 5153992,
+    12818760, 2956967, 5200489, 5185649, 5255680, 5670633, 7708758, 9511076,
+    11788302, 12334244, 9321021, 15160301, 17997996, 19320863, 20478751, 18821407,
+    19315384, 20809250, 19852656, 21105787, 20526752, 19590472, 20942672, 21258878,
+    21606531, 21421462, 21860842, 22113600, 5153641, 5289686, 14318087, 5321423,
+    5587476, 6584934, 5713887, 6351560, 10703957, 13443293, 15556150, 16996857,
+    18126057, 18551065, 19424456, 5291930, 21398979, 20060377, 21185386, 20546481,
+    19305759, 21019325, 21413670, 21669984, 21964890, 22147721, 5147889, 5156397,
+    5167473, 6317975, 5234676, 5609855, 5824348, 5295049, 5420073, 5983601,
+    6474506, 5267522, 18994407, 14796608, 6400303, 18737438, 19939063, 19288337,
+    20943757, 19978063, 21141773, 20544706, 19231263, 21220406, 20891452, 21384838,
+    21639136, 21867848, 22049914, 5156514, 5040692, 9669031, 5275874, 5659197,
+    5279416, 6676630, 7949872, 6175269, 5351295, 8147818, 10703503, 15345627,
+    18325012, 18935266, 19323012, 19888375, 19448504, 15200594, 19997495, 20539573,
+    19890518, 19043717, 20999257, 20473264, 21283751, 21452246, 21781565, 22066256,
+    5150034, 5170716, 5195337, 5275042, 5224225, 5356780, 5601374, 5298176,
+    6033244, 9324145, 11202734, 5978549, 8844665, 15539068, 17853104, 18823501,
+    15197456, 20630036, 19467650, 17773097, 13223021, 5476344, 20994202, 20169886,
+    18915860, 20542221, 20901075, 19529769, 20385881, 21431864, 21025906, 21372705,
+    21572314, 21729260, 21679600, 21976932, 22141569, 5150354, 5168898, 6019229,
+    5261905, 8644616, 5717263, 9124554, 12479009, 5841019, 18054390, 18566262,
+    15072756, 19359022, 19952103, 20224321, 20537114, 18583282, 19473505, 21238118,
+    20816891, 21258098, 20817579, 21397753, 21556224, 21847303, 21713894, 22002694,
+    22173592, 5148276, 5156730, 5167465, 5239828, 7726886, 5214453, 5387714,
+    5672564, 19088400, 9605458, 13366652, 9995155, 15392734, 17327841, 18340961,
+    18914634, 19727436, 12834379, 19029647, 20489741, 19681059, 20932745, 21359977,
+    21621454, 21731000, 22031999, 5148072, 5155604, 5188780, 5167202, 5928435,
+    4353140, 5260983, 8066567, 6160593, 5685386, 5476332, 5284618, 9920695,
+    13129779, 15843877, 14576988, 16941640, 12714045, 18533059, 19456899, 20887489,
+    20127553, 20804966, 19967386, 19829363, 21314582, 20988760, 21412870, 21643749,
+    21861589, 22015584, 22173641, 5154779, 4887993, 5317599, 9550766, 5606229,
+    8357592, 6081562, 11230863, 12334244, 12792716, 14809866, 17224739, 15866388,
+    17829351, 18949073, 20035080, 19045274, 20562298, 20780685, 19652724, 20307040,
+    20976969, 21327242, 21603191, 21758680, 22127132, 21947720, 5148064, 5156011,
+    5165792, 5176016, 8084480, 5300914, 5537965, 5332555, 5957714, 5695160,
+    14015939, 6337790, 7560192, 5682640, 9603126, 20201800, 17202121, 13477162,
+    15693417, 18597644, 19477215, 20002688, 19398492, 20503367, 19630572, 19332603,
+    20905847, 21186763, 20236180, 20834632, 21389917, 21645411, 21958114, 22142908,
+    5148713, 5179402, 5160036, 5171995, 5354435, 6605305, 5257556, 8100741,
+    5812538, 7176749, 5704520, 5270028, 9200671, 7479329, 13728725, 15244343,
+    17162673, 18720520, 14155544, 19348526, 19988262, 10247813, 20486848, 19287215,
+    20918181, 21312038, 21519577, 21780326, 22075434, 5153682, 5240862, 8968306,
+    5235616, 8327031, 5727163, 9926729, 7744953, 14881751, 12834382, 17207328,
+    18502840, 18964370, 16457487, 19510646, 20952280, 20017207, 18993695, 20846370,
+    19035904, 20017593, 20875752, 21268022, 21494313, 21414259, 21593661, 21656734,
+    21808445, 21997042, 22136087, 5149633, 5174255, 5324227, 5248164, 5267461,
+    5998344, 6690174, 5805317, 8602097, 10696367, 18554511, 15018264, 16164671,
+    18739411, 16852640, 19575927, 5273797, 21132247, 20128858, 20559610, 21045150,
+    18388869, 19632770, 21005262, 21405526, 21635282, 21863148, 22094460, 5150317,
+    5168378, 6352508, 5241564, 9255383, 5382911, 5662989, 6642244, 5877824,
+    10554503, 14432686, 14640508, 17548042, 18077249, 18728577, 19312766, 20103277,
+    20665330, 16328970, 19647131, 20962675, 21337550, 21714054, 22076224, 5156056,
+    4966160, 8542720, 5270147, 7667507, 5535180, 5863936, 6098985, 11396529,
+    8791736, 13958881, 5273149, 10645313, 13356401, 15661782, 17287557, 11831009,
+    18408957, 19002032, 19595104, 5345065, 20230095, 18625377, 20741417, 19693097,
+    21145746, 20750909, 21395406, 21526581, 21721713, 21884805, 22043775, 22202917,
+    5153863, 5289580, 9981602, 5268002, 8199660, 5613114, 6712576, 11136051,
+    9102223, 19859005, 17326727, 13938565, 16008602, 18736316, 16958653, 19607482,
+    5274737, 20424459, 19836787, 20891674, 20160284, 21314296, 21426981, 21520886,
+    21605760, 21892847, 21700440, 21967566, 22137696, 5149654, 5168642, 10508037,
+    5345996, 6038072, 9194424, 11662213, 7946945, 13962296, 16031416, 17375796,
+    20353712, 18736019, 19550224, 14466028, 19979183, 20206493, 20938716, 20488188,
+    18734259, 19737321, 20971077, 21370360, 21590168, 21856476, 22098097, 5153059,
+    4940122, 7022029, 5275807, 6250833, 5723560, 11542405, 15895538, 19946523,
+    17147931, 15625069, 17214920, 18621366, 19426652, 19974479, 20308555, 20500973,
+    20865392, 19877356, 21100883, 20549499, 21298191, 21444497, 21737731, 21893627,
+    22236692, 22075075, 5153673, 5265357, 4705686, 5183758, 7217398, 5308804,
+    5892055, 11276856, 15741351, 14317029, 17261245, 16483191, 18582025, 19541780,
+    19935563, 20292444, 20953195, 20446884, 18497012, 19681559, 21250016, 20902827,
+    21397870, 21685408, 21932437, 22133532, 5153975, 4891648, 7022812, 5246690,
+    6974019, 5386919, 5661929, 6098350, 20890522, 9737953, 14763465, 15781364,
+    18005163, 18819022, 19546158, 5292960, 20196354, 19442666, 20748759, 17635553,
+    21244771, 21429323, 21833051, 22104541, 5154941, 5300679, 15658516, 5290504,
+    5643395, 7607218, 5215846, 17855145, 15064098, 16779990, 18633654, 20093800,
+    19414090, 5370074, 14667334, 20059585, 19120292, 20559018, 19688902, 20974076,
+    20457074, 21281369, 20805079, 21399996, 21579327, 21752194, 21935502, 22241673,
+    22109729, 5148067, 5156302, 5251277, 5169436, 5308887, 5946767, 19794203,
+    16396509, 10691502, 15611790, 21123891, 18110664, 18827996, 18992128, 6958841,
+    18727068, 5315369, 19372334, 21145784, 19900986, 5635748, 13969654, 20399426,
+    20908145, 21244769, 21442231, 21780316, 22027846,
+};
+
+const EPS_ForestFixed eps_voltage_forest_fixed = {
+    .n_features = 5,
+    .n_trees = 50,
+    .n_nodes = 2348,
+    .n_leaves = 1525,
+    .pred_mul = 20,
+    .pred_shift = 12,
+    .quant = voltage_fx_feature,
+    .roots = voltage_fx_roots,
+    .feature = voltage_fx_feature_index,
+    .threshold = voltage_fx_threshold,
+    .children = voltage_fx_children,
+    .leaf_value = voltage_fx_leaf_value,
+};
+
+int64_t eps_model_voltage_score_fixed(const int64_t *x) {
+    return eps_forest_fixed_score(&eps_voltage_forest_fixed, x);
+}
+
+#endif
+
+#if EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_BINNED)
+
+static const uint16_t voltage_bn_split_offset[6] = {
+    0, 357, 503, 673, 896, 1080,
+};
+
+static const double voltage_bn_split[1080] = {
+    627.2899780273438, 628.0549926757812, 1256.8699951171875, 1258.39501953125,
+    1259.9200439453125, 1261.4450073242188, 1262.2100219726562, 1262.9749755859375,
+    1264.5, 1265.2650146484375, 1266.0250244140625, 1269.0799560546875,
+    1275.1849975585938, 1275.9450073242188, 1279.0, 1282.050048828125,
+    1284.3399658203125, 1285.10498046875, 1286.6300048828125, 1288.155029296875,
+    1288.9200439453125, 1296.550048828125, 1299.6050415039062, 1301.1300048828125,
+    1312.5750122070312, 1314.864990234375, 1320.2050170898438, 1331.6549682617188,
+    1332.4149780273438, 1332.4199829101562, 1333.1799926757812, 1333.9450073242188,
+    1336.9949951171875, 1351.5, 1352.260009765625, 1370.5750122070312,
+    1386.5999755859375, 1394.9949951171875, 1406.4400024414062, 1409.4950561523438,
+    1418.6499633789062, 1420.9400024414062, 1423.989990234375, 1425.52001953125,
+    1427.0449829101562, 1430.8599853515625, 1433.9149780273438, 1452.22998046875,
+    1455.2799682617188, 1456.0449829101562, 1465.9649658203125, 1469.0149536132812,
+    1469.7799682617188, 1475.1199951171875, 1495.7250366210938, 1498.780029296875,
+    1509.4600219726562, 1512.5150146484375, 1520.14501953125, 1523.9650268554688,
+    1539.2249755859375, 1567.4600219726562, 1571.2749633789062, 1581.1950073242188,
+    1585.0150146484375, 1588.824951171875, 1592.64501953125, 1620.8800048828125,
+    1630.7999877929688, 1659.0349731445312, 1666.6649780273438, 1723.905029296875,
+    1730.0049438476562, 1752.1400146484375, 1797.9249877929688, 1816.239990234375,
+    1823.1099853515625, 1841.4249877929688, 1849.81494140625, 1878.8150024414062,
+    1909.3450317382812, 1917.7349853515625, 1962.760009765625, 1990.2350463867188,
+    1992.5199584960938, 2013.125, 2062.7249755859375, 2100.1199951171875,
+    2131.4100341796875, 2154.3050537109375, 2168.8050537109375, 2178.7249755859375,
+    2197.0399780273438, 2259.614990234375, 2284.0350341796875, 2293.9549560546875,
+    2295.47998046875, 2312.2698974609375, 2313.7950439453125, 2377.135009765625,
+    2395.449951171875, 2407.659912109375, 2419.1099853515625, 2453.449951171875,
+    2499.2349853515625, 2560.2900390625, 2620.574951171875, 2679.3349609375,
+    2739.625, 2799.909912109375, 2847.219970703125, 2858.669921875,
+    2865.5399169921875, 2896.0599365234375, 2902.929931640625, 2905.97998046875,
+    2912.8499755859375, 2954.0599365234375, 3031.135009765625, 3078.449951171875,
+    3079.2099609375, 3099.054931640625, 3170.784912109375, 3183.7598876953125,
+    3193.6849365234375, 3204.364990234375, 3218.0999755859375, 3308.9149169921875,
+    3321.8900146484375, 3332.5699462890625, 3349.3599853515625, 3351.6500244140625,
+    3363.094970703125, 3415.75, 3419.570068359375, 3431.0150146484375,
+    3431.780029296875, 3433.3050537109375, 3530.97998046875, 3578.294921875,
+    3597.375, 3704.9749755859375, 3736.2650146484375, 3771.364990234375,
+    3824.02001953125, 3851.4949951171875, 3898.0499267578125, 3936.2049560546875,
+    3985.0450439453125, 3995.7249755859375, 4002.594970703125, 4010.22998046875,
+    4079.669921875, 4087.300048828125, 4144.53515625, 4177.35498046875,
+    4243.739990234375, 4252.135009765625, 4262.054931640625, 4272.739990234375,
+    4291.81494140625, 4297.159912109375, 4297.919921875, 4298.68505859375,
+    4303.264892578125, 4304.02490234375, 4423.83984375, 4457.4150390625,
+    4498.6298828125, 4508.544921875, 4524.570068359375, 4527.625,
+    4528.385009765625, 4530.675048828125, 4531.440185546875, 4533.72998046875,
+    4547.465087890625, 4556.625, 4582.570068359375, 4609.280029296875,
+    4638.27490234375, 4639.039794921875, 4663.4599609375, 4667.27490234375,
+    4668.039794921875, 4669.56494140625, 4672.619873046875, 4672.6201171875,
+    4676.43505859375, 4677.2001953125, 4678.72509765625, 4685.594970703125,
+    4688.64501953125, 4689.41015625, 4690.93505859375, 4692.4599609375,
+    4696.27490234375, 4700.090087890625, 4703.905029296875, 4704.670166015625,
+    4708.48486328125, 4709.25, 4731.3798828125, 4734.43505859375,
+    4740.5400390625, 4750.454833984375, 4754.27490234375, 4758.85498046875,
+    4760.3798828125, 4763.429931640625, 4775.639892578125, 4776.39990234375,
+    4777.929931640625, 4780.21484375, 4780.98486328125, 4781.744873046875,
+    4785.559814453125, 4787.090087890625, 4787.849853515625, 4797.77001953125,
+    4822.190185546875, 4822.195068359375, 4824.47998046875, 4825.2451171875,
+    4853.47998046875, 4857.294921875, 4858.059814453125, 4858.824951171875,
+    4863.400146484375, 4864.1650390625, 4864.93017578125, 4877.14013671875,
+    4892.400146484375, 4893.1650390625, 4897.7451171875, 4900.030029296875,
+    4902.320068359375, 4903.0849609375, 4905.369873046875, 4907.659912109375,
+    4914.530029296875, 4916.820068359375, 4925.974853515625, 4931.31494140625,
+    4932.079833984375, 4934.3701171875, 4938.18505859375, 4943.52490234375,
+    4945.81494140625, 4947.344970703125, 4948.869873046875, 4958.02490234375,
+    4971.76513671875, 4976.344970703125, 4979.39501953125, 4980.920166015625,
+    4986.264892578125, 4994.655029296875, 4997.710205078125, 4998.474853515625,
+    4998.47509765625, 4999.235107421875, 4999.239990234375, 5000.764892578125,
+    5008.39501953125, 5014.5, 5038.920166015625, 5040.445068359375,
+    5044.260009765625, 5048.074951171875, 5052.655029296875, 5053.420166015625,
+    5054.945068359375, 5057.235107421875, 5062.5751953125, 5069.445068359375,
+    5070.969970703125, 5072.5, 5073.260009765625, 5075.550048828125,
+    5078.60009765625, 5083.18017578125, 5083.945068359375, 5086.235107421875,
+    5099.969970703125, 5110.655029296875, 5121.3349609375, 5122.85986328125,
+    5125.9150390625, 5127.43994140625, 5127.445068359375, 5132.019775390625,
+    5144.9951171875, 5153.39013671875, 5156.440185546875, 5170.175048828125,
+    5178.574951171875, 5181.625, 5182.385009765625, 5182.39013671875,
+    5183.150146484375, 5184.675048828125, 5197.650146484375, 5204.51513671875,
+    5208.3349609375, 5210.625, 5211.385009765625, 5211.39013671875,
+    5214.440185546875, 5217.489990234375, 5219.02001953125, 5222.8349609375,
+    5226.650146484375, 5228.175048828125, 5254.885009765625, 5256.41015625,
+    5257.175048828125, 5258.699951171875, 5258.7001953125, 5262.51513671875,
+    5264.80517578125, 5266.330078125, 5267.85498046875, 5269.3798828125,
+    5275.489990234375, 5276.2548828125, 5282.35498046875, 5286.93505859375,
+    5288.4599609375, 5289.22509765625, 5289.98486328125, 5290.75,
+    5291.514892578125, 5293.0400390625, 5296.094970703125, 5299.14501953125,
+    5306.014892578125, 5309.829833984375, 5324.330078125, 5326.6201171875,
+    5336.5400390625, 5337.30517578125, 5338.065185546875, 5339.58984375,
+    5340.35498046875, 5341.114990234375, 5342.64501953125, 5343.405029296875,
+    5354.85009765625, 5355.614990234375, 5358.670166015625, 5367.824951171875,
+    5369.35498046875, 5383.090087890625, 5383.85009765625, 5390.719970703125,
+    5408.27001953125, 1256.8699951171875, 1260.6849975585938, 1261.4450073242188,
+    1262.2100219726562, 1266.0250244140625, 1280.5250244140625, 1291.9700317382812,
+    1292.7350463867188, 1295.0249633789062, 1301.8900146484375, 1304.1799926757812,
+    1307.9949951171875, 1311.8150024414062, 1315.6300048828125, 1321.7349853515625,
+    1322.5, 1324.7849731445312, 1350.7349853515625, 1354.5449829101562,
+    1355.3099975585938, 1375.9150390625, 1389.6549682617188, 1403.3849487304688,
+    1404.1549682617188, 1406.4400024414062, 1410.2550048828125, 1419.4150390625,
+    1423.989990234375, 1433.1500244140625, 1452.22998046875, 1455.2799682617188,
+    1469.7799682617188, 1520.1449584960938, 1531.5950317382812, 1550.6699829101562,
+    1585.0150146484375, 1585.7749633789062, 1610.9599609375, 1619.3499755859375,
+    1708.6349487304688, 1823.1099853515625, 1918.5, 1969.6249389648438,
+    1986.4200439453125, 1990.2350463867188, 1992.5199584960938, 2013.125,
+    2036.02001953125, 2091.7300415039062, 2128.35498046875, 2131.4100341796875,
+    2154.3050537109375, 2178.7249755859375, 2228.324951171875, 2259.614990234375,
+    2293.9549560546875, 2377.135009765625, 2545.02490234375, 2622.864990234375,
+    2633.544921875, 2806.780029296875, 2867.06494140625, 2995.2649536132812,
+    3037.239990234375, 3055.554931640625, 3099.054931640625, 3172.3098754882812,
+    3183.760009765625, 3208.9400024414062, 3279.1499633789062, 3321.8850708007812,
+    3704.9749755859375, 3812.5799560546875, 3917.1251220703125, 3974.35986328125,
+    4043.0399169921875, 4072.0399169921875, 4090.349853515625, 4144.53515625,
+    4153.695068359375, 4250.610107421875, 4271.21484375, 4334.554931640625,
+    4350.580078125, 4388.73486328125, 4394.840087890625, 4413.9150390625,
+    4498.6298828125, 4513.125, 4548.22998046875, 4579.51513671875,
+    4657.35498046875, 4668.804931640625, 4685.594970703125, 4697.7998046875,
+    4736.724853515625, 4774.114990234375, 4802.349853515625, 4803.8798828125,
+    4841.27001953125, 4858.824951171875, 4877.14013671875, 4892.39990234375,
+    4911.47998046875, 4916.820068359375, 4921.39501953125, 4927.5,
+    4935.1298828125, 4935.89501953125, 4943.52490234375, 4946.580078125,
+    4949.6298828125, 4960.31494140625, 4962.60986328125, 4967.184814453125,
+    4970.23486328125, 4970.239990234375, 4990.844970703125, 4991.60498046875,
+    4992.3701171875, 5000.0, 5001.525146484375, 5006.10498046875,
+    5006.864990234375, 5023.659912109375, 5070.969970703125, 5075.550048828125,
+    5077.0751953125, 5092.340087890625, 5101.494873046875, 5240.385009765625,
+    5254.885009765625, 5256.41015625, 5257.175048828125, 5258.7001953125,
+    5282.35498046875, 5286.93505859375, 5289.98486328125, 5309.829833984375,
+    5317.4599609375, 5342.64501953125, 5355.614990234375, 5358.670166015625,
+    5368.590087890625, 5379.275146484375, 5402.169921875, 1258.39501953125,
+    1259.155029296875, 1259.9199829101562, 1260.6849975585938, 1261.4450073242188,
+    1262.2100219726562, 1264.5, 1266.0250244140625, 1275.1800537109375,
+    1278.2350463867188, 1282.050048828125, 1285.864990234375, 1290.4450073242188,
+    1291.9700317382812, 1294.260009765625, 1295.7849731445312, 1298.0750122070312,
+    1300.364990234375, 1302.655029296875, 1304.1799926757812, 1304.9450073242188,
+    1307.9949951171875, 1308.760009765625, 1311.0499877929688, 1311.8099975585938,
+    1314.0999755859375, 1317.9199829101562, 1318.6799926757812, 1322.5,
+    1324.7849731445312, 1326.3099975585938, 1326.3150024414062, 1327.8399658203125,
+    1334.7049560546875, 1337.7599487304688, 1338.5249633789062, 1344.625,
+    1353.7850341796875, 1358.364990234375, 1376.6799926757812, 1377.4450073242188,
+    1380.4949951171875, 1393.469970703125, 1394.2300415039062, 1400.3349609375,
+    1402.6300048828125, 1410.2550048828125, 1423.989990234375, 1433.1499633789062,
+    1437.72998046875, 1440.780029296875, 1452.22998046875, 1454.5150146484375,
+    1455.2799682617188, 1465.2000122070312, 1468.2550048828125, 1469.7799682617188,
+    1474.3600463867188, 1478.9400024414062, 1481.989990234375, 1485.8049926757812,
+    1495.7250366210938, 1501.8300170898438, 1520.9100341796875, 1531.5950317382812,
+    1547.6199951171875, 1565.1699829101562, 1581.1950073242188, 1619.3499755859375,
+    1630.7999877929688, 1644.5349731445312, 1712.4550170898438, 1893.3150024414062,
+    1992.5199584960938, 2036.02001953125, 2061.2050170898438, 2062.7249755859375,
+    2074.93994140625, 2241.2999877929688, 2293.9549560546875, 2311.5050048828125,
+    2378.6600341796875, 2500.0, 2563.3400268554688, 2564.864990234375,
+    2574.784912109375, 2633.544921875, 2688.4949951171875, 2864.7750244140625,
+    3008.2400512695312, 3031.135009765625, 3037.239990234375, 3043.3450927734375,
+    3117.3650512695312, 3131.1050415039062, 3208.9400024414062, 3268.4649047851562,
+    3305.860107421875, 3350.125, 3396.669921875, 3464.5899658203125,
+    3622.56005859375, 3790.445068359375, 3847.679931640625, 3906.4400634765625,
+    3964.4400634765625, 3984.280029296875, 4052.2000732421875, 4072.0399169921875,
+    4139.18994140625, 4425.369873046875, 4521.52001953125, 4574.175048828125,
+    4657.35498046875, 4658.8798828125, 4668.0400390625, 4680.25,
+    4681.01513671875, 4698.56494140625, 4729.08984375, 4752.75,
+    4760.3798828125, 4794.719970703125, 4805.405029296875, 4877.14013671875,
+    4902.320068359375, 4921.39501953125, 4943.52490234375, 4946.580078125,
+    4960.31494140625, 4980.925048828125, 4990.844970703125, 4991.60498046875,
+    4993.130126953125, 5000.0, 5020.60498046875, 5028.235107421875,
+    5032.050048828125, 5042.73486328125, 5058.764892578125, 5060.2900390625,
+    5062.5751953125, 5064.864990234375, 5066.394775390625, 5068.68017578125,
+    5069.445068359375, 5075.550048828125, 5076.31494140625, 5077.0751953125,
+    5079.364990234375, 5083.945068359375, 5088.52001953125, 5103.02490234375,
+    5113.704833984375, 5138.125, 5139.64990234375, 5177.044921875,
+    5194.594970703125, 5245.72998046875, 5248.02001953125, 5286.93505859375,
+    5358.670166015625, 5367.824951171875, 5369.35498046875, 5370.880126953125,
+    5389.955078125, 5393.77490234375, 5396.824951171875, 5399.114990234375,
+    5402.1650390625, 1256.8699951171875, 1258.39501953125, 1259.155029296875,
+    1259.9199829101562, 1261.4450073242188, 1262.9749755859375, 1263.7350463867188,
+    1266.0250244140625, 1266.7899780273438, 1275.1800537109375, 1275.9450073242188,
+    1276.7100219726562, 1278.2349853515625, 1279.760009765625, 1284.3400268554688,
+    1285.1050415039062, 1285.864990234375, 1285.8699951171875, 1287.3900146484375,
+    1288.9199829101562, 1290.4450073242188, 1291.2050170898438, 1291.2100219726562,
+    1292.7349853515625, 1295.0250244140625, 1295.7899780273438, 1298.8400268554688,
+    1299.60498046875, 1301.8900146484375, 1307.9949951171875, 1336.9949951171875,
+    1338.5250244140625, 1340.050048828125, 1343.864990234375, 1345.3900146484375,
+    1351.4949951171875, 1374.3899536132812, 1374.3900146484375, 1379.72998046875,
+    1382.0250244140625, 1385.8400268554688, 1391.175048828125, 1392.7050170898438,
+    1398.0450439453125, 1398.8099975585938, 1403.3900146484375, 1420.1749877929688,
+    1460.625, 1485.0450439453125, 1493.4400024414062, 1567.4599609375,
+    1567.4600219726562, 1575.0899658203125, 1581.1950073242188, 1584.25,
+    1588.0650024414062, 1605.614990234375, 1691.8499755859375, 1692.6150512695312,
+    1740.6900024414062, 1794.1100463867188, 1797.9249877929688, 1852.8699340820312,
+    1855.1600341796875, 1948.260009765625, 2036.02001953125, 2125.304931640625,
+    2139.0449829101562, 2160.4099731445312, 2193.219970703125, 2284.7999267578125,
+    2393.9249877929688, 2502.2900390625, 2545.7899780273438, 2614.469970703125,
+    2615.9949951171875, 2681.625, 2864.7750244140625, 2951.0050048828125,
+    2976.949951171875, 2993.7449340820312, 3005.9498901367188, 3026.5599365234375,
+    3166.2099609375, 3521.0599365234375, 3527.169921875, 3753.8199462890625,
+    3770.6051025390625, 3864.469970703125, 3956.81005859375, 3992.6749267578125,
+    4210.925048828125, 4291.820068359375, 4339.1298828125, 4368.135009765625,
+    4398.655029296875, 4442.919921875, 4482.599853515625, 4493.284912109375,
+    4507.78515625, 4523.044921875, 4578.7548828125, 4590.199951171875,
+    4590.965087890625, 4594.014892578125, 4635.989990234375, 4636.75,
+    4658.1201171875, 4693.985107421875, 4716.114990234375, 4718.405029296875,
+    4722.98486328125, 4729.090087890625, 4757.324951171875, 4775.639892578125,
+    4781.7451171875, 4802.349853515625, 4809.219970703125, 4822.955078125,
+    4830.5849609375, 4865.68994140625, 4909.949951171875, 4948.10498046875,
+    5023.66015625, 5041.97509765625, 5048.080078125, 5063.33984375,
+    5069.445068359375, 5078.60009765625, 5086.22998046875, 5090.050048828125,
+    5096.155029296875, 5103.784912109375, 5108.364990234375, 5120.5751953125,
+    5131.260009765625, 5133.544921875, 5135.074951171875, 5140.414794921875,
+    5141.18017578125, 5141.94482421875, 5143.469970703125, 5144.994873046875,
+    5144.9951171875, 5145.755126953125, 5145.760009765625, 5146.52001953125,
+    5149.5751953125, 5150.335205078125, 5154.155029296875, 5154.9150390625,
+    5155.675048828125, 5156.43994140625, 5156.440185546875, 5157.204833984375,
+    5157.969970703125, 5158.72998046875, 5159.494873046875, 5160.255126953125,
+    5161.019775390625, 5162.545166015625, 5165.594970703125, 5166.364990234375,
+    5167.89013671875, 5168.650146484375, 5170.175048828125, 5170.179931640625,
+    5171.705078125, 5172.465087890625, 5173.989990234375, 5176.284912109375,
+    5177.81005859375, 5178.574951171875, 5183.14990234375, 5186.965087890625,
+    5194.60009765625, 5195.360107421875, 5197.650146484375, 5199.18017578125,
+    5199.940185546875, 5205.28515625, 5211.39013671875, 5212.9150390625,
+    5213.68017578125, 5215.965087890625, 5217.4951171875, 5219.02001953125,
+    5219.780029296875, 5220.544921875, 5221.31005859375, 5224.360107421875,
+    5225.885009765625, 5226.64990234375, 5227.4150390625, 5232.7548828125,
+    5232.755126953125, 5234.280029296875, 5235.0400390625, 5238.094970703125,
+    5240.385009765625, 5241.909912109375, 5243.43505859375, 5243.440185546875,
+    5244.96484375, 5247.2548828125, 5247.255126953125, 5249.544921875,
+    5250.31005859375, 5251.070068359375, 5255.650146484375, 5256.41015625,
+    5260.989990234375, 5261.755126953125, 5264.804931640625, 5265.56982421875,
+    5268.6201171875, 5272.434814453125, 5280.070068359375, 5281.594970703125,
+    5308.30517578125, 5311.35498046875, 5345.695068359375, 5397.590087890625,
+    1256.8699951171875, 1258.39501953125, 1262.2149658203125, 1262.9749755859375,
+    1266.0250244140625, 1267.5549926757812, 1269.844970703125, 1270.60498046875,
+    1272.1300048828125, 1288.155029296875, 1291.9700317382812, 1305.7050170898438,
+    1308.0, 1310.2849731445312, 1333.1800537109375, 1343.10498046875,
+    1349.9700317382812, 1376.6799926757812, 1379.72998046875, 1381.2550048828125,
+    1382.02001953125, 1415.5950317382812, 1443.0750122070312, 1454.52001953125,
+    1455.2850341796875, 1461.3900146484375, 1474.3600463867188, 1485.0450439453125,
+    1526.25, 1594.1700439453125, 1669.7200317382812, 1797.925048828125,
+    1821.5799560546875, 1929.945068359375, 2105.4649658203125, 2193.989990234375,
+    2208.489990234375, 2290.9049682617188, 2317.614990234375, 2371.7950439453125,
+    2599.969970703125, 2668.655029296875, 2679.3350219726562, 2692.31005859375,
+    2700.7050170898438, 2728.175048828125, 2740.3849487304688, 2792.280029296875,
+    2799.9100341796875, 2858.669921875, 2876.2200317382812, 2890.7200317382812,
+    2892.2450561523438, 2896.8250122070312, 2940.3250732421875, 2943.3750610351562,
+    2974.6649169921875, 2977.7149047851562, 2986.8750610351562, 2988.4000854492188,
+    3015.1100463867188, 3088.3701171875, 3102.10986328125, 3173.0751342773438,
+    3234.1298828125, 3240.22998046875, 3250.1500244140625, 3268.4699096679688,
+    3276.1000366210938, 3285.2550048828125, 3396.669921875, 3518.77490234375,
+    3866.7601318359375, 3878.2049560546875, 4030.8299560546875, 4087.300048828125,
+    4171.2451171875, 4278.844970703125, 4377.2900390625, 4410.864990234375,
+    4419.260009765625, 4423.074951171875, 4429.94482421875, 4447.494873046875,
+    4456.655029296875, 4465.81005859375, 4472.679931640625, 4480.31005859375,
+    4485.64990234375, 4489.47021484375, 4494.81005859375, 4553.56982421875,
+    4562.724853515625, 4597.070068359375, 4603.93994140625, 4676.429931640625,
+    4676.43505859375, 4690.175048828125, 4693.22509765625, 4710.77490234375,
+    4719.169921875, 4719.93505859375, 4738.25, 4753.510009765625,
+    4774.875, 4779.4599609375, 4781.75, 4782.510009765625,
+    4783.27001953125, 4808.455078125, 4809.97998046875, 4822.190185546875,
+    4841.27001953125, 4848.900146484375, 4871.795166015625, 4877.900146484375,
+    4912.239990234375, 4942.005126953125, 4957.26513671875, 4969.47509765625,
+    4973.2900390625, 4993.130126953125, 5017.554931640625, 5023.655029296875,
+    5025.945068359375, 5028.235107421875, 5054.945068359375, 5056.469970703125,
+    5067.919921875, 5080.89501953125, 5086.235107421875, 5090.81005859375,
+    5090.81494140625, 5110.655029296875, 5162.545166015625, 5170.175048828125,
+    5176.28515625, 5181.625, 5183.91015625, 5190.780029296875,
+    5192.30517578125, 5199.18017578125, 5200.699951171875, 5203.7548828125,
+    5206.044921875, 5207.5751953125, 5209.860107421875, 5216.72998046875,
+    5217.4951171875, 5219.014892578125, 5219.01513671875, 5220.544921875,
+    5220.545166015625, 5222.830078125, 5223.594970703125, 5224.35986328125,
+    5224.360107421875, 5225.125, 5225.885009765625, 5227.4150390625,
+    5228.175048828125, 5228.93994140625, 5233.52001953125, 5235.0400390625,
+    5235.804931640625, 5237.3349609375, 5238.094970703125, 5238.85986328125,
+    5238.860107421875, 5240.385009765625, 5241.14501953125, 5241.909912109375,
+    5244.199951171875, 5245.724853515625, 5245.72998046875, 5249.5400390625,
+    5293.0400390625, 5311.35498046875, 5327.385009765625, 5353.330078125,
+    5383.85009765625, 5389.955078125, 5402.169921875, 5403.69482421875,
+};
+
+static const uint8_t voltage_bn_slot_feature[6] = {
+    0, 0, 1, 2, 3, 4,
+};
+
+static const uint16_t voltage_bn_slot_base[6] = {
+    0, 255, 0, 0, 0, 0,
+};
+
+static const uint8_t voltage_bn_slot[2348] = {
+    0, 0, 5, 0, 0, 5, 4, 4, 4, 5, 4, 0, 5, 4, 0, 0, 3, 4, 3, 3, 4, 2, 0, 5,
+    5, 0, 2, 4, 0, 4, 0, 0, 3, 2, 5, 0, 3, 0, 4, 4, 1, 1, 3, 4, 4, 4, 1, 1,
+    1, 3, 1, 3, 1, 4, 0, 0, 0, 0, 0, 0, 0, 3, 4, 0, 3, 0, 4, 4, 0, 3, 3, 0,
+    4, 5, 0, 3, 0, 0, 3, 0, 4, 0, 5, 2, 0, 0, 4, 0, 5, 2, 0, 4, 4, 4, 1, 1,
+    4, 4, 3, 3, 3, 1, 1, 4, 1, 1, 4, 3, 0, 0, 0, 0, 5, 0, 4, 2, 3, 4, 4, 3,
+    0, 5, 2, 0, 4, 0, 3, 4, 2, 0, 0, 0, 5, 2, 2, 2, 2, 1, 4, 0, 5, 4, 2, 2,
+    4, 1, 1, 3, 1, 1, 1, 3, 0, 0, 0, 0, 0, 0, 3, 4, 5, 3, 2, 2, 3, 4, 0, 3,
+    3, 3, 0, 0, 4, 5, 5, 3, 0, 4, 0, 0, 4, 3, 4, 0, 2, 5, 2, 2, 3, 1, 4, 4,
+    4, 0, 0, 1, 1, 2, 4, 1, 5, 1, 0, 0, 0, 5, 0, 0, 5, 4, 0, 0, 3, 3, 5, 4,
+    3, 4, 0, 0, 2, 0, 0, 2, 0, 0, 5, 4, 0, 2, 0, 0, 5, 5, 0, 2, 5, 2, 1, 1,
+    4, 3, 2, 1, 2, 0, 0, 0, 0, 5, 5, 4, 5, 0, 4, 3, 3, 5, 0, 4, 0, 5, 0, 0,
+    4, 0, 5, 0, 0, 0, 5, 0, 3, 1, 4, 2, 4, 1, 2, 5, 5, 1, 1, 3, 1, 1, 1, 3,
+    0, 0, 0, 5, 0, 0, 3, 4, 0, 0, 4, 3, 5, 3, 0, 2, 0, 4, 0, 3, 3, 0, 0, 4,
+    4, 5, 4, 3, 4, 1, 4, 1, 4, 1, 4, 2, 1, 1, 4, 2, 1, 5, 3, 0, 0, 0, 0, 5,
+    0, 4, 2, 4, 0, 5, 3, 0, 5, 5, 4, 0, 0, 4, 0, 2, 0, 2, 0, 5, 4, 0, 5, 0,
+    4, 5, 1, 4, 4, 0, 5, 1, 1, 4, 1, 1, 1, 3, 0, 0, 0, 5, 0, 0, 3, 4, 0, 0,
+    3, 3, 4, 0, 4, 3, 4, 0, 4, 4, 0, 4, 4, 0, 4, 0, 0, 5, 0, 3, 0, 0, 0, 5,
+    5, 3, 1, 4, 1, 4, 2, 1, 1, 4, 1, 1, 1, 3, 0, 0, 5, 0, 0, 4, 2, 2, 2, 0,
+    4, 2, 4, 0, 0, 4, 5, 0, 3, 5, 4, 3, 3, 0, 0, 4, 3, 4, 4, 4, 0, 5, 5, 2,
+    0, 1, 4, 1, 3, 2, 1, 1, 3, 2, 1, 5, 3, 0, 0, 0, 0, 0, 0, 4, 4, 3, 3, 3,
+    5, 4, 4, 0, 5, 4, 0, 4, 5, 0, 4, 0, 0, 0, 4, 0, 0, 0, 5, 2, 4, 1, 1, 4,
+    5, 5, 4, 1, 1, 1, 1, 4, 1, 1, 1, 3, 0, 0, 0, 0, 0, 4, 3, 4, 3, 0, 3, 5,
+    3, 4, 0, 4, 3, 4, 5, 0, 2, 0, 4, 0, 2, 4, 4, 0, 4, 2, 5, 2, 5, 1, 4, 1,
+    4, 2, 1, 2, 4, 5, 1, 1, 3, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 4, 3, 0, 4, 0,
+    0, 5, 3, 3, 0, 4, 0, 2, 4, 0, 5, 0, 5, 2, 3, 0, 1, 4, 0, 5, 4, 2, 4, 5,
+    1, 3, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 4, 4, 3, 3, 3, 2, 0, 0, 4, 0, 0, 4,
+    0, 0, 5, 0, 5, 5, 5, 3, 1, 1, 4, 5, 4, 4, 4, 1, 1, 4, 1, 1, 1, 2, 0, 0,
+    0, 0, 0, 5, 0, 3, 5, 4, 4, 5, 5, 0, 4, 2, 0, 2, 4, 5, 5, 2, 0, 0, 0, 5,
+    0, 5, 0, 5, 4, 0, 3, 1, 4, 1, 4, 1, 1, 1, 0, 0, 0, 5, 0, 0, 0, 4, 4, 2,
+    0, 0, 4, 0, 3, 3, 3, 2, 3, 4, 2, 5, 0, 3, 0, 4, 0, 0, 2, 5, 0, 2, 4, 2,
+    4, 4, 3, 2, 5, 1, 1, 4, 1, 5, 3, 4, 1, 2, 1, 1, 2, 1, 1, 0, 0, 0, 0, 5,
+    2, 5, 4, 5, 5, 3, 4, 5, 0, 4, 5, 4, 3, 3, 0, 0, 0, 5, 3, 2, 0, 4, 0, 0,
+    3, 5, 0, 0, 5, 4, 5, 5, 3, 1, 4, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 3, 0,
+    0, 0, 0, 0, 5, 4, 3, 3, 4, 2, 4, 0, 0, 0, 0, 4, 4, 3, 0, 0, 5, 0, 0, 4,
+    4, 4, 0, 3, 5, 0, 4, 0, 1, 4, 1, 3, 4, 2, 1, 4, 1, 3, 5, 5, 0, 0, 0, 0,
+    0, 5, 4, 3, 4, 4, 5, 3, 0, 3, 3, 3, 5, 0, 0, 0, 4, 0, 3, 5, 0, 0, 3, 5,
+    3, 5, 5, 2, 1, 1, 3, 0, 0, 3, 4, 1, 1, 4, 5, 1, 1, 3, 0, 0, 0, 0, 0, 5,
+    4, 3, 4, 4, 4, 4, 3, 4, 3, 3, 0, 2, 5, 2, 0, 4, 0, 3, 2, 4, 5, 5, 0, 0,
+    0, 4, 0, 3, 3, 5, 2, 3, 1, 1, 4, 4, 1, 1, 1, 0, 0, 0, 0, 0, 4, 3, 3, 2,
+    0, 2, 4, 4, 0, 3, 3, 3, 2, 3, 3, 4, 2, 2, 5, 0, 4, 0, 3, 5, 5, 0, 0, 5,
+    2, 5, 4, 4, 4, 3, 1, 4, 0, 5, 1, 5, 4, 1, 1, 4, 4, 1, 2, 1, 0, 0, 5, 0,
+    0, 0, 0, 4, 3, 4, 4, 5, 5, 0, 0, 2, 3, 0, 0, 4, 3, 4, 0, 0, 3, 0, 5, 0,
+    2, 2, 4, 0, 5, 0, 2, 5, 1, 5, 0, 2, 4, 5, 4, 2, 3, 2, 1, 1, 1, 5, 0, 0,
+    0, 0, 0, 0, 3, 2, 4, 0, 3, 3, 5, 3, 3, 0, 4, 0, 2, 3, 5, 0, 4, 5, 0, 4,
+    0, 0, 5, 0, 0, 2, 2, 3, 1, 4, 0, 3, 5, 2, 1, 1, 4, 4, 5, 1, 1, 3, 0, 0,
+    5, 3, 0, 0, 3, 5, 4, 0, 4, 0, 3, 5, 0, 3, 3, 4, 4, 2, 3, 5, 3, 0, 0, 3,
+    0, 2, 0, 5, 0, 4, 0, 5, 5, 2, 5, 1, 4, 4, 0, 2, 1, 1, 3, 1, 1, 1, 3, 0,
+    0, 0, 0, 0, 5, 4, 3, 3, 3, 0, 2, 4, 5, 4, 5, 3, 3, 0, 2, 2, 0, 4, 3, 5,
+    4, 0, 4, 0, 5, 2, 0, 5, 0, 5, 4, 3, 2, 1, 4, 0, 3, 4, 0, 2, 4, 1, 4, 2,
+    1, 1, 1, 0, 0, 5, 0, 0, 2, 0, 2, 5, 0, 4, 0, 2, 0, 5, 3, 4, 3, 4, 5, 0,
+    3, 3, 4, 4, 3, 4, 0, 4, 0, 0, 0, 0, 3, 2, 2, 2, 4, 1, 3, 0, 5, 4, 0, 2,
+    1, 3, 1, 1, 1, 3, 0, 0, 0, 0, 5, 0, 4, 3, 5, 4, 3, 5, 3, 4, 5, 0, 5, 5,
+    2, 0, 4, 0, 0, 5, 5, 0, 2, 0, 4, 0, 4, 1, 4, 1, 0, 3, 4, 1, 1, 2, 1, 1,
+    1, 2, 0, 0, 5, 0, 0, 0, 0, 0, 3, 4, 4, 0, 5, 5, 0, 0, 2, 3, 5, 2, 3, 0,
+    3, 0, 0, 0, 5, 5, 3, 4, 0, 4, 0, 2, 0, 5, 4, 0, 0, 0, 5, 2, 4, 1, 4, 1,
+    3, 4, 1, 1, 3, 1, 2, 1, 5, 0, 0, 0, 5, 4, 5, 2, 4, 2, 0, 3, 5, 3, 0, 2,
+    0, 3, 0, 5, 2, 2, 0, 4, 0, 0, 5, 4, 4, 0, 5, 2, 5, 1, 4, 0, 4, 5, 2, 5,
+    3, 1, 2, 1, 1, 5, 1, 0, 0, 0, 0, 5, 2, 4, 0, 3, 3, 3, 0, 4, 3, 4, 2, 0,
+    4, 5, 0, 2, 0, 2, 0, 4, 0, 5, 2, 0, 5, 0, 5, 5, 2, 4, 0, 1, 4, 0, 5, 5,
+    2, 0, 5, 1, 3, 4, 1, 1, 2, 0, 0, 0, 0, 0, 5, 4, 3, 4, 3, 2, 4, 3, 0, 3,
+    4, 5, 4, 4, 0, 3, 0, 5, 0, 4, 0, 2, 4, 2, 0, 0, 2, 5, 3, 3, 2, 1, 4, 1,
+    4, 4, 4, 5, 1, 4, 4, 1, 1, 2, 0, 0, 0, 0, 5, 5, 3, 2, 2, 4, 4, 0, 4, 2,
+    4, 2, 0, 3, 0, 2, 5, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 4, 5, 4, 4, 2, 1, 3,
+    4, 0, 4, 1, 5, 5, 4, 1, 1, 1, 0, 0, 0, 5, 0, 0, 0, 3, 0, 0, 4, 5, 0, 3,
+    5, 3, 3, 5, 5, 4, 4, 0, 3, 3, 0, 4, 0, 0, 5, 0, 3, 3, 2, 4, 2, 5, 3, 2,
+    1, 1, 3, 4, 5, 4, 1, 1, 1, 1, 3, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 4, 3, 0,
+    0, 2, 5, 2, 0, 2, 0, 4, 4, 0, 4, 0, 5, 2, 4, 5, 0, 2, 2, 2, 4, 4, 1, 1,
+    4, 0, 0, 3, 4, 1, 1, 4, 1, 1, 4, 3, 0, 0, 0, 0, 0, 5, 4, 3, 5, 0, 4, 3,
+    3, 4, 0, 4, 0, 4, 5, 2, 3, 4, 0, 3, 5, 3, 4, 5, 0, 4, 0, 0, 5, 2, 2, 2,
+    1, 1, 4, 2, 1, 1, 1, 0, 0, 0, 0, 0, 5, 4, 4, 5, 3, 3, 0, 4, 4, 5, 5, 3,
+    4, 5, 0, 5, 0, 2, 0, 0, 0, 0, 3, 4, 4, 4, 3, 5, 0, 5, 4, 4, 1, 4, 1, 4,
+    4, 0, 4, 4, 1, 1, 4, 2, 1, 1, 3, 0, 0, 0, 0, 0, 4, 3, 3, 0, 3, 4, 5, 2,
+    5, 0, 5, 5, 0, 4, 4, 0, 4, 0, 4, 0, 5, 0, 2, 5, 0, 4, 0, 0, 1, 0, 4, 0,
+    2, 4, 1, 1, 1, 2, 1, 1, 1, 5, 0, 0, 0, 0, 0, 5, 0, 3, 3, 2, 5, 0, 4, 3,
+    4, 3, 2, 0, 2, 0, 0, 5, 3, 0, 2, 4, 0, 4, 0, 3, 5, 0, 4, 0, 5, 0, 5, 5,
+    1, 4, 0, 2, 4, 0, 5, 1, 4, 1, 1, 1, 1, 3, 0, 0, 0, 0, 0, 5, 0, 3, 5, 4,
+    3, 0, 4, 0, 5, 5, 2, 0, 4, 3, 2, 3, 5, 5, 0, 5, 4, 3, 0, 0, 4, 0, 0, 0,
+    0, 2, 2, 1, 1, 4, 3, 1, 5, 1, 0, 0, 0, 0, 5, 0, 4, 3, 0, 0, 3, 2, 5, 0,
+    5, 5, 0, 2, 5, 0, 5, 0, 0, 0, 0, 4, 5, 0, 2, 1, 1, 4, 4, 5, 4, 1, 1, 1,
+    1, 2, 1, 1, 4, 3, 0, 0, 0, 5, 0, 0, 4, 4, 2, 0, 4, 0, 2, 3, 4, 0, 0, 4,
+    2, 0, 5, 0, 4, 0, 4, 5, 0, 0, 3, 5, 2, 4, 3, 0, 0, 1, 4, 5, 3, 2, 2, 4,
+    1, 4, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, 4, 3, 5, 0, 4, 2, 3, 0, 4, 3, 0, 4,
+    5, 5, 4, 5, 2, 4, 0, 5, 4, 0, 0, 4, 0, 0, 0, 0, 5, 1, 4, 0, 2, 1, 1, 1,
+    0, 0, 0, 0, 5, 5, 4, 2, 4, 0, 5, 3, 5, 5, 0, 0, 4, 3, 0, 0, 0, 4, 0, 5,
+    0, 2, 0, 5, 0, 2, 4, 0, 2, 5, 1, 4, 1, 3, 4, 2, 1, 4, 4, 1, 1, 1, 0, 0,
+    0, 0, 5, 0, 4, 3, 3, 0, 2, 0, 2, 2, 5, 3, 2, 2, 0, 4, 0, 3, 2, 0, 0, 4,
+    4, 2, 2, 4, 3, 3, 1, 4, 1, 4, 4, 1, 2, 1, 1, 1, 5, 3, 0, 0, 0, 0, 0, 0,
+    3, 2, 5, 0, 4, 0, 0, 5, 4, 3, 5, 5, 3, 0, 4, 0, 5, 2, 5, 0, 2, 4, 0, 2,
+    3, 5, 4, 2, 1, 3, 0, 0, 4, 0, 2, 1, 3, 4, 1, 1, 1, 0, 0, 0, 0, 0, 4, 3,
+    2, 0, 4, 3, 2, 3, 0, 2, 2, 2, 4, 0, 4, 0, 4, 5, 5, 4, 0, 5, 5, 0, 2, 3,
+    1, 4, 0, 0, 1, 2, 5, 1, 1, 4, 1, 3, 1, 1, 0, 0, 0, 5, 5, 3, 3, 4, 0, 4,
+    2, 2, 3, 5, 4, 3, 3, 0, 2, 2, 2, 4, 5, 0, 4, 0, 5, 5, 3, 5, 0, 4, 3, 5,
+    1, 3, 0, 5, 4, 2, 0, 1, 3, 4, 2, 1, 3, 0, 0, 0, 0, 0, 4, 3, 3, 5, 0, 3,
+    3, 0, 0, 0, 3, 5, 3, 4, 0, 0, 3, 0, 0, 0, 4, 4, 0, 4, 0, 2, 1, 1, 3, 4,
+    1, 1, 1, 0, 0, 0, 0, 5, 0, 4, 3, 5, 2, 4, 0, 2, 4, 0, 2, 4, 3, 2, 3, 0,
+    4, 0, 4, 3, 0, 5, 4, 0, 5, 0, 3, 5, 1, 1, 0, 3, 4, 2, 4, 1, 1, 4, 1, 3,
+    1, 5, 0, 0, 0, 0, 0, 5, 3, 3, 3, 4, 5, 3, 3, 5, 0, 3, 0, 4, 5, 0, 2, 0,
+    4, 3, 4, 5, 4, 5, 0, 4, 0, 4, 3, 2, 5, 2, 1, 4, 1, 1, 1, 1,
+};
+
+static const uint8_t voltage_bn_bin[2348] = {
+    112, 45, 4, 14, 4, 1, 0, 6, 1, 1, 7, 5, 7, 4, 24, 16, 22, 31, 34, 29, 11, 36, 72, 94,
+    38, 60, 75, 94, 222, 156, 155, 131, 77, 51, 169, 192, 131, 186, 217, 193, 43, 6, 146, 105, 165, 213, 20, 73,
+    54, 143, 60, 168, 81, 222, 119, 70, 28, 8, 3, 2, 5, 7, 7, 21, 27, 38, 38, 24, 66, 91, 62, 92,
+    14, 119, 105, 75, 118, 94, 88, 232, 150, 173, 28, 88, 143, 203, 110, 218, 148, 105, 166, 202, 176, 174, 43, 14,
+    186, 142, 154, 89, 159, 74, 48, 198, 56, 89, 219, 167, 75, 0, 43, 28, 4, 14, 3, 10, 11, 27, 32, 13,
+    57, 35, 38, 210, 150, 142, 76, 81, 81, 161, 159, 192, 173, 102, 98, 120, 101, 21, 153, 238, 154, 114, 116, 112,
+    211, 61, 42, 158, 54, 89, 81, 168, 110, 69, 35, 8, 4, 3, 0, 7, 5, 7, 17, 16, 13, 49, 54, 92,
+    52, 36, 99, 88, 67, 47, 23, 81, 220, 156, 153, 128, 72, 53, 150, 181, 104, 173, 99, 93, 151, 21, 160, 113,
+    96, 238, 234, 20, 43, 68, 130, 77, 134, 82, 77, 0, 45, 4, 10, 4, 0, 7, 10, 30, 42, 26, 110, 54,
+    61, 90, 168, 138, 45, 89, 83, 39, 112, 86, 106, 128, 147, 72, 164, 240, 171, 152, 201, 116, 173, 101, 46, 21,
+    140, 89, 138, 54, 141, 121, 70, 0, 52, 7, 4, 8, 81, 66, 45, 34, 38, 48, 104, 51, 109, 120, 103, 233,
+    164, 164, 29, 139, 194, 191, 154, 221, 133, 33, 146, 121, 114, 26, 126, 145, 95, 67, 43, 137, 53, 89, 76, 168,
+    112, 0, 45, 4, 15, 4, 14, 7, 10, 30, 34, 26, 110, 79, 55, 56, 233, 164, 153, 85, 51, 127, 210, 139,
+    144, 147, 183, 145, 175, 35, 161, 14, 119, 27, 218, 128, 70, 48, 197, 135, 86, 66, 162, 109, 70, 0, 46, 4,
+    14, 7, 25, 11, 67, 14, 35, 79, 97, 45, 57, 91, 226, 150, 148, 59, 137, 84, 178, 18, 100, 196, 128, 156,
+    181, 168, 23, 210, 135, 246, 141, 70, 43, 213, 48, 89, 75, 168, 134, 70, 30, 4, 14, 4, 9, 7, 10, 20,
+    17, 12, 36, 66, 27, 49, 26, 107, 92, 70, 94, 133, 76, 225, 150, 161, 157, 31, 192, 118, 218, 205, 186, 132,
+    140, 139, 42, 215, 7, 186, 66, 73, 48, 179, 59, 95, 82, 168, 101, 50, 4, 10, 3, 0, 2, 8, 3, 22,
+    4, 3, 7, 26, 31, 35, 98, 75, 18, 119, 63, 71, 101, 232, 134, 55, 44, 133, 101, 156, 193, 39, 156, 116,
+    227, 43, 215, 8, 148, 70, 77, 48, 156, 134, 91, 177, 167, 113, 69, 0, 49, 24, 8, 22, 35, 18, 63, 49,
+    63, 26, 21, 100, 43, 48, 97, 78, 26, 232, 156, 173, 172, 153, 150, 208, 219, 227, 173, 105, 175, 43, 12, 170,
+    123, 133, 181, 29, 32, 75, 54, 206, 63, 95, 88, 168, 134, 70, 0, 30, 10, 7, 1, 25, 12, 67, 49, 63,
+    35, 21, 88, 68, 70, 83, 165, 116, 76, 228, 156, 161, 86, 87, 150, 195, 153, 107, 173, 93, 158, 43, 215, 8,
+    172, 66, 76, 131, 120, 69, 95, 83, 168, 119, 72, 0, 27, 8, 4, 0, 31, 41, 53, 37, 33, 98, 71, 76,
+    91, 50, 80, 99, 210, 155, 161, 85, 64, 145, 156, 192, 173, 102, 134, 191, 28, 172, 248, 163, 161, 116, 175, 74,
+    50, 83, 39, 137, 69, 92, 115, 0, 67, 51, 8, 3, 7, 35, 63, 50, 36, 75, 95, 233, 147, 163, 159, 69,
+    185, 184, 156, 186, 128, 144, 139, 129, 43, 11, 151, 113, 165, 213, 190, 76, 54, 204, 69, 95, 83, 145, 80, 0,
+    40, 8, 3, 7, 5, 6, 3, 7, 31, 51, 93, 67, 88, 41, 161, 86, 46, 109, 55, 42, 127, 84, 151, 143,
+    122, 65, 243, 171, 209, 180, 127, 36, 161, 15, 165, 69, 54, 90, 134, 70, 50, 4, 10, 3, 19, 3, 7, 26,
+    52, 55, 59, 58, 65, 35, 38, 55, 75, 51, 52, 165, 116, 122, 232, 150, 185, 184, 87, 118, 215, 91, 104, 106,
+    166, 155, 145, 116, 162, 42, 22, 162, 2, 72, 89, 181, 71, 133, 50, 65, 143, 81, 98, 134, 46, 8, 4, 1,
+    0, 7, 0, 0, 3, 1, 7, 4, 24, 32, 52, 26, 29, 13, 81, 72, 55, 20, 124, 77, 229, 156, 162, 159,
+    103, 169, 197, 219, 139, 209, 163, 158, 127, 23, 136, 123, 116, 125, 20, 9, 62, 43, 69, 55, 88, 76, 168, 112,
+    46, 0, 10, 4, 1, 0, 0, 6, 33, 24, 11, 79, 78, 72, 67, 115, 75, 108, 233, 160, 80, 152, 127, 133,
+    77, 150, 192, 118, 146, 196, 195, 231, 43, 215, 18, 147, 188, 139, 50, 200, 64, 163, 179, 183, 114, 45, 0, 8,
+    4, 1, 1, 1, 7, 30, 115, 20, 72, 64, 57, 98, 119, 106, 94, 225, 156, 165, 110, 84, 125, 194, 118, 155,
+    150, 173, 164, 124, 41, 4, 142, 237, 236, 89, 184, 73, 48, 199, 153, 95, 83, 166, 80, 46, 31, 8, 4, 1,
+    0, 0, 7, 28, 19, 40, 39, 80, 40, 26, 74, 33, 16, 67, 175, 158, 120, 66, 31, 115, 19, 10, 155, 156,
+    232, 150, 200, 111, 114, 147, 105, 128, 39, 18, 135, 181, 69, 48, 89, 112, 68, 46, 30, 10, 7, 6, 19, 6,
+    39, 26, 11, 50, 56, 93, 52, 33, 29, 38, 82, 89, 50, 75, 76, 228, 150, 164, 56, 56, 171, 189, 184, 154,
+    106, 173, 174, 155, 205, 140, 29, 161, 244, 127, 17, 74, 168, 69, 43, 188, 99, 82, 137, 99, 80, 46, 7, 13,
+    5, 3, 8, 6, 8, 17, 8, 8, 59, 24, 16, 11, 40, 62, 71, 62, 54, 88, 222, 149, 73, 137, 57, 136,
+    46, 82, 139, 173, 19, 185, 122, 174, 31, 151, 242, 97, 142, 160, 175, 120, 160, 68, 48, 91, 80, 180, 121, 46,
+    0, 29, 8, 4, 2, 15, 19, 34, 43, 33, 115, 20, 24, 83, 17, 74, 67, 63, 68, 105, 93, 104, 211, 169,
+    161, 158, 86, 185, 184, 89, 102, 132, 21, 160, 238, 120, 125, 116, 20, 48, 208, 123, 61, 90, 69, 169, 68, 50,
+    4, 10, 4, 3, 0, 1, 6, 17, 7, 10, 4, 6, 25, 7, 21, 58, 15, 62, 69, 70, 72, 228, 140, 73,
+    129, 29, 108, 119, 117, 156, 161, 33, 169, 109, 173, 30, 212, 142, 246, 117, 67, 42, 159, 49, 91, 73, 167, 112,
+    50, 28, 8, 4, 1, 0, 0, 6, 17, 36, 6, 29, 22, 37, 98, 32, 38, 52, 22, 71, 88, 60, 84, 60,
+    122, 222, 164, 175, 21, 90, 142, 150, 192, 174, 177, 126, 120, 21, 142, 250, 121, 117, 234, 116, 168, 43, 213, 68,
+    76, 54, 87, 109, 50, 4, 11, 3, 0, 5, 7, 1, 23, 7, 10, 2, 24, 5, 21, 35, 33, 10, 131, 74,
+    97, 63, 173, 73, 78, 91, 213, 150, 160, 157, 134, 193, 118, 91, 100, 95, 155, 20, 149, 239, 156, 117, 236, 128,
+    54, 94, 43, 89, 67, 167, 119, 70, 0, 45, 4, 14, 4, 37, 110, 52, 52, 114, 32, 17, 119, 100, 44, 53,
+    49, 232, 164, 173, 172, 164, 169, 201, 104, 204, 217, 156, 175, 33, 145, 13, 244, 135, 218, 19, 63, 68, 43, 82,
+    75, 145, 114, 50, 4, 10, 3, 2, 5, 18, 3, 9, 7, 10, 5, 6, 30, 20, 9, 46, 98, 23, 38, 52,
+    24, 72, 67, 64, 41, 119, 106, 121, 226, 156, 160, 86, 148, 175, 150, 192, 219, 216, 173, 103, 181, 35, 218, 5,
+    146, 149, 78, 42, 138, 54, 142, 83, 182, 114, 52, 0, 5, 7, 4, 4, 4, 1, 24, 45, 63, 35, 79, 22,
+    105, 102, 88, 60, 61, 58, 206, 137, 174, 170, 87, 95, 84, 193, 167, 102, 129, 28, 145, 239, 102, 111, 116, 162,
+    157, 54, 68, 44, 76, 9, 97, 134, 45, 0, 30, 4, 5, 3, 32, 11, 30, 46, 65, 24, 20, 12, 21, 88,
+    56, 17, 59, 77, 119, 94, 223, 156, 164, 88, 83, 144, 169, 192, 174, 173, 102, 196, 191, 21, 172, 249, 73, 100,
+    116, 231, 74, 48, 95, 216, 82, 70, 144, 80, 45, 30, 8, 4, 1, 0, 0, 7, 25, 6, 19, 58, 37, 109,
+    34, 51, 24, 11, 74, 97, 55, 67, 207, 141, 161, 85, 43, 96, 185, 184, 92, 173, 133, 126, 120, 21, 180, 3,
+    107, 119, 182, 72, 48, 214, 125, 80, 64, 140, 114, 45, 0, 30, 7, 4, 5, 13, 6, 82, 34, 65, 24, 19,
+    26, 21, 76, 68, 63, 63, 102, 96, 229, 133, 174, 171, 146, 185, 183, 214, 217, 141, 149, 166, 185, 114, 25, 157,
+    142, 239, 189, 42, 40, 30, 192, 75, 54, 92, 114, 68, 31, 7, 10, 4, 12, 4, 9, 16, 27, 62, 44, 58,
+    12, 52, 32, 58, 119, 75, 53, 103, 108, 88, 228, 131, 154, 119, 92, 194, 118, 113, 108, 155, 94, 173, 140, 111,
+    37, 0, 144, 106, 136, 159, 15, 19, 73, 48, 155, 70, 89, 79, 100, 136, 70, 0, 30, 8, 4, 7, 28, 38,
+    67, 34, 114, 23, 106, 75, 72, 133, 101, 232, 156, 192, 19, 90, 109, 157, 212, 100, 93, 98, 166, 175, 43, 18,
+    142, 251, 247, 89, 124, 75, 54, 203, 61, 89, 220, 168, 70, 0, 31, 8, 4, 1, 0, 7, 4, 16, 20, 12,
+    11, 11, 67, 27, 154, 42, 101, 44, 35, 18, 132, 79, 43, 90, 167, 108, 240, 171, 199, 169, 160, 109, 105, 116,
+    47, 18, 157, 66, 73, 63, 91, 112, 69, 28, 8, 4, 1, 2, 7, 5, 7, 16, 42, 36, 85, 24, 13, 49,
+    21, 9, 81, 42, 76, 45, 85, 220, 148, 135, 77, 133, 98, 86, 104, 171, 192, 32, 132, 163, 33, 160, 10, 112,
+    149, 241, 175, 218, 69, 48, 126, 135, 91, 81, 168, 111, 50, 0, 28, 10, 7, 0, 17, 38, 26, 35, 98, 29,
+    9, 75, 116, 119, 100, 63, 65, 94, 121, 210, 155, 153, 82, 127, 73, 156, 175, 166, 188, 176, 29, 254, 180, 253,
+    123, 140, 16, 24, 68, 68, 42, 91, 75, 181, 112, 46, 30, 8, 4, 1, 7, 0, 6, 12, 122, 39, 82, 48,
+    33, 33, 27, 47, 29, 75, 72, 36, 57, 69, 75, 94, 228, 156, 153, 85, 99, 139, 150, 185, 174, 227, 173, 126,
+    22, 171, 236, 115, 138, 236, 72, 48, 194, 37, 38, 81, 69, 167, 70, 0, 30, 8, 3, 7, 5, 6, 2, 7,
+    17, 38, 36, 48, 25, 15, 35, 161, 41, 47, 29, 29, 112, 78, 102, 43, 61, 130, 126, 232, 154, 185, 184, 223,
+    186, 113, 116, 42, 22, 142, 89, 82, 138, 91, 121, 70, 0, 30, 4, 10, 7, 27, 38, 67, 62, 29, 9, 105,
+    119, 46, 94, 65, 27, 220, 171, 173, 172, 164, 194, 109, 142, 182, 101, 45, 1, 180, 111, 137, 146, 40, 34, 69,
+    58, 130, 60, 92, 221, 168, 134, 46, 0, 5, 14, 4, 13, 3, 1, 30, 32, 65, 19, 13, 14, 100, 72, 52,
+    75, 130, 107, 228, 154, 154, 74, 54, 140, 193, 118, 146, 107, 166, 145, 202, 224, 20, 142, 124, 123, 129, 117, 165,
+    51, 216, 83, 84, 69, 95, 80, 0, 45, 24, 8, 4, 7, 22, 64, 34, 32, 32, 13, 72, 52, 67, 150, 43,
+    101, 57, 16, 121, 64, 133, 119, 103, 103, 141, 220, 150, 174, 172, 193, 196, 132, 29, 142, 246, 116, 66, 42, 83,
+    119, 45, 0, 30, 7, 4, 5, 15, 38, 39, 11, 35, 9, 77, 74, 68, 79, 100, 87, 82, 230, 147, 153, 91,
+    133, 48, 177, 34, 198, 109, 166, 205, 105, 158, 35, 218, 7, 146, 191, 136, 52, 201, 209, 94, 85, 101, 112, 73,
+    1, 30, 4, 14, 7, 28, 23, 57, 37, 88, 43, 40, 75, 87, 45, 75, 232, 164, 148, 85, 54, 138, 192, 109,
+    148, 110, 105, 207, 152, 153, 43, 218, 15, 152, 181, 74, 132, 58, 66, 89, 176, 167, 112, 70, 1, 50, 8, 4,
+    6, 26, 116, 58, 39, 93, 79, 119, 75, 74, 90, 159, 88, 228, 150, 165, 79, 80, 89, 187, 78, 129, 209, 102,
+    126, 129, 185, 114, 12, 147, 249, 237, 118, 236, 127, 51, 94, 216, 80, 60, 96, 134, 69, 0, 35, 10, 7, 6,
+    20, 41, 47, 59, 30, 29, 90, 43, 40, 74, 94, 222, 156, 164, 66, 96, 85, 150, 192, 174, 173, 179, 98, 151,
+    30, 161, 252, 239, 15, 116, 72, 72, 47, 187, 57, 161, 88, 93, 135, 68, 50, 5, 4, 10, 7, 4, 6, 7,
+    28, 18, 63, 37, 45, 34, 38, 105, 53, 47, 57, 133, 107, 225, 178, 155, 83, 71, 105, 170, 193, 217, 141, 135,
+    21, 149, 237, 130, 116, 119, 245, 48, 96, 124, 138, 69, 164, 70, 0, 50, 24, 10, 7, 6, 21, 105, 33, 41,
+    18, 61, 55, 173, 125, 83, 60, 26, 116, 101, 107, 123, 156, 229, 164, 134, 190, 153, 227, 118, 43, 0, 136, 213,
+    75, 51, 97, 114, 50, 0, 30, 4, 14, 3, 15, 117, 14, 35, 65, 18, 23, 105, 71, 93, 112, 60, 81, 229,
+    147, 148, 133, 86, 180, 49, 97, 209, 173, 179, 140, 174, 45, 18, 243, 136, 142, 68, 188, 76, 54, 204, 63, 165,
+    88, 178, 69, 0, 46, 10, 4, 1, 0, 0, 6, 35, 110, 98, 55, 172, 185, 117, 161, 44, 109, 124, 79, 167,
+    143, 119, 108, 166, 217, 144, 235, 148, 222, 127, 115, 108, 161, 116, 43, 218, 20, 77, 54, 91,
+};
+
+const EPS_ForestBinned eps_voltage_forest_binned = {
+    .n_features = 5,
+    .n_slots = 6,
+    .n_trees = 50,
+    .n_nodes = 2348,
+    .n_leaves = 1525,
+    .scale = 0.02,
+    .split_offset = voltage_bn_split_offset,
+    .split = voltage_bn_split,
+    .slot_feature = voltage_bn_slot_feature,
+    .slot_base = voltage_bn_slot_base,
+    .roots = voltage_roots,
+    .slot = voltage_bn_slot,
+    .bin = voltage_bn_bin,
+    .children = voltage_children,
+    .leaf_value = voltage_leaf_value,
+};
+
+#endif
+
+#if EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_IMPLICIT)
+
+#if EPS_IMPLICIT_DEPTH != 6
+#error "tables generated for EPS_IMPLICIT_DEPTH 6"
+#endif
+
+static const uint8_t voltage_im_feature[3150] = {
+    0, 0, 0, 4, 3, 3, 0, 0, 3, 2, 0, 0, 0, 0, 0, 0, 3, 0, 0, 2, 1, 4, 1, 0,
+    4, 3, 0, 2, 3, 0, 2, 4, 3, 3, 4, 4, 3, 0, 2, 3, 0, 0, 0, 4, 0, 3, 0, 2,
+    1, 0, 2, 3, 0, 0, 0, 3, 3, 0, 0, 2, 0, 0, 3, 0, 0, 0, 0, 2, 3, 0, 0, 2,
+    0, 4, 0, 4, 0, 0, 0, 2, 0, 0, 3, 0, 0, 0, 4, 0, 1, 3, 3, 2, 0, 0, 0, 0,
+    3, 0, 3, 3, 2, 0, 0, 0, 0, 0, 2, 0, 2, 0, 1, 0, 3, 0, 0, 3, 3, 0, 3, 2,
+    0, 2, 3, 0, 3, 2, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, 4, 3, 0, 0, 0, 0,
+    0, 4, 1, 2, 0, 2, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2,
+    3, 0, 0, 4, 1, 3, 1, 0, 0, 1, 1, 0, 0, 4, 3, 1, 3, 2, 0, 0, 2, 0, 0, 0,
+    0, 2, 3, 0, 0, 1, 2, 0, 0, 4, 3, 0, 0, 3, 1, 3, 0, 0, 0, 4, 0, 3, 1, 0,
+    3, 0, 1, 0, 0, 2, 4, 2, 0, 2, 0, 2, 0, 0, 0, 0, 3, 4, 0, 2, 3, 2, 0, 1,
+    1, 2, 0, 0, 3, 0, 0, 0, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 1,
+    3, 4, 0, 0, 0, 0, 0, 0, 3, 2, 3, 0, 0, 0, 0, 4, 4, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 4, 0, 2, 3, 0, 1, 0, 4, 1, 0, 0, 0, 0, 1, 0, 1, 3,
+    2, 0, 1, 0, 0, 0, 0, 3, 3, 0, 0, 0, 2, 4, 0, 0, 3, 0, 0, 0, 4, 4, 0, 2,
+    0, 4, 4, 0, 2, 0, 1, 1, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 3, 0,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 3, 0, 4, 4, 2, 0, 0, 2, 0, 0, 0, 0, 0, 3,
+    0, 0, 0, 4, 3, 0, 4, 3, 0, 0, 0, 0, 0, 0, 3, 2, 2, 2, 0, 3, 3, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 4, 0, 0, 1, 2, 0, 3, 3, 0, 2, 0,
+    0, 3, 0, 1, 0, 3, 1, 4, 2, 0, 0, 0, 0, 4, 3, 0, 0, 0, 2, 4, 0, 0, 3, 0,
+    0, 0, 4, 1, 0, 0, 4, 0, 1, 0, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0,
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 4, 3, 0, 0, 4, 0, 0, 4, 0, 0, 3, 0, 0, 2,
+    0, 0, 0, 0, 2, 3, 0, 4, 2, 3, 0, 0, 0, 3, 0, 0, 3, 2, 0, 0, 0, 3, 3, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 2, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 3, 0, 3, 0, 4,
+    0, 2, 0, 4, 0, 0, 2, 3, 1, 0, 0, 3, 0, 0, 2, 0, 0, 0, 4, 3, 0, 0, 0, 3,
+    4, 4, 3, 3, 3, 0, 0, 1, 1, 3, 0, 2, 3, 0, 2, 3, 0, 1, 0, 0, 0, 0, 3, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 3, 0, 4, 4, 0, 0, 2, 1,
+    0, 0, 2, 1, 4, 2, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 0, 4, 3, 0, 3, 4, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 3, 2, 2, 3, 0, 0,
+    0, 3, 0, 4, 0, 0, 0, 0, 0, 1, 0, 0, 0, 4, 4, 0, 0, 3, 0, 0, 2, 0, 0, 0,
+    0, 2, 3, 0, 0, 0, 4, 0, 0, 1, 3, 0, 0, 0, 0, 3, 2, 0, 3, 4, 1, 3, 4, 4,
+    0, 0, 1, 0, 0, 0, 0, 0, 3, 2, 2, 0, 3, 0, 0, 0, 2, 3, 0, 1, 3, 0, 0, 3,
+    1, 0, 0, 0, 3, 1, 0, 0, 3, 4, 0, 2, 0, 0, 0, 0, 3, 3, 0, 0, 0, 2, 0, 0,
+    4, 3, 0, 0, 0, 0, 2, 0, 0, 3, 4, 1, 4, 1, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 3, 0, 0, 0, 2, 0, 0, 0, 4, 3, 3, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    2, 1, 0, 0, 4, 4, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 2, 0, 0,
+    0, 0, 3, 0, 0, 4, 0, 4, 0, 2, 4, 3, 3, 0, 3, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 3, 3, 4, 4, 0, 0, 0, 0, 0, 0, 2, 4, 0, 4, 0, 0, 0, 3, 2, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 3, 0, 4, 3, 1, 4, 1, 0, 0, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 2, 3, 0, 4, 1, 2, 1, 0, 1, 0, 0,
+    0, 3, 0, 0, 0, 2, 2, 4, 0, 0, 3, 1, 3, 2, 1, 1, 0, 0, 0, 3, 0, 0, 3, 0,
+    0, 0, 0, 0, 3, 1, 0, 2, 1, 4, 1, 3, 3, 2, 4, 0, 0, 4, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 3, 0, 0, 2, 4, 0, 0, 4, 3, 0, 4, 3, 0, 3, 3, 2, 0, 2, 0,
+    4, 3, 4, 4, 0, 0, 0, 1, 4, 4, 4, 0, 0, 4, 0, 2, 0, 0, 0, 0, 4, 1, 0, 2,
+    0, 0, 0, 0, 0, 4, 2, 2, 1, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0,
+    1, 0, 4, 3, 3, 1, 0, 0, 0, 2, 3, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 4, 3, 0, 2, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 3, 0, 2, 4, 3, 0, 2, 3,
+    0, 0, 3, 0, 4, 4, 0, 0, 0, 0, 3, 3, 0, 0, 0, 4, 0, 0, 2, 0, 0, 0, 0, 0,
+    2, 2, 0, 2, 4, 2, 0, 4, 1, 2, 2, 0, 0, 0, 0, 0, 0, 4, 3, 0, 3, 0, 0, 0,
+    0, 2, 2, 0, 0, 4, 0, 2, 4, 4, 0, 0, 0, 0, 0, 0, 3, 3, 4, 0, 2, 0, 0, 0,
+    0, 2, 3, 0, 0, 3, 2, 0, 0, 0, 3, 0, 0, 2, 3, 3, 0, 0, 1, 0, 2, 4, 0, 0,
+    0, 4, 0, 0, 4, 3, 0, 3, 0, 0, 2, 3, 0, 0, 0, 0, 4, 1, 0, 0, 1, 3, 4, 0,
+    0, 0, 0, 0, 2, 2, 1, 2, 3, 3, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 1, 2, 2, 0,
+    1, 3, 0, 0, 2, 3, 3, 0, 1, 3, 1, 2, 0, 4, 3, 0, 4, 0, 0, 3, 2, 1, 0, 0,
+    0, 0, 2, 0, 0, 0, 2, 1, 0, 4, 0, 4, 4, 0, 4, 3, 3, 2, 0, 4, 0, 0, 3, 3,
+    3, 1, 0, 0, 0, 0, 4, 2, 0, 0, 0, 3, 0, 0, 2, 3, 4, 2, 0, 3, 4, 0, 0, 0,
+    3, 0, 0, 0, 0, 1, 0, 4, 1, 0, 0, 0, 2, 3, 0, 4, 0, 1, 0, 0, 0, 0, 2, 3,
+    0, 0, 4, 0, 1, 1, 4, 0, 4, 0, 1, 3, 3, 1, 0, 0, 0, 4, 0, 0, 0, 0, 2, 3,
+    0, 0, 0, 2, 0, 0, 1, 3, 0, 0, 0, 0, 1, 4, 0, 1, 0, 0, 0, 2, 0, 0, 1, 3,
+    0, 0, 0, 0, 0, 0, 2, 3, 0, 2, 2, 3, 0, 2, 4, 3, 4, 4, 0, 0, 1, 0, 0, 0,
+    0, 2, 4, 0, 0, 3, 4, 0, 2, 0, 0, 0, 4, 3, 0, 0, 2, 3, 3, 1, 2, 3, 3, 0,
+    0, 4, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 2, 3, 0, 2, 4, 2, 2,
+    0, 0, 0, 0, 4, 2, 0, 0, 1, 0, 4, 0, 4, 4, 4, 0, 0, 1, 0, 0, 2, 0, 0, 2,
+    0, 0, 0, 0, 3, 3, 0, 0, 2, 4, 1, 0, 3, 3, 0, 0, 2, 0, 3, 2, 0, 0, 4, 4,
+    4, 2, 1, 0, 0, 3, 0, 4, 3, 0, 2, 1, 0, 0, 4, 0, 2, 0, 1, 3, 2, 0, 3, 1,
+    0, 0, 4, 0, 0, 0, 0, 2, 3, 1, 3, 1, 0, 0, 0, 0, 0, 0, 4, 3, 3, 0, 0, 3,
+    2, 0, 0, 1, 2, 0, 0, 1, 0, 0, 3, 0, 2, 3, 0, 0, 1, 3, 0, 0, 2, 0, 1, 0,
+    4, 0, 1, 0, 4, 2, 0, 4, 0, 0, 2, 3, 2, 3, 0, 0, 2, 1, 0, 0, 0, 0, 4, 3,
+    0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 4, 0, 0, 3, 0, 0, 0, 4,
+    2, 2, 0, 0, 1, 0, 4, 3, 3, 0, 3, 1, 0, 0, 0, 0, 0, 0, 3, 4, 3, 0, 3, 0,
+    0, 4, 4, 0, 0, 4, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    4, 2, 3, 0, 0, 3, 4, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 4, 1, 3, 4, 3,
+    0, 0, 0, 1, 0, 0, 2, 3, 4, 4, 0, 1, 0, 2, 0, 2, 0, 4, 2, 3, 0, 4, 0, 0,
+    1, 0, 0, 0, 2, 3, 0, 0, 2, 0, 0, 4, 0, 0, 0, 0, 2, 3, 0, 0, 4, 4, 0, 0,
+    4, 3, 0, 0, 0, 3, 3, 2, 1, 2, 1, 0, 3, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 4,
+    1, 1, 0, 0, 0, 0, 0, 0, 4, 1, 0, 4, 0, 3, 0, 0, 4, 0, 0, 3, 4, 4, 2, 0,
+    0, 4, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 4, 0, 3, 3,
+    3, 1, 4, 4, 1, 0, 0, 1, 2, 0, 0, 0, 0, 0, 1, 3, 2, 2, 2, 0, 0, 1, 4, 0,
+    0, 1, 1, 0, 0, 4, 3, 0, 0, 0, 4, 4, 0, 4, 0, 3, 0, 1, 0, 0, 0, 0, 3, 3,
+    0, 0, 2, 4, 0, 0, 4, 3, 0, 0, 2, 1, 2, 0, 3, 2, 0, 1, 0, 2, 0, 0, 3, 3,
+    0, 4, 3, 0, 3, 0, 3, 0, 2, 0, 0, 3, 0, 0, 4, 0, 0, 3, 1, 0, 1, 2, 1, 0,
+    0, 3, 3, 0, 4, 3, 0, 0, 1, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 4, 1, 3, 3, 2, 4, 0, 0, 3, 3, 3, 0, 4, 0, 0, 0, 0, 0, 4, 2, 1, 3,
+    1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 4, 3, 1, 0, 0, 3, 0, 0, 4, 3, 0, 0,
+    0, 0, 0, 0, 2, 3, 0, 4, 3, 2, 4, 0, 1, 0, 0, 0, 2, 4, 0, 0, 4, 3, 2, 0,
+    0, 3, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 0, 3, 0, 2, 0, 0,
+    4, 2, 2, 1, 4, 1, 0, 3, 4, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0,
+    4, 0, 0, 1, 0, 0, 0, 0, 0, 2, 1, 0, 1, 3, 4, 4, 1, 3, 3, 2, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 3, 0, 0, 0, 1, 0, 3, 0, 0,
+    0, 3, 3, 0, 3, 2, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 4, 0, 3, 0, 0, 0, 0,
+    0, 0, 2, 2, 0, 1, 3, 2, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 4,
+    0, 2, 3, 3, 0, 2, 0, 0, 0, 4, 2, 4, 0, 0, 4, 1, 1, 3, 1, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 2, 3, 0, 0, 4, 3, 0, 0, 3, 0, 3, 0, 4, 4, 1, 2, 3, 0, 3,
+    0, 0, 0, 0, 4, 3, 4, 2, 3, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 2,
+    4, 3, 0, 0, 3, 3, 3, 3, 3, 1, 0, 2, 0, 0, 0, 0, 3, 3, 0, 0, 0, 4, 4, 0,
+    3, 0, 0, 0, 0, 0, 2, 1, 4, 0, 0, 4, 4, 0, 0, 3, 3, 1, 0, 0, 0, 0, 0, 3,
+    2, 0, 2, 4, 0, 0, 0, 3, 3, 3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 3, 3, 0, 0, 1, 2, 0, 0, 0, 3, 0, 0, 2, 4, 0, 1, 1,
+    4, 1, 2, 3, 4, 0, 0, 0, 3, 0, 4, 0, 0, 2, 0, 0, 3, 2, 0, 0, 0, 0, 2, 0,
+    3, 0, 4, 0, 0, 4, 4, 0, 0, 0, 1, 3, 0, 4, 0, 0, 0, 2, 0, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 2, 2, 4, 3, 0, 0, 0, 0, 0, 0, 2, 0, 4, 1, 4, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 3, 3, 0, 4, 1, 2, 0, 0, 0, 4, 3, 0,
+    0, 0, 0, 1, 1, 3, 2, 4, 0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 4, 2, 4, 0, 4, 1, 0, 0, 0, 1, 3, 3, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, 0, 0, 4, 0, 4, 0, 0, 0, 3, 4, 0, 0, 0, 0, 3, 4, 0, 0, 1, 0, 3, 2,
+    0, 0, 0, 0, 3, 3, 0, 0, 4, 0, 0, 0, 1, 3, 0, 0, 0, 0, 3, 1, 3, 0, 0, 3,
+    0, 3, 0, 4, 1, 3, 0, 0, 0, 0, 0, 0, 3, 1, 0, 2, 0, 0, 0, 3, 1, 4, 0, 4,
+    0, 2, 4, 0, 2, 0, 0, 2, 1, 0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0,
+    0, 3, 4, 3, 3, 0, 0, 0, 0, 0, 0, 2, 1, 0, 4, 4, 0, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 4, 0, 2, 0, 3, 2, 3, 0, 1, 0, 4, 3, 0, 0, 0, 0,
+    4, 0, 0, 1, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 2, 4, 0, 1, 3, 1, 0, 0, 4,
+    1, 4, 0, 0, 2, 4, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 3, 0, 0, 0, 0,
+    0, 0, 3, 0, 0, 0, 1, 4, 0, 0, 1, 0, 0, 2, 3, 0, 0, 3, 3, 0, 0, 0, 0, 0,
+    0, 1, 3, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 4, 2, 0, 0, 1, 2, 2, 0, 1, 2,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 0, 0, 0, 1, 4, 1, 1, 1, 0, 3, 3,
+    3, 0, 0, 2, 3, 3, 0, 0, 0, 0, 4, 2, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 4, 0,
+    0, 2, 0, 0, 0, 0, 1, 0, 0, 3, 4, 4, 0, 1, 3, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    2, 4, 0, 0, 0, 0, 0, 2, 4, 2, 0, 1, 4, 1, 3, 2, 4, 1, 0, 0, 3, 0, 1, 0,
+    3, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 1, 0, 0, 4, 3, 0, 0, 0, 0, 1, 2, 0,
+    1, 1, 3, 3, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 3, 2, 0, 3, 0, 0, 0, 0, 1, 0,
+    3, 0, 4, 4, 0, 4, 1, 2, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 3, 3,
+    0, 4, 1, 2, 0, 0, 3, 2, 0, 4, 3, 1, 2, 0, 2, 1, 3, 4, 4, 2, 0, 0, 1, 2,
+    1, 2, 2, 0, 3, 0, 0, 0, 4, 0, 0, 0, 0, 1, 1, 4, 0, 4, 2, 0, 0, 0, 4, 0,
+    0, 4, 3, 0, 0, 0, 3, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 4, 0, 3, 0,
+    0, 0, 0, 0, 0, 2, 2, 0, 2, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 2, 4, 0, 0, 0, 0, 0, 3, 0, 2, 0, 0, 0, 0, 0, 0, 3, 1, 0, 2, 3, 0, 0,
+    0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 1, 3, 1, 1, 3,
+    0, 4, 2, 0, 1, 0, 2, 0, 0, 0, 0, 0, 3, 4, 1, 0, 0, 0, 0, 3, 2, 2, 0, 2,
+    0, 4, 3, 0, 0, 4, 0, 2, 3, 0, 3, 3, 0, 0, 4, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 3, 0, 3, 3, 0, 0, 0, 0, 0, 0, 2, 4, 2, 3, 1, 2, 3, 0, 1, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 2, 0, 2, 0, 0, 2, 4, 4, 0, 0, 0, 3, 4, 4, 0, 3, 2,
+    4, 1, 0, 0, 0, 0,
+};
+
+static const double voltage_im_threshold[3150] = {
+    2865.5399169921875, 1430.8599853515625, 4824.47998046875, 1266.0250244140625,
+    1338.5250244140625, 5158.72998046875, 5182.385009765625, 1279.0,
+    1266.0250244140625, 1337.7599487304688, 1730.0049438476562, 4177.35498046875,
+    4672.619873046875, 4999.235107421875, 5288.4599609375, 1259.9200439453125,
+    1263.7350463867188, 1261.4450073242188, 1312.5750122070312, 1324.7849731445312,
+    1585.7749633789062, 4603.93994140625, 4043.0399169921875, 3351.6500244140625,
+    5240.385009765625, 5280.070068359375, 0.0, 5075.550048828125,
+    5264.804931640625, 5217.489990234375, 5399.114990234375, 1258.39501953125,
+    1256.8699951171875, 1258.39501953125, 1258.39501953125, 1270.60498046875,
+    1261.4450073242188, 1284.3399658203125, 1308.760009765625, 1276.7100219726562,
+    0.0, 0.0, 0.0, 2317.614990234375,
+    1539.2249755859375, 4368.135009765625, 0.0, 2074.93994140625,
+    2154.3050537109375, 4688.64501953125, 4990.844970703125, 5227.4150390625,
+    0.0, 0.0, 0.0, 4635.989990234375,
+    5170.175048828125, 5069.445068359375, 0.0, 5066.394775390625,
+    5256.41015625, 5306.014892578125, 5397.590087890625, 3078.449951171875,
+    1666.6649780273438, 4892.400146484375, 1332.4149780273438, 1501.8300170898438,
+    5154.9150390625, 5182.385009765625, 1264.5, 1318.6799926757812,
+    2197.0399780273438, 4969.47509765625, 4530.675048828125, 5217.4951171875,
+    5048.074951171875, 5289.22509765625, 1258.39501953125, 1266.0250244140625,
+    1406.4400024414062, 1592.64501953125, 1284.3400268554688, 0.0,
+    2560.2900390625, 2284.0350341796875, 1526.25, 4734.43505859375,
+    4921.39501953125, 5195.360107421875, 5219.02001953125, 3008.2400512695312,
+    5204.51513671875, 5340.35498046875, 1256.8699951171875, 1261.4450073242188,
+    1266.0250244140625, 1296.550048828125, 1379.72998046875, 1295.0250244140625,
+    3037.239990234375, 0.0, 0.0, 0.0,
+    0.0, 0.0, 2061.2050170898438, 3031.135009765625,
+    2864.7750244140625, 0.0, 4513.125, 3771.364990234375,
+    4718.405029296875, 4787.849853515625, 4423.83984375, 5243.440185546875,
+    5186.965087890625, 0.0, 5144.994873046875, 5138.125,
+    0.0, 5248.02001953125, 5238.094970703125, 5222.8349609375,
+    5308.30517578125, 5396.824951171875, 1816.239990234375, 627.2899780273438,
+    4775.639892578125, 0.0, 1425.52001953125, 5154.9150390625,
+    5070.969970703125, 0.0, 0.0, 1332.4149780273438,
+    1340.050048828125, 3736.2650146484375, 5245.724853515625, 5156.440185546875,
+    5257.175048828125, 0.0, 0.0, 0.0,
+    0.0, 1266.0250244140625, 1304.1799926757812, 1291.9700317382812,
+    1512.5150146484375, 2062.7249755859375, 4297.159912109375, 4892.39990234375,
+    4877.14013671875, 4905.369873046875, 4970.239990234375, 5181.625,
+    5340.35498046875, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0,
+    0.0, 1279.0, 1259.9199829101562, 1285.864990234375,
+    1299.60498046875, 0.0, 0.0, 2193.989990234375,
+    1619.3499755859375, 3005.9498901367188, 4271.21484375, 4272.739990234375,
+    4688.64501953125, 4803.8798828125, 5000.0, 0.0,
+    0.0, 5223.594970703125, 4775.639892578125, 4960.31494140625,
+    5260.989990234375, 5245.72998046875, 5217.489990234375, 5306.014892578125,
+    5399.114990234375, 2847.219970703125, 1659.0349731445312, 4822.190185546875,
+    1370.5750122070312, 1454.5150146484375, 5158.72998046875, 5070.969970703125,
+    1264.5, 1350.7349853515625, 1344.625, 2377.135009765625,
+    4087.300048828125, 5245.724853515625, 5162.545166015625, 5182.385009765625,
+    1259.9200439453125, 1266.0250244140625, 1324.7849731445312, 1493.4400024414062,
+    0.0, 0.0, 2131.4100341796875, 1454.52001953125,
+    3321.8900146484375, 5154.9150390625, 4841.27001953125, 0.0,
+    4757.324951171875, 4897.7451171875, 3208.9400024414062, 5291.514892578125,
+    1258.39501953125, 1258.39501953125, 1267.5549926757812, 1266.0250244140625,
+    0.0, 1291.9700317382812, 1495.7250366210938, 3043.3450927734375,
+    0.0, 0.0, 0.0, 0.0,
+    2139.0449829101562, 2792.280029296875, 0.0, 2378.6600341796875,
+    2502.2900390625, 1455.2799682617188, 4639.039794921875, 4916.820068359375,
+    4685.594970703125, 5088.52001953125, 0.0, 0.0,
+    4442.919921875, 4905.369873046875, 0.0, 5069.445068359375,
+    0.0, 5090.050048828125, 5162.545166015625, 5309.829833984375,
+    1841.4249877929688, 627.2899780273438, 4498.6298828125, 0.0,
+    1430.8599853515625, 3530.97998046875, 4914.530029296875, 0.0,
+    0.0, 1266.0250244140625, 1393.469970703125, 1992.5199584960938,
+    5078.60009765625, 5241.909912109375, 5184.675048828125, 0.0,
+    0.0, 0.0, 0.0, 1266.0250244140625,
+    1266.0250244140625, 1317.9199829101562, 1584.25, 2154.3050537109375,
+    2865.5399169921875, 3936.2049560546875, 0.0, 5220.545166015625,
+    5245.724853515625, 5070.969970703125, 5309.829833984375, 0.0,
+    0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 1259.9200439453125,
+    1256.8699951171875, 1266.0250244140625, 1333.1799926757812, 4809.97998046875,
+    0.0, 1495.7250366210938, 3992.6749267578125, 1990.2350463867188,
+    1708.6349487304688, 2062.7249755859375, 4781.75, 3812.5799560546875,
+    4303.264892578125, 0.0, 0.0, 4709.25,
+    4970.239990234375, 0.0, 4877.14013671875, 5141.94482421875,
+    3008.2400512695312, 5217.489990234375, 5355.614990234375, 3099.054931640625,
+    1666.6649780273438, 4893.1650390625, 627.2899780273438, 1403.3900146484375,
+    5168.650146484375, 5125.9150390625, 0.0, 1469.7799682617188,
+    1337.7599487304688, 2799.9100341796875, 4303.264892578125, 4822.195068359375,
+    5146.52001953125, 5267.85498046875, 0.0, 0.0,
+    1270.60498046875, 4423.074951171875, 0.0, 1358.364990234375,
+    2499.2349853515625, 4973.2900390625, 1594.1700439453125, 4690.93505859375,
+    4993.130126953125, 0.0, 5001.525146484375, 5075.550048828125,
+    5182.385009765625, 5340.35498046875, 0.0, 0.0,
+    0.0, 0.0, 1266.0250244140625, 1266.7899780273438,
+    1592.64501953125, 0.0, 0.0, 0.0,
+    0.0, 0.0, 1567.4600219726562, 2799.909912109375,
+    2453.449951171875, 0.0, 0.0, 3578.294921875,
+    4685.594970703125, 5223.594970703125, 0.0, 0.0,
+    0.0, 0.0, 4775.639892578125, 5083.18017578125,
+    5207.5751953125, 4676.429931640625, 5032.050048828125, 5214.440185546875,
+    5290.75, 5399.114990234375, 2865.5399169921875, 627.2899780273438,
+    4893.1650390625, 0.0, 1430.8599853515625, 5168.650146484375,
+    5127.445068359375, 0.0, 0.0, 1266.0250244140625,
+    1345.3900146484375, 4087.300048828125, 5216.72998046875, 5165.594970703125,
+    5276.2548828125, 0.0, 0.0, 0.0,
+    0.0, 1282.050048828125, 1266.0250244140625, 1317.9199829101562,
+    2293.9549560546875, 2574.784912109375, 4775.639892578125, 5213.68017578125,
+    5194.60009765625, 5048.074951171875, 5281.594970703125, 5204.51513671875,
+    5337.30517578125, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0,
+    0.0, 1259.9200439453125, 1294.260009765625, 1266.0250244140625,
+    1333.1799926757812, 4809.97998046875, 0.0, 1498.780029296875,
+    2377.135009765625, 1452.22998046875, 3308.9149169921875, 5141.18017578125,
+    5145.755126953125, 0.0, 5069.445068359375, 0.0,
+    0.0, 4830.5849609375, 5083.945068359375, 5092.340087890625,
+    0.0, 5235.0400390625, 5282.35498046875, 3250.1500244140625,
+    5367.824951171875, 2799.909912109375, 1666.6649780273438, 4858.059814453125,
+    627.2899780273438, 1333.1800537109375, 5154.9150390625, 5073.260009765625,
+    0.0, 1433.9149780273438, 1338.5249633789062, 4690.175048828125,
+    3985.0450439453125, 4696.27490234375, 5256.41015625, 5276.2548828125,
+    0.0, 0.0, 1266.0250244140625, 1410.2550048828125,
+    1878.8150024414062, 0.0, 2728.175048828125, 0.0,
+    2633.544921875, 4582.570068359375, 5067.919921875, 5211.39013671875,
+    5131.260009765625, 0.0, 5182.385009765625, 5340.35498046875,
+    0.0, 0.0, 0.0, 0.0,
+    1279.0, 1266.0250244140625, 1276.7100219726562, 1620.8800048828125,
+    0.0, 0.0, 0.0, 0.0,
+    1691.8499755859375, 2178.7249755859375, 0.0, 0.0,
+    3433.3050537109375, 4388.73486328125, 1379.72998046875, 4523.044921875,
+    0.0, 4243.739990234375, 5238.860107421875, 0.0,
+    4938.18505859375, 5199.18017578125, 0.0, 0.0,
+    5264.804931640625, 5204.51513671875, 5289.98486328125, 5399.114990234375,
+    3419.570068359375, 1666.6649780273438, 4857.294921875, 1333.1799926757812,
+    1437.72998046875, 5154.9150390625, 5181.625, 1266.0250244140625,
+    1300.364990234375, 1298.8400268554688, 2679.3349609375, 4297.159912109375,
+    4750.454833984375, 5268.6201171875, 5288.4599609375, 1279.0,
+    1266.0250244140625, 1290.4450073242188, 1592.64501953125, 0.0,
+    0.0, 4291.820068359375, 5108.364990234375, 4252.135009765625,
+    4688.64501953125, 4672.619873046875, 5192.30517578125, 4999.239990234375,
+    0.0, 5204.51513671875, 5358.670166015625, 1259.9200439453125,
+    1278.2350463867188, 1266.0250244140625, 1288.9200439453125, 1374.3899536132812,
+    0.0, 1299.60498046875, 0.0, 0.0,
+    0.0, 0.0, 0.0, 2284.7999267578125,
+    2284.0350341796875, 2681.625, 0.0, 1797.925048828125,
+    0.0, 4698.56494140625, 4787.849853515625, 5090.81494140625,
+    0.0, 0.0, 5058.764892578125, 5219.02001953125,
+    3172.3098754882812, 0.0, 0.0, 5199.940185546875,
+    5254.885009765625, 5309.829833984375, 5399.114990234375, 2407.659912109375,
+    1465.9649658203125, 4892.400146484375, 1266.0250244140625, 1351.4949951171875,
+    3419.570068359375, 5182.385009765625, 1266.0250244140625, 1261.4450073242188,
+    4693.22509765625, 4969.47509765625, 1588.0650024414062, 5158.72998046875,
+    5268.6201171875, 5291.514892578125, 1258.39501953125, 1295.0249633789062,
+    1262.2100219726562, 1266.0250244140625, 1816.239990234375, 1302.655029296875,
+    1855.1600341796875, 0.0, 1400.3349609375, 5108.364990234375,
+    4689.41015625, 4970.239990234375, 5000.764892578125, 0.0,
+    5204.51513671875, 5342.64501953125, 1256.8699951171875, 1261.4450073242188,
+    1262.2100219726562, 1299.6050415039062, 0.0, 0.0,
+    1320.2050170898438, 1333.9450073242188, 0.0, 0.0,
+    0.0, 0.0, 1712.4550170898438, 3622.56005859375,
+    0.0, 0.0, 0.0, 0.0,
+    4578.7548828125, 0.0, 2371.7950439453125, 5224.360107421875,
+    4858.824951171875, 0.0, 5077.0751953125, 3321.8850708007812,
+    0.0, 0.0, 5177.044921875, 5258.7001953125,
+    5311.35498046875, 5396.824951171875, 2896.0599365234375, 1659.0349731445312,
+    4892.400146484375, 627.2899780273438, 1437.72998046875, 5158.72998046875,
+    5182.385009765625, 0.0, 1456.0449829101562, 3173.0751342773438,
+    2395.449951171875, 4530.675048828125, 4858.824951171875, 5040.445068359375,
+    5289.98486328125, 0.0, 0.0, 1312.5750122070312,
+    1351.4949951171875, 1298.8400268554688, 0.0, 2692.31005859375,
+    2951.0050048828125, 4528.385009765625, 5154.9150390625, 5245.724853515625,
+    5194.60009765625, 5176.284912109375, 5211.39013671875, 5217.489990234375,
+    5358.670166015625, 0.0, 0.0, 0.0,
+    0.0, 1264.5, 1291.2100219726562, 1302.655029296875,
+    1520.9100341796875, 1291.2050170898438, 0.0, 0.0,
+    0.0, 1485.0450439453125, 2312.2698974609375, 1474.3600463867188,
+    0.0, 4087.300048828125, 0.0, 4760.3798828125,
+    4797.77001953125, 4921.39501953125, 0.0, 0.0,
+    0.0, 5023.655029296875, 5110.655029296875, 5099.969970703125,
+    5122.85986328125, 5249.544921875, 5258.7001953125, 5339.58984375,
+    5399.114990234375, 3419.570068359375, 1666.6649780273438, 4863.400146484375,
+    627.2899780273438, 1437.72998046875, 5158.72998046875, 5182.385009765625,
+    0.0, 1333.1799926757812, 3173.0751342773438, 2131.4100341796875,
+    4297.159912109375, 4935.1298828125, 5268.6201171875, 5290.75,
+    0.0, 0.0, 1266.0250244140625, 1295.7899780273438,
+    1338.5249633789062, 0.0, 2160.4099731445312, 5237.3349609375,
+    4413.9150390625, 5154.9150390625, 5245.724853515625, 5225.885009765625,
+    5000.764892578125, 0.0, 5254.885009765625, 5358.670166015625,
+    0.0, 0.0, 0.0, 0.0,
+    1266.0250244140625, 1259.155029296875, 1290.4450073242188, 1620.8800048828125,
+    1291.2050170898438, 0.0, 0.0, 0.0,
+    1644.5349731445312, 3166.2099609375, 2912.8499755859375, 4072.0399169921875,
+    3770.6051025390625, 0.0, 4692.4599609375, 5156.440185546875,
+    4685.594970703125, 0.0, 0.0, 0.0,
+    5178.574951171875, 3172.3098754882812, 0.0, 0.0,
+    4865.68994140625, 3285.2550048828125, 5324.330078125, 5399.114990234375,
+    3078.449951171875, 1730.0049438476562, 4775.639892578125, 627.2899780273438,
+    1374.3900146484375, 5157.969970703125, 5086.235107421875, 0.0,
+    1331.6549682617188, 1334.7049560546875, 2313.7950439453125, 4297.159912109375,
+    5245.724853515625, 5178.574951171875, 5210.625, 0.0,
+    0.0, 1264.5, 1326.3150024414062, 0.0,
+    0.0, 2393.9249877929688, 2876.2200317382812, 4394.840087890625,
+    5224.360107421875, 4892.39990234375, 0.0, 4945.81494140625,
+    4970.239990234375, 2563.3400268554688, 5289.98486328125, 0.0,
+    0.0, 0.0, 0.0, 1259.9200439453125,
+    1258.39501953125, 1420.9400024414062, 1475.1199951171875, 0.0,
+    0.0, 0.0, 0.0, 1823.1099853515625,
+    2178.7249755859375, 2311.5050048828125, 3396.669921875, 1948.260009765625,
+    3851.4949951171875, 4688.64501953125, 0.0, 5000.0,
+    4685.594970703125, 0.0, 0.0, 5235.0400390625,
+    5165.594970703125, 5194.60009765625, 4030.8299560546875, 0.0,
+    5156.440185546875, 5275.489990234375, 5343.405029296875, 2905.97998046875,
+    627.2899780273438, 4893.1650390625, 0.0, 1620.8800048828125,
+    5149.5751953125, 5182.385009765625, 0.0, 0.0,
+    1469.0149536132812, 1440.780029296875, 4298.68505859375, 4672.619873046875,
+    5038.920166015625, 5290.75, 0.0, 0.0,
+    0.0, 0.0, 1264.5, 1351.4949951171875,
+    1344.625, 4043.0399169921875, 4272.739990234375, 4669.56494140625,
+    5067.919921875, 5190.780029296875, 5155.675048828125, 5264.804931640625,
+    5217.489990234375, 5358.670166015625, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 1258.39501953125, 1266.0250244140625,
+    0.0, 1520.9100341796875, 0.0, 0.0,
+    2293.9549560546875, 0.0, 2193.219970703125, 0.0,
+    4668.039794921875, 5224.360107421875, 0.0, 5206.044921875,
+    0.0, 4960.31494140625, 4848.900146484375, 5170.175048828125,
+    5224.360107421875, 0.0, 5247.2548828125, 5275.489990234375,
+    5324.330078125, 5402.169921875, 1909.3450317382812, 627.2899780273438,
+    4297.159912109375, 0.0, 1418.6499633789062, 4413.9150390625,
+    4931.31494140625, 0.0, 0.0, 1264.5,
+    1338.5250244140625, 1420.1749877929688, 5203.7548828125, 5241.909912109375,
+    5132.019775390625, 0.0, 0.0, 0.0,
+    0.0, 1258.39501953125, 1264.5, 2890.7200317382812,
+    1620.8800048828125, 4808.455078125, 3308.9149169921875, 3170.784912109375,
+    0.0, 5255.650146484375, 4943.52490234375, 5165.594970703125,
+    5275.489990234375, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0,
+    0.0, 1270.60498046875, 1261.4450073242188, 1262.9749755859375,
+    1266.0250244140625, 0.0, 4597.070068359375, 3864.469970703125,
+    1918.5, 2943.3750610351562, 1969.6249389648438, 1992.5199584960938,
+    4010.22998046875, 0.0, 3240.22998046875, 0.0,
+    0.0, 4638.27490234375, 0.0, 0.0,
+    0.0, 5052.655029296875, 5170.175048828125, 5217.489990234375,
+    5341.114990234375, 3419.570068359375, 1666.6649780273438, 4892.400146484375,
+    1465.9649658203125, 1547.6199951171875, 5154.9150390625, 5181.625,
+    1266.0250244140625, 1419.4150390625, 1338.5249633789062, 2293.9549560546875,
+    4669.56494140625, 4927.5, 5072.5, 5282.35498046875,
+    1266.0250244140625, 1259.9199829101562, 1469.7799682617188, 1498.780029296875,
+    0.0, 1358.364990234375, 2061.2050170898438, 5237.3349609375,
+    4668.039794921875, 4781.744873046875, 5170.179931640625, 4970.239990234375,
+    5166.364990234375, 3008.2400512695312, 5257.175048828125, 5368.590087890625,
+    1258.39501953125, 1288.155029296875, 0.0, 1266.0250244140625,
+    0.0, 0.0, 1740.6900024414062, 1520.14501953125,
+    0.0, 0.0, 0.0, 0.0,
+    1567.4600219726562, 2178.7249755859375, 2912.8499755859375, 4794.719970703125,
+    4498.6298828125, 4957.26513671875, 4657.35498046875, 4594.014892578125,
+    5157.969970703125, 5069.445068359375, 5233.52001953125, 0.0,
+    4994.655029296875, 3866.7601318359375, 0.0, 5211.39013671875,
+    5210.625, 5264.80517578125, 5306.014892578125, 5383.090087890625,
+    3419.570068359375, 1433.9149780273438, 4864.1650390625, 1264.5,
+    1340.050048828125, 5158.72998046875, 5073.260009765625, 1259.9200439453125,
+    1259.155029296875, 2892.2450561523438, 1917.7349853515625, 4297.919921875,
+    5190.780029296875, 5133.544921875, 5258.699951171875, 1258.39501953125,
+    1256.8699951171875, 0.0, 1266.0250244140625, 1298.8400268554688,
+    1291.9700317382812, 1730.0049438476562, 4877.14013671875, 4272.739990234375,
+    5240.385009765625, 5255.650146484375, 5235.0400390625, 5023.655029296875,
+    5069.445068359375, 5182.385009765625, 5339.58984375, 1256.8699951171875,
+    1270.60498046875, 1256.8699951171875, 1262.9749755859375, 0.0,
+    0.0, 1266.0250244140625, 1312.5750122070312, 1324.7849731445312,
+    0.0, 0.0, 0.0, 1498.780029296875,
+    1382.02001953125, 4090.349853515625, 0.0, 3847.679931640625,
+    0.0, 4700.090087890625, 4797.77001953125, 0.0,
+    0.0, 5225.885009765625, 4943.52490234375, 4680.25,
+    5070.969970703125, 5008.39501953125, 0.0, 3279.1499633789062,
+    5219.02001953125, 5290.75, 5399.114990234375, 2865.5399169921875,
+    1433.9149780273438, 4893.1650390625, 627.2899780273438, 1343.864990234375,
+    4291.81494140625, 5182.385009765625, 0.0, 1266.0250244140625,
+    1406.4400024414062, 1849.81494140625, 4419.260009765625, 5154.9150390625,
+    5268.6201171875, 5317.4599609375, 0.0, 0.0,
+    1259.9200439453125, 1258.39501953125, 1276.7100219726562, 1878.8150024414062,
+    1730.0049438476562, 4781.7451171875, 4079.669921875, 5108.364990234375,
+    4688.64501953125, 4696.27490234375, 5057.235107421875, 0.0,
+    5210.625, 5369.35498046875, 0.0, 0.0,
+    0.0, 0.0, 1258.39501953125, 1256.8699951171875,
+    0.0, 1264.5, 0.0, 0.0,
+    0.0, 0.0, 1620.8800048828125, 0.0,
+    2615.9949951171875, 4072.0399169921875, 3308.9149169921875, 0.0,
+    2864.7750244140625, 0.0, 4698.56494140625, 5209.860107421875,
+    5232.755126953125, 4877.14013671875, 5076.31494140625, 5220.544921875,
+    0.0, 0.0, 5241.909912109375, 5262.51513671875,
+    5353.330078125, 5403.69482421875, 2902.929931640625, 1430.8599853515625,
+    4857.294921875, 627.2899780273438, 1336.9949951171875, 5158.72998046875,
+    5178.574951171875, 0.0, 1264.5, 4877.900146484375,
+    1730.0049438476562, 4304.02490234375, 5083.945068359375, 4998.474853515625,
+    5288.4599609375, 0.0, 0.0, 1259.9200439453125,
+    1259.155029296875, 1304.9450073242188, 0.0, 1531.5950317382812,
+    4969.47509765625, 4425.369873046875, 4690.93505859375, 5245.724853515625,
+    5023.659912109375, 5064.864990234375, 3008.2400512695312, 5204.51513671875,
+    5358.670166015625, 0.0, 0.0, 0.0,
+    0.0, 1258.39501953125, 1258.39501953125, 0.0,
+    1266.0250244140625, 0.0, 0.0, 0.0,
+    0.0, 1474.3600463867188, 3350.125, 2620.574951171875,
+    2284.0350341796875, 4456.655029296875, 3204.364990234375, 4698.56494140625,
+    5224.35986328125, 5235.804931640625, 0.0, 0.0,
+    0.0, 4903.0849609375, 4902.320068359375, 0.0,
+    5215.965087890625, 5240.385009765625, 5222.830078125, 5324.330078125,
+    5393.77490234375, 1909.3450317382812, 1433.9149780273438, 4533.72998046875,
+    1333.9450073242188, 1377.4450073242188, 5160.255126953125, 4892.400146484375,
+    1264.5, 1301.8900146484375, 1317.9199829101562, 1797.9249877929688,
+    3079.2099609375, 4243.739990234375, 5154.9150390625, 5156.440185546875,
+    1259.9200439453125, 1258.39501953125, 1288.9199829101562, 1385.8400268554688,
+    0.0, 0.0, 1531.5950317382812, 0.0,
+    1565.1699829101562, 1381.2550048828125, 0.0, 0.0,
+    4708.48486328125, 5216.72998046875, 5057.235107421875, 5275.489990234375,
+    1258.39501953125, 1256.8699951171875, 0.0, 1266.0250244140625,
+    0.0, 0.0, 1376.6799926757812, 2993.7449340820312,
+    0.0, 0.0, 0.0, 0.0,
+    1349.9700317382812, 3183.760009765625, 0.0, 0.0,
+    1469.7799682617188, 4781.7451171875, 1291.9700317382812, 4177.35498046875,
+    0.0, 0.0, 0.0, 0.0,
+    4521.52001953125, 4658.8798828125, 4921.39501953125, 4946.580078125,
+    5131.260009765625, 5211.39013671875, 5204.51513671875, 5340.35498046875,
+    2865.5399169921875, 1630.7999877929688, 4863.400146484375, 1433.9149780273438,
+    1454.5150146484375, 5154.9150390625, 5099.969970703125, 1333.1799926757812,
+    1419.4150390625, 1334.7049560546875, 2500.0, 4303.264892578125,
+    4927.5, 5165.594970703125, 5275.489990234375, 1266.0250244140625,
+    1304.1799926757812, 1276.7100219726562, 1567.4599609375, 0.0,
+    1452.22998046875, 3956.81005859375, 4043.0399169921875, 1469.7799682617188,
+    4677.2001953125, 5245.724853515625, 5247.255126953125, 4932.079833984375,
+    4030.8299560546875, 5182.385009765625, 5309.829833984375, 1266.0250244140625,
+    1264.5, 1291.9700317382812, 1409.4950561523438, 0.0,
+    0.0, 1509.4600219726562, 3117.3650512695312, 0.0,
+    0.0, 0.0, 1358.364990234375, 2131.4100341796875,
+    0.0, 4171.2451171875, 0.0, 2974.6649169921875,
+    5241.909912109375, 4668.039794921875, 5223.594970703125, 5186.965087890625,
+    5157.969970703125, 5060.2900390625, 0.0, 5056.469970703125,
+    5054.945068359375, 0.0, 5172.465087890625, 5220.544921875,
+    4507.78515625, 5289.98486328125, 5383.85009765625, 1909.3450317382812,
+    1433.9149780273438, 4824.47998046875, 1270.60498046875, 1377.4450073242188,
+    3995.7249755859375, 5121.3349609375, 1275.9450073242188, 1266.7899780273438,
+    1571.2749633789062, 1723.905029296875, 1992.5199584960938, 5141.18017578125,
+    5220.544921875, 5286.93505859375, 1261.4450073242188, 1263.7350463867188,
+    1272.1300048828125, 1312.5750122070312, 0.0, 0.0,
+    1852.8699340820312, 0.0, 3433.3050537109375, 3431.780029296875,
+    4530.675048828125, 5006.10498046875, 4925.974853515625, 5228.175048828125,
+    3208.9400024414062, 5342.64501953125, 1258.39501953125, 1264.5,
+    1275.1800537109375, 1285.8699951171875, 0.0, 2988.4000854492188,
+    1284.3399658203125, 1307.9949951171875, 0.0, 0.0,
+    0.0, 0.0, 1465.2000122070312, 3864.469970703125,
+    0.0, 0.0, 2977.7149047851562, 0.0,
+    2013.125, 4334.554931640625, 1381.2550048828125, 4669.56494140625,
+    5245.72998046875, 0.0, 4802.349853515625, 5144.994873046875,
+    5194.60009765625, 5000.0, 0.0, 5204.51513671875,
+    5299.14501953125, 5383.85009765625, 3099.054931640625, 1433.9149780273438,
+    4776.39990234375, 627.2899780273438, 1394.2300415039062, 5173.989990234375,
+    5070.969970703125, 0.0, 1332.4199829101562, 1334.7049560546875,
+    1797.9249877929688, 4297.159912109375, 4892.39990234375, 5162.545166015625,
+    5204.51513671875, 0.0, 0.0, 1264.5,
+    1322.5, 4877.900146484375, 1990.2350463867188, 3183.760009765625,
+    2560.2900390625, 4262.054931640625, 4669.56494140625, 4991.60498046875,
+    0.0, 4905.369873046875, 4970.239990234375, 5251.070068359375,
+    5341.114990234375, 0.0, 0.0, 0.0,
+    0.0, 1259.9200439453125, 1259.9199829101562, 1288.9199829101562,
+    1352.260009765625, 1304.9450073242188, 1311.8099975585938, 1285.8699951171875,
+    0.0, 1520.9100341796875, 3276.1000366210938, 4339.1298828125,
+    4774.875, 4472.679931640625, 0.0, 4668.039794921875,
+    4548.22998046875, 0.0, 0.0, 0.0,
+    0.0, 4752.75, 5028.235107421875, 0.0,
+    5069.445068359375, 5023.66015625, 3088.3701171875, 5275.489990234375,
+    5402.1650390625, 1630.7999877929688, 1465.9649658203125, 4863.400146484375,
+    1266.0250244140625, 1692.6150512695312, 3597.375, 5110.655029296875,
+    1282.050048828125, 1266.0250244140625, 1285.1050415039062, 2995.2649536132812,
+    1992.5199584960938, 5158.72998046875, 5261.755126953125, 5267.85498046875,
+    1259.9200439453125, 1258.39501953125, 1266.0250244140625, 1314.864990234375,
+    0.0, 0.0, 1630.7999877929688, 0.0,
+    3332.5699462890625, 2739.625, 4297.159912109375, 4943.52490234375,
+    5144.994873046875, 0.0, 5181.625, 5342.64501953125,
+    1258.39501953125, 1258.39501953125, 1263.7350463867188, 1285.10498046875,
+    1261.4450073242188, 1269.844970703125, 1266.0250244140625, 1307.9949951171875,
+    0.0, 0.0, 0.0, 0.0,
+    3396.669921875, 1893.3150024414062, 0.0, 0.0,
+    1452.22998046875, 0.0, 4969.47509765625, 2954.0599365234375,
+    1929.945068359375, 5240.385009765625, 5245.724853515625, 0.0,
+    4938.18505859375, 4990.844970703125, 0.0, 0.0,
+    5248.02001953125, 5208.3349609375, 5288.4599609375, 5396.824951171875,
+    2865.5399169921875, 1465.9649658203125, 4824.47998046875, 1332.4149780273438,
+    1374.3900146484375, 5168.650146484375, 5070.969970703125, 1264.5,
+    1300.364990234375, 4693.22509765625, 3704.9749755859375, 4533.72998046875,
+    5197.650146484375, 5144.994873046875, 5182.385009765625, 1259.9200439453125,
+    1258.39501953125, 1386.5999755859375, 1307.9949951171875, 1327.8399658203125,
+    1469.7799682617188, 2131.4100341796875, 3015.1100463867188, 1415.5950317382812,
+    5219.01513671875, 4921.39501953125, 5000.0, 4948.869873046875,
+    4897.7451171875, 5264.804931640625, 5290.75, 1258.39501953125,
+    1256.8699951171875, 0.0, 1264.5, 1291.9700317382812,
+    0.0, 0.0, 1443.0750122070312, 0.0,
+    1358.364990234375, 0.0, 1403.3849487304688, 1794.1100463867188,
+    2564.864990234375, 0.0, 4948.10498046875, 4579.51513671875,
+    3736.2650146484375, 4688.64501953125, 5245.72998046875, 0.0,
+    0.0, 0.0, 0.0, 4760.3798828125,
+    4809.219970703125, 4970.239990234375, 5172.465087890625, 3208.9400024414062,
+    0.0, 5217.489990234375, 5338.065185546875, 2799.909912109375,
+    1465.9649658203125, 4780.21484375, 1266.0250244140625, 1351.4949951171875,
+    5154.9150390625, 5069.445068359375, 1269.0799560546875, 1266.0250244140625,
+    1334.7049560546875, 1797.9249877929688, 4291.81494140625, 4858.824951171875,
+    5079.364990234375, 5217.489990234375, 1258.39501953125, 1292.7350463867188,
+    1266.0250244140625, 1312.5750122070312, 1275.9450073242188, 0.0,
+    3305.860107421875, 2545.7899780273438, 4252.135009765625, 4689.41015625,
+    4736.724853515625, 5157.969970703125, 4907.659912109375, 4902.320068359375,
+    3131.1050415039062, 5340.35498046875, 1256.8699951171875, 1261.4450073242188,
+    1258.39501953125, 1301.1300048828125, 1261.4450073242188, 0.0,
+    1267.5549926757812, 1307.9949951171875, 0.0, 5090.81005859375,
+    0.0, 0.0, 1520.9100341796875, 5183.14990234375,
+    2241.2999877929688, 4210.925048828125, 3419.570068359375, 0.0,
+    4698.56494140625, 4657.35498046875, 0.0, 0.0,
+    0.0, 0.0, 5224.360107421875, 4809.219970703125,
+    0.0, 5092.340087890625, 0.0, 5182.385009765625,
+    5267.85498046875, 5396.824951171875, 3078.449951171875, 1666.6649780273438,
+    4892.400146484375, 627.2899780273438, 1454.5150146484375, 5168.650146484375,
+    5125.9150390625, 0.0, 1430.8599853515625, 4871.795166015625,
+    4969.47509765625, 4530.675048828125, 4740.5400390625, 5145.760009765625,
+    5258.7001953125, 0.0, 0.0, 1266.0250244140625,
+    1353.7850341796875, 1327.8399658203125, 0.0, 2395.449951171875,
+    2128.35498046875, 4528.385009765625, 5240.385009765625, 5280.070068359375,
+    5194.60009765625, 5044.260009765625, 5281.594970703125, 3208.9400024414062,
+    5309.829833984375, 0.0, 0.0, 0.0,
+    0.0, 1279.0, 1261.4450073242188, 4809.97998046875,
+    1575.0899658203125, 0.0, 1285.8699951171875, 0.0,
+    0.0, 2700.7050170898438, 2896.8250122070312, 0.0,
+    0.0, 5235.804931640625, 0.0, 4709.25,
+    4916.820068359375, 4243.739990234375, 0.0, 0.0,
+    0.0, 4932.079833984375, 5020.60498046875, 5062.5751953125,
+    0.0, 0.0, 5182.385009765625, 5289.98486328125,
+    5402.169921875, 2902.929931640625, 1465.9649658203125, 4858.059814453125,
+    1266.0250244140625, 1410.2550048828125, 5158.72998046875, 5127.445068359375,
+    1266.0250244140625, 1266.0250244140625, 4693.22509765625, 1730.0049438476562,
+    4291.81494140625, 4785.559814453125, 5281.594970703125, 5293.0400390625,
+    1258.39501953125, 1286.6300048828125, 1266.0250244140625, 1333.1799926757812,
+    1404.1549682617188, 1469.7799682617188, 1620.8800048828125, 4969.47509765625,
+    4413.9150390625, 5154.9150390625, 5245.724853515625, 5211.39013671875,
+    4998.47509765625, 0.0, 5181.625, 5358.670166015625,
+    1256.8699951171875, 1261.4450073242188, 1260.6849975585938, 1275.1800537109375,
+    1267.5549926757812, 1269.844970703125, 1288.9200439453125, 1301.8900146484375,
+    0.0, 1358.364990234375, 0.0, 1311.8099975585938,
+    1585.0150146484375, 2668.655029296875, 3984.280029296875, 4909.949951171875,
+    3985.0450439453125, 5249.5400390625, 4688.64501953125, 4797.77001953125,
+    4911.47998046875, 0.0, 0.0, 0.0,
+    5075.550048828125, 5154.155029296875, 0.0, 0.0,
+    5042.73486328125, 5217.489990234375, 5324.330078125, 5402.169921875,
+    2902.929931640625, 1469.7799682617188, 4754.27490234375, 627.2899780273438,
+    1402.6300048828125, 5135.074951171875, 5086.235107421875, 0.0,
+    1267.5549926757812, 3173.0751342773438, 2560.2900390625, 4531.440185546875,
+    5238.85986328125, 5145.760009765625, 5217.489990234375, 0.0,
+    0.0, 1266.0250244140625, 1261.4450073242188, 1338.5249633789062,
+    1403.3849487304688, 3790.445068359375, 2867.06494140625, 4524.570068359375,
+    4398.655029296875, 4892.39990234375, 0.0, 4907.659912109375,
+    4970.239990234375, 3208.9400024414062, 5290.75, 0.0,
+    0.0, 0.0, 0.0, 1266.0250244140625,
+    1266.0250244140625, 1260.6849975585938, 1312.5750122070312, 1878.8150024414062,
+    0.0, 0.0, 0.0, 2131.4100341796875,
+    3015.1100463867188, 2622.864990234375, 0.0, 4480.31005859375,
+    0.0, 3521.0599365234375, 4689.41015625, 0.0,
+    5080.89501953125, 0.0, 0.0, 4590.199951171875,
+    4822.190185546875, 5233.52001953125, 5194.594970703125, 0.0,
+    5182.39013671875, 1288.155029296875, 5369.35498046875, 3419.570068359375,
+    1430.8599853515625, 4825.2451171875, 627.2899780273438, 1410.2550048828125,
+    5158.72998046875, 5070.969970703125, 0.0, 1333.1799926757812,
+    1588.824951171875, 2131.4100341796875, 4303.264892578125, 5245.724853515625,
+    5178.574951171875, 5204.51513671875, 0.0, 0.0,
+    1266.0250244140625, 1336.9949951171875, 1295.0250244140625, 1278.2349853515625,
+    1605.614990234375, 4090.349853515625, 4485.64990234375, 5240.385009765625,
+    4892.39990234375, 0.0, 4947.344970703125, 4970.239990234375,
+    3208.9400024414062, 5309.829833984375, 0.0, 0.0,
+    0.0, 0.0, 1280.5250244140625, 1259.9199829101562,
+    1285.864990234375, 1326.3099975585938, 1304.9450073242188, 0.0,
+    0.0, 1389.6549682617188, 1376.6799926757812, 1523.9650268554688,
+    3078.449951171875, 4697.7998046875, 4350.580078125, 3824.02001953125,
+    4688.64501953125, 5245.72998046875, 5234.280029296875, 4685.594970703125,
+    0.0, 0.0, 3878.2049560546875, 4719.169921875,
+    4877.14013671875, 4030.8299560546875, 0.0, 5272.434814453125,
+    5276.2548828125, 5379.275146484375, 1909.3450317382812, 1430.8599853515625,
+    4758.85498046875, 1333.1799926757812, 1345.3900146484375, 5143.469970703125,
+    5070.969970703125, 1264.5, 1314.0999755859375, 2890.7200317382812,
+    1797.9249877929688, 4297.159912109375, 5245.724853515625, 5205.28515625,
+    5204.51513671875, 1259.9200439453125, 1258.39501953125, 1291.9700317382812,
+    1478.9400024414062, 0.0, 1295.0250244140625, 3305.860107421875,
+    0.0, 4394.840087890625, 4669.56494140625, 4993.130126953125,
+    0.0, 4997.710205078125, 5212.9150390625, 5265.56982421875,
+    5299.14501953125, 1258.39501953125, 1256.8699951171875, 0.0,
+    1266.0250244140625, 0.0, 1288.9199829101562, 1394.9949951171875,
+    4139.18994140625, 0.0, 0.0, 1276.7100219726562,
+    0.0, 1498.780029296875, 3268.4699096679688, 0.0,
+    0.0, 1398.0450439453125, 4774.114990234375, 4668.039794921875,
+    4668.804931640625, 4921.39501953125, 5000.0, 0.0,
+    0.0, 4658.1201171875, 4830.5849609375, 0.0,
+    3866.7601318359375, 5048.080078125, 0.0, 5262.51513671875,
+    5342.64501953125, 2902.929931640625, 1430.8599853515625, 4864.1650390625,
+    627.2899780273438, 1345.3900146484375, 5108.364990234375, 5078.60009765625,
+    0.0, 1333.1799926757812, 1588.824951171875, 1823.1099853515625,
+    4531.440185546875, 4787.090087890625, 5194.594970703125, 5181.625,
+    0.0, 0.0, 1270.60498046875, 1315.6300048828125,
+    1295.0250244140625, 1298.8400268554688, 1619.3499755859375, 4738.25,
+    4527.625, 4669.56494140625, 5143.469970703125, 5217.4951171875,
+    5144.994873046875, 0.0, 2599.969970703125, 5289.98486328125,
+    0.0, 0.0, 0.0, 0.0,
+    1266.0250244140625, 1262.2100219726562, 1291.9700317382812, 3026.5599365234375,
+    1355.3099975585938, 0.0, 1389.6549682617188, 0.0,
+    1581.1950073242188, 3037.239990234375, 2295.47998046875, 0.0,
+    3898.0499267578125, 0.0, 4667.27490234375, 4780.98486328125,
+    5219.014892578125, 5170.179931640625, 4967.184814453125, 0.0,
+    4907.659912109375, 5221.31005859375, 0.0, 0.0,
+    1669.7200317382812, 5226.64990234375, 5217.489990234375, 5343.405029296875,
+    2902.929931640625, 1630.7999877929688, 4863.400146484375, 1333.9450073242188,
+    1454.5150146484375, 5096.155029296875, 5144.9951171875, 1270.60498046875,
+    1299.60498046875, 1327.8399658203125, 4969.47509765625, 4144.53515625,
+    4935.89501953125, 4980.920166015625, 5288.4599609375, 1266.0250244140625,
+    1261.4450073242188, 3102.10986328125, 1427.0449829101562, 0.0,
+    2986.8750610351562, 2615.9949951171875, 4072.0399169921875, 3078.449951171875,
+    4690.93505859375, 5157.969970703125, 5060.2900390625, 5068.68017578125,
+    5161.019775390625, 5204.51513671875, 5340.35498046875, 1259.9200439453125,
+    1275.1849975585938, 1265.2650146484375, 1284.3399658203125, 0.0,
+    0.0, 1478.9400024414062, 1308.0, 0.0,
+    0.0, 0.0, 0.0, 1581.1950073242188,
+    2453.449951171875, 2864.7750244140625, 0.0, 0.0,
+    4562.724853515625, 4698.56494140625, 4657.35498046875, 4697.7998046875,
+    5245.724853515625, 4949.6298828125, 0.0, 4636.75,
+    5176.28515625, 5052.655029296875, 5062.5751953125, 5139.64990234375,
+    5276.2548828125, 5296.094970703125, 5390.719970703125, 3431.780029296875,
+    1666.6649780273438, 4892.400146484375, 627.2899780273438, 1550.6699829101562,
+    5158.72998046875, 5182.385009765625, 0.0, 1333.1799926757812,
+    4871.795166015625, 2620.574951171875, 4688.64501953125, 4858.824951171875,
+    5057.235107421875, 5289.98486328125, 0.0, 0.0,
+    1264.5, 1322.5, 1404.1549682617188, 0.0,
+    4043.0399169921875, 5108.364990234375, 1381.2550048828125, 5225.125,
+    4685.594970703125, 5170.179931640625, 5144.994873046875, 3008.2400512695312,
+    5217.489990234375, 5340.35498046875, 0.0, 0.0,
+    0.0, 0.0, 1259.9200439453125, 1266.0250244140625,
+    1406.4400024414062, 1620.8800048828125, 0.0, 0.0,
+    0.0, 0.0, 1730.0049438476562, 0.0,
+    4578.7548828125, 0.0, 4579.51513671875, 4716.114990234375,
+    4777.929931640625, 0.0, 0.0, 4803.8798828125,
+    0.0, 5194.60009765625, 4958.02490234375, 4943.52490234375,
+    0.0, 5041.97509765625, 5244.96484375, 5257.175048828125,
+    5311.35498046875, 5399.114990234375, 1666.6649780273438, 627.2899780273438,
+    4144.53515625, 0.0, 1333.9450073242188, 1392.7050170898438,
+    4914.530029296875, 0.0, 0.0, 1264.5,
+    1290.4450073242188, 4719.93505859375, 3363.094970703125, 5177.81005859375,
+    5197.650146484375, 0.0, 0.0, 0.0,
+    0.0, 1259.9200439453125, 1266.0250244140625, 1290.4450073242188,
+    1620.8800048828125, 1990.2350463867188, 1287.3900146484375, 2293.9549560546875,
+    5171.705078125, 4704.670166015625, 4943.52490234375, 5057.235107421875,
+    5288.4599609375, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0,
+    0.0, 1258.39501953125, 1256.8699951171875, 1266.0250244140625,
+    1284.3399658203125, 1285.864990234375, 1276.7100219726562, 1299.60498046875,
+    0.0, 1338.5249633789062, 0.0, 0.0,
+    0.0, 2692.31005859375, 3031.135009765625, 4783.27001953125,
+    0.0, 4508.544921875, 5228.175048828125, 4921.39501953125,
+    4970.239990234375, 5159.494873046875, 3172.3098754882812, 5258.7001953125,
+    5342.64501953125, 2865.5399169921875, 1659.0349731445312, 4822.190185546875,
+    1332.4149780273438, 1437.72998046875, 3985.0450439453125, 5125.9150390625,
+    1264.5, 1298.0750122070312, 1291.2050170898438, 1917.7349853515625,
+    3431.0150146484375, 5241.909912109375, 5162.545166015625, 5275.489990234375,
+    1259.9200439453125, 1266.0250244140625, 1423.989990234375, 3527.169921875,
+    0.0, 1288.155029296875, 2679.3350219726562, 1992.5199584960938,
+    2074.93994140625, 4493.284912109375, 4688.64501953125, 5167.89013671875,
+    5014.5, 4916.820068359375, 5204.51513671875, 5342.64501953125,
+    1258.39501953125, 1259.155029296875, 1267.5549926757812, 1266.0250244140625,
+    1374.3899536132812, 0.0, 1455.2850341796875, 1310.2849731445312,
+    0.0, 0.0, 0.0, 0.0,
+    1823.1099853515625, 0.0, 0.0, 2013.125,
+    0.0, 5108.364990234375, 3753.8199462890625, 3906.4400634765625,
+    1821.5799560546875, 5103.784912109375, 0.0, 0.0,
+    4729.090087890625, 5154.155029296875, 5194.60009765625, 5281.594970703125,
+    5063.33984375, 5282.35498046875, 5306.014892578125, 5399.114990234375,
+    2858.669921875, 1465.9649658203125, 4775.639892578125, 627.2899780273438,
+    1351.4949951171875, 5157.969970703125, 5099.969970703125, 0.0,
+    1332.4149780273438, 4693.22509765625, 4969.47509765625, 4087.300048828125,
+    5170.179931640625, 4979.39501953125, 5269.3798828125, 0.0,
+    0.0, 1266.0250244140625, 1300.364990234375, 1452.22998046875,
+    4912.239990234375, 2395.449951171875, 2284.0350341796875, 4429.94482421875,
+    5224.360107421875, 0.0, 4676.43505859375, 5205.28515625,
+    5141.94482421875, 3208.9400024414062, 5342.64501953125, 0.0,
+    0.0, 0.0, 0.0, 1266.0250244140625,
+    1258.39501953125, 1406.4400024414062, 1317.9199829101562, 1288.155029296875,
+    1816.239990234375, 0.0, 0.0, 1855.1600341796875,
+    2036.02001953125, 4909.949951171875, 0.0, 3308.9149169921875,
+    3917.1251220703125, 4533.72998046875, 0.0, 0.0,
+    0.0, 4547.465087890625, 0.0, 4976.344970703125,
+    5006.864990234375, 5053.420166015625, 5075.550048828125, 0.0,
+    5181.625, 5289.98486328125, 5389.955078125, 2865.5399169921875,
+    1433.9149780273438, 4863.400146484375, 1333.1799926757812, 1343.864990234375,
+    5158.72998046875, 5072.5, 1264.5, 1311.8150024414062,
+    1334.7049560546875, 1730.0049438476562, 4087.300048828125, 4858.824951171875,
+    5177.81005859375, 5204.51513671875, 1259.9200439453125, 1258.39501953125,
+    5017.554931640625, 1409.4950561523438, 1423.989990234375, 1452.22998046875,
+    2208.489990234375, 4043.0399169921875, 2574.784912109375, 5154.9150390625,
+    5245.724853515625, 0.0, 4902.320068359375, 4902.320068359375,
+    5232.7548828125, 5306.014892578125, 1258.39501953125, 1262.9749755859375,
+    0.0, 1264.5, 0.0, 0.0,
+    3026.5599365234375, 1433.1499633789062, 1452.22998046875, 0.0,
+    0.0, 1816.239990234375, 1474.3600463867188, 1659.0349731445312,
+    4368.135009765625, 0.0, 4710.77490234375, 3578.294921875,
+    4669.56494140625, 5245.72998046875, 5054.945068359375, 0.0,
+    0.0, 0.0, 4970.23486328125, 5140.414794921875,
+    0.0, 3866.7601318359375, 5144.9951171875, 5153.39013671875,
+    5275.489990234375, 5396.824951171875, 1666.6649780273438, 627.2899780273438,
+    4297.159912109375, 0.0, 1333.1799926757812, 1391.175048828125,
+    4892.400146484375, 0.0, 0.0, 1264.5,
+    1300.364990234375, 1423.989990234375, 4377.2900390625, 5157.204833984375,
+    5181.625, 0.0, 0.0, 0.0,
+    0.0, 1258.39501953125, 1264.5, 1406.4400024414062,
+    1461.3900146484375, 1452.22998046875, 4841.27001953125, 2419.1099853515625,
+    4980.925048828125, 4669.56494140625, 4672.619873046875, 5072.5,
+    5309.829833984375, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0,
+    0.0, 1270.60498046875, 1261.4450073242188, 1262.2149658203125,
+    1266.0250244140625, 1374.3899536132812, 1455.2799682617188, 1343.10498046875,
+    1585.0150146484375, 1324.7849731445312, 0.0, 0.0,
+    0.0, 2692.31005859375, 1797.9249877929688, 3218.0999755859375,
+    0.0, 4668.039794921875, 4825.2451171875, 4962.60986328125,
+    4970.239990234375, 5144.994873046875, 3008.2400512695312, 5183.91015625,
+    5342.64501953125, 3099.054931640625, 1666.6649780273438, 4822.190185546875,
+    627.2899780273438, 1501.8300170898438, 5241.909912109375, 5183.150146484375,
+    0.0, 1333.1799926757812, 1452.22998046875, 2560.2900390625,
+    4530.675048828125, 4663.4599609375, 4986.264892578125, 5275.489990234375,
+    0.0, 0.0, 1266.0250244140625, 1318.6799926757812,
+    1288.155029296875, 0.0, 4969.47509765625, 3099.054931640625,
+    4528.385009765625, 4690.93505859375, 0.0, 4877.14013671875,
+    5205.28515625, 5146.52001953125, 5228.175048828125, 5343.405029296875,
+    0.0, 0.0, 0.0, 0.0,
+    1266.0250244140625, 1266.0250244140625, 1406.4400024414062, 1620.8800048828125,
+    0.0, 0.0, 0.0, 0.0,
+    2740.3849487304688, 2284.0350341796875, 1485.0450439453125, 0.0,
+    4303.264892578125, 0.0, 4716.114990234375, 5200.699951171875,
+    0.0, 0.0, 0.0, 0.0,
+    4722.98486328125, 5181.625, 5170.175048828125, 5127.43994140625,
+    5240.385009765625, 5256.41015625, 5345.695068359375, 5399.114990234375,
+    3419.570068359375, 1433.9149780273438, 4863.400146484375, 627.2899780273438,
+    1340.050048828125, 5157.204833984375, 5069.445068359375, 0.0,
+    1267.5549926757812, 1588.824951171875, 2395.449951171875, 4144.53515625,
+    4935.1298828125, 5144.994873046875, 5211.385009765625, 0.0,
+    0.0, 1279.0, 1259.9199829101562, 1355.3099975585938,
+    1284.3400268554688, 1730.0049438476562, 3349.3599853515625, 2614.469970703125,
+    4689.41015625, 5170.179931640625, 4731.3798828125, 5025.945068359375,
+    4990.844970703125, 5272.434814453125, 5326.6201171875, 0.0,
+    0.0, 0.0, 0.0, 1259.9200439453125,
+    1279.760009765625, 1260.6849975585938, 1333.1799926757812, 1291.9700317382812,
+    0.0, 0.0, 0.0, 1575.0899658203125,
+    4043.0399169921875, 4782.510009765625, 0.0, 2940.3250732421875,
+    3597.375, 4698.56494140625, 5209.860107421875, 0.0,
+    5069.445068359375, 0.0, 4853.47998046875, 4805.405029296875,
+    5101.494873046875, 0.0, 5170.175048828125, 2563.3400268554688,
+    0.0, 5275.489990234375, 5358.670166015625, 1909.3450317382812,
+    627.2899780273438, 4002.594970703125, 0.0, 1430.8599853515625,
+    1398.0450439453125, 4822.190185546875, 0.0, 0.0,
+    1312.5750122070312, 1340.050048828125, 4719.93505859375, 5108.364990234375,
+    5154.9150390625, 5099.969970703125, 0.0, 0.0,
+    0.0, 0.0, 1264.5, 1308.760009765625,
+    1520.1449584960938, 1730.0049438476562, 2977.7149047851562, 4993.130126953125,
+    3078.449951171875, 3704.9749755859375, 4531.440185546875, 4696.27490234375,
+    5144.994873046875, 5266.330078125, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 1259.9200439453125, 1266.0250244140625,
+    3234.1298828125, 1352.260009765625, 1291.9700317382812, 0.0,
+    1575.0899658203125, 1581.1950073242188, 1285.864990234375, 0.0,
+    3055.554931640625, 0.0, 4753.510009765625, 4590.965087890625,
+    0.0, 0.0, 4528.385009765625, 4689.41015625,
+    5090.81494140625, 0.0, 4938.18505859375, 4970.239990234375,
+    5181.625, 5324.330078125, 3078.449951171875, 1430.8599853515625,
+    4864.93017578125, 627.2899780273438, 1305.7050170898438, 5149.5751953125,
+    5127.445068359375, 0.0, 1333.1799926757812, 1338.5249633789062,
+    4278.844970703125, 4087.300048828125, 4943.52490234375, 5281.594970703125,
+    5286.93505859375, 0.0, 0.0, 1270.60498046875,
+    1322.5, 1288.155029296875, 0.0, 1797.9249877929688,
+    3464.5899658203125, 4553.56982421875, 4556.625, 5170.179931640625,
+    5225.885009765625, 4999.239990234375, 0.0, 5211.39013671875,
+    5355.614990234375, 0.0, 0.0, 0.0,
+    0.0, 1266.0250244140625, 1262.9749755859375, 1379.72998046875,
+    1409.4950561523438, 0.0, 0.0, 0.0,
+    0.0, 1630.7999877929688, 2976.949951171875, 2100.1199951171875,
+    1962.760009765625, 3415.75, 2091.7300415039062, 2105.4649658203125,
+    4703.905029296875, 4750.454833984375, 4921.39501953125, 0.0,
+    0.0, 5075.550048828125, 5225.885009765625, 0.0,
+    0.0, 5243.43505859375, 5255.650146484375, 5336.5400390625,
+    5408.27001953125, 2865.5399169921875, 1752.1400146484375, 4892.400146484375,
+    628.0549926757812, 1610.9599609375, 5168.650146484375, 5182.385009765625,
+    0.0, 1333.1799926757812, 0.0, 2131.4100341796875,
+    3985.0450439453125, 4946.580078125, 5281.594970703125, 5289.22509765625,
+    0.0, 0.0, 1266.0250244140625, 1322.5,
+    0.0, 0.0, 1986.4200439453125, 2688.4949951171875,
+    2574.784912109375, 4688.64501953125, 4921.39501953125, 5103.02490234375,
+    5052.655029296875, 0.0, 5256.41015625, 5340.35498046875,
+    0.0, 0.0, 0.0, 0.0,
+    1279.0, 1266.0250244140625, 1311.0499877929688, 1512.5150146484375,
+    0.0, 0.0, 0.0, 0.0,
+    1823.1099853515625, 4087.300048828125, 1992.5199584960938, 4043.0399169921875,
+    2259.614990234375, 3530.97998046875, 4716.114990234375, 5150.335205078125,
+    5250.31005859375, 0.0, 0.0, 5113.704833984375,
+    5156.43994140625, 5211.39013671875, 0.0, 0.0,
+    5228.175048828125, 5266.330078125, 5293.0400390625, 5396.824951171875,
+    2865.5399169921875, 1666.6649780273438, 4863.400146484375, 628.0549926757812,
+    1382.0250244140625, 5154.9150390625, 5040.445068359375, 0.0,
+    1465.9649658203125, 2259.614990234375, 4969.47509765625, 4304.02490234375,
+    4763.429931640625, 5076.31494140625, 5211.385009765625, 0.0,
+    0.0, 1264.5, 1419.4150390625, 1878.8150024414062,
+    0.0, 2615.9949951171875, 5227.4150390625, 4410.864990234375,
+    4672.6201171875, 4892.39990234375, 5217.4951171875, 4947.344970703125,
+    4902.320068359375, 3131.1050415039062, 5299.14501953125, 0.0,
+    0.0, 0.0, 0.0, 1259.9200439453125,
+    1264.5, 4912.239990234375, 1520.14501953125, 0.0,
+    0.0, 0.0, 0.0, 2036.02001953125,
+    4494.81005859375, 2864.7750244140625, 0.0, 4250.610107421875,
+    4489.47021484375, 4144.53515625, 5086.22998046875, 4921.39501953125,
+    5080.89501953125, 4967.184814453125, 0.0, 4903.0849609375,
+    4822.955078125, 0.0, 5077.0751953125, 0.0,
+    5272.434814453125, 5256.41015625, 5367.824951171875, 3419.570068359375,
+    1659.0349731445312, 4824.47998046875, 627.2899780273438, 1481.989990234375,
+    5158.72998046875, 5110.655029296875, 0.0, 1370.5750122070312,
+    1455.2799682617188, 2168.8050537109375, 4303.264892578125, 5245.724853515625,
+    5165.594970703125, 5286.93505859375, 0.0, 0.0,
+    1266.0250244140625, 1375.9150390625, 1324.7849731445312, 0.0,
+    1986.4200439453125, 3974.35986328125, 2125.304931640625, 5154.9150390625,
+    4609.280029296875, 0.0, 4971.76513671875, 4970.239990234375,
+    5197.650146484375, 5358.670166015625, 0.0, 0.0,
+    0.0, 0.0, 1266.0250244140625, 1264.5,
+    1420.9400024414062, 1460.625, 0.0, 0.0,
+    0.0, 0.0, 1823.1099853515625, 0.0,
+    4368.135009765625, 0.0, 4676.43505859375, 4465.81005859375,
+    4688.64501953125, 5245.72998046875, 4803.8798828125, 5088.52001953125,
+    0.0, 0.0, 4907.659912109375, 5052.655029296875,
+    0.0, 3866.7601318359375, 5219.780029296875, 5226.650146484375,
+    5339.58984375, 5354.85009765625, 3431.0150146484375, 1630.7999877929688,
+    4857.294921875, 1465.9649658203125, 1403.3900146484375, 5199.18017578125,
+    5070.969970703125, 1267.5549926757812, 1433.1500244140625, 1337.7599487304688,
+    2560.2900390625, 4177.35498046875, 5280.070068359375, 5079.364990234375,
+    5204.51513671875, 1266.0250244140625, 1261.4450073242188, 1354.5449829101562,
+    1520.9100341796875, 0.0, 1358.364990234375, 2228.324951171875,
+    5108.364990234375, 4447.494873046875, 5241.14501953125, 5062.5751953125,
+    0.0, 4903.0849609375, 4992.3701171875, 3268.4649047851562,
+    5309.829833984375, 1282.050048828125, 1266.0250244140625, 1262.2100219726562,
+    1266.0250244140625, 0.0, 0.0, 0.0,
+    2290.9049682617188, 0.0, 0.0, 0.0,
+    0.0, 2036.02001953125, 2545.02490234375, 4782.510009765625,
+    0.0, 3518.77490234375, 3964.4400634765625, 4689.41015625,
+    0.0, 0.0, 5170.175048828125, 0.0,
+    0.0, 5086.235107421875, 4802.349853515625, 0.0,
+    4934.3701171875, 0.0, 5041.97509765625, 5275.489990234375,
+    5370.880126953125, 1666.6649780273438, 627.2899780273438, 4530.675048828125,
+    0.0, 1465.9649658203125, 4902.320068359375, 4864.1650390625,
+    0.0, 0.0, 1312.5750122070312, 1380.4949951171875,
+    4447.494873046875, 4243.739990234375, 5168.650146484375, 5182.385009765625,
+    0.0, 0.0, 0.0, 0.0,
+    1266.0250244140625, 1307.9949951171875, 1302.655029296875, 1567.4600219726562,
+    1485.8049926757812, 2407.659912109375, 0.0, 0.0,
+    5120.5751953125, 4858.824951171875, 4980.920166015625, 5289.98486328125,
+    0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0,
+    1266.0250244140625, 1264.5, 4779.4599609375, 1351.5,
+    0.0, 0.0, 1498.780029296875, 0.0,
+    1298.8400268554688, 2912.8499755859375, 4052.2000732421875, 3183.7598876953125,
+    0.0, 0.0, 0.0, 0.0,
+    4678.72509765625, 5156.440185546875, 4991.60498046875, 0.0,
+    5028.235107421875, 5264.804931640625, 5211.385009765625, 5369.35498046875,
+    2902.929931640625, 1465.9649658203125, 4864.1650390625, 627.2899780273438,
+    1351.4949951171875, 5149.5751953125, 5183.150146484375, 0.0,
+    1333.1799926757812, 1588.824951171875, 2560.2900390625, 3985.0450439453125,
+    4763.429931640625, 5057.235107421875, 5290.75, 0.0,
+    0.0, 1266.0250244140625, 1295.7849731445312, 1354.5449829101562,
+    1292.7349853515625, 3704.9749755859375, 2806.780029296875, 5108.364990234375,
+    4638.27490234375, 5245.724853515625, 5060.2900390625, 4931.31494140625,
+    3208.9400024414062, 5217.489990234375, 5389.955078125, 0.0,
+    0.0, 0.0, 0.0, 1279.0,
+    1259.9199829101562, 4942.005126953125, 1321.7349853515625, 0.0,
+    0.0, 0.0, 0.0, 4339.1298828125,
+    4574.175048828125, 2378.6600341796875, 0.0, 2633.544921875,
+    0.0, 2858.669921875, 4482.599853515625, 4609.280029296875,
+    0.0, 5245.72998046875, 0.0, 5028.235107421875,
+    5144.994873046875, 0.0, 5220.544921875, 5247.2548828125,
+    5258.7001953125, 5339.58984375, 5327.385009765625, 1659.0349731445312,
+    627.2899780273438, 4669.56494140625, 0.0, 1433.9149780273438,
+    4681.01513671875, 4900.030029296875, 0.0, 0.0,
+    1266.0250244140625, 1351.4949951171875, 4297.159912109375, 5144.9951171875,
+    5150.335205078125, 5182.385009765625, 0.0, 0.0,
+    0.0, 0.0, 1259.9200439453125, 1258.39501953125,
+    4809.97998046875, 3350.125, 1398.8099975585938, 4153.695068359375,
+    4729.08984375, 5280.070068359375, 4824.47998046875, 4935.89501953125,
+    5281.594970703125, 5291.514892578125, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 1258.39501953125, 1258.39501953125,
+    0.0, 1264.5, 0.0, 0.0,
+    1468.2550048828125, 5244.199951171875, 4808.455078125, 3193.6849365234375,
+    0.0, 4457.4150390625, 4693.985107421875, 5238.094970703125,
+    5206.044921875, 0.0, 5069.445068359375, 4668.0400390625,
+    5228.93994140625, 4970.239990234375, 5069.445068359375, 0.0,
+    5217.489990234375, 5342.64501953125,
+};
+
+static const double voltage_im_leaf_value[3200] = {
+    1256.7373293768533, 1258.7764655172425, 1289.68, 1262.2384905660388,
+    1308.0, 1297.315, 1289.6825000000001, 1279.6119999999999,
+    1257.63, 1265.2649999999999, 4548.23, 2450.548,
+    1273.2333043478272, 1302.3911224489793, 1732.2949999999998, 1338.4759375000003,
+    3220.39, 3421.86, 3922.47, 3922.47,
+    4681.01, 4681.01, 4629.12, 4629.12,
+    1600.6550000000002, 1470.7983333333334, 1285.1, 1289.68,
+    2344.0045833333334, 3174.0933333333337, 1265.26, 1265.26,
+    4681.01, 3161.741428571429, 5183.15, 4046.2204166666666,
+    4569.676802325581, 4745.8473, 3147.13, 3826.31,
+    1303.42, 1349.21, 1613.25, 1613.25,
+    2312.27, 2312.27, 2312.27, 2312.27,
+    5144.1050000000005, 4910.816826923076, 4400.565, 4777.319,
+    5015.3722857142875, 5100.864214285711, 4618.44, 4618.44,
+    5258.443333333334, 5195.32590909091, 5229.665238095238, 5264.551111111111,
+    5299.143333333333, 5359.195172413793, 5429.2575, 5400.643333333333,
+    1256.5224120603018, 1257.4305988023964, 1259.6371532846715, 1262.4964062500003,
+    1504.501875, 1265.26, 1275.1901984126994, 1314.8298809523806,
+    1932.2366666666667, 2466.42, 3321.125, 3644.69,
+    1412.546428571429, 1311.658, 1891.03, 1891.03,
+    4681.01, 4681.01, 5170.94, 5170.94,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    2388.582, 1633.6625, 3027.065, 2558.0,
+    3821.73, 3444.75, 2255.8, 2255.8,
+    1491.15, 1393.47, 3466.1184210526317, 4393.384181818183,
+    4628.392810457514, 4399.192, 4780.162962962962, 4870.897936507936,
+    1349.21, 1286.63, 1465.2, 1613.25,
+    2917.886, 1280.53, 4948.11, 4948.11,
+    4990.294444444446, 4857.782727272728, 4600.12, 4494.81,
+    4496.34, 4496.34, 5104.900328947371, 4618.44,
+    5179.8890909090915, 5083.5625, 5206.436285714286, 5237.892399999998,
+    5330.69, 5298.4914285714285, 5365.894666666666, 5410.5633333333335,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.4505584642238, 1288.921, 2907.51, 1296.4139751552805,
+    2466.42, 2052.81, 1704.82, 1370.2100000000003,
+    3644.69, 3644.69, 3421.86, 3421.86,
+    1514.8025, 1407.01125, 1823.1100000000001, 1513.0266666666666,
+    4884.77, 4049.15, 3271.966250000001, 2216.1150000000002,
+    4206.0445, 1393.47, 4557.141813471502, 4731.717012987015,
+    1303.42, 1280.53, 1465.2, 1613.25,
+    2312.27, 2312.27, 3147.13, 3147.13,
+    4876.624246575341, 4183.46, 5114.775333333333, 4985.06101010101,
+    3553.6233333333334, 2991.45, 4710.359090909092, 3992.67,
+    5106.709915966388, 4618.44, 5177.212, 5223.661355932204,
+    5289.3772, 5337.8116666666665, 5381.3725, 5405.011363636363,
+    1256.9700261780104, 1258.9846835443047, 1289.68, 1261.460740740741,
+    1651.7849999999999, 4674.91, 843.5066666666667, 1288.1479204892967,
+    1927.66, 1927.66, 3644.69, 3421.86,
+    1463.5363636363636, 1691.85, 1413.8183333333334, 1312.268,
+    5170.94, 5170.94, 5170.94, 5170.94,
+    4681.01, 4681.01, 4681.01, 4681.01,
+    2040.6, 1630.8, 2442.0, 2168.8050000000003,
+    2683.15, 2683.15, 2800.67, 2916.67,
+    3221.92, 3373.02, 5183.15, 3998.34380952381,
+    4565.754620689654, 4731.792364864865, 3147.13, 3826.31,
+    1349.21, 1303.42, 1465.2, 1613.25,
+    2312.27, 2312.27, 2312.27, 2312.27,
+    5219.78, 5108.976000000001, 4870.315538461539, 4993.982884615383,
+    2991.45, 2991.45, 4743.382272727273, 3992.67,
+    4496.34, 4496.34, 5157.673333333333, 5095.424456521737,
+    5204.918625, 5239.889803921567, 5297.2375, 5376.203777777778,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1257.3598689956334, 1261.5939495798314, 1294.0933333333332, 1271.2592857142856,
+    1513.635333333333, 4674.91, 1281.3934650455935, 1464.8360000000002,
+    3421.86, 3644.69, 4629.12, 4629.12,
+    1660.3066666666666, 1990.743333333333, 1463.2949999999998, 1330.38,
+    4681.01, 4952.69, 3922.47, 3821.73,
+    3444.75, 2205.6237499999997, 3250.289411764705, 3823.263333333334,
+    4025.4900000000002, 3396.67, 4185.796666666667, 4442.794,
+    1280.53, 1280.53, 1280.53, 1280.53,
+    4615.197660818713, 4832.288347107437, 3806.2166666666667, 4948.11,
+    1303.42, 1303.42, 2312.27, 3147.13,
+    5005.439, 4770.6647826086955, 4496.34, 5106.009448818896,
+    5178.902826086955, 5246.646410256409, 5338.826666666667, 5395.9,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1259.4202080000007, 1235.0268918918916, 2470.748333333333, 1292.895730337079,
+    1521.367, 1891.03, 3644.69, 3644.69,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    4629.12, 4629.12, 4681.01, 4681.01,
+    2315.32, 2562.58, 2916.67, 3183.2533333333336,
+    1571.785, 2177.5271428571427, 3444.75, 3444.75,
+    1393.47, 1393.47, 3518.9836363636364, 4086.4704545454547,
+    4592.990967741935, 3906.6949999999997, 4796.139166666664, 4004.885,
+    1303.42, 1303.42, 1465.2, 1465.2,
+    2991.45, 2991.45, 2991.45, 2991.45,
+    5075.397999999999, 4945.957346938777, 5049.429142857143, 5122.143333333334,
+    4665.241666666666, 4923.6849999999995, 4663.21, 4936.885882352941,
+    5228.327, 5126.087014925374, 5187.858857142858, 5229.239242424243,
+    5268.745833333333, 5309.321333333334, 5375.458125, 5408.577,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1257.3765145228206, 1263.1875000000002, 1304.336, 1289.6825000000003,
+    1637.9730000000002, 4611.57, 1281.5686024844733, 1495.0836842105266,
+    3421.86, 3644.69, 4629.12, 4629.12,
+    1488.398, 1668.005, 3696.0699999999997, 2247.2292307692305,
+    5183.15, 4317.509999999999, 3096.984285714286, 3853.3370588235293,
+    4596.038819188189, 3147.13, 4885.206499999999, 3826.31,
+    1465.2, 1465.2, 1286.63, 1349.21,
+    2991.45, 2991.45, 3417.28, 3417.28,
+    5119.189090909091, 4962.104605263156, 5070.781000000001, 5118.442857142855,
+    4673.38125, 4919.491666666667, 3992.67, 3992.67,
+    5160.577236842104, 5073.259333333333, 5222.885689655172, 5120.57,
+    5257.5575, 5299.8629411764705, 5350.482727272727, 5393.555714285714,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.2884793388425, 1290.4466666666667, 2270.2988888888885, 1302.3427914110432,
+    3220.39, 3421.86, 1423.0746666666669, 1891.03,
+    5170.94, 5170.94, 4952.69, 4952.69,
+    4629.12, 4629.12, 4629.12, 4629.12,
+    2360.5, 2846.766, 1606.1266666666668, 2081.81,
+    3821.73, 3821.73, 3821.73, 3821.73,
+    4881.866, 4099.003333333333, 3454.3843750000005, 1944.44,
+    3089.135, 4511.487247706421, 4926.570740740741, 4689.799558011047,
+    1613.25, 1613.25, 1349.21, 1280.53,
+    4948.11, 3147.13, 1286.63, 1286.63,
+    4889.200192307692, 5030.120408163265, 4754.655, 4888.58375,
+    3992.67, 3992.67, 3992.67, 3992.67,
+    5120.325581395347, 4618.44, 5175.2136, 5222.356125,
+    5269.978888888889, 5310.339166666668, 5363.338235294118, 5408.317647058823,
+    1257.2904845814971, 1262.2096330275238, 1304.565, 1283.325,
+    1797.4885714285713, 4611.57, 1274.1061904761912, 1315.8281159420287,
+    2052.81, 2466.42, 3421.86, 3421.86,
+    1704.82, 1390.601212121212, 1891.03, 1891.03,
+    5170.94, 5170.94, 5170.94, 5170.94,
+    4629.12, 4629.12, 4629.12, 4629.12,
+    2370.7766666666666, 1864.9122222222222, 3538.995, 2255.8,
+    3112.7883333333334, 3726.3433333333337, 1944.44, 1944.44,
+    5183.15, 4054.8062499999996, 1393.47, 1393.47,
+    4564.043734939759, 4050.452142857143, 4713.475897435896, 4862.418095238095,
+    1613.25, 1288.16, 2312.27, 2312.27,
+    1286.63, 1286.63, 3373.523333333333, 4948.11,
+    4919.797741935485, 4547.465, 4496.34, 5073.779350000001,
+    3992.67, 3992.67, 3992.67, 3992.67,
+    5212.427272727273, 5140.306428571428, 5221.251097560977, 5260.926666666666,
+    5306.5216666666665, 5340.481666666667, 5371.023333333334, 5400.642,
+    1256.3896932515336, 1257.3882474226814, 1259.4694890510948, 1262.577407407407,
+    1306.47, 1275.2353333333333, 1289.68, 1295.79,
+    1266.79, 1266.79, 4674.91, 4674.91,
+    1679.3844444444444, 1927.66, 1283.1566366366362, 1405.2800000000002,
+    5170.94, 5170.94, 4681.01, 4681.01,
+    3644.69, 3644.69, 3220.39, 3220.39,
+    1725.58, 2522.3866666666668, 1517.0942857142857, 1265.26,
+    3821.73, 3821.73, 3821.73, 3821.73,
+    3922.47, 3922.47, 4681.01, 4681.01,
+    2881.1825000000003, 3854.55, 1944.44, 1944.44,
+    3198.3466666666664, 4475.19292929293, 4797.448943661971, 3897.7400000000002,
+    1489.318, 3097.9075, 4948.11, 4948.11,
+    4964.917464788733, 4632.784000000001, 4496.34, 5088.918109452736,
+    3992.67, 3992.67, 3992.67, 3992.67,
+    5221.508666666667, 5161.7065, 5225.122325581396, 5261.6765,
+    5340.052, 5303.5337500000005, 5367.023684210528, 5414.487142857142,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.3421441441449, 1284.2108408408424, 1820.8166666666666, 1357.9948484848485,
+    3644.69, 3220.39, 1697.1916666666668, 1417.9964285714286,
+    4952.69, 5170.94, 4629.12, 4629.12,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    2040.5999999999997, 2378.66, 1796.4, 1265.26,
+    2712.53, 2973.442, 2081.81, 2081.81,
+    4037.644642857143, 4451.961000000001, 1491.15, 1491.15,
+    4640.507368421052, 4867.634945054944, 3147.13, 3826.31,
+    1293.346, 1514.55, 2312.27, 2312.27,
+    2991.4499999999994, 2991.4499999999994, 3417.28, 3417.28,
+    4929.2925000000005, 5019.31043478261, 4600.12, 4806.928333333333,
+    5072.224150943399, 5135.778734177215, 4844.76, 5036.77,
+    5192.18262295082, 5069.19, 5230.0419999999995, 5265.236086956522,
+    5310.898, 5346.154, 5377.746000000001, 5400.968571428572,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.3786837606833, 1157.2783333333334, 4548.23, 1293.47131097561,
+    2052.81, 3421.86, 1390.878787878788, 1891.03,
+    4952.69, 5170.94, 4629.12, 4629.12,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    2040.6, 2315.32, 1556.78, 1704.82,
+    2666.778181818182, 3373.5266666666666, 2255.8, 1944.4399999999998,
+    4466.88, 3737.6873333333338, 1393.47, 1393.47,
+    4574.264589371981, 4785.820094339622, 3147.13, 3826.31,
+    1349.21, 1285.3616666666667, 2312.27, 2312.27,
+    3417.28, 3417.28, 4948.11, 4948.11,
+    4938.690638297874, 4349.0525, 4496.34, 5079.81699507389,
+    3992.67, 3992.67, 3992.67, 3992.67,
+    5239.813125000001, 5206.513974358975, 5219.0175, 5266.89,
+    5314.408888888888, 5347.5485714285705, 5371.8966666666665, 5406.898,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1257.3947098214273, 1262.209607843138, 4548.23, 1293.870320855615,
+    2193.2239999999997, 3220.39, 1371.72, 1567.3333333333333,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    4952.69, 4952.69, 4952.69, 4952.69,
+    2040.6, 2248.165, 1704.82, 2139.806666666667,
+    2653.0075, 3011.2925, 2211.03, 2558.0,
+    4780.724999999999, 3853.6636, 1944.44, 1393.47,
+    4548.444070351757, 4734.95341772152, 3147.13, 3147.13,
+    1294.264, 1349.21, 1613.25, 1465.2,
+    2312.27, 2312.27, 2312.27, 2312.27,
+    4873.687499999999, 4183.46, 5031.205445544553, 4311.66,
+    2991.45, 3417.28, 3992.67, 4861.112,
+    4496.34, 4496.34, 5095.9497560975615, 5171.3062666666665,
+    5228.938769230768, 5272.590000000001, 5314.332, 5382.071666666668,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1256.9490760869558, 1260.780809248554, 1750.6760869565219, 1290.6765642458106,
+    3644.69, 3644.69, 1699.8625, 1429.5888888888887,
+    5170.94, 5170.94, 4681.01, 4681.01,
+    1845.6545454545455, 2382.648888888889, 1265.26, 1265.26,
+    4644.19125, 3716.026956521739, 1393.47, 1393.47,
+    4565.649066666665, 1286.63, 4786.901277777777, 4183.46,
+    1613.25, 1613.25, 1349.21, 1295.79,
+    1286.63, 1286.63, 2312.27, 3248.032222222222,
+    5182.278571428571, 4987.241403508772, 4311.66, 4775.423571428572,
+    5114.7275735294115, 5017.510526315789, 4618.44, 4618.44,
+    5206.044250000001, 5093.712, 5227.6955714285705, 5281.047142857143,
+    5297.28, 5348.875, 5375.217368421052, 5409.623846153846,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1256.9179945799444, 1264.2483333333332, 1259.7981249999998, 1262.6592156862744,
+    1285.716, 4632.683333333333, 1648.2827272727272, 1281.986069364162,
+    4629.12, 4629.12, 3421.86, 3220.39,
+    1477.9654545454543, 1338.52, 1987.6899999999998, 1556.78,
+    5010.305, 4690.167142857143, 3922.47, 4123.93,
+    3444.75, 2486.7000000000003, 3835.823076923077, 4323.283846153847,
+    1265.26, 1265.26, 1393.47, 1349.21,
+    4403.24, 4403.24, 4403.24, 4403.24,
+    4564.4544966442945, 4769.211084337352, 1613.25, 1613.25,
+    1303.42, 1303.42, 2312.27, 2312.27,
+    5019.268854166668, 5106.131052631577, 4311.66, 4893.439090909091,
+    5172.118607594936, 5225.412676056337, 5286.859, 5381.2868181818185,
+    1256.9009919571035, 1260.7353932584265, 1274.2411764705882, 1297.314285714286,
+    4674.91, 4674.91, 1630.5441666666666, 1297.8368700265253,
+    3220.39, 3220.39, 3644.69, 3644.69,
+    1533.88, 1399.57, 1628.51, 1782.3580000000002,
+    4952.69, 4952.69, 4952.69, 4952.69,
+    4629.12, 4629.12, 4681.01, 4681.01,
+    2248.165, 2562.58, 1556.78, 1704.82,
+    2656.6958333333337, 3394.6399999999994, 2255.8, 1944.44,
+    4220.26231884058, 4589.19169117647, 1286.63, 4540.6,
+    5015.263333333333, 4714.8816853932585, 5134.6925, 4862.459666666667,
+    3147.1299999999997, 2312.27, 1289.3025, 1349.21,
+    2991.45, 3826.31, 4948.11, 4948.11,
+    4956.488852459014, 5041.541304347826, 3992.67, 4773.0975,
+    4496.34, 4496.34, 5130.055959595958, 5035.976428571428,
+    5196.203157894737, 5222.664074074074, 5251.835, 5272.739,
+    5300.394545454546, 5334.25, 5361.722, 5393.86875,
+    1256.5261904761896, 1257.2068707483006, 1258.677027027028, 1265.2649999999999,
+    1268.32, 1289.68, 1260.585873015873, 1262.8394117647058,
+    4548.23, 4548.23, 4548.23, 4548.23,
+    1283.9608333333333, 2058.4033333333336, 1276.8193015873017, 1382.524680851064,
+    5170.94, 4952.69, 4629.12, 4629.12,
+    3644.69, 3644.69, 3421.86, 3421.86,
+    1452.035, 1690.1719999999998, 2040.6, 2181.01,
+    2820.6351999999997, 1774.645, 3710.32, 3710.32,
+    4340.222142857143, 3852.4799999999996, 1393.47, 1393.47,
+    4583.760236966826, 4781.34588785047, 3147.13, 3826.31,
+    1286.63, 1286.63, 1613.25, 1613.25,
+    3417.28, 4948.11, 1303.42, 2312.27,
+    5240.636666666666, 4903.302602739726, 5016.684252873563, 5099.486363636363,
+    4620.980833333333, 4846.527777777778, 3992.67, 3992.67,
+    4496.34, 5109.647787610617, 5188.854035087718, 5221.307192982456,
+    5269.744736842105, 5304.233333333334, 5365.112592592592, 5410.562222222222,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1256.823971014492, 1258.7700000000011, 1289.68, 1262.2359482758625,
+    4548.23, 4548.23, 1966.4239999999998, 1297.6494017094021,
+    3220.39, 3220.39, 3421.86, 3421.86,
+    4629.12, 4629.12, 4952.69, 4952.69,
+    1491.452, 1723.905, 2040.6, 2040.6,
+    2676.027777777778, 1776.8620000000003, 3696.0699999999997, 2255.8,
+    3076.9244444444444, 3326.2100000000005, 1393.47, 1393.47,
+    4474.2025, 4088.8300000000004, 1944.44, 1944.44,
+    4580.654791666667, 3685.8969999999995, 4788.130196078429, 4183.46,
+    1303.42, 1613.25, 3391.0260000000003, 2991.45,
+    4991.3153999999995, 4764.848571428572, 5117.08216, 4977.775,
+    3992.67, 3992.67, 3992.67, 3992.67,
+    5183.150000000001, 5098.4425, 5226.262597402597, 5275.869500000001,
+    5376.068000000001, 5334.248333333334, 5407.440000000001, 5369.099999999999,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1256.960164383561, 1258.7676744186056, 1267.2285714285713, 1261.534947368421,
+    4548.23, 4548.23, 1524.5219999999997, 1288.1530303030306,
+    3421.86, 3421.86, 3220.39, 3220.39,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    1550.67, 1823.1100000000001, 1473.4857142857143, 1289.68,
+    1918.498, 2780.0675, 3696.0699999999997, 2255.8,
+    3645.538888888889, 4256.992272727272, 3710.32, 1668.955,
+    4599.931576086956, 4158.3164705882355, 4764.179117647061, 3826.31,
+    1283.58, 1303.42, 2312.27, 2312.27,
+    4948.11, 4948.11, 1613.25, 1613.25,
+    4863.204571428571, 4975.198076923077, 2991.45, 4620.269,
+    4496.34, 4496.34, 5087.773668639057, 4915.587692307693,
+    5174.722608695652, 5084.556, 5218.459807692308, 5258.992307692307,
+    5305.3462500000005, 5347.177647058824, 5373.931428571429, 5403.946666666667,
+    1256.830497382198, 1258.737653061225, 1282.5600000000002, 1261.4177358490572,
+    4548.23, 4548.23, 1494.3794117647058, 1278.5878885630493,
+    2052.81, 2052.81, 1704.82, 1704.82,
+    1396.7749999999999, 1452.688, 1352.26, 1300.3675,
+    3421.86, 3421.86, 3421.86, 3421.86,
+    4629.12, 4629.12, 4629.12, 4629.12,
+    1549.1433333333334, 1755.19, 1495.3475, 1350.73,
+    2181.01, 2181.01, 2181.01, 2181.01,
+    4789.682, 3922.47, 2334.401875, 3628.335714285714,
+    4884.003333333333, 1417.8899999999999, 3909.2697058823524, 4474.4073684210525,
+    1349.21, 1349.21, 1349.21, 1349.21,
+    1280.53, 1280.53, 1280.53, 1280.53,
+    4785.017857142857, 4600.776024844719, 5081.400000000001, 4810.10375,
+    1286.63, 1563.8999999999999, 1303.42, 3342.66,
+    5012.564545454545, 4821.663846153847, 5107.924999999999, 4936.988571428572,
+    5159.786730769231, 5222.563382352941, 5293.488823529413, 5381.30888888889,
+    1258.266488413547, 1136.2930000000001, 2941.47, 1285.3528220858896,
+    2466.42, 1990.2350000000001, 1341.45, 1445.364,
+    3220.39, 3220.39, 3421.86, 3421.86,
+    1533.88, 1755.19, 1439.472857142857, 1306.9766666666667,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    4952.69, 4952.69, 4629.12, 4681.01,
+    2168.42, 2769.9575, 3821.73, 3821.73,
+    1704.82, 2230.1083333333336, 1265.26, 1265.26,
+    5183.15, 4681.01, 3947.3286842105267, 1944.44,
+    4596.514545454543, 4205.58625, 4770.823039215686, 4183.46,
+    1303.42, 1284.5966666666666, 3147.13, 2312.27,
+    3553.6233333333334, 4948.11, 1613.25, 1613.25,
+    4894.281333333332, 5000.654285714286, 5003.053033707865, 5081.798125000001,
+    3992.67, 3992.67, 4311.66, 4806.267333333334,
+    5135.771075268817, 5043.1594444444445, 5255.952, 5209.033437499998,
+    5283.447142857142, 5304.794, 5357.612307692307, 5394.870800000001,
+    1256.998935064935, 1259.9207142857135, 1262.3599999999994, 1267.0077142857142,
+    1308.0, 1297.315, 1289.03, 1280.7816666666665,
+    4548.23, 4548.23, 1266.79, 1927.66,
+    1275.3076351351344, 1305.8406666666663, 1820.8166666666666, 1340.2744117647057,
+    3421.86, 3421.86, 3421.86, 3421.86,
+    4629.12, 4629.12, 4629.12, 4629.12,
+    1501.32, 1755.1899999999998, 1474.8700000000001, 1350.73,
+    2181.01, 2181.01, 2181.01, 2181.01,
+    5067.92, 4681.01, 4049.15, 4049.15,
+    3821.73, 2574.69705882353, 3875.2372222222225, 1349.21,
+    2030.5259999999998, 4418.200972222221, 4559.481678832116, 4718.197636363636,
+    3826.31, 3147.13, 1613.25, 1613.25,
+    5145.604, 4867.822602739728, 5066.771224489796, 4843.81375,
+    2991.45, 3417.28, 5021.37, 4856.533333333334,
+    4496.34, 4496.34, 5142.157547169813, 5227.0449367088595,
+    5284.6449999999995, 5331.366666666667, 5403.864444444445, 5363.248461538462,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1257.4425635103921, 1261.5259701492544, 4548.23, 1292.3189972144853,
+    2002.75, 1704.82, 1321.2266666666667, 1411.1299999999999,
+    3421.86, 3220.39, 3644.69, 3922.47,
+    4681.01, 4629.12, 4952.69, 4952.69,
+    1617.8257142857142, 1498.78, 1350.73, 1285.1,
+    2100.758333333333, 2850.275, 2779.68625, 3710.32,
+    3769.0347058823527, 4297.821999999999, 1393.47, 1393.47,
+    4574.619054054052, 2913.6150000000002, 4908.169999999999, 4707.0599999999995,
+    1280.53, 1280.53, 1349.21, 1349.21,
+    1465.2, 1465.2, 1465.2, 1465.2,
+    4985.7072727272725, 4858.411739130434, 4968.415918367347, 5045.15104477612,
+    2991.45, 2991.45, 4740.1788235294125, 3992.67,
+    5188.958888888888, 5113.074296874997, 4618.44, 4913.0,
+    5222.6359999999995, 5295.9712, 5376.578, 5409.4175000000005,
+    1256.793966480446, 1259.0507070707076, 1289.68, 1261.9936666666674,
+    1295.79, 1288.3742857142859, 1279.0, 1280.53,
+    1264.5, 2757.3239999999996, 4674.91, 4548.23,
+    1157.2783333333334, 1281.992320261439, 1486.876, 1358.6258536585365,
+    3220.39, 3220.39, 3220.39, 3220.39,
+    3644.69, 3644.69, 3644.69, 3644.69,
+    1423.99, 1443.83, 1466.73, 1491.15,
+    1350.73, 1350.73, 1350.73, 1350.73,
+    5098.19, 4669.478888888889, 4049.15, 4049.15,
+    2070.8892307692304, 3520.1459999999997, 3105.92, 3474.443636363636,
+    1393.47, 4211.000476190477, 4650.157869415811, 3554.6380000000004,
+    1339.6675, 2312.27, 3417.28, 3417.28,
+    4896.49530612245, 5049.21080882353, 2991.45, 4863.753076923077,
+    3992.67, 3992.67, 3992.67, 3992.67,
+    5136.107777777777, 4618.44, 5181.543157894737, 5225.674615384616,
+    5260.553571428572, 5308.218888888889, 5374.542666666666, 5408.655000000001,
+    1256.8331621621617, 1259.0274285714295, 1279.0, 1261.6409090909094,
+    4548.23, 4548.23, 1856.1766666666665, 1293.4653804347834,
+    2466.42, 2052.81, 3421.86, 3421.86,
+    1704.82, 1704.82, 1443.7153846153847, 1338.382727272727,
+    5170.94, 5170.94, 4629.12, 4681.01,
+    3220.39, 3220.39, 3644.69, 3922.47,
+    2175.67, 1512.5166666666667, 2610.196, 2172.1116666666667,
+    1350.73, 1350.73, 1265.26, 1289.68,
+    1458.5900000000001, 4285.71, 3596.8666666666663, 4355.473333333332,
+    4538.951732283467, 4742.7997752809, 3969.1699999999996, 3147.13,
+    1280.53, 1280.53, 1303.42, 1303.42,
+    1465.2, 1465.2, 1613.25, 1613.25,
+    5168.105714285714, 4891.570571428571, 5146.825999999999, 5014.509090909092,
+    3204.365, 4948.11, 4453.908, 4779.416842105264,
+    4496.34, 5109.578106060606, 4618.44, 4618.44,
+    5191.629682539683, 5240.632253521125, 5326.822, 5396.626086956521,
+    1256.4424479166655, 1257.5470555555564, 1259.491197183099, 1262.5688235294117,
+    1272.5125, 1279.7649999999999, 1288.5375000000001, 1297.315,
+    1264.7566666666667, 2508.4777777777776, 4548.23, 4548.23,
+    1054.6383333333333, 1280.907535714286, 1725.9714285714285, 1366.4155,
+    3220.39, 3220.39, 3922.47, 3644.69,
+    4952.69, 4952.69, 4952.69, 4952.69,
+    1612.8650000000002, 1503.97, 1350.73, 1289.68,
+    2406.135, 2916.67, 1950.5525, 1265.26,
+    3216.956875, 4180.402857142856, 1393.47, 1393.47,
+    4583.295075376883, 3928.9524999999994, 4825.2474999999995, 4717.073582089554,
+    1349.21, 1349.21, 1280.53, 1280.53,
+    3147.13, 3147.13, 2312.27, 2312.27,
+    4879.407999999998, 4183.46, 5124.815, 4983.55188235294,
+    2991.4499999999994, 2991.4499999999994, 4629.8835714285715, 4843.255,
+    4496.34, 4496.34, 5106.746600000001, 5182.554878048781,
+    5234.909999999999, 5298.3054999999995, 5371.751785714287, 5405.9818749999995,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.4359198542809, 1294.044285714286, 3177.657142857143, 1303.4558753709198,
+    3421.86, 3644.69, 1633.3433333333335, 1397.5366666666669,
+    5170.94, 5170.94, 4681.01, 4629.12,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    2330.585, 1652.1675, 2934.79125, 2416.8199999999997,
+    3821.73, 3821.73, 3444.75, 3444.75,
+    4345.098505747126, 1944.44, 1491.15, 1491.15,
+    4608.689587628865, 4800.660512820513, 3147.13, 3826.31,
+    1349.21, 1288.16, 1613.25, 1613.25,
+    2991.4499999999994, 2991.4499999999994, 3417.28, 3417.28,
+    4917.900000000001, 5013.440000000001, 5182.597272727274, 5095.194516129033,
+    4767.380588235295, 4923.824545454546, 3992.67, 3992.67,
+    4496.34, 4496.34, 5132.057380952381, 5205.063253968253,
+    5272.386, 5305.098, 5359.0505, 5400.386666666667,
+    1256.5554807692295, 1257.4977358490582, 1259.7454128440368, 1262.6801923076919,
+    1306.47, 1270.60375, 1300.368, 1286.63,
+    3130.34, 1262.363, 4674.91, 4548.23,
+    1275.2632780082993, 1328.8668421052632, 2466.42, 1384.2603333333334,
+    5170.94, 5170.94, 4629.12, 4681.01,
+    3220.39, 3220.39, 3644.69, 3922.47,
+    1467.1075, 1289.68, 1891.03, 1556.78,
+    2124.135333333333, 1265.26, 3821.73, 3444.75,
+    3695.216315789474, 4298.042307692307, 1668.955, 3710.32,
+    4546.584404145077, 4773.068202247192, 3147.13, 3826.31,
+    1318.6833333333334, 1613.25, 2312.27, 2312.27,
+    4948.11, 4948.11, 1286.63, 1286.63,
+    4942.128235294118, 4606.662857142857, 5074.9221768707475, 4898.473043478261,
+    3992.67, 3992.67, 3992.67, 3992.67,
+    5218.085555555556, 5123.315306122449, 5197.093220338983, 5236.830609756096,
+    5313.83625, 5344.041666666667, 5408.715263157896, 5373.579230769231,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.2987272727278, 3129.58, 721.9157142857144, 1269.650625,
+    1266.0275, 4611.57, 1283.124880546076, 1384.432,
+    5170.94, 4952.69, 4629.12, 4629.12,
+    3644.69, 3644.69, 3922.47, 3922.47,
+    1882.021, 2322.04, 1350.73, 1265.26,
+    2878.0033333333336, 3011.2899999999995, 2275.64, 2275.64,
+    3701.245277777778, 4394.041904761905, 1491.15, 1491.15,
+    4717.007500000001, 4999.695000000001, 4595.0701550387585, 4715.669827586207,
+    1280.53, 1280.53, 1613.25, 1465.2,
+    2312.27, 2312.27, 2312.27, 2312.27,
+    5080.383333333334, 4846.83974025974, 5152.780000000001, 5011.414086956523,
+    2991.45, 3826.31, 4782.829999999999, 3992.67,
+    4496.34, 4496.34, 5112.9571428571435, 5190.155641025641,
+    5275.032, 5229.849193548386, 5337.1196, 5398.828125,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.2131475409835, 1291.427142857143, 3495.6266666666666, 1299.1754385964916,
+    2466.42, 2052.81, 1704.82, 1364.13,
+    3421.86, 3220.39, 3644.69, 3644.69,
+    4681.01, 4681.01, 5170.94, 4952.69,
+    1607.6500000000003, 2315.32, 1394.992, 1550.6737500000002,
+    2613.2707142857143, 3282.054, 1265.26, 1944.44,
+    3797.888125, 1393.47, 4149.623333333334, 4425.306923076923,
+    4529.068674698796, 4742.298928571429, 3826.31, 3147.13,
+    1291.975, 1349.21, 1613.25, 1465.2,
+    2312.27, 2312.27, 2312.27, 2312.27,
+    5224.36, 4897.553013698629, 5172.213333333333, 5016.230731707317,
+    3417.28, 2991.45, 3992.67, 4713.320000000001,
+    4496.34, 4496.34, 5131.671117647056, 4618.44,
+    5227.946753246752, 5290.523500000001, 5362.521904761905, 5407.158461538462,
+    1256.8088819875766, 1258.8860396039618, 1282.5600000000002, 1261.5901980198028,
+    4548.23, 4548.23, 1542.4744444444445, 1277.9971351351357,
+    2466.42, 2466.42, 1990.2350000000001, 1704.82,
+    1369.5935714285713, 1421.9599999999998, 1292.7366666666667, 1323.26,
+    4629.12, 4629.12, 4629.12, 4629.12,
+    3220.39, 3421.86, 3644.69, 3644.69,
+    1460.8400000000001, 1580.6899999999998, 1350.73, 1286.016,
+    2181.01, 2181.01, 2181.01, 2181.01,
+    4637.306363636364, 3612.45303030303, 1562.574, 4403.24,
+    4574.569727891156, 1286.63, 4867.935294117647, 4709.066630434781,
+    1280.53, 1303.42, 1465.2, 1613.25,
+    2312.27, 2312.27, 2312.27, 2312.27,
+    5113.221818181818, 4877.4567938931295, 5161.565714285714, 5015.797375,
+    3417.28, 3417.28, 3992.67, 4695.132500000001,
+    5180.763076923076, 5100.452183908047, 4618.44, 4618.44,
+    5220.907619047621, 5282.9920833333335, 5338.83, 5383.2796875,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.9144293015343, 1230.6376119402983, 2360.603333333333, 1288.055087719298,
+    2466.42, 2052.81, 1381.64, 1288.92,
+    3421.86, 3220.39, 3644.69, 3644.69,
+    5170.94, 4952.69, 4629.12, 4629.12,
+    1630.0366666666669, 1940.8866666666665, 1507.634, 1306.4685714285715,
+    1989.2133333333331, 2613.1600000000003, 3444.75, 3444.75,
+    3746.4909999999995, 4473.879795918367, 1491.15, 1491.15,
+    4622.867686567164, 1286.63, 4717.5321875, 4855.560303030302,
+    4748.17, 1944.44, 2312.27, 1393.47,
+    3711.0825000000004, 4948.11, 1286.63, 1286.63,
+    4882.20090909091, 5014.544214876035, 4856.083529411764, 4649.345,
+    3992.67, 3992.67, 3992.67, 3992.67,
+    4496.34, 4618.44, 5126.7717241379305, 4998.3553846153845,
+    5196.228275862069, 5237.3646478873225, 5317.765, 5387.269565217392,
+    1257.3325053533183, 1262.3817293233087, 1268.392833333333, 1287.8519999999999,
+    1266.79, 4548.23, 1275.4454430379744, 1307.8075000000001,
+    1704.82, 1704.82, 2052.81, 2052.81,
+    1367.5228571428572, 1293.5, 1350.73, 1472.96,
+    5170.94, 5170.94, 5170.94, 5170.94,
+    4629.12, 4629.12, 4681.01, 4681.01,
+    2276.4025, 2735.0425, 1459.6066666666666, 2159.3419999999996,
+    3821.73, 3444.75, 2255.8, 2255.8,
+    2558.0, 2558.0, 3793.717857142857, 4358.668000000001,
+    4595.5813499999995, 3710.316363636364, 5036.63, 4752.844128440368,
+    4339.135, 3228.2766666666666, 1336.998, 2312.27,
+    3826.31, 3417.28, 4948.11, 4948.11,
+    5125.537499999999, 4924.288636363635, 4618.129999999999, 4311.66,
+    5015.190781249999, 5102.801612903225, 4768.01, 4977.0216666666665,
+    5232.388695652174, 5133.277941176471, 5217.945443037976, 5266.678181818182,
+    5304.995, 5292.871111111111, 5365.462, 5405.656428571428,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1257.4105381165903, 1261.9378813559329, 1469.5384210526315, 1284.644759036146,
+    2110.502, 3321.125, 1395.8161538461538, 1891.03,
+    5170.94, 5170.94, 4681.01, 4681.01,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    1556.78, 2227.674285714286, 1265.26, 1265.26,
+    3046.633076923077, 3854.55, 1944.4399999999998, 1944.4399999999998,
+    1426.03, 4407.8099999999995, 4532.7788770053485, 3679.8721052631577,
+    4726.32375, 4871.119, 3826.31, 3826.31,
+    1349.21, 1349.21, 1303.42, 1280.53,
+    2312.27, 2312.27, 2991.4499999999994, 3417.28,
+    4937.578367346939, 5013.943950617286, 4536.933999999999, 4754.27375,
+    4496.34, 4496.34, 5185.087307692307, 5082.2487962963,
+    5189.96534883721, 5082.416666666667, 5224.060869565218, 5262.75,
+    5333.814285714286, 5301.243750000001, 5371.751428571429, 5413.4745454545455,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1256.9032208588953, 1258.967250000001, 1289.68, 1261.5881415929202,
+    1279.255, 1886.4466666666667, 1273.0597297297306, 1315.3599159663868,
+    1927.66, 2052.81, 3220.39, 3421.86,
+    1704.82, 1384.9033333333332, 1891.03, 1891.03,
+    4952.69, 4660.254, 5183.15, 5183.15,
+    3922.47, 3922.47, 4311.66, 4311.66,
+    2345.0825, 1556.78, 3263.342857142857, 2440.2233333333334,
+    3757.991764705882, 4230.43, 1349.21, 1349.21,
+    4477.773783783783, 4617.830559006209, 4816.268656716417, 3826.31,
+    1289.3025, 1465.2, 3133.3933333333334, 4645.91,
+    5002.378255813954, 4804.946, 4496.34, 5110.533450292395,
+    5214.838181818181, 5278.675294117646, 5305.42, 5378.905925925927,
+    1256.8535359116013, 1258.6924576271201, 1266.792, 1261.5238775510213,
+    1447.3718181818183, 4674.91, 1062.7783333333334, 1284.4197196261684,
+    1969.3766666666668, 2466.42, 3644.69, 3644.69,
+    1504.0509090909093, 1388.0336000000002, 1336.995, 1290.1899999999998,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    4629.12, 4629.12, 5170.94, 5170.94,
+    2040.5999999999997, 2181.01, 1556.78, 1556.78,
+    3821.73, 3821.73, 3444.75, 2422.0446153846156,
+    4681.01, 4681.01, 3205.5125, 1944.44,
+    3868.1339999999996, 3558.835, 4136.142500000001, 4403.24,
+    3104.0150000000003, 4524.6726767676755, 4750.219444444445, 4004.885,
+    3147.13, 3147.13, 1303.42, 1303.42,
+    5099.484545454546, 4913.953469387755, 5079.337476635514, 4874.85,
+    2991.45, 3417.28, 4841.153076923078, 3992.67,
+    5203.755416666667, 5124.209078947369, 5227.751388888887, 5120.57,
+    5284.118461538462, 5337.302, 5374.898333333333, 5413.486666666667,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.4909290540554, 1193.357777777778, 4548.23, 1298.2418771331056,
+    2331.73, 3421.86, 1704.82, 1368.7083333333333,
+    4952.69, 5170.94, 4629.12, 4681.01,
+    3220.39, 3220.39, 3644.69, 3644.69,
+    2040.4277777777777, 1484.7562500000001, 2741.91, 3011.29,
+    3821.73, 3444.75, 2255.8, 2255.8,
+    3123.221666666667, 3615.69, 4205.2585714285715, 3873.63,
+    4352.868867924526, 4626.238482142857, 3147.1299999999997, 3147.1299999999997,
+    2312.27, 2312.27, 2312.27, 2312.27,
+    1280.53, 1303.42, 1465.2, 1465.2,
+    4891.377033898304, 4311.66, 3417.28, 4649.725,
+    5020.092328767126, 5073.409512195123, 4798.028333333333, 4957.7733333333335,
+    4496.34, 4496.34, 5121.330353982301, 5206.8462711864395,
+    5274.216666666666, 5312.177692307693, 5402.131904761905, 5358.33,
+    1256.8515838509302, 1258.791680000001, 1261.1797752808995, 1263.6758333333337,
+    4548.23, 4548.23, 1973.75, 1294.1684266666678,
+    2052.81, 2052.81, 2466.42, 2466.42,
+    1352.0421428571428, 1301.8933333333334, 1454.52, 1390.42,
+    3421.8599999999997, 3220.39, 3922.47, 3922.47,
+    4952.69, 4952.69, 4629.12, 4681.01,
+    1547.3120000000001, 1845.75, 1387.3633333333335, 1556.78,
+    2344.5131250000004, 3174.0933333333337, 1265.26, 1265.26,
+    4932.08, 4199.736666666667, 3290.3227272727277, 3831.400666666667,
+    4540.440413793105, 4755.179548872179, 3826.31, 3147.13,
+    1613.25, 1293.346, 2312.27, 2312.27,
+    3417.28, 3417.28, 3417.28, 3417.28,
+    4883.468648648648, 4735.96, 5005.704854368932, 4792.620000000001,
+    2991.45, 2991.45, 3992.67, 4719.873846153846,
+    5103.966559139784, 5172.549636363636, 4940.47375, 5086.580000000001,
+    5222.147640449438, 5284.524210526317, 5360.8676000000005, 5405.983333333333,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1257.0099483204133, 1264.5025, 1259.774452054795, 1262.694,
+    1307.2350000000001, 4674.91, 1612.6231818181818, 1283.5830473372782,
+    1977.72, 2466.42, 3421.86, 3644.69,
+    1419.0766666666668, 1752.136, 1392.7050000000002, 1286.6280000000002,
+    5170.94, 4952.69, 4681.01, 4681.01,
+    4311.66, 4311.66, 4123.93, 4123.93,
+    2246.2575, 1826.0080000000003, 1393.47, 3351.7394117647063,
+    3721.763333333334, 4190.105714285714, 1349.21, 1349.21,
+    4570.4395454545465, 3455.943333333334, 4723.761304347827, 4879.9468181818165,
+    1295.79, 1613.25, 2501.9075000000003, 4948.11,
+    5001.671825396827, 4708.792666666666, 4496.34, 5106.977750000002,
+    5203.134186046511, 5253.8029166666665, 5317.4625, 5389.510344827587,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.223233215547, 1279.5072222222223, 2189.5278947368415, 1278.2266346153845,
+    2032.9666666666665, 3321.125, 1398.2331707317073, 1891.03,
+    4952.69, 4952.69, 5170.94, 5170.94,
+    4681.01, 4681.01, 4681.01, 4681.01,
+    2423.5177777777776, 1890.857777777778, 3633.24, 2255.8,
+    2800.67, 3133.3940000000002, 2558.0, 2558.0,
+    4201.007692307692, 4517.29487804878, 1491.15, 1491.15,
+    4629.973023255813, 4017.9411111111112, 4763.341262135921, 4004.885,
+    1303.42, 1303.42, 1303.42, 1303.42,
+    2312.27, 2312.27, 3147.13, 3147.13,
+    5115.302727272728, 4887.013523809524, 4637.1325, 3417.28,
+    5089.44569767442, 4647.4375, 4887.107741935485, 5096.619130434783,
+    5192.388245614035, 5247.635, 5228.0905555555555, 5271.889999999999,
+    5287.288461538462, 5324.3275, 5370.371666666667, 5404.318181818182,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1257.2345720720716, 1263.2458955223888, 1299.86, 1281.29,
+    1265.2649999999999, 4611.57, 1286.001206349207, 1464.4394444444447,
+    3644.69, 3421.86, 3220.39, 3220.39,
+    4681.01, 4681.01, 5170.94, 5170.94,
+    1633.3433333333332, 1417.31375, 2100.1214285714286, 1265.26,
+    2611.4176923076925, 3854.55, 1944.4399999999998, 1944.4399999999998,
+    5183.15, 4529.91, 3666.568333333333, 3946.452857142857,
+    4575.051420765026, 4114.414117647058, 4779.279017857142, 4183.46,
+    2312.27, 2312.27, 1287.548, 1349.21,
+    1613.25, 1613.25, 4948.11, 3417.28,
+    5159.240000000001, 4914.2719718309845, 5019.435949367089, 5137.976000000001,
+    2991.45, 2991.45, 4489.469999999999, 4793.156666666667,
+    4496.34, 5128.2377777777765, 4618.44, 4618.44,
+    5225.958571428571, 5282.051333333334, 5337.6825, 5394.155357142858,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1257.4015800415787, 1261.811081081081, 1550.9053846153847, 1279.6787662337665,
+    1704.82, 2259.615, 1314.1872222222223, 1382.5657142857144,
+    3644.69, 3421.86, 4629.12, 4629.12,
+    1621.6416666666667, 1435.0155555555557, 2040.6, 2181.01,
+    4952.69, 5183.15, 4681.01, 4681.01,
+    4123.93, 4311.66, 3922.47, 3922.47,
+    2576.783076923077, 3523.605, 3574.342727272727, 4284.1900000000005,
+    1944.44, 1944.44, 1349.21, 1349.21,
+    4413.390769230769, 1491.15, 4572.406594202897, 4715.03076923077,
+    1613.25, 1291.975, 3147.13, 3147.13,
+    4908.026666666668, 5045.246635514019, 3986.565, 4796.662727272726,
+    5117.840608695651, 5209.362844036697, 5301.282800000002, 5389.70303030303,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.8026833333342, 1212.4414492753624, 2085.625, 1286.6570344827583,
+    1871.95, 2466.42, 1351.3623529411764, 1431.625,
+    4952.69, 4952.69, 5170.94, 5170.94,
+    4629.12, 4629.12, 4629.12, 4629.12,
+    1489.01, 1556.78, 2782.355714285714, 2146.42,
+    3407.93, 3821.73, 1287.3899999999999, 2598.9533333333334,
+    3260.84, 3823.6772727272723, 4681.01, 4220.595,
+    2888.4300000000003, 4494.374166666666, 4639.167874015748, 4783.96105769231,
+    2312.27, 3147.13, 1304.9475, 1465.2,
+    3417.28, 3417.28, 4948.11, 4948.11,
+    4938.988024691358, 4547.211111111112, 5063.822543859649, 4807.885,
+    3992.67, 3992.67, 3992.67, 3992.67,
+    5162.535584415586, 5066.14, 5223.487714285715, 5255.512941176472,
+    5303.1525, 5342.97, 5381.780952380952, 5420.634,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.2673157894733, 1291.40125, 2436.9144444444446, 1286.1333227848106,
+    2001.87, 3220.39, 1370.389090909091, 1638.8125,
+    4681.01, 4681.01, 4681.01, 4681.01,
+    4681.01, 4681.01, 4681.01, 4681.01,
+    2181.01, 2315.32, 1556.78, 1704.82,
+    3821.73, 2718.7625000000003, 2222.2225, 1265.26,
+    4848.39, 4230.158, 3402.9700000000003, 3908.3500000000004,
+    4574.296, 4140.296111111111, 4786.982875816991, 3826.31,
+    1287.7775000000001, 1349.21, 1465.2, 1465.2,
+    4948.11, 4948.11, 2991.45, 1613.25,
+    4986.440096153847, 4842.9655555555555, 5100.506446280991, 4921.944285714286,
+    3992.67, 3992.67, 3992.67, 3992.67,
+    5203.685606060608, 5231.196458333334, 5254.1224999999995, 5274.843846153846,
+    5344.933333333333, 5297.958888888888, 5363.175238095238, 5404.7108333333335,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1257.2396645702308, 1261.875523809524, 2565.43875, 1305.174921052632,
+    3220.39, 3644.69, 1474.1385714285716, 1845.75,
+    4629.12, 4629.12, 4952.69, 4952.69,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    2244.7325, 2847.2200000000003, 1940.1719999999998, 1265.26,
+    3821.73, 3444.75, 2255.8, 2255.8,
+    3408.763684210526, 1393.47, 3913.9199999999996, 4242.137586206897,
+    4969.168, 4574.223416149067, 4773.004000000001, 4183.46,
+    1280.53, 1303.42, 1613.25, 1465.2,
+    3531.7450000000003, 4948.11, 1286.63, 1286.63,
+    4877.730277777778, 4933.2259375, 5111.99125, 5001.999014084507,
+    2991.45, 2991.45, 4573.79375, 4818.682000000001,
+    4496.34, 4496.34, 5119.891955307261, 4618.44,
+    5217.37309859155, 5271.037083333334, 5336.0536363636365, 5395.043333333333,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.0709965635735, 1206.0845454545454, 1714.3625, 1288.0387643678162,
+    1927.66, 3220.39, 1526.0822222222223, 1397.3536363636363,
+    5170.94, 5170.94, 4952.69, 4952.69,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    2181.01, 2315.32, 1556.78, 1556.78,
+    2817.97, 3880.7466666666664, 1944.4399999999998, 1944.4399999999998,
+    4869.756666666667, 4186.506666666667, 3814.714, 4202.861428571428,
+    4546.232022471909, 4742.834945054947, 3826.31, 3147.13,
+    1303.42, 1280.53, 1465.2, 1613.25,
+    2312.27, 2312.27, 2312.27, 2312.27,
+    4876.581818181819, 4958.1433333333325, 5005.120379746836, 5094.08980392157,
+    2991.45, 2991.45, 3992.67, 4852.87,
+    5151.582653061223, 5016.967647058824, 5199.753658536586, 5235.472968750001,
+    5307.063124999999, 5345.12375, 5428.88, 5389.4225,
+    1258.2210016977942, 1285.4875, 1148.849090909091, 1265.566,
+    1266.79, 4611.57, 1762.0600000000002, 1296.094722222223,
+    3644.69, 3644.69, 3220.39, 3220.39,
+    1755.19, 1755.19, 1350.73, 1438.49,
+    3922.47, 3922.47, 3922.47, 3922.47,
+    4629.12, 4629.12, 4681.01, 4681.01,
+    2315.32, 2562.58, 1704.82, 2081.81,
+    2753.138571428571, 3854.55, 1944.44, 1944.44,
+    3843.1033333333344, 3495.3683333333333, 4214.17125, 4024.2166666666667,
+    4536.627079646016, 4770.942260869565, 1303.42, 1303.42,
+    1465.2, 1465.2, 1286.63, 1349.21,
+    1613.25, 1613.25, 1613.25, 1613.25,
+    4867.080882352942, 4954.21, 5115.526153846154, 4991.914954954956,
+    2991.45, 2991.45, 4515.872, 4805.068,
+    4496.34, 4496.34, 5187.992068965517, 5103.22914728682,
+    5224.089240506329, 5294.289090909091, 5354.598888888889, 5403.694375,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.2947160068848, 1194.25, 1714.5537499999998, 1280.9302317880802,
+    1702.6414285714288, 2259.615, 1315.165652173913, 1382.306875,
+    3644.69, 3644.69, 3220.39, 3220.39,
+    1488.855, 1628.51, 1891.03, 1891.03,
+    5100.224999999999, 4629.12, 2377.4300000000003, 3604.361538461538,
+    3444.75, 1265.26, 3852.8720000000003, 4395.791836734695,
+    1349.21, 1349.21, 1349.21, 1349.21,
+    1280.53, 1280.53, 1280.53, 1280.53,
+    4594.487757009345, 4772.011344537814, 3147.13, 3826.31,
+    1292.2266666666667, 1613.25, 3417.28, 3417.28,
+    4930.750384615385, 4746.7446666666665, 5065.615045871559, 4305.555,
+    5186.711578947367, 5231.768229166668, 5330.3347826086965, 5396.616363636364,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1258.5304227941178, 1294.1109999999999, 3822.88, 1291.6270655270662,
+    1927.66, 2466.42, 1704.82, 1377.7819444444447,
+    3644.69, 3644.69, 3220.39, 3220.39,
+    4952.69, 4952.69, 4629.12, 4629.12,
+    1857.2309523809527, 2850.275, 1350.73, 1273.3999999999999,
+    2800.67, 2916.67, 2275.64, 2275.64,
+    4359.16625, 3677.7583333333337, 1944.44, 1944.44,
+    4096.677142857143, 4549.231928571429, 4905.712777777778, 4739.768029197079,
+    1311.0533333333333, 1563.8999999999999, 2312.27, 2312.27,
+    3580.892, 3147.13, 4948.11, 4948.11,
+    4897.359583333334, 4668.04, 5019.291511627907, 4806.860909090909,
+    4496.34, 4496.34, 5120.624090909091, 4994.402777777777,
+    5195.6466666666665, 5079.365, 5224.608372093023, 5268.390499999999,
+    5310.594166666667, 5355.34705882353, 5430.096, 5397.883076923076,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    5024.42, 5024.42, 5024.42, 5024.42,
+    1256.8522916666666, 1258.8628225806463, 1282.05, 1262.0693577981656,
+    4548.23, 4548.23, 1856.1766666666665, 1296.1151111111117,
+    3421.86, 3421.86, 3644.69, 3644.69,
+    1533.88, 1451.8475, 1289.68, 1285.1,
+    4832.569, 4003.054, 2610.2300000000005, 3811.472068965518,
+    5157.2, 5157.2, 4421.548823529412, 4596.67872180451,
+    4636.75, 1698.9357142857145, 4572.0380000000005, 3710.32,
+    1349.21, 1297.6975, 1613.25, 1613.25,
+    4729.573816793895, 4183.46, 5162.545, 4858.6392,
+    1375.915, 2312.27, 3410.56, 4948.11,
+    4980.328492063496, 5104.527638888888, 3992.67, 3992.67,
+    5186.71119047619, 5234.919729729729, 5317.46, 5377.892162162161,
+};
+
+const EPS_ForestImplicit eps_voltage_forest_implicit = {
+    .n_features = 5,
+    .n_trees = 50,
+    .scale = 0.02,
+    .feature = voltage_im_feature,
+    .threshold = voltage_im_threshold,
+    .leaf_value = voltage_im_leaf_value,
+};
+
+#endif
+
+uint16_t eps_model_voltage_n_features(void) {
+    return EPS_MODEL_VOLTAGE_N_FEATURES;
+}
+
+uint32_t eps_model_voltage_hash(void) {
+    return EPS_MODEL_VOLTAGE_HASH;
+}
+
+#if EPS_FOREST_BACKEND != EPS_FOREST_BACKEND_FIXED && EPS_FOREST_BACKEND != EPS_FOREST_BACKEND_FLOAT32
+
+double eps_model_voltage_score(const double *x) {
+#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_QUICKSCORER
+    return eps_qs_score(&eps_voltage_forest_qs, x);
+#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_QUANTIZED
+    return eps_forest_q_score(&eps_voltage_forest_q, x);
+#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_IMPLICIT
+    return eps_forest_implicit_score(&eps_voltage_forest_implicit, x);
+#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_BINNED
+    return eps_forest_binned_score(&eps_voltage_forest_binned, x);
+#else
+    return eps_forest_score(&eps_voltage_forest, x);
+#endif
+}
+
+void eps_model_voltage_score_batch(const double x[][EPS_MODEL_VOLTAGE_N_FEATURES], double *out, int n) {
+#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_QUICKSCORER
+    eps_qs_score_batch(&eps_voltage_forest_qs, &x[0][0], EPS_MODEL_VOLTAGE_N_FEATURES, out, n);
+#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_QUANTIZED
+    eps_forest_q_score_batch(&eps_voltage_forest_q, &x[0][0], EPS_MODEL_VOLTAGE_N_FEATURES, out, n);
+#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_IMPLICIT
+    eps_forest_implicit_score_batch(&eps_voltage_forest_implicit, &x[0][0], EPS_MODEL_VOLTAGE_N_FEATURES, out, n);
+#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_BINNED
+    eps_forest_binned_score_batch(&eps_voltage_forest_binned, &x[0][0], EPS_MODEL_VOLTAGE_N_FEATURES, out, n);
+#else
+    eps_forest_score_batch(&eps_voltage_forest, &x[0][0], EPS_MODEL_VOLTAGE_N_FEATURES, out, n);
+#endif
+}
+
+#endif
@@ -0,0 +1,36 @@
+/**
+ * EPS Predictive FDIR - Voltage model API
+ * Generated by eps_forest_export.py from voltage_forest.json -- do not edit
+ *
+ * Entry points follow eps_model_abi.h; the tables are in voltage_model.c
+ */
+
+#ifndef EPS_MODEL_VOLTAGE_H
+#define EPS_MODEL_VOLTAGE_H
+
+#include "eps_forest.h"
+#include "eps_model_abi.h"
+#include <stdint.h>
+
+#define EPS_MODEL_VOLTAGE_ABI         1
+#define EPS_MODEL_VOLTAGE_N_FEATURES  5
+#define EPS_MODEL_VOLTAGE_HASH        0xC503AD38u   // CRC-32 of voltage_model.bin
+
+#if EPS_MODEL_VOLTAGE_ABI != EPS_MODEL_ABI_VERSION
+#error "voltage_model.h was generated for another model ABI; rerun eps_forest_export.py"
+#endif
+
+uint16_t eps_model_voltage_n_features(void);
+uint32_t eps_model_voltage_hash(void);
+
+#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_FIXED
+int64_t eps_model_voltage_score_fixed(const int64_t *x);
+#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_FLOAT32
+float eps_model_voltage_score_f32(const float *x);
+void eps_model_voltage_score_batch_f32(const float x[][EPS_MODEL_VOLTAGE_N_FEATURES], float *out, int n);
+#else
+double eps_model_voltage_score(const double *x);
+void eps_model_voltage_score_batch(const double x[][EPS_MODEL_VOLTAGE_N_FEATURES], double *out, int n);
+#endif
+
+#endif // EPS_MODEL_VOLTAGE_H
@@ -0,0 +1,139 @@
+/**
+ * EPS Predictive FDIR - Deferred Actuation Check
+ * Drives eps_protection_update_all() through cycles in which k = 0..13
+ * panels change state at once, and measures the loop latency on the
+ * simulated clock (host HAL_Delay() advances it):
+ *
+ *   enable     k panels go anomalous: DISABLED -> ENABLED, Layer 2 enabled
+ *   re-enable  k tripped panels get CMD_REENABLE: TRIPPED -> RECOVERY,
+ *              MOSFET override closed
+ *
+ * For each it reports the ms spent inside the protection update, the ms
+ * until eps_actuation_tick() (called every 1 ms) has completed every
+ * settle step, and what the former in-line HAL_Delay() calls cost for the
+ * same cycle (k x settle time). The check fails (exit 1) unless the update
+ * takes 0 ms for every k, all steps complete within their settle time and
+ * every panel reaches the expected state.
+ * Built with -DEPS_ACTUATION_QUEUE=1, all but one step fall back to settling
+ * in place, and the loop time grows with k again.
+ *
+ * Each cycle starts with a scan of all channels, as in the main loop. The
+ * host ADC reads 0 V (MOSFET open), so enabled panels trip on the next
+ * cycle and the re-enable verify step logs the MOSFET as still open.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -include deploy/host/eps_hal_host.h -Ideploy/stm32_package -Ideploy/host \
+ *       deploy/host/actuation_check.c deploy/stm32_package/eps_protection_final.c \
+ *       deploy/stm32_package/eps_actuation.c deploy/stm32_package/eps_acquisition.c \
+ *       -lm -o build/actuation_check
+ *
+ * Run:
+ *   build/actuation_check
+ */
+
+#include "eps_acquisition.h"
+#include "eps_actuation.h"
+#include "eps_protection_final.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+// Host HAL stand-in peripherals (eps_hal_host.h)
+ADC_HandleTypeDef hadc1, hadc2, hadc3;
+GPIO_TypeDef eps_host_gpio[4];
+
+#define SAMPLE_MS 5000u
+#define P_NOMINAL 8.0f
+#define V_NOMINAL 17.0f
+
+typedef struct {
+    uint32_t loop_ms;              // Inside eps_protection_update_all()
+    uint32_t settled_ms;           // Until the actuation queue is empty
+    int steps;                     // Settle steps run
+} Cycle;
+
+// One sample for all panels: the first k predict a power spike (spike and
+// residual conditions), the rest match their measurement
+static Cycle run_cycle(int k) {
+    float P[NUM_PANELS], V[NUM_PANELS], P_pred[NUM_PANELS], V_pred[NUM_PANELS];
+    for (int p = 0; p < NUM_PANELS; p++) {
+        P[p] = P_NOMINAL;
+        V[p] = V_NOMINAL;
+        P_pred[p] = (p < k) ? 1.5f * P_NOMINAL : P_NOMINAL;
+        V_pred[p] = V_NOMINAL;
+    }
+
+    Cycle c = {0, 0, 0};
+    sim_advance_time(SAMPLE_MS);
+    uint32_t start = HAL_GetTick();
+    eps_acq_scan(EPS_ACQ_TIMEOUT_MS);
+    eps_protection_update_all(P, V, P_pred, V_pred, NUM_PANELS);
+    c.loop_ms = HAL_GetTick() - start;
+
+    while (eps_actuation_count() > 0 && HAL_GetTick() - start < SAMPLE_MS) {
+        sim_advance_time(1);
+        c.steps += eps_actuation_tick(HAL_GetTick());
+    }
+    c.settled_ms = HAL_GetTick() - start;
+    return c;
+}
+
+static int count_state(ComparatorState_t state) {
+    int n = 0;
+    for (int p = 0; p < NUM_PANELS; p++) n += (panels[p].state == state);
+    return n;
+}
+
+// The FDIR code logs to stdout; keep it off the report
+static int quiet_begin(void) {
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd >= 0) {
+        dup2(null_fd, STDOUT_FILENO);
+        close(null_fd);
+    }
+    return saved;
+}
+
+static void quiet_end(int saved) {
+    fflush(stdout);
+    if (saved >= 0) {
+        dup2(saved, STDOUT_FILENO);
+        close(saved);
+    }
+}
+
+int main(void) {
+    int failures = 0;
+
+    printf("panels | enable: loop  settled  blocking | re-enable: loop  settled  blocking   (ms)\n");
+    for (int k = 0; k <= NUM_PANELS; k++) {
+        int saved = quiet_begin();
+        eps_acq_init();
+        eps_protection_init();
+        for (uint8_t p = 0; p < NUM_PANELS; p++) eps_protection_init_panel(p, P_NOMINAL, V_NOMINAL);
+        run_cycle(0);                                  // History
+
+        Cycle enable = run_cycle(k);                   // DISABLED -> ENABLED
+        int enabled = count_state(COMP_ENABLED);
+        run_cycle(0);                                  // ENABLED -> TRIPPED (ADC reads 0 V)
+        int tripped = count_state(COMP_TRIPPED);
+        for (uint8_t p = 0; p < k; p++) process_ground_command(p, CMD_REENABLE);
+        Cycle reenable = run_cycle(0);                 // TRIPPED -> RECOVERY
+        int recovering = count_state(COMP_RECOVERY);
+        quiet_end(saved);
+
+        int ok = enable.loop_ms == 0 && reenable.loop_ms == 0 &&
+                 enable.steps == k && reenable.steps == k &&
+                 enable.settled_ms <= (k ? LAYER2_SETTLE_MS : 0) &&
+                 reenable.settled_ms <= (k ? MOSFET_SETTLE_MS : 0) &&
+                 enabled == k && tripped == k && recovering == k;
+        printf("%6d | %12lu %8lu %9d | %15lu %8lu %9d   %s\n", k,
+               (unsigned long)enable.loop_ms, (unsigned long)enable.settled_ms, k * LAYER2_SETTLE_MS,
+               (unsigned long)reenable.loop_ms, (unsigned long)reenable.settled_ms, k * MOSFET_SETTLE_MS,
+               ok ? "ok" : "FAIL");
+        failures += !ok;
+    }
+    return failures ? 1 : 0;
+}
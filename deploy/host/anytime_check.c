@@ -0,0 +1,169 @@
+/**
+ * EPS Predictive FDIR - Anytime Evaluation Check
+ * Replays telemetry as one COMP_DISABLED panel through the anytime cycle
+ * of eps_main_deployment.c (EPS_ANYTIME): cuts from
+ * eps_protection_power_cuts() / eps_protection_voltage_cuts() shifted by
+ * the bias, exact cycles (no cuts) every BIAS_UPDATE_PERIOD rows and
+ * through the bias warmup, and bias updates on exact cycles only. A second
+ * bias corrector follows the same schedule on the full-forest scores.
+ * Checks, over the whole replay:
+ *
+ *   decisions    the prediction-dependent conditions (power_spike,
+ *                large_residual, voltage_drop of eps_protection_conditions())
+ *                are those of the full forest on every row
+ *   bias         both correctors end bit-identical (no midpoint drift)
+ *   exact        without cuts eps_anytime_score() is bit-identical to
+ *                eps_forest_score() on every row
+ *
+ * Reports the trees skipped by the cycle. Exits 1 on any difference.
+ *
+ * The protection thresholds are in W and V (eps_protection_final.h); the
+ * models predict uW and mV, so the cuts are scaled accordingly. The panel
+ * nominal power and voltage are the replay's means. The host has no cycle
+ * counter, so the "us saved" of the reports is stubbed to 0.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -DEPS_FOREST_BACKEND=EPS_FOREST_BACKEND_TABLE -include deploy/host/eps_hal_host.h \
+ *       -Ideploy/stm32_package -Ideploy/c_code -Ideploy/host \
+ *       deploy/host/anytime_check.c deploy/host/eps_replay.c \
+ *       deploy/stm32_package/eps_forest.c deploy/stm32_package/eps_forest_anytime.c \
+ *       deploy/stm32_package/eps_protection_final.c deploy/stm32_package/eps_actuation.c \
+ *       deploy/stm32_package/eps_acquisition.c \
+ *       deploy/c_code/power_model.c deploy/c_code/voltage_model.c -lm -o build/anytime_check
+ *
+ * Run:
+ *   build/anytime_check build/NEPALISAT.csv build/RAAVANA.csv build/UGUISU.csv
+ */
+
+#include "eps_bias_corrector.h"
+#include "eps_forest_anytime.h"
+#include "eps_protection_final.h"
+#include "eps_replay.h"
+#include <stdio.h>
+#include <string.h>
+
+// Host HAL stand-in peripherals (eps_hal_host.h)
+ADC_HandleTypeDef hadc1, hadc2, hadc3;
+GPIO_TypeDef eps_host_gpio[4];
+
+// Bias corrector settings of eps_main_deployment.c with EPS_ANYTIME
+#define BIAS_UPDATE_PERIOD 12
+#define BIAS_ALPHA (0.01f * BIAS_UPDATE_PERIOD)
+#define BIAS_WARMUP 50
+
+#define UW_PER_W 1e6
+#define MV_PER_V 1e3
+
+// Prediction-dependent conditions of panel 0, one bit each
+static unsigned decisions(float P, float V, float P_pred, float V_pred) {
+    ProtectionMasks_t m;
+    eps_protection_conditions(&P, &V, &P_pred, &V_pred, 1, &m);
+    return (m.power_spike & 1u) | (m.large_residual & 1u) << 1 | (m.voltage_drop & 1u) << 2;
+}
+
+// Cuts of one condition set in model units, net of the bias (as the main loop)
+static uint8_t model_cuts(uint8_t n_cuts, const float cuts_f[], float bias, double units,
+                          double cuts[]) {
+    for (uint8_t c = 0; c < n_cuts; c++) {
+        cuts[c] = (cuts_f[c] - bias) * units;
+    }
+    return n_cuts;
+}
+
+static int check_replay(const char *path) {
+    EPS_Replay replay;
+    EPS_ReplayRows rows;
+    if (eps_replay_load(path, &replay) != 0) return -1;
+    int n = eps_replay_build_rows(&replay, &rows);
+
+    double P_nominal = 0.0, V_nominal = 0.0;
+    for (int r = 0; r < n; r++) {
+        P_nominal += rows.power_target[r];
+        V_nominal += rows.voltage_target[r];
+    }
+    P_nominal /= ((n > 0) ? n : 1) * UW_PER_W;
+    V_nominal /= ((n > 0) ? n : 1) * MV_PER_V;
+
+    EPS_Anytime power, voltage;
+    memset(&power, 0, sizeof(power));
+    memset(&voltage, 0, sizeof(voltage));
+    if (eps_anytime_init(&power, &eps_power_forest) != 0 ||
+        eps_anytime_init(&voltage, &eps_voltage_forest) != 0) {
+        fprintf(stderr, "anytime: forest too large\n");
+        return -1;
+    }
+
+    // No cuts: all trees, bit-identical to eps_forest_score()
+    int not_exact = 0;
+    for (int r = 0; r < n; r++) {
+        double p_full = eps_forest_score(&eps_power_forest, rows.power[r]);
+        double v_full = eps_forest_score(&eps_voltage_forest, rows.voltage[r]);
+        double p_all = eps_anytime_score(&power, rows.power[r], NULL, 0);
+        double v_all = eps_anytime_score(&voltage, rows.voltage[r], NULL, 0);
+        not_exact += memcmp(&p_all, &p_full, sizeof(double)) != 0;
+        not_exact += memcmp(&v_all, &v_full, sizeof(double)) != 0;
+    }
+    memset(&power.telemetry, 0, sizeof(power.telemetry));
+    memset(&voltage.telemetry, 0, sizeof(voltage.telemetry));
+
+    eps_protection_init();
+    eps_protection_init_panel(0, (float)P_nominal, (float)V_nominal);
+    BiasCorrector bias_any, bias_full;
+    bias_init(&bias_any, BIAS_ALPHA, BIAS_WARMUP);
+    bias_init(&bias_full, BIAS_ALPHA, BIAS_WARMUP);
+
+    int bad = 0;
+    for (int r = 0; r < n; r++) {
+        float P = (float)(rows.power_target[r] / UW_PER_W);
+        float V = (float)(rows.voltage_target[r] / MV_PER_V);
+        bool exact_cycle = (r % BIAS_UPDATE_PERIOD) == 0 || !bias_is_ready(&bias_any);
+        float bias_p = bias_is_ready(&bias_any) ? bias_any.bias_power : 0.0f;
+        float bias_v = bias_is_ready(&bias_any) ? bias_any.bias_voltage : 0.0f;
+        float cuts_f[3];
+        double cuts[3];
+
+        uint8_t n_cuts = exact_cycle ? 0 : eps_protection_power_cuts(0, P, cuts_f);
+        double p = eps_anytime_score(&power, rows.power[r],
+                                     cuts, model_cuts(n_cuts, cuts_f, bias_p, UW_PER_W, cuts));
+        n_cuts = exact_cycle ? 0 : eps_protection_voltage_cuts(0, V, cuts_f);
+        double v = eps_anytime_score(&voltage, rows.voltage[r],
+                                     cuts, model_cuts(n_cuts, cuts_f, bias_v, MV_PER_V, cuts));
+        double p_full = eps_forest_score(&eps_power_forest, rows.power[r]);
+        double v_full = eps_forest_score(&eps_voltage_forest, rows.voltage[r]);
+
+        float p_any = (float)(p / UW_PER_W), v_any = (float)(v / MV_PER_V);
+        float p_ref = (float)(p_full / UW_PER_W), v_ref = (float)(v_full / MV_PER_V);
+        float p_raw = p_any, v_raw = v_any;
+        bias_correct(&bias_any, &p_any, &v_any);
+        bias_correct(&bias_full, &p_ref, &v_ref);
+        bad += decisions(P, V, p_any, v_any) != decisions(P, V, p_ref, v_ref);
+
+        if (exact_cycle) {
+            bias_update(&bias_any, P, p_raw, V, v_raw);
+            bias_update(&bias_full, P, (float)(p_full / UW_PER_W), V, (float)(v_full / MV_PER_V));
+        }
+    }
+    int drift = memcmp(&bias_any, &bias_full, sizeof(BiasCorrector)) != 0;
+
+    printf("%s: %d rows, decision mismatches %d, bias drift %s, full-evaluation mismatches %d\n",
+           path, n, bad, drift ? "YES" : "none", not_exact);
+    eps_anytime_report(&power, "power");
+    eps_anytime_report(&voltage, "voltage");
+
+    eps_replay_free_rows(&rows);
+    eps_replay_free(&replay);
+    return bad + drift + not_exact;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s replay.csv...\n", argv[0]);
+        return 2;
+    }
+    int failures = 0;
+    for (int i = 1; i < argc; i++) {
+        int bad = check_replay(argv[i]);
+        if (bad != 0) failures++;
+    }
+    return failures ? 1 : 0;
+}
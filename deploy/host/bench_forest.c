@@ -0,0 +1,366 @@
+/**
+ * EPS Predictive FDIR - Host Forest Backend Benchmark
+ * Compares the m2cgen if/else code, the table walk, QuickScorer and the
+ * AVX2 lockstep batch (as dispatched after calibration, and forced on) on
+ * replayed telemetry, and checks that every backend
+ * returns bit-identical predictions. The quantized backend is checked
+ * against its leaf rounding bound instead (a wrong split exceeds it).
+ *
+ * "binned" bins each feature once per row against the model's sorted
+ * thresholds and walks the trees on uint8 bin IDs (eps_forest_binned.h).
+ * "implicit" is the perfect-tree backend (eps_forest_implicit.h). "multi
+ * batch" times the P/V/I panel model (eps_forest_multi.h, one walk per tree
+ * for all three outputs) against the power and voltage table batches it
+ * replaces with EPS_MULTI_TARGET. The run
+ * ends with a modelled STM32F4 cycle count per prediction for m2cgen, the
+ * table walk, the implicit walk, the binned walk and the single-precision
+ * walk (eps_forest_f32.h, same paths on hardware float compares), from the
+ * mean replayed path length and per-level instruction costs (see STM32F4
+ * COST MODEL below). These are estimates, not measurements; on the board,
+ * time the backends with the DWT cycle counter (eps_cycle_clock.h).
+ *
+ * Build (from the repository root):
+ *   python3 deploy/host/export_replay.py data/NEPALISAT/NEPALISAT.xlsx build/NEPALISAT.csv
+ *   python3 eps_forest_export.py --emit-m2cgen build/ref --symbol-prefix ref_
+ *   gcc -O2 -DEPS_FOREST_ALL_BACKENDS -Ideploy/stm32_package -Ideploy/c_code -Ideploy/host \
+ *       deploy/host/bench_forest.c deploy/host/eps_replay.c \
+ *       deploy/host/eps_forest_avx2.c deploy/stm32_package/eps_forest.c deploy/stm32_package/eps_forest_qs.c \
+ *       deploy/stm32_package/eps_forest_q.c deploy/stm32_package/eps_forest_fixed.c \
+ *       deploy/stm32_package/eps_forest_implicit.c deploy/stm32_package/eps_forest_binned.c \
+ *       deploy/stm32_package/eps_forest_f32.c deploy/stm32_package/eps_forest_multi.c \
+ *       deploy/c_code/power_model.c deploy/c_code/voltage_model.c deploy/c_code/panel_model.c \
+ *       build/ref/power_model_m2cgen.c build/ref/voltage_model_m2cgen.c -lm -o build/bench_forest
+ *
+ * Run:
+ *   build/bench_forest build/NEPALISAT.csv [repeats] [shuffle]
+ *
+ * "shuffle" randomizes the row order, which removes the sample-to-sample
+ * correlation that lets the branch predictor learn the hot paths.
+ */
+
+#include "eps_forest.h"
+#include "eps_forest_avx2.h"
+#include "eps_forest_binned.h"
+#include "eps_forest_implicit.h"
+#include "eps_forest_multi.h"
+#include "eps_forest_q.h"
+#include "eps_forest_qs.h"
+#include "eps_replay.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// m2cgen reference (eps_forest_export.py --emit-m2cgen --symbol-prefix ref_)
+extern double ref_score(double *input);
+extern double ref_score_voltage(double *input);
+
+typedef double (*ScoreFn)(const double *x);
+
+static double m2cgen_power(const double *x)  { return ref_score((double *)x); }
+static double m2cgen_voltage(const double *x) { return ref_score_voltage((double *)x); }
+static double table_power(const double *x)   { return eps_forest_score(&eps_power_forest, x); }
+static double table_voltage(const double *x) { return eps_forest_score(&eps_voltage_forest, x); }
+static double qs_power(const double *x)      { return eps_qs_score(&eps_power_forest_qs, x); }
+static double qs_voltage(const double *x)    { return eps_qs_score(&eps_voltage_forest_qs, x); }
+static double q_power(const double *x)       { return eps_forest_q_score(&eps_power_forest_q, x); }
+static double q_voltage(const double *x)     { return eps_forest_q_score(&eps_voltage_forest_q, x); }
+static double im_power(const double *x)      { return eps_forest_implicit_score(&eps_power_forest_implicit, x); }
+static double im_voltage(const double *x)    { return eps_forest_implicit_score(&eps_voltage_forest_implicit, x); }
+static double bn_power(const double *x)      { return eps_forest_binned_score(&eps_power_forest_binned, x); }
+static double bn_voltage(const double *x)    { return eps_forest_binned_score(&eps_voltage_forest_binned, x); }
+
+typedef struct {
+    const char *name;
+    ScoreFn power;
+    ScoreFn voltage;
+} Backend;
+
+static const Backend BACKENDS[] = {
+    {"m2cgen",      m2cgen_power, m2cgen_voltage},
+    {"table",       table_power,  table_voltage},
+    {"quickscorer", qs_power,     qs_voltage},
+    {"implicit",    im_power,     im_voltage},
+    {"binned",      bn_power,     bn_voltage},
+};
+#define N_BACKENDS (int)(sizeof(BACKENDS) / sizeof(BACKENDS[0]))
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Time fn over all rows, return ns per prediction
+static double bench(ScoreFn fn, const double *rows, int stride, int n_rows, int repeats,
+                    double *out) {
+    volatile double sink = 0.0;
+    double start = now_ns();
+    for (int r = 0; r < repeats; r++) {
+        for (int i = 0; i < n_rows; i++) {
+            out[i] = fn(rows + i * stride);
+        }
+        sink += out[r % n_rows];
+    }
+    (void)sink;
+    return (now_ns() - start) / ((double)repeats * n_rows);
+}
+
+// Same as bench() for whole-matrix entry points, fed in blocks that stay
+// cache resident (the flight loop passes 13 rows per cycle)
+#define BATCH_ROWS 64
+
+typedef void (*BatchFn)(const void *model, const double *x, uint16_t stride, double *out, int n);
+
+static double bench_batch(BatchFn fn, const void *model, const double *rows, int stride,
+                          int n_rows, int repeats, double *out) {
+    volatile double sink = 0.0;
+    double start = now_ns();
+    for (int r = 0; r < repeats; r++) {
+        for (int i = 0; i < n_rows; i += BATCH_ROWS) {
+            int len = (n_rows - i < BATCH_ROWS) ? n_rows - i : BATCH_ROWS;
+            fn(model, rows + i * stride, (uint16_t)stride, out + i, len);
+        }
+        sink += out[r % n_rows];
+    }
+    (void)sink;
+    return (now_ns() - start) / ((double)repeats * n_rows);
+}
+
+static void table_batch(const void *model, const double *x, uint16_t stride, double *out, int n) {
+    eps_forest_score_batch((const EPS_Forest *)model, x, stride, out, n);
+}
+
+static void avx2_batch(const void *model, const double *x, uint16_t stride, double *out, int n) {
+    eps_forest_avx2_score_batch((const EPS_ForestAVX2 *)model, x, stride, out, (size_t)n);
+}
+
+// ===== STM32F4 COST MODEL =====
+// Cortex-M4F at 168 MHz: the FPU is single precision, so every double
+// compare and add is a soft-float library call. Assumed cycles per tree
+// level, counted from the expected instruction sequence (not measured):
+#define CYC_DCMP      24   // __aeabi_cdcmple incl. call/return
+#define CYC_DADD      60   // __aeabi_dadd, once per tree (leaf sum)
+#define CYC_IMPLICIT  (CYC_DCMP + 11)   // ldrb feature, 2x ldrd, index update
+#define CYC_TABLE     (CYC_DCMP + 16)   // + child ldrsh, leaf test, loop branch
+#define CYC_M2CGEN    (CYC_DCMP + 14)   // literal-pool ldrd, ldrd x, cond. branch,
+                                        // ~6 for flash refills (>60 KB of code vs 1 KB ART)
+#define CYC_BINNED    10   // ldrb slot, ldrb bins[slot], ldrb bin, cmp, ldrsh child
+#define CYC_SEARCH    (CYC_DCMP + 8)    // one binary-search step of the binning pass
+#define CYC_F32       12   // ldrb feature, 2x vldr, vcmp.f32 + vmrs, ldrsh child, loop
+#define CYC_FADD      3    // vldr leaf + vadd.f32, once per tree
+
+// Mean split nodes visited per tree
+static double mean_path(const EPS_Forest *forest, const double *rows, int stride, int n) {
+    long visited = 0;
+    for (int i = 0; i < n; i++) {
+        const double *x = rows + i * stride;
+        for (uint16_t t = 0; t < forest->n_trees; t++) {
+            for (int16_t node = forest->roots[t]; !EPS_FOREST_IS_LEAF(node);
+                 node = forest->children[2 * node + !(x[forest->feature[node]] <= forest->threshold[node])]) {
+                visited++;
+            }
+        }
+    }
+    return (double)visited / ((double)n * forest->n_trees);
+}
+
+static void print_stm32_estimate(const char *name, const EPS_Forest *forest,
+                                 const EPS_ForestBinned *binned, const double *rows, int stride, int n) {
+    double path = mean_path(forest, rows, stride, n);
+    double trees = forest->n_trees;
+    double m2c = trees * (path * CYC_M2CGEN + CYC_DADD);
+    double table = trees * (path * CYC_TABLE + CYC_DADD);
+    double implicit = trees * (EPS_IMPLICIT_DEPTH * CYC_IMPLICIT + CYC_DADD);
+
+    // Binning: ceil(log2(m + 1)) double compares per feature with m thresholds
+    int searches = 0;
+    for (uint16_t f = 0; f < binned->n_features; f++) {
+        for (int m = binned->split_offset[f + 1] - binned->split_offset[f]; m > 0; m >>= 1) {
+            searches++;
+        }
+    }
+    double bn = searches * CYC_SEARCH + trees * (path * CYC_BINNED + CYC_DADD);
+    double f32 = trees * (path * CYC_F32 + CYC_FADD);
+    printf("%-8s path %.2f, %d vs %.0f double compares: m2cgen %6.0f cyc (%5.1f us), table %6.0f (%5.1f us), "
+           "implicit %6.0f (%5.1f us), binned %6.0f (%5.1f us), float32 %6.0f (%5.1f us)\n",
+           name, path, searches, trees * path, m2c, m2c / 168.0, table, table / 168.0,
+           implicit, implicit / 168.0, bn, bn / 168.0, f32, f32 / 168.0);
+}
+
+static int count_mismatches(const double *a, const double *b, int n) {
+    int bad = 0;
+    for (int i = 0; i < n; i++) {
+        if (memcmp(&a[i], &b[i], sizeof(double)) != 0) bad++;
+    }
+    return bad;
+}
+
+// Rows off by more than the int32 leaf rounding (half a unit per tree)
+static int count_beyond(const double *ref, const double *b, int n, double bound, double *max_err) {
+    int bad = 0;
+    for (int i = 0; i < n; i++) {
+        double err = fabs(ref[i] - b[i]);
+        if (err > *max_err) *max_err = err;
+        if (err > bound * (1.0 + 1e-9)) bad++;
+    }
+    return bad;
+}
+
+// Fisher-Yates with a fixed seed so runs are comparable
+static void shuffle_rows(EPS_ReplayRows *rows) {
+    uint32_t state = 0x12345678;
+    for (int i = rows->n_rows - 1; i > 0; i--) {
+        state = 1664525u * state + 1013904223u;
+        int j = (int)(state % (uint32_t)(i + 1));
+        double p[REPLAY_POWER_FEATURES], v[REPLAY_VOLTAGE_FEATURES];
+        memcpy(p, rows->power[i], sizeof(p));
+        memcpy(rows->power[i], rows->power[j], sizeof(p));
+        memcpy(rows->power[j], p, sizeof(p));
+        memcpy(v, rows->voltage[i], sizeof(v));
+        memcpy(rows->voltage[i], rows->voltage[j], sizeof(v));
+        memcpy(rows->voltage[j], v, sizeof(v));
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s replay.csv [repeats] [shuffle]\n", argv[0]);
+        return 2;
+    }
+    int repeats = (argc > 2) ? atoi(argv[2]) : 20;
+
+    EPS_Replay replay;
+    EPS_ReplayRows rows;
+    if (eps_replay_load(argv[1], &replay) != 0) return 1;
+    int n = eps_replay_build_rows(&replay, &rows);
+    bool shuffle = (argc > 3) && strcmp(argv[3], "shuffle") == 0;
+    if (shuffle) {
+        shuffle_rows(&rows);
+    }
+    printf("Replay %s: %d samples, %d feature rows, %d repeats%s\n",
+           argv[1], replay.n_samples, n, repeats, shuffle ? ", shuffled" : "");
+
+    double *ref_p = malloc(n * sizeof(double));
+    double *ref_v = malloc(n * sizeof(double));
+    double *out = malloc(n * sizeof(double));
+    int failures = 0;
+
+    printf("%-12s %12s %12s %10s\n", "backend", "power ns", "voltage ns", "mismatch");
+    for (int b = 0; b < N_BACKENDS; b++) {
+        double *dst_p = (b == 0) ? ref_p : out;
+        double ns_p = bench(BACKENDS[b].power, &rows.power[0][0], REPLAY_POWER_FEATURES,
+                            n, repeats, dst_p);
+        int bad = (b == 0) ? 0 : count_mismatches(ref_p, out, n);
+
+        double *dst_v = (b == 0) ? ref_v : out;
+        double ns_v = bench(BACKENDS[b].voltage, &rows.voltage[0][0], REPLAY_VOLTAGE_FEATURES,
+                            n, repeats, dst_v);
+        if (b != 0) bad += count_mismatches(ref_v, out, n);
+
+        printf("%-12s %12.1f %12.1f %10d\n", BACKENDS[b].name, ns_p, ns_v, bad);
+        failures += bad;
+    }
+
+    // Quantized backend: same splits, leaves rounded to the int32 grid
+    {
+        const EPS_ForestQ *qp = &eps_power_forest_q, *qv = &eps_voltage_forest_q;
+        double err_p = 0.0, err_v = 0.0;
+        double ns_p = bench(q_power, &rows.power[0][0], REPLAY_POWER_FEATURES, n, repeats, out);
+        int bad = count_beyond(ref_p, out, n, 0.5 * qp->n_trees * qp->leaf_scale, &err_p);
+        double ns_v = bench(q_voltage, &rows.voltage[0][0], REPLAY_VOLTAGE_FEATURES, n, repeats, out);
+        bad += count_beyond(ref_v, out, n, 0.5 * qv->n_trees * qv->leaf_scale, &err_v);
+
+        printf("%-12s %12.1f %12.1f %10d   (max error %.3g uW, %.3g mV)\n",
+               "quantized", ns_p, ns_v, bad, err_p, err_v);
+        failures += bad;
+    }
+
+    // Whole-matrix entry points (ground replay processes rows in bulk)
+    EPS_ForestAVX2 simd_p, simd_v;
+    if (eps_forest_avx2_init(&simd_p, &eps_power_forest) != 0 ||
+        eps_forest_avx2_init(&simd_v, &eps_voltage_forest) != 0) {
+        fprintf(stderr, "avx2: out of memory\n");
+        return 1;
+    }
+    // Dispatch as shipped: the kernel only if calibration measures a win
+    eps_forest_avx2_calibrate(&simd_p, &rows.power[0][0], REPLAY_POWER_FEATURES, n);
+    eps_forest_avx2_calibrate(&simd_v, &rows.voltage[0][0], REPLAY_VOLTAGE_FEATURES, n);
+    printf("avx2 calibration: power %.1f vs scalar %.1f ns/row (%s), voltage %.1f vs %.1f (%s)\n",
+           simd_p.avx2_ns, simd_p.scalar_ns, simd_p.use_avx2 ? "on" : "off",
+           simd_v.avx2_ns, simd_v.scalar_ns, simd_v.use_avx2 ? "on" : "off");
+    // And the kernel forced on, to keep its cost on record
+    EPS_ForestAVX2 forced_p = simd_p, forced_v = simd_v;
+    forced_p.use_avx2 = forced_v.use_avx2 = true;
+    struct {
+        const char *name;
+        BatchFn fn;
+        const void *power;
+        const void *voltage;
+    } batches[] = {
+        {"table batch", table_batch, &eps_power_forest, &eps_voltage_forest},
+        {"avx2 dispatch", avx2_batch, &simd_p, &simd_v},
+        {eps_forest_avx2_available() ? "avx2 forced" : "avx2 (scalar)", avx2_batch, &forced_p, &forced_v},
+    };
+    for (int b = 0; b < 3; b++) {
+        double ns_p = bench_batch(batches[b].fn, batches[b].power, &rows.power[0][0],
+                                  REPLAY_POWER_FEATURES, n, repeats, out);
+        int bad = count_mismatches(ref_p, out, n);
+        double ns_v = bench_batch(batches[b].fn, batches[b].voltage, &rows.voltage[0][0],
+                                  REPLAY_VOLTAGE_FEATURES, n, repeats, out);
+        bad += count_mismatches(ref_v, out, n);
+
+        printf("%-12s %12.1f %12.1f %10d\n", batches[b].name, ns_p, ns_v, bad);
+        failures += bad;
+    }
+    eps_forest_avx2_free(&simd_p);
+    eps_forest_avx2_free(&simd_v);
+
+    // Multi-target panel model: one row of 15 features gives P, V and I
+    {
+        double (*panel)[EPS_PANEL_FEATURES] = malloc(n * sizeof(*panel));
+        double *panel_out = malloc(BATCH_ROWS * EPS_PANEL_OUTPUTS * sizeof(double));
+        for (int i = 0; i < n; i++) {
+            memcpy(panel[i], rows.power[i], sizeof(rows.power[i]));
+            memcpy(panel[i] + EPS_PANEL_VOLTAGE_FEAT, rows.voltage[i], sizeof(rows.voltage[i]));
+        }
+        volatile double sink = 0.0;
+        double start = now_ns();
+        for (int r = 0; r < repeats; r++) {
+            for (int i = 0; i < n; i += BATCH_ROWS) {
+                int len = (n - i < BATCH_ROWS) ? n - i : BATCH_ROWS;
+                eps_forest_multi_score_batch(&eps_panel_forest_multi, panel[i], EPS_PANEL_FEATURES,
+                                             panel_out, len);
+            }
+            sink += panel_out[0];
+        }
+        (void)sink;
+        double ns_m = (now_ns() - start) / ((double)repeats * n);
+        double ns_p = bench_batch(table_batch, &eps_power_forest, &rows.power[0][0],
+                                  REPLAY_POWER_FEATURES, n, repeats, out);
+        double ns_v = bench_batch(table_batch, &eps_voltage_forest, &rows.voltage[0][0],
+                                  REPLAY_VOLTAGE_FEATURES, n, repeats, out);
+        printf("%-12s %12.1f ns/row for P, V and I (%u nodes) vs power+voltage batch %.1f "
+               "(%.1f + %.1f, %u + %u nodes)\n",
+               "multi batch", ns_m, eps_panel_forest_multi.n_nodes, ns_p + ns_v, ns_p, ns_v,
+               eps_power_forest.n_nodes, eps_voltage_forest.n_nodes);
+        free(panel);
+        free(panel_out);
+    }
+
+    printf("STM32F4 modelled estimate per prediction (cost model, not measured; 168 MHz, "
+           "soft-float doubles):\n");
+    print_stm32_estimate("power", &eps_power_forest, &eps_power_forest_binned,
+                         &rows.power[0][0], REPLAY_POWER_FEATURES, n);
+    print_stm32_estimate("voltage", &eps_voltage_forest, &eps_voltage_forest_binned,
+                         &rows.voltage[0][0], REPLAY_VOLTAGE_FEATURES, n);
+
+    free(ref_p);
+    free(ref_v);
+    free(out);
+    eps_replay_free_rows(&rows);
+    eps_replay_free(&replay);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,497 @@
+/**
+ * EPS Predictive FDIR - Pipeline Micro-Benchmarks
+ * Times each hot path of the per-cycle FDIR pipeline in isolation on
+ * replayed telemetry and prints one JSON report:
+ *
+ *   eps_model_power_score / eps_model_voltage_score   (power_model.h, voltage_model.h)
+ *   eps_extract_power_features                        (eps_features.c)
+ *   eps_store_features                                (eps_panel_store.c, one op =
+ *                                                      both matrices of all panels)
+ *   eps_rolling_push                                  (eps_rolling.c, 60-sample window,
+ *                                                      mean/var/min/max read back)
+ *   p2_update                                         (eps_p2_quantile.h)
+ *   bias_update                                       (eps_bias_corrector.h)
+ *   eps_protection_update                             (eps_protection_final.c)
+ *   eps_protection_update_all                         (eps_protection_final.c, one op =
+ *                                                      all panels of one sample)
+ *   eps_protection_conditions                         (condition masks alone, same ops)
+ *   eps_acq_scan                                      (eps_acquisition.c, one op = DMA scan
+ *                                                      of all 13 panels' 39 channels, read
+ *                                                      back as V, I, drain voltage)
+ *
+ * Each entry reports ns/op from the monotonic clock and, on Linux,
+ * cycles, instructions and branch misses per op from perf_event_open
+ * (user space only). When the kernel refuses the counters
+ * (perf_event_paranoid, containers) those fields are null. Operations
+ * that need fresh state first (a new sample in the ring buffer) are timed
+ * with and without the op and report the difference. Every figure is the
+ * best of the repeats, and includes one indirect call per op.
+ *
+ * The models see the replay rows in uW/mV; bias, P2 and protection get
+ * W/V as on the satellite, with each panel's nominal power and voltage
+ * set to its replay mean. Log output from the FDIR code is discarded
+ * while timing. The host DMA stand-in (eps_hal_host.h) copies the first
+ * replay sample's voltage and current counts and completes at once, so
+ * eps_acq_scan times the software side only; drain sense reads 0 V, so
+ * panels trip as on the bench before.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -include deploy/host/eps_hal_host.h -Ideploy/stm32_package -Ideploy/c_code -Ideploy/host \
+ *       deploy/host/bench_pipeline.c deploy/host/eps_replay.c \
+ *       deploy/stm32_package/eps_features.c deploy/stm32_package/eps_panel_store.c \
+ *       deploy/stm32_package/eps_rolling.c \
+ *       deploy/stm32_package/eps_protection_final.c deploy/stm32_package/eps_actuation.c \
+ *       deploy/stm32_package/eps_acquisition.c \
+ *       deploy/stm32_package/eps_model_slots.c deploy/stm32_package/eps_forest_blob.c \
+ *       deploy/stm32_package/eps_forest.c deploy/stm32_package/eps_forest_implicit.c \
+ *       deploy/c_code/power_model.c deploy/c_code/voltage_model.c -lm -o build/bench_pipeline
+ *
+ * Run:
+ *   build/bench_pipeline build/UGUISU.csv [repeats] > build/bench_pipeline.json
+ */
+
+#include "eps_acquisition.h"
+#include "eps_actuation.h"
+#include "eps_bias_corrector.h"
+#include "eps_model_config.h"
+#include "eps_p2_quantile.h"
+#include "eps_panel_store.h"
+#include "eps_protection_final.h"
+#include "eps_replay.h"
+#include "eps_rolling.h"
+#include "power_model.h"
+#include "voltage_model.h"
+#include <fcntl.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+// Host HAL stand-in peripherals (eps_hal_host.h)
+ADC_HandleTypeDef hadc1, hadc2, hadc3;
+GPIO_TypeDef eps_host_gpio[4];
+
+#define UW_PER_W 1e6
+#define MV_PER_V 1e3
+#define SAMPLE_MS 5000u         // 5 s sampling period
+
+// ===== REPLAYED INPUTS =====
+
+static struct {
+    EPS_ReplayRows rows;
+    int n_panels;
+    int rows_per_panel;
+    int n_samples;
+    const double *power;        // [n_samples * n_panels] uW
+    const double *voltage;      // [n_samples * n_panels] mV
+
+    // Per row, in W and V
+    float *P, *V, *P_pred, *V_pred;
+
+    EPS_FeatureBuffers buffers[REPLAY_MAX_PANELS];
+    EPS_PanelStore store;
+    double power_matrix[REPLAY_MAX_PANELS][POWER_N_FEATURES];
+    double voltage_matrix[REPLAY_MAX_PANELS][VOLTAGE_N_FEATURES];
+    P2Quantile p2[REPLAY_MAX_PANELS];
+    BiasCorrector bias[REPLAY_MAX_PANELS];
+    double features[POWER_N_FEATURES];
+    EPS_Rolling rolling[REPLAY_MAX_PANELS];
+    float cycle_P[REPLAY_MAX_PANELS], cycle_V[REPLAY_MAX_PANELS];
+    float cycle_P_pred[REPLAY_MAX_PANELS], cycle_V_pred[REPLAY_MAX_PANELS];
+    uint16_t scan_voltage[NUM_PANELS], scan_current[NUM_PANELS];   // Host DMA counts
+} in;
+
+static volatile double sink;
+
+// Rows are panel-major (eps_replay.c), samples in time order within a panel
+static int row_panel(int r) { return r / in.rows_per_panel; }
+
+// Samples for the ring-buffer benchmarks, panel-major as well
+static int step_panel(int i) { return i / in.n_samples; }
+static int step_sample(int i) { return i % in.n_samples; }
+
+// ===== OPERATIONS =====
+
+static int reset_rows(void) { return in.rows.n_rows; }
+static int reset_steps(void) { return in.n_samples * in.n_panels; }
+
+static void op_power_score(int i) { sink = eps_model_power_score(in.rows.power[i]); }
+static void op_voltage_score(int i) { sink = eps_model_voltage_score(in.rows.voltage[i]); }
+
+static int reset_extract(void) {
+    for (int p = 0; p < in.n_panels; p++) eps_init_buffers(&in.buffers[p]);
+    return reset_steps();
+}
+static void setup_extract(int i) {
+    int p = step_panel(i), t = step_sample(i);
+    eps_update_buffers(&in.buffers[p], in.power[t * in.n_panels + p], in.voltage[t * in.n_panels + p]);
+}
+static void op_extract(int i) {
+    eps_extract_power_features(&in.buffers[step_panel(i)], in.features);
+    sink = in.features[9];
+}
+
+static int reset_store(void) {
+    eps_store_init(&in.store);
+    return in.n_samples;
+}
+static void setup_store(int t) {
+    eps_store_push(&in.store, in.power + t * in.n_panels, in.voltage + t * in.n_panels, in.n_panels);
+}
+static void op_store(int t) {
+    (void)t;
+    eps_store_features(&in.store, in.n_panels, &in.power_matrix[0][0], POWER_N_FEATURES,
+                       &in.voltage_matrix[0][0], VOLTAGE_N_FEATURES);
+    sink = in.power_matrix[0][9];
+}
+
+#define ROLLING_BENCH_WINDOW 60
+
+static int reset_rolling(void) {
+    for (int p = 0; p < in.n_panels; p++) eps_rolling_init(&in.rolling[p], ROLLING_BENCH_WINDOW);
+    return reset_steps();
+}
+static void op_rolling(int i) {
+    int p = step_panel(i), t = step_sample(i);
+    EPS_Rolling *r = &in.rolling[p];
+    eps_rolling_push(r, in.power[t * in.n_panels + p]);
+    sink = eps_rolling_mean(r) + eps_rolling_var(r) + eps_rolling_min(r) + eps_rolling_max(r);
+}
+
+static int reset_p2(void) {
+    for (int p = 0; p < in.n_panels; p++) p2_init(&in.p2[p], 0.99f);
+    return reset_rows();
+}
+static void op_p2(int i) {
+    p2_update(&in.p2[row_panel(i)], fabsf(in.P[i] - in.P_pred[i]));
+}
+
+static int reset_bias(void) {
+    for (int p = 0; p < in.n_panels; p++) bias_init(&in.bias[p], 0.01f, 50);
+    return reset_rows();
+}
+static void op_bias(int i) {
+    bias_update(&in.bias[row_panel(i)], in.P[i], in.P_pred[i], in.V[i], in.V_pred[i]);
+}
+
+static int reset_protection(void) {
+    eps_acq_init();
+    eps_protection_init();
+    for (int p = 0; p < in.n_panels; p++) {
+        double P = 0.0, V = 0.0;
+        for (int r = p * in.rows_per_panel; r < (p + 1) * in.rows_per_panel; r++) {
+            P += in.P[r];
+            V += in.V[r];
+        }
+        eps_protection_init_panel((uint8_t)p, (float)(P / in.rows_per_panel),
+                                  (float)(V / in.rows_per_panel));
+    }
+    return reset_rows();
+}
+static void setup_protection(int i) {
+    (void)i;
+    sim_advance_time(SAMPLE_MS);
+    eps_actuation_tick(HAL_GetTick());      // Settle steps of the last sample (idle wait)
+    eps_acq_scan(EPS_ACQ_TIMEOUT_MS);       // Drain voltages of this sample
+}
+static void op_protection(int i) {
+    eps_protection_update((uint8_t)row_panel(i), in.P[i], in.V[i], in.P_pred[i], in.V_pred[i]);
+}
+
+// Same rows a sample at a time: sample k of every panel, gathered into
+// per-panel arrays
+static int reset_protection_all(void) {
+    reset_protection();
+    return in.rows_per_panel;
+}
+static void setup_protection_all(int k) {
+    for (int p = 0; p < in.n_panels; p++) {
+        int r = p * in.rows_per_panel + k;
+        in.cycle_P[p] = in.P[r];
+        in.cycle_V[p] = in.V[r];
+        in.cycle_P_pred[p] = in.P_pred[r];
+        in.cycle_V_pred[p] = in.V_pred[r];
+    }
+    sim_advance_time(SAMPLE_MS);
+    eps_actuation_tick(HAL_GetTick());      // Settle steps of the last sample (idle wait)
+    eps_acq_scan(EPS_ACQ_TIMEOUT_MS);       // Drain voltages of this sample
+}
+static void op_protection_all(int k) {
+    (void)k;
+    eps_protection_update_all(in.cycle_P, in.cycle_V, in.cycle_P_pred, in.cycle_V_pred,
+                              (uint8_t)in.n_panels);
+}
+static void op_conditions(int k) {
+    (void)k;
+    ProtectionMasks_t masks;
+    sink = eps_protection_conditions(in.cycle_P, in.cycle_V, in.cycle_P_pred, in.cycle_V_pred,
+                                     (uint8_t)in.n_panels, &masks);
+}
+
+static int reset_acq(void) {
+    eps_acq_init();
+    return in.n_samples;
+}
+static void op_acq_scan(int i) {
+    (void)i;
+    const EPS_SampleFrame *frame = eps_acq_scan(EPS_ACQ_TIMEOUT_MS);
+    float sum = 0.0f;
+    for (uint8_t p = 0; p < NUM_PANELS; p++) {
+        sum += eps_acq_voltage(frame, p) * eps_acq_current(frame, p) + eps_acq_drain_voltage(frame, p);
+    }
+    sink = sum;
+}
+
+typedef struct {
+    const char *name;
+    int (*reset)(void);          // Fresh state, returns the number of ops
+    void (*setup)(int i);        // Untimed prerequisite of op i (NULL: none)
+    void (*op)(int i);
+} PipelineBench;
+
+static const PipelineBench BENCHES[] = {
+    {"eps_model_power_score",      reset_rows,       NULL,             op_power_score},
+    {"eps_model_voltage_score",    reset_rows,       NULL,             op_voltage_score},
+    {"eps_extract_power_features", reset_extract,    setup_extract,    op_extract},
+    {"eps_store_features",         reset_store,      setup_store,      op_store},
+    {"eps_rolling_push",           reset_rolling,    NULL,             op_rolling},
+    {"p2_update",                  reset_p2,         NULL,             op_p2},
+    {"bias_update",                reset_bias,       NULL,             op_bias},
+    {"eps_protection_update",      reset_protection, setup_protection, op_protection},
+    {"eps_protection_update_all",  reset_protection_all, setup_protection_all, op_protection_all},
+    {"eps_protection_conditions",  reset_protection_all, setup_protection_all, op_conditions},
+    {"eps_acq_scan",               reset_acq,        NULL,             op_acq_scan},
+};
+#define N_BENCHES (int)(sizeof(BENCHES) / sizeof(BENCHES[0]))
+
+// ===== COUNTERS =====
+
+enum { CNT_CYCLES, CNT_INSTRUCTIONS, CNT_BRANCH_MISSES, N_COUNTERS };
+
+typedef struct {
+    double ns;
+    double count[N_COUNTERS];
+} Sample;
+
+static int perf_fd[N_COUNTERS] = {-1, -1, -1};
+
+static bool perf_open(void) {
+#if defined(__linux__)
+    static const uint64_t config[N_COUNTERS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    for (int k = 0; k < N_COUNTERS; k++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config[k];
+        attr.disabled = (k == 0);           // The group leader starts all three
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        perf_fd[k] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, k ? perf_fd[0] : -1, 0);
+        if (perf_fd[k] < 0) {
+            for (int j = 0; j < k; j++) close(perf_fd[j]);
+            perf_fd[0] = -1;
+            return false;
+        }
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void counters_start(void) {
+#if defined(__linux__)
+    if (perf_fd[0] >= 0) {
+        ioctl(perf_fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(perf_fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+static void counters_stop(Sample *s) {
+    memset(s->count, 0, sizeof(s->count));
+#if defined(__linux__)
+    if (perf_fd[0] >= 0) {
+        uint64_t group[1 + N_COUNTERS];
+        ioctl(perf_fd[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        if (read(perf_fd[0], group, sizeof(group)) == (ssize_t)sizeof(group)) {
+            for (int k = 0; k < N_COUNTERS; k++) s->count[k] = (double)group[1 + k];
+        }
+    }
+#endif
+}
+
+// One pass over all ops; with_op = false runs only the setup
+static int run_once(const PipelineBench *b, bool with_op, Sample *s) {
+    int n = b->reset();
+    double start = now_ns();
+    counters_start();
+    if (b->setup) {
+        for (int i = 0; i < n; i++) {
+            b->setup(i);
+            if (with_op) b->op(i);
+        }
+    } else {
+        for (int i = 0; i < n; i++) b->op(i);
+    }
+    counters_stop(s);
+    s->ns = now_ns() - start;
+    return n;
+}
+
+// Best of repeats, per op, setup subtracted
+static int run_bench(const PipelineBench *b, int repeats, Sample *best) {
+    int n = 0;
+    for (int pass = 0; pass < (b->setup ? 2 : 1); pass++) {
+        Sample min;
+        for (int r = 0; r < repeats; r++) {
+            Sample s;
+            n = run_once(b, pass == 0, &s);
+            if (r == 0 || s.ns < min.ns) min.ns = s.ns;
+            for (int k = 0; k < N_COUNTERS; k++) {
+                if (r == 0 || s.count[k] < min.count[k]) min.count[k] = s.count[k];
+            }
+        }
+        if (pass == 0) {
+            *best = min;
+        } else {
+            best->ns -= min.ns;
+            for (int k = 0; k < N_COUNTERS; k++) best->count[k] -= min.count[k];
+        }
+    }
+    best->ns /= n;
+    for (int k = 0; k < N_COUNTERS; k++) best->count[k] /= n;
+    return n;
+}
+
+// ===== OUTPUT =====
+
+// The FDIR code logs to stdout; keep it off the JSON while timing
+static int quiet_begin(void) {
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd >= 0) {
+        dup2(null_fd, STDOUT_FILENO);
+        close(null_fd);
+    }
+    return saved;
+}
+
+static void quiet_end(int saved) {
+    fflush(stdout);
+    if (saved >= 0) {
+        dup2(saved, STDOUT_FILENO);
+        close(saved);
+    }
+}
+
+static void print_count(const char *key, double value, bool have, const char *sep) {
+    if (have) {
+        printf("\"%s\": %.2f%s", key, value, sep);
+    } else {
+        printf("\"%s\": null%s", key, sep);
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s replay.csv [repeats]\n", argv[0]);
+        return 2;
+    }
+    int repeats = (argc > 2) ? atoi(argv[2]) : 5;
+    if (repeats < 1) repeats = 1;
+
+    EPS_Replay replay;
+    if (eps_replay_load(argv[1], &replay) != 0) return 1;
+    int n_rows = eps_replay_build_rows(&replay, &in.rows);
+    if (n_rows <= 0) {
+        fprintf(stderr, "%s: no complete feature rows\n", argv[1]);
+        return 1;
+    }
+    in.n_panels = replay.n_panels;
+    in.rows_per_panel = n_rows / replay.n_panels;
+    in.n_samples = replay.n_samples;
+    in.power = replay.power;
+    in.voltage = replay.voltage;
+    in.P = malloc(n_rows * sizeof(float));
+    in.V = malloc(n_rows * sizeof(float));
+    in.P_pred = malloc(n_rows * sizeof(float));
+    in.V_pred = malloc(n_rows * sizeof(float));
+    if (!in.P || !in.V || !in.P_pred || !in.V_pred) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (int r = 0; r < n_rows; r++) {
+        in.P[r] = (float)(in.rows.power_target[r] / UW_PER_W);
+        in.V[r] = (float)(in.rows.voltage_target[r] / MV_PER_V);
+        in.P_pred[r] = (float)(eps_model_power_score(in.rows.power[r]) / UW_PER_W);
+        in.V_pred[r] = (float)(eps_model_voltage_score(in.rows.voltage[r]) / MV_PER_V);
+    }
+    // 13 scan ranks from the replay panels (mV, mA) at the acquisition full scale
+    for (int p = 0; p < NUM_PANELS; p++) {
+        int k = p % in.n_panels;
+        in.scan_voltage[p] = (uint16_t)(in.voltage[k] / MV_PER_V / EPS_ACQ_VOLTAGE_SCALE * EPS_ACQ_COUNTS);
+        in.scan_current[p] = (uint16_t)(replay.current[k] / 1e3 / EPS_ACQ_CURRENT_SCALE * EPS_ACQ_COUNTS);
+    }
+    hadc1.scan = in.scan_voltage;
+    hadc2.scan = in.scan_current;
+
+    bool perf = perf_open();
+    Sample results[N_BENCHES];
+    int ops[N_BENCHES];
+    int saved = quiet_begin();
+    for (int b = 0; b < N_BENCHES; b++) {
+        ops[b] = run_bench(&BENCHES[b], repeats, &results[b]);
+    }
+    quiet_end(saved);
+
+    printf("{\n");
+    printf("  \"replay\": \"%s\",\n", argv[1]);
+    printf("  \"samples\": %d,\n", replay.n_samples);
+    printf("  \"panels\": %d,\n", replay.n_panels);
+    printf("  \"rows\": %d,\n", n_rows);
+    printf("  \"repeats\": %d,\n", repeats);
+    printf("  \"forest_backend\": %d,\n", EPS_FOREST_BACKEND);
+    printf("  \"model_hash\": {\"power\": \"%08X\", \"voltage\": \"%08X\"},\n",
+           (unsigned)eps_model_power_hash(), (unsigned)eps_model_voltage_hash());
+    printf("  \"perf_events\": %s,\n", perf ? "true" : "false");
+    printf("  \"benchmarks\": [\n");
+    for (int b = 0; b < N_BENCHES; b++) {
+        printf("    {\"name\": \"%s\", \"ops\": %d, \"ns_per_op\": %.2f, ",
+               BENCHES[b].name, ops[b], results[b].ns);
+        print_count("cycles_per_op", results[b].count[CNT_CYCLES], perf, ", ");
+        print_count("instructions_per_op", results[b].count[CNT_INSTRUCTIONS], perf, ", ");
+        print_count("branch_misses_per_op", results[b].count[CNT_BRANCH_MISSES], perf, "");
+        printf("}%s\n", (b + 1 < N_BENCHES) ? "," : "");
+    }
+    printf("  ]\n");
+    printf("}\n");
+
+    free(in.P);
+    free(in.V);
+    free(in.P_pred);
+    free(in.V_pred);
+    eps_replay_free_rows(&in.rows);
+    eps_replay_free(&replay);
+    return 0;
+}
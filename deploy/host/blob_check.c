@@ -0,0 +1,66 @@
+/**
+ * EPS Predictive FDIR - Forest Blob Check
+ * Maps a .bin model, validates it and compares its predictions with the
+ * compiled-in tables on replayed telemetry (ground check before uplink)
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -DEPS_FOREST_BACKEND=EPS_FOREST_BACKEND_TABLE \
+ *       -Ideploy/stm32_package -Ideploy/c_code -Ideploy/host \
+ *       deploy/host/blob_check.c deploy/host/eps_blob_map.c deploy/host/eps_replay.c \
+ *       deploy/stm32_package/eps_forest.c deploy/stm32_package/eps_forest_blob.c \
+ *       deploy/c_code/power_model.c deploy/c_code/voltage_model.c -o build/blob_check
+ *
+ * Run:
+ *   build/blob_check power|voltage deploy/c_code/power_model.bin build/NEPALISAT.csv
+ */
+
+#include "eps_blob_map.h"
+#include "eps_replay.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+int main(int argc, char **argv) {
+    if (argc != 4 || (strcmp(argv[1], "power") != 0 && strcmp(argv[1], "voltage") != 0)) {
+        fprintf(stderr, "usage: %s power|voltage model.bin replay.csv\n", argv[0]);
+        return 2;
+    }
+    bool is_power = strcmp(argv[1], "power") == 0;
+    const EPS_Forest *compiled = is_power ? &eps_power_forest : &eps_voltage_forest;
+
+    EPS_MappedForest mapped;
+    EPS_BlobStatus status = eps_blob_map_file(argv[2], &mapped);
+    if (status != BLOB_OK) {
+        fprintf(stderr, "%s: %s\n", argv[2], eps_blob_status_to_string(status));
+        return 1;
+    }
+    const EPS_ForestBlobHeader *h = (const EPS_ForestBlobHeader *)mapped.map;
+    printf("%s: v%u, %u bytes, crc 0x%08X, %u features, %u trees, %u nodes, %u leaves\n",
+           argv[2], h->version, h->total_size, h->crc32,
+           h->n_features, h->n_trees, h->n_nodes, h->n_leaves);
+    if (mapped.forest.n_features != compiled->n_features) {
+        fprintf(stderr, "%s: expected %u features for the %s model\n",
+                argv[2], compiled->n_features, argv[1]);
+        eps_blob_unmap(&mapped);
+        return 1;
+    }
+
+    EPS_Replay replay;
+    EPS_ReplayRows rows;
+    if (eps_replay_load(argv[3], &replay) != 0) return 1;
+    int n = eps_replay_build_rows(&replay, &rows);
+
+    int mismatches = 0;
+    for (int i = 0; i < n; i++) {
+        const double *x = is_power ? rows.power[i] : rows.voltage[i];
+        double a = eps_forest_score(&mapped.forest, x);
+        double b = eps_forest_score(compiled, x);
+        if (memcmp(&a, &b, sizeof(double)) != 0) mismatches++;
+    }
+    printf("%d rows, %d mismatches vs compiled-in model\n", n, mismatches);
+
+    eps_replay_free_rows(&rows);
+    eps_replay_free(&replay);
+    eps_blob_unmap(&mapped);
+    return mismatches ? 1 : 0;
+}
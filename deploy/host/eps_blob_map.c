@@ -0,0 +1,44 @@
+/**
+ * Host mmap loader implementation
+ */
+
+#include "eps_blob_map.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+EPS_BlobStatus eps_blob_map_file(const char *path, EPS_MappedForest *mapped) {
+    memset(mapped, 0, sizeof(*mapped));
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return BLOB_ERR_SIZE;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return BLOB_ERR_SIZE;
+    }
+
+    // Page-aligned, so the 8-byte section alignment holds
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return BLOB_ERR_SIZE;
+
+    EPS_BlobStatus status = eps_forest_blob_bind(map, (size_t)st.st_size, &mapped->forest);
+    if (status != BLOB_OK) {
+        munmap(map, (size_t)st.st_size);
+        return status;
+    }
+    mapped->map = map;
+    mapped->size = (size_t)st.st_size;
+    return BLOB_OK;
+}
+
+void eps_blob_unmap(EPS_MappedForest *mapped) {
+    if (mapped->map) {
+        munmap(mapped->map, mapped->size);
+    }
+    memset(mapped, 0, sizeof(*mapped));
+}
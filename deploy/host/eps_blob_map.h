@@ -0,0 +1,23 @@
+/**
+ * EPS Predictive FDIR - Host mmap loader for forest blobs
+ * Maps a .bin model read-only and binds an EPS_Forest to it in place
+ *
+ * Host only (POSIX mmap), not part of the STM32 image
+ */
+
+#ifndef EPS_BLOB_MAP_H
+#define EPS_BLOB_MAP_H
+
+#include "eps_forest_blob.h"
+
+typedef struct {
+    EPS_Forest forest;     // Points into the mapping
+    void *map;
+    size_t size;
+} EPS_MappedForest;
+
+// Returns BLOB_OK, a validation error, or BLOB_ERR_SIZE if the file cannot be mapped
+EPS_BlobStatus eps_blob_map_file(const char *path, EPS_MappedForest *mapped);
+void eps_blob_unmap(EPS_MappedForest *mapped);
+
+#endif // EPS_BLOB_MAP_H
@@ -0,0 +1,192 @@
+/**
+ * AVX2 lockstep forest evaluation with runtime CPU dispatch
+ */
+
+#include "eps_forest_avx2.h"
+#include <immintrin.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LANES 8
+#define CALIBRATE_ROWS 256
+#define CALIBRATE_RUNS 5
+
+// ===== TABLE FLATTENING =====
+
+static uint8_t subtree_depth(const EPS_Forest *forest, int16_t node) {
+    if (EPS_FOREST_IS_LEAF(node)) return 0;
+    uint8_t l = subtree_depth(forest, forest->children[2 * node]);
+    uint8_t r = subtree_depth(forest, forest->children[2 * node + 1]);
+    return 1 + (l > r ? l : r);
+}
+
+// Leaves go after the internal nodes: slot = n_nodes + leaf index
+static int32_t to_slot(const EPS_Forest *forest, int16_t child) {
+    return EPS_FOREST_IS_LEAF(child) ? forest->n_nodes + EPS_FOREST_LEAF(child) : child;
+}
+
+int eps_forest_avx2_init(EPS_ForestAVX2 *simd, const EPS_Forest *forest) {
+    memset(simd, 0, sizeof(*simd));
+    simd->source = forest;
+    simd->n_trees = forest->n_trees;
+    simd->n_slots = forest->n_nodes + forest->n_leaves;
+    simd->scale = forest->scale;
+
+    simd->root = malloc(forest->n_trees * sizeof(int32_t));
+    simd->depth = malloc(forest->n_trees);
+    simd->feature = malloc(simd->n_slots * sizeof(int32_t));
+    simd->threshold = malloc(simd->n_slots * sizeof(double));
+    simd->children = malloc(2 * simd->n_slots * sizeof(int32_t));
+    simd->value = malloc(simd->n_slots * sizeof(double));
+    if (!simd->root || !simd->depth || !simd->feature || !simd->threshold ||
+        !simd->children || !simd->value) {
+        eps_forest_avx2_free(simd);
+        return -1;
+    }
+
+    for (uint16_t t = 0; t < forest->n_trees; t++) {
+        simd->root[t] = to_slot(forest, forest->roots[t]);
+        simd->depth[t] = subtree_depth(forest, forest->roots[t]);
+    }
+    for (int32_t n = 0; n < forest->n_nodes; n++) {
+        simd->feature[n] = forest->feature[n];
+        simd->threshold[n] = forest->threshold[n];
+        simd->children[2 * n] = to_slot(forest, forest->children[2 * n]);
+        simd->children[2 * n + 1] = to_slot(forest, forest->children[2 * n + 1]);
+        simd->value[n] = 0.0;
+    }
+    for (int32_t l = 0; l < forest->n_leaves; l++) {
+        int32_t s = forest->n_nodes + l;
+        simd->feature[s] = 0;
+        simd->threshold[s] = INFINITY;
+        simd->children[2 * s] = s;       // x <= inf stays put
+        simd->children[2 * s + 1] = s;   // NaN stays put too
+        simd->value[s] = forest->leaf_value[l];
+    }
+    return 0;
+}
+
+void eps_forest_avx2_free(EPS_ForestAVX2 *simd) {
+    free(simd->root);
+    free(simd->depth);
+    free(simd->feature);
+    free(simd->threshold);
+    free(simd->children);
+    free(simd->value);
+    memset(simd, 0, sizeof(*simd));
+}
+
+bool eps_forest_avx2_available(void) {
+    static int cached = -1;
+    if (cached < 0) {
+        __builtin_cpu_init();
+        cached = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return cached == 1;
+}
+
+// ===== AVX2 KERNEL =====
+
+// 4x64-bit compare mask -> 4x32-bit (-1/0) in the low 128 bits
+__attribute__((target("avx2")))
+static inline __m128i narrow_mask(__m256d mask) {
+    const __m256i pick_low = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    __m256i m = _mm256_permutevar8x32_epi32(_mm256_castpd_si256(mask), pick_low);
+    return _mm256_castsi256_si128(m);
+}
+
+__attribute__((target("avx2")))
+static void score8_avx2(const EPS_ForestAVX2 *simd, const double *x, uint16_t stride,
+                        double *out) {
+    // Offset of each lane's row inside the 8-row block
+    const __m256i row_base = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                                _mm256_set1_epi32(stride));
+    __m256d sum_lo = _mm256_setzero_pd();
+    __m256d sum_hi = _mm256_setzero_pd();
+
+    for (uint16_t t = 0; t < simd->n_trees; t++) {
+        __m256i node = _mm256_set1_epi32(simd->root[t]);
+
+        for (uint8_t d = 0; d < simd->depth[t]; d++) {
+            __m256i feat = _mm256_i32gather_epi32(simd->feature, node, 4);
+            __m256i xi = _mm256_add_epi32(row_base, feat);
+
+            __m256d x_lo = _mm256_i32gather_pd(x, _mm256_castsi256_si128(xi), 8);
+            __m256d x_hi = _mm256_i32gather_pd(x, _mm256_extracti128_si256(xi, 1), 8);
+            __m256d t_lo = _mm256_i32gather_pd(simd->threshold, _mm256_castsi256_si128(node), 8);
+            __m256d t_hi = _mm256_i32gather_pd(simd->threshold, _mm256_extracti128_si256(node, 1), 8);
+
+            // !(x <= t): -1 where the walk goes right (NaN included)
+            __m256i go_right = _mm256_set_m128i(narrow_mask(_mm256_cmp_pd(x_hi, t_hi, _CMP_NLE_UQ)),
+                                                narrow_mask(_mm256_cmp_pd(x_lo, t_lo, _CMP_NLE_UQ)));
+            __m256i child = _mm256_sub_epi32(_mm256_add_epi32(node, node), go_right);
+            node = _mm256_i32gather_epi32(simd->children, child, 4);
+        }
+
+        __m256d v_lo = _mm256_i32gather_pd(simd->value, _mm256_castsi256_si128(node), 8);
+        __m256d v_hi = _mm256_i32gather_pd(simd->value, _mm256_extracti128_si256(node, 1), 8);
+        if (t == 0) {
+            // Start from tree 0 like eps_forest_score() (0.0 + -0.0 would differ)
+            sum_lo = v_lo;
+            sum_hi = v_hi;
+        } else {
+            sum_lo = _mm256_add_pd(sum_lo, v_lo);
+            sum_hi = _mm256_add_pd(sum_hi, v_hi);
+        }
+    }
+
+    const __m256d scale = _mm256_set1_pd(simd->scale);
+    _mm256_storeu_pd(out, _mm256_mul_pd(sum_lo, scale));
+    _mm256_storeu_pd(out + 4, _mm256_mul_pd(sum_hi, scale));
+}
+
+// ===== CALIBRATION =====
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+bool eps_forest_avx2_calibrate(EPS_ForestAVX2 *simd, const double *x, uint16_t stride, size_t n) {
+    simd->use_avx2 = false;
+    simd->scalar_ns = simd->avx2_ns = 0.0;
+    if (n > CALIBRATE_ROWS) n = CALIBRATE_ROWS;
+    n -= n % LANES;
+    if (!eps_forest_avx2_available() || n == 0) return false;
+
+    double out[CALIBRATE_ROWS];
+    double best_scalar = INFINITY, best_avx2 = INFINITY;
+    for (int run = 0; run < CALIBRATE_RUNS; run++) {
+        double start = now_ns();
+        eps_forest_score_batch(simd->source, x, stride, out, (int)n);
+        double mid = now_ns();
+        for (size_t i = 0; i < n; i += LANES) {
+            score8_avx2(simd, x + i * stride, stride, out + i);
+        }
+        double end = now_ns();
+        if (mid - start < best_scalar) best_scalar = mid - start;
+        if (end - mid < best_avx2) best_avx2 = end - mid;
+    }
+    simd->scalar_ns = best_scalar / n;
+    simd->avx2_ns = best_avx2 / n;
+    simd->use_avx2 = best_avx2 * EPS_AVX2_MIN_SPEEDUP < best_scalar;
+    return simd->use_avx2;
+}
+
+// ===== DISPATCH =====
+
+void eps_forest_avx2_score_batch(const EPS_ForestAVX2 *simd, const double *x, uint16_t stride,
+                                 double *out, size_t n) {
+    size_t i = 0;
+    if (simd->use_avx2 && eps_forest_avx2_available()) {
+        for (; i + LANES <= n; i += LANES) {
+            score8_avx2(simd, x + i * stride, stride, out + i);
+        }
+    }
+    if (i < n) {
+        eps_forest_score_batch(simd->source, x + i * stride, stride, out + i, (int)(n - i));
+    }
+}
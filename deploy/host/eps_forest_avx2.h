@@ -0,0 +1,64 @@
+/**
+ * EPS Predictive FDIR - AVX2 Forest Backend (ground / host replay)
+ * Evaluates 8 samples per tree in lockstep with gathers and compare masks
+ *
+ * The EPS_Forest tables are flattened at load time into one node array
+ * where leaves loop back to themselves, so every tree runs a fixed number
+ * of branch-free steps (its depth). Results are bit-identical to
+ * eps_forest_score().
+ *
+ * Lockstep runs every tree to its full depth with five gathers per step,
+ * so it only pays off for shallow trees. On the pruned depth-6 models it
+ * is ~2.7x slower than the scalar batch on replayed rows. The kernel is
+ * therefore off after init: eps_forest_avx2_calibrate() times both on
+ * sample rows and enables it only on a measured win. Without AVX2, or
+ * uncalibrated, scoring is eps_forest_score_batch().
+ *
+ * Host only (x86-64, GCC/Clang), not part of the STM32 image
+ */
+
+#ifndef EPS_FOREST_AVX2_H
+#define EPS_FOREST_AVX2_H
+
+#include "eps_forest.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const EPS_Forest *source;  // Scalar fallback
+    uint16_t n_trees;
+    int32_t n_slots;           // Internal nodes + leaves
+    double scale;
+
+    int32_t *root;             // [n_trees] slot of each root
+    uint8_t *depth;            // [n_trees] steps to reach the deepest leaf
+    int32_t *feature;          // [n_slots] leaves: 0
+    double *threshold;         // [n_slots] leaves: +inf
+    int32_t *children;         // [2*n_slots] leaves: self, self
+    double *value;             // [n_slots] leaf value (0 for internal nodes)
+
+    bool use_avx2;             // Set by eps_forest_avx2_calibrate()
+    double scalar_ns;          // Calibration: ns per row, scalar walk
+    double avx2_ns;            //              ns per row, lockstep kernel
+} EPS_ForestAVX2;
+
+// Lockstep must beat the scalar walk by this factor to be enabled
+#define EPS_AVX2_MIN_SPEEDUP 1.10
+
+// Returns 0 on success, -1 on allocation failure
+int eps_forest_avx2_init(EPS_ForestAVX2 *simd, const EPS_Forest *forest);
+void eps_forest_avx2_free(EPS_ForestAVX2 *simd);
+
+// True if the running CPU supports AVX2 (checked once)
+bool eps_forest_avx2_available(void);
+
+// Time both paths on up to 256 sample rows (row i at x + i*stride) and
+// enable the AVX2 kernel only if it wins by EPS_AVX2_MIN_SPEEDUP. Returns
+// use_avx2; false without AVX2 or with fewer than 8 rows.
+bool eps_forest_avx2_calibrate(EPS_ForestAVX2 *simd, const double *x, uint16_t stride, size_t n);
+
+// Score n rows (row i at x + i*stride); AVX2 kernel only if calibrated on
+void eps_forest_avx2_score_batch(const EPS_ForestAVX2 *simd, const double *x, uint16_t stride,
+                                 double *out, size_t n);
+
+#endif // EPS_FOREST_AVX2_H
@@ -0,0 +1,113 @@
+/**
+ * EPS Predictive FDIR - Host HAL Stand-In
+ * Just enough of the STM32 HAL for the FDIR sources (eps_protection_final.c,
+ * eps_main_deployment.c) to compile and run on the host: GPIO writes only
+ * latch a fake output register, ADC reads return 0, HAL_GetTick() is the
+ * simulated clock in eps_protection_final.c and delays advance that clock
+ * (returning at once). A DMA scan (eps_acquisition.c) copies the counts the
+ * host program left in the handle's 'scan' array (0 if NULL) and completes
+ * at once, calling HAL_ADC_ConvCpltCallback() before it returns.
+ *
+ * Force-include it ahead of the STM32 sources:
+ *   gcc -include deploy/host/eps_hal_host.h ...
+ * and define the peripherals once in the host program:
+ *   ADC_HandleTypeDef hadc1, hadc2, hadc3;
+ *   GPIO_TypeDef eps_host_gpio[4];
+ *
+ * Host only, not part of the STM32 image
+ */
+
+#ifndef EPS_HAL_HOST_H
+#define EPS_HAL_HOST_H
+
+#include <stdint.h>
+
+typedef struct { uint32_t ODR; } GPIO_TypeDef;
+typedef struct {
+    uint32_t Instance;
+    const uint16_t *scan;          // Host: counts of the next DMA scan, by rank
+} ADC_HandleTypeDef;
+typedef struct {
+    uint32_t Channel;
+    uint32_t Rank;
+    uint32_t SamplingTime;
+} ADC_ChannelConfTypeDef;
+
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+
+extern GPIO_TypeDef eps_host_gpio[4];
+#define GPIOA (&eps_host_gpio[0])
+#define GPIOB (&eps_host_gpio[1])
+#define GPIOC (&eps_host_gpio[2])
+#define GPIOD (&eps_host_gpio[3])
+
+#define GPIO_PIN_0  0x0001u
+#define GPIO_PIN_1  0x0002u
+#define GPIO_PIN_2  0x0004u
+#define GPIO_PIN_3  0x0008u
+#define GPIO_PIN_4  0x0010u
+#define GPIO_PIN_5  0x0020u
+#define GPIO_PIN_6  0x0040u
+#define GPIO_PIN_7  0x0080u
+
+#define ADC_CHANNEL_0   0u
+#define ADC_CHANNEL_1   1u
+#define ADC_CHANNEL_2   2u
+#define ADC_CHANNEL_3   3u
+#define ADC_CHANNEL_4   4u
+#define ADC_CHANNEL_5   5u
+#define ADC_CHANNEL_6   6u
+#define ADC_CHANNEL_7   7u
+#define ADC_CHANNEL_8   8u
+#define ADC_CHANNEL_9   9u
+#define ADC_CHANNEL_10  10u
+#define ADC_CHANNEL_11  11u
+#define ADC_CHANNEL_12  12u
+#define ADC_CHANNEL_13  13u
+#define ADC_CHANNEL_14  14u
+#define ADC_CHANNEL_15  15u
+#define ADC_SAMPLETIME_15CYCLES 1u
+
+// Telemetry clock (eps_cycle_clock.h): no DWT on the host, so the slot and
+// anytime timings (swap_us, shadow_us, eval_us) are stubbed to 0
+#define EPS_CLOCK() 0u
+#define EPS_CLOCK_PER_US() 1u
+
+uint32_t HAL_GetTick(void);
+void sim_advance_time(uint32_t ms);
+
+static inline void HAL_Delay(uint32_t ms) { sim_advance_time(ms); }
+
+static inline void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state) {
+    if (state == GPIO_PIN_SET) {
+        port->ODR |= pin;
+    } else {
+        port->ODR &= ~(uint32_t)pin;
+    }
+}
+
+static inline int HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, ADC_ChannelConfTypeDef *config) {
+    (void)hadc;
+    (void)config;
+    return 0;
+}
+static inline int HAL_ADC_Start(ADC_HandleTypeDef *hadc) { (void)hadc; return 0; }
+static inline int HAL_ADC_Stop(ADC_HandleTypeDef *hadc) { (void)hadc; return 0; }
+static inline int HAL_ADC_PollForConversion(ADC_HandleTypeDef *hadc, uint32_t timeout) {
+    (void)hadc;
+    (void)timeout;
+    return 0;
+}
+static inline uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef *hadc) { (void)hadc; return 0; }
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc);
+
+static inline int HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *data, uint32_t length) {
+    uint16_t *out = (uint16_t *)data;          // Halfword DMA
+    for (uint32_t k = 0; k < length; k++) out[k] = hadc->scan ? hadc->scan[k] : 0;
+    HAL_ADC_ConvCpltCallback(hadc);
+    return 0;
+}
+static inline int HAL_ADC_Stop_DMA(ADC_HandleTypeDef *hadc) { (void)hadc; return 0; }
+
+#endif // EPS_HAL_HOST_H
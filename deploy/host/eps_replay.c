@@ -0,0 +1,144 @@
+/**
+ * Host telemetry replay implementation
+ */
+
+#include "eps_replay.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int eps_replay_load(const char *path, EPS_Replay *replay) {
+    memset(replay, 0, sizeof(*replay));
+
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "replay: cannot open %s\n", path);
+        return -1;
+    }
+
+    char line[1024];
+    if (!fgets(line, sizeof(line), f)) {
+        fprintf(stderr, "replay: %s is empty\n", path);
+        fclose(f);
+        return -1;
+    }
+
+    int capacity = 4096;
+    replay->n_panels = REPLAY_MAX_PANELS;
+    replay->segment = malloc(capacity * sizeof(int));
+    replay->voltage = malloc(capacity * REPLAY_MAX_PANELS * sizeof(double));
+    replay->current = malloc(capacity * REPLAY_MAX_PANELS * sizeof(double));
+    replay->power = malloc(capacity * REPLAY_MAX_PANELS * sizeof(double));
+
+    while (fgets(line, sizeof(line), f)) {
+        if (replay->n_samples == capacity) {
+            capacity *= 2;
+            replay->segment = realloc(replay->segment, capacity * sizeof(int));
+            replay->voltage = realloc(replay->voltage, capacity * REPLAY_MAX_PANELS * sizeof(double));
+            replay->current = realloc(replay->current, capacity * REPLAY_MAX_PANELS * sizeof(double));
+            replay->power = realloc(replay->power, capacity * REPLAY_MAX_PANELS * sizeof(double));
+        }
+
+        int s = replay->n_samples;
+        char *p = line;
+        replay->segment[s] = (int)strtol(p, &p, 10);
+        for (int k = 0; k < REPLAY_MAX_PANELS; k++) {
+            double v = strtod(p + 1, &p);
+            double i = strtod(p + 1, &p);
+            replay->voltage[s * REPLAY_MAX_PANELS + k] = v;
+            replay->current[s * REPLAY_MAX_PANELS + k] = i;
+            replay->power[s * REPLAY_MAX_PANELS + k] = v * i;
+        }
+        replay->n_samples++;
+    }
+
+    fclose(f);
+    return 0;
+}
+
+void eps_replay_free(EPS_Replay *replay) {
+    free(replay->segment);
+    free(replay->voltage);
+    free(replay->current);
+    free(replay->power);
+    memset(replay, 0, sizeof(*replay));
+}
+
+#if EPS_SPEC_N_STATS
+enum { SIGNAL_power, SIGNAL_voltage };
+enum { STAT_mean, STAT_var, STAT_min, STAT_max };
+#define ROLLING_ENTRY(k, signal, window) {SIGNAL_##signal, window},
+#define STAT_ENTRY(j, k, name) {k, STAT_##name},
+static const struct { int signal, window; } ROLLING[] = { EPS_SPEC_ROLLING(ROLLING_ENTRY) };
+static const struct { int rolling, stat; } STATS[] = { EPS_SPEC_STATS(STAT_ENTRY) };
+
+// Statistic j of the window ending at sample end, directly from its
+// definition (two-pass variance, population)
+static double replay_stat(const double *const signals[2], int np, int j, int end) {
+    int window = ROLLING[STATS[j].rolling].window;
+    const double *s = signals[ROLLING[STATS[j].rolling].signal] + (end - window + 1) * np;
+    double sum = 0.0, lo = s[0], hi = s[0];
+    for (int i = 0; i < window; i++) {
+        sum += s[i * np];
+        if (s[i * np] < lo) lo = s[i * np];
+        if (s[i * np] > hi) hi = s[i * np];
+    }
+    double mean = sum / window;
+    switch (STATS[j].stat) {
+    case STAT_mean: return mean;
+    case STAT_min:  return lo;
+    case STAT_max:  return hi;
+    default: {
+        double m2 = 0.0;
+        for (int i = 0; i < window; i++) m2 += (s[i * np] - mean) * (s[i * np] - mean);
+        return m2 / window;
+    }
+    }
+}
+#endif
+
+// Training definitions (eps_feature_spec.h) for the row predicting sample t
+#define REPLAY_LAG(signal, age) signal[(t - (age)) * np]
+#define REPLAY_DIFF(signal, age) (signal[(t - (age)) * np] - signal[(t - (age) - 1) * np])
+#define REPLAY_STAT(j, age) replay_stat(signals, np, j, t - (age))
+#define POWER_FEATURE(i, kind, signal, age) rows->power[r][i] = REPLAY_##kind(signal, age);
+#define VOLTAGE_FEATURE(i, kind, signal, age) rows->voltage[r][i] = REPLAY_##kind(signal, age);
+
+int eps_replay_build_rows(const EPS_Replay *replay, EPS_ReplayRows *rows) {
+    int max_rows = replay->n_samples * replay->n_panels;
+    int np = replay->n_panels;
+
+    rows->n_rows = 0;
+    rows->power = malloc(max_rows * sizeof(*rows->power));
+    rows->voltage = malloc(max_rows * sizeof(*rows->voltage));
+    rows->power_target = malloc(max_rows * sizeof(double));
+    rows->voltage_target = malloc(max_rows * sizeof(double));
+
+    for (int panel = 0; panel < np; panel++) {
+        int seg_start = 0;
+        for (int t = 0; t < replay->n_samples; t++) {
+            if (replay->segment[t] != replay->segment[seg_start]) seg_start = t;
+            if (t - seg_start < REPLAY_HISTORY) continue;
+
+            const double *power = replay->power + panel;
+            const double *voltage = replay->voltage + panel;
+            const double *const signals[2] = {power, voltage};
+            (void)signals;
+            int r = rows->n_rows++;
+
+            EPS_SPEC_POWER_FEATURES(POWER_FEATURE)
+            EPS_SPEC_VOLTAGE_FEATURES(VOLTAGE_FEATURE)
+            rows->power_target[r] = power[t * np];
+            rows->voltage_target[r] = voltage[t * np];
+        }
+    }
+    return rows->n_rows;
+}
+
+void eps_replay_free_rows(EPS_ReplayRows *rows) {
+    free(rows->power);
+    free(rows->voltage);
+    free(rows->power_target);
+    free(rows->voltage_target);
+    memset(rows, 0, sizeof(*rows));
+}
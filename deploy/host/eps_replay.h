@@ -0,0 +1,46 @@
+/**
+ * EPS Predictive FDIR - Host Telemetry Replay
+ * Loads the CSV written by export_replay.py and builds model feature rows
+ * with the training definitions (deploy/models/feature_spec.json, compiled
+ * into eps_feature_spec.h)
+ *
+ * Host only (uses malloc/stdio), not part of the STM32 image
+ */
+
+#ifndef EPS_REPLAY_H
+#define EPS_REPLAY_H
+
+#include "eps_feature_spec.h"
+#include <stdint.h>
+
+#define REPLAY_MAX_PANELS 5
+#define REPLAY_POWER_FEATURES EPS_SPEC_POWER_N_FEATURES
+#define REPLAY_VOLTAGE_FEATURES EPS_SPEC_VOLTAGE_N_FEATURES
+#define REPLAY_HISTORY EPS_SPEC_HISTORY   // Oldest sample a row reads
+
+typedef struct {
+    int n_samples;
+    int n_panels;
+    int *segment;              // [n_samples] sheet (day) index
+    double *voltage;           // [n_samples * n_panels] mV
+    double *current;           // [n_samples * n_panels] mA
+    double *power;             // [n_samples * n_panels] uW (V * I)
+} EPS_Replay;
+
+// Feature rows for every (sample, panel) with full history inside its segment
+typedef struct {
+    int n_rows;
+    double (*power)[REPLAY_POWER_FEATURES];
+    double (*voltage)[REPLAY_VOLTAGE_FEATURES];
+    double *power_target;      // Measured power at the row's sample
+    double *voltage_target;    // Measured voltage at the row's sample
+} EPS_ReplayRows;
+
+// Returns 0 on success, -1 on error (message on stderr)
+int eps_replay_load(const char *path, EPS_Replay *replay);
+void eps_replay_free(EPS_Replay *replay);
+
+int eps_replay_build_rows(const EPS_Replay *replay, EPS_ReplayRows *rows);
+void eps_replay_free_rows(EPS_ReplayRows *rows);
+
+#endif // EPS_REPLAY_H
@@ -0,0 +1,89 @@
+"""
+Export satellite telemetry to the replay CSV read by the host tools
+(deploy/host/eps_replay.c)
+
+Reads the raw .xlsx workbooks directly (standard library only, no pandas),
+using the same columns as the notebooks: panel voltage in mV and current
+in mA for panels Y, +X, -Z, -X, +Z. Each sheet (one day of telemetry) is
+written as its own segment so lag features never span two days.
+
+Usage:
+  python deploy/host/export_replay.py data/NEPALISAT/NEPALISAT.xlsx build/NEPALISAT.csv
+"""
+
+import re
+import sys
+import zipfile
+import xml.etree.ElementTree as ET
+
+NS = {'m': 'http://schemas.openxmlformats.org/spreadsheetml/2006/main'}
+
+# Same panel order and column indices as the notebooks (raw_data builder)
+PANEL_NAMES = ['Y', '+X', '-Z', '-X', '+Z']
+VOLT_COLUMNS = [12, 14, 16, 18, 20]   # V (mV)
+AMP_COLUMNS = [22, 24, 26, 28, 30]    # I (mA)
+
+
+def _col_index(ref):
+    n = 0
+    for ch in re.match(r'[A-Z]+', ref).group(0):
+        n = n * 26 + ord(ch) - ord('A') + 1
+    return n - 1
+
+
+def read_workbook(path):
+    """Return [(sheet_name, [ {col: text} ... ])] for every sheet."""
+    z = zipfile.ZipFile(path)
+    strings = []
+    if 'xl/sharedStrings.xml' in z.namelist():
+        for si in ET.fromstring(z.read('xl/sharedStrings.xml')).findall('m:si', NS):
+            strings.append(''.join(t.text or '' for t in si.iter('{%s}t' % NS['m'])))
+
+    names = [s.get('name') for s in ET.fromstring(z.read('xl/workbook.xml')).find('m:sheets', NS)]
+    files = sorted((n for n in z.namelist() if re.match(r'xl/worksheets/sheet\d+\.xml$', n)),
+                   key=lambda n: int(re.findall(r'\d+', n)[0]))
+
+    sheets = []
+    for name, f in zip(names, files):
+        rows = []
+        for r in ET.fromstring(z.read(f)).find('m:sheetData', NS):
+            row = {}
+            for c in r:
+                v = c.find('m:v', NS)
+                if v is None:
+                    continue
+                row[_col_index(c.get('r'))] = strings[int(v.text)] if c.get('t') == 's' else v.text
+            rows.append(row)
+        sheets.append((name, rows))
+    return sheets
+
+
+def _num(text):
+    # Matches the notebooks: non-numeric cells become 0
+    try:
+        return float(text)
+    except (TypeError, ValueError):
+        return 0.0
+
+
+def export(xlsx_path, csv_path):
+    n = 0
+    with open(csv_path, 'w') as out:
+        cols = ['segment'] + ['V_%s,I_%s' % (p, p) for p in PANEL_NAMES]
+        out.write(','.join(cols) + '\n')
+        for segment, (name, rows) in enumerate(read_workbook(xlsx_path)):
+            for row in rows[1:]:  # skip the header row
+                vals = []
+                for vc, ac in zip(VOLT_COLUMNS, AMP_COLUMNS):
+                    vals.append(repr(_num(row.get(vc))))
+                    vals.append(repr(_num(row.get(ac))))
+                out.write('%d,%s\n' % (segment, ','.join(vals)))
+                n += 1
+    print(f"✓ {csv_path}: {n} samples x {len(PANEL_NAMES)} panels")
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        print(__doc__)
+        sys.exit(1)
+    export(sys.argv[1], sys.argv[2])
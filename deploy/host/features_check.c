@@ -0,0 +1,207 @@
+/**
+ * EPS Predictive FDIR - Lag Feature Golden Check
+ * Pushes replayed telemetry sample by sample through the incremental lag
+ * rings (eps_features.c) and the all-panel store (eps_panel_store.c), and
+ * checks every power and voltage feature row, bit for bit, against the
+ * training definitions in eps_replay.c. All see the same rows, restarted at
+ * each segment (day), from the first sample with RING_BUFFER_HISTORY
+ * samples of history. Rolling statistic features are summed in a different
+ * order than the direct definition, so they match to within ROLLING_TOL.
+ *
+ * The rolling window module (eps_rolling.c) is also checked on its own for
+ * every panel signal and window in ROLLING_WINDOWS: min and max exactly,
+ * mean and variance to within ROLLING_TOL of the largest value (squared)
+ * of the last two windows.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -Ideploy/stm32_package -Ideploy/c_code -Ideploy/host deploy/host/features_check.c \
+ *       deploy/host/eps_replay.c deploy/stm32_package/eps_features.c \
+ *       deploy/stm32_package/eps_panel_store.c deploy/stm32_package/eps_rolling.c -lm -o build/features_check
+ *
+ * Run:
+ *   build/features_check build/NEPALISAT.csv build/RAAVANA.csv build/UGUISU.csv
+ */
+
+#include "eps_model_config.h"
+#include "eps_panel_store.h"
+#include "eps_replay.h"
+#include "eps_rolling.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#define ROLLING_TOL 1e-9
+static const uint16_t ROLLING_WINDOWS[] = {2, 12, 60, EPS_ROLLING_MAX_WINDOW};
+
+#if REPLAY_HISTORY + 1 != RING_BUFFER_HISTORY || REPLAY_POWER_FEATURES != POWER_N_FEATURES || \
+    REPLAY_VOLTAGE_FEATURES != VOLTAGE_N_FEATURES
+#error "feature ring and replay definitions disagree"
+#endif
+
+#if EPS_SPEC_N_STATS
+// Same row up to rounding on the scale of its largest value (a variance
+// near 0 keeps the rounding of the values it was computed from)
+static bool close_values(const double *a, const double *b, int n) {
+    double scale = 1.0;
+    for (int i = 0; i < n; i++) scale = fmax(scale, fabs(b[i]));
+    for (int i = 0; i < n; i++) {
+        if (fabs(a[i] - b[i]) > ROLLING_TOL * scale) return false;
+    }
+    return true;
+}
+#endif
+
+static bool same_row(const double *power, const double *voltage, const EPS_ReplayRows *rows, int r) {
+#if EPS_SPEC_N_STATS
+    return close_values(power, rows->power[r], POWER_N_FEATURES) &&
+           close_values(voltage, rows->voltage[r], VOLTAGE_N_FEATURES);
+#else
+    return memcmp(power, rows->power[r], POWER_N_FEATURES * sizeof(double)) == 0 &&
+           memcmp(voltage, rows->voltage[r], VOLTAGE_N_FEATURES * sizeof(double)) == 0;
+#endif
+}
+
+// One signal of one panel through EPS_Rolling against the direct window
+// statistics; returns the number of mismatching samples
+static int check_rolling_signal(const EPS_Replay *replay, const double *signal, uint16_t window) {
+    int np = replay->n_panels, bad = 0, seg_start = 0;
+    EPS_Rolling r;
+    eps_rolling_init(&r, window);
+    for (int t = 0; t < replay->n_samples; t++) {
+        if (t > 0 && replay->segment[t] != replay->segment[t - 1]) {
+            eps_rolling_init(&r, window);
+            seg_start = t;
+        }
+        eps_rolling_push(&r, signal[t * np]);
+        if (t - seg_start + 1 < window) continue;
+
+        double sum = 0.0, lo = signal[t * np], hi = lo;
+        for (int i = t - window + 1; i <= t; i++) {
+            sum += signal[i * np];
+            lo = fmin(lo, signal[i * np]);
+            hi = fmax(hi, signal[i * np]);
+        }
+        double mean = sum / window, m2 = 0.0;
+        for (int i = t - window + 1; i <= t; i++) m2 += (signal[i * np] - mean) * (signal[i * np] - mean);
+        // The sliding updates round with the largest value they saw since the
+        // last rebuild, at most two windows back
+        double scale = 1.0;
+        for (int i = (t - 2 * window + 1 > seg_start) ? t - 2 * window + 1 : seg_start; i <= t; i++) {
+            scale = fmax(scale, fabs(signal[i * np]));
+        }
+        if (!eps_rolling_ready(&r) || eps_rolling_min(&r) != lo || eps_rolling_max(&r) != hi ||
+            fabs(eps_rolling_mean(&r) - mean) > ROLLING_TOL * scale ||
+            fabs(eps_rolling_var(&r) - m2 / window) > ROLLING_TOL * scale * scale) {
+            bad++;
+        }
+    }
+    return bad;
+}
+
+static int check_rolling(const char *path, const EPS_Replay *replay) {
+    int bad = 0;
+    for (size_t w = 0; w < sizeof(ROLLING_WINDOWS) / sizeof(ROLLING_WINDOWS[0]); w++) {
+        for (int p = 0; p < replay->n_panels; p++) {
+            bad += check_rolling_signal(replay, replay->power + p, ROLLING_WINDOWS[w]);
+            bad += check_rolling_signal(replay, replay->voltage + p, ROLLING_WINDOWS[w]);
+        }
+    }
+    if (bad) fprintf(stderr, "%s: %d rolling statistics differ from their definition\n", path, bad);
+    return bad;
+}
+
+// All panels at once through the SoA store; replay rows are panel-major
+static int check_store(const char *path, const EPS_Replay *replay, const EPS_ReplayRows *rows) {
+    int np = replay->n_panels;
+    int per_panel = rows->n_rows / np;
+    double power[EPS_STORE_LANES][POWER_N_FEATURES], voltage[EPS_STORE_LANES][VOLTAGE_N_FEATURES];
+    double P[EPS_STORE_LANES], V[EPS_STORE_LANES];
+    EPS_PanelStore store;
+    eps_store_init(&store);
+
+    int k = 0, bad = 0;
+    for (int t = 0; t < replay->n_samples; t++) {
+        if (t > 0 && replay->segment[t] != replay->segment[t - 1]) eps_store_init(&store);
+        for (int p = 0; p < np; p++) {
+            P[p] = replay->power[t * np + p];
+            V[p] = replay->voltage[t * np + p];
+        }
+        eps_store_push(&store, P, V, np);
+        if (!eps_store_ready(&store)) continue;
+
+        eps_store_features(&store, np, &power[0][0], POWER_N_FEATURES, &voltage[0][0], VOLTAGE_N_FEATURES);
+        for (int p = 0; p < np; p++) {
+            if (k >= per_panel || !same_row(power[p], voltage[p], rows, p * per_panel + k)) {
+                if (!bad) {
+                    fprintf(stderr, "%s: store panel %d sample %d: feature row differs from training definition\n",
+                            path, p, t);
+                }
+                bad++;
+            }
+        }
+        k++;
+    }
+    if (k * np != rows->n_rows) {
+        fprintf(stderr, "%s: store has %d feature rows, training definition has %d\n", path, k * np, rows->n_rows);
+        bad++;
+    }
+    return bad;
+}
+
+// Returns the number of mismatching rows (first one printed)
+static int check_replay(const char *path) {
+    EPS_Replay replay;
+    EPS_ReplayRows rows;
+    if (eps_replay_load(path, &replay) != 0) return -1;
+    int n = eps_replay_build_rows(&replay, &rows);
+    int np = replay.n_panels;
+
+    int r = 0, bad = 0;
+    for (int panel = 0; panel < np; panel++) {
+        EPS_FeatureBuffers buffers;
+        eps_init_buffers(&buffers);
+        for (int t = 0; t < replay.n_samples; t++) {
+            if (t > 0 && replay.segment[t] != replay.segment[t - 1]) eps_init_buffers(&buffers);
+            eps_update_buffers(&buffers, replay.power[t * np + panel], replay.voltage[t * np + panel]);
+            if (!eps_features_ready(&buffers)) continue;
+
+            double power[POWER_N_FEATURES], voltage[VOLTAGE_N_FEATURES];
+            eps_extract_power_features(&buffers, power);
+            eps_extract_voltage_features(&buffers, voltage);
+            if (r >= n || !same_row(power, voltage, &rows, r)) {
+                if (!bad) {
+                    fprintf(stderr, "%s: panel %d sample %d: feature row differs from training definition\n",
+                            path, panel, t);
+                }
+                bad++;
+            }
+            r++;
+        }
+    }
+    if (r != n) {
+        fprintf(stderr, "%s: %d feature rows, training definition has %d\n", path, r, n);
+        bad++;
+    }
+    int bad_store = check_store(path, &replay, &rows);
+    int bad_rolling = check_rolling(path, &replay);
+    printf("%-28s %6d rows, %d mismatches (per panel), %d (panel store), %d (rolling windows)\n",
+           path, r, bad, bad_store, bad_rolling);
+    bad += bad_store + bad_rolling;
+    eps_replay_free_rows(&rows);
+    eps_replay_free(&replay);
+    return bad;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s replay.csv [replay.csv ...]\n", argv[0]);
+        return 2;
+    }
+    int failures = 0;
+    for (int a = 1; a < argc; a++) {
+        int bad = check_replay(argv[a]);
+        failures += (bad != 0);
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * EPS Predictive FDIR - Fixed-Point Path Check
+ * Replays telemetry through the integer pipeline (eps_fixed_pipeline.c) and
+ * checks that every tree of both models ends at the same leaf as the double
+ * model on the same sample. Exits 1 on any difference.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -DEPS_FOREST_ALL_BACKENDS -Ideploy/stm32_package -Ideploy/c_code -Ideploy/host \
+ *       deploy/host/fixed_check.c deploy/host/eps_replay.c \
+ *       deploy/stm32_package/eps_fixed_pipeline.c deploy/stm32_package/eps_forest_fixed.c \
+ *       deploy/stm32_package/eps_forest.c deploy/stm32_package/eps_forest_qs.c \
+ *       deploy/stm32_package/eps_forest_q.c deploy/stm32_package/eps_forest_f32.c \
+ *       deploy/stm32_package/eps_forest_implicit.c \
+ *       deploy/c_code/power_model.c deploy/c_code/voltage_model.c -lm -o build/fixed_check
+ *
+ * Run:
+ *   build/fixed_check build/NEPALISAT.csv build/RAAVANA.csv build/UGUISU.csv
+ */
+
+#include "eps_fixed_pipeline.h"
+#include "eps_replay.h"
+#include <math.h>
+#include <stdio.h>
+
+// Leaf index reached by the double model
+static int leaf_double(const EPS_Forest *forest, uint16_t tree, const double *x) {
+    int16_t node = forest->roots[tree];
+    while (!EPS_FOREST_IS_LEAF(node)) {
+        node = forest->children[2 * node + !(x[forest->feature[node]] <= forest->threshold[node])];
+    }
+    return EPS_FOREST_LEAF(node);
+}
+
+static int count_path_mismatches(const EPS_Forest *ref, const EPS_ForestFixed *fixed,
+                                 const double *x, const int64_t *xi) {
+    uint16_t xq[EPS_FIXED_MAX_FEATURES];
+    for (uint16_t f = 0; f < fixed->n_features; f++) {
+        xq[f] = eps_forest_fixed_code(&fixed->quant[f], xi[f]);
+    }
+    int bad = 0;
+    for (uint16_t t = 0; t < ref->n_trees; t++) {
+        if (leaf_double(ref, t, x) != eps_forest_fixed_leaf(fixed, t, xq)) bad++;
+    }
+    return bad;
+}
+
+static int check_replay(const char *path) {
+    EPS_Replay replay;
+    EPS_ReplayRows rows;
+    if (eps_replay_load(path, &replay) != 0) return -1;
+    int n = eps_replay_build_rows(&replay, &rows);
+    int np = replay.n_panels;
+
+    // Stream each panel through the integer pipeline in the same row order
+    // as eps_replay_build_rows() (panel by panel, history reset per segment)
+    int r = 0, bad_p = 0, bad_v = 0;
+    double err_p = 0.0, err_v = 0.0;
+    for (int panel = 0; panel < np; panel++) {
+        EPS_FixedPanel state;
+        eps_fixed_panel_init(&state);
+        for (int t = 0; t < replay.n_samples; t++) {
+            if (t > 0 && replay.segment[t] != replay.segment[t - 1]) {
+                eps_fixed_panel_init(&state);
+            }
+            int32_t v_uV = (int32_t)llround(replay.voltage[t * np + panel] * 1000.0);
+            int32_t i_uA = (int32_t)llround(replay.current[t * np + panel] * 1000.0);
+
+            if (eps_fixed_panel_ready(&state)) {
+                int64_t power_x[10], voltage_x[5];
+                eps_fixed_power_features(&state, power_x);
+                eps_fixed_voltage_features(&state, voltage_x);
+                bad_p += count_path_mismatches(&eps_power_forest, &eps_power_forest_fixed,
+                                               rows.power[r], power_x);
+                bad_v += count_path_mismatches(&eps_voltage_forest, &eps_voltage_forest_fixed,
+                                               rows.voltage[r], voltage_x);
+
+                EPS_FixedResult res;
+                eps_fixed_step(&state, v_uV, i_uA, &res);
+                double dp = fabs(res.power_pred_pW * 1e-6 - eps_forest_score(&eps_power_forest, rows.power[r]));
+                double dv = fabs(res.voltage_pred_uV * 1e-3 - eps_forest_score(&eps_voltage_forest, rows.voltage[r]));
+                if (dp > err_p) err_p = dp;
+                if (dv > err_v) err_v = dv;
+                r++;
+            } else {
+                eps_fixed_panel_push(&state, v_uV, i_uA);
+            }
+        }
+    }
+
+    printf("%s: %d rows, %d trees/row, path mismatches power %d voltage %d, "
+           "max |fixed - double| %.3g uW, %.3g mV\n",
+           path, r, eps_power_forest.n_trees, bad_p, bad_v, err_p, err_v);
+    int failed = (r != n) || bad_p || bad_v;
+    if (r != n) printf("  row count differs from the double replay (%d)\n", n);
+
+    eps_replay_free_rows(&rows);
+    eps_replay_free(&replay);
+    return failed;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s replay.csv [replay.csv ...]\n", argv[0]);
+        return 2;
+    }
+    int failures = 0;
+    for (int i = 1; i < argc; i++) {
+        failures += (check_replay(argv[i]) != 0);
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,188 @@
+/**
+ * EPS Predictive FDIR - Single-Precision Accuracy Check
+ * Replays telemetry through the float pipeline (EPS_FOREST_BACKEND_FLOAT32:
+ * float samples P = V * I, float feature rings, eps_forest_f32.c) and
+ * compares every prediction with the double table walk on the same
+ * (sample, panel), fed two ways:
+ *   training   the training definition rows (double telemetry)
+ *   on board   the same float samples, features in double: what the double
+ *              build computes from the float ADC readings
+ *
+ * Reported per model and reference:
+ *   max / mean |f32 - double| prediction
+ *   flipped paths: (row, tree) pairs whose leaf differs from the double
+ *                  model, and the rows with at least one. These come from
+ *                  the feature values (rounded inputs, float first
+ *                  differences), never from the tables:
+ *   table flips:   the float tables against the double tables on the same
+ *                  float row, 0 by construction (thresholds rounded down);
+ *                  any other count fails the check (exit 1)
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -DEPS_FOREST_BACKEND=EPS_FOREST_BACKEND_FLOAT32 -DEPS_FOREST_ALL_BACKENDS \
+ *       -Ideploy/stm32_package -Ideploy/c_code -Ideploy/host deploy/host/float_check.c \
+ *       deploy/host/eps_replay.c deploy/stm32_package/eps_features.c deploy/stm32_package/eps_rolling.c \
+ *       deploy/stm32_package/eps_forest.c deploy/stm32_package/eps_forest_f32.c \
+ *       deploy/stm32_package/eps_forest_fixed.c \
+ *       deploy/c_code/power_model.c deploy/c_code/voltage_model.c -lm -o build/float_check
+ *
+ * Run:
+ *   build/float_check build/NEPALISAT.csv build/RAAVANA.csv build/UGUISU.csv
+ */
+
+#include "eps_forest_f32.h"
+#include "eps_model_config.h"
+#include "eps_replay.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if EPS_FOREST_BACKEND != EPS_FOREST_BACKEND_FLOAT32
+#error "build with -DEPS_FOREST_BACKEND=EPS_FOREST_BACKEND_FLOAT32 (float feature rings)"
+#endif
+
+typedef struct {
+    double max_err, sum_err;
+    long flips;                    // (row, tree) pairs on another leaf
+    int flip_rows;                 // Rows with at least one flip
+} Envelope;
+
+static int leaf_double(const EPS_Forest *forest, uint16_t tree, const double *x) {
+    int16_t node = forest->roots[tree];
+    while (!EPS_FOREST_IS_LEAF(node)) {
+        node = forest->children[2 * node + !(x[forest->feature[node]] <= forest->threshold[node])];
+    }
+    return EPS_FOREST_LEAF(node);
+}
+
+static int leaf_f32(const EPS_ForestF32 *forest, uint16_t tree, const float *x) {
+    int16_t node = forest->roots[tree];
+    while (!EPS_FOREST_IS_LEAF(node)) {
+        node = forest->children[2 * node + !(x[forest->feature[node]] <= forest->threshold[node])];
+    }
+    return EPS_FOREST_LEAF(node);
+}
+
+static void add_row(Envelope *env, const EPS_Forest *ref, const EPS_ForestF32 *f32,
+                    const double *x, const float *xf, float pred) {
+    int flips = 0;
+    for (uint16_t t = 0; t < ref->n_trees; t++) flips += leaf_f32(f32, t, xf) != leaf_double(ref, t, x);
+    env->flips += flips;
+    env->flip_rows += flips > 0;
+
+    double err = fabs((double)pred - eps_forest_score(ref, x));
+    if (err > env->max_err) env->max_err = err;
+    env->sum_err += err;
+}
+
+// One float pipeline row xf against the training row x and the on-board
+// double row xb; returns the table flips
+static long compare_row(Envelope env[2], const EPS_Forest *ref, const EPS_ForestF32 *f32,
+                        const double *x, const double *xb, const float *xf) {
+    double xd[POWER_N_FEATURES + VOLTAGE_N_FEATURES];   // Room for either model
+    for (uint16_t f = 0; f < ref->n_features; f++) xd[f] = xf[f];
+
+    long table_flips = 0;
+    for (uint16_t t = 0; t < ref->n_trees; t++) {
+        table_flips += leaf_f32(f32, t, xf) != leaf_double(ref, t, xd);
+    }
+    float pred = eps_forest_f32_score(f32, xf);
+    add_row(&env[0], ref, f32, x, xf, pred);
+    add_row(&env[1], ref, f32, xb, xf, pred);
+    return table_flips;
+}
+
+static void print_envelope(const char *model, const char *unit, const Envelope env[2], int n, long table_flips) {
+    static const char *const REFERENCE[2] = {"training", "on board"};
+    for (int k = 0; k < 2; k++) {
+        printf("  %-8s %-9s max |f32 - double| %-9.4g %s (mean %.3g), flipped paths %ld in %d rows\n",
+               k ? "" : model, REFERENCE[k], env[k].max_err, unit, n ? env[k].sum_err / n : 0.0,
+               env[k].flips, env[k].flip_rows);
+    }
+    printf("  %-8s table flips %ld\n", "", table_flips);
+}
+
+// Copy of the replay with the samples the satellite sees: float voltage and
+// current, power multiplied in float
+static void float_samples(const EPS_Replay *replay, EPS_Replay *out) {
+    size_t n = (size_t)replay->n_samples * replay->n_panels;
+    *out = *replay;
+    out->segment = malloc(replay->n_samples * sizeof(int));
+    memcpy(out->segment, replay->segment, replay->n_samples * sizeof(int));
+    out->voltage = malloc(n * sizeof(double));
+    out->current = malloc(n * sizeof(double));
+    out->power = malloc(n * sizeof(double));
+    for (size_t k = 0; k < n; k++) {
+        float v = (float)replay->voltage[k];
+        float i = (float)replay->current[k];
+        out->voltage[k] = v;
+        out->current[k] = i;
+        out->power[k] = v * i;
+    }
+}
+
+static int check_replay(const char *path) {
+    EPS_Replay replay;
+    EPS_ReplayRows rows;
+    if (eps_replay_load(path, &replay) != 0) return -1;
+    int n = eps_replay_build_rows(&replay, &rows);
+    int np = replay.n_panels;
+
+    EPS_Replay board;
+    EPS_ReplayRows board_rows;
+    float_samples(&replay, &board);
+    eps_replay_build_rows(&board, &board_rows);
+
+    // Same row order as eps_replay_build_rows(): panel by panel, history
+    // reset per segment
+    Envelope power[2] = {{0}}, voltage[2] = {{0}};
+    long power_table = 0, voltage_table = 0;
+    int r = 0;
+    for (int panel = 0; panel < np; panel++) {
+        EPS_FeatureBuffers buffers;
+        eps_init_buffers(&buffers);
+        for (int t = 0; t < replay.n_samples; t++) {
+            if (t > 0 && replay.segment[t] != replay.segment[t - 1]) eps_init_buffers(&buffers);
+            eps_update_buffers(&buffers, (float)board.power[t * np + panel], (float)board.voltage[t * np + panel]);
+            if (!eps_features_ready(&buffers)) continue;
+            if (r >= n) {
+                r++;
+                continue;
+            }
+
+            float power_x[POWER_N_FEATURES], voltage_x[VOLTAGE_N_FEATURES];
+            eps_extract_power_features(&buffers, power_x);
+            eps_extract_voltage_features(&buffers, voltage_x);
+            power_table += compare_row(power, &eps_power_forest, &eps_power_forest_f32,
+                                       rows.power[r], board_rows.power[r], power_x);
+            voltage_table += compare_row(voltage, &eps_voltage_forest, &eps_voltage_forest_f32,
+                                         rows.voltage[r], board_rows.voltage[r], voltage_x);
+            r++;
+        }
+    }
+
+    printf("%s: %d rows x %d trees\n", path, r, eps_power_forest.n_trees);
+    print_envelope("power", "uW", power, r, power_table);
+    print_envelope("voltage", "mV", voltage, r, voltage_table);
+    int failed = (r != n) || power_table || voltage_table;
+    if (r != n) printf("  row count differs from the double replay (%d)\n", n);
+
+    eps_replay_free_rows(&board_rows);
+    eps_replay_free(&board);
+    eps_replay_free_rows(&rows);
+    eps_replay_free(&replay);
+    return failed;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s replay.csv [replay.csv ...]\n", argv[0]);
+        return 2;
+    }
+    int failures = 0;
+    for (int i = 1; i < argc; i++) {
+        failures += (check_replay(argv[i]) != 0);
+    }
+    return failures ? 1 : 0;
+}
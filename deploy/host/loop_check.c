@@ -0,0 +1,135 @@
+/**
+ * EPS Predictive FDIR - Main Loop Actuation Check
+ * Runs the flight loop eps_main_loop_iteration() (eps_main_deployment.c)
+ * on the host's simulated clock, 5 s per cycle, and never calls
+ * eps_actuation_tick() itself, so the comparator and MOSFET settle steps
+ * only complete if the flight code runs them:
+ *
+ *   Layer 2 trip  panel 0's comparator is armed after the history has
+ *                 filled and its drain sense drops to 0 V (hardware trip);
+ *                 the next cycle must see the trip (COMP_TRIPPED)
+ *   re-enable     CMD_REENABLE with the drain back at bus level; the MOSFET
+ *                 verify step must report the panel re-enabled
+ *
+ * All other drain channels read a closed MOSFET. Exits 1 if either is
+ * missed.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -DEPS_HOST_CHECK -include deploy/host/eps_hal_host.h \
+ *       -Ideploy/stm32_package -Ideploy/c_code -Ideploy/host \
+ *       deploy/host/loop_check.c deploy/stm32_package/eps_main_deployment.c \
+ *       deploy/stm32_package/eps_features.c deploy/stm32_package/eps_panel_store.c \
+ *       deploy/stm32_package/eps_protection_final.c deploy/stm32_package/eps_actuation.c \
+ *       deploy/stm32_package/eps_acquisition.c deploy/stm32_package/eps_model_slots.c \
+ *       deploy/stm32_package/eps_forest_blob.c deploy/stm32_package/eps_forest.c \
+ *       deploy/stm32_package/eps_forest_implicit.c \
+ *       deploy/c_code/power_model.c deploy/c_code/voltage_model.c -lm -o build/loop_check
+ *
+ * Add -DEPS_MULTI_TARGET, deploy/stm32_package/eps_forest_multi.c and
+ * deploy/c_code/panel_model.c to run the same checks on the panel model loop.
+ *
+ * Run:
+ *   build/loop_check
+ */
+
+#include "eps_acquisition.h"
+#include "eps_model_config.h"
+#include "eps_protection_final.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// Host HAL stand-in peripherals (eps_hal_host.h)
+ADC_HandleTypeDef hadc1, hadc2, hadc3;
+GPIO_TypeDef eps_host_gpio[4];
+
+// eps_main_deployment.c
+void eps_main_init(void);
+void eps_main_loop_iteration(void);
+
+#define SAMPLE_MS 5000u
+
+// Nominal panel: 17.5 V, 0.48 A; drain sense at 3 V while the MOSFET is closed
+static uint16_t scan_voltage[NUM_PANELS];
+static uint16_t scan_current[NUM_PANELS];
+static uint16_t scan_drain[NUM_PANELS];
+
+static void cycle(void) {
+    sim_advance_time(SAMPLE_MS);
+    eps_main_loop_iteration();
+}
+
+// The FDIR code logs to stdout; keep it in a file the check can search
+static int log_begin(FILE *log) {
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    dup2(fileno(log), STDOUT_FILENO);
+    return saved;
+}
+
+static void log_end(int saved) {
+    fflush(stdout);
+    if (saved >= 0) {
+        dup2(saved, STDOUT_FILENO);
+        close(saved);
+    }
+}
+
+static int log_contains(FILE *log, const char *text) {
+    char line[256];
+    rewind(log);
+    while (fgets(line, sizeof(line), log)) {
+        if (strstr(line, text)) return 1;
+    }
+    return 0;
+}
+
+int main(void) {
+    for (int p = 0; p < NUM_PANELS; p++) {
+        scan_voltage[p] = (uint16_t)(17.5f / EPS_ACQ_VOLTAGE_SCALE * EPS_ACQ_COUNTS);
+        scan_current[p] = (uint16_t)(0.48f / EPS_ACQ_CURRENT_SCALE * EPS_ACQ_COUNTS);
+        scan_drain[p] = (uint16_t)(3.0f / EPS_ACQ_DRAIN_SCALE * EPS_ACQ_COUNTS);
+    }
+    hadc1.scan = scan_voltage;
+    hadc2.scan = scan_current;
+    hadc3.scan = scan_drain;
+
+    FILE *log = tmpfile();
+    if (!log) return 1;
+    int saved = log_begin(log);
+
+    eps_main_init();
+    for (int i = 0; i < RING_BUFFER_HISTORY; i++) cycle();   // Features ready
+
+    // Arm panel 0 (power spike + residual), as a cycle of the protection
+    // update would; its comparator is now settling
+    float P[NUM_PANELS], V[NUM_PANELS], P_pred[NUM_PANELS], V_pred[NUM_PANELS];
+    for (int p = 0; p < NUM_PANELS; p++) {
+        P[p] = 17.5f * 0.48f;
+        V[p] = 17.5f;
+        P_pred[p] = (p == 0) ? 1.5f * P[p] : P[p];
+        V_pred[p] = V[p];
+    }
+    eps_protection_update_all(P, V, P_pred, V_pred, NUM_PANELS);
+    int armed = panels[0].state == COMP_ENABLED;
+
+    scan_drain[0] = 0;                                       // Hardware trip
+    cycle();
+    int tripped = panels[0].state == COMP_TRIPPED;
+
+    scan_drain[0] = (uint16_t)(3.0f / EPS_ACQ_DRAIN_SCALE * EPS_ACQ_COUNTS);
+    process_ground_command(0, CMD_REENABLE);
+    cycle();                                                 // TRIPPED -> RECOVERY
+    int recovering = panels[0].state == COMP_RECOVERY;
+    cycle();                                                 // Verify step due
+    log_end(saved);
+
+    int verified = log_contains(log, "Panel 0: MOSFET re-enabled");
+    fclose(log);
+
+    printf("Layer 2 armed:     %s\n", armed ? "ok" : "FAIL");
+    printf("Layer 2 trip seen: %s\n", tripped ? "ok" : "FAIL");
+    printf("re-enable:         %s\n", recovering ? "ok" : "FAIL");
+    printf("MOSFET verified:   %s\n", verified ? "ok" : "FAIL");
+    return (armed && tripped && recovering && verified) ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+/**
+ * EPS Predictive FDIR - Multi-Target Forest Check
+ * Scores replayed telemetry with the generated panel model
+ * (deploy/c_code/panel_model.c) and compares P, V and I with the Python
+ * predictions of the same forest (eps_forest_export.py
+ * --multi-predictions), bit for bit. Rows are the 10 power features
+ * followed by the 5 voltage features, as the EPS_MULTI_TARGET main loop
+ * builds them. Both eps_forest_multi_score() and
+ * eps_forest_multi_score_batch() (13 rows per call, as in flight) are
+ * checked. Exits 1 on any difference.
+ *
+ * Build (from the repository root):
+ *   python3 eps_forest_export.py --multi-predictions build \
+ *       --telemetry build/NEPALISAT.csv build/RAAVANA.csv build/UGUISU.csv
+ *   gcc -O2 -Ideploy/stm32_package -Ideploy/c_code -Ideploy/host \
+ *       deploy/host/multi_check.c deploy/host/eps_replay.c \
+ *       deploy/stm32_package/eps_forest_multi.c deploy/c_code/panel_model.c -o build/multi_check
+ *
+ * Run:
+ *   build/multi_check build/NEPALISAT.csv build/NEPALISAT_panel.csv \
+ *       build/RAAVANA.csv build/RAAVANA_panel.csv build/UGUISU.csv build/UGUISU_panel.csv
+ */
+
+#include "eps_forest_multi.h"
+#include "eps_replay.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BATCH_ROWS 13    // NUM_PANELS
+
+#if REPLAY_POWER_FEATURES != EPS_PANEL_VOLTAGE_FEAT || \
+    REPLAY_POWER_FEATURES + REPLAY_VOLTAGE_FEATURES != EPS_PANEL_FEATURES
+#error "panel model row layout and replay features disagree"
+#endif
+
+// Python predictions, one "power,voltage,current" line per replay row
+static double *load_predictions(const char *path, int n) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return NULL;
+    }
+    double *pred = malloc((size_t)n * EPS_PANEL_OUTPUTS * sizeof(double));
+    char line[256];
+    int rows = 0;
+    if (!fgets(line, sizeof(line), f)) rows = -1;    // Header
+    while (rows >= 0 && rows < n && fgets(line, sizeof(line), f)) {
+        double *p = pred + rows * EPS_PANEL_OUTPUTS;
+        if (sscanf(line, "%lf,%lf,%lf", &p[0], &p[1], &p[2]) != 3) break;
+        rows++;
+    }
+    fclose(f);
+    if (rows != n) {
+        fprintf(stderr, "%s: expected %d prediction rows\n", path, n);
+        free(pred);
+        return NULL;
+    }
+    return pred;
+}
+
+static int count_mismatches(const double *a, const double *b, int n, double max_diff[]) {
+    int bad = 0;
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < EPS_PANEL_OUTPUTS; k++) {
+            const double *x = &a[i * EPS_PANEL_OUTPUTS + k], *y = &b[i * EPS_PANEL_OUTPUTS + k];
+            if (fabs(*x - *y) > max_diff[k]) max_diff[k] = fabs(*x - *y);
+            if (memcmp(x, y, sizeof(double)) != 0) {
+                bad++;
+                break;
+            }
+        }
+    }
+    return bad;
+}
+
+static int check_replay(const char *replay_path, const char *pred_path) {
+    EPS_Replay replay;
+    EPS_ReplayRows rows;
+    if (eps_replay_load(replay_path, &replay) != 0) return -1;
+    int n = eps_replay_build_rows(&replay, &rows);
+    double *pred = load_predictions(pred_path, n);
+    if (!pred) return -1;
+
+    double (*x)[EPS_PANEL_FEATURES] = malloc((size_t)n * sizeof(*x));
+    double *single = malloc((size_t)n * EPS_PANEL_OUTPUTS * sizeof(double));
+    double *batch = malloc((size_t)n * EPS_PANEL_OUTPUTS * sizeof(double));
+    for (int i = 0; i < n; i++) {
+        memcpy(x[i], rows.power[i], sizeof(rows.power[i]));
+        memcpy(x[i] + EPS_PANEL_VOLTAGE_FEAT, rows.voltage[i], sizeof(rows.voltage[i]));
+        eps_forest_multi_score(&eps_panel_forest_multi, x[i], single + i * EPS_PANEL_OUTPUTS);
+    }
+    for (int i = 0; i < n; i += BATCH_ROWS) {
+        int len = (n - i < BATCH_ROWS) ? n - i : BATCH_ROWS;
+        eps_forest_multi_score_batch(&eps_panel_forest_multi, x[i], EPS_PANEL_FEATURES,
+                                     batch + i * EPS_PANEL_OUTPUTS, len);
+    }
+
+    double diff[EPS_PANEL_OUTPUTS] = {0.0};
+    int bad_single = count_mismatches(single, pred, n, diff);
+    int bad_batch = count_mismatches(batch, pred, n, diff);
+    printf("%s: %d rows, mismatches vs Python: score %d, batch %d (max diff %.3g uW, %.3g mV, %.3g mA)\n",
+           replay_path, n, bad_single, bad_batch, diff[0], diff[1], diff[2]);
+
+    free(x);
+    free(single);
+    free(batch);
+    free(pred);
+    eps_replay_free_rows(&rows);
+    eps_replay_free(&replay);
+    return bad_single + bad_batch;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3 || (argc - 1) % 2 != 0) {
+        fprintf(stderr, "usage: %s replay.csv predictions.csv [replay.csv predictions.csv]...\n",
+                argv[0]);
+        return 2;
+    }
+    printf("Panel model: %u trees, %u nodes, %u leaves, %u features, %u outputs\n",
+           eps_panel_forest_multi.n_trees, eps_panel_forest_multi.n_nodes,
+           eps_panel_forest_multi.n_leaves, eps_panel_forest_multi.n_features,
+           eps_panel_forest_multi.n_outputs);
+    int failures = 0;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (check_replay(argv[i], argv[i + 1]) != 0) failures++;
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * EPS Predictive FDIR - Forest Profile Dump
+ * Replays telemetry through the instrumented table walk (EPS_FOREST_PROFILE)
+ * and writes one split/path profile per model for the exporter:
+ *   OUT_DIR/power_model.prof, OUT_DIR/voltage_model.prof
+ * (format in eps_forest_profile.h). Also prints the path length histogram,
+ * per-tree depth, compares per feature, and the split nodes no replayed
+ * row reached (pruning candidates).
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -DEPS_FOREST_PROFILE -DEPS_FOREST_BACKEND=EPS_FOREST_BACKEND_TABLE -Ideploy/stm32_package -Ideploy/c_code -Ideploy/host \
+ *       deploy/host/profile_forest.c deploy/host/eps_replay.c \
+ *       deploy/stm32_package/eps_forest.c deploy/stm32_package/eps_forest_profile.c \
+ *       deploy/stm32_package/eps_forest_blob.c \
+ *       deploy/c_code/power_model.c deploy/c_code/voltage_model.c -lm -o build/profile_forest
+ *
+ * Run, then re-export with the profile:
+ *   build/profile_forest build build/NEPALISAT.csv build/RAAVANA.csv
+ *   python3 eps_forest_export.py --profile build/power_model.prof build/voltage_model.prof
+ */
+
+#include "eps_forest.h"
+#include "eps_forest_profile.h"
+#include "eps_replay.h"
+#include "power_model.h"
+#include "voltage_model.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#if !defined(EPS_FOREST_PROFILE)
+#error "build with -DEPS_FOREST_PROFILE"
+#endif
+#if EPS_FOREST_BACKEND != EPS_FOREST_BACKEND_TABLE
+#error "only the table walk is instrumented (-DEPS_FOREST_BACKEND=EPS_FOREST_BACKEND_TABLE)"
+#endif
+
+typedef struct {
+    const char *name;
+    const char *file;
+    const EPS_Forest *forest;
+    uint32_t (*hash)(void);
+    EPS_ForestProfile profile;
+    uint32_t *storage;
+} Model;
+
+static void print_summary(const Model *m) {
+    const EPS_Forest *f = m->forest;
+    const EPS_ForestProfile *p = &m->profile;
+    const int bins = EPS_FOREST_PROFILE_MAX_DEPTH + 1;
+
+    printf("%s: %u rows x %u trees\n", m->name, p->walks / f->n_trees, f->n_trees);
+
+    // Path length histogram over all trees
+    printf("  path length:");
+    double total = 0.0;
+    for (int d = 0; d < bins; d++) {
+        uint32_t n = 0;
+        for (uint16_t t = 0; t < f->n_trees; t++) n += p->path_length[t * bins + d];
+        if (n) printf("  %d: %.1f%%", d, 100.0 * n / p->walks);
+        total += (double)d * n;
+    }
+    printf("\n  mean path %.2f splits per tree\n", total / p->walks);
+
+    // Mean path per tree, shortest and longest
+    double lo = 1e9, hi = 0.0;
+    int t_lo = 0, t_hi = 0;
+    for (uint16_t t = 0; t < f->n_trees; t++) {
+        uint32_t n = 0;
+        double sum = 0.0;
+        for (int d = 0; d < bins; d++) {
+            n += p->path_length[t * bins + d];
+            sum += (double)d * p->path_length[t * bins + d];
+        }
+        double mean = n ? sum / n : 0.0;
+        if (mean < lo) { lo = mean; t_lo = t; }
+        if (mean > hi) { hi = mean; t_hi = t; }
+    }
+    printf("  per tree: shortest tree %d (%.2f), longest tree %d (%.2f)\n", t_lo, lo, t_hi, hi);
+
+    // Compares per feature, as a share of all compares
+    uint64_t compares = 0;
+    for (uint16_t i = 0; i < f->n_features; i++) compares += p->compares[i];
+    printf("  compares per feature:");
+    for (uint16_t i = 0; i < f->n_features; i++) {
+        printf(" %u:%.1f%%", i, compares ? 100.0 * p->compares[i] / compares : 0.0);
+    }
+    printf("\n");
+
+    // Split nodes never reached, and splits whose rows all go one way
+    int unreached = 0, one_way = 0;
+    for (uint16_t n = 0; n < f->n_nodes; n++) {
+        uint32_t left = p->branch[2 * n], right = p->branch[2 * n + 1];
+        if (left + right == 0) {
+            unreached++;
+        } else if (left == 0 || right == 0) {
+            one_way++;
+        }
+    }
+    printf("  %d of %u split nodes never reached, %d send every row the same way\n",
+           unreached, f->n_nodes, one_way);
+}
+
+static int write_profile(const Model *m, const char *dir) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", dir, m->file);
+    size_t size = eps_forest_profile_size(&m->profile);
+    uint8_t *buf = malloc(size);
+    if (!buf || eps_forest_profile_serialize(&m->profile, m->hash(), buf, size) != size) {
+        fprintf(stderr, "%s: out of memory\n", path);
+        free(buf);
+        return -1;
+    }
+    FILE *f = fopen(path, "wb");
+    if (!f || fwrite(buf, 1, size, f) != size) {
+        fprintf(stderr, "%s: write failed\n", path);
+        if (f) fclose(f);
+        free(buf);
+        return -1;
+    }
+    fclose(f);
+    free(buf);
+    printf("  %s (%zu bytes, hash %08X)\n", path, size, (unsigned)m->hash());
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s out_dir replay.csv [replay.csv ...]\n", argv[0]);
+        return 2;
+    }
+
+    Model models[2] = {
+        {"power",   "power_model.prof",   &eps_power_forest,   eps_model_power_hash,   {0}, NULL},
+        {"voltage", "voltage_model.prof", &eps_voltage_forest, eps_model_voltage_hash, {0}, NULL},
+    };
+    for (int i = 0; i < 2; i++) {
+        const EPS_Forest *f = models[i].forest;
+        models[i].storage = malloc(EPS_FOREST_PROFILE_WORDS(f->n_trees, f->n_nodes, f->n_features)
+                                   * sizeof(uint32_t));
+        if (!models[i].storage || eps_forest_profile_attach(&models[i].profile, f, models[i].storage) != 0) {
+            fprintf(stderr, "cannot attach %s profile\n", models[i].name);
+            return 1;
+        }
+    }
+
+    for (int a = 2; a < argc; a++) {
+        EPS_Replay replay;
+        EPS_ReplayRows rows;
+        if (eps_replay_load(argv[a], &replay) != 0) return 1;
+        int n = eps_replay_build_rows(&replay, &rows);
+        for (int r = 0; r < n; r++) {
+            eps_model_power_score(rows.power[r]);
+            eps_model_voltage_score(rows.voltage[r]);
+        }
+        printf("Replay %s: %d feature rows\n", argv[a], n);
+        eps_replay_free_rows(&rows);
+        eps_replay_free(&replay);
+    }
+
+    int failures = 0;
+    for (int i = 0; i < 2; i++) {
+        print_summary(&models[i]);
+        if (write_profile(&models[i], argv[1]) != 0) failures++;
+        eps_forest_profile_detach(&models[i].profile);
+        free(models[i].storage);
+    }
+    return failures ? 1 : 0;
+}
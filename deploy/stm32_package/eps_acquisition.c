@@ -0,0 +1,122 @@
+/**
+ * Panel acquisition (ADC scan + DMA) for STM32
+ */
+
+#include "eps_acquisition.h"
+#include <stddef.h>
+
+// ADC handles (must be initialized in main.c, scan mode with DMA)
+extern ADC_HandleTypeDef hadc1;
+extern ADC_HandleTypeDef hadc2;
+extern ADC_HandleTypeDef hadc3;
+
+// ===== CHANNEL MAPPINGS (EXAMPLE - Adjust for your hardware) =====
+// Rank r of each sequence converts panel r-1
+
+// hadc1: voltage sensing (one per panel)
+static const uint32_t VOLTAGE_ADC_CHANNELS[NUM_PANELS] = {
+    ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3,
+    ADC_CHANNEL_4, ADC_CHANNEL_5, ADC_CHANNEL_6, ADC_CHANNEL_7,
+    ADC_CHANNEL_8, ADC_CHANNEL_9, ADC_CHANNEL_10, ADC_CHANNEL_11,
+    ADC_CHANNEL_12
+};
+
+// hadc2: current sensing (one per panel)
+static const uint32_t CURRENT_ADC_CHANNELS[NUM_PANELS] = {
+    ADC_CHANNEL_13, ADC_CHANNEL_14, ADC_CHANNEL_15, ADC_CHANNEL_0,
+    ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3, ADC_CHANNEL_4,
+    ADC_CHANNEL_5, ADC_CHANNEL_6, ADC_CHANNEL_7, ADC_CHANNEL_8,
+    ADC_CHANNEL_9
+};
+
+// hadc3: MOSFET drain voltage sensing
+static const uint32_t DRAIN_ADC_CHANNELS[NUM_PANELS] = {
+    ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3,
+    ADC_CHANNEL_4, ADC_CHANNEL_5, ADC_CHANNEL_6, ADC_CHANNEL_7,
+    ADC_CHANNEL_8, ADC_CHANNEL_9, ADC_CHANNEL_10, ADC_CHANNEL_11,
+    ADC_CHANNEL_12
+};
+
+#define ADC_VOLTAGE_DONE 0x1u
+#define ADC_CURRENT_DONE 0x2u
+#define ADC_DRAIN_DONE   0x4u
+#define ADC_ALL_DONE     0x7u
+
+// ===== DOUBLE-BUFFERED FRAMES =====
+static EPS_SampleFrame frames[2];
+static volatile uint8_t front;         // Last complete frame
+static volatile uint8_t busy;          // ADC_*_DONE bits still outstanding
+static volatile uint32_t sequence;     // Completed scans
+
+static void configure_sequence(ADC_HandleTypeDef* hadc, const uint32_t channels[NUM_PANELS]) {
+    ADC_ChannelConfTypeDef sConfig = {0};
+    sConfig.SamplingTime = ADC_SAMPLETIME_15CYCLES;
+    for (uint8_t p = 0; p < NUM_PANELS; p++) {
+        sConfig.Channel = channels[p];
+        sConfig.Rank = p + 1u;
+        HAL_ADC_ConfigChannel(hadc, &sConfig);
+    }
+}
+
+void eps_acq_init(void) {
+    configure_sequence(&hadc1, VOLTAGE_ADC_CHANNELS);
+    configure_sequence(&hadc2, CURRENT_ADC_CHANNELS);
+    configure_sequence(&hadc3, DRAIN_ADC_CHANNELS);
+
+    front = 0;
+    busy = 0;
+    sequence = 0;
+}
+
+bool eps_acq_start(void) {
+    if (busy) return false;
+
+    // Fill the frame readers are not looking at
+    EPS_SampleFrame* back = &frames[front ^ 1u];
+    busy = ADC_ALL_DONE;
+    HAL_ADC_Start_DMA(&hadc1, (uint32_t*)back->voltage, NUM_PANELS);
+    HAL_ADC_Start_DMA(&hadc2, (uint32_t*)back->current, NUM_PANELS);
+    HAL_ADC_Start_DMA(&hadc3, (uint32_t*)back->drain, NUM_PANELS);
+    return true;
+}
+
+const EPS_SampleFrame* eps_acq_frame(void) {
+    return sequence ? &frames[front] : NULL;
+}
+
+const EPS_SampleFrame* eps_acq_scan(uint32_t timeout_ms) {
+    uint32_t before = sequence;
+    eps_acq_start();                    // Or wait for the scan already running
+
+    uint32_t start = HAL_GetTick();
+    while (sequence == before) {
+        if (HAL_GetTick() - start > timeout_ms) {
+            // Abandon the scan so the next cycle can start a fresh one
+            HAL_ADC_Stop_DMA(&hadc1);
+            HAL_ADC_Stop_DMA(&hadc2);
+            HAL_ADC_Stop_DMA(&hadc3);
+            busy = 0;
+            return NULL;
+        }
+    }
+    return &frames[front];
+}
+
+// DMA transfer complete (end of a scan sequence), from the DMA interrupt.
+// The three DMA streams share one interrupt priority, so calls never nest.
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc) {
+    HAL_ADC_Stop_DMA(hadc);
+
+    if (hadc == &hadc1) busy &= (uint8_t)~ADC_VOLTAGE_DONE;
+    else if (hadc == &hadc2) busy &= (uint8_t)~ADC_CURRENT_DONE;
+    else if (hadc == &hadc3) busy &= (uint8_t)~ADC_DRAIN_DONE;
+
+    if (busy == 0) {
+        // Publish: the back frame becomes the front frame
+        uint8_t back = front ^ 1u;
+        frames[back].tick = HAL_GetTick();
+        frames[back].sequence = sequence + 1u;
+        front = back;
+        sequence++;
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * EPS Predictive FDIR - Panel Acquisition
+ * One DMA scan per cycle of every panel's voltage, current and MOSFET
+ * drain-sense channel into a double-buffered sample frame
+ *
+ *   hadc1  panel voltage      13-rank scan sequence -> frame.voltage
+ *   hadc2  panel current      13-rank scan sequence -> frame.current
+ *   hadc3  MOSFET drain sense 13-rank scan sequence -> frame.drain
+ *
+ * The rank sequences are configured once by eps_acq_init(); the ADCs
+ * themselves are set up for scan mode with DMA (ScanConvMode enabled,
+ * NbrOfConversion = 13, EOC at end of sequence, DMA halfword, normal mode)
+ * by the CubeMX init code. eps_acq_start() starts the three scans into the
+ * back frame. When the last DMA transfer completes, the back frame becomes
+ * the front frame that eps_acq_frame() returns, so readers always see one
+ * complete, consistent scan while the next one fills the other buffer.
+ *
+ * The main loop scans once at the start of each cycle; the protection logic
+ * (check_mosfet_status()) reads the drain voltages from that frame.
+ *
+ * RAM: 2 x 88 bytes
+ */
+
+#ifndef EPS_ACQUISITION_H
+#define EPS_ACQUISITION_H
+
+#include "eps_protection_final.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Full scale of a 12-bit count per channel
+#define EPS_ACQ_COUNTS          4095.0f
+#define EPS_ACQ_VOLTAGE_SCALE   25.0f      // Panel voltage divider: 0-25 V
+#define EPS_ACQ_CURRENT_SCALE   2.0f       // Shunt amplifier: 0-2 A
+#define EPS_ACQ_DRAIN_SCALE     3.3f       // Drain sense divider: 0-3.3 V
+
+// Wait for a scan in eps_acq_scan() (three 13-rank sequences take ~20 us)
+#define EPS_ACQ_TIMEOUT_MS      2u
+
+typedef struct {
+    uint16_t voltage[NUM_PANELS];   // Raw counts, index = panel_id
+    uint16_t current[NUM_PANELS];
+    uint16_t drain[NUM_PANELS];
+    uint32_t tick;                  // HAL_GetTick() when the scan completed
+    uint32_t sequence;              // Completed scans since init, from 1
+} EPS_SampleFrame;
+
+void eps_acq_init(void);
+
+// Start one scan of all channels; false if the previous one is still running
+bool eps_acq_start(void);
+
+// Latest complete frame (NULL before the first scan completes)
+const EPS_SampleFrame* eps_acq_frame(void);
+
+// Start a scan (or join the one running) and wait up to timeout_ms for it.
+// Returns the new frame, or NULL if it did not complete (eps_acq_frame()
+// still has the previous one).
+const EPS_SampleFrame* eps_acq_scan(uint32_t timeout_ms);
+
+static inline float eps_acq_voltage(const EPS_SampleFrame* frame, uint8_t panel_id) {
+    return (frame->voltage[panel_id] / EPS_ACQ_COUNTS) * EPS_ACQ_VOLTAGE_SCALE;
+}
+
+static inline float eps_acq_current(const EPS_SampleFrame* frame, uint8_t panel_id) {
+    return (frame->current[panel_id] / EPS_ACQ_COUNTS) * EPS_ACQ_CURRENT_SCALE;
+}
+
+static inline float eps_acq_drain_voltage(const EPS_SampleFrame* frame, uint8_t panel_id) {
+    return (frame->drain[panel_id] / EPS_ACQ_COUNTS) * EPS_ACQ_DRAIN_SCALE;
+}
+
+#endif // EPS_ACQUISITION_H
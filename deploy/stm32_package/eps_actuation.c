@@ -0,0 +1,102 @@
+/**
+ * Deferred actuation queue for STM32
+ */
+
+#include "eps_actuation.h"
+
+typedef struct {
+    uint32_t due;
+    EPS_ActuationStep step;
+    uint8_t panel_id;
+} Action;
+
+static Action heap[EPS_ACTUATION_QUEUE];
+static uint8_t heap_count;
+
+// Wrap-safe: a is due before b
+static inline bool before(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) < 0;
+}
+
+static void sift_up(uint8_t i) {
+    Action a = heap[i];
+    while (i > 0) {
+        uint8_t parent = (uint8_t)((i - 1) / 2);
+        if (!before(a.due, heap[parent].due)) break;
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = a;
+}
+
+static void sift_down(uint8_t i) {
+    Action a = heap[i];
+    for (;;) {
+        uint8_t child = (uint8_t)(2 * i + 1);
+        if (child >= heap_count) break;
+        if (child + 1 < heap_count && before(heap[child + 1].due, heap[child].due)) child++;
+        if (!before(heap[child].due, a.due)) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = a;
+}
+
+static int find(EPS_ActuationStep step, uint8_t panel_id) {
+    for (uint8_t i = 0; i < heap_count; i++) {
+        if (heap[i].step == step && heap[i].panel_id == panel_id) return i;
+    }
+    return -1;
+}
+
+// Remove entry i, filling the hole with the last entry
+static void remove_at(uint8_t i) {
+    heap_count--;
+    if (i == heap_count) return;
+    heap[i] = heap[heap_count];
+    sift_down(i);
+    sift_up(i);
+}
+
+void eps_actuation_init(void) {
+    heap_count = 0;
+}
+
+bool eps_actuation_defer(EPS_ActuationStep step, uint8_t panel_id, uint32_t due) {
+    int i = find(step, panel_id);
+    if (i >= 0) {
+        remove_at((uint8_t)i);
+    } else if (heap_count >= EPS_ACTUATION_QUEUE) {
+        return false;
+    }
+    heap[heap_count] = (Action){due, step, panel_id};
+    sift_up(heap_count++);
+    return true;
+}
+
+void eps_actuation_cancel(EPS_ActuationStep step, uint8_t panel_id) {
+    int i = find(step, panel_id);
+    if (i >= 0) remove_at((uint8_t)i);
+}
+
+bool eps_actuation_pending(EPS_ActuationStep step, uint8_t panel_id) {
+    return find(step, panel_id) >= 0;
+}
+
+uint8_t eps_actuation_count(void) {
+    return heap_count;
+}
+
+int eps_actuation_tick(uint32_t now) {
+    // At most as many steps as were queued on entry, so a step that defers
+    // itself with no delay cannot keep the loop spinning
+    uint8_t budget = heap_count;
+    int ran = 0;
+    while (budget-- > 0 && heap_count > 0 && !before(now, heap[0].due)) {
+        Action a = heap[0];
+        remove_at(0);
+        a.step(a.panel_id);
+        ran++;
+    }
+    return ran;
+}
@@ -0,0 +1,48 @@
+/**
+ * EPS Predictive FDIR - Deferred Actuation
+ * Settle and verify steps of the protection GPIO writes, run later from a
+ * tick handler instead of busy-waiting inside the protection update
+ *
+ * enable_layer2_comparator() and attempt_reenable_mosfet() write their pin,
+ * schedule the follow-up step here and return at once, so a cycle in which
+ * several panels change state no longer stalls the panels after them by
+ * 1-10 ms each. eps_actuation_tick() runs every step whose time has come,
+ * earliest first; call it from the main loop's idle wait (or SysTick).
+ *
+ * Pending steps sit in a binary min-heap keyed by due tick (compared
+ * wrap-safe), at most one per (step, panel): deferring the same pair again
+ * moves its due time.
+ *
+ * RAM: 12 bytes per queue entry
+ */
+
+#ifndef EPS_ACTUATION_H
+#define EPS_ACTUATION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Two steps per panel (comparator settle, MOSFET settle) for 13 panels
+#ifndef EPS_ACTUATION_QUEUE
+#define EPS_ACTUATION_QUEUE 32
+#endif
+
+typedef void (*EPS_ActuationStep)(uint8_t panel_id);
+
+void eps_actuation_init(void);
+
+// Run step(panel_id) at tick 'due' (HAL_GetTick() time base). Returns false
+// if the queue is full; the caller then has to complete the step itself.
+bool eps_actuation_defer(EPS_ActuationStep step, uint8_t panel_id, uint32_t due);
+
+// Drop a pending step (no-op if none)
+void eps_actuation_cancel(EPS_ActuationStep step, uint8_t panel_id);
+
+bool eps_actuation_pending(EPS_ActuationStep step, uint8_t panel_id);
+uint8_t eps_actuation_count(void);
+
+// Run the steps due at or before 'now'; returns how many ran. A step may
+// defer further steps, which run in a later tick.
+int eps_actuation_tick(uint32_t now);
+
+#endif // EPS_ACTUATION_H
@@ -0,0 +1,36 @@
+/**
+ * EPS Predictive FDIR - Telemetry Clock
+ * Free-running clock shared by the model-slot (swap/shadow) and anytime
+ * (eval) timing telemetry
+ *
+ * Defaults to the DWT cycle counter (CMSIS device header), enabled by
+ * eps_cycle_clock_enable(). A build without DWT defines EPS_CLOCK() and
+ * EPS_CLOCK_PER_US() before this header (the host HAL, eps_hal_host.h,
+ * stubs both). Durations subtract raw ticks before converting, so a
+ * counter wrap (every ~25 s at 168 MHz) between the two reads is harmless.
+ */
+
+#ifndef EPS_CYCLE_CLOCK_H
+#define EPS_CYCLE_CLOCK_H
+
+#include <stdint.h>
+
+#ifndef EPS_CLOCK
+#define EPS_CLOCK_USE_DWT
+#define EPS_CLOCK() (DWT->CYCCNT)
+#define EPS_CLOCK_PER_US() (SystemCoreClock / 1000000u)
+#endif
+
+// Microseconds since start (an EPS_CLOCK() reading)
+#define EPS_ELAPSED_US(start) \
+    ((uint32_t)(EPS_CLOCK() - (start)) / EPS_CLOCK_PER_US())
+
+// Start the cycle counter; idempotent, called by every module that times
+static inline void eps_cycle_clock_enable(void) {
+#ifdef EPS_CLOCK_USE_DWT
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+#endif // EPS_CYCLE_CLOCK_H
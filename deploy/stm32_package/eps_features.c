@@ -5,47 +5,50 @@
 #include "eps_model_config.h"
 #include <string.h>
 
+// One rolling window per spec entry, fed the signal of the same name
+#define ROLLING_INIT(k, signal, window) eps_rolling_init(&buffers->rolling[k], window);
+#define ROLLING_PUSH(k, signal, window) eps_rolling_push(&buffers->rolling[k], signal);
+#define STAT_STORE(j, k, name) buffers->stat[j][idx] = eps_rolling_##name(&buffers->rolling[k]);
+
 void eps_init_buffers(EPS_FeatureBuffers *buffers) {
-    memset(buffers->power_buffer, 0, sizeof(buffers->power_buffer));
-    memset(buffers->voltage_buffer, 0, sizeof(buffers->voltage_buffer));
-    buffers->buffer_index = 0;
+    memset(buffers, 0, sizeof(EPS_FeatureBuffers));
+    EPS_SPEC_ROLLING(ROLLING_INIT)
 }
 
-void eps_update_buffers(EPS_FeatureBuffers *buffers, double power, double voltage) {
-    buffers->buffer_index = (buffers->buffer_index + 1) % RING_BUFFER_SIZE;
-    buffers->power_buffer[buffers->buffer_index] = power;
-    buffers->voltage_buffer[buffers->buffer_index] = voltage;
+void eps_update_buffers(EPS_FeatureBuffers *buffers, eps_feature_t power, eps_feature_t voltage) {
+    uint8_t prev = buffers->buffer_index;
+    uint8_t idx = (prev + 1) & RING_BUFFER_MASK;
+#if EPS_SPEC_POWER_DIFF
+    buffers->power_diff[idx] = power - buffers->power_buffer[prev];
+#endif
+#if EPS_SPEC_VOLTAGE_DIFF
+    buffers->voltage_diff[idx] = voltage - buffers->voltage_buffer[prev];
+#endif
+    EPS_SPEC_ROLLING(ROLLING_PUSH)
+    EPS_SPEC_STATS(STAT_STORE)
+    buffers->power_buffer[idx] = power;
+    buffers->voltage_buffer[idx] = voltage;
+    buffers->buffer_index = idx;
+    if (buffers->n_samples < RING_BUFFER_HISTORY) buffers->n_samples++;
 }
 
-static inline double get_lag(double *buffer, uint8_t current_idx, uint8_t lag) {
-    int idx = (current_idx - lag + RING_BUFFER_SIZE) % RING_BUFFER_SIZE;
-    return buffer[idx];
+bool eps_features_ready(const EPS_FeatureBuffers *buffers) {
+    return buffers->n_samples >= RING_BUFFER_HISTORY;
 }
 
-void eps_extract_power_features(EPS_FeatureBuffers *buffers, double *features_out) {
-    // Power lags: 1,2,3,6,12
+// One masked load per spec feature, 'age' samples before the newest
+#define SLOT(age) ((idx - (age)) & RING_BUFFER_MASK)
+#define RING_LAG(signal) buffers->signal##_buffer
+#define RING_DIFF(signal) buffers->signal##_diff
+#define RING_STAT(j) buffers->stat[j]
+#define FEATURE(i, kind, signal, age) features_out[i] = RING_##kind(signal)[SLOT(age)];
+
+void eps_extract_power_features(const EPS_FeatureBuffers *buffers, eps_feature_t *features_out) {
     uint8_t idx = buffers->buffer_index;
-    features_out[0] = get_lag(buffers->power_buffer, idx, 1);
-    features_out[1] = get_lag(buffers->power_buffer, idx, 2);
-    features_out[2] = get_lag(buffers->power_buffer, idx, 3);
-    features_out[3] = get_lag(buffers->power_buffer, idx, 6);
-    features_out[4] = get_lag(buffers->power_buffer, idx, 12);
-
-    // Power_diff lags: compute derivatives then lag them
-    double p_diff = buffers->power_buffer[idx] - get_lag(buffers->power_buffer, idx, 1);
-    features_out[5] = p_diff;  // Power_diff_lag1 (approximate)
-    features_out[6] = get_lag(buffers->power_buffer, idx, 2) - get_lag(buffers->power_buffer, idx, 3);
-    features_out[7] = get_lag(buffers->power_buffer, idx, 3) - get_lag(buffers->power_buffer, idx, 4);
-    features_out[8] = get_lag(buffers->power_buffer, idx, 6) - get_lag(buffers->power_buffer, idx, 7);
-    features_out[9] = get_lag(buffers->power_buffer, idx, 12) - ((idx >= 13) ? get_lag(buffers->power_buffer, idx, 13) : 0);
+    EPS_SPEC_POWER_FEATURES(FEATURE)
 }
 
-void eps_extract_voltage_features(EPS_FeatureBuffers *buffers, double *features_out) {
-    // Voltage lags: 1,2,3,6,12
+void eps_extract_voltage_features(const EPS_FeatureBuffers *buffers, eps_feature_t *features_out) {
     uint8_t idx = buffers->buffer_index;
-    features_out[0] = get_lag(buffers->voltage_buffer, idx, 1);
-    features_out[1] = get_lag(buffers->voltage_buffer, idx, 2);
-    features_out[2] = get_lag(buffers->voltage_buffer, idx, 3);
-    features_out[3] = get_lag(buffers->voltage_buffer, idx, 6);
-    features_out[4] = get_lag(buffers->voltage_buffer, idx, 12);
+    EPS_SPEC_VOLTAGE_FEATURES(FEATURE)
 }
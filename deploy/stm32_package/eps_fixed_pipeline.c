@@ -0,0 +1,54 @@
+/**
+ * Fixed-point panel pipeline implementation
+ */
+
+#include "eps_fixed_pipeline.h"
+#include <string.h>
+
+#define RING_MASK (EPS_FIXED_RING - 1)
+
+void eps_fixed_panel_init(EPS_FixedPanel *panel) {
+    memset(panel, 0, sizeof(EPS_FixedPanel));
+}
+
+void eps_fixed_panel_push(EPS_FixedPanel *panel, int32_t voltage_uV, int32_t current_uA) {
+    panel->power_pW[panel->head] = (int64_t)voltage_uV * current_uA;
+    panel->voltage_uV[panel->head] = voltage_uV;
+    panel->head = (panel->head + 1) & RING_MASK;
+    if (panel->count < EPS_FIXED_RING) panel->count++;
+}
+
+// Straight-line loads per spec feature; head is the slot of the predicted
+// sample, so age 1 is the most recent push
+#define SLOT(age) ((panel->head - (age)) & RING_MASK)
+#define FIXED_RING_power power_pW
+#define FIXED_RING_voltage voltage_uV
+#define RING(signal) panel->FIXED_RING_##signal
+#define VALUE_LAG(signal, age) (int64_t)RING(signal)[SLOT(age)]
+#define VALUE_DIFF(signal, age) ((int64_t)RING(signal)[SLOT(age)] - RING(signal)[SLOT((age) + 1)])
+#define FEATURE(i, kind, signal, age) x[i] = VALUE_##kind(signal, age);
+
+void eps_fixed_power_features(const EPS_FixedPanel *panel, int64_t x[EPS_SPEC_POWER_N_FEATURES]) {
+    EPS_SPEC_POWER_FEATURES(FEATURE)
+}
+
+void eps_fixed_voltage_features(const EPS_FixedPanel *panel, int64_t x[EPS_SPEC_VOLTAGE_N_FEATURES]) {
+    EPS_SPEC_VOLTAGE_FEATURES(FEATURE)
+}
+
+bool eps_fixed_step(EPS_FixedPanel *panel, int32_t voltage_uV, int32_t current_uA,
+                    EPS_FixedResult *out) {
+    bool ready = eps_fixed_panel_ready(panel);
+    if (ready) {
+        int64_t power_x[EPS_SPEC_POWER_N_FEATURES], voltage_x[EPS_SPEC_VOLTAGE_N_FEATURES];
+        eps_fixed_power_features(panel, power_x);
+        eps_fixed_voltage_features(panel, voltage_x);
+
+        out->power_pred_pW = eps_forest_fixed_score(&eps_power_forest_fixed, power_x);
+        out->voltage_pred_uV = (int32_t)eps_forest_fixed_score(&eps_voltage_forest_fixed, voltage_x);
+        out->power_residual_pW = (int64_t)voltage_uV * current_uA - out->power_pred_pW;
+        out->voltage_residual_uV = voltage_uV - out->voltage_pred_uV;
+    }
+    eps_fixed_panel_push(panel, voltage_uV, current_uA);
+    return ready;
+}
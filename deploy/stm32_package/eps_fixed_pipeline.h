@@ -0,0 +1,59 @@
+/**
+ * EPS Predictive FDIR - Fixed-Point Panel Pipeline
+ * Feature extraction, inference and residuals in integer units
+ *
+ * Units: voltage in uV, current in uA, power = V * I in pW (int64).
+ * The recorded telemetry has 0.01 mV / 0.01 mA resolution, so these units
+ * hold it exactly. Features follow the feature spec (eps_feature_spec.h):
+ * the new sample t is predicted from the history before it is pushed, a LAG
+ * feature at age a reading s[t-a] and a DIFF feature s[t-a] - s[t-a-1].
+ *
+ * RAM: 200 bytes per panel
+ */
+
+#ifndef EPS_FIXED_PIPELINE_H
+#define EPS_FIXED_PIPELINE_H
+
+#include "eps_feature_spec.h"
+#include "eps_forest_fixed.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#if EPS_SPEC_N_STATS
+#error "fixed-point pipeline: rolling statistic features are not supported"
+#endif
+
+#define EPS_FIXED_RING     EPS_SPEC_RING      // Power of two > EPS_SPEC_MAX_AGE
+#define EPS_FIXED_HISTORY  EPS_SPEC_MAX_AGE   // Samples needed before the first prediction
+
+typedef struct {
+    int64_t power_pW[EPS_FIXED_RING];
+    int32_t voltage_uV[EPS_FIXED_RING];
+    uint8_t head;                  // Next write position
+    uint8_t count;                 // Samples held, saturates at EPS_FIXED_RING
+} EPS_FixedPanel;
+
+typedef struct {
+    int64_t power_pred_pW;
+    int64_t power_residual_pW;     // measured - predicted
+    int32_t voltage_pred_uV;
+    int32_t voltage_residual_uV;
+} EPS_FixedResult;
+
+void eps_fixed_panel_init(EPS_FixedPanel *panel);
+void eps_fixed_panel_push(EPS_FixedPanel *panel, int32_t voltage_uV, int32_t current_uA);
+
+static inline bool eps_fixed_panel_ready(const EPS_FixedPanel *panel) {
+    return panel->count >= EPS_FIXED_HISTORY;
+}
+
+// Features for the next sample (requires eps_fixed_panel_ready)
+void eps_fixed_power_features(const EPS_FixedPanel *panel, int64_t x[EPS_SPEC_POWER_N_FEATURES]);
+void eps_fixed_voltage_features(const EPS_FixedPanel *panel, int64_t x[EPS_SPEC_VOLTAGE_N_FEATURES]);
+
+// Predict the new sample from history, compute residuals, then push it.
+// Returns false (and only pushes) while the history is still filling.
+bool eps_fixed_step(EPS_FixedPanel *panel, int32_t voltage_uV, int32_t current_uA,
+                    EPS_FixedResult *out);
+
+#endif // EPS_FIXED_PIPELINE_H
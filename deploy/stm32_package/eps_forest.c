@@ -0,0 +1,76 @@
+/**
+ * Table-driven forest evaluation for STM32
+ */
+
+#include "eps_forest.h"
+
+double eps_forest_score(const EPS_Forest *forest, const double *x) {
+    // Sum left to right starting from tree 0, exactly like the m2cgen
+    // expression (var0 + var1 + ... + var49) * scale
+    double sum = eps_forest_tree(forest, 0, x);
+    for (uint16_t t = 1; t < forest->n_trees; t++) {
+        sum += eps_forest_tree(forest, t, x);
+    }
+    return sum * forest->scale;
+}
+
+// Four-row walk for eps_forest_score_batch(); the profiling build scores
+// row by row so every walk goes through the counting hook
+#if !defined(EPS_FOREST_PROFILE)
+// One step of the walk (as in eps_forest_tree())
+static inline int16_t step(const EPS_Forest *forest, int16_t node, const double *x) {
+    return forest->children[2 * node + !(x[forest->feature[node]] <= forest->threshold[node])];
+}
+
+// Walk tree t for rows x0..x3 at once: four independent load chains, so
+// one row's node fetch overlaps the others' compares
+static void tree4(const EPS_Forest *forest, uint16_t t, const double *x0, uint16_t stride,
+                  double v[4]) {
+    const double *x1 = x0 + stride, *x2 = x1 + stride, *x3 = x2 + stride;
+    int16_t a = forest->roots[t], b = a, c = a, d = a;
+    while (!EPS_FOREST_IS_LEAF(a) && !EPS_FOREST_IS_LEAF(b) &&
+           !EPS_FOREST_IS_LEAF(c) && !EPS_FOREST_IS_LEAF(d)) {
+        a = step(forest, a, x0);
+        b = step(forest, b, x1);
+        c = step(forest, c, x2);
+        d = step(forest, d, x3);
+    }
+    while (!EPS_FOREST_IS_LEAF(a)) a = step(forest, a, x0);
+    while (!EPS_FOREST_IS_LEAF(b)) b = step(forest, b, x1);
+    while (!EPS_FOREST_IS_LEAF(c)) c = step(forest, c, x2);
+    while (!EPS_FOREST_IS_LEAF(d)) d = step(forest, d, x3);
+    v[0] = forest->leaf_value[EPS_FOREST_LEAF(a)];
+    v[1] = forest->leaf_value[EPS_FOREST_LEAF(b)];
+    v[2] = forest->leaf_value[EPS_FOREST_LEAF(c)];
+    v[3] = forest->leaf_value[EPS_FOREST_LEAF(d)];
+}
+#endif
+
+void eps_forest_score_batch(const EPS_Forest *forest, const double *x, uint16_t stride,
+                            double *out, int n) {
+    int i = 0;
+#if !defined(EPS_FOREST_PROFILE)
+    // Groups of four rows walk each tree together; per-row sums still run
+    // tree 0, 1, 2, ... so results match eps_forest_score()
+    for (; i + 4 <= n; i += 4) {
+        const double *xi = x + i * stride;
+        double v[4];
+        tree4(forest, 0, xi, stride, v);
+        double s0 = v[0], s1 = v[1], s2 = v[2], s3 = v[3];
+        for (uint16_t t = 1; t < forest->n_trees; t++) {
+            tree4(forest, t, xi, stride, v);
+            s0 += v[0];
+            s1 += v[1];
+            s2 += v[2];
+            s3 += v[3];
+        }
+        out[i] = s0 * forest->scale;
+        out[i + 1] = s1 * forest->scale;
+        out[i + 2] = s2 * forest->scale;
+        out[i + 3] = s3 * forest->scale;
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = eps_forest_score(forest, x + i * stride);
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ * EPS Predictive FDIR - Table-Driven Forest Runtime
+ * One small interpreter loop shared by the power and voltage models
+ *
+ * Trees are stored as structure-of-arrays node tables generated by
+ * eps_forest_export.py (see deploy/c_code/power_model.c, voltage_model.c).
+ * Predictions are bit-identical to the former m2cgen if/else code.
+ * Nodes are in pre-order, left child first (eps_forest_export.py --profile
+ * can put each tree's hot path first instead; the walk does not care).
+ *
+ * Flash: 13 bytes per internal node + 8 bytes per distinct leaf value
+ * (trees share one leaf pool)
+ */
+
+#ifndef EPS_FOREST_H
+#define EPS_FOREST_H
+
+#include <stdint.h>
+
+// Backend behind the generated eps_model_*_score() API (compile-time choice)
+#define EPS_FOREST_BACKEND_TABLE        0   // Tree walk over node tables
+#define EPS_FOREST_BACKEND_QUICKSCORER  1   // Bitvector evaluation (eps_forest_qs.c)
+#define EPS_FOREST_BACKEND_QUANTIZED    2   // 16-bit threshold codes, int32 leaves (eps_forest_q.c)
+#define EPS_FOREST_BACKEND_FIXED        3   // Integer-only, no double entry points (eps_forest_fixed.c)
+#define EPS_FOREST_BACKEND_IMPLICIT     4   // Perfect trees, unrolled branch-free walk (eps_forest_implicit.c, default)
+#define EPS_FOREST_BACKEND_BINNED       5   // Per-feature threshold bins, uint8 compares (eps_forest_binned.c)
+#define EPS_FOREST_BACKEND_FLOAT32      6   // Single precision, float entry points (eps_forest_f32.c)
+
+#ifndef EPS_FOREST_BACKEND
+#define EPS_FOREST_BACKEND EPS_FOREST_BACKEND_IMPLICIT
+#endif
+
+// Define EPS_FOREST_ALL_BACKENDS to emit every backend's tables (host benchmarks).
+// Anytime evaluation walks the node tables tree by tree, so EPS_ANYTIME keeps
+// them (eps_power_forest, eps_voltage_forest) next to the selected backend's.
+#if defined(EPS_FOREST_ALL_BACKENDS)
+#define EPS_FOREST_HAS_BACKEND(b) 1
+#elif defined(EPS_ANYTIME)
+#define EPS_FOREST_HAS_BACKEND(b) (EPS_FOREST_BACKEND == (b) || EPS_FOREST_BACKEND_TABLE == (b))
+#else
+#define EPS_FOREST_HAS_BACKEND(b) (EPS_FOREST_BACKEND == (b))
+#endif
+
+// Child encoding: >= 0 is an internal node index, < 0 is ~leaf_index
+#define EPS_FOREST_IS_LEAF(child)  ((child) < 0)
+#define EPS_FOREST_LEAF(child)     (~(child))
+
+typedef struct {
+    uint16_t n_features;
+    uint16_t n_trees;
+    uint16_t n_nodes;              // Internal (split) nodes
+    uint16_t n_leaves;
+    double scale;                  // 1 / n_estimators (RandomForest averaging)
+
+    const int16_t *roots;          // [n_trees]  root child of each tree
+    const uint8_t *feature;        // [n_nodes]  feature index compared at node
+    const double *threshold;       // [n_nodes]  go left if x[feature] <= threshold
+    const int16_t *children;       // [2*n_nodes] left child, right child
+    const double *leaf_value;      // [n_leaves] leaf outputs
+} EPS_Forest;
+
+#if defined(EPS_FOREST_PROFILE)
+// Instrumentation hook, counts the walk (eps_forest_profile.h)
+void eps_forest_profile_tree(const EPS_Forest *forest, uint16_t tree, const double *x);
+#endif
+
+// Walk one tree and return its leaf value
+static inline double eps_forest_tree(const EPS_Forest *forest, uint16_t tree, const double *x) {
+#if defined(EPS_FOREST_PROFILE)
+    eps_forest_profile_tree(forest, tree, x);
+#endif
+    const uint8_t *feature = forest->feature;
+    const double *threshold = forest->threshold;
+    const int16_t *children = forest->children;
+
+    // Index the child pair instead of branching on the compare; !(x <= t)
+    // sends NaN right, matching the m2cgen else-branch
+    int16_t node = forest->roots[tree];
+    while (!EPS_FOREST_IS_LEAF(node)) {
+        node = children[2 * node + !(x[feature[node]] <= threshold[node])];
+    }
+    return forest->leaf_value[EPS_FOREST_LEAF(node)];
+}
+
+// Average of all trees for one feature vector
+double eps_forest_score(const EPS_Forest *forest, const double *x);
+
+// Score n feature vectors (row i at x + i*stride), four rows walking each
+// tree side by side so their node loads overlap. Same results as calling
+// eps_forest_score() per row (the profiling build does exactly that).
+void eps_forest_score_batch(const EPS_Forest *forest, const double *x, uint16_t stride,
+                            double *out, int n);
+
+// Generated models (deploy/c_code)
+extern const EPS_Forest eps_power_forest;
+extern const EPS_Forest eps_voltage_forest;
+
+#endif // EPS_FOREST_H
@@ -0,0 +1,127 @@
+/**
+ * Anytime forest evaluation with remaining-tree bounds
+ */
+
+#include "eps_forest_anytime.h"
+#include "eps_cycle_clock.h"
+#include <stdbool.h>
+
+extern void log_event(const char* format, ...);
+
+#define TREE_STACK 64
+
+// Smallest and largest leaf of one tree; -1 if the tree is too deep to scan
+static int tree_leaf_range(const EPS_Forest *forest, uint16_t tree, double *lo, double *hi) {
+    int16_t stack[TREE_STACK];
+    int top = 0;
+    bool first = true;
+    stack[top++] = forest->roots[tree];
+    while (top > 0) {
+        int16_t node = stack[--top];
+        if (EPS_FOREST_IS_LEAF(node)) {
+            double v = forest->leaf_value[EPS_FOREST_LEAF(node)];
+            if (first || v < *lo) *lo = v;
+            if (first || v > *hi) *hi = v;
+            first = false;
+        } else {
+            if (top + 2 > TREE_STACK) return -1;
+            stack[top++] = forest->children[2 * node];
+            stack[top++] = forest->children[2 * node + 1];
+        }
+    }
+    return 0;
+}
+
+int eps_anytime_init(EPS_Anytime *anytime, const EPS_Forest *forest) {
+    uint16_t n = forest->n_trees;
+    double lo[EPS_ANYTIME_MAX_TREES], hi[EPS_ANYTIME_MAX_TREES];
+    if (n == 0 || n > EPS_ANYTIME_MAX_TREES) return -1;
+    eps_cycle_clock_enable();   // eval_us telemetry
+
+    for (uint16_t t = 0; t < n; t++) {
+        if (tree_leaf_range(forest, t, &lo[t], &hi[t]) != 0) return -1;
+        anytime->order[t] = (uint8_t)t;
+    }
+
+    // Widest trees first: they move the prediction most, and the bound
+    // shrinks fastest once they are summed (insertion sort, runs at init)
+    for (uint16_t i = 1; i < n; i++) {
+        uint8_t t = anytime->order[i];
+        uint16_t j = i;
+        while (j > 0 && hi[anytime->order[j - 1]] - lo[anytime->order[j - 1]] < hi[t] - lo[t]) {
+            anytime->order[j] = anytime->order[j - 1];
+            j--;
+        }
+        anytime->order[j] = t;
+    }
+
+    anytime->rem_lo[n] = anytime->rem_hi[n] = 0.0;
+    for (int k = n - 1; k >= 0; k--) {
+        anytime->rem_lo[k] = anytime->rem_lo[k + 1] + lo[anytime->order[k]];
+        anytime->rem_hi[k] = anytime->rem_hi[k + 1] + hi[anytime->order[k]];
+    }
+    anytime->forest = forest;
+    return 0;
+}
+
+static double magnitude(double v) {
+    return (v < 0.0) ? -v : v;
+}
+
+// True if no cut lies in [lo, hi] widened by the margin
+static bool interval_clear(double lo, double hi, const double *cuts, uint8_t n_cuts) {
+    for (uint8_t c = 0; c < n_cuts; c++) {
+        double m = EPS_ANYTIME_MARGIN * (magnitude(cuts[c]) + 1.0);
+        if (cuts[c] >= lo - m && cuts[c] <= hi + m) return false;
+    }
+    return true;
+}
+
+double eps_anytime_score(EPS_Anytime *anytime, const double *x, const double *cuts, uint8_t n_cuts) {
+    const EPS_Forest *forest = anytime->forest;
+    EPS_AnytimeTelemetry *tm = &anytime->telemetry;
+    uint16_t n = forest->n_trees;
+    double leaf[EPS_ANYTIME_MAX_TREES];
+    double partial = 0.0;
+    uint32_t start = EPS_CLOCK();
+
+    leaf[0] = 0.0;                 // Always overwritten (n_trees >= 1)
+    tm->rows++;
+    for (uint16_t k = 0; k < n; k++) {
+        uint8_t t = anytime->order[k];
+        leaf[t] = eps_forest_tree(forest, t, x);
+        partial += leaf[t];
+
+        if (k + 1 < n && n_cuts > 0) {
+            double lo = (partial + anytime->rem_lo[k + 1]) * forest->scale;
+            double hi = (partial + anytime->rem_hi[k + 1]) * forest->scale;
+            if (interval_clear(lo, hi, cuts, n_cuts)) {
+                tm->early_exits++;
+                tm->trees_evaluated += k + 1;
+                tm->trees_skipped += n - (k + 1);
+                tm->eval_us += EPS_ELAPSED_US(start);
+                return 0.5 * (lo + hi);
+            }
+        }
+    }
+
+    // Full evaluation: same summation order as eps_forest_score()
+    double sum = leaf[0];
+    for (uint16_t t = 1; t < n; t++) {
+        sum += leaf[t];
+    }
+    tm->trees_evaluated += n;
+    tm->eval_us += EPS_ELAPSED_US(start);
+    return sum * forest->scale;
+}
+
+void eps_anytime_report(const EPS_Anytime *anytime, const char *name) {
+    const EPS_AnytimeTelemetry *tm = &anytime->telemetry;
+    uint32_t total = tm->trees_evaluated + tm->trees_skipped;
+    uint32_t saved_us = tm->trees_evaluated
+        ? (uint32_t)((uint64_t)tm->eval_us * tm->trees_skipped / tm->trees_evaluated) : 0;
+    log_event("Anytime %s: %lu rows, %lu early exits, %lu/%lu trees skipped (%.1f%%), ~%luus saved",
+             name, (unsigned long)tm->rows, (unsigned long)tm->early_exits,
+             (unsigned long)tm->trees_skipped, (unsigned long)total,
+             total ? 100.0f * tm->trees_skipped / total : 0.0f, (unsigned long)saved_us);
+}
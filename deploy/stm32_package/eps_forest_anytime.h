@@ -0,0 +1,62 @@
+/**
+ * EPS Predictive FDIR - Anytime Forest Evaluation
+ * Early exit once the remaining trees cannot change a protection decision
+ *
+ * eps_anytime_init() orders the trees of an EPS_Forest by leaf spread
+ * (largest first) and precomputes, for every prefix of that order, the
+ * smallest and largest sum the remaining trees can add. After each tree
+ * the final score is known to lie in
+ *   [(partial + rem_lo[k]) * scale, (partial + rem_hi[k]) * scale]
+ * and evaluation stops as soon as no decision threshold ("cut") lies in
+ * that interval: every comparison against a cut then has the same outcome
+ * as with the full 50-tree score.
+ *
+ * If all trees are needed the leaves are summed in tree order, so the
+ * result is bit-identical to eps_forest_score(). After an early exit the
+ * interval midpoint is returned; a caller that needs the score itself
+ * (bias update, shadow comparison) passes no cuts.
+ *
+ * RAM: ~1.1 KB per model (order and bound tables)
+ */
+
+#ifndef EPS_FOREST_ANYTIME_H
+#define EPS_FOREST_ANYTIME_H
+
+#include "eps_forest.h"
+#include <stdint.h>
+
+#define EPS_ANYTIME_MAX_TREES 64
+#define EPS_ANYTIME_MAX_CUTS  4
+
+// Interval kept clear of every cut: relative, covers float conversion
+// and summation-order rounding between the bound and the final score
+#define EPS_ANYTIME_MARGIN 1e-6
+
+// Reported through telemetry (eps_anytime_report)
+typedef struct {
+    uint32_t rows;                 // Scored feature vectors
+    uint32_t early_exits;          // Rows that stopped before the last tree
+    uint32_t trees_evaluated;
+    uint32_t trees_skipped;
+    uint32_t eval_us;              // Time spent scoring, for the per-tree cost
+} EPS_AnytimeTelemetry;
+
+typedef struct {
+    const EPS_Forest *forest;
+    uint8_t order[EPS_ANYTIME_MAX_TREES];        // Evaluation order (tree indices)
+    double rem_lo[EPS_ANYTIME_MAX_TREES + 1];    // Min sum of the trees order[k..]
+    double rem_hi[EPS_ANYTIME_MAX_TREES + 1];    // Max sum of the trees order[k..]
+    EPS_AnytimeTelemetry telemetry;
+} EPS_Anytime;
+
+// Returns 0, or -1 if the forest has more than EPS_ANYTIME_MAX_TREES trees.
+// Telemetry is kept when re-initialised for a swapped-in model.
+int eps_anytime_init(EPS_Anytime *anytime, const EPS_Forest *forest);
+
+// Score x, stopping once no cut lies in the remaining interval
+// (n_cuts = 0 scores all trees)
+double eps_anytime_score(EPS_Anytime *anytime, const double *x, const double *cuts, uint8_t n_cuts);
+
+void eps_anytime_report(const EPS_Anytime *anytime, const char *name);
+
+#endif // EPS_FOREST_ANYTIME_H
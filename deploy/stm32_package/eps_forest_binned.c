@@ -0,0 +1,54 @@
+/**
+ * Binned forest evaluation
+ */
+
+#include "eps_forest_binned.h"
+
+// Number of thresholds below x (binary search); NaN ranks above all of them
+static uint16_t split_rank(const double *split, uint16_t n, double x) {
+    if (!(x <= x)) {
+        return n;
+    }
+    uint16_t lo = 0, hi = n;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (split[mid] < x) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+void eps_forest_binned_bins(const EPS_ForestBinned *forest, const double *x, uint8_t *bins) {
+    uint16_t rank = 0;
+    int last = -1;
+    for (uint16_t s = 0; s < forest->n_slots; s++) {
+        uint8_t f = forest->slot_feature[s];
+        if (f != last) {
+            // Slots of one feature are adjacent: search once per feature
+            uint16_t first = forest->split_offset[f];
+            rank = split_rank(forest->split + first, forest->split_offset[f + 1] - first, x[f]);
+            last = f;
+        }
+        int32_t b = (int32_t)rank - forest->slot_base[s];
+        bins[s] = (b < 0) ? 0 : (b > 255) ? 255 : (uint8_t)b;
+    }
+}
+
+double eps_forest_binned_score(const EPS_ForestBinned *forest, const double *x) {
+    uint8_t bins[EPS_BINNED_MAX_SLOTS];
+    eps_forest_binned_bins(forest, x, bins);
+
+    // Same summation order as eps_forest_score()
+    double sum = eps_forest_binned_tree(forest, 0, bins);
+    for (uint16_t t = 1; t < forest->n_trees; t++) {
+        sum += eps_forest_binned_tree(forest, t, bins);
+    }
+    return sum * forest->scale;
+}
+
+void eps_forest_binned_score_batch(const EPS_ForestBinned *forest, const double *x, uint16_t stride,
+                                   double *out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = eps_forest_binned_score(forest, x + i * stride);
+    }
+}
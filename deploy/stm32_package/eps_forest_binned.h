@@ -0,0 +1,73 @@
+/**
+ * EPS Predictive FDIR - Binned Forest Backend
+ * Each feature is compared once per sample against its sorted thresholds;
+ * the trees then compare 8-bit bin IDs
+ *
+ * All trees of a model compare feature f against a few hundred distinct
+ * thresholds T_0 < T_1 < ... (eps_forest_export.py collects them). With
+ * rank(x) = number of T_k < x, the split "x <= T_j" is exactly
+ * "rank(x) <= j", so one binary search per feature replaces every double
+ * compare in the 50 trees and predictions stay bit-identical.
+ *
+ * Ranks are stored as uint8 per bin slot: a feature with more than 255
+ * thresholds gets one slot per 255 of them, holding
+ * clamp(rank - base, 0, 255), which preserves every split outcome within
+ * its range. NaN ranks above all thresholds (right at every split).
+ *
+ * Flash: 6 bytes per internal node + 8 per leaf + 8 per distinct threshold
+ */
+
+#ifndef EPS_FOREST_BINNED_H
+#define EPS_FOREST_BINNED_H
+
+#include <stdint.h>
+
+#define EPS_BINNED_MAX_SLOTS 32
+#define EPS_BINNED_SLOT_RANGE 255      // Thresholds covered by one uint8 slot
+
+typedef struct {
+    uint16_t n_features;
+    uint16_t n_slots;              // Bin slots (>= features that have splits)
+    uint16_t n_trees;
+    uint16_t n_nodes;
+    uint16_t n_leaves;
+    double scale;                  // 1 / n_estimators (RandomForest averaging)
+
+    const uint16_t *split_offset;  // [n_features+1] feature f's thresholds: split[offset[f]..offset[f+1])
+    const double *split;           // Ascending distinct thresholds, feature by feature
+    const uint8_t *slot_feature;   // [n_slots] input feature binned into the slot
+    const uint16_t *slot_base;     // [n_slots] first threshold rank the slot covers
+
+    const int16_t *roots;          // [n_trees]  same encoding as EPS_Forest
+    const uint8_t *slot;           // [n_nodes]  bin slot compared at node
+    const uint8_t *bin;            // [n_nodes]  go left if bins[slot] <= bin
+    const int16_t *children;       // [2*n_nodes]
+    const double *leaf_value;      // [n_leaves]
+} EPS_ForestBinned;
+
+// Bin IDs of one feature vector (bins[n_slots])
+void eps_forest_binned_bins(const EPS_ForestBinned *forest, const double *x, uint8_t *bins);
+
+// Walk one tree on bin IDs and return its leaf value
+static inline double eps_forest_binned_tree(const EPS_ForestBinned *forest, uint16_t tree,
+                                            const uint8_t *bins) {
+    const uint8_t *slot = forest->slot;
+    const uint8_t *bin = forest->bin;
+    const int16_t *children = forest->children;
+
+    int16_t node = forest->roots[tree];
+    while (node >= 0) {
+        node = children[2 * node + (bins[slot[node]] > bin[node])];
+    }
+    return forest->leaf_value[~node];
+}
+
+double eps_forest_binned_score(const EPS_ForestBinned *forest, const double *x);
+void eps_forest_binned_score_batch(const EPS_ForestBinned *forest, const double *x, uint16_t stride,
+                                   double *out, int n);
+
+// Generated models (deploy/c_code)
+extern const EPS_ForestBinned eps_power_forest_binned;
+extern const EPS_ForestBinned eps_voltage_forest_binned;
+
+#endif // EPS_FOREST_BINNED_H
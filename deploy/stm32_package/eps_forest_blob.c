@@ -0,0 +1,109 @@
+/**
+ * Binary forest blob validation and binding
+ */
+
+#include "eps_forest_blob.h"
+
+// Nibble-wise CRC-32 (reflected 0xEDB88320): 64-byte table instead of 1 KB
+static const uint32_t CRC32_NIBBLE[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+uint32_t eps_crc32(uint32_t crc, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    crc = ~crc;
+    while (len--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ CRC32_NIBBLE[crc & 0x0F];
+        crc = (crc >> 4) ^ CRC32_NIBBLE[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+// Section [offset, offset + bytes) must be aligned and inside the blob
+static int section_ok(uint32_t offset, uint32_t bytes, uint32_t header_size, uint32_t total) {
+    return (offset % EPS_BLOB_ALIGN) == 0 &&
+           offset >= header_size &&
+           offset <= total &&
+           bytes <= total - offset;
+}
+
+EPS_BlobStatus eps_forest_blob_bind(const void *blob, size_t size, EPS_Forest *forest) {
+    const EPS_ForestBlobHeader *h = (const EPS_ForestBlobHeader *)blob;
+    const uint8_t *base = (const uint8_t *)blob;
+
+    if (size < sizeof(EPS_ForestBlobHeader)) return BLOB_ERR_SIZE;
+    if (((uintptr_t)blob % EPS_BLOB_ALIGN) != 0) return BLOB_ERR_ALIGN;
+    if (h->magic != EPS_BLOB_MAGIC) return BLOB_ERR_MAGIC;
+    if (h->version != EPS_BLOB_VERSION || h->header_size != sizeof(EPS_ForestBlobHeader)) {
+        return BLOB_ERR_VERSION;
+    }
+    if (h->total_size > size || h->total_size < h->header_size) return BLOB_ERR_SIZE;
+
+    uint32_t crc = eps_crc32(0, base + 16, h->total_size - 16);
+    if (crc != h->crc32) return BLOB_ERR_CRC;
+
+    uint32_t hs = h->header_size;
+    uint32_t total = h->total_size;
+    if (h->n_trees == 0 ||
+        !section_ok(h->threshold_offset, h->n_nodes * sizeof(double), hs, total) ||
+        !section_ok(h->leaf_value_offset, h->n_leaves * sizeof(double), hs, total) ||
+        !section_ok(h->children_offset, 2u * h->n_nodes * sizeof(int16_t), hs, total) ||
+        !section_ok(h->roots_offset, h->n_trees * sizeof(int16_t), hs, total) ||
+        !section_ok(h->feature_offset, h->n_nodes, hs, total)) {
+        return BLOB_ERR_LAYOUT;
+    }
+
+    // Structural check so a CRC-valid but malformed upload cannot send the
+    // walk out of bounds or into a loop: every internal child index must be
+    // greater than its parent's (any order the exporter picks, pre-order or
+    // hot-path-first, satisfies this; nothing stricter is assumed) and
+    // features must exist
+    const int16_t *children = (const int16_t *)(base + h->children_offset);
+    const int16_t *roots = (const int16_t *)(base + h->roots_offset);
+    const uint8_t *feature = base + h->feature_offset;
+    for (uint32_t n = 0; n < 2u * h->n_nodes; n++) {
+        int16_t c = children[n];
+        if (EPS_FOREST_IS_LEAF(c) ? (EPS_FOREST_LEAF(c) >= h->n_leaves)
+                                  : (c <= (int32_t)(n / 2) || c >= h->n_nodes)) {
+            return BLOB_ERR_LAYOUT;
+        }
+    }
+    for (uint16_t t = 0; t < h->n_trees; t++) {
+        int16_t r = roots[t];
+        if (EPS_FOREST_IS_LEAF(r) ? (EPS_FOREST_LEAF(r) >= h->n_leaves) : (r >= h->n_nodes)) {
+            return BLOB_ERR_LAYOUT;
+        }
+    }
+    for (uint16_t n = 0; n < h->n_nodes; n++) {
+        if (feature[n] >= h->n_features) return BLOB_ERR_LAYOUT;
+    }
+
+    forest->n_features = h->n_features;
+    forest->n_trees = h->n_trees;
+    forest->n_nodes = h->n_nodes;
+    forest->n_leaves = h->n_leaves;
+    forest->scale = h->scale;
+    forest->roots = roots;
+    forest->feature = feature;
+    forest->threshold = (const double *)(base + h->threshold_offset);
+    forest->children = children;
+    forest->leaf_value = (const double *)(base + h->leaf_value_offset);
+    return BLOB_OK;
+}
+
+const char* eps_blob_status_to_string(EPS_BlobStatus status) {
+    switch(status) {
+        case BLOB_OK: return "OK";
+        case BLOB_ERR_SIZE: return "SIZE";
+        case BLOB_ERR_ALIGN: return "ALIGN";
+        case BLOB_ERR_MAGIC: return "MAGIC";
+        case BLOB_ERR_VERSION: return "VERSION";
+        case BLOB_ERR_CRC: return "CRC";
+        case BLOB_ERR_LAYOUT: return "LAYOUT";
+        default: return "UNKNOWN";
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * EPS Predictive FDIR - Binary Forest Blob
+ * Versioned, CRC-protected model image executed in place (no copy, no parse)
+ *
+ * Layout (little-endian, every section 8-byte aligned):
+ *   EPS_ForestBlobHeader | threshold[] | leaf_value[] | children[] | roots[] | feature[]
+ *
+ * The CRC-32 (IEEE 802.3) covers every byte after the crc32 field, header
+ * counts and offsets included. eps_forest_blob_bind() only validates the
+ * blob (CRC, section bounds, node links) and points an EPS_Forest at the
+ * arrays inside it, so the blob can live in flash or in an mmap'd file.
+ * Written by eps_forest_export.py next to the generated C (deploy/c_code/power_model.bin, voltage_model.bin).
+ */
+
+#ifndef EPS_FOREST_BLOB_H
+#define EPS_FOREST_BLOB_H
+
+#include "eps_forest.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "EPS forest blobs are little-endian; add byte swapping for this target"
+#endif
+
+#define EPS_BLOB_MAGIC    0x46535045u   // "EPSF"
+#define EPS_BLOB_VERSION  1
+#define EPS_BLOB_ALIGN    8
+
+typedef struct {
+    uint32_t magic;               // EPS_BLOB_MAGIC
+    uint16_t version;             // EPS_BLOB_VERSION
+    uint16_t header_size;         // sizeof(EPS_ForestBlobHeader)
+    uint32_t total_size;          // Header + arrays, bytes
+    uint32_t crc32;               // CRC-32 of bytes [16, total_size)
+
+    uint16_t n_features;
+    uint16_t n_trees;
+    uint16_t n_nodes;
+    uint16_t n_leaves;
+    double scale;
+
+    // Byte offsets from the start of the blob
+    uint32_t threshold_offset;
+    uint32_t leaf_value_offset;
+    uint32_t children_offset;
+    uint32_t roots_offset;
+    uint32_t feature_offset;
+    uint32_t reserved;
+} EPS_ForestBlobHeader;
+
+typedef enum {
+    BLOB_OK = 0,
+    BLOB_ERR_SIZE = 1,        // Truncated, or total_size disagrees with the buffer
+    BLOB_ERR_ALIGN = 2,       // Blob not 8-byte aligned in memory
+    BLOB_ERR_MAGIC = 3,
+    BLOB_ERR_VERSION = 4,
+    BLOB_ERR_CRC = 5,
+    BLOB_ERR_LAYOUT = 6       // Section offsets/counts out of range
+} EPS_BlobStatus;
+
+// Incremental CRC-32 (start with crc = 0)
+uint32_t eps_crc32(uint32_t crc, const void *data, size_t len);
+
+// Validate the blob and point forest at its arrays (no copy)
+EPS_BlobStatus eps_forest_blob_bind(const void *blob, size_t size, EPS_Forest *forest);
+
+const char* eps_blob_status_to_string(EPS_BlobStatus status);
+
+#endif // EPS_FOREST_BLOB_H
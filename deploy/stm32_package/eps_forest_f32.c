@@ -0,0 +1,29 @@
+/**
+ * Single-precision forest evaluation for STM32
+ */
+
+#include "eps_forest_f32.h"
+
+float eps_forest_f32_score(const EPS_ForestF32 *forest, const float *x) {
+    // Same summation order as eps_forest_score(), in float
+    float sum = eps_forest_f32_tree(forest, 0, x);
+    for (uint16_t t = 1; t < forest->n_trees; t++) {
+        sum += eps_forest_f32_tree(forest, t, x);
+    }
+    return sum * forest->scale;
+}
+
+void eps_forest_f32_score_batch(const EPS_ForestF32 *forest, const float *x, uint16_t stride,
+                                float *out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = eps_forest_f32_tree(forest, 0, x + i * stride);
+    }
+    for (uint16_t t = 1; t < forest->n_trees; t++) {
+        for (int i = 0; i < n; i++) {
+            out[i] += eps_forest_f32_tree(forest, t, x + i * stride);
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        out[i] *= forest->scale;
+    }
+}
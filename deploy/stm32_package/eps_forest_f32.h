@@ -0,0 +1,65 @@
+/**
+ * EPS Predictive FDIR - Single-Precision Forest Backend
+ * The table walk on float inputs, thresholds and leaves, for MCUs whose FPU
+ * has no double support (Cortex-M4F: every double compare or add is a
+ * soft-float library call)
+ *
+ * Same node layout as EPS_Forest; roots, feature indices and child links
+ * are the very same tables. eps_forest_export.py stores each threshold as
+ * the largest float <= the double threshold, so for any float input
+ *   x <= threshold_f32  <=>  x <= threshold
+ * and a float feature row takes exactly the double model's path. Leaves are
+ * the nearest float, and trees are summed in float. Only the feature values
+ * themselves can differ from a double pipeline (a float P[t] - P[t-1] is
+ * rounded); deploy/host/float_check.c measures the effect on replayed
+ * telemetry.
+ *
+ * Build with EPS_FOREST_BACKEND=EPS_FOREST_BACKEND_FLOAT32: the generated
+ * model files then provide float entry points instead of the double ones,
+ * and the feature engines store float rings (eps_feature_t).
+ *
+ * Flash: 9 bytes per internal node + 4 bytes per distinct leaf value
+ */
+
+#ifndef EPS_FOREST_F32_H
+#define EPS_FOREST_F32_H
+
+#include "eps_forest.h"
+#include <stdint.h>
+
+typedef struct {
+    uint16_t n_features;
+    uint16_t n_trees;
+    uint16_t n_nodes;
+    uint16_t n_leaves;
+    float scale;                   // 1 / n_estimators (RandomForest averaging)
+
+    const int16_t *roots;          // [n_trees]  same tables as EPS_Forest
+    const uint8_t *feature;        // [n_nodes]
+    const float *threshold;        // [n_nodes]  go left if x[feature] <= threshold
+    const int16_t *children;       // [2*n_nodes]
+    const float *leaf_value;       // [n_leaves]
+} EPS_ForestF32;
+
+// Walk one tree and return its leaf value (NaN goes right, as in eps_forest_tree)
+static inline float eps_forest_f32_tree(const EPS_ForestF32 *forest, uint16_t tree, const float *x) {
+    const uint8_t *feature = forest->feature;
+    const float *threshold = forest->threshold;
+    const int16_t *children = forest->children;
+
+    int16_t node = forest->roots[tree];
+    while (!EPS_FOREST_IS_LEAF(node)) {
+        node = children[2 * node + !(x[feature[node]] <= threshold[node])];
+    }
+    return forest->leaf_value[EPS_FOREST_LEAF(node)];
+}
+
+float eps_forest_f32_score(const EPS_ForestF32 *forest, const float *x);
+void eps_forest_f32_score_batch(const EPS_ForestF32 *forest, const float *x, uint16_t stride,
+                                float *out, int n);
+
+// Generated models (deploy/c_code)
+extern const EPS_ForestF32 eps_power_forest_f32;
+extern const EPS_ForestF32 eps_voltage_forest_f32;
+
+#endif // EPS_FOREST_F32_H
@@ -0,0 +1,36 @@
+/**
+ * Fixed-point forest evaluation (no floating point)
+ */
+
+#include "eps_forest_fixed.h"
+
+uint16_t eps_forest_fixed_code(const EPS_FixedFeature *quant, int64_t x) {
+    uint16_t top = quant->n_buckets - 1;
+    uint16_t bucket = 0;
+    if (x >= quant->offset) {
+        uint64_t b = (uint64_t)(x - quant->offset) >> quant->shift;
+        bucket = (b > top) ? top : (uint16_t)b;
+    }
+
+    // Split values below x (a handful per feature)
+    uint16_t lo = 0, hi = quant->n_splits;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (quant->split[mid] < x) lo = mid + 1;
+        else hi = mid;
+    }
+    return bucket + lo;
+}
+
+int64_t eps_forest_fixed_score(const EPS_ForestFixed *forest, const int64_t *x) {
+    uint16_t xq[EPS_FIXED_MAX_FEATURES];
+    for (uint16_t f = 0; f < forest->n_features; f++) {
+        xq[f] = eps_forest_fixed_code(&forest->quant[f], x[f]);
+    }
+
+    int32_t sum = 0;
+    for (uint16_t t = 0; t < forest->n_trees; t++) {
+        sum += forest->leaf_value[eps_forest_fixed_leaf(forest, t, xq)];
+    }
+    return ((int64_t)sum * forest->pred_mul) >> forest->pred_shift;
+}
@@ -0,0 +1,72 @@
+/**
+ * EPS Predictive FDIR - Fixed-Point Forest Backend
+ * Integer-only inference for EPS controllers without an FPU (Cortex-M0/M3)
+ *
+ * Same scheme as eps_forest_q.h, but the inputs are integers in the units
+ * of eps_fixed_pipeline.h (power in pW, voltage in uV) and every step is an
+ * integer operation: subtract, shift, compare, add. Predictions come back
+ * in the same integer units. eps_forest_export.py checks that every tree
+ * takes the same path as the double model on all recorded telemetry.
+ *
+ * Build with EPS_FOREST_BACKEND=EPS_FOREST_BACKEND_FIXED so the generated
+ * model files leave out the double entry points.
+ */
+
+#ifndef EPS_FOREST_FIXED_H
+#define EPS_FOREST_FIXED_H
+
+#include "eps_forest.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define EPS_FIXED_MAX_FEATURES 16
+
+typedef struct {
+    int64_t offset;                // Input value at the start of bucket 0
+    uint8_t shift;                 // Bucket width = 2^shift input units
+    uint16_t n_buckets;
+    uint16_t n_splits;
+    const int64_t *split;          // [n_splits] ascending exact split values
+} EPS_FixedFeature;
+
+typedef struct {
+    uint16_t n_features;
+    uint16_t n_trees;
+    uint16_t n_nodes;
+    uint16_t n_leaves;
+    int32_t pred_mul;              // prediction = (leaf sum * pred_mul) >> pred_shift
+    uint8_t pred_shift;
+
+    const EPS_FixedFeature *quant; // [n_features]
+    const int16_t *roots;          // [n_trees]  same encoding as EPS_Forest
+    const uint8_t *feature;        // [n_nodes]
+    const uint16_t *threshold;     // [n_nodes]  go left if code(x[feature]) <= threshold
+    const int16_t *children;       // [2*n_nodes]
+    const int32_t *leaf_value;     // [n_leaves]
+} EPS_ForestFixed;
+
+// 16-bit code of one input value
+uint16_t eps_forest_fixed_code(const EPS_FixedFeature *quant, int64_t x);
+
+// Walk one tree on precomputed codes and return its leaf index
+static inline uint16_t eps_forest_fixed_leaf(const EPS_ForestFixed *forest, uint16_t tree,
+                                             const uint16_t *xq) {
+    const uint8_t *feature = forest->feature;
+    const uint16_t *threshold = forest->threshold;
+    const int16_t *children = forest->children;
+
+    int16_t node = forest->roots[tree];
+    while (!EPS_FOREST_IS_LEAF(node)) {
+        node = children[2 * node + (xq[feature[node]] > threshold[node])];
+    }
+    return (uint16_t)EPS_FOREST_LEAF(node);
+}
+
+// Prediction in the model's integer units (pW or uV)
+int64_t eps_forest_fixed_score(const EPS_ForestFixed *forest, const int64_t *x);
+
+// Generated models (deploy/c_code)
+extern const EPS_ForestFixed eps_power_forest_fixed;
+extern const EPS_ForestFixed eps_voltage_forest_fixed;
+
+#endif // EPS_FOREST_FIXED_H
@@ -0,0 +1,29 @@
+/**
+ * Implicit perfect-tree forest evaluation
+ */
+
+#include "eps_forest_implicit.h"
+
+double eps_forest_implicit_score(const EPS_ForestImplicit *forest, const double *x) {
+    // Same summation order as eps_forest_score()
+    double sum = eps_forest_implicit_tree(forest, 0, x);
+    for (uint16_t t = 1; t < forest->n_trees; t++) {
+        sum += eps_forest_implicit_tree(forest, t, x);
+    }
+    return sum * forest->scale;
+}
+
+void eps_forest_implicit_score_batch(const EPS_ForestImplicit *forest, const double *x, uint16_t stride,
+                                     double *out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = eps_forest_implicit_tree(forest, 0, x + i * stride);
+    }
+    for (uint16_t t = 1; t < forest->n_trees; t++) {
+        for (int i = 0; i < n; i++) {
+            out[i] += eps_forest_implicit_tree(forest, t, x + i * stride);
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        out[i] *= forest->scale;
+    }
+}
@@ -0,0 +1,87 @@
+/**
+ * EPS Predictive FDIR - Implicit Perfect-Tree Forest Backend
+ * Every tree padded to a perfect binary tree of EPS_IMPLICIT_DEPTH levels
+ *
+ * Node i of a tree has its children at 2i+1 and 2i+2, so no child links are
+ * stored: a tree is (2^D - 1) split nodes followed by 2^D leaves, and the
+ * walk is D unrolled steps of i = 2i + 1 + !(x[feature[i]] <= threshold[i])
+ * with no data-dependent branch. eps_forest_export.py pads shallower leaves
+ * with dummy splits whose two subtrees hold the same leaf value, so
+ * predictions are bit-identical to the table walk.
+ *
+ * The depth is fixed at compile time (default 6, the pruned models' cap);
+ * the generated tables refuse to build against a different depth.
+ *
+ * Flash per tree: 9 bytes per split node + 8 bytes per leaf (D = 6: 1079 bytes)
+ */
+
+#ifndef EPS_FOREST_IMPLICIT_H
+#define EPS_FOREST_IMPLICIT_H
+
+#include <stdint.h>
+
+#ifndef EPS_IMPLICIT_DEPTH
+#define EPS_IMPLICIT_DEPTH 6
+#endif
+
+#if EPS_IMPLICIT_DEPTH < 1 || EPS_IMPLICIT_DEPTH > 8
+#error "EPS_IMPLICIT_DEPTH must be 1..8"
+#endif
+
+#define EPS_IMPLICIT_NODES   ((1 << EPS_IMPLICIT_DEPTH) - 1)   // Split nodes per tree
+#define EPS_IMPLICIT_LEAVES  (1 << EPS_IMPLICIT_DEPTH)         // Leaves per tree
+
+typedef struct {
+    uint16_t n_features;
+    uint16_t n_trees;
+    double scale;                  // 1 / n_estimators (RandomForest averaging)
+
+    const uint8_t *feature;        // [n_trees * EPS_IMPLICIT_NODES]
+    const double *threshold;       // [n_trees * EPS_IMPLICIT_NODES]  go left if x <= threshold
+    const double *leaf_value;      // [n_trees * EPS_IMPLICIT_LEAVES]
+} EPS_ForestImplicit;
+
+// One level: step to child 2i+1 (x <= t) or 2i+2 (otherwise, NaN included)
+#define EPS_IMPLICIT_STEP(i) ((i) = 2 * (i) + 1 + !(x[feature[i]] <= threshold[i]))
+
+// Walk one tree, unrolled for the compile-time depth
+static inline double eps_forest_implicit_tree(const EPS_ForestImplicit *forest, uint16_t tree,
+                                              const double *x) {
+    const uint8_t *feature = forest->feature + (uint32_t)tree * EPS_IMPLICIT_NODES;
+    const double *threshold = forest->threshold + (uint32_t)tree * EPS_IMPLICIT_NODES;
+    uint32_t i = 0;
+
+    EPS_IMPLICIT_STEP(i);
+#if EPS_IMPLICIT_DEPTH > 1
+    EPS_IMPLICIT_STEP(i);
+#endif
+#if EPS_IMPLICIT_DEPTH > 2
+    EPS_IMPLICIT_STEP(i);
+#endif
+#if EPS_IMPLICIT_DEPTH > 3
+    EPS_IMPLICIT_STEP(i);
+#endif
+#if EPS_IMPLICIT_DEPTH > 4
+    EPS_IMPLICIT_STEP(i);
+#endif
+#if EPS_IMPLICIT_DEPTH > 5
+    EPS_IMPLICIT_STEP(i);
+#endif
+#if EPS_IMPLICIT_DEPTH > 6
+    EPS_IMPLICIT_STEP(i);
+#endif
+#if EPS_IMPLICIT_DEPTH > 7
+    EPS_IMPLICIT_STEP(i);
+#endif
+    return forest->leaf_value[(uint32_t)tree * EPS_IMPLICIT_LEAVES + (i - EPS_IMPLICIT_NODES)];
+}
+
+double eps_forest_implicit_score(const EPS_ForestImplicit *forest, const double *x);
+void eps_forest_implicit_score_batch(const EPS_ForestImplicit *forest, const double *x, uint16_t stride,
+                                     double *out, int n);
+
+// Generated models (deploy/c_code)
+extern const EPS_ForestImplicit eps_power_forest_implicit;
+extern const EPS_ForestImplicit eps_voltage_forest_implicit;
+
+#endif // EPS_FOREST_IMPLICIT_H
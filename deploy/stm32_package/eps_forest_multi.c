@@ -0,0 +1,47 @@
+/**
+ * Multi-target forest evaluation
+ */
+
+#include "eps_forest_multi.h"
+
+void eps_forest_multi_score(const EPS_ForestMulti *forest, const double *x, double *out) {
+    uint16_t n_out = forest->n_outputs;
+
+    // Per output, the same summation order as eps_forest_score()
+    const double *leaf = eps_forest_multi_tree(forest, 0, x);
+    for (uint16_t k = 0; k < n_out; k++) {
+        out[k] = leaf[k];
+    }
+    for (uint16_t t = 1; t < forest->n_trees; t++) {
+        leaf = eps_forest_multi_tree(forest, t, x);
+        for (uint16_t k = 0; k < n_out; k++) {
+            out[k] += leaf[k];
+        }
+    }
+    for (uint16_t k = 0; k < n_out; k++) {
+        out[k] *= forest->scale;
+    }
+}
+
+void eps_forest_multi_score_batch(const EPS_ForestMulti *forest, const double *x, uint16_t stride,
+                                  double *out, int n) {
+    uint16_t n_out = forest->n_outputs;
+
+    for (int i = 0; i < n; i++) {
+        const double *leaf = eps_forest_multi_tree(forest, 0, x + i * stride);
+        for (uint16_t k = 0; k < n_out; k++) {
+            out[i * n_out + k] = leaf[k];
+        }
+    }
+    for (uint16_t t = 1; t < forest->n_trees; t++) {
+        for (int i = 0; i < n; i++) {
+            const double *leaf = eps_forest_multi_tree(forest, t, x + i * stride);
+            for (uint16_t k = 0; k < n_out; k++) {
+                out[i * n_out + k] += leaf[k];
+            }
+        }
+    }
+    for (int i = 0; i < n * n_out; i++) {
+        out[i] *= forest->scale;
+    }
+}
@@ -0,0 +1,71 @@
+/**
+ * EPS Predictive FDIR - Multi-Target Forest Runtime
+ * One RandomForest with vector-valued leaves: a single walk of each tree
+ * yields power, voltage and current for a panel
+ *
+ * Same node tables as eps_forest.h; each leaf holds n_outputs values
+ * (row-major, leaf_value[leaf * n_outputs + k]). Tables are generated by
+ * eps_forest_export.py --multi-target from a multi-output
+ * RandomForestRegressor (deploy/c_code/panel_model.c).
+ *
+ * Flash: 13 bytes per internal node + 8 bytes per leaf and output
+ */
+
+#ifndef EPS_FOREST_MULTI_H
+#define EPS_FOREST_MULTI_H
+
+#include <stdint.h>
+
+typedef struct {
+    uint16_t n_features;
+    uint16_t n_outputs;
+    uint16_t n_trees;
+    uint16_t n_nodes;              // Internal (split) nodes
+    uint16_t n_leaves;
+    double scale;                  // 1 / n_estimators (RandomForest averaging)
+
+    const int16_t *roots;          // [n_trees]
+    const uint8_t *feature;        // [n_nodes]
+    const double *threshold;       // [n_nodes]  go left if x[feature] <= threshold
+    const int16_t *children;       // [2*n_nodes] left child, right child (< 0: ~leaf)
+    const double *leaf_value;      // [n_leaves * n_outputs]
+} EPS_ForestMulti;
+
+// Walk one tree and return its leaf's output vector
+static inline const double *eps_forest_multi_tree(const EPS_ForestMulti *forest, uint16_t tree,
+                                                  const double *x) {
+    const uint8_t *feature = forest->feature;
+    const double *threshold = forest->threshold;
+    const int16_t *children = forest->children;
+
+    int16_t node = forest->roots[tree];
+    while (node >= 0) {
+        node = children[2 * node + !(x[feature[node]] <= threshold[node])];
+    }
+    return forest->leaf_value + (uint32_t)(~node) * forest->n_outputs;
+}
+
+// Average of all trees for one feature vector; writes n_outputs values to out
+void eps_forest_multi_score(const EPS_ForestMulti *forest, const double *x, double *out);
+
+// Score n feature vectors (row i at x + i*stride) tree by tree; row i's
+// outputs go to out + i*n_outputs
+void eps_forest_multi_score_batch(const EPS_ForestMulti *forest, const double *x, uint16_t stride,
+                                  double *out, int n);
+
+// ===== PANEL MODEL =====
+// Inputs: the 10 power features followed by the 5 voltage features, so the
+// single-target models can read the same row (power at +0, voltage at +10)
+#define EPS_PANEL_FEATURES      15
+#define EPS_PANEL_VOLTAGE_FEAT  10   // Offset of Volt_lag1 in the row
+#define EPS_PANEL_OUTPUTS       3
+
+// Output order
+#define EPS_MULTI_POWER    0          // uW
+#define EPS_MULTI_VOLTAGE  1          // mV
+#define EPS_MULTI_CURRENT  2          // mA
+
+// Generated model (deploy/c_code/panel_model.c)
+extern const EPS_ForestMulti eps_panel_forest_multi;
+
+#endif // EPS_FOREST_MULTI_H
@@ -0,0 +1,107 @@
+/**
+ * Forest walk instrumentation (built with -DEPS_FOREST_PROFILE)
+ */
+
+#include "eps_forest_profile.h"
+#include "eps_forest_blob.h"
+#include <string.h>
+
+static EPS_ForestProfile *attached[EPS_FOREST_PROFILE_MAX_MODELS];
+
+int eps_forest_profile_attach(EPS_ForestProfile *profile, const EPS_Forest *forest,
+                              uint32_t *storage) {
+    int slot = -1;
+    for (int i = 0; i < EPS_FOREST_PROFILE_MAX_MODELS; i++) {
+        if (attached[i] == profile) {
+            slot = i;
+            break;
+        }
+        if (attached[i] == 0 && slot < 0) slot = i;
+    }
+    if (slot < 0) return -1;
+
+    memset(storage, 0, EPS_FOREST_PROFILE_WORDS(forest->n_trees, forest->n_nodes, forest->n_features)
+                       * sizeof(uint32_t));
+    profile->forest = forest;
+    profile->walks = 0;
+    profile->branch = storage;
+    profile->path_length = storage + 2u * forest->n_nodes;
+    profile->compares = profile->path_length + forest->n_trees * (EPS_FOREST_PROFILE_MAX_DEPTH + 1u);
+    attached[slot] = profile;
+    return 0;
+}
+
+void eps_forest_profile_detach(EPS_ForestProfile *profile) {
+    for (int i = 0; i < EPS_FOREST_PROFILE_MAX_MODELS; i++) {
+        if (attached[i] == profile) attached[i] = 0;
+    }
+}
+
+void eps_forest_profile_tree(const EPS_Forest *forest, uint16_t tree, const double *x) {
+    EPS_ForestProfile *p = 0;
+    for (int i = 0; i < EPS_FOREST_PROFILE_MAX_MODELS; i++) {
+        if (attached[i] && attached[i]->forest == forest) {
+            p = attached[i];
+            break;
+        }
+    }
+    if (!p) return;
+
+    // Same decisions as eps_forest_tree(): !(x <= t) goes right
+    uint32_t depth = 0;
+    for (int16_t node = forest->roots[tree]; !EPS_FOREST_IS_LEAF(node); depth++) {
+        uint8_t f = forest->feature[node];
+        int right = !(x[f] <= forest->threshold[node]);
+        p->branch[2 * node + right]++;
+        p->compares[f]++;
+        node = forest->children[2 * node + right];
+    }
+    if (depth > EPS_FOREST_PROFILE_MAX_DEPTH) depth = EPS_FOREST_PROFILE_MAX_DEPTH;
+    p->path_length[tree * (EPS_FOREST_PROFILE_MAX_DEPTH + 1u) + depth]++;
+    p->walks++;
+}
+
+size_t eps_forest_profile_size(const EPS_ForestProfile *profile) {
+    const EPS_Forest *f = profile->forest;
+    return EPS_FOREST_PROFILE_HEADER
+           + 4u * EPS_FOREST_PROFILE_WORDS(f->n_trees, f->n_nodes, f->n_features) + 4u;
+}
+
+static uint8_t *put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+    return p + 4;
+}
+
+size_t eps_forest_profile_serialize(const EPS_ForestProfile *profile, uint32_t model_hash,
+                                    uint8_t *buf, size_t cap) {
+    const EPS_Forest *f = profile->forest;
+    size_t size = eps_forest_profile_size(profile);
+    if (cap < size) return 0;
+
+    uint8_t *p = put_u32(buf, EPS_FOREST_PROFILE_MAGIC);
+    p = put_u16(p, EPS_FOREST_PROFILE_VERSION);
+    p = put_u16(p, EPS_FOREST_PROFILE_MAX_DEPTH);
+    p = put_u16(p, f->n_trees);
+    p = put_u16(p, f->n_nodes);
+    p = put_u16(p, f->n_features);
+    p = put_u16(p, 0);
+    p = put_u32(p, model_hash);
+    p = put_u32(p, f->n_trees ? profile->walks / f->n_trees : 0);
+
+    // branch, path_length and compares are contiguous in the caller storage
+    uint32_t words = EPS_FOREST_PROFILE_WORDS(f->n_trees, f->n_nodes, f->n_features);
+    for (uint32_t i = 0; i < words; i++) {
+        p = put_u32(p, profile->branch[i]);
+    }
+    put_u32(p, eps_crc32(0, buf, size - 4));
+    return size;
+}
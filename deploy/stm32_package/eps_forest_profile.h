@@ -0,0 +1,76 @@
+/**
+ * EPS Predictive FDIR - Forest Instrumentation
+ * Split and path statistics of the table walk, for layout and pruning work
+ *
+ * Build the forest runtime with -DEPS_FOREST_PROFILE and every
+ * eps_forest_tree() call on an attached model also records:
+ *   - per node: rows sent left and right (visits = left + right)
+ *   - per tree: histogram of path lengths (split nodes visited, 0..MAX_DEPTH)
+ *   - per feature: number of compares
+ * Without EPS_FOREST_PROFILE the hook is not compiled and nothing here is
+ * linked: zero overhead. Only the table walk is counted (node indices are
+ * the table layout); the other backends are not instrumented.
+ *
+ * Counters live in caller storage (EPS_FOREST_PROFILE_WORDS uint32 words)
+ * and are serialized to a compact little-endian record that
+ * eps_forest_export.py --profile reads back to order the node layout:
+ *
+ *   offset  size
+ *   0       4     magic "EPSP"
+ *   4       2     version
+ *   6       2     max_depth
+ *   8       2     n_trees
+ *   10      2     n_nodes
+ *   12      2     n_features
+ *   14      2     reserved (0)
+ *   16      4     model hash (eps_model_<m>_hash(), CRC-32 of the model blob)
+ *   20      4     rows (tree walks / n_trees)
+ *   24      4*2*n_nodes                 branch counts, left then right per node
+ *   ..      4*n_trees*(max_depth+1)     path length histogram, tree-major
+ *   ..      4*n_features                compares per feature
+ *   ..      4     CRC-32 of all preceding bytes
+ */
+
+#ifndef EPS_FOREST_PROFILE_H
+#define EPS_FOREST_PROFILE_H
+
+#include "eps_forest.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define EPS_FOREST_PROFILE_MAGIC      0x50535045u   // "EPSP"
+#define EPS_FOREST_PROFILE_VERSION    1
+#define EPS_FOREST_PROFILE_MAX_DEPTH  15            // Longer paths count in the last bin
+#define EPS_FOREST_PROFILE_MAX_MODELS 4             // Models attached at once
+#define EPS_FOREST_PROFILE_HEADER     24
+
+// Counter storage for a forest, in uint32_t words
+#define EPS_FOREST_PROFILE_WORDS(n_trees, n_nodes, n_features) \
+    (2u * (n_nodes) + (n_trees) * (EPS_FOREST_PROFILE_MAX_DEPTH + 1u) + (n_features))
+
+typedef struct {
+    const EPS_Forest *forest;
+    uint32_t walks;                // Trees walked (rows * n_trees)
+    uint32_t *branch;              // [2*n_nodes] rows sent left, right at each node
+    uint32_t *path_length;         // [n_trees * (MAX_DEPTH+1)] path length histogram
+    uint32_t *compares;            // [n_features]
+} EPS_ForestProfile;
+
+// Zero the counters in storage (EPS_FOREST_PROFILE_WORDS words) and attach
+// the profile: from now on walks of forest are counted.
+// Returns 0, or -1 when EPS_FOREST_PROFILE_MAX_MODELS are already attached.
+int eps_forest_profile_attach(EPS_ForestProfile *profile, const EPS_Forest *forest,
+                              uint32_t *storage);
+void eps_forest_profile_detach(EPS_ForestProfile *profile);
+
+// Hook called by eps_forest_tree() under EPS_FOREST_PROFILE: walks tree
+// once more and counts the path if forest is attached
+void eps_forest_profile_tree(const EPS_Forest *forest, uint16_t tree, const double *x);
+
+// Serialized record size, and serialization into buf (returns bytes
+// written, 0 if cap is too small)
+size_t eps_forest_profile_size(const EPS_ForestProfile *profile);
+size_t eps_forest_profile_serialize(const EPS_ForestProfile *profile, uint32_t model_hash,
+                                    uint8_t *buf, size_t cap);
+
+#endif // EPS_FOREST_PROFILE_H
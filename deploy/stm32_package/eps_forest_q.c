@@ -0,0 +1,57 @@
+/**
+ * Quantized forest evaluation
+ */
+
+#include "eps_forest_q.h"
+#include "eps_forest.h"
+#include <math.h>
+
+uint16_t eps_forest_q_code(const EPS_QFeature *quant, double x) {
+    uint16_t top = quant->n_buckets - 1;
+    if (!(x <= x)) {
+        return top + quant->n_splits;
+    }
+
+    double b = floor((x - quant->offset) * quant->inv_step);
+    uint16_t bucket = (b < 0.0) ? 0 : (b > top) ? top : (uint16_t)b;
+
+    // Split values below x (a handful per feature)
+    uint16_t lo = 0, hi = quant->n_splits;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (quant->split[mid] < x) lo = mid + 1;
+        else hi = mid;
+    }
+    return bucket + lo;
+}
+
+static int32_t q_sum(const EPS_ForestQ *forest, const uint16_t *xq) {
+    const uint8_t *feature = forest->feature;
+    const uint16_t *threshold = forest->threshold;
+    const int16_t *children = forest->children;
+
+    int32_t sum = 0;
+    for (uint16_t t = 0; t < forest->n_trees; t++) {
+        int16_t node = forest->roots[t];
+        while (!EPS_FOREST_IS_LEAF(node)) {
+            node = children[2 * node + (xq[feature[node]] > threshold[node])];
+        }
+        sum += forest->leaf_value[EPS_FOREST_LEAF(node)];
+    }
+    return sum;
+}
+
+double eps_forest_q_score(const EPS_ForestQ *forest, const double *x) {
+    uint16_t xq[EPS_Q_MAX_FEATURES];
+    for (uint16_t f = 0; f < forest->n_features; f++) {
+        xq[f] = eps_forest_q_code(&forest->quant[f], x[f]);
+    }
+    return (double)q_sum(forest, xq) * forest->leaf_scale;
+}
+
+void eps_forest_q_score_batch(const EPS_ForestQ *forest, const double *x, uint16_t stride,
+                              double *out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = eps_forest_q_score(forest, x + i * stride);
+    }
+}
@@ -0,0 +1,59 @@
+/**
+ * EPS Predictive FDIR - Quantized Forest Backend
+ * 16-bit threshold codes and int32 leaves with one global scale
+ *
+ * Each feature is quantized once per sample to a 16-bit code:
+ *   code = floor((x - offset) / step) + (number of split values < x)
+ * with a power-of-two step per feature. Node thresholds are stored as codes,
+ * so the tree walk compares integers. eps_forest_export.py chooses the
+ * steps and keeps a threshold as an exact split value wherever the recorded
+ * telemetry (the data/ workbooks) has samples on both sides of it inside one
+ * bucket, so every split decision on that telemetry matches the double
+ * model. Leaves are summed as integers and scaled once.
+ *
+ * Flash: 7 bytes per internal node + 4 bytes per leaf + 8 per split value
+ */
+
+#ifndef EPS_FOREST_Q_H
+#define EPS_FOREST_Q_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define EPS_Q_MAX_FEATURES 16
+
+typedef struct {
+    double offset;                 // x at the start of bucket 0
+    double inv_step;               // 1 / bucket width (power of two)
+    uint16_t n_buckets;
+    uint16_t n_splits;
+    const double *split;           // [n_splits] ascending exact split values
+} EPS_QFeature;
+
+typedef struct {
+    uint16_t n_features;
+    uint16_t n_trees;
+    uint16_t n_nodes;
+    uint16_t n_leaves;
+    double leaf_scale;             // prediction = sum of leaf_value * leaf_scale
+
+    const EPS_QFeature *quant;     // [n_features]
+    const int16_t *roots;          // [n_trees]  same encoding as EPS_Forest
+    const uint8_t *feature;        // [n_nodes]
+    const uint16_t *threshold;     // [n_nodes]  go left if code(x[feature]) <= threshold
+    const int16_t *children;       // [2*n_nodes]
+    const int32_t *leaf_value;     // [n_leaves] leaf / leaf_scale (per-tree share included)
+} EPS_ForestQ;
+
+// Quantize one feature value; NaN maps to the top code (right at every split)
+uint16_t eps_forest_q_code(const EPS_QFeature *quant, double x);
+
+double eps_forest_q_score(const EPS_ForestQ *forest, const double *x);
+void eps_forest_q_score_batch(const EPS_ForestQ *forest, const double *x, uint16_t stride,
+                              double *out, int n);
+
+// Generated models (deploy/c_code)
+extern const EPS_ForestQ eps_power_forest_q;
+extern const EPS_ForestQ eps_voltage_forest_q;
+
+#endif // EPS_FOREST_Q_H
@@ -0,0 +1,36 @@
+/**
+ * QuickScorer forest evaluation
+ */
+
+#include "eps_forest_qs.h"
+
+double eps_qs_score(const EPS_ForestQS *forest, const double *x) {
+    uint64_t leaves[EPS_QS_MAX_TREES];
+    for (uint16_t t = 0; t < forest->n_trees; t++) {
+        leaves[t] = ~(uint64_t)0;
+    }
+
+    // Thresholds are sorted, so stop at the first one the feature does not
+    // exceed. !(x <= t) keeps NaN on the right like the tree walk does.
+    for (uint16_t f = 0; f < forest->n_features; f++) {
+        double xf = x[f];
+        uint16_t end = forest->feature_offset[f + 1];
+        for (uint16_t k = forest->feature_offset[f]; k < end && !(xf <= forest->threshold[k]); k++) {
+            leaves[forest->tree[k]] &= forest->mask[k];
+        }
+    }
+
+    // Same tree order as eps_forest_score(), so results are bit-identical
+    double sum = forest->leaf_value[forest->leaf_offset[0] + __builtin_ctzll(leaves[0])];
+    for (uint16_t t = 1; t < forest->n_trees; t++) {
+        sum += forest->leaf_value[forest->leaf_offset[t] + __builtin_ctzll(leaves[t])];
+    }
+    return sum * forest->scale;
+}
+
+void eps_qs_score_batch(const EPS_ForestQS *forest, const double *x, uint16_t stride,
+                        double *out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = eps_qs_score(forest, x + i * stride);
+    }
+}
@@ -0,0 +1,43 @@
+/**
+ * EPS Predictive FDIR - QuickScorer Forest Backend
+ * Bitvector evaluation (Lucchese et al., SIGIR 2015), feature by feature
+ *
+ * Every split is visited once per feature in ascending threshold order;
+ * each false node (x > threshold) clears the leaves of its left subtree in
+ * a 64-bit mask per tree. The exit leaf is the lowest bit left set, so the
+ * data-dependent branches of tree walking disappear. Requires <= 64 leaves
+ * per tree (depth-6 pruned forests qualify).
+ *
+ * Flash: 18 bytes per internal node, shares leaf values with EPS_Forest
+ */
+
+#ifndef EPS_FOREST_QS_H
+#define EPS_FOREST_QS_H
+
+#include <stdint.h>
+
+#define EPS_QS_MAX_TREES 64
+
+typedef struct {
+    uint16_t n_features;
+    uint16_t n_trees;
+    uint16_t n_nodes;
+    double scale;
+
+    const uint16_t *feature_offset;  // [n_features+1] threshold run of each feature
+    const double *threshold;         // [n_nodes] ascending within a feature
+    const uint16_t *tree;            // [n_nodes] owning tree
+    const uint64_t *mask;            // [n_nodes] AND-mask applied when x > threshold
+    const uint16_t *leaf_offset;     // [n_trees] first leaf of each tree
+    const double *leaf_value;        // leaves, left to right within each tree
+} EPS_ForestQS;
+
+double eps_qs_score(const EPS_ForestQS *forest, const double *x);
+void eps_qs_score_batch(const EPS_ForestQS *forest, const double *x, uint16_t stride,
+                        double *out, int n);
+
+// Generated models (deploy/c_code)
+extern const EPS_ForestQS eps_power_forest_qs;
+extern const EPS_ForestQS eps_voltage_forest_qs;
+
+#endif // EPS_FOREST_QS_H
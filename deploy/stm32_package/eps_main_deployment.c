@@ -10,29 +10,57 @@
  * Sampling: 5 seconds per cycle
  */
 
+#include "eps_model_config.h"
+#include "eps_panel_store.h"      // Lag history of all panels (SoA)
 #include "eps_protection_final.h"
+#include "eps_actuation.h"        // Deferred comparator/MOSFET settle steps
+#include "eps_acquisition.h"      // DMA scan of all panel ADC channels
 #include "eps_bias_corrector.h"   // Online fine-tuning
-#include "power_model.h"           // Generated C code from m2cgen (generic model)
+#include "eps_model_slots.h"      // A/B slots for uploaded models
+#include "eps_forest_multi.h"     // Multi-target P/V/I panel model (EPS_MULTI_TARGET)
+#include "eps_forest_anytime.h"   // Early-exit evaluation (EPS_ANYTIME)
+#include "power_model.h"          // Generated model API (eps_model_power_*)
+#include "voltage_model.h"        // Generated model API (eps_model_voltage_*)
 #include <stdio.h>
 #include <string.h>
 
-// Forward declarations for model inference functions
-extern double score(double* input);          // Power model (from power_model.c)
-extern double score_voltage(double* input);  // Voltage model (from voltage_model.c)
+// The feature rows built below must be what the generated models expect
+#if EPS_MODEL_POWER_N_FEATURES != POWER_N_FEATURES || EPS_MODEL_VOLTAGE_N_FEATURES != VOLTAGE_N_FEATURES
+#error "Generated models disagree with POWER_N_FEATURES/VOLTAGE_N_FEATURES; re-export or update the feature builders"
+#endif
+#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_FIXED
+#error "This loop runs the double models; FPU-less boards use eps_fixed_pipeline.c"
+#endif
+
+// With EPS_FOREST_BACKEND_FLOAT32 features, rows and predictions are float
+// (eps_feature_t) and the compiled-in models run eps_model_*_score_batch_f32().
+// Uploaded model blobs carry double tables, so that build has no A/B slots.
+#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_FLOAT32
+#define EPS_MODEL_UPLOAD 0
+#if defined(EPS_MULTI_TARGET) || defined(EPS_ANYTIME)
+#error "EPS_MULTI_TARGET and EPS_ANYTIME run the double forests"
+#endif
+#else
+#define EPS_MODEL_UPLOAD 1
+#endif
+
+
+// Define EPS_MULTI_TARGET to predict P, V and I with one multi-target forest
+// (deploy/c_code/panel_model.c, eps_forest_multi.c) instead of walking the
+// separate power and voltage forests. Requires a panel model exported with
+// eps_forest_export.py --multi-target.
+
+// Define EPS_ANYTIME to score each panel tree by tree and stop once the
+// remaining trees cannot flip a protection condition (eps_forest_anytime.c).
+// It walks the node tables, which eps_forest.h then keeps in the image next
+// to the selected backend's (eps_forest.c is linked for the blobs anyway).
+#if defined(EPS_ANYTIME) && defined(EPS_MULTI_TARGET)
+#error "EPS_ANYTIME works on the single-target power and voltage forests"
+#endif
 
-// ===== HARDWARE CONFIGURATION =====
-
-// ADC channels for voltage sensing (one per panel)
-#define ADC_CHANNELS_VOLTAGE {ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3, \
-                              ADC_CHANNEL_4, ADC_CHANNEL_5, ADC_CHANNEL_6, ADC_CHANNEL_7, \
-                              ADC_CHANNEL_8, ADC_CHANNEL_9, ADC_CHANNEL_10, ADC_CHANNEL_11, \
-                              ADC_CHANNEL_12}
 
-// ADC channels for current sensing (one per panel)
-#define ADC_CHANNELS_CURRENT {ADC_CHANNEL_13, ADC_CHANNEL_14, ADC_CHANNEL_15, ADC_CHANNEL_0, \
-                              ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3, ADC_CHANNEL_4, \
-                              ADC_CHANNEL_5, ADC_CHANNEL_6, ADC_CHANNEL_7, ADC_CHANNEL_8, \
-                              ADC_CHANNEL_9}
+// ===== HARDWARE CONFIGURATION =====
+// ADC channel maps of the voltage, current and drain-sense scans: eps_acquisition.c
 
 // ===== GLOBAL STATE =====
 
@@ -47,23 +75,42 @@ const float PANEL_V_NOMINAL[NUM_PANELS] = {
     17.5f, 17.5f, 17.5f, 17.5f, 17.5f, 17.5f         // Panels 7-12
 };
 
-// Feature buffers for each panel (lag windows)
+// Lag history of all panels, one lane per panel (eps_panel_store.c)
 // Power model needs: Power_lag1, Power_lag2, Power_lag3, Power_lag6, Power_lag12
 //                    Power_diff_lag1, ..., Power_diff_lag12 (10 features)
 // Voltage model needs: Volt_lag1, Volt_lag2, Volt_lag3, Volt_lag6, Volt_lag12 (5 features)
-
-#define POWER_LAG_SIZE 12
-#define VOLTAGE_LAG_SIZE 12
-
-typedef struct {
-    float power_history[POWER_LAG_SIZE + 1];   // +1 for current sample
-    float voltage_history[VOLTAGE_LAG_SIZE + 1];
-    uint8_t history_index;  // Circular buffer index
-    bool initialized;       // Need 12 samples before prediction
-    BiasCorrector bias_corrector;  // Online fine-tuning per panel
-} PanelFeatureBuffer_t;
-
-PanelFeatureBuffer_t panel_buffers[NUM_PANELS];
+#if NUM_PANELS > EPS_STORE_LANES
+#error "NUM_PANELS exceeds the panel store lanes (EPS_STORE_LANES)"
+#endif
+
+EPS_PanelStore feature_store;
+bool features_initialized;      // Need RING_BUFFER_HISTORY samples before prediction
+
+// Online fine-tuning per panel
+BiasCorrector panel_bias[NUM_PANELS];
+
+#if EPS_MODEL_UPLOAD
+// Active power/voltage models: compiled-in at boot, hot-swapped after upload
+EPS_ModelSlots power_slots;
+EPS_ModelSlots voltage_slots;
+
+// Shadow-evaluate uploads for 12 cycles (60 s) before swapping them in
+#define MODEL_SHADOW_CYCLES 12
+#endif
+
+#if defined(EPS_ANYTIME)
+// Tree order and bounds of the active models, rebuilt after a swap
+EPS_Anytime power_anytime;
+EPS_Anytime voltage_anytime;
+
+// An early exit returns an interval midpoint, not the score. The bias
+// corrector and shadow evaluation need exact scores, so every
+// BIAS_UPDATE_PERIOD cycles (and throughout the bias warmup) the forests
+// run without cuts and only those cycles update them
+#define BIAS_UPDATE_PERIOD 12
+#else
+#define BIAS_UPDATE_PERIOD 1
+#endif
 
 // ===== INITIALIZATION =====
 
@@ -71,210 +118,260 @@ void eps_main_init(void) {
     // Initialize protection system
     eps_protection_init();
     
+    // Initialize feature history (all panels)
+    eps_store_init(&feature_store);
+    features_initialized = false;
+    
     // Configure panel-specific parameters
     for (uint8_t i = 0; i < NUM_PANELS; i++) {
         eps_protection_init_panel(i, PANEL_P_NOMINAL[i], PANEL_V_NOMINAL[i]);
         
-        // Initialize feature buffers
-        memset(&panel_buffers[i], 0, sizeof(PanelFeatureBuffer_t));
-        panel_buffers[i].history_index = 0;
-        panel_buffers[i].initialized = false;
-        
         // Initialize bias corrector for online fine-tuning
-        // alpha=0.01 -> slow adaptation, warmup=50 samples = 250s
-        bias_init(&panel_buffers[i].bias_corrector, 0.01f, 50);
+        // alpha=0.01 per 5 s cycle -> slow adaptation, warmup=50 samples = 250s
+        // (alpha scaled by the update period keeps the same time constant)
+        bias_init(&panel_bias[i], 0.01f * BIAS_UPDATE_PERIOD, 50);
     }
     
-    // Initialize ADC
-    // HAL_ADC_Init(...);
+#if EPS_MODEL_UPLOAD
+    // Start on the compiled-in models; uploads go to the A/B slots
+    eps_slots_init(&power_slots, "power", POWER_N_FEATURES);
+    eps_slots_init(&voltage_slots, "voltage", VOLTAGE_N_FEATURES);
+#endif
+    
+    // Initialize ADC scan sequences (ADCs and DMA set up by MX_ADCx_Init)
+    eps_acq_init();
     
     log_event("EPS Main Loop Initialized - 13 panels ready");
 }
 
 // ===== ADC READING =====
 
-float read_panel_voltage(uint8_t panel_id) {
-    // Read voltage from ADC
+// Both read this cycle's scan frame (eps_acquisition.c), no conversion here
+
+float read_panel_voltage(const EPS_SampleFrame* frame, uint8_t panel_id) {
     // Scale: ADC (0-4095) -> Voltage (0-25V)
-    
-    // Example:
-    // uint32_t adc_val = HAL_ADC_GetValue(&hadc1);
-    // float voltage = (adc_val / 4095.0f) * 25.0f;
-    
-    // Placeholder for simulation
-    return PANEL_V_NOMINAL[panel_id];  // Replace with real ADC read
+    return eps_acq_voltage(frame, panel_id);
 }
 
-float read_panel_current(uint8_t panel_id) {
-    // Read current from ADC via shunt resistor
-    // Scale: ADC (0-4095) -> Current (0-2A)
-    
-    // Example:
-    // uint32_t adc_val = HAL_ADC_GetValue(&hadc2);
-    // float voltage_shunt = (adc_val / 4095.0f) * 3.3f;
-    // float current = voltage_shunt / R_shunt;  // R_shunt = 0.1 ohm
-    
-    // Placeholder for simulation
-    float nominal_current = PANEL_P_NOMINAL[panel_id] / PANEL_V_NOMINAL[panel_id];
-    return nominal_current;  // Replace with real ADC read
+float read_panel_current(const EPS_SampleFrame* frame, uint8_t panel_id) {
+    // Shunt amplifier, scale: ADC (0-4095) -> Current (0-2A)
+    return eps_acq_current(frame, panel_id);
 }
 
-// ===== FEATURE ENGINEERING =====
+// ===== MAIN LOOP =====
 
-void update_panel_history(uint8_t panel_id, float power, float voltage) {
-    PanelFeatureBuffer_t* buf = &panel_buffers[panel_id];
+void eps_main_loop_iteration(void) {
+    // This function is called every 5 seconds
     
-    // Store in circular buffer
-    buf->power_history[buf->history_index] = power;
-    buf->voltage_history[buf->history_index] = voltage;
+    // Per-cycle scratch: one feature row per panel that is ready to predict
+    float P_measured[NUM_PANELS];
+    float V_measured[NUM_PANELS];
+#if defined(EPS_MULTI_TARGET)
+    // Power and voltage features share one row (EPS_PANEL_FEATURES wide)
+    double panel_features[NUM_PANELS][EPS_PANEL_FEATURES];
+    double panel_predicted[NUM_PANELS][EPS_PANEL_OUTPUTS];
+    double* power_rows = &panel_features[0][0];
+    double* voltage_rows = &panel_features[0][EPS_PANEL_VOLTAGE_FEAT];
+    const uint16_t power_stride = EPS_PANEL_FEATURES;
+    const uint16_t voltage_stride = EPS_PANEL_FEATURES;
+#else
+    eps_feature_t power_features[NUM_PANELS][POWER_N_FEATURES];
+    eps_feature_t voltage_features[NUM_PANELS][VOLTAGE_N_FEATURES];
+    eps_feature_t* power_rows = &power_features[0][0];
+    eps_feature_t* voltage_rows = &voltage_features[0][0];
+    const uint16_t power_stride = POWER_N_FEATURES;
+    const uint16_t voltage_stride = VOLTAGE_N_FEATURES;
+#endif
+    eps_feature_t P_predicted_raw[NUM_PANELS];
+    eps_feature_t V_predicted_raw[NUM_PANELS];
+    uint8_t ready_panels[NUM_PANELS];
+#if EPS_MODEL_UPLOAD
+    float P_ready[NUM_PANELS];      // Measurements of the ready rows (shadow and anytime)
+    float V_ready[NUM_PANELS];
+#endif
+    int n_ready = 0;
     
-    buf->history_index = (buf->history_index + 1) % (POWER_LAG_SIZE + 1);
+    // ===== 0. COMPLETE DUE SETTLE STEPS =====
+    // Comparator/MOSFET settle steps (eps_actuation.h) that fell due since
+    // the last cycle. The idle wait in main() normally runs them within 1 ms;
+    // this keeps Layer 2 trips and re-enable checks working without it.
+    eps_actuation_tick(HAL_GetTick());
     
-    // Check if we have enough history (need 12 lags + current = 13 samples minimum)
-    static uint8_t sample_counts[NUM_PANELS] = {0};
-    if (!buf->initialized) {
-        sample_counts[panel_id]++;
-        if (sample_counts[panel_id] >= POWER_LAG_SIZE) {
-            buf->initialized = true;
-            log_event("Panel %d: Feature buffer initialized (%d samples)", 
-                     panel_id, POWER_LAG_SIZE);
-        }
+    // ===== 1. READ SENSORS =====
+    // One DMA scan of every voltage, current and drain-sense channel; the
+    // protection logic reads the drain voltages from the same frame
+    const EPS_SampleFrame* frame = eps_acq_scan(EPS_ACQ_TIMEOUT_MS);
+    if (!frame) {
+        log_event("ADC scan timeout, cycle skipped (Layer 1 still armed)");
+        return;
+    }
+    eps_feature_t P_sample[NUM_PANELS];
+    eps_feature_t V_sample[NUM_PANELS];
+    for (uint8_t panel_id = 0; panel_id < NUM_PANELS; panel_id++) {
+        float V = read_panel_voltage(frame, panel_id);
+        float I_measured = read_panel_current(frame, panel_id);
+        P_measured[panel_id] = V * I_measured;
+        V_measured[panel_id] = V;
+        P_sample[panel_id] = P_measured[panel_id];
+        V_sample[panel_id] = V;
     }
-}
-
-float get_lag_value(float* history, uint8_t current_idx, uint8_t lag, uint8_t buffer_size) {
-    // Get value from 'lag' timesteps ago
-    int idx = (int)current_idx - lag;
-    if (idx < 0) idx += buffer_size;
-    return history[idx];
-}
-
-bool build_power_features(uint8_t panel_id, double* features) {
-    // Build 10 features for power prediction:
-    // Power_lag1, Power_lag2, Power_lag3, Power_lag6, Power_lag12
-    // Power_diff_lag1, Power_diff_lag2, Power_diff_lag3, Power_diff_lag6, Power_diff_lag12
     
-    PanelFeatureBuffer_t* buf = &panel_buffers[panel_id];
-    if (!buf->initialized) return false;
+    // ===== 2. UPDATE HISTORY =====
+    // All panels in one push (first differences computed once here)
+    eps_store_push(&feature_store, P_sample, V_sample, NUM_PANELS);
     
-    uint8_t curr = buf->history_index;
-    uint8_t size = POWER_LAG_SIZE + 1;
+    // ===== 3. CHECK IF READY FOR PREDICTION =====
+    // Power_diff_lag12 needs 13 past samples + current; until then only collect
+    if (eps_store_ready(&feature_store)) {
+        if (!features_initialized) {
+            features_initialized = true;
+            log_event("Feature history initialized (%d samples, %d panels)",
+                     RING_BUFFER_HISTORY, NUM_PANELS);
+        }
+        
+        // ===== 4. BUILD FEATURES =====
+        // Whole 13x10 power and 13x5 voltage matrices, straight into the batch rows
+        eps_store_features(&feature_store, NUM_PANELS, power_rows, power_stride,
+                           voltage_rows, voltage_stride);
+        for (uint8_t panel_id = 0; panel_id < NUM_PANELS; panel_id++) {
+#if EPS_MODEL_UPLOAD
+            P_ready[n_ready] = P_measured[panel_id];
+            V_ready[n_ready] = V_measured[panel_id];
+#endif
+            ready_panels[n_ready++] = panel_id;
+        }
+    }
     
-    // Get lag values
-    float P_lag1 = get_lag_value(buf->power_history, curr, 1, size);
-    float P_lag2 = get_lag_value(buf->power_history, curr, 2, size);
-    float P_lag3 = get_lag_value(buf->power_history, curr, 3, size);
-    float P_lag6 = get_lag_value(buf->power_history, curr, 6, size);
-    float P_lag12 = get_lag_value(buf->power_history, curr, 12, size);
+    // ===== 5. RUN INFERENCE =====
+    // Generic model inference (same model for all panels), batched so every
+    // tree is walked once for all ready panels instead of once per panel.
+    // The active model is read once so a swap never splits a cycle.
+#if EPS_MODEL_UPLOAD
+    const EPS_Forest* power_model = eps_slots_active(&power_slots);
+    const EPS_Forest* voltage_model = eps_slots_active(&voltage_slots);
+#endif
     
-    // Compute derivatives (Power_diff = Power[t] - Power[t-1])
-    float P_lag0 = get_lag_value(buf->power_history, curr, 0, size);
-    float dP_lag1 = P_lag1 - P_lag2;
-    float dP_lag2 = P_lag2 - P_lag3;
-    float dP_lag3 = P_lag3 - get_lag_value(buf->power_history, curr, 4, size);
-    float dP_lag6 = P_lag6 - get_lag_value(buf->power_history, curr, 7, size);
-    float dP_lag12 = P_lag12 - get_lag_value(buf->power_history, curr, 13, size);
+    // Cycles whose predictions are exact and may update the bias / shadow
+    static uint32_t bias_cycle = 0;
+    bool exact_cycle = (bias_cycle % BIAS_UPDATE_PERIOD) == 0;
+    for (int row = 0; row < n_ready; row++) {
+        if (!bias_is_ready(&panel_bias[ready_panels[row]])) exact_cycle = true;
+    }
+    if (n_ready > 0) bias_cycle++;
     
-    // Fill feature array (order must match training!)
-    features[0] = P_lag1;
-    features[1] = P_lag2;
-    features[2] = P_lag3;
-    features[3] = P_lag6;
-    features[4] = P_lag12;
-    features[5] = dP_lag1;
-    features[6] = dP_lag2;
-    features[7] = dP_lag3;
-    features[8] = dP_lag6;
-    features[9] = dP_lag12;
+    uint32_t start_time = HAL_GetTick();
     
-    return true;
-}
-
-bool build_voltage_features(uint8_t panel_id, double* features) {
-    // Build 5 features for voltage prediction:
-    // Volt_lag1, Volt_lag2, Volt_lag3, Volt_lag6, Volt_lag12
+#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_FLOAT32
+    eps_model_power_score_batch_f32(power_features, P_predicted_raw, n_ready);
+    eps_model_voltage_score_batch_f32(voltage_features, V_predicted_raw, n_ready);
+#elif defined(EPS_MULTI_TARGET)
+    // One walk per tree yields P, V and I while both models are built in.
+    // An uploaded single-target model replaces its output, and the other
+    // output then comes from its compiled-in single-target model
+    bool panel_ran = !power_model && !voltage_model;
+    if (panel_ran) {
+        eps_forest_multi_score_batch(&eps_panel_forest_multi, &panel_features[0][0],
+                                     EPS_PANEL_FEATURES, &panel_predicted[0][0], n_ready);
+        for (int row = 0; row < n_ready; row++) {
+            P_predicted_raw[row] = panel_predicted[row][EPS_MULTI_POWER];
+            V_predicted_raw[row] = panel_predicted[row][EPS_MULTI_VOLTAGE];
+        }
+    } else {
+        if (power_model) {
+            eps_forest_score_batch(power_model, power_rows, power_stride, P_predicted_raw, n_ready);
+        } else {
+            for (int row = 0; row < n_ready; row++) {
+                P_predicted_raw[row] = eps_model_power_score(power_rows + row * power_stride);
+            }
+        }
+        if (voltage_model) {
+            eps_forest_score_batch(voltage_model, voltage_rows, voltage_stride, V_predicted_raw, n_ready);
+        } else {
+            for (int row = 0; row < n_ready; row++) {
+                V_predicted_raw[row] = eps_model_voltage_score(voltage_rows + row * voltage_stride);
+            }
+        }
+    }
+#elif defined(EPS_ANYTIME)
+    // Row by row: each panel stops once its power/voltage conditions are
+    // decided; the bias correction shifts the cuts into raw model units
+    const EPS_Forest* p_forest = power_model ? power_model : &eps_power_forest;
+    const EPS_Forest* v_forest = voltage_model ? voltage_model : &eps_voltage_forest;
+    bool p_anytime = (power_anytime.forest == p_forest) || eps_anytime_init(&power_anytime, p_forest) == 0;
+    bool v_anytime = (voltage_anytime.forest == v_forest) || eps_anytime_init(&voltage_anytime, v_forest) == 0;
+    for (int row = 0; row < n_ready; row++) {
+        uint8_t panel_id = ready_panels[row];
+        BiasCorrector* bc = &panel_bias[panel_id];
+        float cuts_f[3];
+        double cuts[3];
+        
+        uint8_t n_cuts = exact_cycle ? 0 : eps_protection_power_cuts(panel_id, P_ready[row], cuts_f);
+        for (uint8_t c = 0; c < n_cuts; c++) {
+            cuts[c] = cuts_f[c] - (bias_is_ready(bc) ? bc->bias_power : 0.0f);
+        }
+        P_predicted_raw[row] = p_anytime
+            ? eps_anytime_score(&power_anytime, power_rows + row * power_stride, cuts, n_cuts)
+            : eps_forest_score(p_forest, power_rows + row * power_stride);
+        
+        n_cuts = exact_cycle ? 0 : eps_protection_voltage_cuts(panel_id, V_ready[row], cuts_f);
+        for (uint8_t c = 0; c < n_cuts; c++) {
+            cuts[c] = cuts_f[c] - (bias_is_ready(bc) ? bc->bias_voltage : 0.0f);
+        }
+        V_predicted_raw[row] = v_anytime
+            ? eps_anytime_score(&voltage_anytime, voltage_rows + row * voltage_stride, cuts, n_cuts)
+            : eps_forest_score(v_forest, voltage_rows + row * voltage_stride);
+    }
+#else
+    if (power_model) {
+        eps_forest_score_batch(power_model, power_rows, power_stride, P_predicted_raw, n_ready);
+    } else {
+        eps_model_power_score_batch(power_features, P_predicted_raw, n_ready);
+    }
+    if (voltage_model) {
+        eps_forest_score_batch(voltage_model, voltage_rows, voltage_stride, V_predicted_raw, n_ready);
+    } else {
+        eps_model_voltage_score_batch(voltage_features, V_predicted_raw, n_ready);
+    }
+#endif
     
-    PanelFeatureBuffer_t* buf = &panel_buffers[panel_id];
-    if (!buf->initialized) return false;
+    uint32_t inference_time_us = (HAL_GetTick() - start_time) * 1000;
     
-    uint8_t curr = buf->history_index;
-    uint8_t size = VOLTAGE_LAG_SIZE + 1;
+#if EPS_MODEL_UPLOAD
+    // Uploaded candidates run on the same rows; they may swap in here,
+    // taking effect next cycle
+    if (exact_cycle) {
+        eps_slots_shadow(&power_slots, power_rows, power_stride, P_predicted_raw, P_ready, n_ready);
+        eps_slots_shadow(&voltage_slots, voltage_rows, voltage_stride, V_predicted_raw, V_ready, n_ready);
+    }
+#endif
     
-    features[0] = get_lag_value(buf->voltage_history, curr, 1, size);
-    features[1] = get_lag_value(buf->voltage_history, curr, 2, size);
-    features[2] = get_lag_value(buf->voltage_history, curr, 3, size);
-    features[3] = get_lag_value(buf->voltage_history, curr, 6, size);
-    features[4] = get_lag_value(buf->voltage_history, curr, 12, size);
+    // Apply online bias correction (per-panel fine-tuning)
+    float P_predicted[NUM_PANELS];
+    float V_predicted[NUM_PANELS];
+    for (int row = 0; row < n_ready; row++) {
+        uint8_t panel_id = ready_panels[row];
+        P_predicted[panel_id] = (float)P_predicted_raw[row];
+        V_predicted[panel_id] = (float)V_predicted_raw[row];
+        bias_correct(&panel_bias[panel_id], &P_predicted[panel_id], &V_predicted[panel_id]);
+    }
     
-    return true;
-}
-
-// ===== MODEL INFERENCE =====
-
-// Generic RandomForest model (trained on NEPALISAT, deployed to all panels)
-// Online bias correction handles per-panel adaptation
-
-float predict_power(uint8_t panel_id, double* features) {
-    // Call generated C inference function (generic model)
-    return (float)score(features);  // From power_model.c (m2cgen generated)
-}
-
-float predict_voltage(uint8_t panel_id, double* features) {
-    // Call generated C inference function (generic model)
-    return (float)score_voltage(features);  // From voltage_model.c (m2cgen generated)
-}
-
-// ===== MAIN LOOP =====
-
-void eps_main_loop_iteration(void) {
-    // This function is called every 5 seconds
+    // ===== 6. RUN PROTECTION LOGIC =====
+    // The feature store readies all panels at once, so the whole array goes
+    // through the condition masks in one call
+    if (n_ready == NUM_PANELS) {
+        eps_protection_update_all(P_measured, V_measured, P_predicted, V_predicted, NUM_PANELS);
+    }
     
-    for (uint8_t panel_id = 0; panel_id < NUM_PANELS; panel_id++) {
-        
-        // ===== 1. READ SENSORS =====
-        float V_measured = read_panel_voltage(panel_id);
-        float I_measured = read_panel_current(panel_id);
-        float P_measured = V_measured * I_measured;
-        
-        // ===== 2. UPDATE HISTORY =====
-        update_panel_history(panel_id, P_measured, V_measured);
-        
-        // ===== 3. CHECK IF READY FOR PREDICTION =====
-        if (!panel_buffers[panel_id].initialized) {
-            // Still collecting initial samples
-            continue;
-        }
-        
-        // ===== 4. BUILD FEATURES =====
-        double power_features[10];
-        double voltage_features[5];
-        
-        if (!build_power_features(panel_id, power_features)) continue;
-        if (!build_voltage_features(panel_id, voltage_features)) continue;
-        
-        // ===== 5. RUN INFERENCE =====
-        uint32_t start_time = HAL_GetTick();
-        
-        // Generic model inference (same model for all panels)
-        float P_predicted_raw = predict_power(panel_id, power_features);
-        float V_predicted_raw = predict_voltage(panel_id, voltage_features);
-        
-        // Apply online bias correction (per-panel fine-tuning)
-        float P_predicted = P_predicted_raw;
-        float V_predicted = V_predicted_raw;
-        BiasCorrector* bc = &panel_buffers[panel_id].bias_corrector;
-        bias_correct(bc, &P_predicted, &V_predicted);
-        
-        uint32_t inference_time_us = (HAL_GetTick() - start_time) * 1000;
-        
-        // ===== 6. RUN PROTECTION LOGIC =====
-        eps_protection_update(panel_id, P_measured, V_measured, 
-                            P_predicted, V_predicted);
+    for (int row = 0; row < n_ready; row++) {
+        uint8_t panel_id = ready_panels[row];
+        BiasCorrector* bc = &panel_bias[panel_id];
         
         // ===== 7. UPDATE BIAS CORRECTOR (online learning) =====
         // Use actual measurements to fine-tune predictions for this panel
-        bias_update(bc, P_measured, P_predicted_raw, 
-                   V_measured, V_predicted_raw);
+        if (exact_cycle) {
+            bias_update(bc, P_measured[panel_id], (float)P_predicted_raw[row], 
+                       V_measured[panel_id], (float)V_predicted_raw[row]);
+        }
         
         // ===== 8. PERIODIC LOGGING (every 60 seconds = 12 iterations) =====
         static uint8_t log_counter = 0;
@@ -283,11 +380,16 @@ void eps_main_loop_iteration(void) {
             float bias_v = bc->bias_voltage;
             bool adapted = bias_is_ready(bc);
             
-            log_event("Panel %d: P=%.2fW (pred %.2fW, bias %.3fW%s), V=%.2fV (pred %.2fV, bias %.3fV%s), infer=%luμs",
+            log_event("Panel %d: P=%.2fW (pred %.2fW, bias %.3fW%s), V=%.2fV (pred %.2fV, bias %.3fV%s), infer=%luμs (%d panels)",
                      panel_id, 
-                     P_measured, P_predicted, bias_p, adapted ? " ✓" : "",
-                     V_measured, V_predicted, bias_v, adapted ? " ✓" : "",
-                     inference_time_us);
+                     P_measured[panel_id], P_predicted[panel_id], bias_p, adapted ? " ✓" : "",
+                     V_measured[panel_id], V_predicted[panel_id], bias_v, adapted ? " ✓" : "",
+                     inference_time_us, n_ready);
+#if defined(EPS_MULTI_TARGET)
+            if (panel_ran) {
+                log_event("Panel %d: I pred %.3fmA", panel_id, panel_predicted[row][EPS_MULTI_CURRENT]);
+            }
+#endif
         }
     }
     
@@ -297,6 +399,9 @@ void eps_main_loop_iteration(void) {
 
 // ===== ENTRY POINT =====
 
+// Host checks (EPS_HOST_CHECK) drive eps_main_loop_iteration() themselves.
+// With EPS_SIMULATION the loop returns after one iteration.
+#if !defined(EPS_HOST_CHECK)
 int main(void) {
     // HAL initialization
     // HAL_Init();
@@ -312,17 +417,26 @@ int main(void) {
     
     // Main loop (5-second sampling)
     while (1) {
+        uint32_t cycle_start = HAL_GetTick();
         eps_main_loop_iteration();
         
-        // Wait 5 seconds
-        // HAL_Delay(5000);
-        
+#if defined(EPS_SIMULATION)
         // For simulation, break after one iteration
+        (void)cycle_start;
         break;
+#else
+        // Wait 5 seconds, completing comparator/MOSFET settle steps as they
+        // fall due (eps_actuation.h)
+        while (HAL_GetTick() - cycle_start < 5000) {
+            eps_actuation_tick(HAL_GetTick());
+            __WFI();                    // SysTick wakes the core every 1 ms
+        }
+#endif
     }
     
     return 0;
 }
+#endif // !EPS_HOST_CHECK
 
 // ===== COMMAND INTERFACE =====
 
@@ -332,6 +446,25 @@ void handle_ground_command(uint8_t panel_id, const char* command) {
         process_ground_command(panel_id, CMD_REENABLE);
         log_event("Ground command: RE-ENABLE panel %d", panel_id);
     }
+    else if (strcmp(command, "MODEL_STATUS") == 0) {
+        log_event("Compiled-in models: power %08lX, voltage %08lX (model ABI v%d)",
+                 (unsigned long)eps_model_power_hash(), (unsigned long)eps_model_voltage_hash(),
+                 EPS_MODEL_ABI_VERSION);
+#if EPS_MODEL_UPLOAD
+        eps_slots_report(&power_slots);
+        eps_slots_report(&voltage_slots);
+#endif
+#if defined(EPS_ANYTIME)
+        eps_anytime_report(&power_anytime, "power");
+        eps_anytime_report(&voltage_anytime, "voltage");
+#endif
+    }
+#if EPS_MODEL_UPLOAD
+    else if (strcmp(command, "MODEL_REVERT") == 0) {
+        eps_slots_revert(&power_slots);
+        eps_slots_revert(&voltage_slots);
+    }
+#endif
     else if (strcmp(command, "STATUS") == 0) {
         uint32_t enable_count, trip_count, false_alarm_count;
         get_panel_statistics(panel_id, &enable_count, &trip_count, &false_alarm_count);
@@ -343,3 +476,56 @@ void handle_ground_command(uint8_t panel_id, const char* command) {
         log_event("Unknown command: %s", command);
     }
 }
+
+#if EPS_MODEL_UPLOAD
+static const uint32_t SLOT_ADDR[2][EPS_SLOT_COUNT] = {
+    {EPS_SLOT_POWER_A_ADDR, EPS_SLOT_POWER_B_ADDR},
+    {EPS_SLOT_VOLTAGE_A_ADDR, EPS_SLOT_VOLTAGE_B_ADDR}
+};
+#endif
+
+// Model upload, step 1: before erasing the slot's flash region the comms
+// stack asks for the slot (model 0 = power, 1 = voltage). Returns false if
+// it must not be written: the live slot, or while a candidate is shadowing.
+bool handle_model_upload_begin(uint8_t model, uint8_t slot) {
+#if !EPS_MODEL_UPLOAD
+    log_event("Model upload: not supported in the single-precision build (model %d, slot %d)",
+             model, slot);
+    return false;
+#else
+    if (model > 1) {
+        log_event("Model upload: bad request (model %d, slot %d)", model, slot);
+        return false;
+    }
+    
+    EPS_ModelSlots* slots = (model == 0) ? &power_slots : &voltage_slots;
+    if (eps_slots_claim(slots, slot) != SLOTS_OK) {
+        log_event("Model upload: %s slot %d refused (live or shadow in progress)",
+                 slots->name, slot);
+        return false;
+    }
+    return true;
+#endif
+}
+
+// Model upload, step 2: the comms stack has written the blob to the claimed
+// slot's flash region; validate it and start shadowing
+void handle_model_upload(uint8_t model, uint8_t slot, uint32_t size, uint32_t crc) {
+#if !EPS_MODEL_UPLOAD
+    (void)crc;
+    log_event("Model upload: not supported in the single-precision build (model %d, slot %d, %lu bytes)",
+             model, slot, size);
+#else
+    if (model > 1 || slot >= EPS_SLOT_COUNT || size > EPS_SLOT_REGION_SIZE) {
+        log_event("Model upload: bad request (model %d, slot %d, %lu bytes)", model, slot, size);
+        return;
+    }
+    
+    EPS_ModelSlots* slots = (model == 0) ? &power_slots : &voltage_slots;
+    EPS_SlotStatus status = eps_slots_load(slots, slot, (const void*)(uintptr_t)SLOT_ADDR[model][slot],
+                                           size, crc, MODEL_SHADOW_CYCLES);
+    if (status != SLOTS_OK) {
+        log_event("Model upload: %s slot %d not loaded (status %d)", slots->name, slot, status);
+    }
+#endif
+}
@@ -17,10 +17,8 @@
 #include "eps_model_config.h"
 #include "eps_bias_corrector.h"
 #include "eps_p2_quantile.h"
-
-// External model functions (from generated C code)
-extern double predict_power(double *features);
-extern double predict_voltage(double *features);
+#include "power_model.h"      // Generated model API (eps_model_abi.h)
+#include "voltage_model.h"
 
 // Logic block state machine
 typedef struct {
@@ -71,17 +69,26 @@ void eps_fdir_step(float power_reading, float voltage_reading) {
     
     // ===== 1. UPDATE RING BUFFERS =====
     eps_update_buffers(&buffers, power_reading, voltage_reading);
+    if (!eps_features_ready(&buffers)) {
+        return;     // Still filling the lag history
+    }
     
     // ===== 2. EXTRACT FEATURES =====
-    double power_features[POWER_N_FEATURES];
-    double voltage_features[VOLTAGE_N_FEATURES];
+    eps_feature_t power_features[POWER_N_FEATURES];
+    eps_feature_t voltage_features[VOLTAGE_N_FEATURES];
     
     eps_extract_power_features(&buffers, power_features);
     eps_extract_voltage_features(&buffers, voltage_features);
     
     // ===== 3. PREDICT (RAW MODEL OUTPUT) =====
-    float y_pred_power = (float)predict_power(power_features);
-    float y_pred_voltage = (float)predict_voltage(voltage_features);
+#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_FLOAT32
+    // Single precision throughout: no double math on the Cortex-M4F FPU
+    float y_pred_power = eps_model_power_score_f32(power_features);
+    float y_pred_voltage = eps_model_voltage_score_f32(voltage_features);
+#else
+    float y_pred_power = (float)eps_model_power_score(power_features);
+    float y_pred_voltage = (float)eps_model_voltage_score(voltage_features);
+#endif
     
     // ===== 4. APPLY BIAS CORRECTION =====
     if (bias_is_ready(&bias_corrector)) {
@@ -0,0 +1,36 @@
+/**
+ * EPS Predictive FDIR - Generated Model ABI
+ * Contract of the header/source pair eps_forest_export.py writes per model
+ * (deploy/c_code/power_model.h + power_model.c, voltage_model.h + voltage_model.c)
+ *
+ * For model <m> (power, voltage), <m>_model.h provides:
+ *   EPS_MODEL_<M>_N_FEATURES   feature vector length
+ *   EPS_MODEL_<M>_HASH         CRC-32 of the model's .bin blob (same tables)
+ *   EPS_MODEL_<M>_ABI          ABI version the pair was generated for
+ *
+ *   double   eps_model_<m>_score(const double *x);
+ *   void     eps_model_<m>_score_batch(const double x[][EPS_MODEL_<M>_N_FEATURES],
+ *                                      double *out, int n);
+ *   uint16_t eps_model_<m>_n_features(void);
+ *   uint32_t eps_model_<m>_hash(void);
+ *
+ * The score functions run whichever EPS_FOREST_BACKEND is built. With
+ * EPS_FOREST_BACKEND_FIXED they are replaced by
+ *   int64_t  eps_model_<m>_score_fixed(const int64_t *x);
+ * and with EPS_FOREST_BACKEND_FLOAT32 by
+ *   float    eps_model_<m>_score_f32(const float *x);
+ *   void     eps_model_<m>_score_batch_f32(const float x[][EPS_MODEL_<M>_N_FEATURES],
+ *                                          float *out, int n);
+ *
+ * The batch rows are typed with the feature count, so a caller whose feature
+ * rows have a different width gets a compile-time diagnostic.
+ */
+
+#ifndef EPS_MODEL_ABI_H
+#define EPS_MODEL_ABI_H
+
+// Bump with MODEL_ABI_VERSION in eps_forest_export.py when a signature or
+// its meaning changes; headers generated for another version do not compile
+#define EPS_MODEL_ABI_VERSION  1
+
+#endif // EPS_MODEL_ABI_H
@@ -9,34 +9,69 @@
 #ifndef EPS_MODEL_CONFIG_H
 #define EPS_MODEL_CONFIG_H
 
+#include "eps_feature_spec.h"
+#include "eps_forest.h"
+#include "eps_rolling.h"
+#include <stdbool.h>
 #include <stdint.h>
 
-// Model configuration
-#define POWER_N_FEATURES  10
-#define VOLTAGE_N_FEATURES 5
-#define N_LAG_STEPS 5  // lags: 1,2,3,6,12
+// Model configuration: inputs are defined in deploy/models/feature_spec.json
+// and compiled by eps_forest_export.py into eps_feature_spec.h
+#define POWER_N_FEATURES   EPS_SPEC_POWER_N_FEATURES
+#define VOLTAGE_N_FEATURES EPS_SPEC_VOLTAGE_N_FEATURES
 
-// Feature names (for reference)
-// Power features: Power_lag1, Power_lag2, Power_lag3, Power_lag6, Power_lag12, Power_diff_lag1, Power_diff_lag2, Power_diff_lag3, Power_diff_lag6, Power_diff_lag12
-// Voltage features: Volt_lag1, Volt_lag2, Volt_lag3, Volt_lag6, Volt_lag12
+// Ring buffers: power of two > EPS_SPEC_MAX_AGE so lags are masked loads
+// (Power_diff_lag12 reads P[t-14]); RING_BUFFER_HISTORY samples fill the
+// first feature row (more than the ring when a rolling window is longer)
+#define RING_BUFFER_SIZE EPS_SPEC_RING
+#define RING_BUFFER_MASK (RING_BUFFER_SIZE - 1)
+#define RING_BUFFER_HISTORY (EPS_SPEC_HISTORY + 1)
 
-// Ring buffer sizes (max lag is 12)
-#define RING_BUFFER_SIZE 13
+#if EPS_SPEC_MAX_WINDOW > EPS_ROLLING_MAX_WINDOW
+#error "feature spec rolling window exceeds EPS_ROLLING_MAX_WINDOW"
+#endif
 
-// Prediction functions (implemented in generated C files)
-double predict_power(double *features);
-double predict_voltage(double *features);
+// Prediction functions: eps_model_power_score() / eps_model_voltage_score(),
+// declared in the generated deploy/c_code/power_model.h and voltage_model.h
+// (eps_model_abi.h)
 
-// Feature extraction helpers
+// Feature values: float end to end with EPS_FOREST_BACKEND_FLOAT32 (the
+// single-precision FPU of the Cortex-M4F, eps_model_*_score_f32()), double
+// otherwise. Rolling windows keep double sums either way.
+#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_FLOAT32
+typedef float eps_feature_t;
+#else
+typedef double eps_feature_t;
+#endif
+
+// Incremental lag features for the newest sample t, which the models predict
+// (EPS_SPEC_*_FEATURES): a LAG feature at age a is s[t-a], a DIFF feature
+// s[t-a] - s[t-a-1]. First differences are stored once per sample next to
+// the signal ring, so a feature row is one masked load per feature. Rolling
+// statistics (STAT features) are kept the same way: each rolling window is
+// updated in O(1) per sample and its statistics stored in their own rings.
 typedef struct {
-    double power_buffer[RING_BUFFER_SIZE];
-    double voltage_buffer[RING_BUFFER_SIZE];
-    uint8_t buffer_index;
+    eps_feature_t power_buffer[RING_BUFFER_SIZE];
+    eps_feature_t voltage_buffer[RING_BUFFER_SIZE];
+#if EPS_SPEC_POWER_DIFF
+    eps_feature_t power_diff[RING_BUFFER_SIZE];     // P[i] - P[i-1] at the slot of P[i]
+#endif
+#if EPS_SPEC_VOLTAGE_DIFF
+    eps_feature_t voltage_diff[RING_BUFFER_SIZE];   // V[i] - V[i-1] at the slot of V[i]
+#endif
+#if EPS_SPEC_N_STATS
+    EPS_Rolling rolling[EPS_SPEC_N_ROLLING];
+    eps_feature_t stat[EPS_SPEC_N_STATS][RING_BUFFER_SIZE];  // Statistic of the window ending at i
+#endif
+    uint8_t buffer_index;                           // Newest sample
+    uint16_t n_samples;                             // Saturates at RING_BUFFER_HISTORY
 } EPS_FeatureBuffers;
 
 void eps_init_buffers(EPS_FeatureBuffers *buffers);
-void eps_update_buffers(EPS_FeatureBuffers *buffers, double power, double voltage);
-void eps_extract_power_features(EPS_FeatureBuffers *buffers, double *features_out);
-void eps_extract_voltage_features(EPS_FeatureBuffers *buffers, double *features_out);
+void eps_update_buffers(EPS_FeatureBuffers *buffers, eps_feature_t power, eps_feature_t voltage);
+// True once RING_BUFFER_HISTORY samples are held (features are defined)
+bool eps_features_ready(const EPS_FeatureBuffers *buffers);
+void eps_extract_power_features(const EPS_FeatureBuffers *buffers, eps_feature_t *features_out);
+void eps_extract_voltage_features(const EPS_FeatureBuffers *buffers, eps_feature_t *features_out);
 
 #endif // EPS_MODEL_CONFIG_H
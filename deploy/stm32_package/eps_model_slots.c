@@ -0,0 +1,207 @@
+/**
+ * A/B model slot management and shadow evaluation
+ */
+
+#include "eps_model_slots.h"
+#include "eps_protection_final.h"   // log_event
+#include <math.h>
+#include <string.h>
+
+// Shadow rows scored per eps_forest_score_batch() call (stack scratch)
+#define SHADOW_CHUNK 16
+
+static void reset_window(EPS_ModelSlots *slots, uint16_t target) {
+    slots->live_abs_err = 0.0;
+    slots->shadow_abs_err = 0.0;
+    slots->shadow_rows = 0;
+    slots->telemetry.shadow_cycles = 0;
+    slots->telemetry.shadow_target = target;
+    slots->telemetry.shadow_us = 0;
+    slots->telemetry.shadow_us_max = 0;
+    slots->telemetry.live_mae = 0.0f;
+    slots->telemetry.shadow_mae = 0.0f;
+    slots->telemetry.max_abs_diff = 0.0f;
+}
+
+void eps_slots_init(EPS_ModelSlots *slots, const char *name, uint16_t n_features) {
+    memset(slots, 0, sizeof(EPS_ModelSlots));
+    slots->name = name;
+    slots->n_features = n_features;
+    slots->active = NULL;
+    slots->live = EPS_SLOT_BUILTIN;
+    slots->shadow = EPS_SLOT_NONE;
+    slots->telemetry.last_blob_status = BLOB_OK;
+
+    eps_cycle_clock_enable();   // Swap/shadow telemetry
+}
+
+EPS_SlotStatus eps_slots_claim(EPS_ModelSlots *slots, uint8_t slot) {
+    // One candidate at a time, and never overwrite the live slot
+    if (slot >= EPS_SLOT_COUNT || slot == slots->live || slots->shadow != EPS_SLOT_NONE) {
+        return SLOTS_ERR_SLOT;
+    }
+
+    slots->slot[slot].state = SLOT_CLAIMED;
+    return SLOTS_OK;
+}
+
+EPS_SlotStatus eps_slots_load(EPS_ModelSlots *slots, uint8_t slot, const void *blob, size_t size,
+                              uint32_t expected_crc, uint16_t shadow_cycles) {
+    // Only a slot claimed before its flash was written (so neither live nor
+    // shadowing while it was), and one candidate at a time
+    if (slot >= EPS_SLOT_COUNT || slots->slot[slot].state != SLOT_CLAIMED ||
+        slots->shadow != EPS_SLOT_NONE) {
+        return SLOTS_ERR_SLOT;
+    }
+
+    EPS_ModelSlot *s = &slots->slot[slot];
+    s->state = SLOT_EMPTY;
+    EPS_BlobStatus status = eps_forest_blob_bind(blob, size, &s->forest);
+    slots->telemetry.last_blob_status = status;
+    if (status != BLOB_OK) {
+        log_event("Model %s: slot %c rejected (%s)", slots->name, 'A' + slot,
+                 eps_blob_status_to_string(status));
+        return SLOTS_ERR_BLOB;
+    }
+
+    s->crc32 = ((const EPS_ForestBlobHeader *)blob)->crc32;
+    if (s->crc32 != expected_crc) {
+        log_event("Model %s: slot %c CRC 0x%08lX, expected 0x%08lX", slots->name, 'A' + slot,
+                 (unsigned long)s->crc32, (unsigned long)expected_crc);
+        return SLOTS_ERR_CRC;
+    }
+    if (s->forest.n_features != slots->n_features) {
+        log_event("Model %s: slot %c has %u features, expected %u", slots->name, 'A' + slot,
+                 s->forest.n_features, slots->n_features);
+        return SLOTS_ERR_FEATURES;
+    }
+
+    reset_window(slots, shadow_cycles);
+    s->state = SLOT_SHADOW;
+    slots->shadow = slot;   // Published last: the main loop starts shadowing next cycle
+
+    log_event("Model %s: slot %c loaded (%u trees, CRC 0x%08lX), shadowing %u cycles",
+             slots->name, 'A' + slot, s->forest.n_trees, (unsigned long)s->crc32, shadow_cycles);
+    return SLOTS_OK;
+}
+
+static void slots_swap(EPS_ModelSlots *slots) {
+    uint32_t start = EPS_CLOCK();
+
+    uint8_t next = slots->shadow;
+    slots->slot[next].state = SLOT_LIVE;
+    slots->active = &slots->slot[next].forest;   // The swap: one aligned pointer write
+    if (slots->live != EPS_SLOT_BUILTIN) {
+        slots->slot[slots->live].state = SLOT_EMPTY;   // Free for the next upload
+    }
+    slots->live = next;
+    slots->shadow = EPS_SLOT_NONE;
+
+    slots->telemetry.swap_us = EPS_ELAPSED_US(start);
+    slots->telemetry.swap_count++;
+
+    log_event("Model %s: slot %c LIVE (swap %luus, MAE %.4f vs %.4f, shadow %luus/cycle max)",
+             slots->name, 'A' + next, (unsigned long)slots->telemetry.swap_us,
+             slots->telemetry.shadow_mae, slots->telemetry.live_mae,
+             (unsigned long)slots->telemetry.shadow_us_max);
+}
+
+static void slots_reject(EPS_ModelSlots *slots, const char *reason) {
+    slots->slot[slots->shadow].state = SLOT_REJECTED;
+    log_event("Model %s: slot %c REJECTED after %u cycles (%s, MAE %.4f vs %.4f)",
+             slots->name, 'A' + slots->shadow, slots->telemetry.shadow_cycles, reason,
+             slots->telemetry.shadow_mae, slots->telemetry.live_mae);
+    slots->shadow = EPS_SLOT_NONE;
+    slots->telemetry.reject_count++;
+}
+
+void eps_slots_shadow(EPS_ModelSlots *slots, const double *x, uint16_t stride,
+                      const double *live_out, const float *measured, int n) {
+    if (slots->shadow == EPS_SLOT_NONE) return;
+
+    const EPS_Forest *candidate = &slots->slot[slots->shadow].forest;
+    EPS_SlotTelemetry *tm = &slots->telemetry;
+    uint32_t start = EPS_CLOCK();
+
+    double out[SHADOW_CHUNK];
+    bool finite = true;
+    for (int i = 0; i < n; i += SHADOW_CHUNK) {
+        int len = (n - i < SHADOW_CHUNK) ? n - i : SHADOW_CHUNK;
+        eps_forest_score_batch(candidate, x + i * stride, stride, out, len);
+
+        for (int j = 0; j < len; j++) {
+            if (!isfinite(out[j])) finite = false;
+            float diff = (float)fabs(out[j] - live_out[i + j]);
+            if (diff > tm->max_abs_diff) tm->max_abs_diff = diff;
+            if (measured) {
+                slots->live_abs_err += fabs(measured[i + j] - live_out[i + j]);
+                slots->shadow_abs_err += fabs(measured[i + j] - out[j]);
+            }
+        }
+    }
+    slots->shadow_rows += n;
+
+    tm->shadow_us = EPS_ELAPSED_US(start);
+    if (tm->shadow_us > tm->shadow_us_max) tm->shadow_us_max = tm->shadow_us;
+    if (slots->shadow_rows > 0) {
+        tm->live_mae = (float)(slots->live_abs_err / slots->shadow_rows);
+        tm->shadow_mae = (float)(slots->shadow_abs_err / slots->shadow_rows);
+    }
+
+    if (!finite) {
+        slots_reject(slots, "non-finite prediction");
+        return;
+    }
+    if (++tm->shadow_cycles < tm->shadow_target) return;
+
+    // Window complete: swap unless the candidate tracks measurements worse
+    if (measured && tm->shadow_mae > tm->live_mae * EPS_SHADOW_MAX_MAE_RATIO) {
+        slots_reject(slots, "residual worse than live");
+    } else {
+        slots_swap(slots);
+    }
+}
+
+void eps_slots_abort(EPS_ModelSlots *slots) {
+    if (slots->shadow == EPS_SLOT_NONE) return;
+    slots->slot[slots->shadow].state = SLOT_EMPTY;
+    log_event("Model %s: slot %c shadow aborted", slots->name, 'A' + slots->shadow);
+    slots->shadow = EPS_SLOT_NONE;
+}
+
+void eps_slots_revert(EPS_ModelSlots *slots) {
+    slots->active = NULL;
+    if (slots->live != EPS_SLOT_BUILTIN) {
+        slots->slot[slots->live].state = SLOT_EMPTY;
+    }
+    slots->live = EPS_SLOT_BUILTIN;
+    log_event("Model %s: reverted to built-in model", slots->name);
+}
+
+void eps_slots_report(const EPS_ModelSlots *slots) {
+    const EPS_SlotTelemetry *tm = &slots->telemetry;
+    log_event("Model %s: live=%s, A=%s, B=%s, swaps=%lu (last %luus), rejects=%lu",
+             slots->name,
+             (slots->live == EPS_SLOT_BUILTIN) ? "built-in" : (slots->live == 0 ? "A" : "B"),
+             eps_slot_state_to_string(slots->slot[0].state),
+             eps_slot_state_to_string(slots->slot[1].state),
+             (unsigned long)tm->swap_count, (unsigned long)tm->swap_us,
+             (unsigned long)tm->reject_count);
+    if (slots->shadow != EPS_SLOT_NONE) {
+        log_event("  shadow %u/%u cycles, %luus/cycle (max %luus), MAE %.4f vs live %.4f, max diff %.4f",
+                 tm->shadow_cycles, tm->shadow_target,
+                 (unsigned long)tm->shadow_us, (unsigned long)tm->shadow_us_max,
+                 tm->shadow_mae, tm->live_mae, tm->max_abs_diff);
+    }
+}
+
+const char* eps_slot_state_to_string(EPS_SlotState state) {
+    switch (state) {
+        case SLOT_EMPTY:    return "EMPTY";
+        case SLOT_SHADOW:   return "SHADOW";
+        case SLOT_LIVE:     return "LIVE";
+        case SLOT_REJECTED: return "REJECTED";
+        case SLOT_CLAIMED:  return "CLAIMED";
+        default:            return "UNKNOWN";
+    }
+}
@@ -0,0 +1,135 @@
+/**
+ * EPS Predictive FDIR - A/B Model Slots
+ * Hot-swap of ground-uploaded forests without reboot
+ *
+ * Each model (power, voltage) has two flash slots holding binary blobs
+ * (eps_forest_blob.h) and an active pointer that the main loop reads once
+ * per cycle. The uploader claims the free slot before it erases that flash
+ * region (eps_slots_claim), and the blob written there is CRC-validated,
+ * shadow-evaluated on the same feature rows as the live model for N
+ * cycles, and then swapped in with a single pointer write (atomic on
+ * Cortex-M). The compiled-in model (NULL active pointer, scored through the
+ * generated eps_model_*_score_batch() with whichever EPS_FOREST_BACKEND is built) is
+ * the fallback and the boot default.
+ *
+ * RAM: ~120 bytes per model
+ */
+
+#ifndef EPS_MODEL_SLOTS_H
+#define EPS_MODEL_SLOTS_H
+
+#include "eps_forest.h"
+#include "eps_cycle_clock.h"
+#include "eps_forest_blob.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define EPS_SLOT_COUNT    2
+#define EPS_SLOT_BUILTIN  0xFF   // Compiled-in model (deploy/c_code)
+#define EPS_SLOT_NONE     0xFF
+
+// Flash regions reserved for uploaded blobs (STM32F4 1 MB: sectors 8-11, 128 KB each)
+#ifndef EPS_SLOT_POWER_A_ADDR
+#define EPS_SLOT_POWER_A_ADDR    0x08080000u
+#define EPS_SLOT_POWER_B_ADDR    0x080A0000u
+#define EPS_SLOT_VOLTAGE_A_ADDR  0x080C0000u
+#define EPS_SLOT_VOLTAGE_B_ADDR  0x080E0000u
+#define EPS_SLOT_REGION_SIZE     (128u * 1024u)
+#endif
+
+// Candidate is rejected if its mean |residual| over the shadow window
+// exceeds the live model's by more than this factor
+#define EPS_SHADOW_MAX_MAE_RATIO 1.10f
+
+typedef enum {
+    SLOT_EMPTY = 0,
+    SLOT_SHADOW = 1,       // Validated, evaluated alongside the live model
+    SLOT_LIVE = 2,
+    SLOT_REJECTED = 3,     // Failed shadow evaluation, kept for inspection
+    SLOT_CLAIMED = 4       // Flash region being erased/written by an upload
+} EPS_SlotState;
+
+typedef enum {
+    SLOTS_OK = 0,
+    SLOTS_ERR_SLOT = 1,        // Bad index, slot is live / shadowing, or not claimed
+    SLOTS_ERR_BLOB = 2,        // eps_forest_blob_bind() failed (see last_blob_status)
+    SLOTS_ERR_CRC = 3,         // Blob CRC differs from the one sent with the upload
+    SLOTS_ERR_FEATURES = 4     // Feature count differs from the live model
+} EPS_SlotStatus;
+
+typedef struct {
+    EPS_Forest forest;             // Points into the slot's flash region
+    EPS_SlotState state;
+    uint32_t crc32;
+} EPS_ModelSlot;
+
+// Reported through telemetry (eps_slots_report)
+typedef struct {
+    uint32_t swap_count;
+    uint32_t reject_count;
+    uint32_t swap_us;              // Last swap: decision + pointer write
+    uint32_t shadow_us;            // Last cycle's shadow inference time
+    uint32_t shadow_us_max;
+    uint16_t shadow_cycles;        // Cycles evaluated for the current candidate
+    uint16_t shadow_target;        // Cycles required before the swap
+    float live_mae;                // Mean |measured - prediction| over the window
+    float shadow_mae;
+    float max_abs_diff;            // Largest |shadow - live| seen
+    EPS_BlobStatus last_blob_status;
+} EPS_SlotTelemetry;
+
+typedef struct {
+    const char *name;
+    uint16_t n_features;           // Uploads must match the compiled-in model
+    const EPS_Forest *volatile active;   // Read once per cycle; NULL = compiled-in model
+    EPS_ModelSlot slot[EPS_SLOT_COUNT];
+    uint8_t live;                  // Slot index or EPS_SLOT_BUILTIN
+    uint8_t shadow;                // Slot index or EPS_SLOT_NONE
+
+    // Shadow window accumulators
+    double live_abs_err;
+    double shadow_abs_err;
+    uint32_t shadow_rows;
+
+    EPS_SlotTelemetry telemetry;
+} EPS_ModelSlots;
+
+void eps_slots_init(EPS_ModelSlots *slots, const char *name, uint16_t n_features);
+
+// Uploaded model the main loop should score with this cycle, or NULL for
+// the compiled-in one
+static inline const EPS_Forest* eps_slots_active(const EPS_ModelSlots *slots) {
+    return slots->active;
+}
+
+// Reserve a slot for an upload. Must succeed before the slot's flash region
+// is erased: refused for the live slot and while a candidate is shadowing,
+// since either may be scored from that region this cycle.
+EPS_SlotStatus eps_slots_claim(EPS_ModelSlots *slots, uint8_t slot);
+
+// Validate a blob written to a claimed slot's flash region and start
+// shadowing it for shadow_cycles cycles. expected_crc comes with the
+// upload command so a stale or wrong image is refused. On any error the
+// slot is left EMPTY and has to be claimed again.
+EPS_SlotStatus eps_slots_load(EPS_ModelSlots *slots, uint8_t slot, const void *blob, size_t size,
+                              uint32_t expected_crc, uint16_t shadow_cycles);
+
+// Call once per cycle after live inference on the same rows (row i at
+// x + i*stride). live_out are the raw live predictions, measured the
+// values they predict. Swaps or rejects the candidate when its window ends.
+void eps_slots_shadow(EPS_ModelSlots *slots, const double *x, uint16_t stride,
+                      const double *live_out, const float *measured, int n);
+
+// Drop the candidate under evaluation
+void eps_slots_abort(EPS_ModelSlots *slots);
+
+// Switch back to the compiled-in model (one pointer write)
+void eps_slots_revert(EPS_ModelSlots *slots);
+
+// Log slot states and telemetry
+void eps_slots_report(const EPS_ModelSlots *slots);
+
+const char* eps_slot_state_to_string(EPS_SlotState state);
+
+#endif // EPS_MODEL_SLOTS_H
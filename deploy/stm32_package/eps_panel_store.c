@@ -0,0 +1,59 @@
+/**
+ * Structure-of-arrays panel feature store
+ */
+
+#include "eps_panel_store.h"
+#include <string.h>
+
+#define ROLLING_INIT(k, signal, window) \
+    for (int p = 0; p < EPS_STORE_LANES; p++) eps_rolling_init(&store->rolling[k][p], window);
+#define ROLLING_PUSH(k, signal, window) \
+    for (int p = 0; p < n_panels; p++) eps_rolling_push(&store->rolling[k][p], signal[p]);
+#define STAT_STORE(j, k, name) \
+    for (int p = 0; p < n_panels; p++) store->stat[j][idx][p] = eps_rolling_##name(&store->rolling[k][p]);
+
+void eps_store_init(EPS_PanelStore *store) {
+    memset(store, 0, sizeof(EPS_PanelStore));
+    EPS_SPEC_ROLLING(ROLLING_INIT)
+}
+
+void eps_store_push(EPS_PanelStore *store, const eps_feature_t *power, const eps_feature_t *voltage, int n_panels) {
+    uint8_t prev = store->index;
+    uint8_t idx = (prev + 1) & RING_BUFFER_MASK;
+
+    // Lane loops over contiguous panel vectors
+#if EPS_SPEC_POWER_DIFF
+    for (int p = 0; p < n_panels; p++) store->power_diff[idx][p] = power[p] - store->power[prev][p];
+#endif
+#if EPS_SPEC_VOLTAGE_DIFF
+    for (int p = 0; p < n_panels; p++) store->voltage_diff[idx][p] = voltage[p] - store->voltage[prev][p];
+#endif
+    EPS_SPEC_ROLLING(ROLLING_PUSH)
+    EPS_SPEC_STATS(STAT_STORE)
+    memcpy(store->power[idx], power, n_panels * sizeof(eps_feature_t));
+    memcpy(store->voltage[idx], voltage, n_panels * sizeof(eps_feature_t));
+    store->index = idx;
+    if (store->n_samples < RING_BUFFER_HISTORY) store->n_samples++;
+}
+
+// Feature by feature: one lane vector per spec feature, scattered into
+// column i of the panel rows
+static inline void scatter(eps_feature_t *column, uint16_t stride, const eps_feature_t *lane, int n_panels) {
+    for (int p = 0; p < n_panels; p++) column[p * stride] = lane[p];
+}
+
+#define SLOT(age) ((store->index - (age)) & RING_BUFFER_MASK)
+#define RING_LAG(signal) store->signal
+#define RING_DIFF(signal) store->signal##_diff
+#define RING_STAT(j) store->stat[j]
+#define POWER_FEATURE(i, kind, signal, age) \
+    scatter(power_rows + (i), power_stride, RING_##kind(signal)[SLOT(age)], n_panels);
+#define VOLTAGE_FEATURE(i, kind, signal, age) \
+    scatter(voltage_rows + (i), voltage_stride, RING_##kind(signal)[SLOT(age)], n_panels);
+
+void eps_store_features(const EPS_PanelStore *store, int n_panels,
+                        eps_feature_t *power_rows, uint16_t power_stride,
+                        eps_feature_t *voltage_rows, uint16_t voltage_stride) {
+    EPS_SPEC_POWER_FEATURES(POWER_FEATURE)
+    EPS_SPEC_VOLTAGE_FEATURES(VOLTAGE_FEATURE)
+}
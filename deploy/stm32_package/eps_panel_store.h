@@ -0,0 +1,61 @@
+/**
+ * EPS Predictive FDIR - Panel Feature Store
+ * Lag history of every panel in one structure-of-arrays block
+ *
+ * Same rings and feature definitions as EPS_FeatureBuffers (eps_features.c),
+ * transposed: each ring slot holds one sample of all panels side by side
+ * (power[slot][panel], padded to EPS_STORE_LANES). All panels are pushed
+ * together once per cycle, and eps_store_features() emits the complete
+ * power and voltage feature matrices in the row layout the batched model
+ * entry points take. Every feature of the spec (eps_feature_spec.h) reads
+ * one contiguous lane vector instead of one scattered struct per panel.
+ *
+ * RAM: 16 slots x 16 lanes x 3 rings x 8 bytes = 6 KB (3 KB with float
+ * features, EPS_FOREST_BACKEND_FLOAT32), plus per rolling window
+ * 16 x sizeof(EPS_Rolling) and per statistic one more 2 KB ring
+ */
+
+#ifndef EPS_PANEL_STORE_H
+#define EPS_PANEL_STORE_H
+
+#include "eps_model_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define EPS_STORE_LANES 16   // Panels per store, padded (13 on the satellite)
+
+typedef struct {
+    eps_feature_t power[RING_BUFFER_SIZE][EPS_STORE_LANES];
+    eps_feature_t voltage[RING_BUFFER_SIZE][EPS_STORE_LANES];
+#if EPS_SPEC_POWER_DIFF
+    eps_feature_t power_diff[RING_BUFFER_SIZE][EPS_STORE_LANES];   // P[i] - P[i-1]
+#endif
+#if EPS_SPEC_VOLTAGE_DIFF
+    eps_feature_t voltage_diff[RING_BUFFER_SIZE][EPS_STORE_LANES]; // V[i] - V[i-1]
+#endif
+#if EPS_SPEC_N_STATS
+    EPS_Rolling rolling[EPS_SPEC_N_ROLLING][EPS_STORE_LANES];
+    eps_feature_t stat[EPS_SPEC_N_STATS][RING_BUFFER_SIZE][EPS_STORE_LANES];
+#endif
+    uint8_t index;                 // Slot of the newest sample
+    uint16_t n_samples;            // Saturates at RING_BUFFER_HISTORY
+} EPS_PanelStore;
+
+void eps_store_init(EPS_PanelStore *store);
+
+// Push one sample per panel (power[p], voltage[p] for p < n_panels)
+void eps_store_push(EPS_PanelStore *store, const eps_feature_t *power, const eps_feature_t *voltage, int n_panels);
+
+// True once RING_BUFFER_HISTORY samples are held
+static inline bool eps_store_ready(const EPS_PanelStore *store) {
+    return store->n_samples >= RING_BUFFER_HISTORY;
+}
+
+// Feature rows of the newest sample for panels 0..n_panels-1: row p at
+// power_rows + p * power_stride (POWER_N_FEATURES values) and
+// voltage_rows + p * voltage_stride (VOLTAGE_N_FEATURES values)
+void eps_store_features(const EPS_PanelStore *store, int n_panels,
+                        eps_feature_t *power_rows, uint16_t power_stride,
+                        eps_feature_t *voltage_rows, uint16_t voltage_stride);
+
+#endif // EPS_PANEL_STORE_H
@@ -4,16 +4,27 @@
  */
 
 #include "eps_protection_final.h"
+#include "eps_actuation.h"
+#include "eps_acquisition.h"
 #include <stdio.h>
 #include <stdarg.h>
-
-// ===== EXTERNAL DEPENDENCIES =====
-// ADC handle (must be initialized in main.c)
-extern ADC_HandleTypeDef hadc1;
+#include <string.h>
 
 // ===== GLOBAL STATE =====
 PanelProtection_t panels[NUM_PANELS];
 
+// Condition inputs as lane vectors (index = panel_id): the condition masks
+// come from one pass over contiguous arrays
+static struct {
+    float P_prev[NUM_PANELS];      // Previous power measurement
+    float V_prev[NUM_PANELS];      // Previous voltage measurement
+    float spike_level[NUM_PANELS]; // P_nominal * POWER_SPIKE_MULT
+    uint16_t active;               // Panels not in COMP_DISABLED
+} lanes;
+
+// Panels whose Layer 2 comparator was enabled and has not settled yet
+static uint16_t layer2_settling;
+
 // ===== GPIO PIN MAPPINGS (EXAMPLE - Adjust for your hardware) =====
 // These would be defined based on your actual STM32 pin assignments
 // For now, using placeholder arrays
@@ -24,6 +35,10 @@ static GroundCommand_t ground_commands[NUM_PANELS] = {CMD_NONE};
 // ===== INITIALIZATION =====
 
 void eps_protection_init(void) {
+    // No settle steps carried over (eps_actuation.h)
+    eps_actuation_init();
+    layer2_settling = 0;
+    
     // Initialize all panels with default values
     for (uint8_t i = 0; i < NUM_PANELS; i++) {
         panels[i].state = COMP_DISABLED;
@@ -31,8 +46,6 @@ void eps_protection_init(void) {
         panels[i].trip_time = 0;
         panels[i].last_log_time = 0;
         panels[i].stable_count = 0;
-        panels[i].P_prev = 0.0f;
-        panels[i].V_prev = 0.0f;
         panels[i].hardware_tripped = false;
         panels[i].ground_approved = false;
         panels[i].P_nominal = 8.4f;  // Default, override per panel
@@ -41,9 +54,14 @@ void eps_protection_init(void) {
         panels[i].trip_count = 0;
         panels[i].false_alarm_count = 0;
         
+        lanes.P_prev[i] = 0.0f;
+        lanes.V_prev[i] = 0.0f;
+        lanes.spike_level[i] = panels[i].P_nominal * POWER_SPIKE_MULT;
+        
         // Disable Layer 2 comparator initially (Layer 1 always on)
         disable_layer2_comparator(i);
     }
+    lanes.active = 0;
     
     log_event("EPS Protection System Initialized (%d panels)", NUM_PANELS);
 }
@@ -53,12 +71,61 @@ void eps_protection_init_panel(uint8_t panel_id, float P_nom, float V_nom) {
     
     panels[panel_id].P_nominal = P_nom;
     panels[panel_id].V_nominal = V_nom;
+    lanes.spike_level[panel_id] = P_nom * POWER_SPIKE_MULT;
     
     log_event("Panel %d: P_nom=%.2fW, V_nom=%.2fV", panel_id, P_nom, V_nom);
 }
 
 // ===== MAIN PROTECTION LOGIC =====
 
+// Set this panel's bit in each mask whose condition holds. Compares only,
+// no branches, so a loop over the panels runs straight through.
+static inline void lane_conditions(ProtectionMasks_t* m, uint8_t p,
+                                   float P_measured, float V_measured,
+                                   float P_predicted, float V_predicted) {
+    // ===== COMPUTE DERIVATIVES =====
+    float dP_dt = (P_measured - lanes.P_prev[p]) / 5.0f;  // Per second (5s sampling)
+    float dV_dt = (V_measured - lanes.V_prev[p]) / 5.0f;
+    
+    // ===== COMPUTE RESIDUAL =====
+    float residual_power = P_measured - P_predicted;
+    
+    // Condition 1: Power spike (unpredicted high power)
+    m->power_spike |= (uint16_t)((P_predicted > lanes.spike_level[p]) << p);
+    
+    // Condition 2: Voltage drop (unexpected voltage decrease)
+    m->voltage_drop |= (uint16_t)((V_measured < V_predicted - VOLTAGE_DROP_THRESH) << p);
+    
+    // Condition 3: High dynamics (large rate of change)
+    m->high_dynamics |= (uint16_t)(((fabsf(dP_dt) > DP_DT_THRESH) &
+                                    (fabsf(dV_dt) > DV_DT_THRESH)) << p);
+    
+    // Condition 4: Large residual (prediction error)
+    m->large_residual |= (uint16_t)((fabsf(residual_power) > RESIDUAL_MULT * SIGMA_POWER) << p);
+}
+
+uint16_t eps_protection_conditions(const float P_measured[],
+                                   const float V_measured[],
+                                   const float P_predicted[],
+                                   const float V_predicted[],
+                                   uint8_t n_panels,
+                                   ProtectionMasks_t* masks) {
+    if (n_panels > NUM_PANELS) n_panels = NUM_PANELS;
+    
+    ProtectionMasks_t m = {0};
+    for (uint8_t p = 0; p < n_panels; p++) {
+        lane_conditions(&m, p, P_measured[p], V_measured[p], P_predicted[p], V_predicted[p]);
+    }
+    *masks = m;
+    
+    // Need 2 of 4 to trigger
+    return eps_protection_vote(&m);
+}
+
+static void protection_step(uint8_t panel_id, const ProtectionMasks_t* m,
+                            float P_measured, float V_measured,
+                            float P_predicted, float V_predicted);
+
 void eps_protection_update(uint8_t panel_id,
                            float P_measured,
                            float V_measured,
@@ -67,33 +134,55 @@ void eps_protection_update(uint8_t panel_id,
     
     if (panel_id >= NUM_PANELS) return;
     
-    PanelProtection_t* panel = &panels[panel_id];
-    
-    // ===== COMPUTE DERIVATIVES =====
-    float dP_dt = (P_measured - panel->P_prev) / 5.0f;  // Per second (5s sampling)
-    float dV_dt = (V_measured - panel->V_prev) / 5.0f;
+    ProtectionMasks_t masks = {0};
+    lane_conditions(&masks, panel_id, P_measured, V_measured, P_predicted, V_predicted);
+    protection_step(panel_id, &masks, P_measured, V_measured, P_predicted, V_predicted);
     
     // Update history
-    panel->P_prev = P_measured;
-    panel->V_prev = V_measured;
-    
-    // ===== COMPUTE RESIDUAL =====
-    float residual_power = P_measured - P_predicted;
-    
-    // ===== CHECK 4 CONDITIONS =====
+    lanes.P_prev[panel_id] = P_measured;
+    lanes.V_prev[panel_id] = V_measured;
+}
+
+uint16_t eps_protection_update_all(const float P_measured[],
+                                   const float V_measured[],
+                                   const float P_predicted[],
+                                   const float V_predicted[],
+                                   uint8_t n_panels) {
+    if (n_panels > NUM_PANELS) n_panels = NUM_PANELS;
+    
+    ProtectionMasks_t masks;
+    uint16_t anomaly = eps_protection_conditions(P_measured, V_measured, P_predicted,
+                                                 V_predicted, n_panels, &masks);
+    
+    // A quiet panel in COMP_DISABLED has nothing to do: only the set bits
+    // of the pending mask reach the state machine
+    uint32_t pending = (anomaly | lanes.active) & ((1u << n_panels) - 1u);
+    while (pending) {
+        uint8_t p = (uint8_t)__builtin_ctz(pending);
+        pending &= pending - 1u;
+        protection_step(p, &masks, P_measured[p], V_measured[p], P_predicted[p], V_predicted[p]);
+    }
     
-    // Condition 1: Power spike (unpredicted high power)
-    bool power_spike = (P_predicted > panel->P_nominal * POWER_SPIKE_MULT);
+    // Update history
+    memcpy(lanes.P_prev, P_measured, n_panels * sizeof(float));
+    memcpy(lanes.V_prev, V_measured, n_panels * sizeof(float));
+    return anomaly;
+}
+
+// State machine of one panel for this sample's condition masks
+static void protection_step(uint8_t panel_id, const ProtectionMasks_t* m,
+                            float P_measured, float V_measured,
+                            float P_predicted, float V_predicted) {
     
-    // Condition 2: Voltage drop (unexpected voltage decrease)
-    bool voltage_drop = (V_measured < V_predicted - VOLTAGE_DROP_THRESH);
+    if (panel_id >= NUM_PANELS) return;
     
-    // Condition 3: High dynamics (large rate of change)
-    bool high_dynamics = (fabsf(dP_dt) > DP_DT_THRESH) && 
-                        (fabsf(dV_dt) > DV_DT_THRESH);
+    PanelProtection_t* panel = &panels[panel_id];
+    uint16_t bit = (uint16_t)(1u << panel_id);
     
-    // Condition 4: Large residual (prediction error)
-    bool large_residual = (fabsf(residual_power) > RESIDUAL_MULT * SIGMA_POWER);
+    bool power_spike = (m->power_spike & bit) != 0;
+    bool voltage_drop = (m->voltage_drop & bit) != 0;
+    bool high_dynamics = (m->high_dynamics & bit) != 0;
+    bool large_residual = (m->large_residual & bit) != 0;
     
     // Count conditions (need 2 of 4 to trigger)
     uint8_t condition_count = power_spike + voltage_drop + 
@@ -130,8 +219,9 @@ void eps_protection_update(uint8_t panel_id,
             // ===== LAYER 2 ACTIVE =====
             // Hardware monitoring, waiting for trip or stability
             
-            // Check if hardware tripped (Layer 1 or Layer 2)
-            bool mosfet_open = check_mosfet_status(panel_id);
+            // Check if hardware tripped (Layer 1 or Layer 2); not until the
+            // comparator enabled above has settled
+            bool mosfet_open = !(layer2_settling & bit) && check_mosfet_status(panel_id);
             
             if (mosfet_open) {
                 // === HARDWARE TRIP OCCURRED ===
@@ -144,7 +234,9 @@ void eps_protection_update(uint8_t panel_id,
                 log_event("  P_measured=%.2fW, V_measured=%.2fV", P_measured, V_measured);
                 log_event("  P_predicted=%.2fW, V_predicted=%.2fV", P_predicted, V_predicted);
                 log_event("  Residual=%.2fW, dP/dt=%.3f, dV/dt=%.3f", 
-                         residual_power, dP_dt, dV_dt);
+                         P_measured - P_predicted,
+                         (P_measured - lanes.P_prev[panel_id]) / 5.0f,
+                         (V_measured - lanes.V_prev[panel_id]) / 5.0f);
                 
                 send_telemetry_alert(panel_id, P_measured, V_measured);
             }
@@ -252,13 +344,35 @@ void eps_protection_update(uint8_t panel_id,
             break;
         }
     }
+    
+    // Panels back in COMP_DISABLED leave the pending set
+    lanes.active = (uint16_t)((lanes.active & ~bit) | ((panel->state != COMP_DISABLED) ? bit : 0u));
+}
+
+// ===== DECISION BOUNDARIES (anytime evaluation) =====
+
+uint8_t eps_protection_power_cuts(uint8_t panel_id, float P_measured, float cuts[3]) {
+    // Other states log the predictions and need them exact
+    if (panel_id >= NUM_PANELS || panels[panel_id].state != COMP_DISABLED) return 0;
+    
+    cuts[0] = lanes.spike_level[panel_id];                        // power_spike
+    cuts[1] = P_measured - RESIDUAL_MULT * SIGMA_POWER;           // large_residual
+    cuts[2] = P_measured + RESIDUAL_MULT * SIGMA_POWER;
+    return 3;
+}
+
+uint8_t eps_protection_voltage_cuts(uint8_t panel_id, float V_measured, float cuts[1]) {
+    if (panel_id >= NUM_PANELS || panels[panel_id].state != COMP_DISABLED) return 0;
+    
+    cuts[0] = V_measured + VOLTAGE_DROP_THRESH;                   // voltage_drop
+    return 1;
 }
 
 // ===== HARDWARE CONFIGURATION =====
 // GPIO Pin Mappings for 13 Panels
 // Each panel requires:
 //   1. Layer 2 Comparator Enable (Digital Output)
-//   2. MOSFET Status Sense (ADC Input - drain voltage)
+//   2. MOSFET Status Sense (ADC Input - drain voltage, eps_acquisition.c)
 //   3. MOSFET Control Override (Digital Output - for recovery)
 
 // STM32F4 GPIO mappings (adjust for your hardware)
@@ -282,13 +396,25 @@ static const struct {
     {GPIOD, GPIO_PIN_4}
 };
 
-// ADC channels for MOSFET drain voltage sensing
-static const uint32_t MOSFET_SENSE_ADC_CHANNELS[NUM_PANELS] = {
-    ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3,
-    ADC_CHANNEL_4, ADC_CHANNEL_5, ADC_CHANNEL_6, ADC_CHANNEL_7,
-    ADC_CHANNEL_8, ADC_CHANNEL_9, ADC_CHANNEL_10, ADC_CHANNEL_11,
-    ADC_CHANNEL_12
-};
+// ===== DEFERRED ACTUATION STEPS =====
+// Run by eps_actuation_tick() once the settle time has passed
+
+// Layer 2 comparator output is stable: trips are read from now on
+static void layer2_settled(uint8_t panel_id) {
+    layer2_settling &= (uint16_t)~(1u << panel_id);
+}
+
+// Inrush over: verify the MOSFET actually closed, on a scan taken now
+// (~20 us) rather than the one from the start of the cycle
+static void mosfet_settled(uint8_t panel_id) {
+    if (!eps_acq_scan(EPS_ACQ_TIMEOUT_MS)) {
+        log_event("Panel %d: MOSFET re-enable not verified (ADC scan timeout)", panel_id);
+    } else if (check_mosfet_status(panel_id)) {
+        log_event("Panel %d: MOSFET still open after re-enable", panel_id);
+    } else {
+        log_event("Panel %d: MOSFET re-enabled (override active)", panel_id);
+    }
+}
 
 // ===== HARDWARE INTERFACE IMPLEMENTATION =====
 
@@ -301,8 +427,12 @@ void enable_layer2_comparator(uint8_t panel_id) {
                       LAYER2_ENABLE_PINS[panel_id].pin, 
                       GPIO_PIN_SET);
     
-    // Small delay for comparator stabilization
-    HAL_Delay(1);
+    // Comparator stabilization, completed later by the actuation tick
+    layer2_settling |= (uint16_t)(1u << panel_id);
+    if (!eps_actuation_defer(layer2_settled, panel_id, HAL_GetTick() + LAYER2_SETTLE_MS)) {
+        HAL_Delay(LAYER2_SETTLE_MS);   // Queue full: settle in place
+        layer2_settled(panel_id);
+    }
 }
 
 void disable_layer2_comparator(uint8_t panel_id) {
@@ -313,30 +443,22 @@ void disable_layer2_comparator(uint8_t panel_id) {
     HAL_GPIO_WritePin(LAYER2_ENABLE_PINS[panel_id].port, 
                       LAYER2_ENABLE_PINS[panel_id].pin, 
                       GPIO_PIN_RESET);
+    
+    eps_actuation_cancel(layer2_settled, panel_id);
+    layer2_settling &= (uint16_t)~(1u << panel_id);
 }
 
 bool check_mosfet_status(uint8_t panel_id) {
     if (panel_id >= NUM_PANELS) return false;
     
-    // Read MOSFET drain voltage via ADC
+    // MOSFET drain voltage from the latest scan of all panels
     // Circuit: If MOSFET open (tripped), drain voltage ≈ 0V
     //          If MOSFET closed (normal), drain voltage ≈ bus voltage (scaled)
-    
-    // Select ADC channel
-    ADC_ChannelConfTypeDef sConfig = {0};
-    sConfig.Channel = MOSFET_SENSE_ADC_CHANNELS[panel_id];
-    sConfig.Rank = 1;
-    sConfig.SamplingTime = ADC_SAMPLETIME_15CYCLES;
-    HAL_ADC_ConfigChannel(&hadc1, &sConfig);
-    
-    // Start conversion
-    HAL_ADC_Start(&hadc1);
-    HAL_ADC_PollForConversion(&hadc1, 10);
-    uint32_t adc_value = HAL_ADC_GetValue(&hadc1);
-    HAL_ADC_Stop(&hadc1);
+    const EPS_SampleFrame* frame = eps_acq_frame();
+    if (!frame) return false;      // Nothing scanned yet
     
     // Convert to voltage (0-3.3V range, assuming voltage divider)
-    float drain_voltage = (adc_value / 4095.0f) * 3.3f;
+    float drain_voltage = eps_acq_drain_voltage(frame, panel_id);
     
     // Threshold: If drain voltage < 1.0V, MOSFET is open (tripped)
     bool mosfet_open = (drain_voltage < 1.0f);
@@ -353,10 +475,11 @@ void attempt_reenable_mosfet(uint8_t panel_id) {
                       MOSFET_OVERRIDE_PINS[panel_id].pin,
                       GPIO_PIN_SET);
     
-    // Allow MOSFET to close (inrush current settling)
-    HAL_Delay(10);
-    
-    log_event("Panel %d: MOSFET re-enabled (override active)", panel_id);
+    // Allow MOSFET to close (inrush current settling), then verify it
+    if (!eps_actuation_defer(mosfet_settled, panel_id, HAL_GetTick() + MOSFET_SETTLE_MS)) {
+        HAL_Delay(MOSFET_SETTLE_MS);   // Queue full: settle in place
+        mosfet_settled(panel_id);
+    }
 }
 
 void disable_mosfet(uint8_t panel_id) {
@@ -367,6 +490,7 @@ void disable_mosfet(uint8_t panel_id) {
     HAL_GPIO_WritePin(MOSFET_OVERRIDE_PINS[panel_id].port,
                       MOSFET_OVERRIDE_PINS[panel_id].pin,
                       GPIO_PIN_RESET);
+    eps_actuation_cancel(mosfet_settled, panel_id);
     
     log_event("Panel %d: MOSFET manually disabled", panel_id);
 }
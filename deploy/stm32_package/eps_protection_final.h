@@ -28,6 +28,10 @@
 #define STABLE_REQUIRED 6          // 6 samples = 30s stable before disable
 #define RECOVERY_STABLE_REQ 24     // 24 samples = 2min stable after re-enable
 
+// Actuation settle times, completed by eps_actuation_tick() (eps_actuation.h)
+#define LAYER2_SETTLE_MS 1         // Comparator stabilization after enable
+#define MOSFET_SETTLE_MS 10        // Inrush settling after re-enable, then verify
+
 // Condition thresholds
 #define POWER_SPIKE_MULT 1.2f      // P_predicted > 1.2 × P_nominal
 #define VOLTAGE_DROP_THRESH 0.5f   // V_measured < V_predicted - 0.5V
@@ -56,10 +60,6 @@ typedef struct {
     // Counters
     uint8_t stable_count;          // Consecutive stable samples
     
-    // History (for derivatives)
-    float P_prev;                  // Previous power measurement
-    float V_prev;                  // Previous voltage measurement
-    
     // Flags
     bool hardware_tripped;         // Has hardware isolated this panel?
     bool ground_approved;          // Ground station approved recovery?
@@ -75,6 +75,26 @@ typedef struct {
     
 } PanelProtection_t;
 
+// ===== CONDITION MASKS =====
+// The four conditions for a whole panel array, bit p = panel p
+#if NUM_PANELS > 16
+#error "condition masks hold 16 panels"
+#endif
+
+typedef struct {
+    uint16_t power_spike;
+    uint16_t voltage_drop;
+    uint16_t high_dynamics;
+    uint16_t large_residual;
+} ProtectionMasks_t;
+
+// Panels with at least 2 of the 4 conditions: any two masks sharing a bit
+static inline uint16_t eps_protection_vote(const ProtectionMasks_t* m) {
+    uint16_t a = m->power_spike, b = m->voltage_drop;
+    uint16_t c = m->high_dynamics, d = m->large_residual;
+    return (uint16_t)((a & b) | (c & d) | ((a | b) & (c | d)));
+}
+
 // ===== GLOBAL STATE =====
 extern PanelProtection_t panels[NUM_PANELS];
 
@@ -89,10 +109,39 @@ void eps_protection_update(uint8_t panel_id,
                            float P_predicted,
                            float V_predicted);
 
+// Same logic for panels 0..n_panels-1 in one call, from per-panel arrays
+// (index = panel_id). The conditions are evaluated as masks for all panels;
+// the state machine then runs only for anomalous panels and those not in
+// COMP_DISABLED. Returns the anomaly mask.
+uint16_t eps_protection_update_all(const float P_measured[],
+                                   const float V_measured[],
+                                   const float P_predicted[],
+                                   const float V_predicted[],
+                                   uint8_t n_panels);
+
+// Condition masks for panels 0..n_panels-1 against the stored history,
+// without updating it. Returns the anomaly mask (eps_protection_vote).
+uint16_t eps_protection_conditions(const float P_measured[],
+                                   const float V_measured[],
+                                   const float P_predicted[],
+                                   const float V_predicted[],
+                                   uint8_t n_panels,
+                                   ProtectionMasks_t* masks);
+
+// Predicted values at which a condition of eps_protection_update() flips
+// for this sample (power_spike, large_residual, voltage_drop). A prediction
+// on the same side of every cut gives the same decision, which lets the
+// anytime forest evaluation stop early. Returns the number of cuts written;
+// 0 outside COMP_DISABLED, where the predictions are logged and must be exact.
+uint8_t eps_protection_power_cuts(uint8_t panel_id, float P_measured, float cuts[3]);
+uint8_t eps_protection_voltage_cuts(uint8_t panel_id, float V_measured, float cuts[1]);
+
 // ===== HARDWARE INTERFACE =====
+// Pin writes return at once; the settle time after enabling a comparator
+// or re-enabling a MOSFET is a step queued in eps_actuation.h
 void enable_layer2_comparator(uint8_t panel_id);
 void disable_layer2_comparator(uint8_t panel_id);
-bool check_mosfet_status(uint8_t panel_id);
+bool check_mosfet_status(uint8_t panel_id);   // From the latest eps_acq_frame()
 void attempt_reenable_mosfet(uint8_t panel_id);
 void disable_mosfet(uint8_t panel_id);
 
@@ -0,0 +1,76 @@
+/**
+ * Rolling window statistics implementation
+ */
+
+#include "eps_rolling.h"
+#include <string.h>
+
+int eps_rolling_init(EPS_Rolling *r, uint16_t window) {
+    if (window < 2 || window > EPS_ROLLING_MAX_WINDOW) return -1;
+    memset(r, 0, sizeof(EPS_Rolling));
+    r->window = window;
+    return 0;
+}
+
+// sum += x with Kahan compensation
+static inline void kahan_add(EPS_Rolling *r, double x) {
+    double y = x - r->sum_comp;
+    double t = r->sum + y;
+    r->sum_comp = (t - r->sum) - y;
+    r->sum = t;
+}
+
+// Sum and squared deviations straight from the stored window, oldest first
+// (the two-pass definition), dropping the rounding of the updates so far
+static void rebuild(EPS_Rolling *r) {
+    uint16_t first = r->n - r->window + 1;   // r->n: the sample just stored
+    double sum = 0.0, m2 = 0.0;
+    for (uint16_t i = 0; i < r->window; i++) sum += r->value[(uint16_t)(first + i) & EPS_ROLLING_MASK];
+    double mean = sum / r->window;
+    for (uint16_t i = 0; i < r->window; i++) {
+        double d = r->value[(uint16_t)(first + i) & EPS_ROLLING_MASK] - mean;
+        m2 += d * d;
+    }
+    r->sum = sum;
+    r->sum_comp = 0.0;
+    r->m2 = m2;
+    r->since_rebuild = 0;
+}
+
+void eps_rolling_push(EPS_Rolling *r, double x) {
+    uint16_t n = r->n;
+    double mean = eps_rolling_mean(r);
+
+    if (r->count < r->window) {
+        // Filling: plain Welford step
+        r->count++;
+        kahan_add(r, x);
+        r->m2 += (x - mean) * (x - eps_rolling_mean(r));
+    } else {
+        // Sliding: x replaces the oldest sample at the same count
+        double old = r->value[(uint16_t)(n - r->window) & EPS_ROLLING_MASK];
+        kahan_add(r, x);
+        kahan_add(r, -old);
+        r->m2 += (x - old) * (x - eps_rolling_mean(r) + old - mean);
+        if (r->m2 < 0.0) r->m2 = 0.0;
+    }
+    r->value[n & EPS_ROLLING_MASK] = x;
+
+    // Drop samples that left the window, then those the new one dominates
+    if (r->min_head != r->min_tail &&
+        (uint16_t)(n - r->min_q[r->min_head & EPS_ROLLING_MASK]) >= r->window) r->min_head++;
+    while (r->min_head != r->min_tail &&
+           r->value[r->min_q[(r->min_tail - 1) & EPS_ROLLING_MASK] & EPS_ROLLING_MASK] >= x) r->min_tail--;
+    r->min_q[r->min_tail++ & EPS_ROLLING_MASK] = n;
+
+    if (r->max_head != r->max_tail &&
+        (uint16_t)(n - r->max_q[r->max_head & EPS_ROLLING_MASK]) >= r->window) r->max_head++;
+    while (r->max_head != r->max_tail &&
+           r->value[r->max_q[(r->max_tail - 1) & EPS_ROLLING_MASK] & EPS_ROLLING_MASK] <= x) r->max_tail--;
+    r->max_q[r->max_tail++ & EPS_ROLLING_MASK] = n;
+
+    // Sliding updates cancel large values against each other; rebuild once
+    // per window so their rounding cannot build up (amortized O(1))
+    if (r->count == r->window && ++r->since_rebuild >= r->window) rebuild(r);
+    r->n = n + 1;
+}
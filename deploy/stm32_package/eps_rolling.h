@@ -0,0 +1,78 @@
+/**
+ * EPS Predictive FDIR - Rolling Window Statistics
+ * Mean, variance, min and max of the last 'window' samples, O(1) per sample
+ *
+ *   mean      Kahan-compensated running sum / window
+ *   variance  sliding Welford update of the sum of squared deviations
+ *             (population variance, ddof = 0 as in pandas .var(ddof=0))
+ *             Both sums are rebuilt from the stored window (two-pass) once
+ *             every 'window' samples: power spans six decades, and the
+ *             rounding of the sliding updates would otherwise accumulate
+ *             into a variance that never returns to 0 on a flat signal.
+ *   min, max  monotonic deques of sample numbers: each sample is pushed and
+ *             popped at most once, so the amortized cost is O(1)
+ *
+ * Statistics are defined once 'window' samples are held; before that they
+ * cover the samples seen so far. Used by the feature engines for the
+ * rolling features of the feature spec (eps_feature_spec.h).
+ *
+ * RAM: 8 * EPS_ROLLING_MAX_WINDOW + 4 * EPS_ROLLING_MAX_WINDOW + 48 bytes
+ * (816 bytes for the default window limit of 64)
+ */
+
+#ifndef EPS_ROLLING_H
+#define EPS_ROLLING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef EPS_ROLLING_MAX_WINDOW
+#define EPS_ROLLING_MAX_WINDOW 64   // Power of two (64 samples = 5.3 min at 5 s)
+#endif
+#define EPS_ROLLING_MASK (EPS_ROLLING_MAX_WINDOW - 1)
+
+#if EPS_ROLLING_MAX_WINDOW & EPS_ROLLING_MASK
+#error "EPS_ROLLING_MAX_WINDOW must be a power of two"
+#endif
+
+typedef struct {
+    double value[EPS_ROLLING_MAX_WINDOW];   // Samples, indexed by sample number & mask
+    double sum;                    // Running sum of the window
+    double sum_comp;               // Kahan compensation of sum
+    double m2;                     // Sum of squared deviations from the mean
+    uint16_t min_q[EPS_ROLLING_MAX_WINDOW]; // Sample numbers, values increasing
+    uint16_t max_q[EPS_ROLLING_MAX_WINDOW]; // Sample numbers, values decreasing
+    uint16_t min_head, min_tail;   // Deque positions (masked on access)
+    uint16_t max_head, max_tail;
+    uint16_t n;                    // Samples pushed (wraps, only differences matter)
+    uint16_t count;                // Samples in the window, saturates at window
+    uint16_t window;
+    uint16_t since_rebuild;        // Sliding updates since the sums were rebuilt
+} EPS_Rolling;
+
+// window: 2..EPS_ROLLING_MAX_WINDOW. Returns 0, or -1 if out of range.
+// A push costs O(1), plus a 2 x window pass every window-th push.
+int eps_rolling_init(EPS_Rolling *r, uint16_t window);
+void eps_rolling_push(EPS_Rolling *r, double x);
+
+static inline bool eps_rolling_ready(const EPS_Rolling *r) {
+    return r->count >= r->window;
+}
+
+static inline double eps_rolling_mean(const EPS_Rolling *r) {
+    return r->count ? r->sum / r->count : 0.0;
+}
+
+static inline double eps_rolling_var(const EPS_Rolling *r) {
+    return (r->count && r->m2 > 0.0) ? r->m2 / r->count : 0.0;
+}
+
+static inline double eps_rolling_min(const EPS_Rolling *r) {
+    return r->value[r->min_q[r->min_head & EPS_ROLLING_MASK] & EPS_ROLLING_MASK];
+}
+
+static inline double eps_rolling_max(const EPS_Rolling *r) {
+    return r->value[r->max_q[r->max_head & EPS_ROLLING_MASK] & EPS_ROLLING_MASK];
+}
+
+#endif // EPS_ROLLING_H
@@ -0,0 +1,145 @@
+"""
+EPS Feature Specification
+Loads deploy/models/feature_spec.json, the single definition of the model
+input features, for the training notebooks and eps_forest_export.py
+(which compiles it into deploy/c_code/eps_feature_spec.h).
+
+Definitions, for a signal s sampled every 5 s and the row at index t:
+  lag feature   s[t - lag]
+  diff feature  s[t - lag] - s[t - lag - 1]
+  stat feature  stat (mean, var, min or max) of the 'window' samples
+                ending at s[t - lag]; var is the population variance
+  target        s[t + target_shift]
+so a feature is 'age' = lag + target_shift samples older than the sample it
+predicts, and also reads the 'extent' samples before that (1 for a diff,
+window - 1 for a stat).
+
+Usage (notebook):
+  import eps_feature_spec as fs
+  spec = fs.load()
+  X, y = fs.frame(spec, 'power', {'power': df['Power']})
+"""
+
+import json
+import os
+
+SPEC_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'deploy', 'models', 'feature_spec.json')
+SPEC_VERSION = 1
+STATS = ('mean', 'var', 'min', 'max')
+
+
+def load(path=SPEC_PATH):
+    with open(path) as f:
+        spec = json.load(f)
+    assert spec['version'] == SPEC_VERSION, '%s: unsupported spec version %r' % (path, spec['version'])
+    for model, m in spec['models'].items():
+        assert m['target'] in spec['signals'], '%s: unknown target signal %r' % (model, m['target'])
+        for feat in m['features']:
+            assert feat['signal'] in spec['signals'], '%s: %s reads unknown signal %r' % (model, feat['name'], feat['signal'])
+            assert feat['lag'] >= 1, '%s: %s needs lag >= 1' % (model, feat['name'])
+            if 'stat' in feat:
+                assert feat['stat'] in STATS, '%s: %s: stat must be one of %s' % (model, feat['name'], STATS)
+                assert feat.get('window', 0) >= 2, '%s: %s needs window >= 2' % (model, feat['name'])
+                assert not feat.get('diff'), '%s: %s: stat of a diff is not supported' % (model, feat['name'])
+    return spec
+
+
+def features(spec, model):
+    return spec['models'][model]['features']
+
+
+def feature_names(spec, model):
+    return [feat['name'] for feat in features(spec, model)]
+
+
+def age(spec, feat):
+    """Samples between the predicted sample and the one the feature reads."""
+    return feat['lag'] + spec['target_shift']
+
+
+def extent(feat):
+    """Samples a feature reads before its age."""
+    if 'stat' in feat:
+        return feat['window'] - 1
+    return 1 if feat.get('diff') else 0
+
+
+def _all_features(spec):
+    return [feat for m in spec['models'].values() for feat in m['features']]
+
+
+def max_age(spec):
+    """Oldest ring slot any feature reads, relative to the predicted sample
+    (a diff reads the stored difference, a stat the stored statistic)."""
+    return max(age(spec, feat) + bool(feat.get('diff')) for feat in _all_features(spec))
+
+
+def history(spec):
+    """Samples before the predicted one that a complete row needs."""
+    return max(age(spec, feat) + extent(feat) for feat in _all_features(spec))
+
+
+def rolling(spec):
+    """Distinct (signal, window) rolling windows, in first-use order."""
+    out = []
+    for feat in _all_features(spec):
+        if 'stat' in feat and (feat['signal'], feat['window']) not in out:
+            out.append((feat['signal'], feat['window']))
+    return out
+
+
+def stats(spec):
+    """Distinct (rolling window index, stat) series, in first-use order."""
+    windows = rolling(spec)
+    out = []
+    for feat in _all_features(spec):
+        if 'stat' in feat:
+            key = (windows.index((feat['signal'], feat['window'])), feat['stat'])
+            if key not in out:
+                out.append(key)
+    return out
+
+
+def _stat(values, stat):
+    if stat == 'mean':
+        return sum(values) / len(values)
+    if stat == 'var':
+        mean = sum(values) / len(values)
+        return sum((v - mean) ** 2 for v in values) / len(values)
+    return min(values) if stat == 'min' else max(values)
+
+
+def frame(spec, model, signals):
+    """(X, y) pandas frames for training: signals maps signal name -> Series.
+
+    Rows without complete history or target are dropped; y is the model's
+    target signal target_shift samples ahead.
+    """
+    import pandas as pd
+    cols = {}
+    for feat in features(spec, model):
+        s = signals[feat['signal']]
+        if feat.get('diff'):
+            s = s.diff()
+        elif 'stat' in feat:
+            w = s.rolling(feat['window'])
+            s = w.var(ddof=0) if feat['stat'] == 'var' else getattr(w, feat['stat'])()
+        cols[feat['name']] = s.shift(feat['lag'])
+    target = signals[spec['models'][model]['target']].shift(-spec['target_shift'])
+    df = pd.DataFrame(cols)
+    df['Target'] = target
+    df = df.dropna().reset_index(drop=True)
+    return df[feature_names(spec, model)], df['Target']
+
+
+def row(spec, model, signals, t):
+    """Feature row predicting sample t; signals maps signal name -> sequence."""
+    out = []
+    for feat in features(spec, model):
+        s = signals[feat['signal']]
+        a = age(spec, feat)
+        if 'stat' in feat:
+            out.append(_stat(s[t - a - feat['window'] + 1:t - a + 1], feat['stat']))
+        else:
+            out.append(s[t - a] - s[t - a - 1] if feat.get('diff') else s[t - a])
+    return out
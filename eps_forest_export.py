@@ -0,0 +1,1656 @@
+"""
+EPS Forest Exporter
+Converts the pruned RandomForest models into the table-driven C format
+used by deploy/stm32_package/eps_forest.c
+
+Model sources (in order of preference):
+  - scikit-learn RandomForestRegressor (joblib .pkl)
+  - forest JSON (deploy/models/*_forest.json, written by this script)
+  - legacy m2cgen C output (nested if/else, used for the one-time migration)
+
+Model inputs are defined once in deploy/models/feature_spec.json (see
+eps_feature_spec.py); every export also compiles it into
+deploy/c_code/eps_feature_spec.h for the C feature engines.
+
+Usage:
+  python eps_forest_export.py                      # regenerate both models from JSON
+  python eps_forest_export.py --from-m2cgen        # re-import legacy m2cgen sources
+  python eps_forest_export.py --emit-m2cgen DIR    # write branchy reference code to DIR
+  python eps_forest_export.py --emit-m2cgen DIR --symbol-prefix ref_
+  python eps_forest_export.py --telemetry build/NEPALISAT.csv ...   # replay CSVs instead of .xlsx
+  python eps_forest_export.py --profile build/NEPALISAT.csv         # opt-in: hot paths first from this replay
+  python eps_forest_export.py --profile build/power_model.prof build/voltage_model.prof   # ... from C runtime counts
+  python eps_forest_export.py --multi-target models/panel_rf.pkl      # P/V/I panel model
+  python eps_forest_export.py --synthetic-multi-target --telemetry build/*.csv   # stand-in P/V/I model
+  python eps_forest_export.py --multi-predictions build --telemetry build/NEPALISAT.csv ...
+  python eps_forest_export.py --leaf-error power=100 voltage=0.5    # cluster leaves (uW, mV)
+"""
+
+import argparse
+import bisect
+import heapq
+import json
+from fractions import Fraction
+import math
+import os
+import random
+import re
+import struct
+import sys
+import zlib
+
+import eps_feature_spec
+
+# Configuration
+MODELS_DIR = 'deploy/models'
+C_CODE_DIR = 'deploy/c_code'
+# Recorded telemetry: the quantized tables keep every split decision exact on it
+TELEMETRY = ['data/NEPALISAT/NEPALISAT.xlsx', 'data/RAAVANA/RAAVANA.xlsx', 'data/UGUISU/UGUISU.xlsx']
+
+# name -> (function name, C symbol prefix, C file, JSON file)
+MODELS = {
+    'power': ('score', 'power', 'power_model.c', 'power_forest.json'),
+    'voltage': ('score_voltage', 'voltage', 'voltage_model.c', 'voltage_forest.json'),
+}
+
+# Generated model API (eps_model_abi.h): bump together with EPS_MODEL_ABI_VERSION
+MODEL_ABI_VERSION = 1
+
+# Multi-target panel model (eps_forest_multi.h): one forest predicting P, V and I.
+# Fit a RandomForestRegressor on the 10 power features followed by the 5
+# voltage features, with y = [Power (uW), Voltage (mV), Current (mA)].
+MULTI_MODEL = ('score_panel', 'panel', 'panel_model.c', 'panel_forest.json')
+MULTI_TARGETS = ['power', 'voltage', 'current']
+
+# Stand-in panel model (--synthetic-multi-target) until a trained one exists:
+# random splits, sized like the single-target forests (50 trees, depth 6)
+SYNTHETIC_MULTI = {'trees': 50, 'depth': 6, 'min_leaf': 5, 'sample': 2000, 'candidates': 8,
+                   'seed': 2026}
+
+# Leaf clustering (--leaf-error) is scored on this held-out telemetry file
+HOLDOUT = 'UGUISU'
+UNITS = {'power': 'uW', 'voltage': 'mV'}
+
+
+# ===== TREE IR =====
+# Internal node: (feature, threshold, left, right) -- go left if x[feature] <= threshold
+# Leaf:          float value, or a list of floats for multi-target forests
+
+def is_leaf(node):
+    return not isinstance(node, tuple)
+
+
+class Forest:
+    def __init__(self, n_features, trees, scale, function_name='score'):
+        self.n_features = n_features
+        self.trees = trees
+        self.scale = scale
+        self.function_name = function_name
+        self.profile = None         # {id(internal node): [n_left, n_right]} from profile_forest()
+
+    def predict_tree(self, tree, x):
+        node = tree
+        while not is_leaf(node):
+            node = node[2] if x[node[0]] <= node[1] else node[3]
+        return node
+
+    def predict(self, x):
+        # Same summation order as the C runtime: tree 0 first, then scale
+        total = self.predict_tree(self.trees[0], x)
+        for tree in self.trees[1:]:
+            total += self.predict_tree(tree, x)
+        return total * self.scale
+
+
+class MultiForest(Forest):
+    """Forest whose leaves are [output0, output1, ...] (multi-output regressor)."""
+
+    def __init__(self, n_features, n_outputs, trees, scale, function_name=MULTI_MODEL[0]):
+        super().__init__(n_features, trees, scale, function_name)
+        self.n_outputs = n_outputs
+
+    def predict(self, x):
+        total = list(self.predict_tree(self.trees[0], x))
+        for tree in self.trees[1:]:
+            leaf = self.predict_tree(tree, x)
+            for k in range(self.n_outputs):
+                total[k] += leaf[k]
+        return [v * self.scale for v in total]
+
+
+# ===== LOADERS =====
+
+def forest_from_sklearn(model, function_name='score'):
+    """Build the IR from a fitted RandomForestRegressor (multi-output gives a MultiForest)."""
+    n_outputs = getattr(model, 'n_outputs_', 1)
+    trees = []
+    for est in model.estimators_:
+        t = est.tree_
+
+        def build(i):
+            if t.children_left[i] == -1:
+                if n_outputs > 1:
+                    return [float(v[0]) for v in t.value[i]]
+                return float(t.value[i][0][0])
+            return (int(t.feature[i]), float(t.threshold[i]),
+                    build(t.children_left[i]), build(t.children_right[i]))
+        trees.append(build(0))
+    if n_outputs > 1:
+        return MultiForest(model.n_features_in_, n_outputs, trees, 1.0 / len(trees))
+    return Forest(model.n_features_in_, trees, 1.0 / len(trees), function_name)
+
+
+_M2C_TOKEN = re.compile(
+    r'if \(input\[(\d+)\] <= ([^)]+)\) \{'
+    r'|\} else \{'
+    r'|var\d+ = ([^;]+);'
+    r'|\}')
+
+
+def forest_from_m2cgen(path):
+    """Parse the nested if/else emitted by m2cgen.export_to_c()."""
+    with open(path) as f:
+        src = f.read()
+
+    header = re.search(r'double (\w+)\(double \* input\) \{', src)
+    body_start = header.end()
+    ret = re.search(r'return \((.*)\) \* ([0-9.eE+-]+);', src)
+    body = src[body_start:ret.start()]
+
+    tokens = []
+    for m in _M2C_TOKEN.finditer(body):
+        if m.group(1) is not None:
+            tokens.append(('if', int(m.group(1)), float(m.group(2))))
+        elif m.group(3) is not None:
+            tokens.append(('leaf', float(m.group(3))))
+        elif m.group(0).startswith('} else'):
+            tokens.append(('else',))
+        else:
+            tokens.append(('end',))
+
+    pos = 0
+
+    def parse():
+        nonlocal pos
+        tok = tokens[pos]
+        pos += 1
+        if tok[0] == 'leaf':
+            return tok[1]
+        assert tok[0] == 'if', tok
+        left = parse()
+        assert tokens[pos][0] == 'else'
+        pos += 1
+        right = parse()
+        assert tokens[pos][0] == 'end'
+        pos += 1
+        return (tok[1], tok[2], left, right)
+
+    trees = []
+    while pos < len(tokens):
+        trees.append(parse())
+
+    n_features = 1 + max(max_feature(t) for t in trees)
+    return Forest(n_features, trees, float(ret.group(2)), header.group(1))
+
+
+def max_feature(node):
+    if is_leaf(node):
+        return -1
+    return max(node[0], max_feature(node[2]), max_feature(node[3]))
+
+
+def leaf_values(node):
+    if is_leaf(node):
+        return [node]
+    return leaf_values(node[2]) + leaf_values(node[3])
+
+
+def cluster_leaves(forest, max_error):
+    """Copy of forest with leaf values snapped at most max_error away.
+
+    The sorted distinct values are grouped greedily into runs no wider than
+    2 * max_error and every leaf takes the midpoint of its run, so fewer
+    distinct values are left for the leaf pool. A prediction averages the
+    trees, so it moves by at most max_error as well.
+    """
+    assert not isinstance(forest, MultiForest), 'leaf clustering needs scalar leaves'
+    values = sorted(set(v for tree in forest.trees for v in leaf_values(tree)))
+    centre = {}
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1] - values[i] <= 2 * max_error:
+            j += 1
+        mid = values[i] + (values[j] - values[i]) / 2
+        for v in values[i:j + 1]:
+            centre[v] = mid
+        i = j + 1
+
+    def snap(node):
+        if is_leaf(node):
+            return centre[node]
+        return (node[0], node[1], snap(node[2]), snap(node[3]))
+    return Forest(forest.n_features, [snap(t) for t in forest.trees], forest.scale, forest.function_name)
+
+
+def forest_to_json(forest, path):
+    def enc(node):
+        return node if is_leaf(node) else [node[0], node[1], enc(node[2]), enc(node[3])]
+    d = {'function': forest.function_name,
+         'n_features': forest.n_features,
+         'scale': forest.scale,
+         'trees': [enc(t) for t in forest.trees]}
+    if isinstance(forest, MultiForest):
+        d['n_outputs'] = forest.n_outputs
+    with open(path, 'w') as f:
+        json.dump(d, f, separators=(',', ':'))
+
+
+def forest_from_json(path):
+    with open(path) as f:
+        d = json.load(f)
+
+    # Internal nodes start with an int feature index; vector leaves hold floats
+    def dec(node):
+        if not isinstance(node, list):
+            return float(node)
+        if not isinstance(node[0], int):
+            return [float(v) for v in node]
+        return (node[0], node[1], dec(node[2]), dec(node[3]))
+    trees = [dec(t) for t in d['trees']]
+    if 'n_outputs' in d:
+        return MultiForest(d['n_features'], d['n_outputs'], trees, d['scale'], d['function'])
+    return Forest(d['n_features'], trees, d['scale'], d['function'])
+
+
+# ===== EMITTERS =====
+
+def emit_m2cgen(forest, symbol_prefix=''):
+    """Reproduce m2cgen's branchy C output (reference for benchmarks)."""
+    out = []
+    out.append('double %s%s(double * input) {' % (symbol_prefix, forest.function_name))
+
+    def emit(node, var, depth):
+        ind = '    ' * depth
+        if is_leaf(node):
+            out.append('%svar%d = %r;' % (ind, var, node))
+            return
+        out.append('%sif (input[%d] <= %r) {' % (ind, node[0], node[1]))
+        emit(node[2], var, depth + 1)
+        out.append('%s} else {' % ind)
+        emit(node[3], var, depth + 1)
+        out.append('%s}' % ind)
+
+    for i, tree in enumerate(forest.trees):
+        out.append('    double var%d;' % i)
+        emit(tree, i, 1)
+    total = ' + '.join('var%d' % i for i in range(len(forest.trees)))
+    out.append('    return (%s) * %r;' % (total, forest.scale))
+    out.append('}')
+    return '\r\n'.join(out) + '\r\n'
+
+
+def profile_forest(forest, rows):
+    """Count how often each split sends the replayed rows left and right."""
+    profile = {}
+    for tree in forest.trees:
+        for x in rows:
+            node = tree
+            while not is_leaf(node):
+                counts = profile.setdefault(id(node), [0, 0])
+                right = not x[node[0]] <= node[1]
+                counts[right] += 1
+                node = node[3] if right else node[2]
+    return profile
+
+
+def _hot_right(forest, node):
+    n_left, n_right = forest.profile.get(id(node), (0, 0))
+    return n_right > n_left
+
+
+def flatten(forest):
+    """Lay the trees out as structure-of-arrays tables.
+
+    Pre-order, left child first. With forest.profile (opt-in, --profile)
+    the hot path of every tree (the more frequent child at each split) comes
+    first, tree after tree, so the nodes most rows visit share a few cache
+    lines; cold subtrees follow out of line, most visited first, each laid
+    out the same way. On the host this halves the lines touched per
+    prediction but gives no repeatable speedup, so it is not the default.
+
+    Leaves form one pool: trees share the leaf_value entry of an equal
+    value, numbered in first-use order.
+    """
+    if forest.profile is not None:
+        return _flatten_hot(forest)
+    roots, feature, threshold, children, leaves = [], [], [], [], []
+    pool = {}
+
+    def walk(node):
+        if is_leaf(node):
+            return _leaf_ref(leaves, pool, node)
+        idx = len(feature)
+        feature.append(node[0])
+        threshold.append(node[1])
+        children.extend((0, 0))
+        children[2 * idx] = walk(node[2])
+        children[2 * idx + 1] = walk(node[3])
+        return idx
+
+    for tree in forest.trees:
+        roots.append(walk(tree))
+
+    assert len(feature) < 32768 and len(leaves) <= 32768, 'int16 child indices overflow'
+    return roots, feature, threshold, children, leaves
+
+
+def _leaf_ref(leaves, pool, value):
+    # Key on the bit pattern so -0.0 and 0.0 stay apart (bit-exact sums)
+    key = struct.pack('<%dd' % len(value), *value) if isinstance(value, list) else struct.pack('<d', value)
+    if key not in pool:
+        pool[key] = len(leaves)
+        leaves.append(value)
+    return ~pool[key]
+
+
+def _flatten_hot(forest):
+    roots, feature, threshold, children, leaves = [], [], [], [], []
+    pool = {}
+    cold = []               # heap of (-visits, seq, subtree, children slot)
+    seq = [0]
+
+    def chain(node, slot):
+        # Place node and its hot descendants contiguously; queue the cold siblings
+        while True:
+            if is_leaf(node):
+                ref = _leaf_ref(leaves, pool, node)
+            else:
+                ref = len(feature)
+            if slot is None:
+                roots.append(ref)
+            else:
+                children[slot] = ref
+            if is_leaf(node):
+                return
+            feature.append(node[0])
+            threshold.append(node[1])
+            children.extend((0, 0))
+            right = _hot_right(forest, node)
+            visits = forest.profile.get(id(node), (0, 0))[not right]
+            seq[0] += 1
+            heapq.heappush(cold, (-visits, seq[0], node[2] if right else node[3], 2 * ref + (not right)))
+            node, slot = (node[3] if right else node[2]), 2 * ref + right
+
+    for tree in forest.trees:
+        chain(tree, None)
+    while cold:
+        _, _, node, slot = heapq.heappop(cold)
+        chain(node, slot)
+
+    assert len(feature) < 32768 and len(leaves) <= 32768, 'int16 child indices overflow'
+    return roots, feature, threshold, children, leaves
+
+
+def hot_path_stats(forest):
+    """(hot fraction of split decisions, hot-path nodes) under forest.profile."""
+    hot = total = 0
+    for counts in forest.profile.values():
+        hot += max(counts)
+        total += sum(counts)
+    n_hot = 0
+    for tree in forest.trees:
+        node = tree
+        while not is_leaf(node):
+            n_hot += 1
+            node = node[3] if _hot_right(forest, node) else node[2]
+    return hot / max(total, 1), n_hot
+
+
+def _c_array(ctype, name, values, fmt, per_line):
+    lines = ['static const %s %s[%d] = {' % (ctype, name, len(values))]
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(fmt(v) for v in values[i:i + per_line]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def _c_double(v):
+    r = repr(float(v))
+    return r if ('.' in r or 'e' in r or 'inf' in r or 'nan' in r) else r + '.0'
+
+
+def _f32(v):
+    """v rounded to the nearest float32."""
+    return struct.unpack('<f', struct.pack('<f', v))[0]
+
+
+def _f32_next_down(f):
+    bits = struct.unpack('<I', struct.pack('<f', f))[0]
+    if f == 0:
+        bits = 0x80000001               # smallest negative subnormal
+    else:
+        bits += -1 if f > 0 else 1
+    return struct.unpack('<f', struct.pack('<I', bits))[0]
+
+
+def _f32_below(v):
+    """Largest float32 <= v: for every float32 x, x <= result exactly when x <= v."""
+    f = _f32(v)
+    return _f32_next_down(f) if f > v else f
+
+
+def _c_float(f):
+    """Shortest literal a C compiler reads back as the float32 f."""
+    lo = (Fraction(_f32_next_down(f)) + Fraction(f)) / 2
+    hi = (Fraction(f) - Fraction(_f32_next_down(-f))) / 2
+    for digits in range(6, 10):
+        r = '%.*g' % (digits, f)
+        if lo < Fraction(r) < hi:
+            break
+    assert lo < Fraction(r) < hi, '%r has no float32 literal' % f
+    return (r if ('.' in r or 'e' in r) else r + '.0') + 'f'
+
+
+def quickscorer_tables(forest):
+    """Per-feature sorted thresholds with 64-bit leaf masks (QuickScorer)."""
+    nodes, leaf_offset, leaves = [], [], []
+    n_leaves = 0
+
+    def walk(node, tree, first_leaf):
+        # Returns the number of leaves under node; leaves are numbered left to right
+        if is_leaf(node):
+            leaves.append(node)
+            return 1
+        n_left = walk(node[2], tree, first_leaf)
+        n_right = walk(node[3], tree, first_leaf + n_left)
+        left_bits = ((1 << n_left) - 1) << first_leaf
+        nodes.append((node[0], node[1], tree, ~left_bits & 0xFFFFFFFFFFFFFFFF))
+        return n_left + n_right
+
+    for t, tree in enumerate(forest.trees):
+        leaf_offset.append(n_leaves)
+        count = walk(tree, t, 0)
+        assert count <= 64, 'QuickScorer needs <= 64 leaves per tree'
+        n_leaves += count
+
+    nodes.sort(key=lambda n: (n[0], n[1]))
+    feature_offset = [0] * (forest.n_features + 1)
+    for n in nodes:
+        feature_offset[n[0] + 1] += 1
+    for f in range(forest.n_features):
+        feature_offset[f + 1] += feature_offset[f]
+    return feature_offset, nodes, leaf_offset, leaves
+
+
+BIN_SLOT_RANGE = 255      # EPS_BINNED_SLOT_RANGE (eps_forest_binned.h)
+
+
+def binned_tables(forest):
+    """Distinct thresholds per feature and 8-bit bin IDs per node (eps_forest_binned.h).
+
+    Node "x <= T_j" becomes "rank(x) <= j"; ranks are split into uint8
+    slots of BIN_SLOT_RANGE thresholds each.
+    """
+    roots, feature, threshold, children, leaves = flatten(forest)
+    split_offset, split = [0], []
+    slot_feature, slot_base, slot_of = [], [], {}
+    rank = {}
+    for f in range(forest.n_features):
+        values = sorted(set(t for ff, t in zip(feature, threshold) if ff == f))
+        for j, v in enumerate(values):
+            rank[f, v] = j
+        split += values
+        split_offset.append(len(split))
+        for k in range((len(values) + BIN_SLOT_RANGE - 1) // BIN_SLOT_RANGE):
+            slot_of[f, k] = len(slot_feature)
+            slot_feature.append(f)
+            slot_base.append(k * BIN_SLOT_RANGE)
+    assert len(slot_feature) <= 32, 'more bin slots than EPS_BINNED_MAX_SLOTS'
+
+    node_slot, node_bin = [], []
+    for f, t in zip(feature, threshold):
+        j = rank[f, t]
+        node_slot.append(slot_of[f, j // BIN_SLOT_RANGE])
+        node_bin.append(j % BIN_SLOT_RANGE)
+    return split_offset, split, slot_feature, slot_base, node_slot, node_bin
+
+
+IMPLICIT_DEPTH = 6        # EPS_IMPLICIT_DEPTH default (eps_forest_implicit.h)
+
+
+def tree_depth(node):
+    return 0 if is_leaf(node) else 1 + max(tree_depth(node[2]), tree_depth(node[3]))
+
+
+def implicit_tables(forest, depth=IMPLICIT_DEPTH):
+    """Pad every tree to a perfect tree of depth levels (children of i at 2i+1, 2i+2).
+
+    A leaf above the last level becomes dummy splits (feature 0, threshold
+    0.0) whose subtrees all hold the leaf's value, so any path through them
+    ends at the same value.
+    """
+    n_nodes, n_leaves = 2 ** depth - 1, 2 ** depth
+    feature, threshold, leaves = [], [], []
+    for tree in forest.trees:
+        assert tree_depth(tree) <= depth, 'tree deeper than EPS_IMPLICIT_DEPTH=%d' % depth
+        f, t, v = [0] * n_nodes, [0.0] * n_nodes, [None] * n_leaves
+
+        def fill(node, i):
+            if i >= n_nodes:
+                v[i - n_nodes] = node
+                return
+            if is_leaf(node):
+                fill(node, 2 * i + 1)
+                fill(node, 2 * i + 2)
+                return
+            f[i], t[i] = node[0], node[1]
+            fill(node[2], 2 * i + 1)
+            fill(node[3], 2 * i + 2)
+
+        fill(tree, 0)
+        feature += f
+        threshold += t
+        leaves += v
+    return feature, threshold, leaves
+
+
+# ===== TELEMETRY ROWS =====
+
+FEATURE_SPEC = eps_feature_spec.load()
+
+# Fixed-point units (eps_forest_fixed.h): voltage in uV, current in uA, power in pW
+FIXED_UNIT = 1000                                   # uV per mV, uA per mA
+FIXED_MODEL_UNIT = {'power': 10 ** 6, 'voltage': 1000}    # pW per uW, uV per mV
+
+
+def load_telemetry_rows(path, fixed=False, targets=False):
+    """Feature rows exactly as deploy/host/eps_replay.c builds them (feature_spec.json).
+
+    Accepts the raw .xlsx workbook or a replay CSV from export_replay.py.
+    With fixed=True the rows are integers in the eps_fixed_pipeline.c units.
+    Returns (power_rows, voltage_rows), plus the measured (power, voltage)
+    of each row with targets=True.
+    """
+    segments, volts, amps = [], [], []
+    if path.endswith('.xlsx'):
+        sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), 'deploy', 'host'))
+        import export_replay
+        for segment, (name, rows) in enumerate(export_replay.read_workbook(path)):
+            for row in rows[1:]:
+                segments.append(segment)
+                volts.append([export_replay._num(row.get(c)) for c in export_replay.VOLT_COLUMNS])
+                amps.append([export_replay._num(row.get(c)) for c in export_replay.AMP_COLUMNS])
+    else:
+        with open(path) as f:
+            next(f)
+            for line in f:
+                fields = line.strip().split(',')
+                values = [float(v) for v in fields[1:]]
+                segments.append(int(fields[0]))
+                volts.append(values[0::2])
+                amps.append(values[1::2])
+
+    if fixed:
+        volts = [[round(v * FIXED_UNIT) for v in vs] for vs in volts]
+        amps = [[round(i * FIXED_UNIT) for i in cs] for cs in amps]
+    power = [[v * i for v, i in zip(vs, cs)] for vs, cs in zip(volts, amps)]
+    power_rows, voltage_rows, power_y, voltage_y = [], [], [], []
+    history = eps_feature_spec.history(FEATURE_SPEC)
+    for panel in range(len(volts[0]) if volts else 0):
+        signals = {'power': [p[panel] for p in power], 'voltage': [v[panel] for v in volts]}
+        seg_start = 0
+        for t in range(len(segments)):
+            if segments[t] != segments[seg_start]:
+                seg_start = t
+            if t - seg_start < history:
+                continue
+            power_rows.append(eps_feature_spec.row(FEATURE_SPEC, 'power', signals, t))
+            voltage_rows.append(eps_feature_spec.row(FEATURE_SPEC, 'voltage', signals, t))
+            power_y.append(signals[FEATURE_SPEC['models']['power']['target']][t])
+            voltage_y.append(signals[FEATURE_SPEC['models']['voltage']['target']][t])
+    if targets:
+        return power_rows, voltage_rows, power_y, voltage_y
+    return power_rows, voltage_rows
+
+
+# ===== QUANTIZED FORMAT (eps_forest_q.h) =====
+# Each feature maps to a 16-bit code = bucket + rank. The bucket is
+# floor((x - offset) / step) with a power-of-two step; rank counts the
+# feature's split values below x. A threshold becomes a split value when its
+# bucket holds recorded telemetry values on both sides of it, so every split
+# decision on that telemetry is unchanged while node thresholds shrink to codes.
+
+Q_MAX_CODES = 65535     # bucket count + split count, so every code fits uint16
+
+
+def _q_bucket(x, offset, inv_step):
+    # Same expression, in the same order, as eps_forest_q_code()
+    return math.floor((x - offset) * inv_step)
+
+
+def _quantize_feature(thresholds, values, step):
+    """Quantizer for one feature at a given step, or None if the codes overflow."""
+    t_min, t_max = min(thresholds), max(thresholds)
+    offset = (math.floor(t_min / step) - 1) * step
+    if isinstance(step, int):
+        offset = (t_min // step - 1) * step
+    inv_step = 1.0 / step
+    n_buckets = _q_bucket(t_max, offset, inv_step) + 2
+    if n_buckets > Q_MAX_CODES:
+        return None
+
+    # Telemetry values grouped by bucket
+    in_bucket = {}
+    for x in values:
+        b = min(max(_q_bucket(x, offset, inv_step), 0), n_buckets - 1)
+        in_bucket.setdefault(b, []).append(x)
+
+    splits, side = set(), {}
+    for t in set(thresholds):
+        b = _q_bucket(t, offset, inv_step)
+        bucket = in_bucket.get(b, [])
+        k = bisect.bisect_right(bucket, t)
+        if 0 < k < len(bucket):
+            splits.add(t)
+        side[t] = (b, k == 0 and len(bucket) > 0)   # True: bucket lies entirely above t
+    splits = sorted(splits)
+    if n_buckets + len(splits) > Q_MAX_CODES:
+        return None
+
+    # Code of each threshold: x <= t  <=>  code(x) <= code(t) on the telemetry values
+    codes = {}
+    for t, (b, above) in side.items():
+        if t in splits:
+            codes[t] = b + bisect.bisect_left(splits, t)
+        elif above:
+            codes[t] = b - 1 + bisect.bisect_left(splits, offset + b * step)
+        else:
+            codes[t] = b + bisect.bisect_left(splits, offset + (b + 1) * step)
+    return (offset, inv_step, n_buckets, splits), codes
+
+
+def quantize_forest(forest, rows, unit=None):
+    """Per-feature quantizers, node threshold codes and int32 leaves.
+
+    With unit set, rows are integers in 1/unit of the model's feature units
+    and the quantizer works on them with integer offsets and steps (the
+    fixed-point backend); thresholds become floor(t * unit), exact for
+    integer inputs.
+
+    Returns dict(features=[(offset, inv_step, n_buckets, splits)],
+    threshold=[code per node], leaves=[int32], leaf_shift, leaf_scale).
+    """
+    roots, feature, threshold, children, leaves = flatten(forest)
+    if unit is not None:
+        threshold = [math.floor(Fraction(t) * unit) for t in threshold]
+    features = []
+    codes = [None] * len(feature)
+    for f in range(forest.n_features):
+        nodes = [i for i, ff in enumerate(feature) if ff == f]
+        if not nodes:
+            features.append((0.0, 1.0, 1, []))
+            continue
+        thresholds = [threshold[i] for i in nodes]
+        values = sorted(set(r[f] for r in rows))
+
+        # Finest power-of-two step whose codes fit 16 bits
+        span = max(max(thresholds) - min(thresholds), 1e-300)
+        step = 2.0 ** math.ceil(math.log2(span / (Q_MAX_CODES - 2)))
+        if unit is not None:
+            step = max(int(step), 1)
+        result = _quantize_feature(thresholds, values, step)
+        while result is None:
+            step *= 2
+            result = _quantize_feature(thresholds, values, step)
+        features.append(result[0])
+        for i in nodes:
+            codes[i] = result[1][threshold[i]]
+
+    # Leaves: largest power-of-two scale that keeps the sum over all trees in int32
+    peak = max(abs(v) for v in leaves) or 1.0
+    shift = math.floor(math.log2((2 ** 31 - 1) / (len(roots) * peak)))
+    leaves_q = [int(round(v * 2.0 ** shift)) for v in leaves]
+    assert len(roots) * max(abs(v) for v in leaves_q) < 2 ** 31
+
+    return dict(features=features, threshold=codes, leaves=leaves_q, leaf_shift=shift,
+                leaf_scale=forest.scale * 2.0 ** -shift)
+
+
+def q_code(quant, f, x):
+    offset, inv_step, n_buckets, splits = quant['features'][f]
+    if not x <= x:                      # NaN takes the right branch everywhere
+        return n_buckets - 1 + len(splits)
+    b = min(max(_q_bucket(x, offset, inv_step), 0), n_buckets - 1)
+    return b + bisect.bisect_left(splits, x)
+
+
+def check_quantized_paths(forest, quant, rows, code_rows=None):
+    """Number of (row, tree) pairs whose quantized walk ends at a different leaf.
+
+    The reference walk uses the double rows; codes come from code_rows
+    (the integer rows of the fixed-point backend) when given.
+    """
+    roots, feature, threshold, children, leaves = flatten(forest)
+    codes = quant['threshold']
+    bad = 0
+    for r, x in enumerate(rows):
+        xc = code_rows[r] if code_rows is not None else x
+        xq = [q_code(quant, f, xc[f]) for f in range(forest.n_features)]
+        for root in roots:
+            a = b = root
+            while a >= 0:
+                a = children[2 * a + (not x[feature[a]] <= threshold[a])]
+            while b >= 0:
+                b = children[2 * b + (xq[feature[b]] > codes[b])]
+            bad += a != b
+    return bad
+
+
+def _backend_guard(*backends):
+    return '#if ' + ' || '.join('EPS_FOREST_HAS_BACKEND(EPS_FOREST_BACKEND_%s)' % b for b in backends)
+
+
+def _x_macro(name, params, entries):
+    """#define name(params) with one line per (call, comment) entry."""
+    if not entries:
+        return ['#define %s(%s)' % (name, params)]
+    lines = ['#define %s(%s) \\' % (name, params)]
+    lines += ['    %-28s/* %s */ \\' % entry for entry in entries]
+    lines[-1] = lines[-1][:-2].rstrip()
+    return lines
+
+
+def emit_feature_header(spec):
+    """deploy/c_code/eps_feature_spec.h: the feature spec as C constants and X-macros."""
+    fs = eps_feature_spec
+    max_age = fs.max_age(spec)
+    ring = 1
+    while ring <= max_age:
+        ring *= 2
+    diff_signals = {f['signal'] for m in spec['models'].values() for f in m['features'] if f.get('diff')}
+    windows = fs.rolling(spec)
+    stats = fs.stats(spec)
+    out = ['/**',
+           ' * EPS Predictive FDIR - Feature Spec',
+           ' * Generated by eps_forest_export.py from deploy/models/feature_spec.json; do not edit',
+           ' *',
+           ' * A model predicting sample t reads, for feature i of signal s at age a',
+           ' * (a = lag + EPS_SPEC_TARGET_SHIFT):',
+           ' *   LAG   s[t - a]',
+           ' *   DIFF  s[t - a] - s[t - a - 1]',
+           ' *   STAT  rolling statistic j (EPS_SPEC_STATS) over the window ending at s[t - a]',
+           ' * EPS_SPEC_<MODEL>_FEATURES(F) expands F(index, kind, signal or j, age) once',
+           ' * per feature in model input order; each feature engine turns it into',
+           ' * straight-line ring loads. Rolling statistics (eps_rolling.h) are updated',
+           ' * once per sample per EPS_SPEC_ROLLING window and stored in a ring per',
+           ' * EPS_SPEC_STATS series, like the first differences.',
+           ' */',
+           '',
+           '#ifndef EPS_FEATURE_SPEC_H',
+           '#define EPS_FEATURE_SPEC_H',
+           '',
+           '#define EPS_SPEC_TARGET_SHIFT  %d' % spec['target_shift'],
+           '#define EPS_SPEC_MAX_AGE       %d   // Oldest ring slot read, counted back from the predicted sample' % max_age,
+           '#define EPS_SPEC_RING          %d   // Power of two > EPS_SPEC_MAX_AGE' % ring,
+           '#define EPS_SPEC_HISTORY       %d   // Samples before the predicted one a full row needs'
+           % fs.history(spec),
+           '']
+    for signal in spec['signals']:
+        out.append('%-32s%d   // 1: a diff feature reads this signal' %
+                   ('#define EPS_SPEC_%s_DIFF' % signal.upper(), signal in diff_signals))
+    out.append('')
+    out.append('#define EPS_SPEC_N_ROLLING      %d' % len(windows))
+    out.append('#define EPS_SPEC_MAX_WINDOW     %d' % max([w for _, w in windows] or [0]))
+    out += _x_macro('EPS_SPEC_ROLLING', 'R', [('R(%d, %s, %d)' % (k, sig, w), '%s over %d samples' % (sig, w))
+                                              for k, (sig, w) in enumerate(windows)])
+    out.append('#define EPS_SPEC_N_STATS        %d' % len(stats))
+    out += _x_macro('EPS_SPEC_STATS', 'S', [('S(%d, %d, %s)' % (j, k, stat), '%s %s over %d' % (
+        windows[k][0], stat, windows[k][1])) for j, (k, stat) in enumerate(stats)])
+    for model, m in spec['models'].items():
+        entries = []
+        for i, f in enumerate(m['features']):
+            if 'stat' in f:
+                kind, what = 'STAT', stats.index((windows.index((f['signal'], f['window'])), f['stat']))
+            else:
+                kind, what = ('DIFF' if f.get('diff') else 'LAG'), f['signal']
+            entries.append(('F(%d, %s, %s, %d)' % (i, kind, what, fs.age(spec, f)), f['name']))
+        out.append('')
+        out.append('#define EPS_SPEC_%s_N_FEATURES  %d' % (model.upper(), len(entries)))
+        out += _x_macro('EPS_SPEC_%s_FEATURES' % model.upper(), 'F', entries)
+    out.append('')
+    out.append('#endif // EPS_FEATURE_SPEC_H')
+    return '\r\n'.join(out) + '\r\n'
+
+
+def emit_model_header(forest, prefix, source_desc, model_hash):
+    """<prefix>_model.h: the eps_model_<prefix>_* API of eps_model_abi.h."""
+    guard = 'EPS_MODEL_%s_H' % prefix.upper()
+    macro = 'EPS_MODEL_%s' % prefix.upper()
+    api = 'eps_model_%s' % prefix
+    out = []
+    out.append('/**')
+    out.append(' * EPS Predictive FDIR - %s model API' % prefix.capitalize())
+    out.append(' * Generated by eps_forest_export.py from %s -- do not edit' % source_desc)
+    out.append(' *')
+    out.append(' * Entry points follow eps_model_abi.h; the tables are in %s_model.c' % prefix)
+    out.append(' */')
+    out.append('')
+    out.append('#ifndef %s' % guard)
+    out.append('#define %s' % guard)
+    out.append('')
+    out.append('#include "eps_forest.h"')
+    out.append('#include "eps_model_abi.h"')
+    out.append('#include <stdint.h>')
+    out.append('')
+    out.append('#define %s_ABI         %d' % (macro, MODEL_ABI_VERSION))
+    out.append('#define %s_N_FEATURES  %d' % (macro, forest.n_features))
+    out.append('#define %s_HASH        0x%08Xu   // CRC-32 of %s_model.bin' % (macro, model_hash, prefix))
+    out.append('')
+    out.append('#if %s_ABI != EPS_MODEL_ABI_VERSION' % macro)
+    out.append('#error "%s_model.h was generated for another model ABI; rerun eps_forest_export.py"' % prefix)
+    out.append('#endif')
+    out.append('')
+    out.append('uint16_t %s_n_features(void);' % api)
+    out.append('uint32_t %s_hash(void);' % api)
+    out.append('')
+    out.append('#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_FIXED')
+    out.append('int64_t %s_score_fixed(const int64_t *x);' % api)
+    out.append('#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_FLOAT32')
+    out.append('float %s_score_f32(const float *x);' % api)
+    out.append('void %s_score_batch_f32(const float x[][%s_N_FEATURES], float *out, int n);' % (api, macro))
+    out.append('#else')
+    out.append('double %s_score(const double *x);' % api)
+    out.append('void %s_score_batch(const double x[][%s_N_FEATURES], double *out, int n);' % (api, macro))
+    out.append('#endif')
+    out.append('')
+    out.append('#endif // %s' % guard)
+    out.append('')
+    return '\n'.join(out)
+
+
+def emit_tables(forest, prefix, source_desc, quant, quant_fixed, fixed_unit):
+    roots, feature, threshold, children, leaves = flatten(forest)
+    macro = 'EPS_MODEL_%s' % prefix.upper()
+    api = 'eps_model_%s' % prefix
+    out = []
+    out.append('/**')
+    out.append(' * EPS Predictive FDIR - %s model (table-driven RandomForest)' % prefix.capitalize())
+    out.append(' * Generated by eps_forest_export.py from %s -- do not edit' % source_desc)
+    out.append(' *')
+    out.append(' * Trees: %d, internal nodes: %d, leaves: %d (%d distinct values), features: %d'
+               % (len(roots), len(feature), len(feature) + len(roots), len(leaves), forest.n_features))
+    out.append(' * Backend selected with EPS_FOREST_BACKEND (eps_forest.h)')
+    if forest.profile is not None:
+        out.append(' * Node layout: hot path of each tree first, cold subtrees out of line (replay profile)')
+    out.append(' */')
+    out.append('')
+    out.append('#include "eps_forest.h"')
+    out.append('#include "eps_forest_binned.h"')
+    out.append('#include "eps_forest_f32.h"')
+    out.append('#include "eps_forest_fixed.h"')
+    out.append('#include "eps_forest_implicit.h"')
+    out.append('#include "eps_forest_q.h"')
+    out.append('#include "eps_forest_qs.h"')
+    out.append('#include "%s_model.h"' % prefix)
+    out.append('')
+    out.append('#if %s_N_FEATURES != %d' % (macro, forest.n_features))
+    out.append('#error "%s_model.h does not match these tables; rerun eps_forest_export.py"' % prefix)
+    out.append('#endif')
+    out.append('')
+    # Node links (shared by the double, binned and single-precision walks)
+    out.append(_backend_guard('TABLE', 'BINNED', 'FLOAT32'))
+    out.append('')
+    out.append(_c_array('int16_t', '%s_roots' % prefix, roots, str, 16))
+    out.append('')
+    out.append(_c_array('int16_t', '%s_children' % prefix, children, str, 16))
+    out.append('')
+    out.append('#endif')
+    out.append('')
+    out.append(_backend_guard('TABLE', 'BINNED'))
+    out.append('')
+    out.append(_c_array('double', '%s_leaf_value' % prefix, leaves, _c_double, 4))
+    out.append('')
+    out.append('#endif')
+    out.append('')
+    out.append(_backend_guard('TABLE', 'FLOAT32'))
+    out.append('')
+    out.append(_c_array('uint8_t', '%s_feature' % prefix, feature, str, 24))
+    out.append('')
+    out.append('#endif')
+    out.append('')
+
+    # Tree walk tables
+    out.append(_backend_guard('TABLE'))
+    out.append('')
+    out.append(_c_array('double', '%s_threshold' % prefix, threshold, _c_double, 4))
+    out.append('')
+    out.append('const EPS_Forest eps_%s_forest = {' % prefix)
+    out.append('    .n_features = %d,' % forest.n_features)
+    out.append('    .n_trees = %d,' % len(roots))
+    out.append('    .n_nodes = %d,' % len(feature))
+    out.append('    .n_leaves = %d,' % len(leaves))
+    out.append('    .scale = %s,' % _c_double(forest.scale))
+    out.append('    .roots = %s_roots,' % prefix)
+    out.append('    .feature = %s_feature,' % prefix)
+    out.append('    .threshold = %s_threshold,' % prefix)
+    out.append('    .children = %s_children,' % prefix)
+    out.append('    .leaf_value = %s_leaf_value,' % prefix)
+    out.append('};')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+
+    # Single-precision tables: thresholds rounded down keep every split of a
+    # float row exact, leaves rounded to nearest
+    out.append(_backend_guard('FLOAT32'))
+    out.append('')
+    out.append(_c_array('float', '%s_f32_threshold' % prefix, [_f32_below(t) for t in threshold], _c_float, 6))
+    out.append('')
+    out.append(_c_array('float', '%s_f32_leaf_value' % prefix, [_f32(v) for v in leaves], _c_float, 6))
+    out.append('')
+    out.append('const EPS_ForestF32 eps_%s_forest_f32 = {' % prefix)
+    out.append('    .n_features = %d,' % forest.n_features)
+    out.append('    .n_trees = %d,' % len(roots))
+    out.append('    .n_nodes = %d,' % len(feature))
+    out.append('    .n_leaves = %d,' % len(leaves))
+    out.append('    .scale = %s,' % _c_float(_f32(forest.scale)))
+    out.append('    .roots = %s_roots,' % prefix)
+    out.append('    .feature = %s_feature,' % prefix)
+    out.append('    .threshold = %s_f32_threshold,' % prefix)
+    out.append('    .children = %s_children,' % prefix)
+    out.append('    .leaf_value = %s_f32_leaf_value,' % prefix)
+    out.append('};')
+    out.append('')
+    out.append('float %s_score_f32(const float *x) {' % api)
+    out.append('    return eps_forest_f32_score(&eps_%s_forest_f32, x);' % prefix)
+    out.append('}')
+    out.append('')
+    out.append('void %s_score_batch_f32(const float x[][%s_N_FEATURES], float *out, int n) {' % (api, macro))
+    out.append('    eps_forest_f32_score_batch(&eps_%s_forest_f32, &x[0][0], %s_N_FEATURES, out, n);' % (prefix, macro))
+    out.append('}')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+
+    # QuickScorer tables (leaves left to right in each tree, independent of the node layout)
+    feature_offset, qs_nodes, leaf_offset, qs_leaves = quickscorer_tables(forest)
+    out.append(_backend_guard('QUICKSCORER'))
+    out.append('')
+    out.append(_c_array('uint16_t', '%s_qs_feature_offset' % prefix, feature_offset, str, 16))
+    out.append('')
+    out.append(_c_array('double', '%s_qs_threshold' % prefix, [n[1] for n in qs_nodes], _c_double, 4))
+    out.append('')
+    out.append(_c_array('uint16_t', '%s_qs_tree' % prefix, [n[2] for n in qs_nodes], str, 16))
+    out.append('')
+    out.append(_c_array('uint64_t', '%s_qs_mask' % prefix, [n[3] for n in qs_nodes],
+                        lambda m: '0x%016XULL' % m, 4))
+    out.append('')
+    out.append(_c_array('uint16_t', '%s_qs_leaf_offset' % prefix, leaf_offset, str, 16))
+    out.append('')
+    out.append(_c_array('double', '%s_qs_leaf_value' % prefix, qs_leaves, _c_double, 4))
+    out.append('')
+    out.append('const EPS_ForestQS eps_%s_forest_qs = {' % prefix)
+    out.append('    .n_features = %d,' % forest.n_features)
+    out.append('    .n_trees = %d,' % len(roots))
+    out.append('    .n_nodes = %d,' % len(qs_nodes))
+    out.append('    .scale = %s,' % _c_double(forest.scale))
+    out.append('    .feature_offset = %s_qs_feature_offset,' % prefix)
+    out.append('    .threshold = %s_qs_threshold,' % prefix)
+    out.append('    .tree = %s_qs_tree,' % prefix)
+    out.append('    .mask = %s_qs_mask,' % prefix)
+    out.append('    .leaf_offset = %s_qs_leaf_offset,' % prefix)
+    out.append('    .leaf_value = %s_qs_leaf_value,' % prefix)
+    out.append('};')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+
+    # Quantized tables
+    out.append(_backend_guard('QUANTIZED'))
+    out.append('')
+    splits = [v for q in quant['features'] for v in q[3]]
+    if splits:
+        out.append(_c_array('double', '%s_q_split' % prefix, splits, _c_double, 4))
+        out.append('')
+    out.append('static const EPS_QFeature %s_q_feature[%d] = {' % (prefix, forest.n_features))
+    first = 0
+    for offset, inv_step, n_buckets, feature_splits in quant['features']:
+        split_ptr = ('%s_q_split + %d' % (prefix, first)) if feature_splits else 'NULL'
+        out.append('    {%s, %s, %d, %d, %s},' % (_c_double(offset), _c_double(inv_step), n_buckets,
+                                                len(feature_splits), split_ptr))
+        first += len(feature_splits)
+    out.append('};')
+    out.append('')
+    out.append(_c_array('int16_t', '%s_q_roots' % prefix, roots, str, 16))
+    out.append('')
+    out.append(_c_array('uint8_t', '%s_q_feature_index' % prefix, feature, str, 24))
+    out.append('')
+    out.append(_c_array('uint16_t', '%s_q_threshold' % prefix, quant['threshold'], str, 12))
+    out.append('')
+    out.append(_c_array('int16_t', '%s_q_children' % prefix, children, str, 16))
+    out.append('')
+    out.append(_c_array('int32_t', '%s_q_leaf_value' % prefix, quant['leaves'], str, 8))
+    out.append('')
+    out.append('const EPS_ForestQ eps_%s_forest_q = {' % prefix)
+    out.append('    .n_features = %d,' % forest.n_features)
+    out.append('    .n_trees = %d,' % len(roots))
+    out.append('    .n_nodes = %d,' % len(feature))
+    out.append('    .n_leaves = %d,' % len(leaves))
+    out.append('    .leaf_scale = %s,' % _c_double(quant['leaf_scale']))
+    out.append('    .quant = %s_q_feature,' % prefix)
+    out.append('    .roots = %s_q_roots,' % prefix)
+    out.append('    .feature = %s_q_feature_index,' % prefix)
+    out.append('    .threshold = %s_q_threshold,' % prefix)
+    out.append('    .children = %s_q_children,' % prefix)
+    out.append('    .leaf_value = %s_q_leaf_value,' % prefix)
+    out.append('};')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+
+    # Fixed-point tables
+    out.append(_backend_guard('FIXED'))
+    out.append('')
+    splits = [v for q in quant_fixed['features'] for v in q[3]]
+    if splits:
+        out.append(_c_array('int64_t', '%s_fx_split' % prefix, splits, lambda v: '%dLL' % v, 6))
+        out.append('')
+    out.append('static const EPS_FixedFeature %s_fx_feature[%d] = {' % (prefix, forest.n_features))
+    first = 0
+    for offset, inv_step, n_buckets, feature_splits in quant_fixed['features']:
+        split_ptr = ('%s_fx_split + %d' % (prefix, first)) if feature_splits else 'NULL'
+        shift = int(round(-math.log2(inv_step)))
+        out.append('    {%dLL, %d, %d, %d, %s},' % (offset, shift, n_buckets, len(feature_splits), split_ptr))
+        first += len(feature_splits)
+    out.append('};')
+    out.append('')
+    out.append(_c_array('int16_t', '%s_fx_roots' % prefix, roots, str, 16))
+    out.append('')
+    out.append(_c_array('uint8_t', '%s_fx_feature_index' % prefix, feature, str, 24))
+    out.append('')
+    out.append(_c_array('uint16_t', '%s_fx_threshold' % prefix, quant_fixed['threshold'], str, 12))
+    out.append('')
+    out.append(_c_array('int16_t', '%s_fx_children' % prefix, children, str, 16))
+    out.append('')
+    out.append(_c_array('int32_t', '%s_fx_leaf_value' % prefix, quant_fixed['leaves'], str, 8))
+    out.append('')
+    assert fixed_unit % len(roots) == 0, 'fixed-point unit must divide by the tree count'
+    out.append('const EPS_ForestFixed eps_%s_forest_fixed = {' % prefix)
+    out.append('    .n_features = %d,' % forest.n_features)
+    out.append('    .n_trees = %d,' % len(roots))
+    out.append('    .n_nodes = %d,' % len(feature))
+    out.append('    .n_leaves = %d,' % len(leaves))
+    out.append('    .pred_mul = %d,' % (fixed_unit // len(roots)))
+    out.append('    .pred_shift = %d,' % quant_fixed['leaf_shift'])
+    out.append('    .quant = %s_fx_feature,' % prefix)
+    out.append('    .roots = %s_fx_roots,' % prefix)
+    out.append('    .feature = %s_fx_feature_index,' % prefix)
+    out.append('    .threshold = %s_fx_threshold,' % prefix)
+    out.append('    .children = %s_fx_children,' % prefix)
+    out.append('    .leaf_value = %s_fx_leaf_value,' % prefix)
+    out.append('};')
+    out.append('')
+    out.append('int64_t %s_score_fixed(const int64_t *x) {' % api)
+    out.append('    return eps_forest_fixed_score(&eps_%s_forest_fixed, x);' % prefix)
+    out.append('}')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+
+    # Binned tables: per-feature thresholds, uint8 bin IDs at the nodes
+    split_offset, split, slot_feature, slot_base, node_slot, node_bin = binned_tables(forest)
+    out.append(_backend_guard('BINNED'))
+    out.append('')
+    out.append(_c_array('uint16_t', '%s_bn_split_offset' % prefix, split_offset, str, 16))
+    out.append('')
+    out.append(_c_array('double', '%s_bn_split' % prefix, split, _c_double, 4))
+    out.append('')
+    out.append(_c_array('uint8_t', '%s_bn_slot_feature' % prefix, slot_feature, str, 24))
+    out.append('')
+    out.append(_c_array('uint16_t', '%s_bn_slot_base' % prefix, slot_base, str, 16))
+    out.append('')
+    out.append(_c_array('uint8_t', '%s_bn_slot' % prefix, node_slot, str, 24))
+    out.append('')
+    out.append(_c_array('uint8_t', '%s_bn_bin' % prefix, node_bin, str, 24))
+    out.append('')
+    out.append('const EPS_ForestBinned eps_%s_forest_binned = {' % prefix)
+    out.append('    .n_features = %d,' % forest.n_features)
+    out.append('    .n_slots = %d,' % len(slot_feature))
+    out.append('    .n_trees = %d,' % len(roots))
+    out.append('    .n_nodes = %d,' % len(feature))
+    out.append('    .n_leaves = %d,' % len(leaves))
+    out.append('    .scale = %s,' % _c_double(forest.scale))
+    out.append('    .split_offset = %s_bn_split_offset,' % prefix)
+    out.append('    .split = %s_bn_split,' % prefix)
+    out.append('    .slot_feature = %s_bn_slot_feature,' % prefix)
+    out.append('    .slot_base = %s_bn_slot_base,' % prefix)
+    out.append('    .roots = %s_roots,' % prefix)
+    out.append('    .slot = %s_bn_slot,' % prefix)
+    out.append('    .bin = %s_bn_bin,' % prefix)
+    out.append('    .children = %s_children,' % prefix)
+    out.append('    .leaf_value = %s_leaf_value,' % prefix)
+    out.append('};')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+
+    # Implicit perfect trees (padded to IMPLICIT_DEPTH)
+    im_feature, im_threshold, im_leaves = implicit_tables(forest)
+    out.append(_backend_guard('IMPLICIT'))
+    out.append('')
+    out.append('#if EPS_IMPLICIT_DEPTH != %d' % IMPLICIT_DEPTH)
+    out.append('#error "tables generated for EPS_IMPLICIT_DEPTH %d"' % IMPLICIT_DEPTH)
+    out.append('#endif')
+    out.append('')
+    out.append(_c_array('uint8_t', '%s_im_feature' % prefix, im_feature, str, 24))
+    out.append('')
+    out.append(_c_array('double', '%s_im_threshold' % prefix, im_threshold, _c_double, 4))
+    out.append('')
+    out.append(_c_array('double', '%s_im_leaf_value' % prefix, im_leaves, _c_double, 4))
+    out.append('')
+    out.append('const EPS_ForestImplicit eps_%s_forest_implicit = {' % prefix)
+    out.append('    .n_features = %d,' % forest.n_features)
+    out.append('    .n_trees = %d,' % len(roots))
+    out.append('    .scale = %s,' % _c_double(forest.scale))
+    out.append('    .feature = %s_im_feature,' % prefix)
+    out.append('    .threshold = %s_im_threshold,' % prefix)
+    out.append('    .leaf_value = %s_im_leaf_value,' % prefix)
+    out.append('};')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+
+    # Model API (eps_model_abi.h); no double entry points in FPU-free and
+    # single-precision builds
+    out.append('uint16_t %s_n_features(void) {' % api)
+    out.append('    return %s_N_FEATURES;' % macro)
+    out.append('}')
+    out.append('')
+    out.append('uint32_t %s_hash(void) {' % api)
+    out.append('    return %s_HASH;' % macro)
+    out.append('}')
+    out.append('')
+    out.append('#if EPS_FOREST_BACKEND != EPS_FOREST_BACKEND_FIXED && EPS_FOREST_BACKEND != EPS_FOREST_BACKEND_FLOAT32')
+    out.append('')
+    out.append('double %s_score(const double *x) {' % api)
+    out.append('#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_QUICKSCORER')
+    out.append('    return eps_qs_score(&eps_%s_forest_qs, x);' % prefix)
+    out.append('#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_QUANTIZED')
+    out.append('    return eps_forest_q_score(&eps_%s_forest_q, x);' % prefix)
+    out.append('#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_IMPLICIT')
+    out.append('    return eps_forest_implicit_score(&eps_%s_forest_implicit, x);' % prefix)
+    out.append('#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_BINNED')
+    out.append('    return eps_forest_binned_score(&eps_%s_forest_binned, x);' % prefix)
+    out.append('#else')
+    out.append('    return eps_forest_score(&eps_%s_forest, x);' % prefix)
+    out.append('#endif')
+    out.append('}')
+    out.append('')
+    out.append('void %s_score_batch(const double x[][%s_N_FEATURES], double *out, int n) {' % (api, macro))
+    for cond, call in (('#if EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_QUICKSCORER', 'eps_qs_score_batch(&eps_%s_forest_qs'),
+                       ('#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_QUANTIZED', 'eps_forest_q_score_batch(&eps_%s_forest_q'),
+                       ('#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_IMPLICIT',
+                        'eps_forest_implicit_score_batch(&eps_%s_forest_implicit'),
+                       ('#elif EPS_FOREST_BACKEND == EPS_FOREST_BACKEND_BINNED',
+                        'eps_forest_binned_score_batch(&eps_%s_forest_binned'),
+                       ('#else', 'eps_forest_score_batch(&eps_%s_forest')):
+        out.append(cond)
+        out.append('    %s, &x[0][0], %s_N_FEATURES, out, n);' % (call % prefix, macro))
+    out.append('#endif')
+    out.append('}')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+    return '\n'.join(out)
+
+
+def emit_multi_tables(forest, prefix, source_desc):
+    """Node tables with row-major vector leaves (eps_forest_multi.h)."""
+    roots, feature, threshold, children, leaves = flatten(forest)
+    out = []
+    out.append('/**')
+    out.append(' * EPS Predictive FDIR - %s model (multi-target RandomForest)' % prefix.capitalize())
+    out.append(' * Generated by eps_forest_export.py from %s -- do not edit' % source_desc)
+    out.append(' *')
+    out.append(' * Trees: %d, internal nodes: %d, leaves: %d (%d distinct), features: %d, outputs: %s'
+               % (len(roots), len(feature), len(feature) + len(roots), len(leaves), forest.n_features,
+                  ', '.join(MULTI_TARGETS[:forest.n_outputs])))
+    out.append(' */')
+    out.append('')
+    out.append('#include "eps_forest_multi.h"')
+    out.append('')
+    out.append(_c_array('int16_t', '%s_roots' % prefix, roots, str, 16))
+    out.append('')
+    out.append(_c_array('uint8_t', '%s_feature' % prefix, feature, str, 24))
+    out.append('')
+    out.append(_c_array('double', '%s_threshold' % prefix, threshold, _c_double, 4))
+    out.append('')
+    out.append(_c_array('int16_t', '%s_children' % prefix, children, str, 16))
+    out.append('')
+    out.append(_c_array('double', '%s_leaf_value' % prefix, [v for leaf in leaves for v in leaf],
+                        _c_double, forest.n_outputs))
+    out.append('')
+    out.append('const EPS_ForestMulti eps_%s_forest_multi = {' % prefix)
+    out.append('    .n_features = %d,' % forest.n_features)
+    out.append('    .n_outputs = %d,' % forest.n_outputs)
+    out.append('    .n_trees = %d,' % len(roots))
+    out.append('    .n_nodes = %d,' % len(feature))
+    out.append('    .n_leaves = %d,' % len(leaves))
+    out.append('    .scale = %s,' % _c_double(forest.scale))
+    out.append('    .roots = %s_roots,' % prefix)
+    out.append('    .feature = %s_feature,' % prefix)
+    out.append('    .threshold = %s_threshold,' % prefix)
+    out.append('    .children = %s_children,' % prefix)
+    out.append('    .leaf_value = %s_leaf_value,' % prefix)
+    out.append('};')
+    out.append('')
+    return '\n'.join(out)
+
+
+# ===== BINARY BLOB (eps_forest_blob.h) =====
+
+BLOB_MAGIC = 0x46535045  # "EPSF"
+BLOB_VERSION = 1
+BLOB_HEADER = struct.Struct('<IHHII HHHH d IIIIII')
+BLOB_CRC_START = 16      # CRC covers everything after magic/version/sizes/crc
+
+# Split/path profile of the instrumented runtime (eps_forest_profile.h)
+PROFILE_MAGIC = 0x50535045  # "EPSP"
+PROFILE_VERSION = 1
+PROFILE_HEADER = struct.Struct('<IHHHHHHII')
+
+
+def _align8(buf):
+    buf.extend(b'\0' * (-len(buf) % 8))
+    return len(buf)
+
+
+def emit_blob(forest):
+    """Little-endian, 8-byte aligned, CRC-32 protected image of the node tables."""
+    roots, feature, threshold, children, leaves = flatten(forest)
+    body = bytearray(BLOB_HEADER.size)
+    offsets = {}
+    for name, fmt, values in (('threshold', 'd', threshold), ('leaf_value', 'd', leaves),
+                              ('children', 'h', children), ('roots', 'h', roots),
+                              ('feature', 'B', feature)):
+        offsets[name] = _align8(body)
+        body.extend(struct.pack('<%d%s' % (len(values), fmt), *values))
+    total = _align8(body)
+
+    def header(crc):
+        return BLOB_HEADER.pack(BLOB_MAGIC, BLOB_VERSION, BLOB_HEADER.size, total, crc,
+                                forest.n_features, len(roots), len(feature), len(leaves),
+                                forest.scale,
+                                offsets['threshold'], offsets['leaf_value'], offsets['children'],
+                                offsets['roots'], offsets['feature'], 0)
+
+    body[:BLOB_HEADER.size] = header(0)
+    body[:BLOB_HEADER.size] = header(zlib.crc32(bytes(body[BLOB_CRC_START:])))
+    return bytes(body)
+
+
+_telemetry_rows = {}
+
+
+def telemetry_rows(paths=TELEMETRY, fixed=False):
+    """Concatenated (power_rows, voltage_rows) of every telemetry file."""
+    key = (tuple(paths), fixed)
+    if key not in _telemetry_rows:
+        power_rows, voltage_rows = [], []
+        for path in paths:
+            p, v = load_telemetry_rows(path, fixed)
+            power_rows += p
+            voltage_rows += v
+        _telemetry_rows[key] = (power_rows, voltage_rows)
+    return _telemetry_rows[key]
+
+
+def leaf_error_report(forest, clustered, key, telemetry):
+    """(MAE before, MAE after, largest prediction change) on the HOLDOUT file, or None."""
+    paths = [p for p in telemetry if os.path.basename(p).startswith(HOLDOUT)]
+    if not paths:
+        return None
+    power_rows, voltage_rows, power_y, voltage_y = load_telemetry_rows(paths[0], targets=True)
+    rows, y = (power_rows, power_y) if key == 'power' else (voltage_rows, voltage_y)
+    mae = mae_clustered = worst = 0.0
+    for x, target in zip(rows, y):
+        a, b = forest.predict(x), clustered.predict(x)
+        mae += abs(a - target)
+        mae_clustered += abs(b - target)
+        worst = max(worst, abs(a - b))
+    return mae / len(rows), mae_clustered / len(rows), worst
+
+
+def read_blob_tables(path):
+    """(crc, roots, feature, threshold, children) of a model blob written by emit_blob()."""
+    with open(path, 'rb') as f:
+        blob = f.read()
+    (magic, version, _, _, crc, _, n_trees, n_nodes, _, _,
+     off_threshold, _, off_children, off_roots, off_feature, _) = BLOB_HEADER.unpack_from(blob)
+    assert magic == BLOB_MAGIC and version == BLOB_VERSION, '%s: not a model blob' % path
+    roots = struct.unpack_from('<%dh' % n_trees, blob, off_roots)
+    feature = struct.unpack_from('<%dB' % n_nodes, blob, off_feature)
+    threshold = struct.unpack_from('<%dd' % n_nodes, blob, off_threshold)
+    children = struct.unpack_from('<%dh' % (2 * n_nodes), blob, off_children)
+    return crc, roots, feature, threshold, children
+
+
+def read_profile(path):
+    """(model hash, branch counts) of a record written by eps_forest_profile_serialize()."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    (magic, version, max_depth, n_trees, n_nodes, n_features, _,
+     model_hash, _) = PROFILE_HEADER.unpack_from(data)
+    assert magic == PROFILE_MAGIC and version == PROFILE_VERSION, '%s: not a forest profile' % path
+    n_words = 2 * n_nodes + n_trees * (max_depth + 1) + n_features
+    size = PROFILE_HEADER.size + 4 * n_words
+    assert len(data) == size + 4 and struct.unpack_from('<I', data, size)[0] == zlib.crc32(data[:size]), \
+        '%s: truncated or corrupt profile' % path
+    return model_hash, struct.unpack_from('<%dI' % (2 * n_nodes), data, PROFILE_HEADER.size)
+
+
+def profile_from_counts(forest, tables, branch):
+    """Map per-node branch counts of the table layout in tables onto forest's nodes."""
+    _, roots, feature, threshold, children = tables
+    assert len(roots) == len(forest.trees), 'profile: tree count differs from the model'
+    profile = {}
+
+    def walk(node, idx):
+        if is_leaf(node):
+            assert idx < 0, 'profile: tree shape differs from the model'
+            return
+        assert idx >= 0 and feature[idx] == node[0] and threshold[idx] == node[1], \
+            'profile: split differs from the model'
+        profile[id(node)] = [branch[2 * idx], branch[2 * idx + 1]]
+        walk(node[2], children[2 * idx])
+        walk(node[3], children[2 * idx + 1])
+
+    for tree, root in zip(forest.trees, roots):
+        walk(tree, root)
+    return profile
+
+
+def apply_profile(forest, key, profile, c_dir=C_CODE_DIR):
+    """Set forest.profile from the files in profile (None: pre-order layout).
+
+    Replay files are scored on the model here. Profiles recorded by the
+    instrumented C runtime (*.prof, deploy/host/profile_forest.c) count
+    nodes by table index; they are mapped back through the model blob they
+    were recorded on, which must still be the one in c_dir. Counts of all
+    files add up.
+    """
+    if not profile:
+        return
+    replays = [p for p in profile if not p.endswith('.prof')]
+    counts = profile_forest(forest, telemetry_rows(replays)[0 if key == 'power' else 1]) if replays else {}
+    recorded = [p for p in profile if p.endswith('.prof')]
+    if recorded:
+        blob_path = os.path.join(c_dir, MODELS[key][2].replace('.c', '.bin'))
+        tables = read_blob_tables(blob_path)
+        matched = 0
+        for path in recorded:
+            model_hash, branch = read_profile(path)
+            if model_hash != tables[0]:
+                continue
+            matched += 1
+            for node, (n_left, n_right) in profile_from_counts(forest, tables, branch).items():
+                c = counts.setdefault(node, [0, 0])
+                c[0] += n_left
+                c[1] += n_right
+        if not matched and not replays:
+            sys.exit(f'{key}: no profile in {" ".join(recorded)} was recorded on {blob_path} '
+                     f'(hash 0x{tables[0]:08X}); re-run deploy/host/profile_forest on the current tables')
+    forest.profile = counts
+
+
+def export_forest(forest, key, source_desc, c_dir=C_CODE_DIR, models_dir=MODELS_DIR,
+                  telemetry=TELEMETRY, profile=None, leaf_error=0.0):
+    fn, prefix, c_file, json_file = MODELS[key]
+    n_spec = len(eps_feature_spec.features(FEATURE_SPEC, key))
+    assert forest.n_features == n_spec, \
+        '%s: model reads %d features, feature_spec.json defines %d' % (key, forest.n_features, n_spec)
+    forest.function_name = fn
+    power_rows, voltage_rows = telemetry_rows(telemetry)
+    rows = power_rows if key == 'power' else voltage_rows
+
+    # The JSON keeps the trained leaves; clustering only affects the C tables and blob
+    os.makedirs(models_dir, exist_ok=True)
+    json_path = os.path.join(models_dir, json_file)
+    forest_to_json(forest, json_path)
+    n_distinct = len(flatten(forest)[4])
+    trained = forest
+    if leaf_error > 0:
+        forest = cluster_leaves(forest, leaf_error)
+
+    apply_profile(forest, key, profile, c_dir)
+    quant = quantize_forest(forest, rows)
+    bad = check_quantized_paths(forest, quant, rows)
+    assert bad == 0, '%s: %d quantized tree paths differ from the double model' % (key, bad)
+
+    # Fixed-point backend: same scheme on the integer rows
+    fixed_rows = telemetry_rows(telemetry, fixed=True)[0 if key == 'power' else 1]
+    quant_fixed = quantize_forest(forest, fixed_rows, unit=FIXED_MODEL_UNIT[key])
+    bad = check_quantized_paths(forest, quant_fixed, rows, code_rows=fixed_rows)
+    assert bad == 0, '%s: %d fixed-point tree paths differ from the double model' % (key, bad)
+
+    # The blob CRC doubles as the model hash of the generated API
+    blob = emit_blob(forest)
+    model_hash = BLOB_HEADER.unpack_from(blob)[4]
+    c_path = os.path.join(c_dir, c_file)
+    h_path = os.path.splitext(c_path)[0] + '.h'
+    with open(h_path, 'w', newline='\r\n') as f:
+        f.write(emit_model_header(forest, prefix, source_desc, model_hash))
+    with open(c_path, 'w', newline='\r\n') as f:
+        f.write(emit_tables(forest, prefix, source_desc, quant, quant_fixed, FIXED_MODEL_UNIT[key]))
+
+    blob_path = os.path.splitext(c_path)[0] + '.bin'
+    with open(blob_path, 'wb') as f:
+        f.write(blob)
+
+    print(f"✓ {key}: {len(forest.trees)} trees, {forest.n_features} features")
+    print(f"  {json_path} ({os.path.getsize(json_path) / 1024:.1f} KB)")
+    print(f"  {c_path} ({os.path.getsize(c_path) / 1024:.1f} KB), {h_path} (hash 0x{model_hash:08X})")
+    print(f"  {blob_path} ({os.path.getsize(blob_path) / 1024:.1f} KB)")
+    n_splits = sum(len(q[3]) for q in quant['features'])
+    q_bytes = 7 * len(quant['threshold']) + 4 * len(quant['leaves']) + 8 * n_splits
+    print(f"  quantized: {q_bytes / 1024:.1f} KB of tables, {n_splits} split values, "
+          f"paths exact on {len(rows)} telemetry rows")
+    n_splits = sum(len(q[3]) for q in quant_fixed['features'])
+    print(f"  fixed-point: {n_splits} split values, paths exact on {len(fixed_rows)} telemetry rows")
+    split_offset, split, slot_feature = binned_tables(forest)[:3]
+    n_nodes, n_leaves = len(flatten(forest)[1]), len(flatten(forest)[4])
+    n_refs = n_nodes + len(forest.trees)
+    print(f"  leaf pool: {n_refs} leaves, {n_distinct} distinct values "
+          f"(-{8 * (n_refs - n_distinct) / 1024:.1f} KB)")
+    if leaf_error > 0:
+        print(f"  leaf clustering (max error {leaf_error:g} {UNITS[key]}): {n_distinct} -> {n_leaves} values "
+              f"(-{8 * (n_distinct - n_leaves) / 1024:.1f} KB)")
+        report = leaf_error_report(trained, forest, key, telemetry)
+        if report:
+            print(f"  {HOLDOUT} MAE {report[0]:.4f} -> {report[1]:.4f} {UNITS[key]}, "
+                  f"largest prediction change {report[2]:.4g} {UNITS[key]}")
+    bn_bytes = 6 * n_nodes + 8 * n_leaves + 8 * len(split) + 3 * len(slot_feature) + 2 * len(split_offset)
+    print(f"  binned: {len(split)} distinct thresholds in {len(slot_feature)} uint8 slots, "
+          f"{bn_bytes / 1024:.1f} KB of tables (node tables {(13 * n_nodes + 8 * n_leaves) / 1024:.1f} KB)")
+    print(f"  float32: {(9 * n_nodes + 4 * n_leaves) / 1024:.1f} KB of tables, "
+          f"thresholds rounded down so float rows keep their double paths")
+    if forest.profile is not None:
+        hot, n_hot = hot_path_stats(forest)
+        print(f"  layout: {n_hot} hot-path nodes first ({13 * n_hot / 1024:.1f} KB), "
+              f"{100 * hot:.1f}% of replayed splits take the hot child")
+    return c_path
+
+
+def export_multi_forest(forest, source_desc, c_dir=C_CODE_DIR, models_dir=MODELS_DIR):
+    fn, prefix, c_file, json_file = MULTI_MODEL
+    assert forest.n_features == 15 and forest.n_outputs == len(MULTI_TARGETS), \
+        'panel model must map the 15 power + voltage features to P, V, I (EPS_PANEL_* in eps_forest_multi.h)'
+    forest.function_name = fn
+
+    os.makedirs(models_dir, exist_ok=True)
+    json_path = os.path.join(models_dir, json_file)
+    forest_to_json(forest, json_path)
+
+    c_path = os.path.join(c_dir, c_file)
+    with open(c_path, 'w', newline='\r\n') as f:
+        f.write(emit_multi_tables(forest, prefix, source_desc))
+
+    print(f"✓ {prefix}: {len(forest.trees)} trees, {forest.n_features} features, "
+          f"{forest.n_outputs} outputs")
+    print(f"  {json_path} ({os.path.getsize(json_path) / 1024:.1f} KB)")
+    print(f"  {c_path} ({os.path.getsize(c_path) / 1024:.1f} KB)")
+    return c_path
+
+
+def panel_rows(paths):
+    """Panel model rows (power then voltage features) and [P uW, V mV, I mA] targets."""
+    rows, y = [], []
+    for path in paths:
+        power_rows, voltage_rows, power_y, voltage_y = load_telemetry_rows(path, targets=True)
+        for p, v, py, vy in zip(power_rows, voltage_rows, power_y, voltage_y):
+            rows.append(p + v)
+            y.append([py, vy, py / vy if vy else 0.0])
+    return rows, y
+
+
+def fit_synthetic_multi(rows, y, trees, depth, min_leaf, sample, candidates, seed):
+    """Seeded random-split multi-output forest: per node, the best of a few random
+    (feature, row value) splits by squared error, each output relative to its range.
+
+    Only a fixture for the EPS_MULTI_TARGET build and its checks; not a trained model.
+    """
+    rng = random.Random(seed)
+    n_features, n_outputs = len(rows[0]), len(y[0])
+    spread = [(max(t[k] for t in y) - min(t[k] for t in y)) or 1.0 for k in range(n_outputs)]
+
+    def mean(idx):
+        return [sum(y[i][k] for i in idx) / len(idx) for k in range(n_outputs)]
+
+    def cost(idx):
+        m = mean(idx)
+        return sum(((y[i][k] - m[k]) / spread[k]) ** 2 for i in idx for k in range(n_outputs))
+
+    def grow(idx, level):
+        if level == depth or len(idx) < 2 * min_leaf:
+            return mean(idx)
+        best = None
+        for _ in range(candidates):
+            f = rng.randrange(n_features)
+            threshold = rows[rng.choice(idx)][f]        # A value the node's rows take
+            left = [i for i in idx if rows[i][f] <= threshold]
+            right = [i for i in idx if rows[i][f] > threshold]
+            if len(left) < min_leaf or len(right) < min_leaf:
+                continue
+            c = cost(left) + cost(right)
+            if best is None or c < best[0]:
+                best = (c, f, threshold, left, right)
+        if best is None:
+            return mean(idx)
+        _, f, threshold, left, right = best
+        return (f, threshold, grow(left, level + 1), grow(right, level + 1))
+
+    forest_trees = [grow([rng.randrange(len(rows)) for _ in range(sample)], 0) for _ in range(trees)]
+    return MultiForest(n_features, n_outputs, forest_trees, 1.0 / trees)
+
+
+def write_multi_predictions(forest, paths, out_dir):
+    """<out_dir>/<replay>_panel.csv: the forest's P, V, I for every replay row (deploy/host/multi_check.c)."""
+    os.makedirs(out_dir, exist_ok=True)
+    for path in paths:
+        rows, _ = panel_rows([path])
+        out = os.path.join(out_dir, os.path.splitext(os.path.basename(path))[0] + '_panel.csv')
+        with open(out, 'w') as f:
+            f.write(','.join(MULTI_TARGETS) + '\n')
+            for x in rows:
+                f.write(','.join(repr(v) for v in forest.predict(x)) + '\n')
+        print(f"✓ {out} ({len(rows)} rows)")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('--from-m2cgen', action='store_true',
+                    help='import the legacy m2cgen sources in deploy/c_code instead of the JSON models')
+    ap.add_argument('--emit-m2cgen', metavar='DIR',
+                    help='write m2cgen-style branchy C for both models to DIR and exit')
+    ap.add_argument('--telemetry', nargs='+', default=TELEMETRY,
+                    help='telemetry (.xlsx or replay .csv) on which quantized splits must stay exact')
+    ap.add_argument('--symbol-prefix', default='',
+                    help='prefix for the --emit-m2cgen function names (e.g. ref_ to link next to the tables)')
+    ap.add_argument('--profile', nargs='+', metavar='REPLAY',
+                    help='telemetry, or *.prof files from deploy/host/profile_forest, whose split '
+                         'statistics put each tree\'s hot path first (default: pre-order layout)')
+    ap.add_argument('--leaf-error', nargs='+', default=[], metavar='MODEL=ERROR',
+                    help='cluster leaf values to at most ERROR from the trained value '
+                         '(power in uW, voltage in mV), e.g. power=100 voltage=0.5')
+    ap.add_argument('--multi-target', metavar='PKL',
+                    help='export a multi-output RandomForestRegressor (.pkl) as the P/V/I panel model and exit')
+    ap.add_argument('--synthetic-multi-target', action='store_true',
+                    help='fit a seeded random-split stand-in P/V/I panel model on --telemetry, export it and exit')
+    ap.add_argument('--multi-predictions', metavar='DIR',
+                    help='write the panel model\'s predictions for each --telemetry file to DIR and exit')
+    args = ap.parse_args()
+    profile = args.profile
+    leaf_error = {}
+    for item in args.leaf_error:
+        key, _, value = item.partition('=')
+        if key not in MODELS or not value:
+            ap.error('--leaf-error expects power=ERROR and/or voltage=ERROR, got %r' % item)
+        leaf_error[key] = float(value)
+
+    if args.multi_target:
+        import joblib
+        forest = forest_from_sklearn(joblib.load(args.multi_target))
+        export_multi_forest(forest, os.path.basename(args.multi_target))
+        return
+
+    if args.synthetic_multi_target:
+        rows, y = panel_rows(args.telemetry)
+        forest = fit_synthetic_multi(rows, y, **SYNTHETIC_MULTI)
+        names = ', '.join(os.path.basename(p) for p in args.telemetry)
+        export_multi_forest(forest, 'a synthetic random-split fit on %s (seed %d)'
+                            % (names, SYNTHETIC_MULTI['seed']))
+        return
+
+    if args.multi_predictions:
+        forest = forest_from_json(os.path.join(MODELS_DIR, MULTI_MODEL[3]))
+        write_multi_predictions(forest, args.telemetry, args.multi_predictions)
+        return
+
+    if not args.emit_m2cgen:
+        spec_h = os.path.join(C_CODE_DIR, 'eps_feature_spec.h')
+        with open(spec_h, 'w', newline='') as f:
+            f.write(emit_feature_header(FEATURE_SPEC))
+        print(f"✓ {spec_h}")
+
+    for key, (fn, prefix, c_file, json_file) in MODELS.items():
+        if args.from_m2cgen:
+            src = os.path.join(C_CODE_DIR, c_file)
+            forest = forest_from_m2cgen(src)
+            with open(src, newline='') as f:
+                assert emit_m2cgen(forest) == f.read(), f'{src}: round trip mismatch'
+            desc = 'm2cgen output (%s)' % c_file
+        else:
+            forest = forest_from_json(os.path.join(MODELS_DIR, json_file))
+            desc = json_file
+
+        if args.emit_m2cgen:
+            if leaf_error.get(key):
+                forest = cluster_leaves(forest, leaf_error[key])
+            os.makedirs(args.emit_m2cgen, exist_ok=True)
+            path = os.path.join(args.emit_m2cgen, c_file.replace('.c', '_m2cgen.c'))
+            with open(path, 'w', newline='') as f:
+                f.write(emit_m2cgen(forest, args.symbol_prefix))
+            print(f"✓ {path}")
+        else:
+            export_forest(forest, key, desc, telemetry=args.telemetry, profile=profile,
+                          leaf_error=leaf_error.get(key, 0.0))
+
+    # The panel model exists once a multi-target forest has been exported
+    panel_json = os.path.join(MODELS_DIR, MULTI_MODEL[3])
+    if os.path.exists(panel_json) and not args.from_m2cgen and not args.emit_m2cgen:
+        export_multi_forest(forest_from_json(panel_json), MULTI_MODEL[3])
+
+
+if __name__ == '__main__':
+    main()
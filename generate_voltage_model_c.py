@@ -1,11 +1,11 @@
 """
 Generate C code for Voltage RandomForest Model
-Uses m2cgen to convert pruned voltage model to C
+Converts the pruned voltage model to the table-driven format (eps_forest_export.py)
 """
 
 import joblib
-import m2cgen
 import os
+from eps_forest_export import forest_from_sklearn, export_forest
 
 # Configuration
 MODELS_DIR = 'deploy/models'
@@ -32,15 +32,11 @@ print(f"Model features: {voltage_model.n_features_in_}")
 
 # Generate C code
 print("Generating C code...")
-c_code = m2cgen.export_to_c(voltage_model, function_name='score_voltage')
-
-# Save to file
-output_path = os.path.join(C_CODE_DIR, 'voltage_model.c')
-with open(output_path, 'w') as f:
-    f.write(c_code)
+forest = forest_from_sklearn(voltage_model, function_name='score_voltage')
+output_path = export_forest(forest, 'voltage', voltage_model_file, c_dir=C_CODE_DIR, models_dir=MODELS_DIR)
 
 print(f"✓ C code generated: {output_path}")
-print(f"✓ Function name: score_voltage(double* input)")
+print(f"✓ Function name: eps_model_voltage_score(const double* x) (voltage_model.h)")
 print(f"✓ Input size: {voltage_model.n_features_in_} features")
 
 # Verify file size
@@ -58,8 +54,5 @@ print("\n" + "="*60)
 print("SUCCESS! Voltage model C code generated.")
 print("="*60)
 print("\nNext steps:")
-print("1. Update eps_main_deployment.c line 203:")
-print("   Replace: return (float)features[0];")
-print("   With:    return (float)score_voltage(features);")
-print("2. Add header: #include \"voltage_model.h\"")
-print("3. Recompile and test")
+print("1. Copy voltage_model.c and eps_forest.c/.h into the STM32 project")
+print("2. Recompile and test")